@@ -13,6 +13,8 @@
 
 #include "bbserver_flightlog.h"
 #include "ContribFile.h"
+#include "MetadataArchive.h"
+#include "MetadataCache.h"
 
 
 /*
@@ -27,6 +29,21 @@ int ContribFile::loadContribFile(ContribFile* &pContribFile, const bfs::path& pC
     FL_Write(FLMetaData, CF_Load, "loadContribFile, counter=%ld", l_FL_Counter, 0, 0, 0);
 
     pContribFile = NULL;
+
+    // Return a copy of the cached archive if the file has not changed since it was cached
+    struct stat l_Stat;
+    bool l_Cacheable = (stat(pContribFileName.c_str(), &l_Stat) == 0);
+    if (l_Cacheable)
+    {
+        pContribFile = metadataCache.findContribFile(pContribFileName.string(), l_Stat);
+        if (pContribFile)
+        {
+            FL_Write(FLMetaData, CF_Load_Cached, "loadContribFile, cached archive returned, counter=%ld", l_FL_Counter, 0, 0, 0);
+
+            return 0;
+        }
+    }
+
     ContribFile* l_ContribFile = new ContribFile();
 
     struct timeval l_StartTime = timeval {.tv_sec=0, .tv_usec=0}, l_StopTime = timeval {.tv_sec=0, .tv_usec=0};
@@ -43,9 +60,7 @@ int ContribFile::loadContribFile(ContribFile* &pContribFile, const bfs::path& pC
         try
         {
             LOG(bb,debug) << "Reading:" << pContribFileName;
-            ifstream l_ArchiveFile{pContribFileName.c_str()};
-            text_iarchive l_Archive{l_ArchiveFile};
-            l_Archive >> *l_ContribFile;
+            loadMetadataArchive(pContribFileName.c_str(), *l_ContribFile);
             pContribFile = l_ContribFile;
         }
         catch(archive_exception& e)
@@ -98,6 +113,14 @@ int ContribFile::loadContribFile(ContribFile* &pContribFile, const bfs::path& pC
             l_ContribFile = NULL;
         }
     }
+    else if (l_Cacheable)
+    {
+        struct stat l_LoadedStat;
+        if (stat(pContribFileName.c_str(), &l_LoadedStat) == 0)
+        {
+            metadataCache.addContribFile(pContribFileName.string(), l_Stat, l_LoadedStat, pContribFile);
+        }
+    }
 
     FL_Write(FLMetaData, CF_Load_End, "loadContribFile, counter=%ld, rc=%ld", l_FL_Counter, rc, 0, 0);
 
@@ -118,9 +141,8 @@ int ContribFile::save(const string& pContribFileName)
     try
     {
         LOG(bb,debug) << "Writing:" << pContribFileName;
-        ofstream l_ArchiveFile{pContribFileName};
-        text_oarchive l_Archive{l_ArchiveFile};
-        l_Archive << *this;
+        metadataCache.invalidate(pContribFileName);
+        saveMetadataArchive(pContribFileName.c_str(), *this);
     }
     catch(ExceptionBailout& e) { }
     catch(exception& e)
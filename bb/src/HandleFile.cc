@@ -20,6 +20,8 @@
 #include "ContribIdFile.h"
 #include "HandleFile.h"
 #include "LVUuidFile.h"
+#include "MetadataArchive.h"
+#include "MetadataCache.h"
 #include "tracksyscall.h"
 #include <dirent.h>
 
@@ -45,6 +47,27 @@ bool accessDir(const std::string& pF)
     return true;
 }
 
+// NOTE: Returns 1 if the location of the handle is cached and the handle directory
+//       can still be accessed.  The handle directory goes away with a removejobinfo
+//       and the directories of the job are only accessible to the job owner.
+static int cachedHandleDirectory(const uint64_t pHandle, uint64_t& pJobId, uint64_t& pJobStepId, bfs::path& pHandleDir)
+{
+    int rc = 0;
+
+    if (metadataCache.findHandle(pHandle, pJobId, pJobStepId))
+    {
+        char l_HandleDir[PATH_MAX] = {'\0'};
+        snprintf(l_HandleDir, sizeof(l_HandleDir), "%s/%lu/%lu/%s/%lu", g_BBServer_Metadata_Path.c_str(), pJobId, pJobStepId, HandleFile::getToplevelHandleName(pHandle).c_str(), pHandle);
+        if (accessDir(l_HandleDir))
+        {
+            pHandleDir = bfs::path(l_HandleDir);
+            rc = 1;
+        }
+    }
+
+    return rc;
+}
+
 int HandleFile::createLockFile(const char* pFilePath)
 {
     int rc = 0;
@@ -187,16 +210,29 @@ int HandleFile::get_xbbServerGetJobForHandle(uint64_t& pJobId, uint64_t& pJobSte
     uint64_t l_FL_Counter = metadataCounter.getNext();
     FL_Write(FLMetaData, HF_GetJobForHandle, "get jobid for handle, counter=%ld, handle=%ld", l_FL_Counter, pHandle, 0, 0);
 
-    // First, build a vector of jobids that the current uid/gid is authorized to access.
-    // We will iterate over these jobids in reverse order, as it is almost always
-    // the case that the jobid we want is the last one...
-    //
-    // NOTE: If we take an exception in the loop below, we do not rebuild this vector
-    //       of jobids.  The job could go away, but any jobid expected by the code
-    //       below should be in the vector.
-    rc = get_xbbServerGetCurrentJobIds(l_PathJobIds);
+    // If the location of the handle is cached, there is no need to search the jobs
+    bfs::path l_HandleDir;
+    bool l_Cached = (cachedHandleDirectory(pHandle, pJobId, pJobStepId, l_HandleDir) == 1);
+    if (!l_Cached)
+    {
+        pJobId = UNDEFINED_JOBID;
+        pJobStepId = UNDEFINED_JOBSTEPID;
 
-    if (!rc)
+        // First, build a vector of jobids that the current uid/gid is authorized to access.
+        // We will iterate over these jobids in reverse order, as it is almost always
+        // the case that the jobid we want is the last one...
+        //
+        // NOTE: If we take an exception in the loop below, we do not rebuild this vector
+        //       of jobids.  The job could go away, but any jobid expected by the code
+        //       below should be in the vector.
+        rc = get_xbbServerGetCurrentJobIds(l_PathJobIds);
+    }
+
+    if (l_Cached)
+    {
+        rc = 0;
+    }
+    else if (!rc)
     {
         rc = -1;
         bool l_AllDone = false;
@@ -224,6 +260,7 @@ int HandleFile::get_xbbServerGetJobForHandle(uint64_t& pJobId, uint64_t& pJobSte
                                     rc = 0;
                                     pJobId = stoull(job.filename().string());
                                     pJobStepId = stoull(jobstep.path().filename().string());
+                                    metadataCache.addHandle(pHandle, pJobId, pJobStepId);
                                     break;
                                 }
                             }
@@ -300,6 +337,53 @@ int HandleFile::get_xbbServerHandleInfo(uint64_t& pJobId, uint64_t& pJobStepId,
 
     bool l_HandleFound = 0;
     bool l_Continue = true;
+
+    // If the location of the handle is cached, first try to load the handle
+    // and contrib files from that handle directory without searching the jobs
+    uint64_t l_CachedJobId = UNDEFINED_JOBID;
+    uint64_t l_CachedJobStepId = UNDEFINED_JOBSTEPID;
+    bfs::path l_CachedHandleDir;
+    if (cachedHandleDirectory(pHandle, l_CachedJobId, l_CachedJobStepId, l_CachedHandleDir) &&
+        ((!l_SearchOnlyWithinJobId) || l_CachedJobId == l_SavedJobId))
+    {
+        try
+        {
+            bfs::path handlefile = l_CachedHandleDir / ("^" + l_HandleStr);
+            if (!loadHandleFile(pHandleFile, handlefile.c_str()))
+            {
+                uint64_t l_NumberOfLVUuidReportingContribs = 0;
+                rc = ContribIdFile::loadContribIdFile(pContribIdFile, pNumberOfReportingContribs, l_NumberOfLVUuidReportingContribs, l_CachedHandleDir, pContribId);
+                if (rc == 0 || rc == 1)
+                {
+                    pJobId = l_CachedJobId;
+                    pJobStepId = l_CachedJobStepId;
+                    l_HandleFound = true;
+                    l_Continue = false;
+                }
+            }
+        }
+        catch(exception& e)
+        {
+            // NOTE: Most likely a concurrent removeJobInfo.  Search the jobs below.
+        }
+
+        rc = 0;
+        if (!l_HandleFound)
+        {
+            pNumberOfReportingContribs = 0;
+            if (pContribIdFile)
+            {
+                delete pContribIdFile;
+                pContribIdFile = 0;
+            }
+            if (pHandleFile)
+            {
+                delete pHandleFile;
+                pHandleFile = 0;
+            }
+        }
+    }
+
     while (l_Continue)
     {
         l_Continue = false;
@@ -356,6 +440,7 @@ int HandleFile::get_xbbServerHandleInfo(uint64_t& pJobId, uint64_t& pJobStepId,
                                 // Store the jobid and jobstepid values in the return variables...
                                 pJobId = l_JobId;
                                 pJobStepId = l_JobStepId;
+                                metadataCache.addHandle(pHandle, pJobId, pJobStepId);
 
                                 uint64_t l_NumberOfLVUuidReportingContribs = 0;
                                 rc = ContribIdFile::loadContribIdFile(pContribIdFile, pNumberOfReportingContribs, l_NumberOfLVUuidReportingContribs, handledir, pContribId);
@@ -655,6 +740,22 @@ int HandleFile::loadHandleFile(HandleFile* &pHandleFile, const char* pHandleFile
     FL_Write(FLMetaData, HF_Load, "loadHandleFile, counter=%ld", l_FL_Counter, 0, 0, 0);
 
     pHandleFile = NULL;
+
+    // Return a copy of the cached archive if the file has not changed since it was cached
+    struct stat l_Stat;
+    bool l_Cacheable = (stat(pHandleFileName, &l_Stat) == 0);
+    if (l_Cacheable)
+    {
+        pHandleFile = metadataCache.findHandleFile(pHandleFileName, l_Stat);
+        if (pHandleFile)
+        {
+            pHandleFile->lockfd = -1;
+            FL_Write(FLMetaData, HF_Load_Cached, "loadHandleFile, cached archive returned, counter=%ld", l_FL_Counter, 0, 0, 0);
+
+            return 0;
+        }
+    }
+
     HandleFile* l_HandleFile = new HandleFile();
 
     struct timeval l_StartTime = timeval {.tv_sec=0, .tv_usec=0}, l_StopTime = timeval {.tv_sec=0, .tv_usec=0};
@@ -671,9 +772,7 @@ int HandleFile::loadHandleFile(HandleFile* &pHandleFile, const char* pHandleFile
         try
         {
             LOG(bb,debug) << "Reading:" << pHandleFileName;
-            ifstream l_ArchiveFile{pHandleFileName};
-            text_iarchive l_Archive{l_ArchiveFile};
-            l_Archive >> *l_HandleFile;
+            loadMetadataArchive(pHandleFileName, *l_HandleFile);
             pHandleFile = l_HandleFile;
         }
         catch(archive_exception& e)
@@ -730,6 +829,12 @@ int HandleFile::loadHandleFile(HandleFile* &pHandleFile, const char* pHandleFile
             // NOTE: This value isn't really used anymore...  Has been replaed with
             //       thread_local handleFileLockFd.
             pHandleFile->lockfd = -1;
+
+            struct stat l_LoadedStat;
+            if (l_Cacheable && stat(pHandleFileName, &l_LoadedStat) == 0)
+            {
+                metadataCache.addHandleFile(pHandleFileName, l_Stat, l_LoadedStat, pHandleFile);
+            }
         }
     }
     else
@@ -1065,8 +1170,6 @@ int HandleFile::saveHandleFile(HandleFile* &pHandleFile, const LVKey* pLVKey, co
     snprintf(l_ArchivePath, sizeof(l_ArchivePath), "%s/%lu/%lu/%s/%lu", l_DataStorePath.c_str(), pJobId, pJobStepId, HandleFile::getToplevelHandleName(pHandle).c_str(), pHandle);
     snprintf(l_ArchivePathWithName, sizeof(l_ArchivePathWithName), "%s/^%lu", l_ArchivePath, pHandle);
     LOG(bb,info) << "saveHandleFile (created): l_ArchiveName=" << l_ArchivePathWithName;
-    ofstream l_ArchiveFile{l_ArchivePathWithName};
-    text_oarchive ha{l_ArchiveFile};
 
     try
     {
@@ -1077,7 +1180,7 @@ int HandleFile::saveHandleFile(HandleFile* &pHandleFile, const LVKey* pLVKey, co
         else
         {
             HandleFile l_HandleFile = HandleFile(pTag, pTagInfo);
-            ha << l_HandleFile;
+            saveMetadataArchive(l_ArchivePathWithName, l_HandleFile);
 //            l_HandleFile.dump("xbbServer: Saved handle file contents (created)");
 
             // Create file used to serialize access to the HandleFile
@@ -1091,6 +1194,10 @@ int HandleFile::saveHandleFile(HandleFile* &pHandleFile, const LVKey* pLVKey, co
             //       because when the load archive code is run it performs a close
             //       for the file which prematurely drops the file lock.
             rc = createLockFile(l_ArchivePath);
+            if (!rc)
+            {
+                metadataCache.addHandle(pHandle, pJobId, pJobStepId);
+            }
         }
     }
     catch(ExceptionBailout& e) { }
@@ -1125,14 +1232,13 @@ int HandleFile::saveHandleFile(HandleFile* &pHandleFile, const LVKey* pLVKey, co
     string l_DataStorePath = g_BBServer_Metadata_Path;
     snprintf(l_ArchiveName, sizeof(l_ArchiveName), "%s/%lu/%lu/%s/%lu/^%lu", l_DataStorePath.c_str(), pJobId, pJobStepId, HandleFile::getToplevelHandleName(pHandle).c_str(), pHandle, pHandle);
     LOG(bb,debug) << "saveHandleFile (existing):" << l_ArchiveName;
-    ofstream l_ArchiveFile{l_ArchiveName};
-    text_oarchive l_Archive{l_ArchiveFile};
+    metadataCache.invalidate(l_ArchiveName);
 
     if (pHandleFile)
     {
         try
         {
-            l_Archive << *pHandleFile;
+            saveMetadataArchive(l_ArchiveName, *pHandleFile);
 //            pHandleFile->dump("xbbServer: Saved handle file contents (passed)");
         }
         catch(ExceptionBailout& e) { }
@@ -15,6 +15,7 @@
 
 #include "bbserver_flightlog.h"
 #include "HandleInfo.h"
+#include "MetadataArchive.h"
 #include "TagInfo.h"
 #include "tracksyscall.h"
 #include "xfer.h"
@@ -75,9 +76,7 @@ int HandleInfo::load(HandleInfo* &pHandleInfo, const bfs::path& pHandleInfoName)
             try
             {
                 LOG(bb,debug) << "Reading:" << pHandleInfoName;
-                ifstream l_ArchiveFile{pHandleInfoName.c_str()};
-                text_iarchive l_Archive{l_ArchiveFile};
-                l_Archive >> *l_HandleInfo;
+                loadMetadataArchive(pHandleInfoName.c_str(), *l_HandleInfo);
             }
             catch(archive_exception& e)
             {
@@ -355,9 +354,7 @@ int HandleInfo::save()
     try
     {
         LOG(bb,debug) << "Writing:" << filename;
-        ofstream l_ArchiveFile{filename};
-        text_oarchive l_Archive{l_ArchiveFile};
-        l_Archive << *this;
+        saveMetadataArchive(filename.c_str(), *this);
     }
     catch(ExceptionBailout& e) { }
     catch(exception& e)
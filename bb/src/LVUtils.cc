@@ -2036,6 +2036,37 @@ int setupTransfer(BBTransferDef* transfer, Uuid &lvuuid, const uint64_t pJobId,
         transfer->setAll_CN_CP_TransfersInDefinition();
         transfer->setNoStageinOrStageoutTransfersInDefinition();
         uint32_t l_NextSourceIndexToProcess = 0;
+
+        if (pPerformOperation && (!config.get(process_whoami+".use_export_layout", false)))
+        {
+            // Fetch the FS extents of the local source files for stageout in parallel.
+            // protect() below then only translates the extents already fetched.
+            // NOTE: The file handle registry stays locked so the file handles cannot be
+            //       removed while the extents are being fetched.
+            vector<filehandle*> l_Prefetch;
+            FileHandleRegistryLock();
+            for(auto& e : transfer->extents)
+            {
+                filehandle* l_File = 0;
+                if ((pStats[e.sourceindex] == 0) ||
+                    (pStats[e.sourceindex]->st_dev == DO_NOT_TRANSFER_FILE &&
+                     pStats[e.sourceindex]->st_ino == DO_NOT_TRANSFER_FILE))
+                {
+                    continue;
+                }
+                if (isLocalFile(transfer->files[e.sourceindex]) && (!isLocalFile(transfer->files[e.targetindex])) &&
+                    (findFilehandle(l_File, pJobId, pHandle, pContribId, e.sourceindex) == 0) && (l_File->getfd() >= 0))
+                {
+                    l_Prefetch.push_back(l_File);
+                }
+            }
+            if (l_Prefetch.size())
+            {
+                prefetchExtents(l_Prefetch, config.get(process_whoami+".numExtentLookupThreads", DEFAULT_NUMBER_OF_EXTENT_LOOKUP_THREADS));
+            }
+            FileHandleRegistryUnlock();
+        }
+
         for(auto& e : transfer->extents)
         {
             LOOP_COUNT(__FILE__,__FUNCTION__,"input extents");
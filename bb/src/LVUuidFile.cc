@@ -15,6 +15,7 @@
 #include "bbserver_flightlog.h"
 #include "HandleFile.h"
 #include "LVUuidFile.h"
+#include "MetadataArchive.h"
 
 
 /*
@@ -115,9 +116,7 @@ int LVUuidFile::load(const string& pLVUuidFileName)
         ++l_Attempts;
         try
         {
-            ifstream l_ArchiveFile{pLVUuidFileName};
-            text_iarchive l_Archive{l_ArchiveFile};
-            l_Archive >> *this;
+            loadMetadataArchive(pLVUuidFileName.c_str(), *this);
         }
         catch(archive_exception& e)
         {
@@ -176,9 +175,7 @@ int LVUuidFile::save(const string& pLVUuidFileName)
     try
     {
         LOG(bb,debug) << "Writing:" << pLVUuidFileName;
-        ofstream l_ArchiveFile{pLVUuidFileName};
-        text_oarchive l_Archive{l_ArchiveFile};
-        l_Archive << *this;
+        saveMetadataArchive(pLVUuidFileName.c_str(), *this);
     }
     catch(ExceptionBailout& e) { }
     catch(exception& e)
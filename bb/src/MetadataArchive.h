@@ -0,0 +1,171 @@
+/*******************************************************************************
+ |    MetadataArchive.h
+ |
+ |   Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#ifndef BB_METADATAARCHIVE_H_
+#define BB_METADATAARCHIVE_H_
+
+#include <fstream>
+#include <sstream>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <boost/archive/archive_exception.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+
+using namespace std;
+using namespace boost::archive;
+
+
+/*******************************************************************************
+ | Enumerators
+ *******************************************************************************/
+enum METADATA_ARCHIVE_FORMAT
+{
+    TEXT_METADATA_ARCHIVE   = 0,
+    BINARY_METADATA_ARCHIVE = 1
+};
+typedef enum METADATA_ARCHIVE_FORMAT METADATA_ARCHIVE_FORMAT;
+
+
+/*******************************************************************************
+ | External data
+ *******************************************************************************/
+extern METADATA_ARCHIVE_FORMAT g_MetadataArchiveFormat;
+
+
+/*******************************************************************************
+ | Constants
+ *******************************************************************************/
+// NOTE: All bbServers at this level read both formats.  Sites with bbServers at
+//       a prior level sharing the metadata set metadataArchiveFormat=text until
+//       all of them have been upgraded.
+const char DEFAULT_METADATA_ARCHIVE_FORMAT[] = "binary";
+
+// NOTE: Binary archives start with this marker.  Text archives start with the
+//       boost serialization signature, so both formats can be read regardless
+//       of the format the archive files are currently written in.
+const char BINARY_METADATA_ARCHIVE_MARKER[] = "bbmdbin1";
+const size_t BINARY_METADATA_ARCHIVE_MARKER_LENGTH = sizeof(BINARY_METADATA_ARCHIVE_MARKER) - 1;
+
+
+/*******************************************************************************
+ | Helper methods
+ *******************************************************************************/
+
+/*
+ * Load an object from a cross bbServer metadata archive file, in either format.
+ *
+ * NOTE: As with text_iarchive, a partially written archive file results in an
+ *       archive_exception so that the invoker can retry the load.
+ */
+template<class T> void loadMetadataArchive(const char* pArchiveFileName, T& pObject)
+{
+    ifstream l_ArchiveFile{pArchiveFileName, ios::in | ios::binary};
+    if (!l_ArchiveFile)
+    {
+        throw archive_exception(archive_exception::input_stream_error, pArchiveFileName);
+    }
+
+    char l_Marker[BINARY_METADATA_ARCHIVE_MARKER_LENGTH] = {'\0'};
+    l_ArchiveFile.read(l_Marker, sizeof(l_Marker));
+    if (l_ArchiveFile.gcount() == (streamsize)sizeof(l_Marker) && (!memcmp(l_Marker, BINARY_METADATA_ARCHIVE_MARKER, sizeof(l_Marker))))
+    {
+        binary_iarchive l_Archive{l_ArchiveFile};
+        l_Archive >> pObject;
+    }
+    else
+    {
+        // Text archive, as written by prior levels of bbServer
+        l_ArchiveFile.clear();
+        l_ArchiveFile.seekg(0);
+        text_iarchive l_Archive{l_ArchiveFile};
+        l_Archive >> pObject;
+    }
+
+    return;
+}
+
+/*
+ * Save an object to a cross bbServer metadata archive file, in the format
+ * selected by g_MetadataArchiveFormat.
+ *
+ * NOTE: The archive is written to a temporary file in the same directory, which
+ *       is then renamed over the archive file.  Every version of an archive file
+ *       is therefore a new inode, which is what allows the metadata cache to
+ *       detect a rewrite that leaves the size and the timestamps unchanged.
+ *       Readers never see a partially written archive.  The temporary file name
+ *       includes the host, so bbServers sharing the file system cannot collide.
+ */
+template<class T> void saveMetadataArchive(const char* pArchiveFileName, const T& pObject)
+{
+    char l_HostName[64] = {'\0'};
+    gethostname(l_HostName, sizeof(l_HostName)-1);
+    stringstream l_TempFileName;
+    l_TempFileName << pArchiveFileName << ".tmp." << l_HostName << "." << getpid() << "." << syscall(SYS_gettid);
+
+    int fd = ::open(l_TempFileName.str().c_str(), O_WRONLY | O_CREAT | O_EXCL, 0666);
+    if (fd < 0)
+    {
+        throw archive_exception(archive_exception::output_stream_error, pArchiveFileName);
+    }
+
+    // The new version keeps the owner and the mode of the version it replaces
+    struct stat l_Stat;
+    if (::stat(pArchiveFileName, &l_Stat) == 0)
+    {
+        if (::fchown(fd, l_Stat.st_uid, l_Stat.st_gid))
+        {
+            // Not permitted unless running as root, the invoker then owns the new version
+        }
+        ::fchmod(fd, l_Stat.st_mode & 07777);
+    }
+    ::close(fd);
+
+    try
+    {
+        ofstream l_ArchiveFile{l_TempFileName.str().c_str(), ios::out | ios::trunc | ios::binary};
+        if (g_MetadataArchiveFormat == BINARY_METADATA_ARCHIVE)
+        {
+            l_ArchiveFile.write(BINARY_METADATA_ARCHIVE_MARKER, BINARY_METADATA_ARCHIVE_MARKER_LENGTH);
+            binary_oarchive l_Archive{l_ArchiveFile};
+            l_Archive << pObject;
+        }
+        else
+        {
+            text_oarchive l_Archive{l_ArchiveFile};
+            l_Archive << pObject;
+        }
+
+        l_ArchiveFile.close();
+        if (l_ArchiveFile.fail() || ::rename(l_TempFileName.str().c_str(), pArchiveFileName))
+        {
+            throw archive_exception(archive_exception::output_stream_error, pArchiveFileName);
+        }
+    }
+    catch(...)
+    {
+        ::unlink(l_TempFileName.str().c_str());
+        throw;
+    }
+
+    return;
+}
+
+#endif /* BB_METADATAARCHIVE_H_ */
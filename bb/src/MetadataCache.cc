@@ -0,0 +1,349 @@
+/*******************************************************************************
+ |    MetadataCache.cc
+ |
+ |   Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bbinternal.h"
+#include "ContribFile.h"
+#include "HandleFile.h"
+#include "logging.h"
+#include "MetadataCache.h"
+
+
+/*
+ * Helper methods
+ */
+
+static int64_t nanoseconds(const struct timespec& pTime)
+{
+    return ((int64_t)pTime.tv_sec * 1000000000) + (int64_t)pTime.tv_nsec;
+}
+
+static uint64_t jobIdForPath(const string& pPath)
+{
+    // NOTE: Archive paths are of the form <metadata path>/<jobid>/...
+    uint64_t l_JobId = 0;
+    size_t l_Length = g_BBServer_Metadata_Path.length();
+    if (pPath.compare(0, l_Length, g_BBServer_Metadata_Path) == 0 && pPath.length() > l_Length+1 && pPath[l_Length] == '/')
+    {
+        l_JobId = strtoull(pPath.c_str()+l_Length+1, NULL, 10);
+    }
+
+    return l_JobId;
+}
+
+
+//
+// MetadataCache class
+//
+
+/*
+ * Static methods
+ */
+
+bool MetadataCache::sameVersion(const struct stat& pStat, const struct stat& pOther)
+{
+    return (pStat.st_ino == pOther.st_ino && pStat.st_size == pOther.st_size &&
+            nanoseconds(pStat.st_mtim) == nanoseconds(pOther.st_mtim) &&
+            nanoseconds(pStat.st_ctim) == nanoseconds(pOther.st_ctim));
+}
+
+
+/*
+ * Non-static methods
+ */
+
+MetadataCache::~MetadataCache()
+{
+    while (files.size())
+    {
+        remove(files.begin());
+    }
+    pthread_mutex_destroy(&lock);
+}
+
+void MetadataCache::add(const string& pPath, const struct stat& pStat, const struct stat& pLoadedStat, Entry& pEntry)
+{
+    pEntry.jobid = jobIdForPath(pPath);
+    pEntry.ino = pStat.st_ino;
+    pEntry.size = pStat.st_size;
+    pEntry.mtime = nanoseconds(pStat.st_mtim);
+    pEntry.ctime = nanoseconds(pStat.st_ctim);
+
+    pthread_mutex_lock(&lock);
+
+    map<string,Entry>::iterator it = files.find(pPath);
+    if (it != files.end())
+    {
+        remove(it);
+    }
+
+    // NOTE: If the file changed while it was being read, the archive may be
+    //       a mix of versions and it is not cached
+    if (maximumEntries && sameVersion(pStat, pLoadedStat))
+    {
+        lru.push_front(pPath);
+        pEntry.lru = lru.begin();
+        files[pPath] = pEntry;
+        prune();
+    }
+    else
+    {
+        delete pEntry.handleFile;
+        delete pEntry.contribFile;
+    }
+
+    pthread_mutex_unlock(&lock);
+
+    return;
+}
+
+void MetadataCache::addContribFile(const string& pPath, const struct stat& pStat, const struct stat& pLoadedStat, const ContribFile* pContribFile)
+{
+    Entry l_Entry;
+    l_Entry.contribFile = new ContribFile(*pContribFile);
+    add(pPath, pStat, pLoadedStat, l_Entry);
+
+    return;
+}
+
+void MetadataCache::addHandle(const uint64_t pHandle, const uint64_t pJobId, const uint64_t pJobStepId)
+{
+    pthread_mutex_lock(&lock);
+
+    map<uint64_t,Location>::iterator it = handles.find(pHandle);
+    if (it != handles.end())
+    {
+        removeHandle(it);
+    }
+    if (maximumEntries)
+    {
+        Location& l_Location = handles[pHandle];
+        l_Location.jobid = pJobId;
+        l_Location.jobstepid = pJobStepId;
+        handleLru.push_front(pHandle);
+        l_Location.lru = handleLru.begin();
+        prune();
+    }
+
+    pthread_mutex_unlock(&lock);
+
+    return;
+}
+
+void MetadataCache::addHandleFile(const string& pPath, const struct stat& pStat, const struct stat& pLoadedStat, const HandleFile* pHandleFile)
+{
+    Entry l_Entry;
+    l_Entry.handleFile = new HandleFile(*pHandleFile);
+    add(pPath, pStat, pLoadedStat, l_Entry);
+
+    return;
+}
+
+void MetadataCache::dump(const char* pSev, const char* pPrefix)
+{
+    stringstream l_Line;
+
+    pthread_mutex_lock(&lock);
+    if (pPrefix)
+    {
+        l_Line << pPrefix << ": ";
+    }
+    l_Line << "MetadataCache: handles=" << handles.size() << ", archives=" << files.size() << ", maximum archives=" << maximumEntries \
+           << ", hits=" << hits << ", misses=" << misses;
+    pthread_mutex_unlock(&lock);
+
+    if (!strcmp(pSev,"debug"))
+    {
+        LOG(bb,debug) << l_Line.str();
+    }
+    else if (!strcmp(pSev,"info"))
+    {
+        LOG(bb,info) << l_Line.str();
+    }
+
+    return;
+}
+
+MetadataCache::Entry* MetadataCache::find(const string& pPath, const struct stat& pStat)
+{
+    // NOTE: lock must be held by the invoker
+    Entry* l_Entry = 0;
+
+    map<string,Entry>::iterator it = files.find(pPath);
+    if (it != files.end())
+    {
+        // NOTE: Compared with the attributes recorded when the archive was read
+        Entry& l_Cached = it->second;
+        if (l_Cached.ino == pStat.st_ino && l_Cached.size == pStat.st_size &&
+            l_Cached.mtime == nanoseconds(pStat.st_mtim) && l_Cached.ctime == nanoseconds(pStat.st_ctim))
+        {
+            lru.splice(lru.begin(), lru, l_Cached.lru);
+            l_Entry = &l_Cached;
+        }
+        else
+        {
+            remove(it);
+        }
+    }
+
+    if (l_Entry)
+    {
+        ++hits;
+    }
+    else
+    {
+        ++misses;
+    }
+
+    return l_Entry;
+}
+
+ContribFile* MetadataCache::findContribFile(const string& pPath, const struct stat& pStat)
+{
+    ContribFile* l_ContribFile = 0;
+
+    pthread_mutex_lock(&lock);
+    Entry* l_Entry = find(pPath, pStat);
+    if (l_Entry && l_Entry->contribFile)
+    {
+        l_ContribFile = new ContribFile(*(l_Entry->contribFile));
+    }
+    pthread_mutex_unlock(&lock);
+
+    return l_ContribFile;
+}
+
+int MetadataCache::findHandle(const uint64_t pHandle, uint64_t& pJobId, uint64_t& pJobStepId)
+{
+    int rc = 0;
+
+    pthread_mutex_lock(&lock);
+    map<uint64_t,Location>::iterator it = handles.find(pHandle);
+    if (it != handles.end())
+    {
+        handleLru.splice(handleLru.begin(), handleLru, it->second.lru);
+        pJobId = it->second.jobid;
+        pJobStepId = it->second.jobstepid;
+        rc = 1;
+    }
+    pthread_mutex_unlock(&lock);
+
+    return rc;
+}
+
+HandleFile* MetadataCache::findHandleFile(const string& pPath, const struct stat& pStat)
+{
+    HandleFile* l_HandleFile = 0;
+
+    pthread_mutex_lock(&lock);
+    Entry* l_Entry = find(pPath, pStat);
+    if (l_Entry && l_Entry->handleFile)
+    {
+        l_HandleFile = new HandleFile(*(l_Entry->handleFile));
+    }
+    pthread_mutex_unlock(&lock);
+
+    return l_HandleFile;
+}
+
+void MetadataCache::invalidate(const string& pPath)
+{
+    pthread_mutex_lock(&lock);
+    map<string,Entry>::iterator it = files.find(pPath);
+    if (it != files.end())
+    {
+        remove(it);
+    }
+    pthread_mutex_unlock(&lock);
+
+    return;
+}
+
+void MetadataCache::prune()
+{
+    // NOTE: lock must be held by the invoker
+    while (files.size() > maximumEntries)
+    {
+        remove(files.find(lru.back()));
+    }
+    while (handles.size() > maximumEntries)
+    {
+        removeHandle(handles.find(handleLru.back()));
+    }
+
+    return;
+}
+
+void MetadataCache::remove(map<string,Entry>::iterator pEntry)
+{
+    // NOTE: lock must be held by the invoker
+    delete pEntry->second.handleFile;
+    delete pEntry->second.contribFile;
+    lru.erase(pEntry->second.lru);
+    files.erase(pEntry);
+
+    return;
+}
+
+void MetadataCache::removeHandle(map<uint64_t,Location>::iterator pLocation)
+{
+    // NOTE: lock must be held by the invoker
+    handleLru.erase(pLocation->second.lru);
+    handles.erase(pLocation);
+
+    return;
+}
+
+void MetadataCache::removeJob(const uint64_t pJobId)
+{
+    pthread_mutex_lock(&lock);
+    for (map<uint64_t,Location>::iterator it = handles.begin(); it != handles.end(); )
+    {
+        if (it->second.jobid == pJobId)
+        {
+            removeHandle(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    for (map<string,Entry>::iterator it = files.begin(); it != files.end(); )
+    {
+        if (it->second.jobid == pJobId)
+        {
+            remove(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    pthread_mutex_unlock(&lock);
+
+    dump("debug", "After removejobinfo");
+
+    return;
+}
+
+void MetadataCache::setMaximumEntries(const uint64_t pMaximumEntries)
+{
+    pthread_mutex_lock(&lock);
+    maximumEntries = pMaximumEntries;
+    prune();
+    pthread_mutex_unlock(&lock);
+
+    return;
+}
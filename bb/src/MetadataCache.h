@@ -0,0 +1,160 @@
+/*******************************************************************************
+ |    MetadataCache.h
+ |
+ |   Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#ifndef BB_METADATACACHE_H_
+#define BB_METADATACACHE_H_
+
+#include <list>
+#include <map>
+#include <string>
+
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+
+/*******************************************************************************
+ | Forward declarations
+ *******************************************************************************/
+class ContribFile;
+class HandleFile;
+class MetadataCache;
+
+
+/*******************************************************************************
+ | External data
+ *******************************************************************************/
+extern MetadataCache metadataCache;
+
+
+/*******************************************************************************
+ | Constants
+ *******************************************************************************/
+const uint64_t DEFAULT_BBSERVER_METADATA_CACHE_ENTRIES = 1024;
+
+
+/*******************************************************************************
+ | Classes
+ *******************************************************************************/
+
+/*
+ * MetadataCache
+ *
+ * In-memory copy of the handle and contrib archives in the xbbServer data store.
+ * Only the bbServer metadata on the parallel file system is the source of truth.
+ *
+ * Handle locations, handle -> (jobid, jobstepid), never change once the handle
+ * file is created.  A location is verified with an opendir() of the handle
+ * directory before it is used, which also enforces the directory permissions of
+ * the job for the requesting uid.
+ *
+ * Archive contents are indexed by the path of the archive file.  An archive is
+ * only cached if a stat() of the file after it was read matches the stat() taken
+ * before, and every lookup is validated against a stat() of the file, so updates
+ * made by other bbServers are always seen.  Only the attributes of the file are
+ * compared, never the time of this bbServer, as other bbServers set the mtime.
+ * Archives are replaced by a rename() of a new file, see saveMetadataArchive(),
+ * so a rewrite is a new inode even when the size and the timestamps, which are
+ * only as fine as the timestamp granule of the file system, are unchanged.
+ * Updates made by this bbServer drop the cached copy when the archive is written.
+ * A removejobinfo for a job, whether issued on this bbServer or received as an
+ * async request from another bbServer, drops all entries for the job.
+ *
+ * Both the archives and the handle locations are limited to the maximum number
+ * of entries, least recently used first.
+ */
+class MetadataCache
+{
+  public:
+    MetadataCache() :
+        maximumEntries(DEFAULT_BBSERVER_METADATA_CACHE_ENTRIES),
+        hits(0),
+        misses(0) {
+        pthread_mutex_init(&lock, NULL);
+    }
+
+    virtual ~MetadataCache();
+
+    /*
+     * Static methods
+     */
+    static bool sameVersion(const struct stat& pStat, const struct stat& pOther);
+
+    /*
+     * Non-static methods
+     */
+    void addContribFile(const string& pPath, const struct stat& pStat, const struct stat& pLoadedStat, const ContribFile* pContribFile);
+    void addHandle(const uint64_t pHandle, const uint64_t pJobId, const uint64_t pJobStepId);
+    void addHandleFile(const string& pPath, const struct stat& pStat, const struct stat& pLoadedStat, const HandleFile* pHandleFile);
+    void dump(const char* pSev, const char* pPrefix=0);
+    ContribFile* findContribFile(const string& pPath, const struct stat& pStat);
+    int findHandle(const uint64_t pHandle, uint64_t& pJobId, uint64_t& pJobStepId);
+    HandleFile* findHandleFile(const string& pPath, const struct stat& pStat);
+    void invalidate(const string& pPath);
+    void removeJob(const uint64_t pJobId);
+    void setMaximumEntries(const uint64_t pMaximumEntries);
+
+  private:
+    class Entry
+    {
+      public:
+        Entry() :
+            jobid(0),
+            ino(0),
+            size(0),
+            mtime(0),
+            ctime(0),
+            handleFile(0),
+            contribFile(0) {}
+
+        uint64_t                jobid;
+        ino_t                   ino;
+        off_t                   size;
+        int64_t                 mtime;
+        int64_t                 ctime;
+        HandleFile*             handleFile;
+        ContribFile*            contribFile;
+        list<string>::iterator  lru;
+    };
+
+    class Location
+    {
+      public:
+        Location() :
+            jobid(0),
+            jobstepid(0) {}
+
+        uint64_t                    jobid;
+        uint64_t                    jobstepid;
+        list<uint64_t>::iterator    lru;
+    };
+
+    void add(const string& pPath, const struct stat& pStat, const struct stat& pLoadedStat, Entry& pEntry);
+    Entry* find(const string& pPath, const struct stat& pStat);
+    void prune();
+    void remove(map<string,Entry>::iterator pEntry);
+    void removeHandle(map<uint64_t,Location>::iterator pLocation);
+
+    pthread_mutex_t lock;
+    uint64_t maximumEntries;
+    uint64_t hits;
+    uint64_t misses;
+    map<uint64_t, Location> handles;                    // handle -> (jobid, jobstepid)
+    list<uint64_t> handleLru;                           // handles, most recently used first
+    map<string, Entry> files;                           // archive path -> contents
+    list<string> lru;                                   // archive paths, most recently used first
+};
+
+#endif /* BB_METADATACACHE_H_ */
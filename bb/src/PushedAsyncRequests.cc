@@ -0,0 +1,218 @@
+/*******************************************************************************
+ |    PushedAsyncRequests.cc
+ |
+ |   Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#include <errno.h>
+#include <time.h>
+
+#include "PushedAsyncRequests.h"
+
+
+//
+// PushedAsyncRequests class
+//
+
+/*
+ * Static methods
+ */
+
+PushedAsyncRequests::DISPOSITION PushedAsyncRequests::classify(const int pSeqNbr, const uint64_t pOffset, const int pNextSeqNbr, const uint64_t pNextOffset)
+{
+    if (pSeqNbr == pNextSeqNbr && pOffset == pNextOffset)
+    {
+        return ENQUEUE;
+    }
+
+    // NOTE: A later offset means that requests before this one were not pushed
+    //       to this bbServer.  A later sequence number means that the async
+    //       request file was swapped.  Either way, read the async request file.
+    if (pSeqNbr > pNextSeqNbr || (pSeqNbr == pNextSeqNbr && pOffset > pNextOffset))
+    {
+        return READ_FILE;
+    }
+
+    return ALREADY_READ;
+}
+
+
+/*
+ * Non-static methods
+ */
+
+void PushedAsyncRequests::add(const int pSeqNbr, const uint64_t pOffset, const string& pRecord)
+{
+    pthread_mutex_lock(&lock);
+
+    requests[make_pair(pSeqNbr, pOffset)] = pRecord;
+
+    // Oldest requests have the lowest seqnbr/offset
+    while (requests.size() > maximumEntries)
+    {
+        requests.erase(requests.begin());
+    }
+
+    pthread_mutex_unlock(&lock);
+
+    return;
+}
+
+uint64_t PushedAsyncRequests::consecutive(const int pSeqNbr, const uint64_t pOffset, const size_t pRecordSize)
+{
+    uint64_t l_Count = 0;
+
+    pthread_mutex_lock(&lock);
+
+    map<pair<int, uint64_t>, string>::iterator it = requests.find(make_pair(pSeqNbr, pOffset));
+    while (it != requests.end() && it->first.first == pSeqNbr && it->first.second == pOffset + l_Count*pRecordSize)
+    {
+        ++l_Count;
+        ++it;
+    }
+
+    pthread_mutex_unlock(&lock);
+
+    return l_Count;
+}
+
+int PushedAsyncRequests::find(const int pSeqNbr, const uint64_t pOffset, string& pRecord)
+{
+    int rc = 0;
+
+    pthread_mutex_lock(&lock);
+
+    map<pair<int, uint64_t>, string>::iterator it = requests.find(make_pair(pSeqNbr, pOffset));
+    if (it != requests.end())
+    {
+        pRecord = it->second;
+        rc = 1;
+    }
+
+    pthread_mutex_unlock(&lock);
+
+    return rc;
+}
+
+uint64_t PushedAsyncRequests::verify(const int pSeqNbr, const uint64_t pOffset, const char* pRecords, const uint64_t pNumberOfRecords, const size_t pRecordSize)
+{
+    // NOTE: pRecords are the pNumberOfRecords records read from the async request
+    //       file starting at (pSeqNbr, pOffset).  Returns the number of consecutive
+    //       pushed requests from that position that are the same as the records in
+    //       the file.  A pushed request that differs from the file is dropped.
+    uint64_t l_Count = 0;
+
+    pthread_mutex_lock(&lock);
+
+    map<pair<int, uint64_t>, string>::iterator it = requests.find(make_pair(pSeqNbr, pOffset));
+    while (l_Count < pNumberOfRecords && it != requests.end() && it->first.first == pSeqNbr && it->first.second == pOffset + l_Count*pRecordSize)
+    {
+        if (it->second.size() != pRecordSize || it->second.compare(0, pRecordSize, pRecords + l_Count*pRecordSize, pRecordSize))
+        {
+            requests.erase(it);
+            break;
+        }
+        ++l_Count;
+        ++it;
+    }
+
+    pthread_mutex_unlock(&lock);
+
+    return l_Count;
+}
+
+size_t PushedAsyncRequests::size()
+{
+    pthread_mutex_lock(&lock);
+    size_t l_Size = requests.size();
+    pthread_mutex_unlock(&lock);
+
+    return l_Size;
+}
+
+
+//
+// AsyncRequestPushQueue class
+//
+
+/*
+ * Non-static methods
+ */
+
+uint64_t AsyncRequestPushQueue::getNumberDropped()
+{
+    pthread_mutex_lock(&lock);
+    uint64_t l_Dropped = dropped;
+    pthread_mutex_unlock(&lock);
+
+    return l_Dropped;
+}
+
+int AsyncRequestPushQueue::push(const PushedAsyncRequest& pRequest)
+{
+    int rc = 0;
+
+    pthread_mutex_lock(&lock);
+
+    if (!stopped)
+    {
+        if (requests.size() >= maximumEntries)
+        {
+            requests.pop_front();
+            ++dropped;
+            rc = 1;
+        }
+        requests.push_back(pRequest);
+        pthread_cond_signal(&cond);
+    }
+    else
+    {
+        rc = -1;
+    }
+
+    pthread_mutex_unlock(&lock);
+
+    return rc;
+}
+
+void AsyncRequestPushQueue::stop()
+{
+    pthread_mutex_lock(&lock);
+    stopped = 1;
+    requests.clear();
+    pthread_cond_broadcast(&cond);
+    pthread_mutex_unlock(&lock);
+
+    return;
+}
+
+int AsyncRequestPushQueue::wait(deque<PushedAsyncRequest>& pRequests, const unsigned int pTimeout)
+{
+    // NOTE: Returns the queued requests in pRequests, waiting up to pTimeout
+    //       seconds for one to be queued.  Returns -1 once the queue is stopped.
+    struct timespec l_Deadline;
+    clock_gettime(CLOCK_REALTIME, &l_Deadline);
+    l_Deadline.tv_sec += pTimeout;
+
+    pthread_mutex_lock(&lock);
+
+    int rc = 0;
+    while (!stopped && requests.empty() && rc != ETIMEDOUT)
+    {
+        rc = pthread_cond_timedwait(&cond, &lock, &l_Deadline);
+    }
+    pRequests.clear();
+    pRequests.swap(requests);
+    rc = (stopped ? -1 : 0);
+
+    pthread_mutex_unlock(&lock);
+
+    return rc;
+}
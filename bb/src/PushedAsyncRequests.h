@@ -0,0 +1,154 @@
+/*******************************************************************************
+ |    PushedAsyncRequests.h
+ |
+ |   Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#ifndef BB_PUSHEDASYNCREQUESTS_H_
+#define BB_PUSHEDASYNCREQUESTS_H_
+
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+
+#include <pthread.h>
+#include <stdint.h>
+
+using namespace std;
+
+
+/*******************************************************************************
+ | Constants
+ *******************************************************************************/
+const size_t MAXIMUM_NUMBER_OF_PUSHED_ASYNC_REQUESTS = 4096;        // Async requests pushed by other bbServers kept in memory
+const size_t MAXIMUM_NUMBER_OF_QUEUED_ASYNC_REQUEST_PUSHES = 4096;  // Async requests waiting to be pushed to other bbServers
+
+
+/*******************************************************************************
+ | Classes
+ *******************************************************************************/
+
+/*
+ * PushedAsyncRequest
+ *
+ * One async request record and its position in the async request file.
+ */
+class PushedAsyncRequest
+{
+  public:
+    PushedAsyncRequest() :
+        seqNbr(0),
+        offset(0) {}
+
+    PushedAsyncRequest(const int pSeqNbr, const uint64_t pOffset, const char* pRecord, const size_t pLength) :
+        seqNbr(pSeqNbr),
+        offset(pOffset),
+        record(pRecord, pLength) {}
+
+    int         seqNbr;
+    uint64_t    offset;
+    string      record;
+};
+
+/*
+ * PushedAsyncRequests
+ *
+ * Async requests pushed to this bbServer by other bbServers, keyed by their
+ * (sequence number, offset) in the async request file.  The file stays the
+ * source of truth.  A pushed request is only a hint that a record was
+ * appended to the file.  It is read from the file, and only enqueued if the
+ * record in the file is the same, when its position lines up with the next
+ * position to be read from the file.
+ */
+class PushedAsyncRequests
+{
+  public:
+    enum DISPOSITION
+    {
+        ENQUEUE         = 0,    // Next request to be read, verify it against the file and enqueue it
+        READ_FILE       = 1,    // Requests before this one were not pushed, read the file
+        ALREADY_READ    = 2     // Already read from the file, nothing to do
+    };
+
+    PushedAsyncRequests(const size_t pMaximumEntries=MAXIMUM_NUMBER_OF_PUSHED_ASYNC_REQUESTS) :
+        maximumEntries(pMaximumEntries) {
+        pthread_mutex_init(&lock, NULL);
+    }
+
+    virtual ~PushedAsyncRequests()
+    {
+        pthread_mutex_destroy(&lock);
+    }
+
+    /*
+     * Static methods
+     */
+    static DISPOSITION classify(const int pSeqNbr, const uint64_t pOffset, const int pNextSeqNbr, const uint64_t pNextOffset);
+
+    /*
+     * Non-static methods
+     */
+    void add(const int pSeqNbr, const uint64_t pOffset, const string& pRecord);
+    uint64_t consecutive(const int pSeqNbr, const uint64_t pOffset, const size_t pRecordSize);
+    int find(const int pSeqNbr, const uint64_t pOffset, string& pRecord);
+    size_t size();
+    uint64_t verify(const int pSeqNbr, const uint64_t pOffset, const char* pRecords, const uint64_t pNumberOfRecords, const size_t pRecordSize);
+
+  private:
+    pthread_mutex_t lock;
+    size_t maximumEntries;
+    map<pair<int, uint64_t>, string> requests;  // (seqnbr, offset) -> record
+};
+
+/*
+ * AsyncRequestPushQueue
+ *
+ * Async requests appended by this bbServer that still have to be pushed to
+ * the other bbServers.  Requesters only queue the request.  The sends are
+ * done by the async request peers thread, so that a slow or hung peer never
+ * stalls a requester.  When the queue is full, the oldest request is dropped.
+ * A peer that misses a request reads it from the async request file.
+ */
+class AsyncRequestPushQueue
+{
+  public:
+    AsyncRequestPushQueue(const size_t pMaximumEntries=MAXIMUM_NUMBER_OF_QUEUED_ASYNC_REQUEST_PUSHES) :
+        maximumEntries(pMaximumEntries),
+        dropped(0),
+        stopped(0) {
+        pthread_mutex_init(&lock, NULL);
+        pthread_cond_init(&cond, NULL);
+    }
+
+    virtual ~AsyncRequestPushQueue()
+    {
+        pthread_cond_destroy(&cond);
+        pthread_mutex_destroy(&lock);
+    }
+
+    /*
+     * Non-static methods
+     */
+    uint64_t getNumberDropped();
+    int push(const PushedAsyncRequest& pRequest);
+    void stop();
+    int wait(deque<PushedAsyncRequest>& pRequests, const unsigned int pTimeout);
+
+  private:
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    size_t maximumEntries;
+    uint64_t dropped;
+    int stopped;
+    deque<PushedAsyncRequest> requests;
+};
+
+#endif /* BB_PUSHEDASYNCREQUESTS_H_ */
@@ -12,6 +12,7 @@
  *******************************************************************************/
 
 #include "bbserver_flightlog.h"
+#include "MetadataArchive.h"
 #include "TagInfo.h"
 #include "tracksyscall.h"
 #include "xfer.h"
@@ -303,9 +304,7 @@ int TagInfo::load(TagInfo* &pTagInfo, const bfs::path& pTagInfoName)
             try
             {
                 LOG(bb,debug) << "Reading:" << pTagInfoName;
-                ifstream l_ArchiveFile{pTagInfoName.c_str()};
-                text_iarchive l_Archive{l_ArchiveFile};
-                l_Archive >> *l_TagInfo;
+                loadMetadataArchive(pTagInfoName.c_str(), *l_TagInfo);
             }
             catch(archive_exception& e)
             {
@@ -783,9 +782,7 @@ int TagInfo::save()
     try
     {
         LOG(bb,debug) << "Writing:" << filename;
-        ofstream l_ArchiveFile{filename};
-        text_oarchive l_Archive{l_ArchiveFile};
-        l_Archive << *this;
+        saveMetadataArchive(filename.c_str(), *this);
     }
     catch(ExceptionBailout& e) { }
     catch(exception& e)
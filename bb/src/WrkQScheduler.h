@@ -0,0 +1,261 @@
+/*******************************************************************************
+ |    WrkQScheduler.h
+ |
+ |   Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#ifndef BB_WRKQSCHEDULER_H_
+#define BB_WRKQSCHEDULER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/*******************************************************************************
+ | Constants
+ *******************************************************************************/
+const uint32_t WRKQ_TIMER_WHEEL_SLOTS = 64; // Throttle bucket intervals covered by one turn of the timer wheel
+
+
+/*******************************************************************************
+ | Enumerators
+ *******************************************************************************/
+enum WRKQE_SCHEDULE_STATE
+{
+    WRKQE_NOT_SCHEDULED     = 0,
+    WRKQE_ON_READY_RING     = 1,
+    WRKQE_ON_TIMER_WHEEL    = 2
+};
+typedef enum WRKQE_SCHEDULE_STATE WRKQE_SCHEDULE_STATE;
+
+
+/*******************************************************************************
+ | Classes
+ *******************************************************************************/
+
+/*
+ * WrkQScheduler
+ *
+ * The ready ring and timer wheel of the work queue manager.  Work queues that
+ * can be assigned are on the ready ring, which is visited round robin from the
+ * ready cursor.  Throttled work queues are parked on the timer wheel for the
+ * number of bucket load intervals until their bucket is no longer negative.
+ *
+ * Entries are linked through their schedNext/schedPrev members and record
+ * where they are in schedState, wheelSlot and wheelRounds.  Access is
+ * serialized by the invoker.
+ */
+template<class T>
+class WrkQScheduler
+{
+  public:
+    WrkQScheduler() :
+        readyCursor(0),
+        readyCount(0),
+        parkedCount(0),
+        wheelTick(0)
+    {
+        memset(timerWheel, 0, sizeof(timerWheel));
+    }
+
+    // Number of bucket load intervals until a bucket refilled at pRate per
+    // interval is no longer negative, at least one
+    static uint64_t intervalsFor(const int64_t pBucket, const uint64_t pRate)
+    {
+        uint64_t l_Intervals = 1;
+        if (pRate && pBucket < 0)
+        {
+            l_Intervals = ((uint64_t)(-pBucket) + pRate - 1) / pRate;
+            if (!l_Intervals)
+            {
+                l_Intervals = 1;
+            }
+        }
+
+        return l_Intervals;
+    }
+
+    inline T* getReadyCursor() const
+    {
+        return readyCursor;
+    }
+
+    inline size_t getReadyCount() const
+    {
+        return readyCount;
+    }
+
+    inline size_t getParkedCount() const
+    {
+        return parkedCount;
+    }
+
+    inline uint64_t getWheelTick() const
+    {
+        return wheelTick;
+    }
+
+    inline T* getParked(const uint32_t pSlot) const
+    {
+        return timerWheel[pSlot];
+    }
+
+    // Move the ready cursor past pEntry, which is on the ready ring
+    inline void skip(T* pEntry)
+    {
+        readyCursor = pEntry->schedNext;
+    }
+
+    // Advance the timer wheel by one bucket load interval.  Returns the work
+    // queues that are due, no longer scheduled and chained through schedNext.
+    // Work queues parked for a later turn of the wheel stay parked.
+    T* advance()
+    {
+        ++wheelTick;
+        uint32_t l_Slot = (uint32_t)(wheelTick % WRKQ_TIMER_WHEEL_SLOTS);
+        T* l_Entry = timerWheel[l_Slot];
+        T* l_Due = 0;
+        timerWheel[l_Slot] = 0;
+
+        while (l_Entry)
+        {
+            T* l_Next = l_Entry->schedNext;
+            l_Entry->schedPrev = 0;
+            if (l_Entry->wheelRounds)
+            {
+                // Not due until a later turn of the wheel
+                --l_Entry->wheelRounds;
+                pushSlot(l_Entry, l_Slot);
+            }
+            else
+            {
+                l_Entry->schedNext = l_Due;
+                l_Entry->schedState = WRKQE_NOT_SCHEDULED;
+                l_Due = l_Entry;
+                --parkedCount;
+            }
+            l_Entry = l_Next;
+        }
+
+        return l_Due;
+    }
+
+    // Insert the work queue at the tail of the ready ring,
+    // i.e., just before the next work queue to be returned
+    void insertReady(T* pEntry)
+    {
+        if (readyCursor)
+        {
+            T* l_Tail = readyCursor->schedPrev;
+            pEntry->schedPrev = l_Tail;
+            pEntry->schedNext = readyCursor;
+            l_Tail->schedNext = pEntry;
+            readyCursor->schedPrev = pEntry;
+        }
+        else
+        {
+            pEntry->schedPrev = pEntry;
+            pEntry->schedNext = pEntry;
+            readyCursor = pEntry;
+        }
+        pEntry->schedState = WRKQE_ON_READY_RING;
+        ++readyCount;
+
+        return;
+    }
+
+    // Park the work queue on the timer wheel until pIntervals more
+    // bucket load intervals have passed
+    void park(T* pEntry, const uint64_t pIntervals)
+    {
+        uint32_t l_Slot = (uint32_t)((wheelTick + pIntervals) % WRKQ_TIMER_WHEEL_SLOTS);
+        pEntry->wheelSlot = l_Slot;
+        pEntry->wheelRounds = (pIntervals - 1) / WRKQ_TIMER_WHEEL_SLOTS;
+        pushSlot(pEntry, l_Slot);
+        pEntry->schedState = WRKQE_ON_TIMER_WHEEL;
+        ++parkedCount;
+
+        return;
+    }
+
+    // Remove the work queue from the ready ring or timer wheel, if on either
+    void unlink(T* pEntry)
+    {
+        switch (pEntry->schedState)
+        {
+            case WRKQE_ON_READY_RING:
+            {
+                if (pEntry->schedNext == pEntry)
+                {
+                    readyCursor = 0;
+                }
+                else
+                {
+                    pEntry->schedPrev->schedNext = pEntry->schedNext;
+                    pEntry->schedNext->schedPrev = pEntry->schedPrev;
+                    if (readyCursor == pEntry)
+                    {
+                        readyCursor = pEntry->schedNext;
+                    }
+                }
+                --readyCount;
+            }
+            break;
+
+            case WRKQE_ON_TIMER_WHEEL:
+            {
+                if (pEntry->schedPrev)
+                {
+                    pEntry->schedPrev->schedNext = pEntry->schedNext;
+                }
+                else
+                {
+                    timerWheel[pEntry->wheelSlot] = pEntry->schedNext;
+                }
+                if (pEntry->schedNext)
+                {
+                    pEntry->schedNext->schedPrev = pEntry->schedPrev;
+                }
+                --parkedCount;
+            }
+            break;
+
+            default:
+                break;
+        }
+
+        pEntry->schedNext = 0;
+        pEntry->schedPrev = 0;
+        pEntry->schedState = WRKQE_NOT_SCHEDULED;
+
+        return;
+    }
+
+  private:
+    inline void pushSlot(T* pEntry, const uint32_t pSlot)
+    {
+        pEntry->schedPrev = 0;
+        pEntry->schedNext = timerWheel[pSlot];
+        if (timerWheel[pSlot])
+        {
+            timerWheel[pSlot]->schedPrev = pEntry;
+        }
+        timerWheel[pSlot] = pEntry;
+    }
+
+    T*          readyCursor;                        // Next work queue to be returned
+    size_t      readyCount;
+    size_t      parkedCount;
+    uint64_t    wheelTick;                          // Number of bucket load intervals
+    T*          timerWheel[WRKQ_TIMER_WHEEL_SLOTS];
+};
+
+#endif /* BB_WRKQSCHEDULER_H_ */
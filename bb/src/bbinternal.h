@@ -144,11 +144,13 @@ const double DEFAULT_BBSERVER_THROTTLE_TIME_INTERVAL = 0.25;
 const double MAXIMUM_BBSERVER_THROTTLE_TIME_INTERVAL = 1.00;                    // in seconds
 const double DEFAULT_BBSERVER_ASYNC_REQUEST_READ_TIME_INTERVAL = 25;            // in seconds
 const double MAXIMUM_BBSERVER_ASYNC_REQUEST_READ_TIME_INTERVAL = 100;           // in seconds
+const unsigned int DEFAULT_BBSERVER_ASYNC_REQUEST_PEER_RETRY_INTERVAL = 30;     // in seconds
 const double DEFAULT_BBSERVER_DUMP_LOCAL_ASYNC_TIME_INTERVAL = 180;             // in seconds
 const uint64_t MINIMUM_BBSERVER_DECLARE_SERVER_DEAD_VALUE = 120;                // in seconds (2 minutes)
 const uint64_t MAXIMUM_BBSERVER_DECLARE_SERVER_DEAD_VALUE = 600;                // in seconds (10 minutes)
 const unsigned int DEFAULT_BBSERVER_NUMBER_OF_LOCAL_ASYNC_REQUEST_THREADS = 48;
 const unsigned int DEFAULT_BBSERVER_NUMBER_OF_TRANSFER_THREADS = 24;
+const unsigned int DEFAULT_NUMBER_OF_EXTENT_LOOKUP_THREADS = 8;
 
 // NOTE: If the BB throttling rate is used to limit the amount of
 //       bandwidth BB consumes, the following default value should be
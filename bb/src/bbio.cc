@@ -15,6 +15,7 @@
 #include <queue>
 
 #include "bbio.h"
+#include "bbioengine.h"
 #include "bbinternal.h"
 #include "bbserver_flightlog.h"
 #include "Extent.h"
@@ -23,6 +24,32 @@
 extern size_t             transferBufferSize;
 thread_local char*        threadTransferBuffer;
 
+// SSD reads are done in 64K aligned blocks, so the slots of the transfer buffer ring share that alignment
+const size_t BBIO_SLOT_ALIGNMENT = 65536;
+
+enum BBIO_SLOT_STATE
+{
+    BBIO_SLOT_FREE     = 0,
+    BBIO_SLOT_INFLIGHT = 1,
+    BBIO_SLOT_DONE     = 2
+};
+
+// One part of the transfer buffer ring used by the pipelined performIO variants
+struct BBIOSlot
+{
+    BBIO_SLOT_STATE state;
+    char*           buffer;
+    size_t          length;
+    off_t           offset;
+    ssize_t         result;
+    uint64_t        time;
+};
+
+static size_t getSlotSize(BBIOEngine* pEngine)
+{
+    return (transferBufferSize / pEngine->getDepth()) & ~(BBIO_SLOT_ALIGNMENT-1);
+}
+
 static pthread_mutex_t    freeTransferBuffers_mutex = PTHREAD_MUTEX_INITIALIZER;
 static queue<void*>       freeTransferBuffers;
 static sem_t              numFreeBuffers;
@@ -228,6 +255,14 @@ int BBIO::performIO(LVKey& pKey, Extent* pExtent)
                               << " dst offset=0x" << setw(8) << offset_dst \
                               << " size=0x" << setw(8) << count \
                               << setfill(' ') << std::nouppercase << std::dec;
+
+                BBIOEngine* l_Engine = BBIOEngine::getThreadEngine();
+                if (l_Engine)
+                {
+                    setupTransferBuffer(pExtent->sourceindex);
+                    rc = performIOToSSD_Async(pExtent, l_Engine, ssd_fd, offset_src, offset_dst, count, l_ForceSSDWriteError, l_PostToReadGovernor);
+                }
+
                 while ((!rc) && count > 0)
                 {
                     setupTransferBuffer(pExtent->sourceindex);
@@ -354,6 +389,13 @@ int BBIO::performIO(LVKey& pKey, Extent* pExtent)
                              << " size=0x" << setw(8) << count \
                              << setfill(' ') << std::nouppercase << std::dec;
 
+                BBIOEngine* l_Engine = BBIOEngine::getThreadEngine();
+                if (l_Engine)
+                {
+                    setupTransferBuffer(pExtent->targetindex);
+                    rc = performIOToPFS_Async(pExtent, l_Engine, ssd_fd, offset_src, offset_dst, count, l_ForceSSDReadError, l_PostToWriteGovernor);
+                }
+
                 while ((!rc) && count > 0)
                 {
                     setupTransferBuffer(pExtent->targetindex);
@@ -489,6 +531,315 @@ int BBIO::performIO(LVKey& pKey, Extent* pExtent)
     return rc;
 }
 
+int BBIO::performIOToSSD_Async(Extent* pExtent, BBIOEngine* pEngine, const int pSSD_Fd, off_t& pOffsetSrc, off_t& pOffsetDst, size_t& pCount, const bool pForceSSDWriteError, int& pPostToReadGovernor)
+{
+    int rc = 0;
+
+    uint64_t l_Time;
+    ssize_t bytesRead;
+    uint32_t l_Depth = pEngine->getDepth();
+    size_t l_SlotSize = getSlotSize(pEngine);
+    if (!l_SlotSize)
+    {
+        // Transfer buffer too small to be split, use the synchronous loop
+        return rc;
+    }
+
+    vector<BBIOSlot> l_Slots(l_Depth);
+    for (uint32_t i=0; i<l_Depth; ++i)
+    {
+        l_Slots[i].state = BBIO_SLOT_FREE;
+        l_Slots[i].buffer = threadTransferBuffer + i * l_SlotSize;
+    }
+    uint32_t l_Next = 0;
+
+    // No matter how we leave, nothing may be in flight into the transfer buffer anymore
+    BBIOEngineGuard l_Guard(pEngine);
+
+    while ((!rc) && (pCount > 0 || pEngine->getNumInflight()))
+    {
+        uint64_t l_Done = l_Depth;
+        ssize_t l_Result = 0;
+
+        if (pCount > 0 && l_Slots[l_Next].state == BBIO_SLOT_FREE)
+        {
+            // Read the next chunk from the PFS while the earlier chunks are written to the SSD
+            BBIOSlot& l_Slot = l_Slots[l_Next];
+
+            if (l_SSD_Read_Governor_Active)
+            {
+                sem_wait(&l_SSD_Read_Governor);
+                pPostToReadGovernor = 1;
+            }
+
+            FL_Write6(FLXfer, APREAD_PFS, "Extent %p, reading from target index %ld into %p, len=%ld at offset 0x%lx", (uint64_t)pExtent, pExtent->sourceindex, (uint64_t)l_Slot.buffer, MIN(l_SlotSize, pCount), pOffsetSrc, 0);
+
+            transferDef->preProcessRead(l_Time);
+            //pread is bbio::pread derived
+            bytesRead = pread(pExtent->sourceindex, l_Slot.buffer, MIN(l_SlotSize, pCount), pOffsetSrc);
+            transferDef->postProcessRead(pExtent->sourceindex, l_Time);
+
+            if (pPostToReadGovernor)
+            {
+                pPostToReadGovernor = 0;
+                sem_post(&l_SSD_Read_Governor);
+            }
+
+            FL_Write(FLXfer, APREAD_PFSCMP, "Extent %p, reading from target index %ld.  bytesRead=%ld errno=%ld", (uint64_t)pExtent, pExtent->sourceindex, bytesRead, errno);
+
+            if (__glibc_unlikely(bytesRead <= 0))
+            {
+                FL_Write(FLXfer, APREAD_PFSFAIL, "Extent %p, read from PFS file failed.  sourceindex=%ld  offset_src=%ld  bytesRead=%ld", (uint64_t)pExtent, pExtent->sourceindex, pOffsetSrc, bytesRead);
+                rc = -1;
+                if (!bytesRead)
+                {
+                    stringstream errorText;
+                    errorText << "Read from PFS file ended before the extent was complete";
+                    LOG_ERROR_TEXT_ERRNO_AND_RAS(errorText, EIO, bb.sc.pread.ssd);
+                    bberror << err("rc", rc);
+                }
+                // Otherwise, BBIO subclass generated bberror and RAS
+                break;
+            }
+
+            if (pOffsetDst < 1024*1024)
+            {
+                // last ditch sanity check
+                throw runtime_error(string("Extent offset into SSD too low.  Offset=") + to_string(pOffsetDst));
+            }
+
+            l_Slot.length = ssdWriteAdjust(bytesRead);
+            l_Slot.offset = pOffsetDst;
+            l_Slot.result = bytesRead;  // bytes of the write that carry data, the rest is page pad
+            l_Slot.state = BBIO_SLOT_INFLIGHT;
+
+            FL_Write(FLXfer, AWRITE_SSD, "Extent %p, writing to SSD.  File descriptor %ld, length %ld at offset 0x%lx", (uint64_t)pExtent, pSSD_Fd, l_Slot.length, l_Slot.offset);
+
+            transferDef->preProcessWrite(l_Slot.time);
+            if (l_Slot.length != (size_t)bytesRead)
+            {
+                // Short read, the page pad overlaps the SSD range of the next chunk.  Write this chunk
+                // synchronously so the pad lands before the next chunk's data is submitted over it.
+                ssize_t l_Written = (!pForceSSDWriteError) ? ::pwrite(pSSD_Fd, l_Slot.buffer, l_Slot.length, l_Slot.offset) : -1;
+                l_Done = l_Next;
+                l_Result = (l_Written >= 0) ? l_Written : ((!pForceSSDWriteError) ? -errno : -EIO);
+            }
+            else
+            {
+                int l_SubmitRc = (!pForceSSDWriteError) ? pEngine->submit(BBIO_ENGINE_WRITE, pSSD_Fd, l_Slot.buffer, l_Slot.length, l_Slot.offset, l_Next) : -EIO;
+                if (l_SubmitRc)
+                {
+                    l_Done = l_Next;
+                    l_Result = l_SubmitRc;
+                }
+            }
+
+            pOffsetSrc += bytesRead;
+            pOffsetDst += bytesRead;
+            pCount     -= bytesRead;
+            l_Next = (l_Next + 1) % l_Depth;
+        }
+        else
+        {
+            threadLocalTrackSyscallPtr->nowTrack(TrackSyscall::SSDpwritesyscall, pSSD_Fd, __LINE__, l_SlotSize, pOffsetDst);
+            int l_ReapRc = pEngine->reap(l_Done, l_Result);
+            threadLocalTrackSyscallPtr->clearTrack();
+            if (l_ReapRc)
+            {
+                stringstream errorText;
+                rc = -1;
+                errorText << "Waiting for writes to remote SSD failed";
+                LOG_ERROR_TEXT_ERRNO_AND_RAS(errorText, -l_ReapRc, bb.sc.pwrite.ssd);
+                bberror << err("rc", rc);
+                break;
+            }
+        }
+
+        if (l_Done < l_Depth)
+        {
+            BBIOSlot& l_Slot = l_Slots[l_Done];
+            transferDef->postProcessWrite(pExtent->sourceindex, l_Slot.time);
+            l_Slot.state = BBIO_SLOT_FREE;
+
+            if (l_Result >= 0 && (size_t)l_Result < l_Slot.length)
+            {
+                // Finish a short write synchronously
+                ssize_t l_Rest = ::pwrite(pSSD_Fd, l_Slot.buffer + l_Result, l_Slot.length - l_Result, l_Slot.offset + l_Result);
+                l_Result = (l_Rest >= 0) ? l_Result + l_Rest : -errno;
+                if (l_Result >= 0 && (size_t)l_Result < l_Slot.length)
+                {
+                    l_Result = -EIO;
+                }
+            }
+
+            if ( __glibc_likely(l_Result >= 0) )
+            {
+                FL_Write6(FLXfer, AWRITE_SSDCMP, "Extent %p, write file descriptor %ld complete.  rc=%ld offset_dst=0x%lx sourceindex=%ld", (uint64_t)pExtent, pSSD_Fd, l_Slot.result, l_Slot.offset, pExtent->sourceindex, 0);
+            }
+            else
+            {
+                stringstream errorText;
+                FL_Write6(FLXfer, AWRITE_SSDFAIL, "Extent %p, write to remote SSD failed. fd=%ld  offset_dst=%ld  bytesWritten=%ld  errno=%ld", (uint64_t)pExtent, pSSD_Fd, l_Slot.offset, l_Result, -l_Result, 0);
+                rc = -1;
+                errorText << "Write to remote SSD failed";
+                LOG_ERROR_TEXT_ERRNO_AND_RAS(errorText, (int)-l_Result, bb.sc.pwrite.ssd);
+                bberror << err("rc", rc);
+            }
+        }
+    }
+
+    return rc;
+}
+
+int BBIO::performIOToPFS_Async(Extent* pExtent, BBIOEngine* pEngine, const int pSSD_Fd, off_t& pOffsetSrc, off_t& pOffsetDst, size_t& pCount, const bool pForceSSDReadError, int& pPostToWriteGovernor)
+{
+    int rc = 0;
+
+    const off_t BLKSIZE = BBIO_SLOT_ALIGNMENT-1;
+    uint64_t l_Time;
+    ssize_t bytesWritten;
+    uint32_t l_Depth = pEngine->getDepth();
+    size_t l_SlotSize = getSlotSize(pEngine);
+    if (!l_SlotSize)
+    {
+        // Transfer buffer too small to be split, use the synchronous loop
+        return rc;
+    }
+
+    vector<BBIOSlot> l_Slots(l_Depth);
+    for (uint32_t i=0; i<l_Depth; ++i)
+    {
+        l_Slots[i].state = BBIO_SLOT_FREE;
+        l_Slots[i].buffer = threadTransferBuffer + i * l_SlotSize;
+    }
+    uint32_t l_Head = 0;
+    uint32_t l_Next = 0;
+    off_t l_ReadPos = pOffsetSrc & (~BLKSIZE);
+    off_t l_ReadEnd = (pOffsetSrc + (off_t)pCount + BLKSIZE) & (~BLKSIZE);
+
+    // No matter how we leave, nothing may be in flight into the transfer buffer anymore
+    BBIOEngineGuard l_Guard(pEngine);
+
+    while ((!rc) && pCount > 0)
+    {
+        // Keep reads from the SSD in flight for the chunks after the one written to the PFS
+        while (l_ReadPos < l_ReadEnd && l_Slots[l_Next].state == BBIO_SLOT_FREE)
+        {
+            BBIOSlot& l_Slot = l_Slots[l_Next];
+            l_Slot.length = MIN(l_SlotSize, (size_t)(l_ReadEnd - l_ReadPos));
+            l_Slot.offset = l_ReadPos;
+
+            FL_Write(FLXfer, AREAD_SSD, "Reading from file descriptor %ld into %p, len=%ld at offset 0x%lx", pSSD_Fd, (uint64_t)l_Slot.buffer, l_Slot.length, l_Slot.offset);
+
+            transferDef->preProcessRead(l_Slot.time);
+            int l_SubmitRc = (!pForceSSDReadError) ? pEngine->submit(BBIO_ENGINE_READ, pSSD_Fd, l_Slot.buffer, l_Slot.length, l_Slot.offset, l_Next) : -EIO;
+            if (l_SubmitRc)
+            {
+                l_Slot.state = BBIO_SLOT_DONE;
+                l_Slot.result = l_SubmitRc;
+            }
+            else
+            {
+                l_Slot.state = BBIO_SLOT_INFLIGHT;
+            }
+            l_ReadPos += l_Slot.length;
+            l_Next = (l_Next + 1) % l_Depth;
+        }
+
+        // Wait for the oldest read
+        while (l_Slots[l_Head].state == BBIO_SLOT_INFLIGHT)
+        {
+            uint64_t l_Done;
+            ssize_t l_Result;
+            threadLocalTrackSyscallPtr->nowTrack(TrackSyscall::SSDpreadsyscall, pSSD_Fd, __LINE__, l_Slots[l_Head].length, l_Slots[l_Head].offset);
+            int l_ReapRc = pEngine->reap(l_Done, l_Result);
+            threadLocalTrackSyscallPtr->clearTrack();
+            if (l_ReapRc)
+            {
+                l_Done = l_Head;
+                l_Result = l_ReapRc;
+            }
+            l_Slots[l_Done].state = BBIO_SLOT_DONE;
+            l_Slots[l_Done].result = l_Result;
+            transferDef->postProcessRead(pExtent->sourceindex, l_Slots[l_Done].time);
+            if (l_ReapRc)
+            {
+                break;
+            }
+        }
+
+        BBIOSlot& l_Slot = l_Slots[l_Head];
+        if (l_Slot.result >= 0 && (size_t)l_Slot.result < l_Slot.length)
+        {
+            // Finish a short read synchronously
+            ssize_t l_Rest = ::pread(pSSD_Fd, l_Slot.buffer + l_Slot.result, l_Slot.length - l_Slot.result, l_Slot.offset + l_Slot.result);
+            l_Slot.result = (l_Rest >= 0) ? l_Slot.result + l_Rest : -errno;
+            if (l_Slot.result >= 0 && (size_t)l_Slot.result < l_Slot.length)
+            {
+                // Still short, the SSD does not hold the data this extent describes
+                l_Slot.result = -EIO;
+            }
+        }
+
+        ssize_t l_Length = MIN((ssize_t)pCount, l_Slot.result - (pOffsetSrc - l_Slot.offset));
+        if ( __glibc_unlikely(l_Slot.result < 0 || l_Length <= 0) )
+        {
+            stringstream errorText;
+            int l_Errno = (l_Slot.result < 0) ? (int)-l_Slot.result : EIO;
+            FL_Write6(FLXfer, AREAD_SSDFAIL, "Extent %p, read from remote SSD failed.  fd=%ld  offset_src=%ld  bytesRead=%ld  errno=%ld", (uint64_t)pExtent, pSSD_Fd, pOffsetSrc, l_Slot.result, l_Errno, 0);
+            rc = -1;
+            errorText << "Read from remote SSD failed";
+            LOG_ERROR_TEXT_ERRNO_AND_RAS(errorText, l_Errno, bb.sc.pread.ssd);
+            bberror << err("rc", rc);
+            break;
+        }
+
+        char* l_Buffer = l_Slot.buffer + (pOffsetSrc - l_Slot.offset);
+        while ((!rc) && l_Length > 0)
+        {
+            if (l_SSD_Write_Governor_Active)
+            {
+                sem_wait(&l_SSD_Write_Governor);
+                pPostToWriteGovernor = 1;
+            }
+
+            FL_Write6(FLXfer, APWRITE_PFS, "Extent %p, writing to target index %ld into %p, len=%ld at offset 0x%lx", (uint64_t)pExtent, pExtent->targetindex, (uint64_t)l_Buffer, l_Length, pOffsetDst, 0);
+
+            transferDef->preProcessWrite(l_Time);
+            // bbio::pwrite derived
+            bytesWritten = pwrite(pExtent->targetindex, l_Buffer, l_Length, pOffsetDst);
+            transferDef->postProcessWrite(pExtent->sourceindex, l_Time);
+
+            if (pPostToWriteGovernor)
+            {
+                pPostToWriteGovernor = 0;
+                sem_post(&l_SSD_Write_Governor);
+            }
+
+            if ( __glibc_likely(bytesWritten > 0) )
+            {
+                FL_Write6(FLXfer, APWRITE_PFSCMP, "Extent %p, write to PFS complete.  Target index=%ld, offset=0x%lx, length=%ld, bytes_written=%ld", (uint64_t)pExtent, pExtent->targetindex, pOffsetDst, l_Length, bytesWritten, 0);
+                pOffsetSrc += bytesWritten;
+                pOffsetDst += bytesWritten;
+                pCount     -= bytesWritten;
+                l_Buffer   += bytesWritten;
+                l_Length   -= bytesWritten;
+            }
+            else
+            {
+                FL_Write(FLXfer, APWRITE_PFSFAIL, "Extent %p, write to PFS file failed.  targetindex=%ld  offset_dst=%ld  bytesWritten=%ld", (uint64_t)pExtent, pExtent->targetindex, pOffsetDst, bytesWritten);
+                rc = -1;
+                // BBIO subclass generated bberror and RAS
+            }
+        }
+
+        l_Slot.state = BBIO_SLOT_FREE;
+        l_Head = (l_Head + 1) % l_Depth;
+    }
+
+    return rc;
+}
+
 void BBIO::setNumWritesNoSync(const uint32_t pFileIndex, const uint32_t pValue)
 {
     return;
@@ -37,6 +37,7 @@ extern string resolveServerConfigKey(const string& pKey);
 /*******************************************************************************
  | Forward declarations
  *******************************************************************************/
+class BBIOEngine;
 class Extent;
 
 
@@ -136,6 +137,11 @@ class BBIO
     // Pure virtual method implemented by derived class to write to the parallel file system.  Return value is number of bytes written.
     virtual ssize_t pwrite(uint32_t pFileIndex, const char* pBuffer, size_t pMaxBytesToWrite, off_t& pOffset) = 0;
 
+    // Pipelined variants of performIO() that keep several SSD I/Os in flight while the PFS I/O is done
+    // Both advance the offsets and count like the synchronous loop.  The count is left untouched if the pipeline cannot be used.
+    int performIOToSSD_Async(Extent* pExtent, BBIOEngine* pEngine, const int pSSD_Fd, off_t& pOffsetSrc, off_t& pOffsetDst, size_t& pCount, const bool pForceSSDWriteError, int& pPostToReadGovernor);
+    int performIOToPFS_Async(Extent* pExtent, BBIOEngine* pEngine, const int pSSD_Fd, off_t& pOffsetSrc, off_t& pOffsetDst, size_t& pCount, const bool pForceSSDReadError, int& pPostToWriteGovernor);
+
     int32_t             contribId;          ///<  Contributor for this transfer
     uint32_t            writesBetweenSyncs; ///<  If supported, number of writes between periodic fsyncs for PFS
     size_t              sizeBetweenSyncs;   ///<  If supported, size of writes between periodic fsyncs for PFS
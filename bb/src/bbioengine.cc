@@ -0,0 +1,420 @@
+/*******************************************************************************
+ |    bbioengine.cc
+ |
+ |  � Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+#include <linux/aio_abi.h>
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+
+#include "bbioengine.h"
+#include "logging.h"
+
+// NOTE: The kernel interfaces are used through their system calls so that bbServer
+//       does not pick up a dependency on liburing or libaio.
+#if defined(IORING_OFF_SQ_RING) && defined(__NR_io_uring_setup)
+#define BBIO_HAVE_IO_URING 1
+#endif
+
+extern string   transferEngine;
+extern uint32_t transferQueueDepth;
+
+thread_local BBIOEngine* threadIOEngine = NULL;
+thread_local bool        threadIOEngineInit = false;
+
+
+/*
+ * Per I/O bookkeeping shared by the engines.  The slot index is what the kernel
+ * hands back, the caller's tag is kept here.
+ */
+class BBIOEngineSlots
+{
+  public:
+    BBIOEngineSlots(const uint32_t pDepth) :
+        tags(pDepth),
+        iov(pDepth)
+    {
+        for (uint32_t i=pDepth; i>0; --i)
+        {
+            freeSlots.push_back(i-1);
+        }
+    };
+
+    inline int get(const uint64_t pTag, char* pBuffer, const size_t pLength)
+    {
+        if (freeSlots.empty())
+        {
+            return -1;
+        }
+        int l_Slot = freeSlots.back();
+        freeSlots.pop_back();
+        tags[l_Slot] = pTag;
+        iov[l_Slot].iov_base = pBuffer;
+        iov[l_Slot].iov_len = pLength;
+
+        return l_Slot;
+    };
+
+    inline uint64_t put(const uint32_t pSlot)
+    {
+        freeSlots.push_back(pSlot);
+
+        return tags[pSlot];
+    };
+
+    vector<uint64_t>     tags;
+    vector<struct iovec> iov;
+    vector<uint32_t>     freeSlots;
+};
+
+
+#ifdef BBIO_HAVE_IO_URING
+//
+// io_uring engine
+//
+
+class BBIOEngine_IoUring : public BBIOEngine
+{
+  public:
+    BBIOEngine_IoUring(const uint32_t pDepth) :
+        BBIOEngine(pDepth),
+        slots(pDepth),
+        ringFd(-1),
+        sqRing(MAP_FAILED),
+        cqRing(MAP_FAILED),
+        sqes(MAP_FAILED),
+        sqRingSize(0),
+        cqRingSize(0),
+        sqesSize(0) {};
+
+    virtual ~BBIOEngine_IoUring()
+    {
+        if (sqes != MAP_FAILED) munmap(sqes, sqesSize);
+        if (cqRing != MAP_FAILED) munmap(cqRing, cqRingSize);
+        if (sqRing != MAP_FAILED) munmap(sqRing, sqRingSize);
+        if (ringFd >= 0) ::close(ringFd);
+    };
+
+    int init()
+    {
+        struct io_uring_params l_Params;
+        memset(&l_Params, 0, sizeof(l_Params));
+
+        ringFd = syscall(__NR_io_uring_setup, depth, &l_Params);
+        if (ringFd < 0)
+        {
+            return -errno;
+        }
+
+        sqRingSize = l_Params.sq_off.array + l_Params.sq_entries * sizeof(uint32_t);
+        cqRingSize = l_Params.cq_off.cqes + l_Params.cq_entries * sizeof(struct io_uring_cqe);
+        sqesSize = l_Params.sq_entries * sizeof(struct io_uring_sqe);
+
+        sqRing = mmap(NULL, sqRingSize, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+        cqRing = mmap(NULL, cqRingSize, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+        sqes = mmap(NULL, sqesSize, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE, ringFd, IORING_OFF_SQES);
+        if (sqRing == MAP_FAILED || cqRing == MAP_FAILED || sqes == MAP_FAILED)
+        {
+            return -errno;
+        }
+
+        char* l_Sq = (char*)sqRing;
+        sqTail  = (uint32_t*)(l_Sq + l_Params.sq_off.tail);
+        sqMask  = *(uint32_t*)(l_Sq + l_Params.sq_off.ring_mask);
+        sqArray = (uint32_t*)(l_Sq + l_Params.sq_off.array);
+
+        char* l_Cq = (char*)cqRing;
+        cqHead = (uint32_t*)(l_Cq + l_Params.cq_off.head);
+        cqTail = (uint32_t*)(l_Cq + l_Params.cq_off.tail);
+        cqMask = *(uint32_t*)(l_Cq + l_Params.cq_off.ring_mask);
+        cqes   = (struct io_uring_cqe*)(l_Cq + l_Params.cq_off.cqes);
+
+        return 0;
+    };
+
+    virtual const char* getName() { return "io_uring"; };
+
+    virtual int submit(const BBIO_ENGINE_OP pOp, const int pFd, char* pBuffer, const size_t pLength, const off_t pOffset, const uint64_t pTag)
+    {
+        int l_Slot = slots.get(pTag, pBuffer, pLength);
+        if (l_Slot < 0)
+        {
+            return -EAGAIN;
+        }
+
+        uint32_t l_Tail = *sqTail;
+        uint32_t l_Index = l_Tail & sqMask;
+        struct io_uring_sqe* l_Sqe = &((struct io_uring_sqe*)sqes)[l_Index];
+        memset(l_Sqe, 0, sizeof(*l_Sqe));
+        l_Sqe->opcode = (pOp == BBIO_ENGINE_READ ? IORING_OP_READV : IORING_OP_WRITEV);
+        l_Sqe->fd = pFd;
+        l_Sqe->addr = (uint64_t)(uintptr_t)&slots.iov[l_Slot];
+        l_Sqe->len = 1;
+        l_Sqe->off = pOffset;
+        l_Sqe->user_data = l_Slot;
+        sqArray[l_Index] = l_Index;
+        __atomic_store_n(sqTail, l_Tail+1, __ATOMIC_RELEASE);
+
+        int rc;
+        do
+        {
+            rc = syscall(__NR_io_uring_enter, ringFd, 1, 0, 0, NULL, 0);
+        } while (rc < 0 && errno == EINTR);
+
+        if (rc < 1)
+        {
+            // The sqe was not consumed.  Take it back.
+            int l_Errno = (rc < 0 ? errno : EAGAIN);
+            __atomic_store_n(sqTail, l_Tail, __ATOMIC_RELEASE);
+            slots.put(l_Slot);
+            return -l_Errno;
+        }
+        ++numInflight;
+
+        return 0;
+    };
+
+    virtual int reap(uint64_t& pTag, ssize_t& pResult)
+    {
+        if (!numInflight)
+        {
+            return -ENOENT;
+        }
+
+        uint32_t l_Head = *cqHead;
+        while (l_Head == __atomic_load_n(cqTail, __ATOMIC_ACQUIRE))
+        {
+            int rc = syscall(__NR_io_uring_enter, ringFd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+            if (rc < 0 && errno != EINTR)
+            {
+                return -errno;
+            }
+        }
+
+        struct io_uring_cqe* l_Cqe = &cqes[l_Head & cqMask];
+        pTag = slots.put((uint32_t)l_Cqe->user_data);
+        pResult = l_Cqe->res;
+        __atomic_store_n(cqHead, l_Head+1, __ATOMIC_RELEASE);
+        --numInflight;
+
+        return 0;
+    };
+
+  private:
+    BBIOEngineSlots slots;
+    int ringFd;
+    void* sqRing;
+    void* cqRing;
+    void* sqes;
+    size_t sqRingSize;
+    size_t cqRingSize;
+    size_t sqesSize;
+    uint32_t* sqTail;
+    uint32_t sqMask;
+    uint32_t* sqArray;
+    uint32_t* cqHead;
+    uint32_t* cqTail;
+    uint32_t cqMask;
+    struct io_uring_cqe* cqes;
+};
+#endif
+
+
+//
+// Linux native AIO engine
+//
+// NOTE: Native AIO only runs asynchronously for O_DIRECT file descriptors.  Otherwise
+//       io_submit() completes the I/O before it returns.
+//
+
+class BBIOEngine_Aio : public BBIOEngine
+{
+  public:
+    BBIOEngine_Aio(const uint32_t pDepth) :
+        BBIOEngine(pDepth),
+        slots(pDepth),
+        ctx(0) {};
+
+    virtual ~BBIOEngine_Aio()
+    {
+        if (ctx)
+        {
+            syscall(__NR_io_destroy, ctx);
+        }
+    };
+
+    int init()
+    {
+        if (syscall(__NR_io_setup, depth, &ctx) < 0)
+        {
+            ctx = 0;
+            return -errno;
+        }
+
+        return 0;
+    };
+
+    virtual const char* getName() { return "aio"; };
+
+    virtual int submit(const BBIO_ENGINE_OP pOp, const int pFd, char* pBuffer, const size_t pLength, const off_t pOffset, const uint64_t pTag)
+    {
+        int l_Slot = slots.get(pTag, pBuffer, pLength);
+        if (l_Slot < 0)
+        {
+            return -EAGAIN;
+        }
+
+        struct iocb l_Iocb;
+        struct iocb* l_Iocbs[1] = { &l_Iocb };
+        memset(&l_Iocb, 0, sizeof(l_Iocb));
+        l_Iocb.aio_data = l_Slot;
+        l_Iocb.aio_lio_opcode = (pOp == BBIO_ENGINE_READ ? IOCB_CMD_PREAD : IOCB_CMD_PWRITE);
+        l_Iocb.aio_fildes = pFd;
+        l_Iocb.aio_buf = (uint64_t)(uintptr_t)pBuffer;
+        l_Iocb.aio_nbytes = pLength;
+        l_Iocb.aio_offset = pOffset;
+
+        int rc;
+        do
+        {
+            rc = syscall(__NR_io_submit, ctx, 1, l_Iocbs);
+        } while (rc < 0 && errno == EINTR);
+
+        if (rc < 1)
+        {
+            int l_Errno = (rc < 0 ? errno : EAGAIN);
+            slots.put(l_Slot);
+            return -l_Errno;
+        }
+        ++numInflight;
+
+        return 0;
+    };
+
+    virtual int reap(uint64_t& pTag, ssize_t& pResult)
+    {
+        if (!numInflight)
+        {
+            return -ENOENT;
+        }
+
+        struct io_event l_Event;
+        int rc;
+        do
+        {
+            rc = syscall(__NR_io_getevents, ctx, 1, 1, &l_Event, NULL);
+        } while (rc < 0 && errno == EINTR);
+
+        if (rc < 1)
+        {
+            return (rc < 0 ? -errno : -EIO);
+        }
+
+        pTag = slots.put((uint32_t)l_Event.data);
+        pResult = (ssize_t)l_Event.res;
+        --numInflight;
+
+        return 0;
+    };
+
+  private:
+    BBIOEngineSlots slots;
+    aio_context_t ctx;
+};
+
+
+/*
+ * Static methods
+ */
+BBIOEngine* BBIOEngine::create(const string& pName, const uint32_t pDepth)
+{
+    if (pName == "sync" || pDepth < 2)
+    {
+        return NULL;
+    }
+
+    if (pName != "auto" && pName != "io_uring" && pName != "aio")
+    {
+        LOG(bb,warning) << "BBIOEngine: Unknown transferEngine " << pName << ", using synchronous I/O";
+        return NULL;
+    }
+
+    int rc = 0;
+#ifdef BBIO_HAVE_IO_URING
+    if (pName != "aio")
+    {
+        BBIOEngine_IoUring* l_Engine = new BBIOEngine_IoUring(pDepth);
+        rc = l_Engine->init();
+        if (!rc)
+        {
+            return l_Engine;
+        }
+        delete l_Engine;
+        LOG(bb,info) << "BBIOEngine: io_uring is not available, rc=" << rc << ", trying native aio";
+    }
+#endif
+
+    BBIOEngine_Aio* l_Engine = new BBIOEngine_Aio(pDepth);
+    rc = l_Engine->init();
+    if (!rc)
+    {
+        return l_Engine;
+    }
+    delete l_Engine;
+    LOG(bb,warning) << "BBIOEngine: Native aio is not available, rc=" << rc << ", using synchronous I/O";
+
+    return NULL;
+}
+
+BBIOEngine* BBIOEngine::getThreadEngine()
+{
+    if (!threadIOEngineInit)
+    {
+        threadIOEngineInit = true;
+        threadIOEngine = create(transferEngine, transferQueueDepth);
+        if (threadIOEngine)
+        {
+            LOG(bb,info) << "BBIOEngine: Transfer thread uses " << threadIOEngine->getName() << " with " << threadIOEngine->getDepth() << " I/Os in flight";
+        }
+    }
+
+    return threadIOEngine;
+}
+
+
+/*
+ * Non-static methods
+ */
+void BBIOEngine::drain()
+{
+    uint64_t l_Tag;
+    ssize_t l_Result;
+    while (numInflight)
+    {
+        if (reap(l_Tag, l_Result))
+        {
+            LOG(bb,error) << "BBIOEngine: Failed to reap outstanding I/O, " << numInflight << " I/O(s) left";
+            break;
+        }
+    }
+
+    return;
+}
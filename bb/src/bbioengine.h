@@ -0,0 +1,121 @@
+/*******************************************************************************
+ |    bbioengine.h
+ |
+ |  � Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#ifndef BB_BBIOENGINE_H_
+#define BB_BBIOENGINE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+
+/*******************************************************************************
+ | Constants
+ *******************************************************************************/
+const char* const DEFAULT_TRANSFER_ENGINE = "sync";
+const uint32_t DEFAULT_TRANSFER_QUEUE_DEPTH = 4;
+
+
+/*******************************************************************************
+ | Enumerators
+ *******************************************************************************/
+enum BBIO_ENGINE_OP
+{
+    BBIO_ENGINE_READ  = 0,
+    BBIO_ENGINE_WRITE = 1
+};
+typedef enum BBIO_ENGINE_OP BBIO_ENGINE_OP;
+
+
+//
+// BBIOEngine class
+//
+// Keeps several reads/writes to the SSD block device in flight for one transfer thread.
+// An engine is not thread safe.  Each transfer thread owns its own instance.
+//
+
+class BBIOEngine
+{
+  public:
+    /**
+     * \brief Creates an engine for the calling transfer thread
+     *
+     * \param[in] pName   "sync", "auto", "io_uring" or "aio"
+     * \param[in] pDepth  Maximum number of I/Os in flight
+     *
+     * \return Engine, or NULL if synchronous I/O is configured or no asynchronous interface is available
+     */
+    static BBIOEngine* create(const string& pName, const uint32_t pDepth);
+
+    /**
+     * \brief Returns the engine for the calling transfer thread based on the bbServer configuration
+     */
+    static BBIOEngine* getThreadEngine();
+
+    virtual ~BBIOEngine() {};
+
+    // Name of the kernel interface used
+    virtual const char* getName() = 0;
+
+    // Queues an I/O.  pTag is handed back with the completion.  Returns 0 or -errno.
+    virtual int submit(const BBIO_ENGINE_OP pOp, const int pFd, char* pBuffer, const size_t pLength, const off_t pOffset, const uint64_t pTag) = 0;
+
+    // Waits for one completion.  pResult is the number of bytes transferred or -errno.  Returns 0 or -errno.
+    virtual int reap(uint64_t& pTag, ssize_t& pResult) = 0;
+
+    // Waits for all outstanding I/O, discarding the results
+    void drain();
+
+    inline uint32_t getDepth() { return depth; };
+    inline uint32_t getNumInflight() { return numInflight; };
+
+  protected:
+    BBIOEngine(const uint32_t pDepth) :
+        depth(pDepth),
+        numInflight(0) {};
+
+    uint32_t depth;         ///< Maximum number of I/Os in flight
+    uint32_t numInflight;   ///< Number of submitted I/Os not reaped yet
+};
+
+
+//
+// BBIOEngineGuard class
+//
+// Makes sure no I/O into the transfer buffer is still in flight when performIO() returns or throws
+//
+
+class BBIOEngineGuard
+{
+  public:
+    BBIOEngineGuard(BBIOEngine* pEngine) :
+        engine(pEngine) {};
+
+    ~BBIOEngineGuard()
+    {
+        if (engine)
+        {
+            engine->drain();
+        }
+    };
+
+  private:
+    BBIOEngine* engine;
+};
+
+#endif /* BB_BBIOENGINE_H_ */
@@ -4944,48 +4944,3 @@ int bb_exit(std::string who)
     EXIT_NO_CLOCK(__FILE__,__FUNCTION__);
     return 0;
 }
-
-int doAuthenticate(const string& name){
-    int rc=0;
-    txp::Msg* msg = 0;
-    txp::Msg::buildMsg(txp::CORAL_AUTHENTICATE, msg);
-    ResponseDescriptor resp;
-
-    LOG(bb,info) << "==> Sending msg to " << name.c_str() << ": CORAL_AUTHENTICATE(SSL) process_whoami=" << \
-    process_whoami.c_str() << ", process_instance=" << process_instance.c_str() \
-    << ", msg#=" << msg->getMsgNumber() << ", rqstmsg#=" << msg->getRequestMsgNumber();
-
-
-    txp::AttrPtr_char_array whoami(txp::whoami, process_whoami.c_str(), process_whoami.length()+1);
-    txp::AttrPtr_char_array instance(txp::instance, process_instance.c_str(), process_instance.length()+1);
-    msg->addAttribute(&whoami);
-    msg->addAttribute(&instance);
-    uint32_t contribid = UNDEFINED_CONTRIBID;
-    msg->addAttribute(txp::contribid, contribid);
-    msg->addAttribute(txp::version, BBAPI_CLIENTVERSIONSTR, strlen(BBAPI_CLIENTVERSIONSTR)+1);
-
-    // Send the message to bbserver
-    rc = sendMessage(name, msg, resp);
-    delete msg;
-    msg=NULL;
-    if (rc)
-    {
-        stringstream errorText;
-        errorText << "sendMessage to server failed";
-        LOG_ERROR_TEXT_RC_AND_BAIL(errorText, rc);
-    }
-
-    waitReply(resp, msg);
-    rc = ((txp::Attr_int32*)msg->retrieveAttrs()->at(txp::resultCode))->getData();
-    if (rc) {
-        stringstream errorText;
-        errorText <<"CORAL_AUTHENICATE(SSL) failed contribid=" << contribid \
-        << ", process_whoami=" << process_whoami.c_str() << ", process_instance=" << process_instance.c_str() \
-        << ", msg#=" << msg->getMsgNumber() << ", rqstmsg#=" << msg->getRequestMsgNumber() << ", rc=" << rc;
-        LOG_ERROR_TEXT_ERRNO(errorText, EINVAL);
-        SET_RC_AND_RAS(rc, bb.net.authfailed);
-    }
-
-    delete msg;
-    return rc;
-}
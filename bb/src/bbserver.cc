@@ -47,6 +47,8 @@ using namespace std;
 #include "HandleFile.h"
 #include "HandleInfo.h"
 #include "LVLookup.h"
+#include "MetadataArchive.h"
+#include "MetadataCache.h"
 #include "Msg.h"
 #include "Uuid.h"
 #include "xfer.h"
@@ -84,6 +86,12 @@ WRKQE* HPWrkQE;
 // Metadata counter for flight logging
 AtomicCounter metadataCounter;
 
+// Cache of the handle and contrib archives in the xbbServer data store
+MetadataCache metadataCache;
+
+// Format used to write the archives in the xbbServer data store
+METADATA_ARCHIVE_FORMAT g_MetadataArchiveFormat = BINARY_METADATA_ARCHIVE;
+
 // Log update handle status elapsed time clip value
 double g_LogUpdateHandleStatusElapsedTimeClipValue = DEFAULT_LOG_UPDATE_HANDLE_STATUS_ELAPSED_TIME_CLIP_VALUE;
 
@@ -3169,6 +3177,48 @@ void msgin_hello(txp::Id id, const string& pConnectionName,  txp::Msg* msg)
 }
 
 
+//*****************************************************************************
+//  Requests from other bbServers
+//*****************************************************************************
+void msgin_asyncrequest(txp::Id id, const std::string& pConnectionName, txp::Msg* msg)
+{
+    ENTRY(__FILE__,__FUNCTION__);
+
+    // NOTE: The sending bbServer already appended the request to the async request
+    //       file.  No response is sent.  The pushed request is only used once it is
+    //       found in the async request file.  Otherwise, it is read from the file.
+    if (!isAsyncRequestPeer(pConnectionName))
+    {
+        LOG(bb,error) << "msgin_asyncrequest(): Async request from " << pConnectionName << " rejected, the connection is not from a configured async request peer bbServer";
+        EXIT(__FILE__,__FUNCTION__);
+        return;
+    }
+
+    try
+    {
+        int l_SeqNbr = (int)((txp::Attr_int32*)msg->retrieveAttrs()->at(txp::asyncRequestFileSeqNbr))->getData();
+        uint64_t l_Offset = ((txp::Attr_uint64*)msg->retrieveAttrs()->at(txp::offset))->getData();
+        const char* l_Buffer = (const char*)msg->retrieveAttrs()->at(txp::buffer)->getDataPtr();
+        size_t l_Length = (size_t)msg->retrieveAttrs()->at(txp::buffer)->getDataLength();
+
+        if (l_Length == sizeof(AsyncRequest))
+        {
+            wrkqmgr.processPushedAsyncRequest(l_SeqNbr, l_Offset, l_Buffer);
+        }
+        else
+        {
+            LOG(bb,error) << "msgin_asyncrequest(): Async request from " << pConnectionName << " has a length of " << l_Length << ", expected " << sizeof(AsyncRequest);
+        }
+    }
+    catch(exception& e)
+    {
+        LOG_ERROR_WITH_EXCEPTION(__FILE__, __FUNCTION__, __LINE__, e);
+    }
+
+    EXIT(__FILE__,__FUNCTION__);
+}
+
+
 //*****************************************************************************
 //  Main routines
 //*****************************************************************************
@@ -3176,6 +3226,7 @@ void msgin_hello(txp::Id id, const string& pConnectionName,  txp::Msg* msg)
 
 int registerHandlers()
 {
+    registerMessageHandler(txp::BB_ASYNC_REQUEST, msgin_asyncrequest);
     registerMessageHandler(txp::BB_CANCELTRANSFER, msgin_canceltransfer);
     registerMessageHandler(txp::BB_CREATELOGICALVOLUME, msgin_createlogicalvolume);
     registerMessageHandler(txp::BB_GETTHROTTLERATE, msgin_getthrottlerate);
@@ -3242,6 +3293,12 @@ int bb_main(std::string who)
 
         g_NumberOfAsyncRequestsThreads = (uint32_t)(config.get(resolveServerConfigKey("numAsyncRequestThreads"), DEFAULT_BBSERVER_NUMBER_OF_LOCAL_ASYNC_REQUEST_THREADS));
 
+        metadataCache.setMaximumEntries(config.get(resolveServerConfigKey("metadataCacheEntries"), DEFAULT_BBSERVER_METADATA_CACHE_ENTRIES));
+
+        string l_MetadataArchiveFormat = config.get(resolveServerConfigKey("metadataArchiveFormat"), DEFAULT_METADATA_ARCHIVE_FORMAT);
+        g_MetadataArchiveFormat = (l_MetadataArchiveFormat == "text" ? TEXT_METADATA_ARCHIVE : BINARY_METADATA_ARCHIVE);
+        LOG(bb,always) << "Metadata archive format=" << (g_MetadataArchiveFormat == TEXT_METADATA_ARCHIVE ? "text" : "binary");
+
         wrkqmgr.setNumberOfAllowedConcurrentCancelRequests(l_NumberOfTransferThreads >= 16 ? l_NumberOfTransferThreads/16 : 1);
         wrkqmgr.setNumberOfAllowedConcurrentHPRequests(l_NumberOfTransferThreads >= 2 ? l_NumberOfTransferThreads/2 : 1);
         wrkqmgr.setAllowDumpOfWorkQueueMgr(config.get("bb.bbserverAllowDumpOfWorkQueueMgr", DEFAULT_ALLOW_DUMP_OF_WORKQUEUE_MGR));
@@ -3431,6 +3488,11 @@ int bb_main(std::string who)
             errorText<<"Listening socket error.  rc=" << rc;
             LOG_ERROR_TEXT_RC_AND_RAS(errorText, rc, bb.net.bbproxyListenerSocketFailed);
         }
+        else
+        {
+            // Push async requests to the other bbServers, if configured
+            setupAsyncRequestPeers(who);
+        }
     }
     catch(ExceptionBailout& e) { }
     catch(exception& e)
@@ -3447,6 +3509,9 @@ int bb_exit(std::string who)
 {
     ENTRY_NO_CLOCK(__FILE__,__FUNCTION__);
 
+    // Stop pushing async requests to the other bbServers
+    stopAsyncRequestPeers();
+
     EXIT_NO_CLOCK(__FILE__,__FUNCTION__);
     return 0;
 }
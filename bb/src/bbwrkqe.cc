@@ -17,6 +17,7 @@
 #include "BBLV_Info.h"
 #include "BBLV_Metadata.h"
 #include "bbwrkqe.h"
+#include "bbwrkqmgr.h"
 #include "bbserver_flightlog.h"
 #include "Extent.h"
 #include "ExtentInfo.h"
@@ -45,6 +46,13 @@ void WRKQE::addToAccumulatedTime()
 void WRKQE::addWorkItem(WorkID& pWorkItem, const bool pValidateQueue)
 {
     wrkq->push(pWorkItem);
+
+    // If the work queue is not already scheduled, make it known
+    // to the work queue manager so that getWrkQE() can return it.
+    if (this != HPWrkQE && !scheduled.exchange(1))
+    {
+        wrkqmgr.activateWrkQ(this);
+    }
     // NOTE: Unless we are debugging a problem, pValidateQueue always comes in as false.
     //       Therefore, we never hit the endOnError() below in production...
     if (pValidateQueue && this != HPWrkQE)
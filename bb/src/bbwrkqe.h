@@ -17,12 +17,14 @@
 
 #include <string.h>
 
+#include <atomic>
 #include <queue>
 #include <vector>
 
 #include "bbinternal.h"
 #include "LVKey.h"
 #include "WorkID.h"
+#include "WrkQScheduler.h"
 
 using namespace std;
 
@@ -180,6 +182,13 @@ class WRKQE
         wrkq = new queue<WorkID>;
         lock_transferqueue = PTHREAD_MUTEX_INITIALIZER;
         transferQueueLocked = 0;
+        schedNext = 0;
+        schedPrev = 0;
+        schedState = WRKQE_NOT_SCHEDULED;
+        wheelSlot = 0;
+        wheelRounds = 0;
+        activationNext = 0;
+        scheduled.store(0);
 
         return;
     };
@@ -294,6 +303,16 @@ class WRKQE
     queue<WorkID>*      wrkq;
     pthread_mutex_t     lock_transferqueue;
     pthread_t           transferQueueLocked;
+
+    // Scheduling of the work queue by WRKQMGR::getWrkQE()
+    WRKQE*              schedNext;                  // Ready ring or timer wheel slot linkage
+    WRKQE*              schedPrev;                  // Access is serialized with the
+    WRKQE_SCHEDULE_STATE schedState;                // work queue manager lock
+    uint32_t            wheelSlot;
+    uint64_t            wheelRounds;
+    WRKQE*              activationNext;             // Linkage on the list of activated work queues
+    std::atomic<int>    scheduled;                  // Set while on the ready ring, the timer wheel,
+                                                    // or the list of activated work queues
 };
 
 #endif /* BB_BBWRKQE_H_ */
@@ -24,6 +24,7 @@
 #include "BBLV_Info.h"
 #include "BBLV_Metadata.h"
 #include "bbserver_flightlog.h"
+#include "connections.h"
 #include "bbwrkqmgr.h"
 #include "identity.h"
 #include "tracksyscall.h"
@@ -126,6 +127,21 @@ int HeartbeatEntry::serverDeclaredDead(const uint64_t pAllowedNumberOfSeconds)
     return ((uint64_t)(l_CurrentTime.tv_sec - l_LastTimeServerReported.tv_sec) < pAllowedNumberOfSeconds ? 0 : 1);
 }
 
+void WRKQMGR::activateWrkQ(WRKQE* pWrkQE)
+{
+    // NOTE: Invoked when the first entry is added to a work queue that is
+    //       not scheduled.  The work queue manager lock is not required, the
+    //       work queue is pushed onto the list of activated work queues and
+    //       moved to the ready ring by drainActivatedWrkQs().
+    WRKQE* l_Head = activatedWrkQs.load();
+    do
+    {
+        pWrkQE->activationNext = l_Head;
+    } while (!activatedWrkQs.compare_exchange_weak(l_Head, pWrkQE));
+
+    return;
+}
+
 void WRKQMGR::addHPWorkItem(LVKey* pLVKey, BBTagID& pTagId)
 {
     // Build the high priority work item
@@ -150,6 +166,13 @@ void WRKQMGR::addHPWorkItem(LVKey* pLVKey, BBTagID& pTagId)
     return;
 }
 
+void WRKQMGR::addPushedAsyncRequest(const int pSeqNbr, const uint64_t pOffset, const char* pBuffer)
+{
+    pushedAsyncRequests.add(pSeqNbr, pOffset, string(pBuffer, sizeof(AsyncRequest)));
+
+    return;
+}
+
 int WRKQMGR::addWrkQ(const LVKey* pLVKey, BBLV_Info* pLV_Info, const uint64_t pJobId, const int pSuspendIndicator)
 {
     int rc = 0;
@@ -185,10 +208,43 @@ int WRKQMGR::addWrkQ(const LVKey* pLVKey, BBLV_Info* pLV_Info, const uint64_t pJ
     return rc;
 }
 
+void WRKQMGR::advanceTimerWheel()
+{
+    // NOTE: Invoked by loadBuckets() after the buckets have been refilled.
+    //       The work queues parked in the slot for this interval are moved
+    //       to the ready ring if their bucket is no longer negative, or are
+    //       parked again for the intervals still needed.
+    WRKQE* l_WrkQE = scheduler.advance();
+    while (l_WrkQE)
+    {
+        WRKQE* l_Next = l_WrkQE->schedNext;
+        l_WrkQE->schedNext = 0;
+
+        if (!l_WrkQE->getWrkQ_Size())
+        {
+            descheduleWrkQ(l_WrkQE);
+        }
+        else if (l_WrkQE->workQueueIsAssignable())
+        {
+            insertReadyWrkQ(l_WrkQE);
+        }
+        else
+        {
+            parkWrkQ(l_WrkQE);
+        }
+        l_WrkQE = l_Next;
+    }
+
+    return;
+}
+
 int WRKQMGR::appendAsyncRequest(AsyncRequest& pRequest)
 {
     int rc = 0;
     size_t l_Size;
+    int l_SeqNbr = 0;
+    int64_t l_Offset = -1;
+    char l_Buffer[sizeof(AsyncRequest)+1] = {'\0'};
 
     LOG(bb,debug) << "appendAsyncRequest(): Attempting an append to the async request file...";
 
@@ -206,11 +262,10 @@ int WRKQMGR::appendAsyncRequest(AsyncRequest& pRequest)
         {
             stringstream errorText;
 
-            int l_SeqNbr = 0;
+            l_SeqNbr = 0;
             FILE* fd = openAsyncRequestFile("ab", l_SeqNbr);
             if (fd != NULL)
             {
-                char l_Buffer[sizeof(AsyncRequest)+1] = {'\0'};
                 pRequest.str(l_Buffer, sizeof(l_Buffer));
 
                 threadLocalTrackSyscallPtr->nowTrack(TrackSyscall::fwritesyscall, fd, __LINE__, sizeof(AsyncRequest));
@@ -221,6 +276,17 @@ int WRKQMGR::appendAsyncRequest(AsyncRequest& pRequest)
                 if (l_Size == sizeof(AsyncRequest))
                 {
                     l_Retry = 0;
+
+                    // Determine the offset the request was appended at, so that
+                    // the request can be pushed to the other bbServers
+                    if (!::fflush(fd))
+                    {
+                        off_t l_End = ::lseek(fileno(fd), 0, SEEK_CUR);
+                        if (l_End >= (off_t)sizeof(AsyncRequest))
+                        {
+                            l_Offset = (int64_t)l_End - (int64_t)sizeof(AsyncRequest);
+                        }
+                    }
                 }
                 else
                 {
@@ -263,6 +329,16 @@ int WRKQMGR::appendAsyncRequest(AsyncRequest& pRequest)
 
   	becomeUser(l_Uid, l_Gid);
 
+    if (!rc && l_Offset >= 0)
+    {
+        // Keep the request for this bbServer, which is not pushed the request, and have
+        // it read the async request file on the next throttle timer pop.  Then, queue the
+        // request to be pushed to the other bbServers.
+        addPushedAsyncRequest(l_SeqNbr, (uint64_t)l_Offset, l_Buffer);
+        g_RemoteAsyncRequest_Controller.fireNextCycle();
+        pushToAsyncRequestPeers(PushedAsyncRequest(l_SeqNbr, (uint64_t)l_Offset, l_Buffer, sizeof(AsyncRequest)));
+    }
+
     if (!rc)
     {
         if (strstr(pRequest.data, "heartbeat"))
@@ -640,6 +716,38 @@ void WRKQMGR::decrementNumberOfConcurrentHPRequests()
     return;
 }
 
+void WRKQMGR::descheduleWrkQ(WRKQE* pWrkQE)
+{
+    // NOTE: The work queue has been found to have no entries and is already
+    //       unlinked from the ready ring or timer wheel.  An entry can be added
+    //       concurrently without the work queue manager lock.  If that add
+    //       found the work queue still scheduled, it did not activate the
+    //       work queue.  Therefore, check the size again after resetting the
+    //       scheduled indicator and put the work queue back on the ready ring
+    //       if needed.
+    pWrkQE->scheduled.exchange(0);
+    if (pWrkQE->getWrkQ_Size() && !pWrkQE->scheduled.exchange(1))
+    {
+        insertReadyWrkQ(pWrkQE);
+    }
+
+    return;
+}
+
+void WRKQMGR::drainActivatedWrkQs()
+{
+    WRKQE* l_WrkQE = activatedWrkQs.exchange(0);
+    while (l_WrkQE)
+    {
+        WRKQE* l_Next = l_WrkQE->activationNext;
+        l_WrkQE->activationNext = 0;
+        insertReadyWrkQ(l_WrkQE);
+        l_WrkQE = l_Next;
+    }
+
+    return;
+}
+
 void WRKQMGR::dump(const char* pSev, const char* pPostfix, DUMP_OPTION pDumpOption) {
     // NOTE: We early exit based on the logging level because we don't want to 'reset'
     //       dump counters, etc. if the logging facility filters out an entry.
@@ -1413,197 +1521,73 @@ int WRKQMGR::getWrkQE(const LVKey* pLVKey, WRKQE* &pWrkQE)
     if (pLVKey == NULL || (pLVKey->second).is_null())
     {
 //        verify();
-        int64_t l_BucketValue = -1;
-        bool l_RecalculateLastQueueWithEntries = (lastQueueWithEntries == LVKey_Null ? true : false);
-        // NOTE: The HP work queue is always present, so there must be at least two work queues...
-        if (wrkqs.size() > 1)
-        {
-            // We have one or more workqueues...
-            LVKey l_LVKey;
-            WRKQE* l_WrkQE = 0;
-
-            // NOTE: We do not lock each transfer queue as we search for the work queue
-            //       to return below.  The biggest exposure is the call to getWrkQ_Size()
-            //       below to get the current size() of the work queue.  Even if we get
-            //       an 'unpredictable' result from the size() operation due to a concurrent
-            //       update and return an empty work queue, our invoker is tolerant of the
-            //       situation and handles it properly.
-            bool l_SelectNext = false;
-            bool l_FoundFirstPositiveWorkQueueInMap = false;
-            bool l_EarlyExit = false;
-            for (map<LVKey,WRKQE*>::iterator qe = wrkqs.begin(); ((qe != wrkqs.end()) && (!l_EarlyExit)); ++qe)
+        // NOTE: Only work queues with entries are scheduled.  Work queues that can
+        //       be assigned are on the ready ring and are returned round robin.
+        //       Throttled work queues that were returned with a negative bucket value
+        //       are parked on the timer wheel until loadBuckets() refills the bucket.
+        //       Therefore, we never search through all of the work queues.
+        //
+        // NOTE: We do not lock each transfer queue as we look at the size of
+        //       the work queues below.  Even if we get an 'unpredictable' result
+        //       from the size() operation due to a concurrent update and return
+        //       an empty work queue, our invoker is tolerant of the situation and
+        //       handles it properly.  A work queue that is found empty here is
+        //       removed from the ready ring and activated again when an entry is added.
+        drainActivatedWrkQs();
+
+        size_t l_NumberToVisit = scheduler.getReadyCount();
+        while (l_NumberToVisit-- && scheduler.getReadyCursor())
+        {
+            WRKQE* l_WrkQE = scheduler.getReadyCursor();
+            if (!l_WrkQE->getWrkQ_Size())
+            {
+                unlinkWrkQ(l_WrkQE);
+                descheduleWrkQ(l_WrkQE);
+            }
+            else if (!l_WrkQE->workQueueIsAssignable())
             {
-                // The value for lastQueueWithEntries is only useful for the NEXT
-                // invocation of this method if the work queue returned on THIS invocation
-                // was the 'last queue with entries' in the map.  In that case, we immediately
-                // return the next 'non-negative bucket' work queue on that next invocation,
-                // as that completes the round-robin distribution of returned queues
-                // back to the top of the map.
-                //
-                // Therefore, only if
-                //   A) We 'encounter' the queue currently in lastQueueWithEntries
-                //      during this search -or-
-                //   B) We go through the entire map without seeing the queue
-                //      currently in lastQueueWithEntries -or-
-                //   C) The value for lastQueueWithEntries is not currently set and
-                //      we return a work queue on this invocation
-                //      *AND*
-                //   D) If returning a work queue entry, it has a non-negative bucket value.
-                // If the above it true, we will recalculate/reset the lastQueueWithEntries
-                // value.
-                //
-                // NOTE: If we are returning a work queue with a negative bucket value, we
-                //       do not recalculate the lastQueueWithEntries value because we will
-                //       go into a delay returning that work queue and then all worker threads
-                //       come back to this method as part of finding their next work item.
-                //       When this method is then invoked, at least one of the work queues will
-                //       have a positive bucket value and then 'normal' logic will determine
-                //       if the lastQueueWithEntries value needs to be recalculated.
-                //
-                // Stated another way, if we didn't encounter the current lastQueueWithEntries
-                // value during this search, it can't effect the work queue to be returned
-                // on the next invocation of this method.  Thus, it doesn't need to be
-                // recalculated at the end of the current invocation of this method.
-                if (qe->first == lastQueueWithEntries)
+                // Throttled work queue with a negative bucket value...
+                if (l_WrkQE->getRate())
                 {
-                    l_RecalculateLastQueueWithEntries = true;
+                    unlinkWrkQ(l_WrkQE);
+                    parkWrkQ(l_WrkQE);
                 }
-
-                bool l_Switch = false;
-                if (qe->second != HPWrkQE)
+                else
                 {
-                    // Not the HP workqueue...
-                    if (qe->second->getWrkQ_Size())
-                    {
-                        // This workqueue has at least one entry...
-                        int64_t l_CurrentQueueBucketValue = qe->second->getBucket();
-                        if (qe->second->workQueueIsAssignable())
-                        {
-                            if (l_WrkQE)
-                            {
-                                // We already have a workqueue to return.  Only switch to this
-                                // workqueue if the current saved bucket value is not positive
-                                // and this workqueue has a better 'bucket' value.
-                                // NOTE: The 'switch' logic below is generally only for throttled
-                                //       work queues.  Non-throttled work queues are simply
-                                //       round-robined.
-                                // NOTE: If all of the workqueues end up having a negative bucket
-                                //       value, we return the workqueue with the least negative
-                                //       bucket value.  We want to 'delay' the smallest amount
-                                //       of time.
-                                // NOTE: If we end up delaying due to throttling, all threads
-                                //       will be delaying on the same workqueue.  However, when the
-                                //       delay time has expired, all of the threads will again return
-                                //       to this routine to get the 'next' workqueue.
-                                //       Returning to get the 'next' workqueue after a throttle delay
-                                //       prevents a huge I/O spike for an individual workqueue.
-                                if (l_BucketValue <= 0 && l_BucketValue < l_CurrentQueueBucketValue)
-                                {
-                                    l_Switch = true;
-                                }
-                            }
-                            else
-                            {
-                                // We don't have a workqueue to return.
-                                // If we can't find a 'next' WRKQE to return,
-                                // we will return this one unless we find a better one...
-                                l_Switch = true;
-                            }
-
-                            if (l_Switch)
-                            {
-                                // This is a better workqueue to return if we
-                                // can't find a 'next' WRKQE...
-                                l_LVKey = qe->first;
-                                l_WrkQE = qe->second;
-                                l_BucketValue = l_CurrentQueueBucketValue;
-
-                                if (!l_FoundFirstPositiveWorkQueueInMap)
-                                {
-                                    if (l_BucketValue >= 0)
-                                    {
-                                        if (lastQueueProcessed == lastQueueWithEntries)
-                                        {
-                                            // Return this queue now as it is the next in round robin order
-                                            l_EarlyExit = true;
-//                                            LOG(bb,info) << "WRKQMGR::getWrkQE(): Early exit, top of map";
-                                        }
-                                        l_FoundFirstPositiveWorkQueueInMap = true;
-                                    }
-                                }
-                            }
-
-                            // Return this queue now as it is the next in round robin order
-                            if (l_SelectNext && l_CurrentQueueBucketValue >= 0)
-                            {
-                                // Switch to this workqueue and return it...
-                                l_LVKey = qe->first;
-                                l_WrkQE = qe->second;
-                                l_BucketValue = l_CurrentQueueBucketValue;
-                                l_EarlyExit = true;
-//                                LOG(bb,info) << "WRKQMGR::getWrkQE(): Early exit, next after last returned";
-                            }
-                        }
-                        rc = 1;
-                    }
-
-                    if ((!l_SelectNext) && qe->first == lastQueueProcessed)
-                    {
-                        // Just found the entry we last returned.  Return the next workqueue that has a positive bucket value...
-//                        LOG(bb,info) << "WRKQMGR::getWrkQE(): l_SelectNext = true";
-                        l_SelectNext = true;
-                    }
+                    scheduler.skip(l_WrkQE);
                 }
             }
-
-            if (l_WrkQE)
+            else
             {
+                // Return this work queue and advance the ring so that
+                // the next invocation returns the next work queue.
                 // NOTE: We don't update the last queue processed here because our invoker may choose to not take action on our returned
                 //       data.  The last queue processed is updated just before an item of work is removed from a queue.
                 pWrkQE = l_WrkQE;
-                if ((!l_RecalculateLastQueueWithEntries) && (!l_EarlyExit))
-                {
-                    l_RecalculateLastQueueWithEntries = true;
-                }
-            }
-            else
-            {
-                // WRKQMGR::getWrkQE(): No extents left on any workqueue
-                LOG(bb,debug) << "WRKQMGR::getWrkQE(): No extents left on any workqueue";
+                scheduler.skip(l_WrkQE);
+                rc = 1;
+                break;
             }
         }
-        else
-        {
-            // WRKQMGR::getWrkQE(): No workqueue entries exist
-            LOG(bb,debug) << "WRKQMGR::getWrkQE(): No workqueue entries exist";
-        }
 
-        if (rc == 1)
+        if (!pWrkQE)
         {
-            if (pWrkQE)
+            if (scheduler.getParkedCount())
             {
-                if (l_RecalculateLastQueueWithEntries && (l_BucketValue >= 0))
-                {
-                    calcLastWorkQueueWithEntries();
-                }
-#if 0
-                if (l_BucketValue >= 0)
-                {
-                    dump("info", " Work Queue Mgr (Work queue entry returned with non-negative bucket)", DUMP_ALWAYS);
-                }
-#endif
+                purgeParkedWrkQs();
+            }
+
+            if (scheduler.getReadyCount() || scheduler.getParkedCount())
+            {
+                // Work queues with entries exist, but none can be assigned now
+                rc = 1;
             }
             else
             {
-                // Update the last work with entries as NONE
-                setLastQueueWithEntries(LVKey_Null);
+                // WRKQMGR::getWrkQE(): No extents left on any workqueue
+                LOG(bb,debug) << "WRKQMGR::getWrkQE(): No extents left on any workqueue";
             }
         }
-        else
-        {
-            // Update the last work with entries as NONE
-            setLastQueueWithEntries(LVKey_Null);
-        }
     }
     else
     {
@@ -1736,6 +1720,15 @@ void WRKQMGR::incrementNumberOfWorkItemsProcessed(WRKQE* pWrkQE, const WorkID& p
     return;
 };
 
+void WRKQMGR::insertReadyWrkQ(WRKQE* pWrkQE)
+{
+    // Insert the work queue at the tail of the ready ring,
+    // i.e., just before the next work queue to be returned
+    scheduler.insertReady(pWrkQE);
+
+    return;
+}
+
 int WRKQMGR::isServerDead(const BBJob pJob, const uint64_t pHandle, const int32_t pContribId)
 {
     int rc = 0;
@@ -1779,6 +1772,9 @@ void WRKQMGR::loadBuckets()
         }
     }
 
+    // Return the parked work queues that are due to the ready ring
+    advanceTimerWheel();
+
     if (l_WorkQueueMgrLocked)
     {
         unlockWorkQueueMgr((LVKey*)0, "loadBuckets");
@@ -2050,6 +2046,15 @@ FILE* WRKQMGR::openAsyncRequestFile(const char* pOpenOption, int &pSeqNbr, const
     return l_FilePtr;
 }
 
+void WRKQMGR::parkWrkQ(WRKQE* pWrkQE)
+{
+    // Park the work queue on the timer wheel for the number of bucket
+    // load intervals it takes for the bucket value to no longer be negative
+    scheduler.park(pWrkQE, WrkQScheduler<WRKQE>::intervalsFor(pWrkQE->getBucket(), pWrkQE->getRate()));
+
+    return;
+}
+
 string WRKQMGR::peekAtNextAsyncRequest(WorkID& pWorkItem)
 {
     ENTRY(__FILE__,__FUNCTION__);
@@ -2201,6 +2206,61 @@ void WRKQMGR::processAllOutstandingHP_Requests(const LVKey* pLVKey)
     return;
 }
 
+void WRKQMGR::processPushedAsyncRequest(const int pSeqNbr, const uint64_t pOffset, const char* pBuffer)
+{
+    addPushedAsyncRequest(pSeqNbr, pOffset, pBuffer);
+
+    HPWrkQE->lock((LVKey*)0, "processPushedAsyncRequest");
+
+    int l_SeqNbr = 0;
+    uint64_t l_Offset = 0;
+    getOffsetToNextAsyncRequest(l_SeqNbr, l_Offset);
+    switch (PushedAsyncRequests::classify(pSeqNbr, pOffset, l_SeqNbr, l_Offset))
+    {
+        case PushedAsyncRequests::ENQUEUE:
+        {
+            // This is the next async request to be enqueued.  Enqueue it, along with any
+            // pushed requests that directly follow it, once they are found in the async
+            // request file.  A pushed request that is not in the file is never enqueued.
+            uint64_t l_NumberPushed = pushedAsyncRequests.consecutive(l_SeqNbr, l_Offset, sizeof(AsyncRequest));
+            uint64_t l_NumberAdded = verifyPushedAsyncRequests(l_SeqNbr, l_Offset, l_NumberPushed);
+            for (uint64_t i=0; i<l_NumberAdded; ++i)
+            {
+                const string l_ConnectionName = "None";
+                LVKey l_LVKey = std::pair<string, Uuid>(l_ConnectionName, Uuid(HP_UUID));
+                BBTagID l_TagId(BBJob(), l_Offset);
+                l_Offset += sizeof(AsyncRequest);
+                addHPWorkItem(&l_LVKey, l_TagId);
+            }
+            if (l_NumberAdded)
+            {
+                setOffsetToNextAsyncRequest(l_SeqNbr, l_Offset);
+                LOG(bb,debug) << "processPushedAsyncRequest(): Enqueued " << l_NumberAdded << " pushed async request(s), async request file sequence number " << l_SeqNbr;
+            }
+            if (l_NumberAdded < l_NumberPushed)
+            {
+                // The async request file does not have what was pushed.  Go by the file.
+                LOG(bb,warning) << "processPushedAsyncRequest(): " << l_NumberPushed-l_NumberAdded << " pushed async request(s) not found in the async request file having sequence number " << l_SeqNbr \
+                                << " at offset 0x" << hex << uppercase << setfill('0') << l_Offset << setfill(' ') << nouppercase << dec;
+                checkForNewHPWorkItems();
+            }
+            break;
+        }
+        case PushedAsyncRequests::READ_FILE:
+            // Requests before this one have not been pushed to this bbServer,
+            // or the async request file was swapped.  Read the async request file.
+            checkForNewHPWorkItems();
+            break;
+        case PushedAsyncRequests::ALREADY_READ:
+            // The request was already read from the async request file
+            break;
+    }
+
+    HPWrkQE->unlock((LVKey*)0, "processPushedAsyncRequest");
+
+    return;
+}
+
 void WRKQMGR::processThrottle(LVKey* pLVKey, WRKQE* pWrkQE, BBLV_Info* pLV_Info, BBTagID& pTagId, ExtentInfo& pExtentInfo, Extent* pExtent, double& pThreadDelay, double& pTotalDelay)
 {
     pThreadDelay = 0;
@@ -2263,6 +2323,30 @@ void WRKQMGR::processTurboFactorForNotFoundRequest()
     return;
 }
 
+void WRKQMGR::purgeParkedWrkQs()
+{
+    // NOTE: Parked work queues are only checked for entries when their slot
+    //       comes due.  If nothing is on the ready ring, remove the parked work
+    //       queues that no longer have entries so that getWrkQE() does not
+    //       report work that does not exist.
+    for (uint32_t i=0; i<WRKQ_TIMER_WHEEL_SLOTS && scheduler.getParkedCount(); ++i)
+    {
+        WRKQE* l_WrkQE = scheduler.getParked(i);
+        while (l_WrkQE)
+        {
+            WRKQE* l_Next = l_WrkQE->schedNext;
+            if (!l_WrkQE->getWrkQ_Size())
+            {
+                unlinkWrkQ(l_WrkQE);
+                descheduleWrkQ(l_WrkQE);
+            }
+            l_WrkQE = l_Next;
+        }
+    }
+
+    return;
+}
+
 void WRKQMGR::removeWorkItem(WRKQE* pWrkQE, WorkID& pWorkItem, bool& pLastWorkItemRemoved)
 {
     if (pWrkQE)
@@ -2345,6 +2429,12 @@ int WRKQMGR::rmvWrkQ(const LVKey* pLVKey)
 
             if (l_WrkQE)
             {
+                // Remove the work queue from the scheduler.
+                // NOTE: The work queue may still be on the list of
+                //       activated work queues, so drain that list first.
+                drainActivatedWrkQs();
+                unlinkWrkQ(l_WrkQE);
+
                 // Delete the work queue entry
                 if (l_WrkQE->getRate())
                 {
@@ -2457,6 +2547,12 @@ int WRKQMGR::setThrottleRate(const LVKey* pLVKey, const uint64_t pRate)
     if (it != wrkqs.end())
     {
         it->second->setRate(pRate);
+        if (it->second->schedState == WRKQE_ON_TIMER_WHEEL)
+        {
+            // Bucket was reset, no longer wait for it to be refilled
+            unlinkWrkQ(it->second);
+            insertReadyWrkQ(it->second);
+        }
         calcThrottleMode();
     }
     else
@@ -2492,6 +2588,13 @@ int WRKQMGR::startProcessingHP_Request(AsyncRequest& pRequest)
 }
 
 // NOTE: pLVKey is not currently used, but can come in as null.
+void WRKQMGR::unlinkWrkQ(WRKQE* pWrkQE)
+{
+    scheduler.unlink(pWrkQE);
+
+    return;
+}
+
 void WRKQMGR::unlockWorkQueueMgr(const LVKey* pLVKey, const char* pMethod, int* pLocalMetadataUnlockedInd)
 {
     stringstream errorText;
@@ -3032,4 +3135,42 @@ int WRKQMGR::verifyAsyncRequestFile(char* &pAsyncRequestFileName, int &pSeqNbr,
 
     return rc;
 }
+
+uint64_t WRKQMGR::verifyPushedAsyncRequests(const int pSeqNbr, const uint64_t pOffset, const uint64_t pNumberOfRequests)
+{
+    // NOTE: Returns the number of the pNumberOfRequests pushed requests starting at
+    //       (pSeqNbr, pOffset) that are the same as the records in the async request
+    //       file.  The HPWrkQE transfer queue lock must be held.
+    uint64_t l_Number = 0;
+    if (!pNumberOfRequests)
+    {
+        return l_Number;
+    }
+
+    vector<char> l_Buffer(pNumberOfRequests*sizeof(AsyncRequest));
+
+    uid_t l_Uid = getuid();
+    gid_t l_Gid = getgid();
+
+  	becomeUser(0, 0);
+
+    int l_SeqNbr = pSeqNbr;
+    FILE* fd = openAsyncRequestFile("rb", l_SeqNbr);
+    if (fd != NULL)
+    {
+        // NOTE: pread() does not move the file position of the cached file for read
+        threadLocalTrackSyscallPtr->nowTrack(TrackSyscall::freadsyscall, fd, __LINE__, l_Buffer.size(), pOffset);
+        ssize_t l_Size = ::pread(fileno(fd), &l_Buffer[0], l_Buffer.size(), (off_t)pOffset);
+        threadLocalTrackSyscallPtr->clearTrack();
+        FL_Write6(FLAsyncRqst, ReadPushed, "Read async request file having seqnbr %ld starting at offset %ld for %ld bytes to verify pushed requests. File pointer %p, %ld bytes read.", l_SeqNbr, pOffset, l_Buffer.size(), (uint64_t)(void*)fd, l_Size, 0);
+        if (l_Size > 0)
+        {
+            l_Number = pushedAsyncRequests.verify(pSeqNbr, pOffset, &l_Buffer[0], (uint64_t)l_Size/sizeof(AsyncRequest), sizeof(AsyncRequest));
+        }
+    }
+
+  	becomeUser(l_Uid, l_Gid);
+
+    return l_Number;
+}
 #undef ATTEMPTS
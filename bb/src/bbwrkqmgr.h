@@ -15,6 +15,7 @@
 #ifndef BB_BBWRKQMGR_H_
 #define BB_BBWRKQMGR_H_
 
+#include <atomic>
 #include <map>
 #include <utility>
 
@@ -26,6 +27,7 @@
 #include "bbwrkqe.h"
 #include "CnxSock.h"
 #include "LVKey.h"
+#include "PushedAsyncRequests.h"
 #include "util.h"
 #include "Uuid.h"
 #include "xfer.h"
@@ -296,6 +298,7 @@ class WRKQMGR
             lock_on_rmvWrkQ = PTHREAD_MUTEX_INITIALIZER;
             lock_workQueueMgr = PTHREAD_MUTEX_INITIALIZER;
             workQueueMgrLocked = 0;
+            activatedWrkQs.store(0);
         };
 
     /**
@@ -596,7 +599,9 @@ class WRKQMGR
     }
 
     // Methods
+    void activateWrkQ(WRKQE* pWrkQE);
     void addHPWorkItem(LVKey* pLVKey, BBTagID& pTagId);
+    void addPushedAsyncRequest(const int pSeqNbr, const uint64_t pOffset, const char* pBuffer);
     int addWrkQ(const LVKey* pLVKey, BBLV_Info* pLV_Info, const uint64_t pJobId, const int pSuspendIndicator);
     int appendAsyncRequest(AsyncRequest& pRequest);
     void calcLastWorkQueueWithEntries();
@@ -635,6 +640,7 @@ class WRKQMGR
     void post();
     void post_multiple(const size_t pCount);
     void processAllOutstandingHP_Requests(const LVKey* pLVKey);
+    void processPushedAsyncRequest(const int pSeqNbr, const uint64_t pOffset, const char* pBuffer);
     void processThrottle(LVKey* pLVKey, WRKQE* pWrkQE, BBLV_Info* pLV_Info, BBTagID& pTagId, ExtentInfo& pExtentInfo, Extent* pExtent, double& pThreadDelay, double& pTotalDelay);
     void processTurboFactorForFoundRequest();
     void processTurboFactorForNotFoundRequest();
@@ -650,6 +656,7 @@ class WRKQMGR
     void updateHeartbeatData(const string& pHostName, const string& pServerTimeStamp);
     void verify();
     int verifyAsyncRequestFile(char* &pAsyncRequestFileName, int &pSeqNbr, const MAINTENANCE_OPTION pMaintenanceOption=NO_MAINTENANCE);
+    uint64_t verifyPushedAsyncRequests(const int pSeqNbr, const uint64_t pOffset, const uint64_t pNumberOfRequests);
 
     // Data members
     //
@@ -692,7 +699,30 @@ class WRKQMGR
                                                 // HPWrkQE transfer queue lock
     vector<string>      inflightHP_Requests;    // Access is serialized with the
                                                 // HPWrkQE transfer queue lock
+    PushedAsyncRequests pushedAsyncRequests;    // Keyed by async request file seqnbr/offset
   private:
+    void advanceTimerWheel();
+    void descheduleWrkQ(WRKQE* pWrkQE);
+    void drainActivatedWrkQs();
+    void insertReadyWrkQ(WRKQE* pWrkQE);
+    void parkWrkQ(WRKQE* pWrkQE);
+    void purgeParkedWrkQs();
+    void unlinkWrkQ(WRKQE* pWrkQE);
+
+    // Scheduling of work queues for getWrkQE()
+    //
+    // Non-HP work queues with entries are either on the ready ring, which
+    // getWrkQE() round-robins through, or, when throttled with a negative
+    // bucket, parked on the timer wheel until loadBuckets() has refilled
+    // their bucket.  A work queue whose first entry is added is pushed onto
+    // activatedWrkQs without the work queue manager lock, and moved to the
+    // ready ring by the next getWrkQE().
+    //
+    // NOTE:  Unless otherwise noted, access is serialized with the
+    //        work queue manager lock
+    WrkQScheduler<WRKQE> scheduler;                 // Advanced by each loadBuckets() call
+    std::atomic<WRKQE*> activatedWrkQs;             // Lock free
+
     volatile int        checkForCanceledExtents;
     pthread_mutex_t     lock_on_rmvWrkQ;
     pthread_mutex_t     lock_workQueueMgr;
@@ -12,13 +12,20 @@
  *******************************************************************************/
 
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <list>
 #include <map>
+#include <set>
 #include <string>
+#include <vector>
 #include <semaphore.h>
 #include <stdio.h>
 #include <signal.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 
 #include <boost/program_options.hpp>
 #include <boost/property_tree/ptree.hpp>
@@ -31,7 +38,9 @@
 #include "tracksyscall.h"
 #elif BBSERVER
 #include "bbserver_flightlog.h"
+#include "bbproxyConn2bbserver.h"
 #include "identity.h"
+#include "PushedAsyncRequests.h"
 #include "tracksyscall.h"
 #elif BBAPI
 #include "bbapi_flightlog.h"
@@ -80,12 +89,13 @@ map<txp::Connex*, CONNECTION_SUSPEND_OPTION> connection2suspendState;
 #endif
 
 map<txp::Connex*, uint32_t> contribIdMap;
+map<txp::Connex*, string> connections2whoami;
 
 pthread_mutex_t replyWaitersLock = PTHREAD_MUTEX_INITIALIZER;
 typedef map<ResponseDescriptor*, bool> mapResponseDescriptor;
 map<string, mapResponseDescriptor > replyWaiters;
 
-static int activePoll=0;  //control poll loop
+static int activePoll=0;  //control reactor loops
 
 void releaseReplyWaiters(const std::string& pName){
     pthread_mutex_lock(&replyWaitersLock);
@@ -132,7 +142,6 @@ int dumpReplyWaiters(){
 map<int32_t, MessageHandlerFunc_t*> ID_handler_table;
 
 sem_t           connection_sem;
-int             connection_doorbell[2];
 //txp::Connex*    newconnection_sock;
 
 string          process_whoami;
@@ -166,6 +175,31 @@ map<pthread_t, threadState*>    threadPool;
 
 bool responseThreadRunning = false;
 
+// NOTE: Connections are spread over the reactor shards by file descriptor.  Each shard
+//       has its own epoll set and response thread, and fds are added to/removed from
+//       the epoll set as they are added to/removed from the connections map.
+//       The response thread uses a connection without holding the connection map lock,
+//       so a removed connection is only deleted by the response thread of its shard,
+//       between epoll waits.  Until then its fd stays open and cannot be reused.
+const int REACTOR_MAX_EVENTS  = 64;   //!< events returned by one epoll_wait
+const int REACTOR_READ_BUDGET = 16;   //!< messages read from one connection before re-arming it
+
+class connectionReactor
+{
+    public:
+        int         epollfd;
+        int         doorbell;   //!< eventfd used to stop the shard and to have it delete removed connections
+        vector<txp::Connex*> removed;   //!< connections to be deleted, serialized with connection_map_mutex
+    connectionReactor() : epollfd(-1), doorbell(-1) {}
+};
+
+static vector<connectionReactor> reactors;
+static bool reactorsRunning = false;    //!< response threads started and not ended, serialized with connection_map_mutex
+
+static void reactorAdd(const int pFD);
+static void reactorDeleteRemoved(connectionReactor* pReactor);
+static void reactorRemove(const int pFD, txp::Connex* pConnection);
+
 static void* workerThread(void* ptr);
 static void* responseThread(void* ptr);
 
@@ -192,6 +226,7 @@ void addToConnectionMap(const int pFD, txp::Connex* pConnection)
     assert(connections_map_mutex_ownership);
     LOG(bb,debug) << "connections: ADD: fd=" << pFD << " => " << static_cast<void*>(pConnection);
     connections[pFD] = pConnection;
+    reactorAdd(pFD);
 }
 
 void removeFromConnectionMap(const int pFD)
@@ -202,7 +237,68 @@ void removeFromConnectionMap(const int pFD)
     LOG(bb,debug) << "connections: REMOVE: fd=" << pFD;
     auto l_connection=connections[pFD];
     connections.erase(pFD);
-    delete l_connection;
+    reactorRemove(pFD, l_connection); //deletes connection
+    return;
+}
+
+/**
+   \brief Watch a connection in the epoll set of its reactor shard
+   \note Listening sockets are level-triggered, one connection is accepted per event.
+   All other connections are edge-triggered, see readConnection().
+   \param[in] pFD File descriptor
+ */
+static void reactorAdd(const int pFD)
+{
+    if (reactors.empty())
+        return;
+
+    struct epoll_event event;
+    event.events  = EPOLLIN;
+    event.data.fd = pFD;
+    if ((pFD != listen_socket) && (pFD != ssl_listen_socket) && (pFD != unix_listen_socket))
+    {
+        event.events |= EPOLLET;
+    }
+    int rc = epoll_ctl(reactors[pFD % reactors.size()].epollfd, EPOLL_CTL_ADD, pFD, &event);
+    if (rc && (errno != EEXIST))
+    {
+        LOG(bb,error) << "reactorAdd(): epoll_ctl failed for fd=" << pFD << ", errno=" << errno << ", " << strerror(errno);
+    }
+
+    return;
+}
+
+/**
+   \brief Stop watching a connection and have the response thread of its shard delete it
+   \note connection_map_mutex must be held when invoking this routine.  The connection
+   is deleted right away if the response threads are not running.
+   \param[in] pFD File descriptor
+   \param[in] pConnection Connection, already removed from the connections map
+ */
+static void reactorRemove(const int pFD, txp::Connex* pConnection)
+{
+    if (reactors.empty())
+    {
+        delete pConnection;
+        return;
+    }
+
+    connectionReactor& l_Reactor = reactors[pFD % reactors.size()];
+    epoll_ctl(l_Reactor.epollfd, EPOLL_CTL_DEL, pFD, NULL);
+    if (!reactorsRunning)
+    {
+        delete pConnection;
+    }
+    else if (pConnection)
+    {
+        l_Reactor.removed.push_back(pConnection);
+        uint64_t tmp = 1;
+        if (write(l_Reactor.doorbell, &tmp, sizeof(tmp)) < 0)
+        {
+            LOG(bb,debug) << "reactorRemove(): doorbell write had errno=" << errno;
+        }
+    }
+
     return;
 }
 
@@ -269,6 +365,7 @@ void addToContribIdMap(txp::Connex* pConnection, const char* pWhoAmI, const char
     assert(connections_map_mutex_ownership);
     LOG(bb,debug) << "contribIdMap: ADD: whoami=" << pWhoAmI << ", instance=" << pInstance << ", connection=" << pConnection << " => contribid=" << pContribId;
     contribIdMap[pConnection] = pContribId;
+    connections2whoami[pConnection] = pWhoAmI;
 
     return;
 }
@@ -280,6 +377,7 @@ void removeFromContribIdMap(txp::Connex* pConnection)
     assert(connections_map_mutex_ownership);
     LOG(bb,debug) << "contribIdMap: REMOVE: " << static_cast<void*>(pConnection);
     contribIdMap.erase(pConnection);
+    connections2whoami.erase(pConnection);
 
     return;
 }
@@ -628,11 +726,24 @@ std::string cleanupConnection(int pFD)
  */
 void cleanupAllConnections()
 {
-    //exit polling thread
+    //exit reactor threads
     activePoll=0;
-    int tmp = 0;
-    write(connection_doorbell[1], &tmp, sizeof(tmp));
-    sem_wait(&connection_sem);
+    for (auto& reactor : reactors)
+    {
+        uint64_t tmp = 1;
+        write(reactor.doorbell, &tmp, sizeof(tmp));
+    }
+    for (size_t i=0; i<reactors.size(); i++)
+    {
+        sem_wait(&connection_sem);
+    }
+    lockConnectionMaps("cleanupAllConnections - reactors ended");
+    reactorsRunning = false;
+    unlockConnectionMaps("cleanupAllConnections - reactors ended");
+    for (auto& reactor : reactors)
+    {
+        reactorDeleteRemoved(&reactor);
+    }
     lockConnectionWrite("cleanupAllConnections");
     {
         lockConnectionMaps("cleanupAllConnections");
@@ -1056,9 +1167,6 @@ int closeConnectionFD(const string& name)
     unlockConnectionWrite("closeConnectionFD");
     LOG(bb,debug) << "Closing connection '" << name << "'";
     if (!noconfig){
-      int tmp = 0;
-      write(connection_doorbell[1], &tmp, sizeof(tmp));
-      sem_wait(&connection_sem);
       return 0;
     }
     return -1;
@@ -1068,18 +1176,62 @@ int closeConnectionFD(const string& name)
 void addToConnectionMapsWithDoorbell(txp::Connex* pConnection_sock){
     lockConnectionMaps("addToConnectionMaps");
     {
-        connections[pConnection_sock->getSockfd()] = pConnection_sock;
+        addToConnectionMap(pConnection_sock->getSockfd(), pConnection_sock);
         addToNameConnectionMaps(pConnection_sock);
 #if BBPROXY
         updateSuspendMap(pConnection_sock, NOT_SUSPENDED);
 #endif
     }
     unlockConnectionMaps("addToConnectionMaps");
-    int tmp = 0;
-    write(connection_doorbell[1], &tmp, sizeof(tmp));//note:  what if two writers to doorbell????
-    sem_wait(&connection_sem);
 }
 
+#if (BBSERVER || BBPROXY)
+int doAuthenticate(const string& name){
+    int rc=0;
+    txp::Msg* msg = 0;
+    txp::Msg::buildMsg(txp::CORAL_AUTHENTICATE, msg);
+    ResponseDescriptor resp;
+
+    LOG(bb,info) << "==> Sending msg to " << name.c_str() << ": CORAL_AUTHENTICATE(SSL) process_whoami=" << \
+    process_whoami.c_str() << ", process_instance=" << process_instance.c_str() \
+    << ", msg#=" << msg->getMsgNumber() << ", rqstmsg#=" << msg->getRequestMsgNumber();
+
+
+    txp::AttrPtr_char_array whoami(txp::whoami, process_whoami.c_str(), process_whoami.length()+1);
+    txp::AttrPtr_char_array instance(txp::instance, process_instance.c_str(), process_instance.length()+1);
+    msg->addAttribute(&whoami);
+    msg->addAttribute(&instance);
+    uint32_t contribid = UNDEFINED_CONTRIBID;
+    msg->addAttribute(txp::contribid, contribid);
+    msg->addAttribute(txp::version, BBAPI_CLIENTVERSIONSTR, strlen(BBAPI_CLIENTVERSIONSTR)+1);
+
+    // Send the message to bbserver
+    rc = sendMessage(name, msg, resp);
+    delete msg;
+    msg=NULL;
+    if (rc)
+    {
+        stringstream errorText;
+        errorText << "sendMessage to server failed";
+        LOG_ERROR_TEXT_RC_AND_BAIL(errorText, rc);
+    }
+
+    waitReply(resp, msg);
+    rc = ((txp::Attr_int32*)msg->retrieveAttrs()->at(txp::resultCode))->getData();
+    if (rc) {
+        stringstream errorText;
+        errorText <<"CORAL_AUTHENICATE(SSL) failed contribid=" << contribid \
+        << ", process_whoami=" << process_whoami.c_str() << ", process_instance=" << process_instance.c_str() \
+        << ", msg#=" << msg->getMsgNumber() << ", rqstmsg#=" << msg->getRequestMsgNumber() << ", rc=" << rc;
+        LOG_ERROR_TEXT_ERRNO(errorText, EINVAL);
+        SET_RC_AND_RAS(rc, bb.net.authfailed);
+    }
+
+    delete msg;
+    return rc;
+}
+#endif
+
 #if BBPROXY
 
 static string bkupServerCfg; //bbproxy backup connection
@@ -1088,7 +1240,6 @@ static string serverCfg; //bbproxy primary connection
 std::string getBACKUP(){return bkupServerCfg;}
 std::string getPRIMARY(){return serverCfg;}
 
-int doAuthenticate(const string& name);
 int bbproxy_SayHello(const string& pConnectionName);
 int xchgWithBBserver(const string& name)
 {
@@ -1460,7 +1611,7 @@ int setupUnixConnections(string whoami)
 
                 unix_listen_socket = unixSock->getSockfd();
 
-                connections[unixSock->getSockfd()] = unixSock;
+                addToConnectionMap(unixSock->getSockfd(), unixSock);
                 addToNameConnectionMaps(unixSock, "ulistener");
 
                 LOG(bb,info) << "Listening for connections on fd " << unixSock->getSockfd() << ", path=" << unixPort;
@@ -1473,9 +1624,6 @@ int setupUnixConnections(string whoami)
             }
     }
     unlockConnectionMaps("setupUnixConnections");
-    int tmp = 0;
-    write(connection_doorbell[1], &tmp, sizeof(tmp));
-    sem_wait(&connection_sem);
     return 0;
 }
 #endif
@@ -1544,7 +1692,7 @@ int setupBBproxyListener(string whoami)
                 sock->setKeepAliveParms(l__keepAliveIntvl, l_keepAliveIdle, l_keepAliveCount, l__tcpusertimeout);
             }
 
-            connections[sock->getSockfd()] = sock;
+            addToConnectionMap(sock->getSockfd(), sock);
             addToNameConnectionMaps(sock, "listener");
 
             LOG(bb,info) << "Listening for connections on fd " << sock->getSockfd() << ", ip=" << ipaddr << ", port=" << port;
@@ -1613,7 +1761,7 @@ int setupBBproxyListener(string whoami)
             }
 
 
-            connections[sslSock->getSockfd()] = sslSock;
+            addToConnectionMap(sslSock->getSockfd(), sslSock);
             addToNameConnectionMaps(sslSock, "ssllistener");
 
             LOG(bb,info) << "Listening for connections on fd (SSL) " << sslSock->getSockfd() << ", ip=" << ipaddr << ", port=" << port;
@@ -1623,9 +1771,264 @@ int setupBBproxyListener(string whoami)
     }
     unlockConnectionMaps("setupBBproxyListener");
 
-    int tmp = 0;
-    write(connection_doorbell[1], &tmp, sizeof(tmp));
-    sem_wait(&connection_sem);
+    return 0;
+}
+
+// NOTE: Async requests appended to the cross bbServer async request file are also
+//       pushed to the bbServers listed in <whoami>.asyncRequestPeers, so that they
+//       do not have to wait for the next read of the async request file.  The peers
+//       are the configuration names of the other bbServers (e.g., bb.server1), with
+//       their address/ssladdress found in the configuration the same way bbProxy does.
+//       Requesters only queue the request.  The asyncRequestPeersThread does all of
+//       the connects and sends, so a slow or hung peer only delays the pushes.
+static vector<string> asyncRequestPeers;
+static set<string> readyAsyncRequestPeers;
+static pthread_mutex_t asyncRequestPeersLock = PTHREAD_MUTEX_INITIALIZER;
+static AsyncRequestPushQueue asyncRequestPushQueue;
+static pthread_t asyncRequestPeersTid;
+static atomic<int> asyncRequestPeersStarted(0);
+
+static void setAsyncRequestPeerReady(const string& pName, const bool pReady)
+{
+    pthread_mutex_lock(&asyncRequestPeersLock);
+    if (pReady)
+    {
+        readyAsyncRequestPeers.insert(pName);
+    }
+    else
+    {
+        readyAsyncRequestPeers.erase(pName);
+    }
+    pthread_mutex_unlock(&asyncRequestPeersLock);
+
+    return;
+}
+
+static int makeConnection2asyncRequestPeer(const string& pName)
+{
+    int rc = 0;
+
+    txp::Connex* newconnection_sock = createConnection2bbserver(pName);
+    if (!newconnection_sock)
+    {
+        return ENOTCONN;
+    }
+    addToConnectionMapsWithDoorbell(newconnection_sock);
+
+    try
+    {
+        rc = doAuthenticate(pName);
+    }
+    catch(ExceptionBailout& e)
+    {
+        if (!rc)
+        {
+            rc = -1;
+        }
+    }
+    catch(exception& e)
+    {
+        rc = -1;
+        LOG_ERROR_RC_WITH_EXCEPTION(__FILE__, __FUNCTION__, __LINE__, e, rc);
+    }
+
+    if (rc)
+    {
+        LOG(bb,error) << "Authentication failed for async request peer " << pName << ", rc=" << rc << ". Closing connection";
+        closeConnectionFD(pName);
+    }
+    else
+    {
+        LOG(bb,info) << "Async requests will be pushed to bbServer " << pName;
+    }
+
+    return rc;
+}
+
+static void sendToAsyncRequestPeers(const PushedAsyncRequest& pRequest)
+{
+    vector<string> l_Peers;
+    pthread_mutex_lock(&asyncRequestPeersLock);
+    l_Peers.assign(readyAsyncRequestPeers.begin(), readyAsyncRequestPeers.end());
+    pthread_mutex_unlock(&asyncRequestPeersLock);
+
+    if (l_Peers.size())
+    {
+        txp::Msg* l_Msg = 0;
+        txp::Msg::buildMsg(txp::BB_ASYNC_REQUEST, l_Msg);
+
+        l_Msg->addAttribute(txp::asyncRequestFileSeqNbr, (int32_t)pRequest.seqNbr);
+        l_Msg->addAttribute(txp::offset, pRequest.offset);
+        l_Msg->addAttribute(txp::buffer, pRequest.record.data(), pRequest.record.size());
+
+        for (auto& l_Peer : l_Peers)
+        {
+            // NOTE: A failed push is not an error for the async request.
+            //       The peer reads the request from the async request file.
+            if (sendMessage(l_Peer, l_Msg))
+            {
+                setAsyncRequestPeerReady(l_Peer, false);
+            }
+        }
+
+        delete l_Msg;
+    }
+
+    return;
+}
+
+void* asyncRequestPeersThread(void* ptr)
+{
+    unsigned int l_Interval = config.get(process_whoami + ".asyncRequestPeerRetryInterval", DEFAULT_BBSERVER_ASYNC_REQUEST_PEER_RETRY_INTERVAL);
+    if (!l_Interval)
+    {
+        l_Interval = DEFAULT_BBSERVER_ASYNC_REQUEST_PEER_RETRY_INTERVAL;
+    }
+
+    time_t l_NextConnect = 0;
+    deque<PushedAsyncRequest> l_Requests;
+    while (1)
+    {
+        time_t l_Now = time(0);
+        if (l_Now >= l_NextConnect)
+        {
+            for (auto& l_Peer : asyncRequestPeers)
+            {
+                if (!connectionExists(l_Peer))
+                {
+                    setAsyncRequestPeerReady(l_Peer, false);
+                    if (!makeConnection2asyncRequestPeer(l_Peer))
+                    {
+                        setAsyncRequestPeerReady(l_Peer, true);
+                    }
+                }
+            }
+            l_Now = time(0);
+            l_NextConnect = l_Now + l_Interval;
+        }
+
+        if (asyncRequestPushQueue.wait(l_Requests, (unsigned int)(l_NextConnect - l_Now)))
+        {
+            // Stopped
+            break;
+        }
+
+        for (auto& l_Request : l_Requests)
+        {
+            sendToAsyncRequestPeers(l_Request);
+        }
+    }
+
+    return NULL;
+}
+
+void pushToAsyncRequestPeers(const PushedAsyncRequest& pRequest)
+{
+    if (asyncRequestPeersStarted)
+    {
+        if (asyncRequestPushQueue.push(pRequest) > 0)
+        {
+            LOG(bb,debug) << "pushToAsyncRequestPeers(): Push queue full, dropped the oldest queued async request. " << asyncRequestPushQueue.getNumberDropped() << " dropped in total";
+        }
+    }
+
+    return;
+}
+
+void stopAsyncRequestPeers()
+{
+    if (asyncRequestPeersStarted.exchange(0))
+    {
+        asyncRequestPushQueue.stop();
+        pthread_join(asyncRequestPeersTid, NULL);
+    }
+
+    return;
+}
+
+int isAsyncRequestPeer(const string& pConnectionName)
+{
+    // NOTE: Only the bbServers listed in <whoami>.asyncRequestPeers may push async
+    //       requests to this bbServer.  The connection must have authenticated as one
+    //       of them and come from the address configured for that bbServer.
+    int rc = 0;
+    string l_WhoAmI;
+    string l_RemoteAddr;
+
+    lockConnectionMaps("isAsyncRequestPeer");
+    {
+        map<string, txp::Connex*>::iterator it = name2connections.find(pConnectionName);
+        if (it != name2connections.end() && it->second)
+        {
+            map<txp::Connex*, string>::iterator w = connections2whoami.find(it->second);
+            if (w != connections2whoami.end())
+            {
+                l_WhoAmI = w->second;
+            }
+            l_RemoteAddr = it->second->getRemoteAddrString();
+        }
+    }
+    unlockConnectionMaps("isAsyncRequestPeer");
+
+    if (l_WhoAmI.size() && find(asyncRequestPeers.begin(), asyncRequestPeers.end(), l_WhoAmI) != asyncRequestPeers.end())
+    {
+        string l_IPinfo = config.get(l_WhoAmI + ".ssladdress", NO_CONFIG_VALUE);
+        if (l_IPinfo == NO_CONFIG_VALUE)
+        {
+            l_IPinfo = config.get(l_WhoAmI + ".address", NO_CONFIG_VALUE);
+        }
+
+        string l_IPAddr;
+        uint16_t l_Port = 0;
+        if (l_IPinfo != NO_CONFIG_VALUE && !getIPPort(l_IPinfo, l_IPAddr, l_Port))
+        {
+            // Same as makeConnection2remoteSSL()/makeConnection2remoteNonSSL()
+            if (l_IPAddr == "0.0.0.0")
+            {
+                l_IPAddr = "127.0.0.1";
+            }
+            rc = (l_IPAddr == l_RemoteAddr);
+        }
+    }
+
+    return rc;
+}
+
+int setupAsyncRequestPeers(string whoami)
+{
+    string l_Peers = config.get(whoami + ".asyncRequestPeers", NO_CONFIG_VALUE);
+    if (l_Peers == NO_CONFIG_VALUE)
+    {
+        return 0;
+    }
+
+    stringstream l_Stream(l_Peers);
+    string l_Peer;
+    while (getline(l_Stream, l_Peer, ','))
+    {
+        l_Peer.erase(0, l_Peer.find_first_not_of(" "));
+        l_Peer.erase(l_Peer.find_last_not_of(" ")+1);
+        if (l_Peer.size() && l_Peer != whoami)
+        {
+            asyncRequestPeers.push_back(l_Peer);
+        }
+    }
+
+    if (asyncRequestPeers.size())
+    {
+        LOG(bb,always) << "setupAsyncRequestPeers(): " << asyncRequestPeers.size() << " async request peer(s) configured: " << l_Peers;
+
+        int rc = pthread_create(&asyncRequestPeersTid, NULL, asyncRequestPeersThread, NULL);
+        if (!rc)
+        {
+            asyncRequestPeersStarted = 1;
+        }
+        else
+        {
+            LOG(bb,error) << "setupAsyncRequestPeers(): Unable to start the async request peers thread, rc=" << rc << ". Peers read async requests from the async request file";
+        }
+    }
+
     return 0;
 }
 #endif
@@ -1638,7 +2041,6 @@ int setupConnections(string whoami, string instance)
     pthread_mutex_init(&connections_io_mutex, NULL);
     pthread_mutex_init(&connection_map_mutex, NULL);
     pthread_mutex_init(&threadFreePool_mutex, NULL);
-    pipe2(connection_doorbell, O_CLOEXEC);
 
     string ipaddr;
     string url = config.get(whoami + ".address", NO_CONFIG_VALUE);
@@ -1662,7 +2064,35 @@ int setupConnections(string whoami, string instance)
         pthread_create(&tid, &attr, workerThread, NULL);
     }
 
-    pthread_create(&tid, &attr, responseThread, NULL);
+    int numreactors = 1;
+    if (process_whoami.find("bb.api") == std::string::npos)
+    {
+        numreactors = config.get(process_whoami + ".numReactorThreads", DEFAULT_NUMBER_OF_REACTOR_THREADS);
+        if (numreactors < 1)
+            numreactors = 1;
+        LOG(bb,info) << "Using " << numreactors << " reactor threads";
+    }
+
+    reactors.resize(numreactors);
+    for (auto& reactor : reactors)
+    {
+        reactor.epollfd  = epoll_create1(EPOLL_CLOEXEC);
+        reactor.doorbell = eventfd(0, EFD_CLOEXEC);
+
+        struct epoll_event event;
+        event.events  = EPOLLIN;
+        event.data.fd = reactor.doorbell;
+        epoll_ctl(reactor.epollfd, EPOLL_CTL_ADD, reactor.doorbell, &event);
+    }
+
+    activePoll=1;
+    lockConnectionMaps("setupConnections - start reactors");
+    reactorsRunning = true;
+    unlockConnectionMaps("setupConnections - start reactors");
+    for (auto& reactor : reactors)
+    {
+        pthread_create(&tid, &attr, responseThread, &reactor);
+    }
     pthread_attr_destroy(&attr);
 
     return 0;
@@ -1810,235 +2240,353 @@ void* workerThread(void* ptr)
 }
 
 /**
-   \brief Handler for transport response messages, connection requests and shutdowns
+   \brief Accept a connection on a listening socket
+   \note connection_map_mutex must NOT be held when invoking this routine
 
-   \param[in] ptr Not used, required by pthread_create calling convention
+   \param[in] pListener Listening connection
  */
-
-void* responseThread(void* ptr)
+static void acceptConnection(txp::Connex* pListener)
 {
-    int rc;
-    activePoll=1;
-    while(activePoll)
-    {
-        lockConnectionMaps("responseThread poll descriptor list");
-        unsigned int idx        = 0;
-        unsigned int conncount  = connections.size() + 1;
-        struct pollfd* pollinfo = (struct pollfd*)malloc(conncount * sizeof(struct pollfd));
+    int fd = pListener->getSockfd();
+    txp::Connex* newsock = NULL;
 
-        pollinfo[idx].fd        = connection_doorbell[0];
-        pollinfo[idx].events    = POLLIN | POLLERR | POLLHUP | POLLNVAL;
-        pollinfo[idx++].revents = 0;
+    if ( __glibc_unlikely(fd == unix_listen_socket) )
+    {
+        FL_Write(FLConn, FL_AcceptStartUNIX, "Remote unix connection is being accepted",0,0,0,0);
 
-        
-        for (map<int,txp::Connex*>::iterator it=connections.begin(); it != connections.end(); ++it)
+        lockConnectionMaps("responseThread - accept remote unix connection");
         {
-            pollinfo[idx].fd        = (it->second)->getSockfd();
-            pollinfo[idx].events    = POLLIN | POLLERR | POLLHUP | POLLNVAL;
-            pollinfo[idx++].revents = 0;
+            int res = pListener->accept(newsock);
+            if (res >= 0)
+            {
+                // setting credentials for this connection
+                newsock->setCred();
+                addToConnectionMap(newsock->getSockfd(), newsock);
+            }
         }
-        unlockConnectionMaps("responseThread poll descriptor list");
+        unlockConnectionMaps("responseThread - accept remote unix connection");
 
-        rc = poll(pollinfo, conncount, -1);
-        if(rc)
+        if (!newsock)
         {
-            for(idx=0; idx<conncount; idx++)
-            {
-                if(pollinfo[idx].revents & POLLIN)
-                {
-                    BUMPCOUNTER(inbound_message);
-                    FL_Write(FLConn, FL_POLLIN, "Data available on %ld (fd=%ld)  revents=%lx",
-                             idx, pollinfo[idx].fd, pollinfo[idx].revents,0);
+            LOG(bb,error) << "accept failed on Unix socket";
+            return;
+        }
+        bberror.clear();
 
-                    if( __glibc_unlikely(pollinfo[idx].fd == connection_doorbell[0]) )
-                    {
-                        FL_Write(FLConn, FL_NewConnect, "Adding/removing connection to poll loop",0,0,0,0);
-                        int tmp;
-                        int bytesRead = read(connection_doorbell[0], &tmp, sizeof(tmp));
-                        if (bytesRead<0) {
-                            LOG(txp,debug) << __PRETTY_FUNCTION__<< "doorbell read had errno="<<errno;
-                        }
-                        sem_post(&connection_sem);
-                        break; //rescan file descriptors
-                    }
-                    else if ( __glibc_unlikely(pollinfo[idx].fd == listen_socket) )
-                    {
-                        FL_Write(FLConn, FL_AcceptStart, "Remote connection is being accepted",0,0,0,0);
-                        txp::Connex* newsock;
+        FL_Write(FLConn, FL_AcceptDoneUNIX, "Remote connection was connected.  fd=%ld",newsock->getSockfd(),0,0,0);
+    }
+    else if ( __glibc_unlikely(fd == ssl_listen_socket) )
+    {
+        FL_Write(FLConn, FL_AcceptStartSSL, "Remote SSL connection is being accepted",0,0,0,0);
 
-                        lockConnectionMaps("responseThread - accept remote connection");
-                        {
-                            (connections[pollinfo[idx].fd])->accept(newsock);
-                            newsock->keepAlive();
-                            connections[newsock->getSockfd()] = newsock;
-                        }
-                        unlockConnectionMaps("responseThread - accept remote connection");
+        lockConnectionMaps("responseThread - accept remote SSL connection");
+        {
+            pListener->accept(newsock);
+            newsock->keepAlive();
+            addToConnectionMap(newsock->getSockfd(), newsock);
+        }
+        unlockConnectionMaps("responseThread - accept remote SSL connection");
 
-                        bberror.clear();
+        bberror.clear();
 
-                        FL_Write(FLConn, FL_AcceptDone, "Remote connection was connected.  fd=%ld",newsock->getSockfd(),0,0,0);
-                    }
-                    else if ( __glibc_unlikely(pollinfo[idx].fd == ssl_listen_socket) )
-                    {
-                        FL_Write(FLConn, FL_AcceptStartSSL, "Remote SSL connection is being accepted",0,0,0,0);
-                        txp::Connex* newsock;
+        FL_Write(FLConn, FL_AcceptDoneSSL, "Remote SSL connection was connected.  fd=%ld",newsock->getSockfd(),0,0,0);
+    }
+    else
+    {
+        FL_Write(FLConn, FL_AcceptStart, "Remote connection is being accepted",0,0,0,0);
 
-                        lockConnectionMaps("responseThread - accept remote SSL connection");
-                        {
-                            (connections[pollinfo[idx].fd])->accept(newsock);
-                            newsock->keepAlive();
-                            connections[newsock->getSockfd()] = newsock;
-                        }
-                        unlockConnectionMaps("responseThread - accept remote SSL connection");
+        lockConnectionMaps("responseThread - accept remote connection");
+        {
+            pListener->accept(newsock);
+            newsock->keepAlive();
+            addToConnectionMap(newsock->getSockfd(), newsock);
+        }
+        unlockConnectionMaps("responseThread - accept remote connection");
 
-                        bberror.clear();
+        bberror.clear();
 
-                        FL_Write(FLConn, FL_AcceptDoneSSL, "Remote SSL connection was connected.  fd=%ld",newsock->getSockfd(),0,0,0);
-                    }
-                    else if( __glibc_unlikely(pollinfo[idx].fd == unix_listen_socket) )
-                    {
-                        FL_Write(FLConn, FL_AcceptStartUNIX, "Remote unix connection is being accepted",0,0,0,0);
-                        txp::Connex* newsock;
-
-                        lockConnectionMaps("responseThread - accept remote unix connection");
-                        {
-                            int res =(connections[pollinfo[idx].fd])->accept(newsock);
-                            if (res < 0)
-                            {
-                                LOG(bb,error) << "accept failed on Unix socket";
-                                continue;
-                            }
-                            // setting credentials for this connection
-                            newsock->setCred();
-                            connections[newsock->getSockfd()] = newsock;
-                        }
-                        unlockConnectionMaps("responseThread - accept remote unix connection");
-
-                        bberror.clear();
-
-                        FL_Write(FLConn, FL_AcceptDoneUNIX, "Remote connection was connected.  fd=%ld",newsock->getSockfd(),0,0,0);
-                    }
-                    else
-                    {
-                        FL_Write(FLConn, FL_IncomingMsg, "Reading incoming transport message on fd=%ld",pollinfo[idx].fd,0,0,0);
+        FL_Write(FLConn, FL_AcceptDone, "Remote connection was connected.  fd=%ld",newsock->getSockfd(),0,0,0);
+    }
 
-                        bberror.clear(getConnectionName(connections[pollinfo[idx].fd]));
+    return;
+}
 
-                        // Read socket
-                        txp::Msg* msg = 0;
-                        rc = connections[pollinfo[idx].fd]->read(msg);
+/**
+   \brief Hand an incoming message to its waiter or to the worker pool
 
-                        if(rc == 0)
-                        {
+   \param[in] pConnection Connection the message was read from
+   \param[in] msg Message
+ */
+static void dispatchMessage(txp::Connex* pConnection, txp::Msg* msg)
+{
 #if MSG_STALE_CHECK
-                            LOG(txp,always) << "responseThread incoming msg "<< (connections[pollinfo[idx].fd]->getFamily() == AF_UNIX ? "AF_UNIX":"SOCK")<<" msg msgId="<<msg->getMsgId()<<" msgNumber="<<msg->getMsgNumber()
-                            <<std::hex<<" hex msgId="<<msg->getMsgId()<<" hex msgNumber="<<msg->getMsgNumber() <<std::dec<<" pointer msg="<<msg;
+    LOG(txp,always) << "responseThread incoming msg "<< (pConnection->getFamily() == AF_UNIX ? "AF_UNIX":"SOCK")<<" msg msgId="<<msg->getMsgId()<<" msgNumber="<<msg->getMsgNumber()
+    <<std::hex<<" hex msgId="<<msg->getMsgId()<<" hex msgNumber="<<msg->getMsgNumber() <<std::dec<<" pointer msg="<<msg;
 #endif
-                            if((msg->getRequestMsgNumber() != 0) &&
-                               (msg->retrieveAttrs()->find(txp::responseHandle) != msg->retrieveAttrs()->end()))
-                            {
-                                ResponseDescriptor* resp = (ResponseDescriptor*)((txp::Attr_uint64*)(msg->retrieveAttrs()->at(txp::responseHandle)))->getData();
-                                resp->reply = msg;
-                                resp->sempost();
-                            }
-                            else if (msg->getMsgId() == txp::CORAL_AUTHENTICATE)
-                            {
-                                connection_authenticate(txp::CORAL_AUTHENTICATE,  connections[pollinfo[idx].fd], msg);
-                            }
-                            else
-                            {
-                                pthread_t threadid = 0;
-
-                                // Find available thread
-                                pthread_mutex_lock(&threadFreePool_mutex);
-                                {
-                                    if(threadFreePool.size() > 0)
-                                    {
-                                        threadid = threadFreePool.back();
-                                        threadFreePool.pop_back();
-                                    }
-                                    if(threadid != 0)
-                                    {
-                                        threadPool[threadid]->msg  = msg;
-                                        Connex * conn = connections[pollinfo[idx].fd];
-                                        threadPool[threadid]->connectionName=getConnectionName(conn);
+    if((msg->getRequestMsgNumber() != 0) &&
+       (msg->retrieveAttrs()->find(txp::responseHandle) != msg->retrieveAttrs()->end()))
+    {
+        ResponseDescriptor* resp = (ResponseDescriptor*)((txp::Attr_uint64*)(msg->retrieveAttrs()->at(txp::responseHandle)))->getData();
+        resp->reply = msg;
+        resp->sempost();
+    }
+    else if (msg->getMsgId() == txp::CORAL_AUTHENTICATE)
+    {
+        connection_authenticate(txp::CORAL_AUTHENTICATE, pConnection, msg);
+    }
+    else
+    {
+        pthread_t threadid = 0;
+
+        // Find available thread
+        pthread_mutex_lock(&threadFreePool_mutex);
+        {
+            if(threadFreePool.size() > 0)
+            {
+                threadid = threadFreePool.back();
+                threadFreePool.pop_back();
+            }
+            if(threadid != 0)
+            {
+                threadPool[threadid]->msg  = msg;
+                threadPool[threadid]->connectionName=getConnectionName(pConnection);
 #if BBPROXY
-                                        if (connections[pollinfo[idx].fd]->getFamily() == AF_UNIX)
-                                        {
-                                          threadPool[threadid]->uid=conn->getUser_ID();
-                                          threadPool[threadid]->gid=conn->getGrp_ID();
-                                        }
-                                        else
-                                        {
-                                          threadPool[threadid]->uid=-1;
-                                          threadPool[threadid]->gid=-1;
-                                        }
+                if (pConnection->getFamily() == AF_UNIX)
+                {
+                  threadPool[threadid]->uid=pConnection->getUser_ID();
+                  threadPool[threadid]->gid=pConnection->getGrp_ID();
+                }
+                else
+                {
+                  threadPool[threadid]->uid=-1;
+                  threadPool[threadid]->gid=-1;
+                }
 #endif
-                                        pthread_mutex_unlock(&threadFreePool_mutex);
-                                        sem_post(&threadPool[threadid]->workAvailable);
-                                    }
-                                    else
-                                    {
-                                        FL_Write(FLConn, FL_AddBacklog, "Adding message to backlog.  Backlog depth=%ld", threadBacklog.size(),0,0,0);
-
-                                        // backlog
-                                        /// \todo Add limit on the total size of backlog messages (and throw RAS)
-                                        threadState* bl  = new(threadState);
-                                        Connex * conn = connections[pollinfo[idx].fd];
+                pthread_mutex_unlock(&threadFreePool_mutex);
+                sem_post(&threadPool[threadid]->workAvailable);
+            }
+            else
+            {
+                FL_Write(FLConn, FL_AddBacklog, "Adding message to backlog.  Backlog depth=%ld", threadBacklog.size(),0,0,0);
+
+                // backlog
+                /// \todo Add limit on the total size of backlog messages (and throw RAS)
+                threadState* bl  = new(threadState);
 #if BBPROXY
-                                        if (connections[pollinfo[idx].fd]->getFamily() == AF_UNIX)
-                                        {
-                                          bl->uid=conn->getUser_ID();
-                                          bl->gid=conn->getGrp_ID();
-                                        }
-                                        else
-                                        {
-                                          bl->uid=-1;
-                                          bl->gid=-1;
-                                        }
+                if (pConnection->getFamily() == AF_UNIX)
+                {
+                  bl->uid=pConnection->getUser_ID();
+                  bl->gid=pConnection->getGrp_ID();
+                }
+                else
+                {
+                  bl->uid=-1;
+                  bl->gid=-1;
+                }
 #endif
-                                        bl->msg = msg;
-                                        bl->connectionName=getConnectionName(conn);
-                                        threadBacklog.push_back(bl);
-                                        pthread_mutex_unlock(&threadFreePool_mutex);
-                                    }
-                                }
-                            }
-                        }
-                        else //rc!=0
-                        {
-                            if (connections[pollinfo[idx].fd]->getFamily() != AF_UNIX)
-                            {
-                                FL_Write(FLConn, FL_ReadError, "Error reading the connection, closing connection.  rc=%ld fd=%ld", rc,pollinfo[idx].fd,0,0);
-                                bberror << errloc(rc);
-                                bberror << err("error.fileDescriptor",pollinfo[idx].fd);
-                                bberror << err("error.text",strerror(-rc));
-                                bberror << err("error.connection", connections[pollinfo[idx].fd]->getInfoString() );
-                                bberror << RAS(bb.net.SockConnErr);
-                            }
-                            std::string nameWas = cleanupConnection(pollinfo[idx].fd);//calls releaseReplyWaiters
+                bl->msg = msg;
+                bl->connectionName=getConnectionName(pConnection);
+                threadBacklog.push_back(bl);
+                pthread_mutex_unlock(&threadFreePool_mutex);
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+   \brief Read the messages available on a connection
+   \note The connection is registered edge-triggered, so messages are read until
+   the socket has no more data.  After REACTOR_READ_BUDGET messages the connection
+   is re-armed instead, so one busy connection does not starve the rest of the shard.
+
+   \param[in] pReactor Reactor shard owning the connection
+   \param[in] pFD File descriptor of the connection
+   \param[in] pConnection Connection
+ */
+static void readConnection(connectionReactor* pReactor, int pFD, txp::Connex* pConnection)
+{
+    int rc;
+
+    for (int l_Count=1; ; ++l_Count)
+    {
+        BUMPCOUNTER(inbound_message);
+        FL_Write(FLConn, FL_IncomingMsg, "Reading incoming transport message on fd=%ld",pFD,0,0,0);
+
+        bberror.clear(getConnectionName(pConnection));
+
+        // Read socket
+        txp::Msg* msg = 0;
+        rc = pConnection->read(msg);
+        if (rc)
+        {
+            if (pConnection->getFamily() != AF_UNIX)
+            {
+                FL_Write(FLConn, FL_ReadError, "Error reading the connection, closing connection.  rc=%ld fd=%ld", rc,pFD,0,0);
+                bberror << errloc(rc);
+                bberror << err("error.fileDescriptor",pFD);
+                bberror << err("error.text",strerror(-rc));
+                bberror << err("error.connection", pConnection->getInfoString() );
+                bberror << RAS(bb.net.SockConnErr);
+            }
+            std::string nameWas = cleanupConnection(pFD);//calls releaseReplyWaiters
 #if BBPROXY
-                           //start_bbserverRecoveryThread(nameWas);
+           //start_bbserverRecoveryThread(nameWas);
 #endif
-                        }
-                    }
+            break;
+        }
+
+        dispatchMessage(pConnection, msg);
+
+        // Connex reads block, so check for more data before reading again
+        struct pollfd pollinfo;
+        pollinfo.fd      = pFD;
+        pollinfo.events  = POLLIN;
+        pollinfo.revents = 0;
+        if (poll(&pollinfo, 1, 0) <= 0)
+        {
+            break;
+        }
+        if ( __glibc_unlikely(!(pollinfo.revents & POLLIN)) )
+        {
+            // Connection was closed while handling the message (e.g., failed authentication)
+            FL_Write(FLConn, FL_PollError, "Error polling the connection, closing connection.  fd=%ld POLLERR=%ld POLLHUP=%ld POLLNVAL=%ld",pFD,pollinfo.revents & POLLERR ,pollinfo.revents &  POLLHUP ,pollinfo.revents & POLLNVAL);
+            std::string nameWas = cleanupConnection(pFD);//calls releaseReplyWaiters
+            break;
+        }
+        if (l_Count >= REACTOR_READ_BUDGET)
+        {
+            // Re-arming reports the data still pending as a new edge
+            struct epoll_event event;
+            event.events  = EPOLLIN | EPOLLET;
+            event.data.fd = pFD;
+            epoll_ctl(pReactor->epollfd, EPOLL_CTL_MOD, pFD, &event);
+            break;
+        }
+    }
+
+    return;
+}
+
+/**
+   \brief Delete the connections removed from a reactor shard
+   \note Invoked by the response thread of the shard, which is not using any connection
+   at that point, or once the response threads have ended.
+   \param[in] pReactor Reactor shard
+ */
+static void reactorDeleteRemoved(connectionReactor* pReactor)
+{
+    vector<txp::Connex*> l_Removed;
+    lockConnectionMaps("reactorDeleteRemoved");
+    {
+        l_Removed.swap(pReactor->removed);
+    }
+    unlockConnectionMaps("reactorDeleteRemoved");
+
+    for (auto l_Connection : l_Removed)
+    {
+        delete l_Connection;
+    }
+
+    return;
+}
+
+/**
+   \brief Handler for transport response messages, connection requests and shutdowns
+   \note There is one response thread per reactor shard.  Each waits on the epoll
+   set of its shard, which only changes when connections are added or removed.
+
+   \param[in] ptr Reactor shard served by the thread
+ */
+void* responseThread(void* ptr)
+{
+    connectionReactor* reactor = (connectionReactor*)ptr;
+    struct epoll_event events[REACTOR_MAX_EVENTS];
+
+    while(activePoll)
+    {
+        int count = epoll_wait(reactor->epollfd, events, REACTOR_MAX_EVENTS, -1);
+        if (count < 0)
+        {
+            if (errno != EINTR)
+            {
+                LOG(txp,error) << __PRETTY_FUNCTION__ << " epoll_wait had errno=" << errno;
+            }
+            continue;
+        }
+
+        for(int idx=0; idx<count; idx++)
+        {
+            int fd = events[idx].data.fd;
+            uint32_t revents = events[idx].events;
+
+            if( __glibc_unlikely(fd == reactor->doorbell) )
+            {
+                // Removed connections are deleted once all events are handled
+                FL_Write(FLConn, FL_NewConnect, "Reactor doorbell rang",0,0,0,0);
+                uint64_t tmp;
+                int bytesRead = read(reactor->doorbell, &tmp, sizeof(tmp));
+                if (bytesRead<0) {
+                    LOG(txp,debug) << __PRETTY_FUNCTION__<< "doorbell read had errno="<<errno;
                 }
-                else if(pollinfo[idx].revents & (POLLERR | POLLHUP | POLLNVAL) )
+                if (!activePoll)
                 {
-                    FL_Write(FLConn, FL_PollError, "Error polling the connection, closing connection.  fd=%ld POLLERR=%ld POLLHUP=%ld POLLNVAL=%ld",pollinfo[idx].fd,pollinfo[idx].revents & POLLERR ,pollinfo[idx].revents &  POLLHUP ,pollinfo[idx].revents & POLLNVAL);
-                    rc=EBADFD;
-                    bberror << errloc(rc) << err("error.fileDescriptor",pollinfo[idx].fd)<< err("error.connection", connections[pollinfo[idx].fd]->getInfoString() );
-                    bberror << err("error.text", string( (pollinfo[idx].revents & POLLERR) ? "":"POLLERR ") + string( (pollinfo[idx].revents & POLLHUP) ? "":"POLLHUP ") + string( (pollinfo[idx].revents & POLLNVAL) ? "":"POLLNVAL ") );
-                    bberror << RAS(bb.net.revent);
+                    break;
+                }
+                continue;
+            }
+
+            // The connection may have been removed after the event was queued
+            txp::Connex* conn = NULL;
+            lockConnectionMaps("responseThread find connection");
+            {
+                auto it = connections.find(fd);
+                if (it != connections.end())
+                {
+                    conn = it->second;
+                }
+            }
+            unlockConnectionMaps("responseThread find connection");
+            if (!conn)
+            {
+                continue;
+            }
+
+            if(revents & EPOLLIN)
+            {
+                FL_Write(FLConn, FL_POLLIN, "Data available on %ld (fd=%ld)  revents=%lx",
+                         idx, fd, revents,0);
 
-                    std::string nameWas = cleanupConnection(pollinfo[idx].fd);//calls releaseReplyWaiters
+                if ( __glibc_unlikely((fd == listen_socket) || (fd == ssl_listen_socket) || (fd == unix_listen_socket)) )
+                {
+                    acceptConnection(conn);
+                }
+                else
+                {
+                    readConnection(reactor, fd, conn);
+                }
+            }
+            else if(revents & (EPOLLERR | EPOLLHUP))
+            {
+                FL_Write(FLConn, FL_EpollError, "Error on the epoll connection, closing connection.  fd=%ld POLLERR=%ld POLLHUP=%ld POLLNVAL=%ld",fd,revents & EPOLLERR ,revents & EPOLLHUP ,0);
+                int rc=EBADFD;
+                bberror << errloc(rc) << err("error.fileDescriptor",fd)<< err("error.connection", conn->getInfoString() );
+                bberror << err("error.text", string( (revents & EPOLLERR) ? "POLLERR ":"") + string( (revents & EPOLLHUP) ? "POLLHUP ":"") );
+                bberror << RAS(bb.net.revent);
+
+                std::string nameWas = cleanupConnection(fd);//calls releaseReplyWaiters
 #if BBPROXY
-                   //start_bbserverRecoveryThread(nameWas);
+               //start_bbserverRecoveryThread(nameWas);
 #endif
-                }
             }
         }
-        free(pollinfo);
+
+        // No connection of this shard is in use here
+        reactorDeleteRemoved(reactor);
     }
+    reactorDeleteRemoved(reactor);
+    sem_post(&connection_sem);
+
     return NULL;
 }
@@ -28,6 +28,7 @@
  | Constants
  *******************************************************************************/
 const int DEFAULT_NUMBER_OF_THREADS = 8;
+const int DEFAULT_NUMBER_OF_REACTOR_THREADS = 1;
 const std::string NO_CONFIG_VALUE = "none";
 
 
@@ -115,6 +116,14 @@ extern int takeActivebbserverOffline(const std::string& pName);
 extern int makeInitialConnection2bbserver();
 extern int openConnectionToBBserver();
 boost::property_tree::ptree getVersionPropertyTree();
+#if BBSERVER
+class PushedAsyncRequest;
+extern int isAsyncRequestPeer(const std::string& pConnectionName);
+extern void pushToAsyncRequestPeers(const PushedAsyncRequest& pRequest);
+extern int setupAsyncRequestPeers(std::string whoami);
+extern void stopAsyncRequestPeers();
+#endif
+
 #if BBPROXY
 extern int countWaitReplyList(const std::string& pConnectionName);
 extern CONNECTION_SUSPEND_OPTION getSuspendState(const std::string& pName);
@@ -13,6 +13,7 @@
 
 
 #define _XOPEN_SOURCE 600
+#include <atomic>
 #include <fcntl.h>
 #include <map>
 #include <pthread.h>
@@ -619,49 +620,81 @@ void filehandle::updateStats(struct stat* stats)
 /***************************************************************/
 
 #if BBPROXY
+// Number of extents returned by one FS_IOC_FIEMAP
+const uint32_t FIEMAP_BATCH_EXTENTS = 512;
+
 class extentLookup_fiemap : public extentLookup
 {
 protected:
     uint64_t  numextents;
-    fiemap_t* extents;
+    vector<fiemap_extent_t> extents;
+
+    // Adjacent extents (contiguous in the file and on the device, same flags)
+    // are merged, so each becomes one transfer on bbServer
+    void append(const fiemap_extent_t& pExtent)
+    {
+        const uint32_t l_Mask = ~(uint32_t)FIEMAP_EXTENT_LAST;
+        if (!extents.empty())
+        {
+            fiemap_extent_t& l_Prev = extents.back();
+            if ((l_Prev.fe_logical + l_Prev.fe_length == pExtent.fe_logical) &&
+                (l_Prev.fe_physical + l_Prev.fe_length == pExtent.fe_physical) &&
+                ((l_Prev.fe_flags & l_Mask) == (pExtent.fe_flags & l_Mask)))
+            {
+                l_Prev.fe_length += pExtent.fe_length;
+                l_Prev.fe_flags = pExtent.fe_flags;
+                return;
+            }
+        }
+        extents.push_back(pExtent);
+
+        return;
+    }
 
     virtual int fetch()
     {
         int       rc;
         int       fd;
-        size_t    mapsize;
 
         if(fetched)
             return 0;
 
         fd = fh->getfd();
 
-        mapsize = sizeof(fiemap_t);
-        extents = (fiemap_t*)malloc(mapsize);
-        memset(extents, 0, mapsize);
-        extents->fm_length = FIEMAP_MAX_OFFSET;
-        rc = ioctl(fd, FS_IOC_FIEMAP, extents);
-        if(rc < 0)
-        {
-            // fail
-            free(extents);
-            throw runtime_error(string("ioctl(FS_IOC_FIEMAP failed. errno=") + to_string(errno));
-            return rc;
-        }
-        numextents = extents->fm_mapped_extents;
-        mapsize += numextents * sizeof(fiemap_extent_t);
-        extents = (fiemap_t*)realloc(extents, mapsize);
-        memset(extents, 0, mapsize);
-        extents->fm_length = FIEMAP_MAX_OFFSET;
-        extents->fm_extent_count = numextents;
-        rc = ioctl(fd, FS_IOC_FIEMAP, extents);
-        if(rc < 0)
+        // The mapping is read in batches into a per thread buffer, continuing after the last
+        // extent returned until the kernel flags the last extent of the file
+        static thread_local vector<char> l_Buffer(sizeof(fiemap_t) + FIEMAP_BATCH_EXTENTS * sizeof(fiemap_extent_t));
+        fiemap_t* l_Map = (fiemap_t*)l_Buffer.data();
+
+        extents.clear();
+        uint64_t l_Start = 0;
+        bool l_Last = false;
+        while (!l_Last)
         {
-            // fail
-            free(extents);
-            throw runtime_error(string("ioctl(FS_IOC_FIEMAP failed. errno=") + to_string(errno));
-            return rc;
+            memset(l_Map, 0, sizeof(fiemap_t));
+            l_Map->fm_start = l_Start;
+            l_Map->fm_length = FIEMAP_MAX_OFFSET - l_Start;
+            l_Map->fm_extent_count = FIEMAP_BATCH_EXTENTS;
+            rc = ioctl(fd, FS_IOC_FIEMAP, l_Map);
+            if(rc < 0)
+            {
+                // fail
+                extents.clear();
+                throw runtime_error(string("ioctl(FS_IOC_FIEMAP failed. errno=") + to_string(errno));
+                return rc;
+            }
+            if (l_Map->fm_mapped_extents == 0)
+                break;
+
+            for (uint32_t i=0; i<l_Map->fm_mapped_extents; i++)
+            {
+                append(l_Map->fm_extents[i]);
+            }
+            const fiemap_extent_t& l_Final = l_Map->fm_extents[l_Map->fm_mapped_extents-1];
+            l_Last = ((l_Final.fe_flags & FIEMAP_EXTENT_LAST) || (l_Map->fm_mapped_extents < FIEMAP_BATCH_EXTENTS));
+            l_Start = l_Final.fe_logical + l_Final.fe_length;
         }
+        numextents = extents.size();
         fetched = true;
 
         return 0;
@@ -670,9 +703,8 @@ protected:
 public:
     extentLookup_fiemap(const filehandle* fileh) :
         extentLookup(fileh),
-        numextents(0),
-        extents(NULL) { };
-    virtual ~extentLookup_fiemap() { free(extents); };
+        numextents(0) { };
+    virtual ~extentLookup_fiemap() { };
 
     virtual int size(unsigned& numentries)
     {
@@ -700,7 +732,7 @@ public:
             len   = 0;
             return -1;
         }
-        uint64_t flags = extents->fm_extents[index].fe_flags;
+        uint64_t flags = extents[index].fe_flags;
         if(flags & FIEMAP_EXTENT_UNWRITTEN)
         {
             lba   = 0;
@@ -710,9 +742,9 @@ public:
             return -2;
         }
 
-        lba   = extents->fm_extents[index].fe_physical;
-        start = extents->fm_extents[index].fe_logical;
-        len   = extents->fm_extents[index].fe_length;
+        lba   = extents[index].fe_physical;
+        start = extents[index].fe_logical;
+        len   = extents[index].fe_length;
 
         return 0;
     }
@@ -911,7 +943,11 @@ int filehandle::protect(off_t start, size_t len, bool writing, Extent& input, ve
 
     if(!config.get(process_whoami+".use_export_layout", false))
     {
-        extlookup = new extentLookup_fiemap(this);
+        // NOTE: The extents of a source file may already have been fetched by prefetchExtents()
+        if (!extlookup)
+        {
+            extlookup = new extentLookup_fiemap(this);
+        }
         if(writing)
         {
             LOG(bb,debug) << "Performing fallocate(fd=" << fd << ", start=" << start << ", size=" << len << ")";
@@ -1070,4 +1106,77 @@ int filehandle::protect(off_t start, size_t len, bool writing, Extent& input, ve
     return 0;
 }
 
+int filehandle::prefetchExtents()
+{
+    int rc = 0;
+
+    if (extlookup)
+        return 0;
+
+    extlookup = new extentLookup_fiemap(this);
+    try
+    {
+        // Same ordering as protect(), allocate any delayed blocks before mapping
+        fdatasync(fd);
+        unsigned numextents = 0;
+        extlookup->size(numextents);
+        FL_Write(FLExtents, PrefetchExtents, "Prefetched FS extents.  fd=%ld  numextents=%ld", fd, numextents, 0, 0);
+    }
+    catch(exception& e)
+    {
+        // NOTE: protect() fetches again and fails the file
+        rc = -1;
+        LOG(bb,debug) << "Prefetching the extents of " << filename << " failed: " << e.what();
+    }
+
+    return rc;
+}
+
+class extentPrefetch
+{
+  public:
+    vector<filehandle*>* files;
+    atomic<size_t>       next;
+};
+
+static void* extentPrefetchWorker(void* ptr)
+{
+    extentPrefetch* l_Prefetch = (extentPrefetch*)ptr;
+    for (size_t i=l_Prefetch->next++; i<l_Prefetch->files->size(); i=l_Prefetch->next++)
+    {
+        (*l_Prefetch->files)[i]->prefetchExtents();
+    }
+
+    return NULL;
+}
+
+void prefetchExtents(vector<filehandle*>& pFiles, const unsigned pNumThreads)
+{
+    extentPrefetch l_Prefetch;
+    l_Prefetch.files = &pFiles;
+    l_Prefetch.next = 0;
+
+    unsigned l_NumThreads = MIN((size_t)pNumThreads, pFiles.size());
+    vector<pthread_t> l_Threads;
+    for (unsigned x=1; x<l_NumThreads; x++)
+    {
+        pthread_t tid;
+        if (pthread_create(&tid, NULL, extentPrefetchWorker, &l_Prefetch))
+        {
+            break;
+        }
+        l_Threads.push_back(tid);
+    }
+
+    // The calling thread works through the list as well
+    extentPrefetchWorker(&l_Prefetch);
+    for (auto& tid : l_Threads)
+    {
+        pthread_join(tid, NULL);
+    }
+    LOG(bb,debug) << "Prefetched the extents of " << pFiles.size() << " file(s) using " << l_Threads.size()+1 << " thread(s)";
+
+    return;
+}
+
 #endif
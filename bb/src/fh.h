@@ -176,6 +176,7 @@ class filehandle
     int             close();
     void            dump(const char* pSev, const char* pPrefix=0);
     int             getstats(struct stat& statbuf);
+    int             prefetchExtents();
     int             protect(off_t start, size_t len, bool writing, class Extent& input, vector<class Extent>& result);
     int             release(BBFILESTATUS completion_status);
     int             setsize(size_t newsize);
@@ -195,5 +196,6 @@ extern void FileHandleRegistryUnlock();
 extern int findFilehandle(filehandle* &fh, uint64_t jobid, uint64_t handle, uint32_t contrib, uint32_t index);
 extern int removeFilehandle(filehandle* &fh, uint64_t jobid, uint64_t handle, uint32_t contrib, uint32_t index, const CHECK_FOR_RESTART_INDICATOR pCheckForRestart=DO_NOT_CHECK_FOR_RESTART);
 extern void removeNextFilehandleByJobId(filehandle* &fh, uint64_t jobid);
+extern void prefetchExtents(vector<filehandle*>& pFiles, const unsigned pNumThreads);
 
 #endif /* BB_FH_H_ */
@@ -37,6 +37,7 @@ namespace bs  = boost::system;
 #include "bbinternal.h"
 #include "bbio_regular.h"
 #include "bbio_BSCFS.h"
+#include "bbioengine.h"
 #include "BBLV_Info.h"
 #include "BBLV_Metadata.h"
 #include "bbserver_flightlog.h"
@@ -50,6 +51,7 @@ namespace bs  = boost::system;
 #include "ContribIdFile.h"
 #include "ExtentInfo.h"
 #include "identity.h"
+#include "MetadataCache.h"
 #include "Msg.h"
 #include "WorkID.h"
 #include "xfer.h"
@@ -64,6 +66,8 @@ namespace bs  = boost::system;
 // Control elements for wrkqmgr
 sem_t sem_workqueue;
 size_t  transferBufferSize   = 0;
+string  transferEngine       = DEFAULT_TRANSFER_ENGINE;
+uint32_t transferQueueDepth  = DEFAULT_TRANSFER_QUEUE_DEPTH;
 pthread_once_t startThreadsControl = PTHREAD_ONCE_INIT;
 
 string getDeviceBySerial(string serial);
@@ -2691,6 +2695,9 @@ void startThreads(void)
 
     unsigned numbuffers = config.get(resolveServerConfigKey("numTransferBuffers"), numthreads);
     transferBufferSize   = config.get(resolveServerConfigKey("workerBufferSize"), 16*1024*1024);
+    transferEngine       = config.get(resolveServerConfigKey("transferEngine"), DEFAULT_TRANSFER_ENGINE);
+    transferQueueDepth   = config.get(resolveServerConfigKey("transferQueueDepth"), DEFAULT_TRANSFER_QUEUE_DEPTH);
+    LOG(bb,info) << "Transfer engine " << transferEngine << ", queue depth " << transferQueueDepth << ", buffer size " << transferBufferSize;
     for(x=0; x<numbuffers; x++)
     {
         void* buffer = mmap(NULL, transferBufferSize, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
@@ -3731,6 +3738,7 @@ int removeJobInfo(const string& pHostName, const uint64_t pJobId)
 
     // Perform any cleanup of the local bbServer metadata
     metadata.cleanUpAll(pJobId);
+    metadataCache.removeJob(pJobId);
 
     if (sameHostName(pHostName))
     {
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ |    bbioengine_test.cc
+ |
+ |  � Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//
+// Exercises the asynchronous transfer engines with short reads and short
+// writes.  bbio relies on the engine reporting the real byte count so it can
+// finish or fail the chunk itself.
+//
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/resource.h>
+
+#include "bbioengine.h"
+#include "csmutil/include/csm_test_utils.h"
+
+// Normally defined by bbServer from its configuration
+string   transferEngine = "auto";
+uint32_t transferQueueDepth = DEFAULT_TRANSFER_QUEUE_DEPTH;
+
+#define CHUNK 4096
+#define VALID 100
+
+static int failures = 0;
+
+static ssize_t runOne(BBIOEngine* pEngine, BBIO_ENGINE_OP pOp, int pFd, char* pBuffer, size_t pLength, off_t pOffset)
+{
+    uint64_t l_Tag = 0;
+    ssize_t l_Result = 0;
+
+    int rc = pEngine->submit(pOp, pFd, pBuffer, pLength, pOffset, 7);
+    if (rc)
+    {
+        return rc;
+    }
+    rc = pEngine->reap(l_Tag, l_Result);
+    if (rc)
+    {
+        return rc;
+    }
+    CHECK(l_Tag == 7, "reaped tag %lu, expected 7", (unsigned long)l_Tag);
+    CHECK(pEngine->getNumInflight() == 0, "%u requests still in flight", pEngine->getNumInflight());
+
+    return l_Result;
+}
+
+static void testShortRead(BBIOEngine* pEngine, const char* pName)
+{
+    char l_Path[] = "/tmp/bbioengine_testXXXXXX";
+    int fd = mkstemp(l_Path);
+    CHECK(fd >= 0, "%s: mkstemp failed, errno=%d", pName, errno);
+    if (fd < 0)
+    {
+        return;
+    }
+    unlink(l_Path);
+
+    char* l_Buffer = (char*)aligned_alloc(CHUNK, CHUNK);
+    memset(l_Buffer, 'a', VALID);
+    CHECK(::pwrite(fd, l_Buffer, VALID, 0) == VALID, "%s: seeding the file failed", pName);
+
+    // Only VALID bytes exist behind the offset
+    memset(l_Buffer, 0, CHUNK);
+    ssize_t l_Result = runOne(pEngine, BBIO_ENGINE_READ, fd, l_Buffer, CHUNK, 0);
+    CHECK(l_Result == VALID, "%s: short read returned %ld, expected %d", pName, (long)l_Result, VALID);
+    CHECK(l_Buffer[0] == 'a' && l_Buffer[VALID-1] == 'a', "%s: short read returned the wrong data", pName);
+
+    // Nothing exists behind the offset
+    l_Result = runOne(pEngine, BBIO_ENGINE_READ, fd, l_Buffer, CHUNK, CHUNK);
+    CHECK(l_Result == 0, "%s: read past end of file returned %ld, expected 0", pName, (long)l_Result);
+
+    free(l_Buffer);
+    close(fd);
+}
+
+static void testShortWrite(BBIOEngine* pEngine, const char* pName)
+{
+    char l_Path[] = "/tmp/bbioengine_testXXXXXX";
+    int fd = mkstemp(l_Path);
+    CHECK(fd >= 0, "%s: mkstemp failed, errno=%d", pName, errno);
+    if (fd < 0)
+    {
+        return;
+    }
+    unlink(l_Path);
+
+    char* l_Buffer = (char*)aligned_alloc(CHUNK, CHUNK);
+    memset(l_Buffer, 'b', CHUNK);
+
+    // Cap the file size so only VALID bytes of the chunk fit
+    struct rlimit l_Old;
+    struct rlimit l_New;
+    getrlimit(RLIMIT_FSIZE, &l_Old);
+    l_New = l_Old;
+    l_New.rlim_cur = CHUNK + VALID;
+    signal(SIGXFSZ, SIG_IGN);
+    CHECK(setrlimit(RLIMIT_FSIZE, &l_New) == 0, "%s: setrlimit failed, errno=%d", pName, errno);
+
+    ssize_t l_Result = runOne(pEngine, BBIO_ENGINE_WRITE, fd, l_Buffer, CHUNK, CHUNK);
+    CHECK(l_Result == VALID, "%s: short write returned %ld, expected %d", pName, (long)l_Result, VALID);
+
+    // Nothing fits at all
+    l_Result = runOne(pEngine, BBIO_ENGINE_WRITE, fd, l_Buffer, CHUNK, 2*CHUNK);
+    CHECK(l_Result == -EFBIG, "%s: write past the limit returned %ld, expected %d", pName, (long)l_Result, -EFBIG);
+
+    setrlimit(RLIMIT_FSIZE, &l_Old);
+    signal(SIGXFSZ, SIG_DFL);
+
+    free(l_Buffer);
+    close(fd);
+}
+
+int main(int argc, char** argv)
+{
+    const char* l_Names[] = {"io_uring", "aio"};
+
+    for (size_t i=0; i<sizeof(l_Names)/sizeof(l_Names[0]); ++i)
+    {
+        BBIOEngine* l_Engine = BBIOEngine::create(l_Names[i], transferQueueDepth);
+        if (!l_Engine)
+        {
+            printf("%s: not available, skipped\n", l_Names[i]);
+            continue;
+        }
+
+        testShortRead(l_Engine, l_Names[i]);
+        testShortWrite(l_Engine, l_Names[i]);
+        l_Engine->drain();
+        delete l_Engine;
+    }
+
+    printf("bbioengine_test: %d failure(s)\n", failures);
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ |    metadataarchive_test.cc
+ |
+ |   Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//
+// Exercises saveMetadataArchive()/loadMetadataArchive(): both formats round
+// trip, the format is detected from the file itself whatever the current
+// setting is, and a partially written file fails to load.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include "MetadataArchive.h"
+#include "csmutil/include/csm_test_utils.h"
+
+// Normally defined by bbServer from its configuration
+METADATA_ARCHIVE_FORMAT g_MetadataArchiveFormat = TEXT_METADATA_ARCHIVE;
+
+static int failures = 0;
+
+class Archived
+{
+  public:
+    Archived() :
+        tag(0) {}
+
+    template<class Archive>
+    void serialize(Archive& pArchive, const unsigned int pVersion)
+    {
+        pArchive & tag;
+        pArchive & name;
+        pArchive & extents;
+        pArchive & contribs;
+    }
+
+    bool operator==(const Archived& pOther) const
+    {
+        return tag == pOther.tag && name == pOther.name && extents == pOther.extents && contribs == pOther.contribs;
+    }
+
+    uint64_t tag;
+    string name;
+    vector<uint32_t> extents;
+    map<uint32_t, string> contribs;
+};
+
+static Archived sample()
+{
+    Archived l_Object;
+    l_Object.tag = 0x123456789ULL;
+    l_Object.name = "handle file with spaces";
+    l_Object.extents = {1, 2, 3, 0xFFFFFFFF};
+    l_Object.contribs[0] = "/gpfs/a";
+    l_Object.contribs[7] = "";
+
+    return l_Object;
+}
+
+static string head(const char* pPath, const size_t pLength)
+{
+    char l_Buffer[64] = {'\0'};
+    FILE* l_File = fopen(pPath, "rb");
+    size_t l_Read = (l_File ? fread(l_Buffer, 1, pLength, l_File) : 0);
+    if (l_File)
+    {
+        fclose(l_File);
+    }
+
+    return string(l_Buffer, l_Read);
+}
+
+static bool loads(const char* pPath, Archived& pObject)
+{
+    try
+    {
+        loadMetadataArchive(pPath, pObject);
+    }
+    catch(archive_exception& e)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+static void testRoundTrip(const char* pPath, const METADATA_ARCHIVE_FORMAT pFormat)
+{
+    const char* l_Name = (pFormat == TEXT_METADATA_ARCHIVE ? "text" : "binary");
+    g_MetadataArchiveFormat = pFormat;
+    saveMetadataArchive(pPath, sample());
+
+    bool l_Binary = (head(pPath, BINARY_METADATA_ARCHIVE_MARKER_LENGTH) == BINARY_METADATA_ARCHIVE_MARKER);
+    CHECK(l_Binary == (pFormat == BINARY_METADATA_ARCHIVE), "%s archive written in the wrong format", l_Name);
+
+    // Read with the same setting, and with the other setting
+    Archived l_Object;
+    CHECK(loads(pPath, l_Object) && l_Object == sample(), "%s archive did not round trip", l_Name);
+
+    g_MetadataArchiveFormat = (pFormat == TEXT_METADATA_ARCHIVE ? BINARY_METADATA_ARCHIVE : TEXT_METADATA_ARCHIVE);
+    Archived l_Other;
+    CHECK(loads(pPath, l_Other) && l_Other == sample(), "%s archive not read with the other format setting", l_Name);
+}
+
+static void testTextUpgrade(const char* pPath)
+{
+    // A text archive left by a prior level is read with metadataArchiveFormat=binary,
+    // and rewritten in the binary format on its next update
+    g_MetadataArchiveFormat = TEXT_METADATA_ARCHIVE;
+    saveMetadataArchive(pPath, sample());
+
+    g_MetadataArchiveFormat = BINARY_METADATA_ARCHIVE;
+    Archived l_Object;
+    CHECK(loads(pPath, l_Object) && l_Object == sample(), "text archive not read with the binary setting");
+    l_Object.tag = 99;
+    saveMetadataArchive(pPath, l_Object);
+    CHECK(head(pPath, BINARY_METADATA_ARCHIVE_MARKER_LENGTH) == BINARY_METADATA_ARCHIVE_MARKER, "updated archive not rewritten in binary");
+
+    Archived l_Updated;
+    CHECK(loads(pPath, l_Updated) && l_Updated.tag == 99, "rewritten archive not read");
+}
+
+static void testPartial(const char* pPath)
+{
+    Archived l_Object;
+    CHECK(!loads("/nonexistent/metadataarchive_test", l_Object), "missing archive loaded");
+
+    for (int l_Format=TEXT_METADATA_ARCHIVE; l_Format<=BINARY_METADATA_ARCHIVE; ++l_Format)
+    {
+        g_MetadataArchiveFormat = (METADATA_ARCHIVE_FORMAT)l_Format;
+        saveMetadataArchive(pPath, sample());
+
+        // A reader that catches the file in the middle of being written
+        struct stat l_Stat;
+        stat(pPath, &l_Stat);
+        CHECK(truncate(pPath, l_Stat.st_size/2) == 0, "truncate failed");
+        CHECK(!loads(pPath, l_Object), "partial %s archive loaded", (l_Format == TEXT_METADATA_ARCHIVE ? "text" : "binary"));
+    }
+
+    // An empty file, e.g. created but not yet written
+    CHECK(truncate(pPath, 0) == 0, "truncate failed");
+    CHECK(!loads(pPath, l_Object), "empty archive loaded");
+}
+
+int main(int argc, char** argv)
+{
+    char l_Path[] = "/tmp/metadataarchive_testXXXXXX";
+    int fd = mkstemp(l_Path);
+    if (fd < 0)
+    {
+        printf("metadataarchive_test: mkstemp failed\n");
+        return 1;
+    }
+    close(fd);
+
+    testRoundTrip(l_Path, TEXT_METADATA_ARCHIVE);
+    testRoundTrip(l_Path, BINARY_METADATA_ARCHIVE);
+    testTextUpgrade(l_Path);
+    testPartial(l_Path);
+
+    unlink(l_Path);
+
+    printf("metadataarchive_test: %d failure(s)\n", failures);
+
+    return failures ? 1 : 0;
+}
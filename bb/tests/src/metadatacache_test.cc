@@ -0,0 +1,325 @@
+/*******************************************************************************
+ |    metadatacache_test.cc
+ |
+ |   Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//
+// Exercises the bbServer metadata cache: hits are only returned while the
+// stat of the archive is unchanged, the least recently used archive or handle
+// location is evicted first, and invalidate/removeJob drop entries.  An archive
+// rewritten with the same size within the timestamp granule is not returned.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bbinternal.h"
+#include "ContribFile.h"
+#include "HandleFile.h"
+#include "MetadataArchive.h"
+#include "MetadataCache.h"
+#include "csmutil/include/csm_test_utils.h"
+
+// Normally defined by bbServer from its configuration
+string g_BBServer_Metadata_Path = "/meta";
+METADATA_ARCHIVE_FORMAT g_MetadataArchiveFormat = TEXT_METADATA_ARCHIVE;
+
+static int failures = 0;
+
+// Stat of an archive last modified by another bbServer, whose clock is not
+// related to this one
+static struct stat archiveStat(const ino_t pIno, const off_t pSize=100)
+{
+    struct stat l_Stat;
+    memset(&l_Stat, 0, sizeof(l_Stat));
+    l_Stat.st_mtim.tv_sec = 4000000000;
+    l_Stat.st_mtim.tv_nsec = 5;
+    l_Stat.st_ctim = l_Stat.st_mtim;
+    l_Stat.st_ino = pIno;
+    l_Stat.st_size = pSize;
+
+    return l_Stat;
+}
+
+static int cached(MetadataCache& pCache, const string& pPath, const struct stat& pStat)
+{
+    HandleFile* l_HandleFile = pCache.findHandleFile(pPath, pStat);
+    int rc = (l_HandleFile != 0);
+    delete l_HandleFile;
+
+    return rc;
+}
+
+static void addHandleFile(MetadataCache& pCache, const string& pPath, const struct stat& pStat, const uint64_t pTag)
+{
+    HandleFile l_HandleFile;
+    l_HandleFile.tag = pTag;
+    pCache.addHandleFile(pPath, pStat, pStat, &l_HandleFile);
+}
+
+static void testHit()
+{
+    MetadataCache l_Cache;
+    struct stat l_Stat = archiveStat(1);
+    string l_Path = "/meta/1/handle";
+
+    CHECK(!cached(l_Cache, l_Path, l_Stat), "empty cache returned an archive");
+
+    addHandleFile(l_Cache, l_Path, l_Stat, 42);
+    HandleFile* l_HandleFile = l_Cache.findHandleFile(l_Path, l_Stat);
+    CHECK(l_HandleFile && l_HandleFile->tag == 42, "cached handle file not returned");
+    delete l_HandleFile;
+
+    // The caller owns a copy, the cached archive is unchanged
+    l_HandleFile = l_Cache.findHandleFile(l_Path, l_Stat);
+    if (l_HandleFile)
+    {
+        l_HandleFile->tag = 7;
+        delete l_HandleFile;
+    }
+    l_HandleFile = l_Cache.findHandleFile(l_Path, l_Stat);
+    CHECK(l_HandleFile && l_HandleFile->tag == 42, "cached handle file modified through a returned copy");
+    delete l_HandleFile;
+
+    // A handle archive is not returned as a contrib archive
+    ContribFile* l_ContribFile = l_Cache.findContribFile(l_Path, l_Stat);
+    CHECK(l_ContribFile == 0, "handle archive returned as contrib archive");
+    delete l_ContribFile;
+
+    ContribFile l_Contribs;
+    l_Contribs.contribs[3] = ContribIdFile();
+    l_Cache.addContribFile("/meta/1/contribs", l_Stat, l_Stat, &l_Contribs);
+    l_ContribFile = l_Cache.findContribFile("/meta/1/contribs", l_Stat);
+    CHECK(l_ContribFile && l_ContribFile->contribs.size() == 1 && l_ContribFile->contribs.count(3), "cached contrib file not returned");
+    delete l_ContribFile;
+
+    // Handle locations
+    uint64_t l_JobId = 0;
+    uint64_t l_JobStepId = 0;
+    CHECK(!l_Cache.findHandle(5, l_JobId, l_JobStepId), "unknown handle found");
+    l_Cache.addHandle(5, 1, 2);
+    CHECK(l_Cache.findHandle(5, l_JobId, l_JobStepId) && l_JobId == 1 && l_JobStepId == 2, "handle location not found");
+}
+
+static void testStale()
+{
+    MetadataCache l_Cache;
+    struct stat l_Stat = archiveStat(1);
+    string l_Path = "/meta/1/handle";
+
+    // Any change to the archive seen by stat() is a miss and drops the entry
+    addHandleFile(l_Cache, l_Path, l_Stat, 1);
+    struct stat l_Changed = l_Stat;
+    l_Changed.st_size += 1;
+    CHECK(!cached(l_Cache, l_Path, l_Changed), "archive with a different size returned");
+    CHECK(!cached(l_Cache, l_Path, l_Stat), "stale entry not dropped");
+
+    addHandleFile(l_Cache, l_Path, l_Stat, 1);
+    l_Changed = l_Stat;
+    l_Changed.st_ino += 1;
+    CHECK(!cached(l_Cache, l_Path, l_Changed), "replaced archive returned");
+
+    addHandleFile(l_Cache, l_Path, l_Stat, 1);
+    l_Changed = l_Stat;
+    l_Changed.st_mtim.tv_nsec += 1;
+    CHECK(!cached(l_Cache, l_Path, l_Changed), "rewritten archive returned");
+
+    // Rewritten while it was being read, neither version is cached
+    HandleFile l_HandleFile;
+    l_Changed = l_Stat;
+    l_Changed.st_ctim.tv_nsec += 1;
+    l_Cache.addHandleFile(l_Path, l_Stat, l_Changed, &l_HandleFile);
+    CHECK(!cached(l_Cache, l_Path, l_Stat), "archive changed during the read returned for the prior stat");
+    CHECK(!cached(l_Cache, l_Path, l_Changed), "archive changed during the read returned for the new stat");
+
+    // A rewrite during the read does not leave a prior entry behind either
+    addHandleFile(l_Cache, l_Path, l_Stat, 1);
+    l_Cache.addHandleFile(l_Path, l_Stat, l_Changed, &l_HandleFile);
+    CHECK(!cached(l_Cache, l_Path, l_Stat), "prior entry kept after a read that saw a change");
+
+    CHECK(MetadataCache::sameVersion(l_Stat, l_Stat), "identical stats not the same version");
+    CHECK(!MetadataCache::sameVersion(l_Stat, l_Changed), "changed ctime seen as the same version");
+}
+
+static void testEviction()
+{
+    MetadataCache l_Cache;
+    struct stat l_Stat = archiveStat(1);
+
+    l_Cache.setMaximumEntries(2);
+    addHandleFile(l_Cache, "/meta/1/a", l_Stat, 1);
+    addHandleFile(l_Cache, "/meta/1/b", l_Stat, 2);
+
+    // a becomes the most recently used, so b is evicted by c
+    CHECK(cached(l_Cache, "/meta/1/a", l_Stat), "a not cached");
+    addHandleFile(l_Cache, "/meta/1/c", l_Stat, 3);
+    CHECK(cached(l_Cache, "/meta/1/a", l_Stat), "most recently used archive evicted");
+    CHECK(!cached(l_Cache, "/meta/1/b", l_Stat), "least recently used archive not evicted");
+    CHECK(cached(l_Cache, "/meta/1/c", l_Stat), "newest archive not cached");
+
+    // Re-adding an archive replaces it without growing the cache
+    addHandleFile(l_Cache, "/meta/1/c", l_Stat, 4);
+    HandleFile* l_HandleFile = l_Cache.findHandleFile("/meta/1/c", l_Stat);
+    CHECK(l_HandleFile && l_HandleFile->tag == 4, "re-added archive not replaced");
+    delete l_HandleFile;
+    CHECK(cached(l_Cache, "/meta/1/a", l_Stat), "re-adding an archive evicted another");
+
+    // Shrinking prunes, least recently used first (a was looked up last)
+    l_Cache.setMaximumEntries(1);
+    CHECK(!cached(l_Cache, "/meta/1/c", l_Stat), "cache not pruned to its new size");
+    CHECK(cached(l_Cache, "/meta/1/a", l_Stat), "most recently used archive pruned");
+
+    // Zero disables archive caching
+    l_Cache.setMaximumEntries(0);
+    CHECK(!cached(l_Cache, "/meta/1/a", l_Stat), "archive kept with caching disabled");
+    addHandleFile(l_Cache, "/meta/1/d", l_Stat, 5);
+    CHECK(!cached(l_Cache, "/meta/1/d", l_Stat), "archive cached with caching disabled");
+}
+
+static void testHandleEviction()
+{
+    MetadataCache l_Cache;
+    uint64_t l_JobId = 0;
+    uint64_t l_JobStepId = 0;
+
+    // Handle locations are bounded and evicted least recently used first
+    l_Cache.setMaximumEntries(2);
+    l_Cache.addHandle(1, 10, 0);
+    l_Cache.addHandle(2, 20, 0);
+    CHECK(l_Cache.findHandle(1, l_JobId, l_JobStepId), "handle 1 not found");
+    l_Cache.addHandle(3, 30, 0);
+    CHECK(l_Cache.findHandle(1, l_JobId, l_JobStepId) && l_JobId == 10, "most recently used handle evicted");
+    CHECK(!l_Cache.findHandle(2, l_JobId, l_JobStepId), "least recently used handle not evicted");
+    CHECK(l_Cache.findHandle(3, l_JobId, l_JobStepId) && l_JobId == 30, "newest handle not cached");
+
+    // Re-adding a handle replaces its location without growing the cache
+    l_Cache.addHandle(3, 31, 1);
+    CHECK(l_Cache.findHandle(3, l_JobId, l_JobStepId) && l_JobId == 31 && l_JobStepId == 1, "re-added handle not replaced");
+    CHECK(l_Cache.findHandle(1, l_JobId, l_JobStepId), "re-adding a handle evicted another");
+
+    // Many handles never exceed the limit
+    for (uint64_t l_Handle=100; l_Handle<1100; ++l_Handle)
+    {
+        l_Cache.addHandle(l_Handle, 1, 0);
+    }
+    CHECK(l_Cache.findHandle(1098, l_JobId, l_JobStepId) && l_Cache.findHandle(1099, l_JobId, l_JobStepId), "latest handles not cached");
+    CHECK(!l_Cache.findHandle(1097, l_JobId, l_JobStepId), "handles kept beyond the limit");
+    CHECK(!l_Cache.findHandle(1, l_JobId, l_JobStepId), "old handle kept beyond the limit");
+
+    // Shrinking prunes the handles, zero disables them
+    l_Cache.setMaximumEntries(1);
+    CHECK(!l_Cache.findHandle(1098, l_JobId, l_JobStepId), "handles not pruned to the new size");
+    CHECK(l_Cache.findHandle(1099, l_JobId, l_JobStepId), "most recently used handle pruned");
+    l_Cache.setMaximumEntries(0);
+    CHECK(!l_Cache.findHandle(1099, l_JobId, l_JobStepId), "handle kept with caching disabled");
+    l_Cache.addHandle(5, 1, 0);
+    CHECK(!l_Cache.findHandle(5, l_JobId, l_JobStepId), "handle cached with caching disabled");
+
+    // removeJob of a job with evicted handles only drops what is left
+    l_Cache.setMaximumEntries(2);
+    l_Cache.addHandle(6, 1, 0);
+    l_Cache.addHandle(7, 2, 0);
+    l_Cache.addHandle(8, 1, 0);
+    l_Cache.removeJob(1);
+    CHECK(!l_Cache.findHandle(8, l_JobId, l_JobStepId), "handle of removed job found");
+    CHECK(l_Cache.findHandle(7, l_JobId, l_JobStepId) && l_JobId == 2, "removeJob dropped a handle of another job");
+    l_Cache.addHandle(9, 3, 0);
+    l_Cache.addHandle(10, 3, 0);
+    CHECK(!l_Cache.findHandle(7, l_JobId, l_JobStepId), "handle list inconsistent after removeJob");
+}
+
+static void testInvalidation()
+{
+    MetadataCache l_Cache;
+    struct stat l_Stat = archiveStat(1);
+    uint64_t l_JobId = 0;
+    uint64_t l_JobStepId = 0;
+
+    addHandleFile(l_Cache, "/meta/1/a", l_Stat, 1);
+    addHandleFile(l_Cache, "/meta/1/b", l_Stat, 2);
+    l_Cache.invalidate("/meta/1/a");
+    CHECK(!cached(l_Cache, "/meta/1/a", l_Stat), "invalidated archive returned");
+    CHECK(cached(l_Cache, "/meta/1/b", l_Stat), "invalidate dropped another archive");
+    l_Cache.invalidate("/meta/1/unknown");
+
+    // removeJob drops archives and handle locations of that job only
+    addHandleFile(l_Cache, "/meta/2/a", l_Stat, 3);
+    addHandleFile(l_Cache, "/meta/12/a", l_Stat, 4);
+    l_Cache.addHandle(10, 1, 0);
+    l_Cache.addHandle(20, 2, 0);
+    l_Cache.removeJob(1);
+    CHECK(!cached(l_Cache, "/meta/1/b", l_Stat), "archive of removed job returned");
+    CHECK(!l_Cache.findHandle(10, l_JobId, l_JobStepId), "handle of removed job found");
+    CHECK(cached(l_Cache, "/meta/2/a", l_Stat), "removeJob dropped an archive of another job");
+    CHECK(cached(l_Cache, "/meta/12/a", l_Stat), "removeJob matched the jobid as a prefix");
+    CHECK(l_Cache.findHandle(20, l_JobId, l_JobStepId) && l_JobId == 2, "removeJob dropped a handle of another job");
+}
+
+static void testRewrite()
+{
+    char l_Path[] = "/tmp/metadatacache_testXXXXXX";
+    int fd = mkstemp(l_Path);
+    CHECK(fd >= 0, "mkstemp failed");
+    if (fd < 0)
+    {
+        return;
+    }
+    close(fd);
+
+    for (int l_Format=TEXT_METADATA_ARCHIVE; l_Format<=BINARY_METADATA_ARCHIVE; ++l_Format)
+    {
+        const char* l_Name = (l_Format == TEXT_METADATA_ARCHIVE ? "text" : "binary");
+        g_MetadataArchiveFormat = (METADATA_ARCHIVE_FORMAT)l_Format;
+        MetadataCache l_Cache;
+
+        HandleFile l_HandleFile;
+        l_HandleFile.tag = 1;
+        saveMetadataArchive(l_Path, l_HandleFile);
+        struct stat l_Stat;
+        CHECK(stat(l_Path, &l_Stat) == 0, "stat of the %s archive failed", l_Name);
+        addHandleFile(l_Cache, l_Path, l_Stat, 1);
+        CHECK(cached(l_Cache, l_Path, l_Stat), "%s archive not cached", l_Name);
+
+        // Rewritten with the same size.  The timestamps of the prior version are
+        // kept, as on a file system whose timestamp granule covers both writes.
+        l_HandleFile.tag = 2;
+        saveMetadataArchive(l_Path, l_HandleFile);
+        struct stat l_Rewritten;
+        CHECK(stat(l_Path, &l_Rewritten) == 0, "stat of the rewritten %s archive failed", l_Name);
+        CHECK(l_Rewritten.st_size == l_Stat.st_size, "%s archive rewritten with a different size", l_Name);
+        l_Rewritten.st_mtim = l_Stat.st_mtim;
+        l_Rewritten.st_ctim = l_Stat.st_ctim;
+        CHECK(!MetadataCache::sameVersion(l_Stat, l_Rewritten), "rewritten %s archive seen as the same version", l_Name);
+        CHECK(!cached(l_Cache, l_Path, l_Rewritten), "same size rewrite of the %s archive returned the stale copy", l_Name);
+
+        HandleFile l_Loaded;
+        loadMetadataArchive(l_Path, l_Loaded);
+        CHECK(l_Loaded.tag == 2, "rewritten %s archive not read", l_Name);
+    }
+
+    unlink(l_Path);
+}
+
+int main(int argc, char** argv)
+{
+    testHit();
+    testStale();
+    testEviction();
+    testHandleEviction();
+    testInvalidation();
+    testRewrite();
+
+    printf("metadatacache_test: %d failure(s)\n", failures);
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,192 @@
+/*******************************************************************************
+ |    pushedasyncrequests_test.cc
+ |
+ |   Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//
+// Exercises the in-memory copies of pushed async requests against the
+// (sequence number, offset) positions and the records of the async request
+// file, and the queue that hands requests to the async request peers thread.
+//
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "PushedAsyncRequests.h"
+#include "csmutil/include/csm_test_utils.h"
+
+#define RECORD 1088
+
+static int failures = 0;
+
+static string record(const char pFill)
+{
+    return string(RECORD, pFill);
+}
+
+static void testClassify()
+{
+    // Next position to be read from the file is seqnbr 3, offset 2*RECORD
+    CHECK(PushedAsyncRequests::classify(3, 2*RECORD, 3, 2*RECORD) == PushedAsyncRequests::ENQUEUE, "next request not enqueued");
+    CHECK(PushedAsyncRequests::classify(3, 3*RECORD, 3, 2*RECORD) == PushedAsyncRequests::READ_FILE, "gap in the pushed requests not read from the file");
+    CHECK(PushedAsyncRequests::classify(4, 0, 3, 2*RECORD) == PushedAsyncRequests::READ_FILE, "swapped file not read");
+    CHECK(PushedAsyncRequests::classify(3, RECORD, 3, 2*RECORD) == PushedAsyncRequests::ALREADY_READ, "request already read from the file enqueued again");
+    CHECK(PushedAsyncRequests::classify(2, 5*RECORD, 3, 0) == PushedAsyncRequests::ALREADY_READ, "request from a prior file enqueued again");
+}
+
+static void testDedup()
+{
+    PushedAsyncRequests l_Pushed;
+    string l_Record;
+
+    CHECK(!l_Pushed.find(1, 0, l_Record), "empty store returned a request");
+    CHECK(l_Pushed.consecutive(1, 0, RECORD) == 0, "empty store has consecutive requests");
+
+    // Pushed out of order, with a gap at 2*RECORD
+    l_Pushed.add(1, RECORD, record('b'));
+    l_Pushed.add(1, 0, record('a'));
+    l_Pushed.add(1, 3*RECORD, record('d'));
+    l_Pushed.add(2, 0, record('x'));
+
+    CHECK(l_Pushed.find(1, RECORD, l_Record) && l_Record == record('b'), "pushed request not found");
+    CHECK(l_Pushed.consecutive(1, 0, RECORD) == 2, "consecutive requests from offset 0: %lu", (unsigned long)l_Pushed.consecutive(1, 0, RECORD));
+    CHECK(l_Pushed.consecutive(1, 2*RECORD, RECORD) == 0, "request in the gap reported");
+    CHECK(l_Pushed.consecutive(1, 3*RECORD, RECORD) == 1, "requests of the next file counted as consecutive");
+
+    // The same request pushed twice, e.g. after a reconnect, is kept once
+    l_Pushed.add(1, 0, record('a'));
+    CHECK(l_Pushed.size() == 4, "duplicate push stored twice, size %lu", (unsigned long)l_Pushed.size());
+
+    // Filling the gap makes the run consecutive
+    l_Pushed.add(1, 2*RECORD, record('c'));
+    CHECK(l_Pushed.consecutive(1, 0, RECORD) == 4, "gap filled, consecutive requests %lu", (unsigned long)l_Pushed.consecutive(1, 0, RECORD));
+}
+
+static void testLimit()
+{
+    PushedAsyncRequests l_Pushed(3);
+    string l_Record;
+
+    l_Pushed.add(2, 0, record('c'));
+    l_Pushed.add(1, RECORD, record('b'));
+    l_Pushed.add(1, 0, record('a'));
+    l_Pushed.add(2, RECORD, record('d'));
+
+    // The lowest (seqnbr, offset) is dropped first
+    CHECK(l_Pushed.size() == 3, "store not bounded, size %lu", (unsigned long)l_Pushed.size());
+    CHECK(!l_Pushed.find(1, 0, l_Record), "oldest request kept");
+    CHECK(l_Pushed.find(2, RECORD, l_Record) && l_Record == record('d'), "newest request dropped");
+}
+
+static void testVerify()
+{
+    PushedAsyncRequests l_Pushed;
+    string l_Record;
+
+    l_Pushed.add(1, 0, record('a'));
+    l_Pushed.add(1, RECORD, record('b'));
+    l_Pushed.add(1, 2*RECORD, record('c'));
+    l_Pushed.add(1, 3*RECORD, record('d'));
+
+    // The file has the pushed records, only what was read is verified
+    string l_File = record('a') + record('b') + record('c');
+    CHECK(l_Pushed.verify(1, 0, l_File.data(), 3, RECORD) == 3, "matching records not verified");
+    CHECK(l_Pushed.verify(1, 0, l_File.data(), 2, RECORD) == 2, "records beyond the file verified");
+    CHECK(l_Pushed.verify(1, RECORD, l_File.data()+RECORD, 2, RECORD) == 2, "records from a later offset not verified");
+    CHECK(l_Pushed.verify(2, 0, l_File.data(), 3, RECORD) == 0, "records of another file verified");
+
+    // A forged or stale push differs from the file, it is never verified and dropped
+    string l_Forged = record('a') + record('x') + record('c');
+    CHECK(l_Pushed.verify(1, 0, l_Forged.data(), 3, RECORD) == 1, "record that differs from the file verified");
+    CHECK(!l_Pushed.find(1, RECORD, l_Record), "record that differs from the file kept");
+    CHECK(l_Pushed.find(1, 2*RECORD, l_Record) && l_Pushed.find(1, 0, l_Record), "records that match the file dropped");
+    CHECK(l_Pushed.consecutive(1, 0, RECORD) == 1, "run continues past the dropped record");
+
+    // A push of the wrong length never matches
+    l_Pushed.add(3, 0, string("short"));
+    string l_Short = string("short") + string(RECORD-5, 'a');
+    CHECK(l_Pushed.verify(3, 0, l_Short.data(), 1, RECORD) == 0, "short record verified");
+}
+
+static void testQueue()
+{
+    AsyncRequestPushQueue l_Queue(2);
+    deque<PushedAsyncRequest> l_Requests;
+
+    // Nothing queued, the wait times out
+    time_t l_Start = time(0);
+    CHECK(l_Queue.wait(l_Requests, 1) == 0 && l_Requests.empty(), "empty queue returned requests");
+    CHECK(time(0) - l_Start <= 2, "wait on an empty queue did not time out");
+
+    CHECK(l_Queue.push(PushedAsyncRequest(1, 0, "a", 1)) == 0, "push failed");
+    CHECK(l_Queue.push(PushedAsyncRequest(1, RECORD, "b", 1)) == 0, "push failed");
+    CHECK(l_Queue.push(PushedAsyncRequest(1, 2*RECORD, "c", 1)) == 1, "full queue did not drop a request");
+    CHECK(l_Queue.getNumberDropped() == 1, "dropped count %lu", (unsigned long)l_Queue.getNumberDropped());
+
+    CHECK(l_Queue.wait(l_Requests, 1) == 0, "wait failed");
+    CHECK(l_Requests.size() == 2, "%lu requests returned", (unsigned long)l_Requests.size());
+    if (l_Requests.size() == 2)
+    {
+        CHECK(l_Requests[0].offset == RECORD && l_Requests[0].record == "b", "oldest request not dropped");
+        CHECK(l_Requests[1].offset == 2*RECORD && l_Requests[1].record == "c", "requests out of order");
+    }
+}
+
+static void* waiter(void* pQueue)
+{
+    deque<PushedAsyncRequest> l_Requests;
+    AsyncRequestPushQueue* l_Queue = (AsyncRequestPushQueue*)pQueue;
+    size_t l_Count = 0;
+    while (l_Queue->wait(l_Requests, 60) == 0)
+    {
+        l_Count += l_Requests.size();
+    }
+
+    return (void*)l_Count;
+}
+
+static void testStop()
+{
+    AsyncRequestPushQueue l_Queue;
+    pthread_t l_Tid;
+    pthread_create(&l_Tid, NULL, waiter, &l_Queue);
+
+    for (int i=0; i<10; ++i)
+    {
+        l_Queue.push(PushedAsyncRequest(1, i*RECORD, "r", 1));
+    }
+    usleep(100000);
+
+    // stop() wakes the waiter well before its 60 second timeout
+    time_t l_Start = time(0);
+    l_Queue.stop();
+    void* l_Count = 0;
+    pthread_join(l_Tid, &l_Count);
+    CHECK(time(0) - l_Start <= 2, "stop did not wake the waiter");
+    CHECK((size_t)l_Count == 10, "waiter received %lu requests", (unsigned long)(size_t)l_Count);
+    CHECK(l_Queue.push(PushedAsyncRequest(1, 0, "r", 1)) == -1, "stopped queue accepted a request");
+}
+
+int main(int argc, char** argv)
+{
+    testClassify();
+    testDedup();
+    testLimit();
+    testVerify();
+    testQueue();
+    testStop();
+
+    printf("pushedasyncrequests_test: %d failure(s)\n", failures);
+
+    return failures ? 1 : 0;
+}
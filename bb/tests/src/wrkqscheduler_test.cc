@@ -0,0 +1,211 @@
+/*******************************************************************************
+ |    wrkqscheduler_test.cc
+ |
+ |   Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//
+// Exercises the ready ring and timer wheel that the work queue manager
+// schedules work queues on: parking for one and for several turns of the
+// wheel, a rate reset that moves a parked work queue back to the ready ring,
+// and removal of emptied work queues from the ready ring.
+//
+
+#include <stdio.h>
+
+#include "WrkQScheduler.h"
+#include "csmutil/include/csm_test_utils.h"
+
+static int failures = 0;
+
+// The scheduling members of a WRKQE
+struct Entry
+{
+    Entry() :
+        schedNext(0),
+        schedPrev(0),
+        schedState(WRKQE_NOT_SCHEDULED),
+        wheelSlot(0),
+        wheelRounds(0) {}
+
+    Entry*               schedNext;
+    Entry*               schedPrev;
+    WRKQE_SCHEDULE_STATE schedState;
+    uint32_t             wheelSlot;
+    uint64_t             wheelRounds;
+};
+
+typedef WrkQScheduler<Entry> Scheduler;
+
+// Advance pScheduler until pEntry comes due, at most pLimit intervals.
+// Returns the number of intervals advanced, 0 if pEntry did not come due.
+static uint64_t intervalsUntilDue(Scheduler& pScheduler, Entry* pEntry, const uint64_t pLimit)
+{
+    for (uint64_t i=1; i<=pLimit; ++i)
+    {
+        bool l_Found = false;
+        for (Entry* l_Due = pScheduler.advance(); l_Due; l_Due = l_Due->schedNext)
+        {
+            l_Found = l_Found || (l_Due == pEntry);
+        }
+        if (l_Found)
+        {
+            return i;
+        }
+    }
+
+    return 0;
+}
+
+// The ready ring from the cursor, as indexes into pEntries
+static bool ringIs(Scheduler& pScheduler, Entry* pEntries, const int* pExpected, const size_t pCount)
+{
+    Entry* l_Entry = pScheduler.getReadyCursor();
+    if (pScheduler.getReadyCount() != pCount || (!pCount && l_Entry))
+    {
+        return false;
+    }
+    for (size_t i=0; i<pCount; ++i)
+    {
+        if (l_Entry != &pEntries[pExpected[i]] || l_Entry->schedNext->schedPrev != l_Entry ||
+            l_Entry->schedState != WRKQE_ON_READY_RING)
+        {
+            return false;
+        }
+        l_Entry = l_Entry->schedNext;
+    }
+
+    return l_Entry == pScheduler.getReadyCursor();
+}
+
+static void testIntervals()
+{
+    CHECK(Scheduler::intervalsFor(0, 100) == 1, "bucket of 0 not due next interval");
+    CHECK(Scheduler::intervalsFor(-100, 0) == 1, "unthrottled work queue not due next interval");
+    CHECK(Scheduler::intervalsFor(-100, 100) == 1, "bucket of -rate not due next interval");
+    CHECK(Scheduler::intervalsFor(-101, 100) == 2, "partial interval not rounded up");
+    CHECK(Scheduler::intervalsFor(-1000, 10) == 100, "%lu intervals for -1000 at 10", (unsigned long)Scheduler::intervalsFor(-1000, 10));
+}
+
+static void testPark()
+{
+    Scheduler l_Scheduler;
+    Entry l_Entries[4];
+
+    // Within one turn of the wheel, from a wheel that has already turned
+    intervalsUntilDue(l_Scheduler, 0, 5);
+    l_Scheduler.park(&l_Entries[0], 3);
+    CHECK(l_Entries[0].schedState == WRKQE_ON_TIMER_WHEEL && l_Scheduler.getParkedCount() == 1, "work queue not parked");
+    CHECK(intervalsUntilDue(l_Scheduler, &l_Entries[0], 3*WRKQ_TIMER_WHEEL_SLOTS) == 3, "parked for 3 intervals, not due after 3");
+    CHECK(l_Entries[0].schedState == WRKQE_NOT_SCHEDULED && !l_Entries[0].schedPrev, "due work queue still scheduled");
+
+    // Across several turns, sharing the slot with work queues due earlier
+    const uint64_t l_Long = 2*WRKQ_TIMER_WHEEL_SLOTS + 7;
+    l_Scheduler.park(&l_Entries[1], l_Long);
+    l_Scheduler.park(&l_Entries[2], 7);
+    l_Scheduler.park(&l_Entries[3], WRKQ_TIMER_WHEEL_SLOTS + 7);
+    CHECK(l_Entries[1].wheelSlot == l_Entries[2].wheelSlot && l_Entries[1].wheelSlot == l_Entries[3].wheelSlot, "work queues not in the same slot");
+    CHECK(l_Scheduler.getParkedCount() == 3, "%zu work queues parked", l_Scheduler.getParkedCount());
+    CHECK(intervalsUntilDue(l_Scheduler, &l_Entries[2], l_Long) == 7, "same turn work queue not due after 7");
+    CHECK(l_Scheduler.getParkedCount() == 2 && l_Entries[1].schedState == WRKQE_ON_TIMER_WHEEL, "later turns returned early");
+    CHECK(intervalsUntilDue(l_Scheduler, &l_Entries[3], l_Long) == WRKQ_TIMER_WHEEL_SLOTS, "next turn work queue not due one turn later");
+    CHECK(intervalsUntilDue(l_Scheduler, &l_Entries[1], l_Long) == WRKQ_TIMER_WHEEL_SLOTS, "third turn work queue not due two turns later");
+    CHECK(l_Scheduler.getParkedCount() == 0 && !l_Scheduler.getParked(l_Entries[1].wheelSlot), "timer wheel not empty");
+}
+
+static void testRateReset()
+{
+    Scheduler l_Scheduler;
+    Entry l_Entries[3];
+
+    // As setThrottleRate(), a rate reset moves the parked work queue to the ready ring
+    l_Scheduler.park(&l_Entries[0], 5);
+    l_Scheduler.park(&l_Entries[1], 5);
+    l_Scheduler.park(&l_Entries[2], 5);
+    l_Scheduler.unlink(&l_Entries[1]);
+    l_Scheduler.insertReady(&l_Entries[1]);
+    int l_Ring[] = {1};
+    CHECK(ringIs(l_Scheduler, l_Entries, l_Ring, 1), "reset work queue not on the ready ring");
+    CHECK(l_Scheduler.getParkedCount() == 2, "%zu work queues parked after the reset", l_Scheduler.getParkedCount());
+
+    // and only the others come due from the slot, which still links them
+    size_t l_Due = 0;
+    bool l_Reset = false;
+    for (uint64_t i=0; i<5; ++i)
+    {
+        for (Entry* l_Entry = l_Scheduler.advance(); l_Entry; l_Entry = l_Entry->schedNext)
+        {
+            ++l_Due;
+            l_Reset = l_Reset || (l_Entry == &l_Entries[1]);
+        }
+    }
+    CHECK(l_Due == 2 && !l_Reset, "%zu work queues due, reset one among them %d", l_Due, l_Reset);
+    CHECK(l_Entries[1].schedState == WRKQE_ON_READY_RING && ringIs(l_Scheduler, l_Entries, l_Ring, 1), "ready ring changed by the wheel");
+
+    // Resetting the head of a slot
+    l_Scheduler.unlink(&l_Entries[1]);
+    l_Scheduler.park(&l_Entries[0], WRKQ_TIMER_WHEEL_SLOTS + 1);
+    l_Scheduler.park(&l_Entries[2], 1);
+    l_Scheduler.unlink(&l_Entries[2]);
+    l_Scheduler.insertReady(&l_Entries[2]);
+    CHECK(l_Scheduler.getParked(l_Entries[0].wheelSlot) == &l_Entries[0] && !l_Entries[0].schedPrev, "slot head not replaced");
+    CHECK(intervalsUntilDue(l_Scheduler, &l_Entries[0], 2*WRKQ_TIMER_WHEEL_SLOTS) == WRKQ_TIMER_WHEEL_SLOTS + 1, "remaining work queue not due");
+}
+
+static void testReadyRing()
+{
+    Scheduler l_Scheduler;
+    Entry l_Entries[4];
+
+    for (int i=0; i<4; ++i)
+    {
+        l_Scheduler.insertReady(&l_Entries[i]);
+    }
+    int l_All[] = {0, 1, 2, 3};
+    CHECK(ringIs(l_Scheduler, l_Entries, l_All, 4), "ready ring not in insertion order");
+
+    // Round robin, a work queue inserted later goes just before the cursor
+    l_Scheduler.skip(l_Scheduler.getReadyCursor());
+    l_Scheduler.unlink(&l_Entries[3]);
+    l_Scheduler.insertReady(&l_Entries[3]);
+    int l_Skipped[] = {1, 2, 0, 3};
+    CHECK(ringIs(l_Scheduler, l_Entries, l_Skipped, 4), "inserted work queue not at the tail");
+
+    // An emptied work queue at the cursor, in the middle and last of all
+    l_Scheduler.unlink(&l_Entries[1]);
+    int l_Cursor[] = {2, 0, 3};
+    CHECK(ringIs(l_Scheduler, l_Entries, l_Cursor, 3), "removing the cursor work queue");
+    CHECK(l_Entries[1].schedState == WRKQE_NOT_SCHEDULED && !l_Entries[1].schedNext && !l_Entries[1].schedPrev, "removed work queue still linked");
+    l_Scheduler.unlink(&l_Entries[0]);
+    int l_Middle[] = {2, 3};
+    CHECK(ringIs(l_Scheduler, l_Entries, l_Middle, 2), "removing a work queue behind the cursor");
+    l_Scheduler.unlink(&l_Entries[3]);
+    l_Scheduler.unlink(&l_Entries[2]);
+    CHECK(ringIs(l_Scheduler, l_Entries, 0, 0), "ready ring not empty");
+
+    // Unlinking a work queue that is not scheduled changes nothing
+    l_Scheduler.unlink(&l_Entries[2]);
+    CHECK(ringIs(l_Scheduler, l_Entries, 0, 0) && !l_Scheduler.getParkedCount(), "unscheduled work queue unlinked");
+    l_Scheduler.insertReady(&l_Entries[2]);
+    int l_One[] = {2};
+    CHECK(ringIs(l_Scheduler, l_Entries, l_One, 1), "ready ring not reusable once empty");
+}
+
+int main(int argc, char** argv)
+{
+    testIntervals();
+    testPark();
+    testRateReset();
+    testReadyRing();
+
+    printf("wrkqscheduler_test: %d failure(s)\n", failures);
+
+    return failures ? 1 : 0;
+}
@@ -154,6 +154,9 @@ public:
   csm::network::Address_sptr GetConfiguredAggregatorAddress() const { return _Aggregator; }
 
   std::string GetHostname() const { return _Hostname; }
+
+  // checksum types this daemon offers in the version handshake (csm.net.checksum)
+  uint32_t GetNetworkChecksumCapabilities() const;
  
   /**
      \brief return the active bucket item list for a given windowId
@@ -184,6 +187,7 @@ public:
   RecurringTasks GetRecurringTasks() const { return _Cron; }
 
   DBDefinitionInfo GetDBDefinitionInfo() const { return _dbInfo; }
+  unsigned GetDBPipelineDepth() const { return _dbPipelineDepth; }
 
   csm::daemon::BDS_Info GetBDS_Info() const { return _BDS_Info; }
     
@@ -303,6 +307,7 @@ private:
 //  uint64_t _IntervalSrcTime; // number of seconds between 2 triggers of the interval timer source
 
   DBDefinitionInfo _dbInfo;
+  unsigned _dbPipelineDepth;
 
   csm::daemon::Tweaks _Tweaks;
   csm::daemon::BDS_Info _BDS_Info;
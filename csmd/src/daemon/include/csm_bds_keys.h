@@ -29,6 +29,8 @@
 #define CSM_BDS_TYPE_DIMM_ENV      "csm-dimm-env"
 #define CSM_BDS_TYPE_TEST_ENV      "csm-test-env"
 
+#define CSM_BDS_TYPE_DAEMON_METRICS "csm-daemon-metrics"
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // CSM_BDS_KEY_SOURCE - the source from which the reported data was collected 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
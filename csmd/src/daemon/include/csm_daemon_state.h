@@ -209,7 +209,7 @@ public:
                     const std::string &id,
                     const csm::network::Message *msg = nullptr );
 
-  csm::network::Address_sptr GetNextHopAddress( const std::string i_NodeName );
+  csm::network::Address_sptr GetNextHopAddress( const std::string &i_NodeName );
   virtual void InitActiveAddresses( ) {};
   virtual csm::network::Address_sptr GetActiveAddress() const { return nullptr; }
   virtual csm::network::Address_sptr GetSecondaryAddress() const { return nullptr; }
@@ -0,0 +1,192 @@
+/*================================================================================
+
+    csmd/src/daemon/include/csm_db_inflight.h
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+
+#ifndef CSMD_SRC_DAEMON_INCLUDE_CSM_DB_INFLIGHT_H_
+#define CSMD_SRC_DAEMON_INCLUDE_CSM_DB_INFLIGHT_H_
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <deque>
+
+#include "csmd/src/db/include/PostgreSql.h"
+
+namespace csm {
+namespace daemon {
+
+/*
+ * Requests in flight on one DB connection of the pipelined DB manager.
+ * libpq returns results in order of submission, so whatever completes
+ * always belongs to the oldest request.
+ */
+template<class Request>
+class DBInFlight
+{
+  std::deque<Request*> _Requests;  ///< requests in order of submission
+  PGresult *_Result;               ///< result collected for the oldest request
+
+public:
+  DBInFlight() : _Result( nullptr ) {}
+  ~DBInFlight() { DropResult(); }
+
+  inline bool Empty() const { return _Requests.empty(); }
+  inline size_t Size() const { return _Requests.size(); }
+
+  inline void Push( Request *aRequest ) { _Requests.push_back( aRequest ); }
+
+  /* same as PQexec: keep the last result unless an error was seen before */
+  void Collect( PGresult *aRes )
+  {
+    if(( _Result != nullptr ) && ( ! PQ_RES_SUCCESS( _Result ) ))
+      PQ_RES_FREE( aRes );
+    else
+    {
+      if( _Result != nullptr )
+        PQ_RES_FREE( _Result );
+      _Result = aRes;
+    }
+  }
+
+  /* removes the oldest request and hands out its result,
+   * which is nullptr if the connection returned none */
+  Request* Complete( PGresult **aRes )
+  {
+    Request *request = _Requests.front();
+    _Requests.pop_front();
+    *aRes = _Result;
+    _Result = nullptr;
+    return request;
+  }
+
+  /* hands back every request newest first, so restoring each one to the
+   * front of the request queue keeps the original order; returns the count */
+  template<class Restore>
+  unsigned Fail( Restore aRestore )
+  {
+    unsigned count = 0;
+    DropResult();
+    while( ! _Requests.empty() )
+    {
+      aRestore( _Requests.back() );
+      _Requests.pop_back();
+      ++count;
+    }
+    return count;
+  }
+
+private:
+  inline void DropResult()
+  {
+    if( _Result != nullptr )
+      PQ_RES_FREE( _Result );
+    _Result = nullptr;
+  }
+};
+
+/*
+ * Holds back requests after DB connection failures, so a broken connection
+ * isn't retried in a tight loop. The delay doubles with each failure in a row
+ * up to the max and a completed request ends the streak.
+ */
+class DBFailBackOff
+{
+  unsigned _MinMs;
+  unsigned _MaxMs;
+  unsigned _Streak;                                 ///< failures since the last completed request
+  std::chrono::steady_clock::time_point _RetryAt;   ///< no dispatching before this time
+
+public:
+  DBFailBackOff( const unsigned aMinMs, const unsigned aMaxMs )
+  : _MinMs( aMinMs ), _MaxMs( aMaxMs ), _Streak( 0 ), _RetryAt( std::chrono::steady_clock::now() )
+  {}
+
+  inline unsigned GetStreak() const { return _Streak; }
+  inline std::chrono::steady_clock::time_point GetRetryAt() const { return _RetryAt; }
+
+  /* false while backing off */
+  inline bool CanDispatch( const std::chrono::steady_clock::time_point aNow = std::chrono::steady_clock::now() ) const
+  {
+    return ( _Streak == 0 ) || ( aNow >= _RetryAt );
+  }
+
+  /* returns the delay in ms until requests are dispatched again */
+  unsigned Failed( const std::chrono::steady_clock::time_point aNow = std::chrono::steady_clock::now() )
+  {
+    unsigned delay = _MaxMs;
+    if( _Streak < 16 )
+      delay = std::min( _MinMs << _Streak, _MaxMs );
+    ++_Streak;
+    _RetryAt = aNow + std::chrono::milliseconds( delay );
+    return delay;
+  }
+
+  inline void Succeeded() { _Streak = 0; }
+};
+
+/*
+ * Wakes up the pipelined DB manager when requests are queued.
+ * The eventfd sits in the same epoll set as the DB connections,
+ * so the manager can block until either one has something to do.
+ */
+class DBRequestWakeup
+{
+  int _FD;
+
+public:
+  DBRequestWakeup() : _FD( eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC ) ) {}
+  ~DBRequestWakeup() { if( _FD >= 0 ) close( _FD ); }
+
+  inline int GetFD() const { return _FD; }
+
+  /* the counter only saturates if nobody drains it, nothing is lost then either */
+  inline void Signal()
+  {
+    uint64_t one = 1;
+    if( _FD >= 0 )
+    {
+      ssize_t rc = write( _FD, &one, sizeof( one ) );
+      (void)rc;
+    }
+  }
+
+  /* returns true if there was a signal since the last call */
+  inline bool Drain()
+  {
+    uint64_t count = 0;
+    return ( _FD >= 0 ) && ( read( _FD, &count, sizeof( count ) ) == sizeof( count ) ) && ( count > 0 );
+  }
+};
+
+/* epoll timeout in ms until the deadline, rounded up so the deadline has passed on return */
+inline int DBPollTimeout( const std::chrono::steady_clock::time_point aDeadline,
+                          const std::chrono::steady_clock::time_point aNow = std::chrono::steady_clock::now() )
+{
+  if( aDeadline <= aNow )
+    return 0;
+  std::chrono::steady_clock::duration left = aDeadline - aNow;
+  std::chrono::milliseconds ms = std::chrono::duration_cast<std::chrono::milliseconds>( left );
+  if( ms < left )
+    ms += std::chrono::milliseconds( 1 );
+  return (int)std::min<int64_t>( ms.count(), INT_MAX );
+}
+
+}  // namespace daemon
+}  // namespace csm
+
+#endif /* CSMD_SRC_DAEMON_INCLUDE_CSM_DB_INFLIGHT_H_ */
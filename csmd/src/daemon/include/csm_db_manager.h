@@ -64,7 +64,20 @@ public:
         if (sink) sink->RestoreRequestEvent( dbe );
   }
   
+  // the pipelined db manager blocks in epoll_wait on this together with its connections
+  inline int GetRequestWakeupFD()
+  {
+    csm::daemon::EventSinkDB* sink = dynamic_cast<csm::daemon::EventSinkDB*>( _Sink );
+    return ( sink ) ? sink->GetPipelineWakeupFD() : -1;
+  }
+  inline void DrainRequestWakeup()
+  {
+    csm::daemon::EventSinkDB* sink = dynamic_cast<csm::daemon::EventSinkDB*>( _Sink );
+    if (sink) sink->DrainPipelineWakeup();
+  }
+
   inline csm::db::DBConnectionPool* GetDBConnectionPool() { return _DBConnectionPool; }
+  inline unsigned GetPipelineDepth() const { return _PipelineDepth; }
   inline csm::daemon::ConnectionHandling *GetConnectionManager() { return _ConnMgr; }
   
   inline const boost::thread* GetThread() { return _Thread[0]; }
@@ -91,10 +104,16 @@ private:
   csm::daemon::ConnectionHandling *_ConnMgr;
 
   volatile std::atomic<bool> _KeepThreadRunning;
+  unsigned _PipelineDepth;   ///< 0: one blocking thread per connection; >0: single pipelined thread
+  unsigned _NumThreads;
   boost::thread ** _Thread;
   RetryBackOff _IdleRetry;
 };
 
 } // namespace daemon
 } // namespace csm
+
+// thread main of the pipelined db manager (csm_db_pipeline.cc)
+void DBManagerPipelineMain( csm::daemon::EventManagerDB *aMgr );
+
 #endif
@@ -0,0 +1,146 @@
+/*================================================================================
+
+    csmd/src/daemon/include/csm_metrics.h
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+#ifndef CSMD_SRC_DAEMON_INCLUDE_CSM_METRICS_H_
+#define CSMD_SRC_DAEMON_INCLUDE_CSM_METRICS_H_
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "csmi/src/common/include/csmi_cmds.h"
+
+namespace csm {
+namespace daemon {
+
+// what a recorded latency was spent on
+typedef enum
+{
+  METRICS_HANDLER = 0,     // processing a handler state
+  METRICS_NETWORK_WAIT,    // waiting for a point-to-point response
+  METRICS_DB_WAIT,         // waiting for a DB response
+  METRICS_MCAST_WAIT,      // waiting for multicast responses
+  METRICS_TOTAL,           // from the request to the end of the last state
+  METRICS_CATEGORY_MAX
+} MetricsCategory;
+
+const char* MetricsCategoryToString( const MetricsCategory i_Category );
+
+// every power of two is split into 2^CSM_METRICS_SUB_BITS buckets (< 12.5% relative error)
+#define CSM_METRICS_SUB_BITS ( 3 )
+#define CSM_METRICS_BUCKETS ( ( 64 - CSM_METRICS_SUB_BITS + 1 ) << CSM_METRICS_SUB_BITS )
+
+/*
+ * log-linear (HDR style) histogram of latencies in microseconds
+ * each histogram has exactly one writing thread, so recording needs no atomic read-modify-write,
+ * the atomics only make the counters safe to read from other threads
+ */
+class LatencyHistogram
+{
+  std::atomic<uint64_t> _Buckets[ CSM_METRICS_BUCKETS ];
+  std::atomic<uint64_t> _Count;
+  std::atomic<uint64_t> _Sum;
+
+public:
+  LatencyHistogram();
+
+  inline void Record( const uint64_t i_Micros )
+  {
+    std::atomic<uint64_t> &bucket = _Buckets[ BucketIndex( i_Micros ) ];
+    bucket.store( bucket.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+    _Sum.store( _Sum.load( std::memory_order_relaxed ) + i_Micros, std::memory_order_relaxed );
+    _Count.store( _Count.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+  }
+
+  static unsigned BucketIndex( const uint64_t i_Micros );
+  static uint64_t BucketUpperBound( const unsigned i_Index );
+
+  friend class LatencySnapshot;
+};
+
+/*
+ * merged, non-atomic copy of one or more histograms
+ */
+class LatencySnapshot
+{
+  std::vector<uint64_t> _Buckets;
+  uint64_t _Count;
+  uint64_t _Sum;
+
+public:
+  LatencySnapshot();
+
+  void Add( const LatencyHistogram &i_Histogram );
+  void Subtract( const LatencySnapshot &i_Older );
+
+  inline uint64_t GetCount() const { return _Count; }
+  inline uint64_t GetSum() const { return _Sum; }
+  inline uint64_t GetMean() const { return _Count ? _Sum / _Count : 0; }
+
+  // upper bound of the bucket holding the i_Fraction quantile (e.g. 0.99), 0 if empty
+  uint64_t GetPercentile( const double i_Fraction ) const;
+  uint64_t GetMax() const;
+};
+
+/*
+ * daemon wide registry of latency histograms keyed by csmi command and category
+ * and of gauges sampled on demand (e.g. queue depths)
+ *
+ * every recording thread gets its own shard of histograms, so recording never takes a lock
+ * readers merge the shards of all threads
+ */
+class Metrics
+{
+  struct Shard
+  {
+    std::atomic<LatencyHistogram*> _Histograms[ CSM_CMD_MAX ][ METRICS_CATEGORY_MAX ];
+    Shard();
+  };
+
+  mutable std::mutex _ShardLock;
+  std::vector<Shard*> _Shards;
+
+  mutable std::mutex _GaugeLock;
+  std::map<std::string, std::function<int64_t()> > _Gauges;
+
+  std::mutex _ExportLock;
+  std::vector<LatencySnapshot> _LastExport;
+
+  Metrics();
+  Shard* GetShard();
+  void Snapshot( std::vector<LatencySnapshot> &o_Snapshot ) const;
+  void SampleGauges( std::map<std::string, int64_t> &o_Gauges ) const;
+
+public:
+  static Metrics& Instance();
+
+  void Record( const uint8_t i_Cmd, const MetricsCategory i_Category, const uint64_t i_Micros );
+
+  void RegisterGauge( const std::string &i_Name, std::function<int64_t()> i_Sample );
+  void UnregisterGauge( const std::string &i_Name );
+
+  // percentiles since daemon start as a text table (for csm_ctrl_cmd)
+  std::string Dump() const;
+
+  // percentiles since the previous export as json documents in BDS format, one per line
+  std::string GetJsonString( const std::string &i_Source, const std::string &i_TimeStamp );
+};
+
+}  // namespace daemon
+} // namespace csm
+
+#endif /* CSMD_SRC_DAEMON_INCLUDE_CSM_METRICS_H_ */
@@ -31,20 +31,31 @@ typedef struct
   bool _Enabled;
 } SoftFailRecovery_t;
 
+typedef struct
+{
+  unsigned _Interval;
+  bool _Enabled;
+} MetricsExport_t;
+
 class RecurringTasks
 {
   bool _Enabled;   ///< indicate whether this feature was enabled through config
   unsigned _LCDInterval;  ///< keep track of the LCD of configured intervals (in seconds)
   SoftFailRecovery_t _SFRecovery;  ///< coordinates for the soft-fail recovery task
+  MetricsExport_t _MetricsExport;  ///< coordinates for the metrics export task
 
 public:
   RecurringTasks( )
   : _Enabled( false ),
     _LCDInterval( 1 ),
-    _SFRecovery()
+    _SFRecovery(),
+    _MetricsExport()
   {
       _SFRecovery._Interval = 0;
       _SFRecovery._Retry = 0;
+      _SFRecovery._Enabled = false;
+      _MetricsExport._Interval = 0;
+      _MetricsExport._Enabled = false;
   }
   ~RecurringTasks() {}
 
@@ -60,10 +71,22 @@ public:
     _SFRecovery._Enabled = i_Enabled;
   }
 
+  inline MetricsExport_t GetMetricsExport() const { return _MetricsExport; }
+  inline void SetMetricsExport( const unsigned i_Interval, const bool i_Enabled )
+  {
+    _MetricsExport._Interval = i_Interval;
+    _MetricsExport._Enabled = i_Enabled;
+  }
+
   inline void UpdateLCM()
   {
-    // since we have only one interval yet, this is just a trivial placeholder for LCD
-    _LCDInterval = boost::math::lcm( _SFRecovery._Interval, _SFRecovery._Interval );
+    // the interval has to divide the intervals of all enabled tasks
+    unsigned interval = 0;
+    if( _SFRecovery._Enabled )
+      interval = _SFRecovery._Interval;
+    if( _MetricsExport._Enabled )
+      interval = interval ? boost::math::gcd( interval, _MetricsExport._Interval ) : _MetricsExport._Interval;
+    _LCDInterval = interval ? interval : 1;
   }
 
   inline unsigned GetMinInterval() const { return _LCDInterval; }
@@ -75,6 +98,8 @@ static stream&
 operator<<( stream &out, const csm::daemon::RecurringTasks &data )
 {
   out << " LCD-Interval=" << data.GetMinInterval() << "s; SoftFailRecovery=( " << data.GetSoftFailRecovery()._Interval << "s : " << data.GetSoftFailRecovery()._Retry << " )";
+  if( data.GetMetricsExport()._Enabled )
+    out << "; MetricsExport=( " << data.GetMetricsExport()._Interval << "s )";
   return (out);
 }
 
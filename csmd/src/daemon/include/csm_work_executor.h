@@ -0,0 +1,174 @@
+/*================================================================================
+
+    csmd/src/daemon/include/csm_work_executor.h
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+#ifndef CSMD_SRC_DAEMON_INCLUDE_CSM_WORK_EXECUTOR_H_
+#define CSMD_SRC_DAEMON_INCLUDE_CSM_WORK_EXECUTOR_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace csm {
+namespace daemon {
+
+typedef std::function<void()> ExecutorTask;
+
+// keeps the hot counters of producers and consumers on separate cache lines
+#define CSM_EXECUTOR_CACHELINE ( 128 )
+
+/*
+ * bounded lock-free multi-producer/multi-consumer ring of tasks
+ * one of these exists per worker: the owner pops from it, the main loop pushes into it
+ * and idle workers steal from it
+ */
+class ExecutorQueue
+{
+  struct Cell
+  {
+    std::atomic<size_t> _Seq;
+    ExecutorTask *_Task;
+  };
+
+  std::unique_ptr<Cell[]> _Cells;
+  size_t _Mask;
+  std::atomic<size_t> _PushPos;
+  char _Pad[ CSM_EXECUTOR_CACHELINE ];
+  std::atomic<size_t> _PopPos;
+
+public:
+  // capacity is rounded up to the next power of 2
+  explicit ExecutorQueue( const size_t i_Capacity );
+  ~ExecutorQueue();
+
+  // returns false if the queue is full
+  bool Push( ExecutorTask *i_Task );
+  // returns nullptr if the queue is empty
+  ExecutorTask* Pop();
+  size_t SizeApprox() const;
+};
+
+/*
+ * serializes the tasks posted to it: at most one of them runs at any time
+ * the pending counter decides which poster has to schedule the strand into the executor
+ */
+class ExecutorStrand
+{
+  struct Node
+  {
+    std::atomic<Node*> _Next;
+    ExecutorTask _Task;
+  };
+
+  std::atomic<Node*> _Head;
+  char _Pad[ CSM_EXECUTOR_CACHELINE ];
+  Node *_Tail;
+  Node _Stub;
+  std::atomic<int64_t> _Pending;
+
+  void PushNode( Node *i_Node );
+  Node* PopNode();
+
+public:
+  ExecutorStrand();
+  ~ExecutorStrand();
+
+  // returns true if the strand was idle and the caller has to schedule Run()
+  bool Push( ExecutorTask &&i_Task );
+
+  // runs up to i_Max tasks; o_Idle is set once no task is left, also if a task leaves Run() with an exception
+  // if the strand is not idle on return, Run() needs to be scheduled again
+  void Run( const unsigned i_Max, bool &o_Idle );
+
+  bool IsIdle() const { return ( _Pending.load() == 0 ); }
+};
+
+/*
+ * maps an owner (e.g. an event handler) to its own strand
+ * a strand only exists while its owner has tasks pending: it is created by the first push
+ * and dropped by the runner that leaves it idle, so an owner never waits behind another one
+ */
+class ExecutorStrandRegistry
+{
+  std::mutex _Lock;
+  std::unordered_map<const void*, ExecutorStrand*> _Strands;
+
+public:
+  ExecutorStrandRegistry();
+  ~ExecutorStrandRegistry();
+
+  // returns the strand if it was idle and the caller has to schedule its Run(), nullptr otherwise
+  ExecutorStrand* Push( const void *i_Owner, ExecutorTask &&i_Task );
+  // drops the strand of the owner if it is still i_Strand and no task was pushed since it went idle
+  void Release( const void *i_Owner, ExecutorStrand *i_Strand );
+  size_t Size();
+};
+
+/*
+ * fixed number of worker slots, each with its own task queue
+ * workers drain their own queue first and steal from the other queues when it runs empty
+ */
+class WorkStealingExecutor
+{
+  std::vector< std::unique_ptr<ExecutorQueue> > _Queues;
+  ExecutorStrandRegistry _Strands;
+
+  // spill-over if all queues are full
+  std::deque<ExecutorTask*> _Overflow;
+  std::mutex _OverflowLock;
+  std::atomic<int64_t> _OverflowCount;
+
+  std::atomic<int64_t> _Queued;
+  char _Pad[ CSM_EXECUTOR_CACHELINE ];
+  std::atomic<size_t> _NextSlot;
+  std::atomic<int> _Sleepers;
+  std::atomic<bool> _Stop;
+  std::mutex _SleepLock;
+  std::condition_variable _SleepCond;
+
+  std::atomic<uint64_t> _Steals;
+
+  void Schedule( ExecutorTask *i_Task );
+  void ScheduleStrand( ExecutorStrand *i_Strand, const void *i_Owner );
+  ExecutorTask* Next( const unsigned i_Slot );
+  void Sleep();
+
+public:
+  WorkStealingExecutor( const unsigned i_Workers, const size_t i_QueueCapacity = 4096 );
+  ~WorkStealingExecutor();
+
+  void Submit( ExecutorTask &&i_Task );
+  // tasks with the same owner run one at a time in submission order
+  void Submit( ExecutorTask &&i_Task, const void *i_Owner );
+
+  // thread body of the worker for queue i_Slot; returns after Shutdown() once all queued work is done
+  // exceptions of a task are not caught, they end the thread as they ended io_service::run() before;
+  // a thread started again for the same slot picks up where the old one left off
+  void WorkerLoop( const unsigned i_Slot );
+  void Shutdown();
+
+  unsigned GetWorkerCount() const { return _Queues.size(); }
+  int64_t GetQueuedCount() const { return _Queued.load(); }
+  uint64_t GetStealCount() const { return _Steals.load( std::memory_order_relaxed ); }
+  size_t GetStrandCount() { return _Strands.Size(); }
+};
+
+} // namespace daemon
+} // namespace csm
+
+#endif
@@ -16,6 +16,8 @@
 #define CSMD_SRC_DAEMON_INCLUDE_THREAD_POOL_H_
 #include "logging.h"
 #include "csm_daemon_exception.h"
+#include "include/csm_work_executor.h"
+#include "include/csm_metrics.h"
 
 #include <atomic>
 #include <mutex>
@@ -28,21 +30,17 @@ namespace csm {
 namespace daemon {
 
 struct ThreadPool {
-  typedef std::unique_ptr<boost::asio::io_service::work> asio_worker;
-  typedef std::shared_ptr<boost::asio::io_service::strand> strand_sptr;
-  
 private:
-  boost::asio::io_service _service;
-  asio_worker _service_worker;
+  WorkStealingExecutor _executor;
   boost::thread_group _thread_grp;
   int _thread_grp_size;
+  // executor queue of each worker thread; a recreated thread takes over the queue of the crashed one
+  std::map<boost::thread::id, unsigned> _TidToSlot;
   
   static std::vector<boost::thread::id> CrashedThreadList;
   static std::map<boost::thread::id, boost::thread* > TidToThreadMap;
   
   static std::map<boost::thread::id, std::string> TidToHandlerMap;
-  
-  static std::map<CSMI_BASE *, strand_sptr> HandlerToStrand;
 
   static std::mutex LockForCrashedThreadList;
   static std::mutex LockForTidToHandlerMap;
@@ -52,20 +50,21 @@ private:
   static boost::thread::id _main_loop_thread_id;
 
 public:
-  ThreadPool(int threads) :_service(), _service_worker(new asio_worker::element_type(_service)) {
+  ThreadPool(int threads) : _executor( threads ) {
     for (int i = 0; i < threads; ++i) {
-      addThread();
+      addThread( i );
     }
     _thread_grp_size = threads;
     CrashedThreadCount = 0;
+    Metrics::Instance().RegisterGauge( "threadpool.queued_tasks", [ this ]() { return _executor.GetQueuedCount(); } );
   }
 
   ~ThreadPool() {
-    _service_worker.reset();
+    Metrics::Instance().UnregisterGauge( "threadpool.queued_tasks" );
+    _executor.Shutdown();
     try { _thread_grp.join_all(); }
     catch ( csm::daemon::Exception &e ) { LOG( csmd, error ) << "ThreadPool failure when joining all threads." << e.what(); }
-    LOG(csmd, debug) << "~ThreadPool(): done with join_all...";
-    _service.stop();
+    LOG(csmd, debug) << "~ThreadPool(): done with join_all... steals=" << _executor.GetStealCount();
   }
 
   /* 
@@ -79,22 +78,13 @@ public:
   {
     if (handler == nullptr)
     {
-      _service.post( f );
+      _executor.Submit( ExecutorTask( f ) );
     }
     else
     {
-      //added the boost strand support for the handlers which may not be multi-thread safe
+      //strand support for the handlers which may not be multi-thread safe
       //solution: the tasks belonging to the same strand can only be executed sequentially
-      auto it = HandlerToStrand.find(handler);
-      strand_sptr strand;
-      if (it == HandlerToStrand.end())
-      {
-        strand = std::make_shared<boost::asio::io_service::strand>(_service);
-        HandlerToStrand[handler] = strand;
-      }
-      else strand = it->second;
-
-      _service.post( strand->wrap(f) );
+      _executor.Submit( ExecutorTask( f ), handler );
     }
   }
 
@@ -134,16 +124,17 @@ public:
   static void segfault_sigaction_handler(int sig, siginfo_t *si, void *arg);
   
 private:
-  inline void addThread()
+  inline void addThread( const unsigned slot )
   {
-    auto worker = [this] { return _service.run(); };
+    auto worker = [this, slot] { _executor.WorkerLoop( slot ); };
       
     boost::thread* thd = new boost::thread(worker);
       
     _thread_grp.add_thread( thd );
     TidToThreadMap[thd->get_id()] = thd;
+    _TidToSlot[thd->get_id()] = slot;
       
-    LOG(csmd, debug) << "ThreadPool(): new thread = " << thd->get_id();
+    LOG(csmd, debug) << "ThreadPool(): new thread = " << thd->get_id() << " slot = " << slot;
   }
   
 };
@@ -69,6 +69,7 @@ csm::daemon::ConnectionHandling::Initialize( const ConnectionDefinition *i_Prim,
     throw csm::daemon::Exception("Trying to initalize ConnectionHandling without initialized DaemonState." );
 
   csm::network::VersionMsg::Init( csm::daemon::Configuration::Instance()->GetHostname() );
+  csm::network::VersionMsg::Get()->SetChecksumCapabilities( csm::daemon::Configuration::Instance()->GetNetworkChecksumCapabilities() );
 }
 
 
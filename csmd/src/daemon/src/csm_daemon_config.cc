@@ -79,6 +79,7 @@ Configuration::Configuration( int argc, char **argv, const RunMode *runmode )
   _ThreadPool(nullptr),
   _CSMIAuthList(nullptr),
   _CSMAPIConfigs(nullptr),
+  _dbPipelineDepth(0),
   _Tweaks()
 {
   _CfgFile = "/etc/ibm/csm/csm_master.cfg";
@@ -612,6 +613,15 @@ void Configuration::SetDBConnectionPool()
   // create connection
   csm::db::DBConnInfo dbInfo( values[1], values[2], values[3], values[4] );
 
+  // optional: number of prepared statements cached per connection (0 = disabled)
+  std::string cache_size = GetValueInConfig("csm.db.statement_cache_size");
+  if (!cache_size.empty())
+  {
+    int size = std::stoi(cache_size);
+    dbInfo.statementCacheSize = (size > 0)? (unsigned)size : 0;
+  }
+  CSMLOG(csmd, debug ) << "csm.db.statement_cache_size = " << dbInfo.statementCacheSize;
+
   unsigned pool_size = DEFAULT_CONNECTION_POOL_SIZE;
   if (!values[0].empty())
     pool_size = std::stoi(values[0]);
@@ -621,6 +631,15 @@ void Configuration::SetDBConnectionPool()
   }
 
   _dbInfo = DBDefinitionInfo(pool_size, dbInfo);
+
+  // optional: number of requests that can be in flight per connection (0 = blocking db threads)
+  std::string pipeline_depth = GetValueInConfig("csm.db.pipeline_depth");
+  if (!pipeline_depth.empty())
+  {
+    int depth = std::stoi(pipeline_depth);
+    _dbPipelineDepth = (depth > 0)? (unsigned)depth : 0;
+  }
+  CSMLOG(csmd, debug ) << "csm.db.pipeline_depth = " << _dbPipelineDepth;
 }
 
 void Configuration::SetDaemonState( const uint64_t aDaemonId )
@@ -718,6 +737,20 @@ void Configuration::CreateThreadPool()
     return interval;
   }
 
+  uint32_t Configuration::GetNetworkChecksumCapabilities() const
+  {
+    uint32_t caps = CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_XOR );
+    std::string value = GetValueInConfig( std::string( "csm.net.checksum" ) );
+    if(( value.empty() ) || ( value.compare( "xor" ) == 0 ))
+      return caps;
+
+    if( value.compare( "crc32c" ) == 0 )
+      caps |= CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_CRC32C );
+    else
+      CSMLOG( csmd, warning ) << "csm.net.checksum=" << value << " is unknown. Using default: xor";
+    return caps;
+  }
+
   // this will always create a server-side socket since the clients are not daemons
   void Configuration::AddConnectionDefinitionLocal( const int i_Prio )
   {
@@ -1253,28 +1286,49 @@ void Configuration::CreateThreadPool()
       ckey_str = GetValueInConfig( "csm.recurring_tasks.soft_fail_recovery.enabled" );
       boost::algorithm::to_lower( ckey_str );
       bool sfenabled = (( ! ckey_str.empty() ) && ( ckey_str.compare( "true") == 0 ));
-      if( ! sfenabled )
+      if( sfenabled )
       {
-        _Cron.Disable();
-        CSMLOG( csmd, info ) << "Recurring task: Soft-failure recovery is disabled. Disabling recurring tasks entirely.";
-        return;
+        ckey_str = GetValueInConfig( "csm.recurring_tasks.soft_fail_recovery.interval" );
+        boost::posix_time::time_duration interval_time = boost::posix_time::duration_from_string(ckey_str);
+        unsigned interval = interval_time.total_seconds();
+
+        ckey_str = GetValueInConfig( "csm.recurring_tasks.soft_fail_recovery.retry" );
+        unsigned retry = strtol( ckey_str.c_str(), nullptr, 10 );
+
+        if(( interval == 0 ) || ( retry == 0 ))
+        {
+          _Cron.Disable();
+          throw csm::daemon::Exception("Recurring Tasks configuration error. Interval/Retry invalid." );
+        }
+
+        _Cron.SetSoftFailRecovery( interval, retry, sfenabled );
       }
 
-      ckey_str = GetValueInConfig( "csm.recurring_tasks.soft_fail_recovery.interval" );
-      boost::posix_time::time_duration interval_time = boost::posix_time::duration_from_string(ckey_str);
-      unsigned interval = interval_time.total_seconds();
+      ckey_str = GetValueInConfig( "csm.recurring_tasks.metrics.enabled" );
+      boost::algorithm::to_lower( ckey_str );
+      bool metricsenabled = (( ! ckey_str.empty() ) && ( ckey_str.compare( "true") == 0 ));
+      if( metricsenabled )
+      {
+        ckey_str = GetValueInConfig( "csm.recurring_tasks.metrics.interval" );
+        boost::posix_time::time_duration interval_time = boost::posix_time::duration_from_string(ckey_str);
+        unsigned interval = interval_time.total_seconds();
 
-      ckey_str = GetValueInConfig( "csm.recurring_tasks.soft_fail_recovery.retry" );
-      unsigned retry = strtol( ckey_str.c_str(), nullptr, 10 );
+        if( interval == 0 )
+        {
+          _Cron.Disable();
+          throw csm::daemon::Exception("Recurring Tasks configuration error. Metrics interval invalid." );
+        }
+
+        _Cron.SetMetricsExport( interval, metricsenabled );
+      }
 
-      if(( interval == 0 ) || ( retry == 0 ))
+      if(( ! sfenabled ) && ( ! metricsenabled ))
       {
         _Cron.Disable();
-        throw csm::daemon::Exception("Recurring Tasks configuration error. Interval/Retry invalid." );
+        CSMLOG( csmd, info ) << "Recurring task: Soft-failure recovery and metrics export are disabled. Disabling recurring tasks entirely.";
+        return;
       }
 
-      _Cron.SetSoftFailRecovery( interval, retry, sfenabled );
-
       _Cron.UpdateLCM();
     }
 
@@ -859,18 +859,15 @@ int csm::daemon::EventManagerNetwork::CreateDestinationAddresses( csm::network::
   }
 
   CSMLOG( csmd, debug ) << "Assembling destinations for multicast msg";
-  std::vector<std::string> nodeList;
-  uint32_t nodeStrLen;
-  csm::network::ExtractMulticastNodelist( i_MsgAddr->_Msg, nodeList, &nodeStrLen );
-
-  for( auto node : nodeList )
+  int nodeCount = csm::network::ForEachMulticastNode( i_MsgAddr->_Msg,
+                                                      [this, &destAddrList]( const std::string &node )
   {
     csm::network::Address_sptr dest = _DaemonState->GetNextHopAddress( node );
     if( dest != nullptr )
       destAddrList.push_back( dest );
-  }
+  } );
 
-  return nodeList.size();
+  return ( nodeCount > 0 ) ? nodeCount : 0;
 }
 
 int csm::daemon::EventManagerNetwork::ExtractDestinationAddresses( csm::network::MessageAndAddress_sptr i_MsgAddr,
@@ -352,7 +352,7 @@ csm::daemon::DaemonState::GetAllEPs(csm::daemon::AddressListType &list,
   return list.size();
 }
 
-csm::network::Address_sptr csm::daemon::DaemonState::GetNextHopAddress( const std::string i_NodeName )
+csm::network::Address_sptr csm::daemon::DaemonState::GetNextHopAddress( const std::string &i_NodeName )
 {
   // check if it's a directly connected node
   // todo: this is O(n) complexity and should be improved....
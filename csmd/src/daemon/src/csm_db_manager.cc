@@ -20,6 +20,7 @@
 
 #include "csm_daemon_config.h"
 #include "include/csm_db_manager.h"
+#include "include/csm_metrics.h"
 
 enum DBManagerState {
   IDLE,
@@ -129,7 +130,8 @@ void DBManagerMain( csm::daemon::EventManagerDB *aMgr )
 
         csm::db::DBReqContent dbcontent = dbevent->GetContent();
 
-        if ( dbcontent.GetNumParams() == 0 )
+        // binary results are only available through the extended query protocol
+        if (( dbcontent.GetNumParams() == 0 ) && ( dbcontent.GetResultFormat() == 0 ))
           dbres = dbConn->ExecSql(dbcontent.GetSqlStmt().c_str());
         else
           dbres = dbConn->ExecParamSql(
@@ -137,7 +139,8 @@ void DBManagerMain( csm::daemon::EventManagerDB *aMgr )
               dbcontent.GetNumParams(),
               dbcontent.GetParamValues(),
               dbcontent.GetParamSizes(),
-              dbcontent.GetParamFormats()
+              dbcontent.GetParamFormats(),
+              dbcontent.GetResultFormat()
           );
 
         CSMLOG(csmdb,debug) << "Completed DB Request: ctx=" << dbevent->GetEventContext()->GetAuxiliaryId() << " conn=" << dbConn->GetId();
@@ -225,12 +228,18 @@ void DBManagerMain( csm::daemon::EventManagerDB *aMgr )
 
 csm::daemon::EventManagerDB::~EventManagerDB()
 {
+  csm::daemon::Metrics::Instance().UnregisterGauge( "dbmgr.pending_requests" );
   _KeepThreadRunning = false;
 
+  // the pipelined db manager might be blocked in epoll_wait
+  csm::daemon::EventSinkDB* sink = dynamic_cast<csm::daemon::EventSinkDB*>( _Sink );
+  if( sink )
+    sink->WakeUpPipeline();
+
   if(( _DBConnectionPool != nullptr ) && ( _Thread != nullptr ))
   {
-    CSMLOG( csmd, info ) << "Exiting. Terminating: " << _DBConnectionPool->GetNumConfigConnections() << " db threads";
-    for( unsigned tid = 0; tid < _DBConnectionPool->GetNumConfigConnections(); ++tid )
+    CSMLOG( csmd, info ) << "Exiting. Terminating: " << _NumThreads << " db threads";
+    for( unsigned tid = 0; tid < _NumThreads; ++tid )
     {
       try { _IdleRetry.JoinThread( _Thread[ tid ], tid ); }
       catch ( ... ) { CSMLOG( csmd, error ) << "Error while DB worker thread joining."; }
@@ -249,6 +258,8 @@ csm::daemon::EventManagerDB::EventManagerDB( csm::daemon::DBDefinitionInfo info,
                                              csm::daemon::RetryBackOff *i_MainIdleLoopRetry )
 :_DBConnectionPool(csm::db::DBConnectionPool::Init(info.first, info.second)),
  _ConnMgr(aConnMgr),
+ _PipelineDepth(csm::daemon::Configuration::Instance()->GetDBPipelineDepth()),
+ _NumThreads(0),
  _Thread(nullptr),
  _IdleRetry( "DBMgr", csm::daemon::RetryBackOff::SleepType::CONDITIONAL, csm::daemon::RetryBackOff::SleepType::CONDITIONAL, 1, 1000000, 1000 )
 {
@@ -263,7 +274,7 @@ csm::daemon::EventManagerDB::EventManagerDB( csm::daemon::DBDefinitionInfo info,
 
   if (_DBConnectionPool)
   {
-    _Sink = new csm::daemon::EventSinkDB( &_IdleRetry, _DBConnectionPool->GetNumConfigConnections() );
+    _Sink = new csm::daemon::EventSinkDB( &_IdleRetry, _DBConnectionPool->GetNumConfigConnections(), ( _PipelineDepth > 0 ) );
 
     std::string dbVersion = _DBConnectionPool->GetDBSchemaVersion();
     std::string codeVersion = std::string( DB_SCHEMA_VERSION );
@@ -294,20 +305,33 @@ csm::daemon::EventManagerDB::EventManagerDB( csm::daemon::DBDefinitionInfo info,
     }
 
 
-    _Thread = new boost::thread*[ _DBConnectionPool->GetNumConfigConnections() ];
-    for( unsigned tid = 0; tid < _DBConnectionPool->GetNumConfigConnections(); ++tid )
+    // pipelined mode multiplexes all connections in a single thread
+    _NumThreads = ( _PipelineDepth > 0 ) ? 1 : _DBConnectionPool->GetNumConfigConnections();
+    if( _PipelineDepth > 0 )
+      CSMLOG(csmd, info) << "DB requests are pipelined with up to " << _PipelineDepth << " requests per connection";
+
+    _Thread = new boost::thread*[ _NumThreads ];
+    for( unsigned tid = 0; tid < _NumThreads; ++tid )
     {
-      _Thread[ tid ] = new boost::thread( DBManagerMain, this );
+      if( _PipelineDepth > 0 )
+        _Thread[ tid ] = new boost::thread( DBManagerPipelineMain, this );
+      else
+        _Thread[ tid ] = new boost::thread( DBManagerMain, this );
       CSMLOG( csmd, debug ) << "Creating DBThread: " << tid << " ptr=" << (void*)_Thread[ tid ];
     }
     csm::daemon::Configuration::Instance()->SetDBConnectionPool(_DBConnectionPool);
   }
+
+  csm::daemon::EventSinkDB* sink = dynamic_cast<csm::daemon::EventSinkDB*>( _Sink );
+  if( sink )
+    csm::daemon::Metrics::Instance().RegisterGauge( "dbmgr.pending_requests",
+                                                    [ sink ]() { return (int64_t)sink->GetRequestCount(); } );
 }
 
 void
 csm::daemon::EventManagerDB::RegisterThreads( csm::daemon::ThreadPool *tp )
 {
-  for( unsigned tid = 0; tid < _DBConnectionPool->GetNumConfigConnections(); ++tid )
+  for( unsigned tid = 0; tid < _NumThreads; ++tid )
   {
     tp->MarkHandler( _Thread[ tid ]->get_id(), std::string("DBManager"+std::to_string(tid) ) );
     CSMLOG( csmd, debug ) << "Registering DBThread: " << tid << " ptr=" << (void*)_Thread[ tid ];
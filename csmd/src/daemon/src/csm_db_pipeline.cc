@@ -0,0 +1,486 @@
+/*================================================================================
+
+    csmd/src/daemon/src/csm_db_pipeline.cc
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+#ifdef logprefix
+#undef logprefix
+#endif
+#define logprefix "DBPIPE"
+#include "csm_pretty_log.h"
+
+#include <sys/epoll.h>
+#include <unistd.h>
+#include <map>
+
+#include "csm_daemon_config.h"
+#include "include/csm_db_manager.h"
+#include "include/csm_db_inflight.h"
+
+#define DB_PIPELINE_MAX_EPOLL_EVENTS ( 64 )
+// epoll data of the request wakeup eventfd, connection ids are small indices
+#define DB_PIPELINE_WAKEUP_ID ( UINT32_MAX )
+// requests returned to the sink after a connection failure are held back
+// for this long, doubled with each further failure in a row up to the max
+#define DB_PIPELINE_RETRY_MIN_MS ( 1 )
+#define DB_PIPELINE_RETRY_MAX_MS ( 1000 )
+
+/*
+ * Asynchronous DB request execution:
+ *   A single thread multiplexes all connections it currently holds on one epoll set.
+ *   The set also holds an eventfd signaled by the request sink, so the thread blocks
+ *   until a response or a new request arrives, or the heartbeat or a retry is due.
+ *   Requests without a dedicated connection are spread over pool connections and
+ *   up to <pipeline_depth> of them are queued per connection in libpq pipeline mode.
+ *   Requests on handler-owned connections and plain (non-parameterized) sql strings
+ *   are never pipelined; they just run non-blocking with one request in flight.
+ *   A pool connection is handed back to the pool as soon as it has nothing in flight.
+ */
+class DBPipeline
+{
+  struct Slot
+  {
+    csm::db::DBConnection_sptr _Conn;
+    bool _Dedicated;                                 ///< connection is owned by a handler
+    bool _WantWrite;                                 ///< output still queued in libpq
+    csm::daemon::DBInFlight<csm::daemon::DBReqEvent> _InFlight;  ///< requests in order of submission
+
+    Slot( csm::db::DBConnection_sptr aConn, const bool aDedicated )
+    : _Conn( aConn ), _Dedicated( aDedicated ), _WantWrite( false )
+    {}
+  };
+
+  csm::daemon::EventManagerDB *_Mgr;
+  csm::db::DBConnectionPool *_Pool;
+  unsigned _Depth;
+  int _EpollFD;
+  unsigned _InFlightCount;
+  std::map<unsigned, Slot*> _Slots;                  ///< active slots by connection id
+  csm::daemon::DBFailBackOff _BackOff;
+
+public:
+  DBPipeline( csm::daemon::EventManagerDB *aMgr, const unsigned aDepth )
+  : _Mgr( aMgr ),
+    _Pool( aMgr->GetDBConnectionPool() ),
+    _Depth( aDepth > 0 ? aDepth : 1 ),
+    _InFlightCount( 0 ),
+    _BackOff( DB_PIPELINE_RETRY_MIN_MS, DB_PIPELINE_RETRY_MAX_MS )
+  {
+    _EpollFD = epoll_create1( EPOLL_CLOEXEC );
+    if( _EpollFD < 0 )
+      throw csm::daemon::Exception( "DBMGR pipeline: failed to create epoll fd.", errno );
+
+    // new requests wake up the same epoll_wait as the connections
+    int wakeupFD = _Mgr->GetRequestWakeupFD();
+    if( wakeupFD < 0 )
+    {
+      close( _EpollFD );
+      throw csm::daemon::Exception( "DBMGR pipeline: no request wakeup fd." );
+    }
+    struct epoll_event ev;
+    memset( &ev, 0, sizeof( ev ) );
+    ev.events = EPOLLIN;
+    ev.data.u32 = DB_PIPELINE_WAKEUP_ID;
+    if( epoll_ctl( _EpollFD, EPOLL_CTL_ADD, wakeupFD, &ev ) != 0 )
+    {
+      int err = errno;
+      close( _EpollFD );
+      throw csm::daemon::Exception( "DBMGR pipeline: failed to add request wakeup fd to epoll set.", err );
+    }
+  }
+
+  ~DBPipeline()
+  {
+    while( ! _Slots.empty() )
+      FailSlot( _Slots.begin()->second, "shutdown" );
+    close( _EpollFD );
+  }
+
+  inline unsigned GetInFlightCount() const { return _InFlightCount; }
+
+  /* false while backing off from a connection failure */
+  inline bool CanDispatch() const { return _BackOff.CanDispatch(); }
+
+  /* Send the request to a connection. Returns false if there's no capacity right now
+   * or the send failed, in which case the request was returned to the sink.
+   */
+  bool Dispatch( csm::daemon::DBReqEvent *aEvent )
+  {
+    csm::db::DBReqContent dbcontent = aEvent->GetContent();
+    csm::db::DBConnection_sptr usrConn = dbcontent.GetDBConnection();
+    const bool plain = (( dbcontent.GetNumParams() == 0 ) && ( dbcontent.GetResultFormat() == 0 ));
+
+    Slot *slot = nullptr;
+    if( usrConn != nullptr )
+    {
+      // the sink serializes requests of dedicated connections, no capacity check needed
+      slot = GetSlot( usrConn, true );
+    }
+    else
+    {
+      slot = PickPoolSlot( plain );
+      if(( slot == nullptr ) || ( ! slot->_InFlight.Empty() ))
+      {
+        // prefer an idle connection over deepening a pipeline
+        csm::db::DBConnection_sptr dbConn = _Pool->AcquireDBConnection();
+        if( dbConn != nullptr )
+          slot = GetSlot( dbConn, false );
+      }
+    }
+
+    if( slot == nullptr )
+    {
+      if( ! _Pool->IsConnected() )
+      {
+        // all connections are down, respond with the error
+        Respond( aEvent, _Pool->GetErrorResult(), nullptr );
+        return true;
+      }
+      CSMLOG( csmd, trace ) << "No available DB Conn for Request: "
+          << "ctx=" << aEvent->GetEventContext()->GetAuxiliaryId();
+      _Mgr->RestoreRequestEvent( aEvent );
+      return false;
+    }
+
+    if( slot->_InFlight.Empty() )
+      slot->_Conn->SetPipelineMode( ! plain && ! slot->_Dedicated && ( _Depth > 1 ) );
+
+    CSMLOG(csmdb,debug) << "Sending DB Request: ctx=" << aEvent->GetEventContext()->GetAuxiliaryId()
+        << " conn=" << slot->_Conn->GetId() << " inflight=" << slot->_InFlight.Size();
+
+    bool sent;
+    if( plain )
+      sent = slot->_Conn->SendSql( dbcontent.GetSqlStmt().c_str() );
+    else
+      sent = slot->_Conn->SendParamSql(
+          dbcontent.GetSqlStmt().c_str(),
+          dbcontent.GetNumParams(),
+          dbcontent.GetParamValues(),
+          dbcontent.GetParamSizes(),
+          dbcontent.GetParamFormats(),
+          dbcontent.GetResultFormat() );
+
+    slot->_InFlight.Push( aEvent );
+    ++_InFlightCount;
+
+    if( ! sent )
+    {
+      FailSlot( slot, "send failed" );
+      return false;
+    }
+    Flush( slot );
+    return true;
+  }
+
+  /* the next time the loop has to run without any socket activity or new requests */
+  std::chrono::steady_clock::time_point NextDeadline() const
+  {
+    std::chrono::steady_clock::time_point deadline = _Pool->GetHeartbeatTimer();
+    if( ! _BackOff.CanDispatch() )
+      deadline = std::min( deadline, _BackOff.GetRetryAt() );
+    return deadline;
+  }
+
+  /* wait for and process socket activity of all connections with requests in flight
+   * returns early when new requests are queued or the next deadline has passed */
+  void Poll()
+  {
+    struct epoll_event events[ DB_PIPELINE_MAX_EPOLL_EVENTS ];
+    int n = epoll_wait( _EpollFD, events, DB_PIPELINE_MAX_EPOLL_EVENTS, csm::daemon::DBPollTimeout( NextDeadline() ) );
+    if(( n < 0 ) && ( errno != EINTR ))
+      CSMLOG( csmdb, error ) << "epoll_wait failed: " << strerror( errno );
+
+    for( int i = 0; i < n; ++i )
+    {
+      if( events[ i ].data.u32 == DB_PIPELINE_WAKEUP_ID )
+      {
+        // the requests themselves are fetched from the sink by the main loop
+        _Mgr->DrainRequestWakeup();
+        continue;
+      }
+      std::map<unsigned, Slot*>::iterator it = _Slots.find( (unsigned)events[ i ].data.u32 );
+      if( it == _Slots.end() )
+        continue;
+      Slot *slot = it->second;
+
+      if( events[ i ].events & ( EPOLLERR | EPOLLHUP ) )
+      {
+        // let libpq find out what's wrong, it will fail in ConsumeInput
+        events[ i ].events |= EPOLLIN;
+      }
+      if(( events[ i ].events & EPOLLOUT ) && ( ! Flush( slot ) ))
+        continue;
+      if( events[ i ].events & EPOLLIN )
+        ProcessInput( slot );
+    }
+  }
+
+private:
+  Slot* GetSlot( csm::db::DBConnection_sptr aConn, const bool aDedicated )
+  {
+    std::map<unsigned, Slot*>::iterator it = _Slots.find( aConn->GetId() );
+    if( it != _Slots.end() )
+      return it->second;
+
+    if( ! aConn->EnterAsyncMode( false ) )
+    {
+      CSMLOG( csmdb, error ) << "Failed to switch connection to non-blocking mode. conn=" << aConn->GetId();
+      if( ! aDedicated )
+        _Pool->ReleaseDBConnection( aConn );
+      return nullptr;
+    }
+
+    Slot *slot = new Slot( aConn, aDedicated );
+    struct epoll_event ev;
+    memset( &ev, 0, sizeof( ev ) );
+    ev.events = EPOLLIN;
+    ev.data.u32 = aConn->GetId();
+    if( epoll_ctl( _EpollFD, EPOLL_CTL_ADD, aConn->GetSocket(), &ev ) != 0 )
+    {
+      CSMLOG( csmdb, error ) << "Failed to add connection to epoll set: " << strerror( errno );
+      aConn->LeaveAsyncMode();
+      if( ! aDedicated )
+        _Pool->ReleaseDBConnection( aConn );
+      delete slot;
+      return nullptr;
+    }
+    _Slots[ aConn->GetId() ] = slot;
+    return slot;
+  }
+
+  // least loaded pool connection that can take another request
+  Slot* PickPoolSlot( const bool aPlain )
+  {
+    Slot *best = nullptr;
+    for( auto &it : _Slots )
+    {
+      Slot *slot = it.second;
+      if( slot->_Dedicated || ( slot->_InFlight.Size() >= _Depth ))
+        continue;
+      if(( ! slot->_InFlight.Empty() ) && ( aPlain || ! slot->_Conn->IsPipelined() ))
+        continue;
+      if(( best == nullptr ) || ( slot->_InFlight.Size() < best->_InFlight.Size() ))
+        best = slot;
+    }
+    return best;
+  }
+
+  // returns false if the slot failed
+  bool Flush( Slot *aSlot )
+  {
+    int rc = aSlot->_Conn->Flush();
+    if( rc < 0 )
+    {
+      FailSlot( aSlot, "flush failed" );
+      return false;
+    }
+    bool wantWrite = ( rc == 1 );
+    if( wantWrite != aSlot->_WantWrite )
+    {
+      struct epoll_event ev;
+      memset( &ev, 0, sizeof( ev ) );
+      ev.events = EPOLLIN | ( wantWrite ? EPOLLOUT : 0 );
+      ev.data.u32 = aSlot->_Conn->GetId();
+      epoll_ctl( _EpollFD, EPOLL_CTL_MOD, aSlot->_Conn->GetSocket(), &ev );
+      aSlot->_WantWrite = wantWrite;
+    }
+    return true;
+  }
+
+  void ProcessInput( Slot *aSlot )
+  {
+    if( ! aSlot->_Conn->ConsumeInput() )
+    {
+      FailSlot( aSlot, "connection lost" );
+      return;
+    }
+
+    const bool pipelined = aSlot->_Conn->IsPipelined();
+    while(( ! aSlot->_InFlight.Empty() ) && ( ! aSlot->_Conn->IsBusy() ))
+    {
+      PGresult *res = aSlot->_Conn->GetNextResult();
+      if( res == nullptr )
+      {
+        // end of the results of one query; in pipeline mode wait for the sync
+        if( ! pipelined )
+          Complete( aSlot );
+        continue;
+      }
+#ifdef LIBPQ_HAS_PIPELINING
+      if( PQ_RES_STATUS_CODE( res ) == PGRES_PIPELINE_SYNC )
+      {
+        PQ_RES_FREE( res );
+        Complete( aSlot );
+        continue;
+      }
+#endif
+      aSlot->_InFlight.Collect( res );
+    }
+    ReleaseIfIdle( aSlot );
+  }
+
+  void Complete( Slot *aSlot )
+  {
+    PGresult *res = nullptr;
+    csm::daemon::DBReqEvent *dbevent = aSlot->_InFlight.Complete( &res );
+    --_InFlightCount;
+
+    aSlot->_Conn->AsyncRequestDone( res );
+    if( res != nullptr )
+      _BackOff.Succeeded();
+
+    CSMLOG(csmdb,debug) << "Completed DB Request: ctx=" << dbevent->GetEventContext()->GetAuxiliaryId()
+        << " conn=" << aSlot->_Conn->GetId();
+
+    csm::db::DBConnection_sptr usrConn = aSlot->_Dedicated ? aSlot->_Conn : nullptr;
+    if( res != nullptr )
+    {
+      if( aSlot->_Dedicated && _Pool->DrainingConnections() )
+      {
+        LOG(csmd, debug) << "DBMGR: Draining locked connections";
+        usrConn = nullptr;
+      }
+      Respond( dbevent, std::make_shared<csm::db::DBResult>( res ), usrConn );
+    }
+    else
+    {
+      CSMLOG( csmdb, warning ) << "DB Request failed. Restoring to queue and checking DB connection..."
+          << " [ctx=" << dbevent->GetEventContext()->GetAuxiliaryId() << " conn=" << aSlot->_Conn->GetId() << "]";
+      _Mgr->RestoreRequestEvent( dbevent );
+      BackOff();
+    }
+
+    if( aSlot->_Dedicated )
+      Acknowledge( aSlot );
+  }
+
+  // hold back restored requests so a broken connection isn't retried in a tight loop
+  void BackOff()
+  {
+    unsigned delay = _BackOff.Failed();
+    CSMLOG( csmdb, debug ) << "Holding back DB requests for " << delay << "ms after " << _BackOff.GetStreak() << " failures";
+  }
+
+  void Respond( csm::daemon::DBReqEvent *aEvent,
+                csm::db::DBResult_sptr aResult,
+                csm::db::DBConnection_sptr aUsrConn )
+  {
+    if( aResult == nullptr )
+      throw csm::daemon::Exception( "DBMGR state machine error: RESPONSE without event." );
+
+    if( csm::db::DB_SUCCESS == aResult->GetResStatus() )
+      _Pool->UpdateHeartbeatTimer();
+
+    csm::daemon::DBRespEvent *dbs = new csm::daemon::DBRespEvent( csm::db::DBRespContent( aResult, aUsrConn ),
+                                                                  csm::daemon::EVENT_TYPE_DB_Response,
+                                                                  aEvent->GetEventContext() );
+    _Mgr->QueueResponseEvent( dbs );
+    delete aEvent;
+  }
+
+  // user-aquired connections are serialized
+  // so we have to tell the event sink that this connection can be unblocked now
+  void Acknowledge( Slot *aSlot )
+  {
+    try
+    {
+      _Mgr->AckRequest( aSlot->_Conn->GetId() );
+    }
+    catch (...)
+    {
+      CSMLOG( csmdb, error ) << "DBMgr failed to acknowledge request for connection " << aSlot->_Conn->GetId();
+    }
+  }
+
+  // return everything in flight to the sink and drop the connection
+  void FailSlot( Slot *aSlot, const char *aReason )
+  {
+    CSMLOG( csmdb, warning ) << "DB connection " << aSlot->_Conn->GetId() << ": " << aReason
+        << ". Restoring " << aSlot->_InFlight.Size() << " requests to queue.";
+
+    // restored in reverse to preserve the original order at the front of the queue
+    if( ! aSlot->_InFlight.Empty() )
+      BackOff();
+    csm::daemon::EventManagerDB *mgr = _Mgr;
+    _InFlightCount -= aSlot->_InFlight.Fail( [mgr]( csm::daemon::DBReqEvent *aEvent ) { mgr->RestoreRequestEvent( aEvent ); } );
+    Release( aSlot );
+  }
+
+  void ReleaseIfIdle( Slot *aSlot )
+  {
+    if(( aSlot != nullptr ) && ( aSlot->_InFlight.Empty() ))
+      Release( aSlot );
+  }
+
+  void Release( Slot *aSlot )
+  {
+    epoll_ctl( _EpollFD, EPOLL_CTL_DEL, aSlot->_Conn->GetSocket(), nullptr );
+    // drain anything left over so the connection is usable for synchronous calls again
+    PGresult *res;
+    while(( ! aSlot->_Conn->IsBusy() ) && (( res = aSlot->_Conn->GetNextResult() ) != nullptr ))
+      PQ_RES_FREE( res );
+    aSlot->_Conn->LeaveAsyncMode();
+
+    if(( ! aSlot->_Dedicated ) || _Pool->DrainingConnections() )
+      _Pool->ReleaseDBConnection( aSlot->_Conn );
+
+    _Slots.erase( aSlot->_Conn->GetId() );
+    delete aSlot;
+  }
+};
+
+void DBManagerPipelineMain( csm::daemon::EventManagerDB *aMgr )
+{
+  CSMLOG(csmd,debug) << "Starting pipelined Database manager threadID=" << boost::this_thread::get_id()
+      << " depth=" << aMgr->GetPipelineDepth();
+  CSMLOG(csmd,debug) << "Built for DB_SCHEMA version=" << std::string( DB_SCHEMA_VERSION );
+#ifndef LIBPQ_HAS_PIPELINING
+  if( aMgr->GetPipelineDepth() > 1 )
+    CSMLOG( csmd, warning ) << "libpq without pipeline support. Running with one request in flight per connection.";
+#endif
+
+  csm::daemon::RetryBackOff *idleRetry = aMgr->GetIdleRetry();
+  csm::db::DBConnectionPool *dbConnPool = aMgr->GetDBConnectionPool();
+  DBPipeline pipeline( aMgr, aMgr->GetPipelineDepth() );
+
+  while( aMgr->GetThreadKeepRunning() )
+  {
+    bool progress = false;
+    csm::daemon::DBReqEvent *dbevent = nullptr;
+    while( pipeline.CanDispatch() && (( dbevent = aMgr->DequeueRequestEvent() ) != nullptr ))
+    {
+      if( ! pipeline.Dispatch( dbevent ) )
+        break;
+      progress = true;
+    }
+
+    // also under constant load: reconnecting lost connections depends on the heartbeat
+    if(dbConnPool->GetHeartbeatTimer() < std::chrono::steady_clock::now())
+    {
+      // check db status and/or try to reconnect
+      dbConnPool->Heartbeat();
+    }
+
+    if( pipeline.GetInFlightCount() == 0 )
+    {
+      if( progress )
+        continue;
+
+      try { idleRetry->AgainOrWait(); }
+      catch ( csm::daemon::Exception &e ) { CSMLOG( csmd, error ) << e.what(); }
+      continue;
+    }
+
+    pipeline.Poll();
+    idleRetry->Reset();
+  }
+}
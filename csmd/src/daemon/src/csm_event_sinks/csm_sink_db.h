@@ -20,6 +20,7 @@
 #include <deque>
 
 #include "include/csm_db_event_content.h"
+#include "include/csm_db_inflight.h"
 #include "include/csm_event_sink.h"
 #include "include/csm_retry_backoff.h"
 
@@ -51,14 +52,17 @@ class EventSinkDB : public csm::daemon::EventSink
   int _ActiveQueue;                           ///< currently active queue for event scheduling
   std::mutex _RequestLock;                    ///< for concurrent access to queues
   std::atomic_int _RequestCount;              ///< total pending request count
+  csm::daemon::DBRequestWakeup *_PipelineWakeup;  ///< to wake up the pipelined db manager in epoll_wait
 
 public:
   EventSinkDB( csm::daemon::RetryBackOff *i_MgrWakeup,
-               const int i_NumQueues = 1 )
+               const int i_NumQueues = 1,
+               const bool i_Pipelined = false )
   : _ManagerWakeup( i_MgrWakeup ),
     _NumQueues( i_NumQueues + 1 ),
     _DefaultQueueIndex( i_NumQueues ),
-    _ActiveQueue( 0 )
+    _ActiveQueue( 0 ),
+    _PipelineWakeup( i_Pipelined ? new csm::daemon::DBRequestWakeup() : nullptr )
   {
     _Request = new DBReqEventQueue[ _NumQueues ];
     _QueueBusy = new bool[ _NumQueues ];
@@ -72,6 +76,7 @@ public:
 
     delete [] _Request;
     delete [] _QueueBusy;
+    delete _PipelineWakeup;
   }
   virtual int PostEvent( const csm::daemon::CoreEvent &aEvent )
   {
@@ -100,6 +105,7 @@ public:
     _RequestLock.unlock();
 
     _ManagerWakeup->WakeUp();
+    WakeUpPipeline();
     return 0;
   }
   virtual csm::daemon::CoreEvent* FetchEvent()
@@ -145,6 +151,14 @@ public:
     _RequestLock.unlock();
   }
 
+  // eventfd the pipelined db manager waits on together with its connections, -1 if not pipelined
+  inline int GetPipelineWakeupFD() const { return ( _PipelineWakeup != nullptr ) ? _PipelineWakeup->GetFD() : -1; }
+  inline void WakeUpPipeline() { if( _PipelineWakeup != nullptr ) _PipelineWakeup->Signal(); }
+  inline bool DrainPipelineWakeup() { return ( _PipelineWakeup != nullptr ) && _PipelineWakeup->Drain(); }
+
+  // number of requests waiting for a db connection
+  inline int GetRequestCount() const { return _RequestCount; }
+
   // signal the completion of an event - required for serialization in dedicated queues
   inline void AckEvent( const int i_ConnectionID )
   {
@@ -0,0 +1,302 @@
+/*================================================================================
+
+    csmd/src/daemon/src/csm_metrics.cc
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+
+#include "include/csm_metrics.h"
+#include "include/csm_bds_keys.h"
+
+#include <iomanip>
+#include <sstream>
+
+namespace csm {
+namespace daemon {
+
+// percentiles reported by Dump() and GetJsonString()
+static const double METRICS_PERCENTILES[] = { 0.5, 0.9, 0.99, 0.999 };
+static const char  *METRICS_PERCENTILE_NAMES[] = { "p50", "p90", "p99", "p999" };
+#define METRICS_PERCENTILE_COUNT ( sizeof( METRICS_PERCENTILES ) / sizeof( double ) )
+
+// shard of the calling thread; shards stay registered after their thread exits to keep the counts
+static thread_local void *tls_Shard = nullptr;
+
+const char* MetricsCategoryToString( const MetricsCategory i_Category )
+{
+  switch( i_Category )
+  {
+    case METRICS_HANDLER:      return "handler";
+    case METRICS_NETWORK_WAIT: return "network_wait";
+    case METRICS_DB_WAIT:      return "db_wait";
+    case METRICS_MCAST_WAIT:   return "mcast_wait";
+    case METRICS_TOTAL:        return "total";
+    default:                   return "unknown";
+  }
+}
+
+/////////////////////////////////////////////////////////////////
+// LatencyHistogram
+
+LatencyHistogram::LatencyHistogram()
+: _Count( 0 ), _Sum( 0 )
+{
+  for( unsigned i = 0; i < CSM_METRICS_BUCKETS; ++i )
+    _Buckets[ i ].store( 0, std::memory_order_relaxed );
+}
+
+unsigned LatencyHistogram::BucketIndex( const uint64_t i_Micros )
+{
+  // small values get one bucket each
+  if( i_Micros < ( 1ull << CSM_METRICS_SUB_BITS ) )
+    return (unsigned)i_Micros;
+
+  // otherwise: the magnitude selects the group, the bits below the leading one select the bucket
+  unsigned magnitude = 63 - __builtin_clzll( i_Micros );
+  unsigned shift = magnitude - CSM_METRICS_SUB_BITS;
+  unsigned sub = ( i_Micros >> shift ) & ( ( 1u << CSM_METRICS_SUB_BITS ) - 1 );
+  return ( ( shift + 1 ) << CSM_METRICS_SUB_BITS ) + sub;
+}
+
+uint64_t LatencyHistogram::BucketUpperBound( const unsigned i_Index )
+{
+  if( i_Index < ( 1u << CSM_METRICS_SUB_BITS ) )
+    return i_Index;
+
+  unsigned shift = ( i_Index >> CSM_METRICS_SUB_BITS ) - 1;
+  uint64_t sub = i_Index & ( ( 1u << CSM_METRICS_SUB_BITS ) - 1 );
+  uint64_t lower = ( ( 1ull << CSM_METRICS_SUB_BITS ) + sub ) << shift;
+  return lower + ( ( 1ull << shift ) - 1 );
+}
+
+/////////////////////////////////////////////////////////////////
+// LatencySnapshot
+
+LatencySnapshot::LatencySnapshot()
+: _Buckets( CSM_METRICS_BUCKETS, 0 ), _Count( 0 ), _Sum( 0 )
+{}
+
+void LatencySnapshot::Add( const LatencyHistogram &i_Histogram )
+{
+  // the count is read first, so the buckets never add up to less than the count
+  _Count += i_Histogram._Count.load( std::memory_order_acquire );
+  _Sum += i_Histogram._Sum.load( std::memory_order_relaxed );
+  for( unsigned i = 0; i < CSM_METRICS_BUCKETS; ++i )
+    _Buckets[ i ] += i_Histogram._Buckets[ i ].load( std::memory_order_relaxed );
+}
+
+void LatencySnapshot::Subtract( const LatencySnapshot &i_Older )
+{
+  _Count -= i_Older._Count;
+  _Sum -= i_Older._Sum;
+  for( unsigned i = 0; i < CSM_METRICS_BUCKETS; ++i )
+    _Buckets[ i ] -= i_Older._Buckets[ i ];
+}
+
+uint64_t LatencySnapshot::GetPercentile( const double i_Fraction ) const
+{
+  if( _Count == 0 )
+    return 0;
+
+  uint64_t rank = (uint64_t)( i_Fraction * _Count );
+  if( rank >= _Count )
+    rank = _Count - 1;
+
+  uint64_t seen = 0;
+  for( unsigned i = 0; i < CSM_METRICS_BUCKETS; ++i )
+  {
+    seen += _Buckets[ i ];
+    if( seen > rank )
+      return LatencyHistogram::BucketUpperBound( i );
+  }
+  return GetMax();
+}
+
+uint64_t LatencySnapshot::GetMax() const
+{
+  for( unsigned i = CSM_METRICS_BUCKETS; i > 0; --i )
+    if( _Buckets[ i - 1 ] != 0 )
+      return LatencyHistogram::BucketUpperBound( i - 1 );
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////
+// Metrics
+
+Metrics::Shard::Shard()
+{
+  for( unsigned cmd = 0; cmd < CSM_CMD_MAX; ++cmd )
+    for( unsigned cat = 0; cat < METRICS_CATEGORY_MAX; ++cat )
+      _Histograms[ cmd ][ cat ].store( nullptr, std::memory_order_relaxed );
+}
+
+Metrics::Metrics()
+: _LastExport( CSM_CMD_MAX * METRICS_CATEGORY_MAX )
+{}
+
+Metrics& Metrics::Instance()
+{
+  // never destroyed: threads may still record or unregister during static destruction
+  static Metrics *instance = new Metrics();
+  return *instance;
+}
+
+Metrics::Shard* Metrics::GetShard()
+{
+  if( tls_Shard == nullptr )
+  {
+    Shard *shard = new Shard();
+    std::lock_guard<std::mutex> guard( _ShardLock );
+    _Shards.push_back( shard );
+    tls_Shard = shard;
+  }
+  return (Shard*)tls_Shard;
+}
+
+void Metrics::Record( const uint8_t i_Cmd, const MetricsCategory i_Category, const uint64_t i_Micros )
+{
+  if(( i_Cmd >= CSM_CMD_MAX ) || ( i_Category >= METRICS_CATEGORY_MAX ))
+    return;
+
+  std::atomic<LatencyHistogram*> &slot = GetShard()->_Histograms[ i_Cmd ][ i_Category ];
+  LatencyHistogram *histogram = slot.load( std::memory_order_relaxed );
+  if( histogram == nullptr )
+  {
+    histogram = new LatencyHistogram();
+    slot.store( histogram, std::memory_order_release );
+  }
+  histogram->Record( i_Micros );
+}
+
+void Metrics::RegisterGauge( const std::string &i_Name, std::function<int64_t()> i_Sample )
+{
+  std::lock_guard<std::mutex> guard( _GaugeLock );
+  _Gauges[ i_Name ] = i_Sample;
+}
+
+void Metrics::UnregisterGauge( const std::string &i_Name )
+{
+  std::lock_guard<std::mutex> guard( _GaugeLock );
+  _Gauges.erase( i_Name );
+}
+
+void Metrics::Snapshot( std::vector<LatencySnapshot> &o_Snapshot ) const
+{
+  o_Snapshot.assign( CSM_CMD_MAX * METRICS_CATEGORY_MAX, LatencySnapshot() );
+
+  std::lock_guard<std::mutex> guard( _ShardLock );
+  for( auto shard : _Shards )
+    for( unsigned cmd = 0; cmd < CSM_CMD_MAX; ++cmd )
+      for( unsigned cat = 0; cat < METRICS_CATEGORY_MAX; ++cat )
+      {
+        LatencyHistogram *histogram = shard->_Histograms[ cmd ][ cat ].load( std::memory_order_acquire );
+        if( histogram != nullptr )
+          o_Snapshot[ cmd * METRICS_CATEGORY_MAX + cat ].Add( *histogram );
+      }
+}
+
+void Metrics::SampleGauges( std::map<std::string, int64_t> &o_Gauges ) const
+{
+  std::lock_guard<std::mutex> guard( _GaugeLock );
+  for( auto &it : _Gauges )
+    o_Gauges[ it.first ] = it.second();
+}
+
+std::string Metrics::Dump() const
+{
+  std::vector<LatencySnapshot> snapshot;
+  Snapshot( snapshot );
+  std::map<std::string, int64_t> gauges;
+  SampleGauges( gauges );
+
+  std::stringstream ss;
+  ss << "Latency (us):\n";
+  ss << "\t" << std::left << std::setw( 48 ) << "command" << std::setw( 14 ) << "category"
+     << std::right << std::setw( 10 ) << "count" << std::setw( 10 ) << "mean";
+  for( unsigned p = 0; p < METRICS_PERCENTILE_COUNT; ++p )
+    ss << std::setw( 10 ) << METRICS_PERCENTILE_NAMES[ p ];
+  ss << std::setw( 10 ) << "max" << "\n";
+
+  for( unsigned cmd = 0; cmd < CSM_CMD_MAX; ++cmd )
+    for( unsigned cat = 0; cat < METRICS_CATEGORY_MAX; ++cat )
+    {
+      const LatencySnapshot &entry = snapshot[ cmd * METRICS_CATEGORY_MAX + cat ];
+      if( entry.GetCount() == 0 )
+        continue;
+
+      ss << "\t" << std::left << std::setw( 48 ) << csmi_cmds_to_str( cmd )
+         << std::setw( 14 ) << MetricsCategoryToString( (MetricsCategory)cat )
+         << std::right << std::setw( 10 ) << entry.GetCount() << std::setw( 10 ) << entry.GetMean();
+      for( unsigned p = 0; p < METRICS_PERCENTILE_COUNT; ++p )
+        ss << std::setw( 10 ) << entry.GetPercentile( METRICS_PERCENTILES[ p ] );
+      ss << std::setw( 10 ) << entry.GetMax() << "\n";
+    }
+
+  ss << "Gauges:\n";
+  for( auto &it : gauges )
+    ss << "\t" << it.first << " = " << it.second << "\n";
+
+  return ss.str();
+}
+
+std::string Metrics::GetJsonString( const std::string &i_Source, const std::string &i_TimeStamp )
+{
+  std::vector<LatencySnapshot> snapshot;
+  Snapshot( snapshot );
+  std::map<std::string, int64_t> gauges;
+  SampleGauges( gauges );
+
+  // only report what happened since the previous export
+  std::vector<LatencySnapshot> interval( snapshot );
+  {
+    std::lock_guard<std::mutex> guard( _ExportLock );
+    for( size_t i = 0; i < interval.size(); ++i )
+      interval[ i ].Subtract( _LastExport[ i ] );
+    _LastExport.swap( snapshot );
+  }
+
+  std::stringstream json;
+  for( unsigned cmd = 0; cmd < CSM_CMD_MAX; ++cmd )
+    for( unsigned cat = 0; cat < METRICS_CATEGORY_MAX; ++cat )
+    {
+      const LatencySnapshot &entry = interval[ cmd * METRICS_CATEGORY_MAX + cat ];
+      if( entry.GetCount() == 0 )
+        continue;
+
+      json << "{\"" CSM_BDS_KEY_TYPE "\":\"" CSM_BDS_TYPE_DAEMON_METRICS "\""
+           << ",\"" CSM_BDS_KEY_SOURCE "\":\"" << i_Source << "\""
+           << ",\"" CSM_BDS_KEY_TIME_STAMP "\":\"" << i_TimeStamp << "\""
+           << ",\"" CSM_BDS_SECTION_DATA "\":{"
+           << "\"command\":\"" << csmi_cmds_to_str( cmd ) << "\""
+           << ",\"category\":\"" << MetricsCategoryToString( (MetricsCategory)cat ) << "\""
+           << ",\"count\":" << entry.GetCount()
+           << ",\"mean_us\":" << entry.GetMean();
+      for( unsigned p = 0; p < METRICS_PERCENTILE_COUNT; ++p )
+        json << ",\"" << METRICS_PERCENTILE_NAMES[ p ] << "_us\":" << entry.GetPercentile( METRICS_PERCENTILES[ p ] );
+      json << ",\"max_us\":" << entry.GetMax() << "}}\n";
+    }
+
+  if( ! gauges.empty() )
+  {
+    json << "{\"" CSM_BDS_KEY_TYPE "\":\"" CSM_BDS_TYPE_DAEMON_METRICS "\""
+         << ",\"" CSM_BDS_KEY_SOURCE "\":\"" << i_Source << "\""
+         << ",\"" CSM_BDS_KEY_TIME_STAMP "\":\"" << i_TimeStamp << "\""
+         << ",\"" CSM_BDS_SECTION_DATA "\":{";
+    for( auto it = gauges.begin(); it != gauges.end(); ++it )
+      json << ( it == gauges.begin() ? "" : "," ) << "\"" << it->first << "\":" << it->second;
+    json << "}}\n";
+  }
+
+  return json.str();
+}
+
+}  // namespace daemon
+} // namespace csm
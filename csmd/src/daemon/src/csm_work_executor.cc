@@ -0,0 +1,439 @@
+/*================================================================================
+
+    csmd/src/daemon/src/csm_work_executor.cc
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+
+#include "include/csm_work_executor.h"
+#include "logging.h"
+
+#include <sched.h>
+
+namespace csm {
+namespace daemon {
+
+// number of empty scans before a worker goes to sleep
+#define CSM_EXECUTOR_IDLE_SPINS ( 64 )
+// number of tasks a strand runs before it yields its worker
+#define CSM_EXECUTOR_STRAND_BATCH ( 16 )
+
+// worker identity of the calling thread so that tasks submitted from a worker stay local
+static thread_local WorkStealingExecutor *tls_Executor = nullptr;
+static thread_local unsigned tls_Slot = 0;
+
+static size_t RoundUpPow2( size_t i_Val )
+{
+  size_t ret = 2;
+  while( ret < i_Val )
+    ret <<= 1;
+  return ret;
+}
+
+// drops a strand's pending count when the task is done, whichever way it is left
+class StrandPendingRelease
+{
+  std::atomic<int64_t> &_Pending;
+  bool &_Idle;
+public:
+  StrandPendingRelease( std::atomic<int64_t> &i_Pending, bool &o_Idle )
+  : _Pending( i_Pending ), _Idle( o_Idle ) {}
+  ~StrandPendingRelease()
+  {
+    _Idle = ( _Pending.fetch_sub( 1, std::memory_order_acq_rel ) == 1 );
+  }
+};
+
+/////////////////////////////////////////////////////////////////
+// ExecutorQueue
+
+ExecutorQueue::ExecutorQueue( const size_t i_Capacity )
+: _Cells(), _Mask( RoundUpPow2( i_Capacity ) - 1 ), _PushPos( 0 ), _PopPos( 0 )
+{
+  _Cells.reset( new Cell[ _Mask + 1 ] );
+  for( size_t i = 0; i <= _Mask; ++i )
+  {
+    _Cells[ i ]._Seq.store( i, std::memory_order_relaxed );
+    _Cells[ i ]._Task = nullptr;
+  }
+}
+
+ExecutorQueue::~ExecutorQueue()
+{
+  ExecutorTask *task;
+  while(( task = Pop() ) != nullptr )
+    delete task;
+}
+
+bool ExecutorQueue::Push( ExecutorTask *i_Task )
+{
+  size_t pos = _PushPos.load( std::memory_order_relaxed );
+  while( true )
+  {
+    Cell *cell = &_Cells[ pos & _Mask ];
+    size_t seq = cell->_Seq.load( std::memory_order_acquire );
+    intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+    if( diff == 0 )
+    {
+      if( _PushPos.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+      {
+        cell->_Task = i_Task;
+        cell->_Seq.store( pos + 1, std::memory_order_release );
+        return true;
+      }
+    }
+    else if( diff < 0 )
+      return false;
+    else
+      pos = _PushPos.load( std::memory_order_relaxed );
+  }
+}
+
+ExecutorTask* ExecutorQueue::Pop()
+{
+  size_t pos = _PopPos.load( std::memory_order_relaxed );
+  while( true )
+  {
+    Cell *cell = &_Cells[ pos & _Mask ];
+    size_t seq = cell->_Seq.load( std::memory_order_acquire );
+    intptr_t diff = (intptr_t)seq - (intptr_t)( pos + 1 );
+    if( diff == 0 )
+    {
+      if( _PopPos.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+      {
+        ExecutorTask *task = cell->_Task;
+        cell->_Seq.store( pos + _Mask + 1, std::memory_order_release );
+        return task;
+      }
+    }
+    else if( diff < 0 )
+      return nullptr;
+    else
+      pos = _PopPos.load( std::memory_order_relaxed );
+  }
+}
+
+size_t ExecutorQueue::SizeApprox() const
+{
+  size_t push = _PushPos.load( std::memory_order_relaxed );
+  size_t pop = _PopPos.load( std::memory_order_relaxed );
+  return ( push > pop ) ? push - pop : 0;
+}
+
+/////////////////////////////////////////////////////////////////
+// ExecutorStrand
+
+ExecutorStrand::ExecutorStrand()
+: _Head( &_Stub ), _Tail( &_Stub ), _Pending( 0 )
+{
+  _Stub._Next.store( nullptr, std::memory_order_relaxed );
+}
+
+ExecutorStrand::~ExecutorStrand()
+{
+  Node *node;
+  while(( node = PopNode() ) != nullptr )
+    delete node;
+}
+
+void ExecutorStrand::PushNode( Node *i_Node )
+{
+  i_Node->_Next.store( nullptr, std::memory_order_relaxed );
+  Node *prev = _Head.exchange( i_Node, std::memory_order_acq_rel );
+  prev->_Next.store( i_Node, std::memory_order_release );
+}
+
+// single consumer: only the worker that currently runs the strand calls this
+ExecutorStrand::Node* ExecutorStrand::PopNode()
+{
+  Node *tail = _Tail;
+  Node *next = tail->_Next.load( std::memory_order_acquire );
+  if( tail == &_Stub )
+  {
+    if( next == nullptr )
+      return nullptr;
+    _Tail = next;
+    tail = next;
+    next = next->_Next.load( std::memory_order_acquire );
+  }
+  if( next != nullptr )
+  {
+    _Tail = next;
+    return tail;
+  }
+  // a producer is between exchanging the head and linking its node
+  if( tail != _Head.load( std::memory_order_acquire ) )
+    return nullptr;
+
+  PushNode( &_Stub );
+  next = tail->_Next.load( std::memory_order_acquire );
+  if( next != nullptr )
+  {
+    _Tail = next;
+    return tail;
+  }
+  return nullptr;
+}
+
+bool ExecutorStrand::Push( ExecutorTask &&i_Task )
+{
+  Node *node = new Node();
+  node->_Task = std::move( i_Task );
+  PushNode( node );
+  return ( _Pending.fetch_add( 1, std::memory_order_acq_rel ) == 0 );
+}
+
+void ExecutorStrand::Run( const unsigned i_Max, bool &o_Idle )
+{
+  o_Idle = false;
+  for( unsigned n = 0; ( n < i_Max ) && ( ! o_Idle ); ++n )
+  {
+    Node *node;
+    // the pending count guarantees that the node is on its way
+    while(( node = PopNode() ) == nullptr )
+      sched_yield();
+
+    // release runs after the node is freed; once idle, the strand may be deleted by the registry
+    StrandPendingRelease release( _Pending, o_Idle );
+    std::unique_ptr<Node> owner( node );
+    owner->_Task();
+  }
+}
+
+/////////////////////////////////////////////////////////////////
+// ExecutorStrandRegistry
+
+ExecutorStrandRegistry::ExecutorStrandRegistry()
+: _Lock(), _Strands()
+{}
+
+ExecutorStrandRegistry::~ExecutorStrandRegistry()
+{
+  std::lock_guard<std::mutex> guard( _Lock );
+  for( auto &it : _Strands )
+    delete it.second;
+  _Strands.clear();
+}
+
+ExecutorStrand* ExecutorStrandRegistry::Push( const void *i_Owner, ExecutorTask &&i_Task )
+{
+  // the push is done under the lock so that Release() never drops a strand that is about to get a task
+  std::lock_guard<std::mutex> guard( _Lock );
+  ExecutorStrand *&strand = _Strands[ i_Owner ];
+  if( strand == nullptr )
+    strand = new ExecutorStrand();
+  return strand->Push( std::move( i_Task ) ) ? strand : nullptr;
+}
+
+void ExecutorStrandRegistry::Release( const void *i_Owner, ExecutorStrand *i_Strand )
+{
+  // a runner of a newer strand of the owner may already have dropped i_Strand, so it is only compared, never accessed
+  ExecutorStrand *strand = nullptr;
+  {
+    std::lock_guard<std::mutex> guard( _Lock );
+    auto it = _Strands.find( i_Owner );
+    if(( it == _Strands.end() ) || ( it->second != i_Strand ) || ( ! it->second->IsIdle() ))
+      return;
+    strand = it->second;
+    _Strands.erase( it );
+  }
+  delete strand;
+}
+
+size_t ExecutorStrandRegistry::Size()
+{
+  std::lock_guard<std::mutex> guard( _Lock );
+  return _Strands.size();
+}
+
+/////////////////////////////////////////////////////////////////
+// WorkStealingExecutor
+
+WorkStealingExecutor::WorkStealingExecutor( const unsigned i_Workers, const size_t i_QueueCapacity )
+: _Queues(),
+  _Strands(),
+  _Overflow(),
+  _OverflowCount( 0 ),
+  _Queued( 0 ),
+  _NextSlot( 0 ),
+  _Sleepers( 0 ),
+  _Stop( false ),
+  _Steals( 0 )
+{
+  unsigned workers = ( i_Workers > 0 ) ? i_Workers : 1;
+  for( unsigned i = 0; i < workers; ++i )
+    _Queues.push_back( std::unique_ptr<ExecutorQueue>( new ExecutorQueue( i_QueueCapacity ) ) );
+}
+
+WorkStealingExecutor::~WorkStealingExecutor()
+{
+  Shutdown();
+  // anything left over was never picked up by a worker
+  std::lock_guard<std::mutex> guard( _OverflowLock );
+  for( auto task : _Overflow )
+    delete task;
+  _Overflow.clear();
+}
+
+void WorkStealingExecutor::Schedule( ExecutorTask *i_Task )
+{
+  // count first so that workers don't go to sleep while the push is in flight
+  _Queued.fetch_add( 1 );
+
+  unsigned workers = _Queues.size();
+  unsigned slot = ( tls_Executor == this ) ? tls_Slot : _NextSlot.fetch_add( 1, std::memory_order_relaxed ) % workers;
+
+  bool queued = false;
+  for( unsigned n = 0; ( n < workers ) && ( ! queued ); ++n )
+    queued = _Queues[ ( slot + n ) % workers ]->Push( i_Task );
+
+  if( ! queued )
+  {
+    std::lock_guard<std::mutex> guard( _OverflowLock );
+    _Overflow.push_back( i_Task );
+    _OverflowCount.fetch_add( 1 );
+  }
+
+  if( _Sleepers.load() > 0 )
+  {
+    std::lock_guard<std::mutex> guard( _SleepLock );
+    _SleepCond.notify_one();
+  }
+}
+
+void WorkStealingExecutor::ScheduleStrand( ExecutorStrand *i_Strand, const void *i_Owner )
+{
+  Schedule( new ExecutorTask( [ this, i_Strand, i_Owner ]()
+  {
+    bool idle = false;
+    try
+    {
+      i_Strand->Run( CSM_EXECUTOR_STRAND_BATCH, idle );
+    }
+    catch( ... )
+    {
+      // the task that threw is done; the remaining tasks of the owner still have to run
+      if( idle )
+        _Strands.Release( i_Owner, i_Strand );
+      else
+        ScheduleStrand( i_Strand, i_Owner );
+      throw;
+    }
+
+    if( idle )
+      _Strands.Release( i_Owner, i_Strand );
+    else
+      ScheduleStrand( i_Strand, i_Owner );
+  } ) );
+}
+
+void WorkStealingExecutor::Submit( ExecutorTask &&i_Task )
+{
+  Schedule( new ExecutorTask( std::move( i_Task ) ) );
+}
+
+void WorkStealingExecutor::Submit( ExecutorTask &&i_Task, const void *i_Owner )
+{
+  if( i_Owner == nullptr )
+  {
+    Submit( std::move( i_Task ) );
+    return;
+  }
+
+  ExecutorStrand *strand = _Strands.Push( i_Owner, std::move( i_Task ) );
+  if( strand != nullptr )
+    ScheduleStrand( strand, i_Owner );
+}
+
+ExecutorTask* WorkStealingExecutor::Next( const unsigned i_Slot )
+{
+  unsigned workers = _Queues.size();
+  ExecutorTask *task = _Queues[ i_Slot ]->Pop();
+
+  for( unsigned n = 1; ( n < workers ) && ( task == nullptr ); ++n )
+  {
+    task = _Queues[ ( i_Slot + n ) % workers ]->Pop();
+    if( task != nullptr )
+      _Steals.fetch_add( 1, std::memory_order_relaxed );
+  }
+
+  if(( task == nullptr ) && ( _OverflowCount.load() > 0 ))
+  {
+    std::lock_guard<std::mutex> guard( _OverflowLock );
+    if( ! _Overflow.empty() )
+    {
+      task = _Overflow.front();
+      _Overflow.pop_front();
+      _OverflowCount.fetch_sub( 1 );
+    }
+  }
+
+  if( task != nullptr )
+    _Queued.fetch_sub( 1 );
+  return task;
+}
+
+void WorkStealingExecutor::Sleep()
+{
+  std::unique_lock<std::mutex> lock( _SleepLock );
+  _Sleepers.fetch_add( 1 );
+  while(( ! _Stop.load() ) && ( _Queued.load() <= 0 ))
+    _SleepCond.wait( lock );
+  _Sleepers.fetch_sub( 1 );
+}
+
+void WorkStealingExecutor::WorkerLoop( const unsigned i_Slot )
+{
+  if( i_Slot >= _Queues.size() )
+  {
+    LOG( csmd, error ) << "WorkStealingExecutor: invalid worker slot " << i_Slot;
+    return;
+  }
+
+  tls_Executor = this;
+  tls_Slot = i_Slot;
+
+  unsigned idle = 0;
+  while( true )
+  {
+    ExecutorTask *task = Next( i_Slot );
+    if( task != nullptr )
+    {
+      std::unique_ptr<ExecutorTask> owner( task );
+      ( *task )();
+      idle = 0;
+      continue;
+    }
+
+    if(( _Stop.load() ) && ( _Queued.load() <= 0 ))
+      break;
+
+    if( ++idle < CSM_EXECUTOR_IDLE_SPINS )
+    {
+      sched_yield();
+      continue;
+    }
+    Sleep();
+    idle = 0;
+  }
+
+  tls_Executor = nullptr;
+}
+
+void WorkStealingExecutor::Shutdown()
+{
+  _Stop.store( true );
+  std::lock_guard<std::mutex> guard( _SleepLock );
+  _SleepCond.notify_all();
+}
+
+} // namespace daemon
+} // namespace csm
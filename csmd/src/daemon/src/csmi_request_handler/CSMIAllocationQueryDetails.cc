@@ -518,29 +518,12 @@ bool CSMIAllocationQueryDetails::CreateStepPayload(
 
 
         // Build the payload, gets both the active and history steps.
-        std::string stmt =
-            "SELECT "
-                "s.step_id,s.num_nodes,CAST(NULL AS DATE) as end_time, "
-                "array_to_string(array_agg(sn.node_name),',') AS nodelist "
-            "FROM csm_step s "
-            "JOIN csm_step_node sn "
-                " ON s.allocation_id=sn.allocation_id AND s.step_id=sn.step_id "
-            "WHERE s.allocation_id = $1::bigint "
-            "GROUP BY s.allocation_id, s.step_id, s.num_nodes, end_time "
-            "UNION ALL "
-            "SELECT "
-                "s.step_id,s.num_nodes,s.end_time,"
-                "array_to_string(array_agg(sn.node_name),',') AS nodelist "
-            "FROM csm_step_history s "
-            "JOIN csm_step_node_history sn "
-                " ON s.allocation_id=sn.allocation_id AND s.step_id=sn.step_id "
-            "WHERE s.allocation_id = $1::bigint "
-            "GROUP BY s.allocation_id, s.step_id, s.num_nodes, s.end_time  "
-            "ORDER BY  end_time DESC, step_id ASC" ;
+        const std::string& stmt = StepQuery();
             
         const int paramCount = 1;
         csm::db::DBReqContent *dbReq = new csm::db::DBReqContent( stmt, paramCount );
         dbReq->AddNumericParam<int64_t>(a->allocation_id);
+        dbReq->SetBinaryResults();
 
         *dbPayload = dbReq;
     }
@@ -569,6 +552,44 @@ bool CSMIAllocationQueryDetails::CreateStepPayload(
     return true;
 }
 
+const std::string& CSMIAllocationQueryDetails::StepQuery()
+{
+    // Column names match the members of csmi_allocation_step_list_t, see StepColumns.
+    static const std::string stmt =
+        "SELECT "
+            "s.step_id,s.num_nodes,CAST(NULL AS DATE) as end_time, "
+            "array_to_string(array_agg(sn.node_name),',') AS compute_nodes "
+        "FROM csm_step s "
+        "JOIN csm_step_node sn "
+            " ON s.allocation_id=sn.allocation_id AND s.step_id=sn.step_id "
+        "WHERE s.allocation_id = $1::bigint "
+        "GROUP BY s.allocation_id, s.step_id, s.num_nodes, end_time "
+        "UNION ALL "
+        "SELECT "
+            "s.step_id,s.num_nodes,s.end_time,"
+            "array_to_string(array_agg(sn.node_name),',') AS compute_nodes "
+        "FROM csm_step_history s "
+        "JOIN csm_step_node_history sn "
+            " ON s.allocation_id=sn.allocation_id AND s.step_id=sn.step_id "
+        "WHERE s.allocation_id = $1::bigint "
+        "GROUP BY s.allocation_id, s.step_id, s.num_nodes, s.end_time  "
+        "ORDER BY  end_time DESC, step_id ASC" ;
+
+    return stmt;
+}
+
+std::vector<int> CSMIAllocationQueryDetails::StepColumns( csm::db::DBResult_sptr dbRes )
+{
+    std::vector<int> columns;
+    #define CSMI_VERSION_START(version)
+    #define CSMI_VERSION_END(hash)
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, extra) \
+        columns.push_back( dbRes->GetFieldNumber( #name ) );
+    #include "csmi/include/csm_types/struct_defs/wm/csmi_allocation_step_list.def"
+    #undef CSMI_STRUCT_NAME
+    return columns;
+}
+
 bool CSMIAllocationQueryDetails::CreateByteArray(
         const std::vector<csm::db::DBTuple *>&tuples,
         char **buf, uint32_t &bufLen,
@@ -576,6 +597,38 @@ bool CSMIAllocationQueryDetails::CreateByteArray(
 {
 	LOG( csmapi, trace ) << STATE_NAME ":CreateByteArray: Enter";
 
+    bool success = SerializeSteps( tuples.size(),
+        [&]( uint32_t i, csmi_allocation_step_list_t **step ) { CreateOutputStruct( tuples[i], step ); },
+        buf, bufLen, ctx );
+
+    LOG( csmapi, trace ) << STATE_NAME ":CreateByteArray: Exit";
+    return success;
+}
+
+bool CSMIAllocationQueryDetails::CreateByteArrayFromResult(
+        csm::db::DBResult_sptr dbRes,
+        char **buf, uint32_t &bufLen,
+        csm::daemon::EventContextHandlerState_sptr& ctx )
+{
+	LOG( csmapi, trace ) << STATE_NAME ":CreateByteArrayFromResult: Enter";
+
+    // Look up the column of each struct member once for the whole result.
+    std::vector<int> columns = StepColumns( dbRes );
+
+    bool success = SerializeSteps( dbRes->GetNumOfTuples(),
+        [&]( uint32_t i, csmi_allocation_step_list_t **step ) { CreateOutputStruct( dbRes, i, columns, step ); },
+        buf, bufLen, ctx );
+
+    LOG( csmapi, trace ) << STATE_NAME ":CreateByteArrayFromResult: Exit";
+    return success;
+}
+
+bool CSMIAllocationQueryDetails::SerializeSteps(
+        uint32_t numSteps,
+        const std::function<void(uint32_t, csmi_allocation_step_list_t**)>& createStep,
+        char **buf, uint32_t &bufLen,
+        csm::daemon::EventContextHandlerState_sptr& ctx )
+{
     bool success = true;
     *buf = nullptr;
     bufLen = 0;
@@ -588,7 +641,7 @@ bool CSMIAllocationQueryDetails::CreateByteArray(
     if ( output )
     {
         csmi_allocation_details_t *ad = output->allocation_details;
-        ad->num_steps = tuples.size();
+        ad->num_steps = numSteps;
 
         if ( ad->num_steps )
         {
@@ -597,7 +650,7 @@ bool CSMIAllocationQueryDetails::CreateByteArray(
 
             for ( uint32_t i = 0; i < ad->num_steps; ++i )
             {
-                CreateOutputStruct( tuples[i], &(ad->steps[i]) );
+                createStep( i, &(ad->steps[i]) );
             }
         }
 
@@ -617,10 +670,35 @@ bool CSMIAllocationQueryDetails::CreateByteArray(
     dataLock.unlock();
     ctx->SetUserData(nullptr);
 
-    LOG( csmapi, trace ) << STATE_NAME ":CreateByteArray: Exit";
     return success;
 }
 
+void CSMIAllocationQueryDetails::CreateOutputStruct(
+        csm::db::DBResult_sptr dbRes,
+        int row,
+        const std::vector<int>& columns,
+        csmi_allocation_step_list_t  **output )
+{
+    LOG( csmapi, trace ) << STATE_NAME ":CreateOutputStruct: Enter";
+
+    csmi_allocation_step_list_t *o = nullptr;
+    csm_init_struct_ptr(csmi_allocation_step_list_t , o);
+
+    // Every member with a column of the same name in the result.
+    size_t c = 0;
+    #define CSMI_VERSION_START(version)
+    #define CSMI_VERSION_END(hash)
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, extra) \
+        if ( columns[c] >= 0 ) csm::daemon::helper::ReadResultField( dbRes, row, columns[c], o->name ); \
+        c++;
+    #include "csmi/include/csm_types/struct_defs/wm/csmi_allocation_step_list.def"
+    #undef CSMI_STRUCT_NAME
+
+    *output = o;
+
+    LOG( csmapi, trace ) << STATE_NAME ":CreateOutputStruct: Exit";
+}
+
 void CSMIAllocationQueryDetails::CreateOutputStruct(
         csm::db::DBTuple * const & fields, 
         csmi_allocation_step_list_t  **output )
@@ -17,6 +17,8 @@
 
 #include "csmi_stateful_db.h"
 
+#include <functional>
+
 class CSMIAllocationQueryDetails : public CSMIStatefulDB {
 
 public:
@@ -54,9 +56,36 @@ public:
         char **buf, uint32_t &bufLen,
         csm::daemon::EventContextHandlerState_sptr& ctx ) final;
 
+    virtual bool CreateByteArrayFromResult(
+        csm::db::DBResult_sptr dbRes,
+        char **buf, uint32_t &bufLen,
+        csm::daemon::EventContextHandlerState_sptr& ctx ) final;
+
     void CreateOutputStruct(
         csm::db::DBTuple * const & fields, 
         csmi_allocation_step_list_t **output );
+
+    static void CreateOutputStruct(
+        csm::db::DBResult_sptr dbRes,
+        int row,
+        const std::vector<int>& columns,
+        csmi_allocation_step_list_t **output );
+
+    /** @brief The query for the steps of an allocation, its columns are named after the
+     *      members of csmi_allocation_step_list_t. */
+    static const std::string& StepQuery();
+
+    /** @brief The column of each csmi_allocation_step_list_t member in @p dbRes, -1 if absent. */
+    static std::vector<int> StepColumns( csm::db::DBResult_sptr dbRes );
+
+private:
+    /** @brief Attaches the steps built by @p createStep to the details and packs them,
+     *      shared by the tuple and the result path. */
+    bool SerializeSteps(
+        uint32_t numSteps,
+        const std::function<void(uint32_t, csmi_allocation_step_list_t**)>& createStep,
+        char **buf, uint32_t &bufLen,
+        csm::daemon::EventContextHandlerState_sptr& ctx );
 };
 
 #endif
@@ -39,13 +39,11 @@ bool AllocStepCGCreateInitState::HandleNetworkMessage(
 
         try
         {
-            // Create all of the cgroups.
-            for( uint32_t i = 0; i < state_args->num_components; ++i )
-            {
-                cgroup.CreateCGroup( state_args->cgroup_name, 
-                                        state_args->components[i],
-                                        state_args->pid );
-            }
+            // Create all of the cgroups, the components are written in parallel.
+            cgroup.CreateCGroups( state_args->cgroup_name, 
+                                    state_args->components,
+                                    state_args->num_components,
+                                    state_args->pid );
         }
         catch(const csm::daemon::helper::CSMHandlerException& e)
         {
@@ -122,6 +122,7 @@ bool CSMINodeAttributesQuery::CreatePayload(
 	
 	// Build the parameterized list.
 	csm::db::DBReqContent *dbReq = new csm::db::DBReqContent(stmt, SQLparameterCount); 
+	dbReq->SetBinaryResults();
 	
 	if(input->comment[0]           != '\0') dbReq->AddTextParam        (input->comment);
 	if(input->node_names_count     > 0    ) dbReq->AddTextArrayParam   (input->node_names, input->node_names_count);
@@ -152,11 +153,49 @@ bool CSMINodeAttributesQuery::CreateByteArray(
 {
     LOG( csmapi, trace ) << STATE_NAME ":CreateByteArray: Enter";
 
+    SerializeRecords( tuples.size(), 
+        [&]( uint32_t i, DB_RECORD_STRUCT **record ) { CreateOutputStruct( tuples[i], record ); },
+        stringBuffer, bufferLength );
+    
+    LOG(csmapi, trace) << STATE_NAME ":CreateByteArray: Exit";
+
+    return true;
+}
+
+bool CSMINodeAttributesQuery::CreateByteArrayFromResult(
+        csm::db::DBResult_sptr dbRes,
+        char **stringBuffer,
+		uint32_t &bufferLength,
+        csm::daemon::EventContextHandlerState_sptr& ctx ) 
+{
+    LOG( csmapi, trace ) << STATE_NAME ":CreateByteArrayFromResult: Enter";
+
+    // Look up the column of each struct member once for the whole result.
+    std::vector<int> columns;
+    #define CSMI_VERSION_START(version)
+    #define CSMI_VERSION_END(hash)
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, extra) \
+        columns.push_back( dbRes->GetFieldNumber( #name ) );
+    #include "csmi/include/csm_types/struct_defs/inv/csmi_node_attributes_record.def"
+    #undef CSMI_STRUCT_NAME
+
+    SerializeRecords( dbRes->GetNumOfTuples(), 
+        [&]( uint32_t i, DB_RECORD_STRUCT **record ) { CreateOutputStruct( dbRes, i, columns, record ); },
+        stringBuffer, bufferLength );
+    
+    LOG(csmapi, trace) << STATE_NAME ":CreateByteArrayFromResult: Exit";
+
+    return true;
+}
+
+void CSMINodeAttributesQuery::SerializeRecords(
+    uint32_t numberOfRecords,
+    const std::function<void(uint32_t, DB_RECORD_STRUCT**)>& createRecord,
+    char **stringBuffer,
+    uint32_t &bufferLength )
+{
 	*stringBuffer = NULL;
     bufferLength = 0;
-	
-	/*Helper Variables*/
-	uint32_t numberOfRecords = tuples.size();
 
 	if(numberOfRecords > 0)
     {
@@ -172,19 +211,61 @@ bool CSMINodeAttributesQuery::CreateByteArray(
 		
 		/* Build the individual records for packing. */
 		for (uint32_t i = 0; i < numberOfRecords; i++){
-			CreateOutputStruct(tuples[i], &(output->results[i]));
+			createRecord(i, &(output->results[i]));
 		}
 		
-		// Pack the allocation up.
-		csm_serialize_struct(API_PARAMETER_OUTPUT_TYPE, output, stringBuffer, &bufferLength);
+		// Pack the allocation up, into the reply pack buffer of this thread.
+		ReplyPackBuffer& pack = GetReplyPackBuffer();
+		csm_serialize_struct_buffer(API_PARAMETER_OUTPUT_TYPE, output, &pack.Buffer, &bufferLength, &pack.Capacity);
+		*stringBuffer = pack.Buffer;
 		
 		// Free struct we made.
 		csm_free_struct_ptr(API_PARAMETER_OUTPUT_TYPE, output);
     }    
-    
-    LOG(csmapi, trace) << STATE_NAME ":CreateByteArray: Exit";
+}
 
-    return true;
+namespace csm {
+namespace daemon {
+namespace helper {
+
+inline void ReadResultField( csm::db::DBResult_sptr dbRes, int row, int col, csmi_node_state_t &value )
+{
+    value = (csmi_node_state_t)csm_get_enum_from_string(csmi_node_state_t, dbRes->GetValue(row, col));
+}
+
+inline void ReadResultField( csm::db::DBResult_sptr dbRes, int row, int col, csmi_node_type_t &value )
+{
+    value = (csmi_node_type_t)csm_get_enum_from_string(csmi_node_type_t, dbRes->GetValue(row, col));
+}
+
+} // End namespace helpers
+} // End namespace daemon
+} // End namespace csm
+
+void CSMINodeAttributesQuery::CreateOutputStruct(
+    csm::db::DBResult_sptr dbRes,
+    int row,
+    const std::vector<int>& columns,
+    DB_RECORD_STRUCT **output )
+{
+        LOG(csmapi, trace) << STATE_NAME ":CreateOutputStruct: Enter";
+
+        DB_RECORD_STRUCT *o = nullptr;
+        csm_init_struct_ptr(DB_RECORD_STRUCT, o);
+
+        // Every member with a column of the same name in the result, members not selected keep their init value.
+        size_t c = 0;
+        #define CSMI_VERSION_START(version)
+        #define CSMI_VERSION_END(hash)
+        #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, extra) \
+            if ( columns[c] >= 0 ) csm::daemon::helper::ReadResultField( dbRes, row, columns[c], o->name ); \
+            c++;
+        #include "csmi/include/csm_types/struct_defs/inv/csmi_node_attributes_record.def"
+        #undef CSMI_STRUCT_NAME
+
+        *output = o;
+
+        LOG(csmapi, trace) << STATE_NAME ":CreateOutputStruct: Exit";
 }
 
 void CSMINodeAttributesQuery::CreateOutputStruct(
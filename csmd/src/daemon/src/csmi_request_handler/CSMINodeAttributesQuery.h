@@ -17,6 +17,8 @@
 
 #include "csmi_stateful_db.h"
 
+#include <functional>
+
 class CSMINodeAttributesQuery : public CSMIStatefulDB { 
 
 public:
@@ -35,9 +37,29 @@ public:
 		uint32_t &bufferLength,
         csm::daemon::EventContextHandlerState_sptr& ctx ) final;
 
+    virtual bool CreateByteArrayFromResult(
+        csm::db::DBResult_sptr dbRes,
+        char **stringBuffer,
+		uint32_t &bufferLength,
+        csm::daemon::EventContextHandlerState_sptr& ctx ) final;
+
     void CreateOutputStruct(
         csm::db::DBTuple * const & fields,
         csmi_node_attributes_record_t ** output );
+
+    void CreateOutputStruct(
+        csm::db::DBResult_sptr dbRes,
+        int row,
+        const std::vector<int>& columns,
+        csmi_node_attributes_record_t ** output );
+
+private:
+    /** @brief Packs the records built by @p createRecord, shared by the tuple and the result path. */
+    void SerializeRecords(
+        uint32_t numberOfRecords,
+        const std::function<void(uint32_t, csmi_node_attributes_record_t**)>& createRecord,
+        char **stringBuffer,
+        uint32_t &bufferLength );
 };
 
 #endif
@@ -160,8 +160,10 @@ bool CSMINodeAttributesQueryHistory::CreateByteArray(
 			CreateOutputStruct(tuples[i], &(output->results[i]));
 		}
 		
-		// Pack the allocation up.
-		csm_serialize_struct(API_PARAMETER_OUTPUT_TYPE, output, stringBuffer, &bufferLength);
+		// Pack the allocation up, into the reply pack buffer of this thread.
+		ReplyPackBuffer& pack = GetReplyPackBuffer();
+		csm_serialize_struct_buffer(API_PARAMETER_OUTPUT_TYPE, output, &pack.Buffer, &bufferLength, &pack.Capacity);
+		*stringBuffer = pack.Buffer;
 		
 		// Free struct we made.
 		csm_free_struct_ptr(API_PARAMETER_OUTPUT_TYPE, output);
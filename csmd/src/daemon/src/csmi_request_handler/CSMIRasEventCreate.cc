@@ -59,7 +59,8 @@ bool string_to_bool(std::string s)
 
 CSMIRasEventCreate::CSMIRasEventCreate(csm::daemon::HandlerOptions &options) : 
     CSMI_BASE(CSM_CMD_ras_event_create, options ),
-    _csmDaemonConfig(nullptr)
+    _csmDaemonConfig(nullptr),
+    _rasCreateBatch(10, 250)
 {
     _initialized  = false;
 }
@@ -121,10 +122,20 @@ void CSMIRasEventCreate::onRasPoolExit(RasEvent &rasEvent,
        assert(rctx);                     // todo, some better error checking...
 
        rctx->_state = CSMIRasEventCreateContext::WRITE_RAS_EVENT;      // remember we did this so we dispose of things on completion...
-          
-       csm::db::DBReqContent dbcontent = getRasCreateDbReq(rasEvent);
-       csm::daemon::DBReqEvent *dbevent = new csm::daemon::DBReqEvent(dbcontent, csm::daemon::EVENT_TYPE_DB_Request, context);
-       postEventList.push_back(dbevent);
+
+       // Events that change the node state are written on their own, everything else
+       // is coalesced with the events arriving within the batch window
+       string set_state = rasEvent.getValue(CSM_RAS_FKEY_SET_STATE);
+       if ((set_state == CSM_NODE_STATE_SOFT_FAILURE) || (set_state == CSM_NODE_STATE_HARD_FAILURE))
+       {
+          csm::db::DBReqContent dbcontent = getRasCreateDbReq(rasEvent);
+          csm::daemon::DBReqEvent *dbevent = new csm::daemon::DBReqEvent(dbcontent, csm::daemon::EVENT_TYPE_DB_Request, context);
+          postEventList.push_back(dbevent);
+       }
+       else
+       {
+          queueRasCreate(ctxId, aEvent, postEventList);
+       }
        db_write_resp_pending = true; 
        
        logSyslog(rasEvent);
@@ -180,6 +191,28 @@ void CSMIRasEventCreate::returnErrorMsg(csm::network::Address_sptr addr,
 
 }
 
+void CSMIRasEventCreate::returnSuccessMsg(csm::network::Address_sptr addr,
+                                          csm::network::Message& inMsg,
+                                          std::vector<csm::daemon::CoreEvent*>& postEventList)
+{
+    LOG(csmras, trace) << "Enter " << __PRETTY_FUNCTION__;
+
+    const char *buf="";      // return null response...
+    uint32_t bufLen=0;
+    uint8_t flags = CSM_HEADER_RESP_BIT;
+
+    csm::network::Message rspMsg;
+    CreateNetworkMessage(inMsg, buf, bufLen, flags, rspMsg);
+    csm::network::Address_sptr rspAddress = CreateReplyAddress(addr.get());
+
+    if (rspAddress) {
+      csm::network::MessageAndAddress netcontent( rspMsg, rspAddress );
+      csm::daemon::NetworkEvent *netEvent = new csm::daemon::NetworkEvent(netcontent,
+                                              csm::daemon::EVENT_TYPE_NETWORK);
+      postEventList.push_back(netEvent);
+    }
+}
+
 RasRc CSMIRasEventCreate::decodeRasEvent(csm::network::MessageAndAddress content, 
                                          RasEvent &rasEvent)
 {
@@ -405,6 +438,73 @@ RasRc CSMIRasEventCreate::processMsgTypeDbRes(csm::db::DBResult_sptr dbRes,
     return rc;
 }
     
+// Generate SQL to read the current state for the node matching location_name, if applicable.
+// Used instead of getMsgTypeDbReq() when the csm_ras_type data for the msg_id is cached.
+csm::db::DBReqContent CSMIRasEventCreate::getNodeStateDbReq(const std::string &location_name)
+{
+    const char *sqlStmt = "SELECT state FROM csm_node WHERE node_name = $1::text;";
+
+    LOG(csmras, debug) << "CSMIRasEventCreate::getNodeStateDbReq: " << sqlStmt;
+
+    // $1::text = location_name
+    const uint32_t SQL_PARAM_COUNT(1);
+    csm::db::DBReqContent dbcontent(sqlStmt, SQL_PARAM_COUNT);
+    dbcontent.AddTextParam(location_name.c_str());
+
+    return dbcontent;
+}
+
+RasRc CSMIRasEventCreate::processNodeStateDbRes(csm::db::DBResult_sptr dbRes,
+                                                std::string &node_state)
+{
+    LOG(csmras, trace) << "Enter " << __PRETTY_FUNCTION__;
+
+    RasRc rc = RasRc(CSMI_SUCCESS);
+    node_state="";
+
+    std::vector<csm::db::DBTuple *> tuples;
+    GetTuplesFromDBResult(dbRes, tuples);
+
+    // expected data is either:
+    // 0 rows -> location_name does not match any nodes in csm_node table
+    // 1 row with the state field -> location_name matched a node in the csm_node table
+    if (tuples.size() > 1)
+    {
+        rc = RasRc(CSMERR_DB_ERROR, "invalid row count");
+    }
+    else if (tuples.size() == 1)
+    {
+        if (tuples[0]->nfields == 1)
+        {
+            node_state = tuples[0]->data[0];
+        }
+        else
+        {
+            rc = RasRc(CSMERR_DB_ERROR, "invalid field count");
+        }
+    }
+
+    for (uint32_t i=0;i<tuples.size();i++) csm::db::DB_TupleFree(tuples[i]);
+    return rc;
+}
+
+void CSMIRasEventCreate::setMsgTypeValues(RasEvent &rasEvent, const RasMessageTypeRec &rec)
+{
+    // transfer rec fields to RasEvent...
+    rasEvent.setValue(CSM_RAS_FKEY_MSG_ID,   rec._msg_id);
+    rasEvent.setValue(CSM_RAS_FKEY_SEVERITY,   rec._severity);
+    rasEvent.setValue(CSM_RAS_FKEY_MESSAGE,    rec._message);
+    rasEvent.setValue(CSM_RAS_FKEY_CONTROL_ACTION,  rec._control_action);
+    rasEvent.setValue(CSM_RAS_FKEY_DESCRIPTION,  rec._description);
+
+    rasEvent.setThresholdCount(rec._threshold_count);
+    rasEvent.setThresholdPeriod(rec._threshold_period);
+
+    rasEvent.setValue(CSM_RAS_FKEY_ENABLED, bool_to_string(rec._enabled));
+    rasEvent.setValue(CSM_RAS_FKEY_SET_STATE,  rec._set_state);
+    rasEvent.setValue(CSM_RAS_FKEY_VISIBLE_TO_USERS,  bool_to_string(rec._visible_to_users));
+}
+
 csm::db::DBReqContent CSMIRasEventCreate::getRasCreateDbReq(RasEvent &rasEvent)
 {
     LOG(csmras, trace) << "Enter " << __PRETTY_FUNCTION__;
@@ -527,6 +627,138 @@ csm::db::DBReqContent CSMIRasEventCreate::getRasCreateDbReq(RasEvent &rasEvent)
     return dbcontent;
 }
 
+/**
+ * Append one element to a postgres array literal, NULL if the event has no value for the key.
+ */
+static void appendArrayElement(std::string &array, RasEvent &rasEvent, const std::string &key)
+{
+    if (array.size() > 1) array.push_back(',');
+
+    if (!rasEvent.hasValue(key))
+    {
+        array.append("NULL");
+        return;
+    }
+
+    array.push_back('"');
+    for (char c : rasEvent.getValue(key))
+    {
+        if ((c == '"') || (c == '\\')) array.push_back('\\');
+        array.push_back(c);
+    }
+    array.push_back('"');
+}
+
+/**
+ * Generate the SQL to insert a batch of events into the csm_ras_event_action table.
+ * 
+ * The events are passed as one array per column and inserted with a single
+ * INSERT ... SELECT FROM unnest(), so the statement and its parameter count
+ * do not depend on the number of events.
+ * 
+ * @param ctxIds The context ids of the events to write.
+ */
+csm::db::DBReqContent CSMIRasEventCreate::getRasBatchCreateDbReq(const std::vector<uint64_t> &ctxIds)
+{
+    LOG(csmras, trace) << "Enter " << __PRETTY_FUNCTION__;
+
+    string msg_ids("{");
+    string location_names("{");
+    string counts("{");
+    string time_stamps("{");
+    string messages("{");
+    string kvcsvs("{");
+    string raw_datas("{");
+
+    for (std::vector<uint64_t>::const_iterator it = ctxIds.begin(); it != ctxIds.end(); ++it)
+    {
+        RasEvent &rasEvent = *(_contextMap[*it]->_rasEvent);
+
+        appendArrayElement(msg_ids, rasEvent, CSM_RAS_FKEY_MSG_ID);
+        appendArrayElement(location_names, rasEvent, CSM_RAS_FKEY_LOCATION_NAME);
+        if (counts.size() > 1) counts.push_back(',');
+        counts.append(std::to_string(rasEvent.getCount()));
+        appendArrayElement(time_stamps, rasEvent, CSM_RAS_FKEY_TIME_STAMP);
+        appendArrayElement(messages, rasEvent, CSM_RAS_FKEY_MESSAGE);
+        appendArrayElement(kvcsvs, rasEvent, CSM_RAS_FKEY_KVCSV);
+        appendArrayElement(raw_datas, rasEvent, CSM_RAS_FKEY_RAW_DATA);
+    }
+
+    msg_ids.push_back('}');
+    location_names.push_back('}');
+    counts.push_back('}');
+    time_stamps.push_back('}');
+    messages.push_back('}');
+    kvcsvs.push_back('}');
+    raw_datas.push_back('}');
+
+    const char *sqlStmt =
+        "INSERT INTO csm_ras_event_action "
+            "(msg_id_seq,master_time_stamp,msg_id,location_name,count,time_stamp,message,kvcsv,raw_data) "
+        "SELECT "
+            "(select msg_id_seq from csm_ras_type_audit where csm_ras_type_audit.msg_id = e.msg_id "
+                "order by change_time desc limit 1),"
+            "now(),e.msg_id,e.location_name,e.count,e.time_stamp,e.message,e.kvcsv,e.raw_data "
+        "FROM unnest($1::text[],$2::text[],$3::int[],$4::timestamp[],$5::text[],$6::text[],$7::text[]) "
+            "AS e(msg_id,location_name,count,time_stamp,message,kvcsv,raw_data);";
+
+    LOG(csmras, debug) << "CSMIRasEventCreate::getRasBatchCreateDbReq: " << ctxIds.size() << " events: " << sqlStmt;
+
+    const uint32_t SQL_PARAM_COUNT(7);
+    csm::db::DBReqContent dbcontent(sqlStmt, SQL_PARAM_COUNT);
+    dbcontent.AddTextParam(msg_ids.c_str());
+    dbcontent.AddTextParam(location_names.c_str());
+    dbcontent.AddTextParam(counts.c_str());
+    dbcontent.AddTextParam(time_stamps.c_str());
+    dbcontent.AddTextParam(messages.c_str());
+    dbcontent.AddTextParam(kvcsvs.c_str());
+    dbcontent.AddTextParam(raw_datas.c_str());
+
+    return dbcontent;
+}
+
+/**
+ * Queue an event for the next batch insert.
+ *  
+ * The batch is written once it holds csm.ras.batch.max_events events or when the 
+ * batch window timer started by the first queued event expires. 
+ */
+void CSMIRasEventCreate::queueRasCreate(uint64_t ctxId,
+                                        const csm::daemon::CoreEvent &aEvent,
+                                        std::vector<csm::daemon::CoreEvent*>& postEventList)
+{
+    switch (_rasCreateBatch.queue(ctxId))
+    {
+        case RasEventBatch::WRITE:
+            flushRasCreates(aEvent, postEventList);
+            break;
+        case RasEventBatch::ARM_TIMER:
+            postEventList.push_back( CreateTimerEvent( _rasCreateBatch.window(), this) );
+            break;
+        default:
+            break;
+    }
+}
+
+void CSMIRasEventCreate::flushRasCreates(const csm::daemon::CoreEvent &aEvent,
+                                         std::vector<csm::daemon::CoreEvent*>& postEventList)
+{
+    std::vector<uint64_t> batch;
+    if (!_rasCreateBatch.take(batch))
+        return;
+
+    csm::daemon::EventContext_sptr context(new csm::daemon::EventContext(this, CreateCtxAuxId(), CopyEvent(aEvent)));
+
+    shared_ptr<CSMIRasEventCreateContext> bctx(new CSMIRasEventCreateContext());
+    bctx->_state = CSMIRasEventCreateContext::WRITE_RAS_EVENT_BATCH;
+    bctx->_batch.swap(batch);
+    _contextMap[context->GetAuxiliaryId()] = bctx;
+
+    csm::db::DBReqContent dbcontent = getRasBatchCreateDbReq(bctx->_batch);
+    csm::daemon::DBReqEvent *dbevent = new csm::daemon::DBReqEvent(dbcontent, csm::daemon::EVENT_TYPE_DB_Request, context);
+    postEventList.push_back(dbevent);
+}
+
 
 
 /**
@@ -591,7 +823,33 @@ void CSMIRasEventCreate::Process( const csm::daemon::CoreEvent &aEvent,
 
         LOG(csmras, info) << "NEW RAS EVENT        " << rctx->_rasEvent->getLogString();
 
-        csm::db::DBReqContent dbcontent = getMsgTypeDbReq(rasEvent->getValue(CSM_RAS_FKEY_MSG_ID), rasEvent->getValue(CSM_RAS_FKEY_LOCATION_NAME));
+        // If the csm_ras_type data for the msg_id is cached, only the node state has to be read,
+        // and disabled events need no database access at all
+        RasMessageTypeRec rec;
+        bool msgTypeCached = g_ras_master.getMsgType(rasEvent->getValue(CSM_RAS_FKEY_MSG_ID), rec);
+        if (msgTypeCached)
+        {
+            if (!rec._enabled)
+            {
+                setMsgTypeValues(*rasEvent, rec);
+                LOG(csmras, info) << "RAS EVENT DISABLED   " << rctx->_rasEvent->getLogString(); 
+                _contextMap.erase(context->GetAuxiliaryId());    // Finished processing this event, remove the rctx context
+
+                if (! content._Msg.GetInt() )
+                    returnSuccessMsg(content.GetAddr(), content._Msg, postEventList);
+                return;
+            }
+            rctx->_msgType = rec;
+            rctx->_state = CSMIRasEventCreateContext::READ_NODE_STATE;
+        }
+        else
+        {
+            rctx->_msgTypeGeneration = g_ras_master.getMsgTypeGeneration();
+        }
+
+        csm::db::DBReqContent dbcontent = msgTypeCached ?
+            getNodeStateDbReq(rasEvent->getValue(CSM_RAS_FKEY_LOCATION_NAME)) :
+            getMsgTypeDbReq(rasEvent->getValue(CSM_RAS_FKEY_MSG_ID), rasEvent->getValue(CSM_RAS_FKEY_LOCATION_NAME));
         csm::daemon::DBReqEvent *dbevent = new csm::daemon::DBReqEvent(dbcontent, csm::daemon::EVENT_TYPE_DB_Request, context);
         postEventList.push_back(dbevent);
         return;
@@ -631,7 +889,8 @@ void CSMIRasEventCreate::Process( const csm::daemon::CoreEvent &aEvent,
             //int errcode = CSMI_SUCCESS;
             csm::db::DBRespContent dbResp = *(csm::db::DBRespContent*) &content;
                 
-            if (rctx->_state == CSMIRasEventCreateContext::READ_EVENT_TYPE) 
+            if ((rctx->_state == CSMIRasEventCreateContext::READ_EVENT_TYPE) ||
+                (rctx->_state == CSMIRasEventCreateContext::READ_NODE_STATE))
             {
                 LOG(csmras, debug) << "RAS EVENT DB RD RESP " << rctx->_rasEvent->getLogString(); 
                 
@@ -654,23 +913,21 @@ void CSMIRasEventCreate::Process( const csm::daemon::CoreEvent &aEvent,
                 RasMessageTypeRec rec;
                 string node_state("");
                 if (rasRc._rc == CSMI_SUCCESS) {
-                    rasRc = processMsgTypeDbRes(dbRes, rec, node_state);
+                    if (rctx->_state == CSMIRasEventCreateContext::READ_NODE_STATE)
+                    {
+                        rec = rctx->_msgType;
+                        rasRc = processNodeStateDbRes(dbRes, node_state);
+                    }
+                    else
+                    {
+                        rasRc = processMsgTypeDbRes(dbRes, rec, node_state);
+                        if (rasRc._rc == CSMI_SUCCESS)
+                            g_ras_master.setMsgType(rec, rctx->_msgTypeGeneration);
+                    }
                 }
     
                 if (rasRc._rc == CSMI_SUCCESS) {
-                    // transfer rec fields to RasEvent...
-                    rasEvent.setValue(CSM_RAS_FKEY_MSG_ID,   rec._msg_id);
-                    rasEvent.setValue(CSM_RAS_FKEY_SEVERITY,   rec._severity);
-                    rasEvent.setValue(CSM_RAS_FKEY_MESSAGE,    rec._message);
-                    rasEvent.setValue(CSM_RAS_FKEY_CONTROL_ACTION,  rec._control_action);
-                    rasEvent.setValue(CSM_RAS_FKEY_DESCRIPTION,  rec._description);
-                    
-                    rasEvent.setThresholdCount(rec._threshold_count);
-                    rasEvent.setThresholdPeriod(rec._threshold_period);
-                    
-                    rasEvent.setValue(CSM_RAS_FKEY_ENABLED, bool_to_string(rec._enabled));
-                    rasEvent.setValue(CSM_RAS_FKEY_SET_STATE,  rec._set_state);
-                    rasEvent.setValue(CSM_RAS_FKEY_VISIBLE_TO_USERS,  bool_to_string(rec._visible_to_users));
+                    setMsgTypeValues(rasEvent, rec);
  
                     // next, do the ras handler chain...
                     
@@ -718,39 +975,69 @@ void CSMIRasEventCreate::Process( const csm::daemon::CoreEvent &aEvent,
                 }
 
                 // finally, ready to construct a network event
-                int errcode = CSMI_SUCCESS;
-
                 csm::daemon::NetworkEvent *ev = (csm::daemon::NetworkEvent *)reqEvent;
                 csm::network::MessageAndAddress content = ev->GetContent();
                 // check to see if this is daemon to daemon or back to to the CSMapi.
                 //     only reply if the return is for CSMapi.
                 if (! content._Msg.GetInt() ) 
                 {
-                    const char *buf="";      // return null response...
-                    uint32_t bufLen=0;
-                    uint8_t flags = CSM_HEADER_RESP_BIT;
-                    if (errcode != CSMI_SUCCESS) flags |= CSM_HEADER_ERR_BIT;;
-
-                    csm::network::Message rspMsg;
-                    CreateNetworkMessage(content._Msg, buf, bufLen, flags, rspMsg);
-                    csm::network::Address_sptr rspAddress = CreateReplyAddress(content.GetAddr().get());
-
-                    if (rspAddress) {
-                      csm::network::MessageAndAddress netcontent( rspMsg, rspAddress );
-                      csm::daemon::NetworkEvent *netEvent = new csm::daemon::NetworkEvent(netcontent,
-                                                              csm::daemon::EVENT_TYPE_NETWORK);
-                      postEventList.push_back(netEvent);
-                      //delete rspAddress;
-                    }
+                    returnSuccessMsg(content.GetAddr(), content._Msg, postEventList);
                 }
 
             }
             else if (rctx->_state == CSMIRasEventCreateContext::WRITE_RAS_EVENT) 
             {
+                csm::db::DBResult_sptr dbRes = dbResp.GetDBResult();
                 LOG(csmras, debug) << "RAS EVENT DB WR RESP " << rctx->_rasEvent->getLogString(); 
-                LOG(csmras, info) << "RAS EVENT COMPLETE   " << rctx->_rasEvent->getLogString(); 
+                if ((dbRes == nullptr) || (dbRes->GetResStatus() != csm::db::DB_SUCCESS))
+                {
+                    LOG(csmras, error) << "RAS EVENT ERROR      " << rctx->_rasEvent->getLogString() << " errstr:"
+                                       << (dbRes == nullptr ? std::string("No Database Connection") : dbRes->GetErrMsg());
+                }
+                else
+                {
+                    LOG(csmras, info) << "RAS EVENT COMPLETE   " << rctx->_rasEvent->getLogString(); 
+                }
                 _contextMap.erase(ctx->GetAuxiliaryId());    // Finished processing this event, remove the rctx context
             }
+            else if (rctx->_state == CSMIRasEventCreateContext::WRITE_RAS_EVENT_BATCH) 
+            {
+                csm::db::DBResult_sptr dbRes = dbResp.GetDBResult();
+                bool failed = ((dbRes == nullptr) || (dbRes->GetResStatus() != csm::db::DB_SUCCESS));
+                if (failed)
+                {
+                    // One bad row fails the whole insert, write the events one at a time so only that row is lost
+                    LOG(csmras, warning) << "RAS EVENT BATCH of " << rctx->_batch.size() << " events could not be written, retrying each event: "
+                                         << (dbRes == nullptr ? std::string("No Database Connection") : dbRes->GetErrMsg());
+                }
+
+                std::vector<uint64_t> complete;
+                std::vector<uint64_t> retry;
+                RasEventBatch::written(rctx->_batch, failed, complete, retry);
+
+                for (std::vector<uint64_t>::iterator it = complete.begin(); it != complete.end(); ++it)
+                {
+                    std::map<uint64_t, std::shared_ptr<CSMIRasEventCreateContext> >::iterator ectx = _contextMap.find(*it);
+                    if (ectx != _contextMap.end())
+                    {
+                        LOG(csmras, info) << "RAS EVENT COMPLETE   " << ectx->second->_rasEvent->getLogString(); 
+                        _contextMap.erase(ectx);
+                    }
+                }
+                for (std::vector<uint64_t>::iterator it = retry.begin(); it != retry.end(); ++it)
+                {
+                    std::map<uint64_t, std::shared_ptr<CSMIRasEventCreateContext> >::iterator ectx = _contextMap.find(*it);
+                    if (ectx != _contextMap.end())
+                    {
+                        // The event context is still in the WRITE_RAS_EVENT state
+                        csm::daemon::EventContext_sptr econtext(new csm::daemon::EventContext(this, *it, CopyEvent(aEvent)));
+                        csm::db::DBReqContent dbcontent = getRasCreateDbReq(*(ectx->second->_rasEvent));
+                        csm::daemon::DBReqEvent *dbevent = new csm::daemon::DBReqEvent(dbcontent, csm::daemon::EVENT_TYPE_DB_Request, econtext);
+                        postEventList.push_back(dbevent);
+                    }
+                }
+                _contextMap.erase(ctx->GetAuxiliaryId());    // Finished processing this batch, remove the batch context
+            }
             else 
             {
                 // TODO: detect and log db errors here...
@@ -761,6 +1048,10 @@ void CSMIRasEventCreate::Process( const csm::daemon::CoreEvent &aEvent,
         }
     }
     else if (isTimerEvent(aEvent)) {
+        // Write the events queued during the batch window
+        _rasCreateBatch.timerExpired();
+        flushRasCreates(aEvent, postEventList);
+
         std::vector<std::shared_ptr<RasEvent> > expiredEvents;
         time_t t = _rasEventPool.TimerExpired(expiredEvents);
 
@@ -831,6 +1122,10 @@ void CSMIRasEventCreate::init() {
         _handleAction.setMaxActions(maxActions);
         _handleAction.setActionTimeout(actionTimeout);
 
+        _rasCreateBatch.configure(csmConfig->get<uint64_t>("csm.ras.batch.window", 10),
+                                  csmConfig->get<uint32_t>("csm.ras.batch.max_events", 250));
+        g_ras_master.setMsgTypeTimeout(csmConfig->get<uint32_t>("csm.ras.msg_type_cache_timeout", 60));
+
     }
     else {
         LOG(csmras, error) << "CSMIRasEventCreate::init csmConfig";
@@ -19,6 +19,7 @@
 #include <boost/thread.hpp>
 #include <map>
 #include <sstream>
+#include <vector>
 #include "csmi_base.h"
 #include <csmd/src/ras/include/RasMessageTypeRec.h>
 #include <csmd/src/ras/include/RasEventHandlerChain.h>
@@ -27,6 +28,7 @@
 #include <csmd/src/ras/include/RasEventPool.h>
 #include <csmd/src/ras/include/RasEventThreshold.h>
 #include <csmd/src/ras/include/RasEventLog.h>
+#include <csmd/src/ras/include/RasEventBatch.h>
 
 
 
@@ -34,15 +36,21 @@ class CSMIRasEventCreateContext
 {
 public:
     CSMIRasEventCreateContext():
-        _state(NO_STATE) {};
+        _state(NO_STATE),
+        _msgTypeGeneration(0) {};
 
     enum {
         NO_STATE,
         READ_EVENT_TYPE,
-        WRITE_RAS_EVENT
+        READ_NODE_STATE,            // csm_ras_type row was cached, only the node state is read
+        WRITE_RAS_EVENT,
+        WRITE_RAS_EVENT_BATCH       // one insert for the events of _batch
     };
     std::shared_ptr<RasEvent> _rasEvent;
     unsigned _state;
+    RasMessageTypeRec _msgType;
+    uint64_t _msgTypeGeneration;
+    std::vector<uint64_t> _batch;   // context ids of the events written by a batch
 };
 
 
@@ -60,6 +68,9 @@ protected:
                         int errcode,
                         const std::string &errmsg,
                         std::vector<csm::daemon::CoreEvent*>& postEventList);
+    void returnSuccessMsg(csm::network::Address_sptr addr,
+                          csm::network::Message& inMsg,
+                          std::vector<csm::daemon::CoreEvent*>& postEventList);
     RasRc decodeRasEvent(csm::network::MessageAndAddress content, 
                          RasEvent &rasEvent);
 
@@ -68,11 +79,27 @@ protected:
     RasRc processMsgTypeDbRes(csm::db::DBResult_sptr dbRes,
                               RasMessageTypeRec &rec,
                               std::string &node_state);  
+
+    csm::db::DBReqContent getNodeStateDbReq(const std::string &location_name);
+
+    RasRc processNodeStateDbRes(csm::db::DBResult_sptr dbRes,
+                                std::string &node_state);
+
+    void setMsgTypeValues(RasEvent &rasEvent, const RasMessageTypeRec &rec);
  
     std::string trim(const std::string& str);
 
     csm::db::DBReqContent getRasCreateDbReq(RasEvent &rasEvent);
 
+    csm::db::DBReqContent getRasBatchCreateDbReq(const std::vector<uint64_t> &ctxIds);
+
+    void queueRasCreate(uint64_t ctxId,
+                        const csm::daemon::CoreEvent &aEvent,
+                        std::vector<csm::daemon::CoreEvent*>& postEventList);
+
+    void flushRasCreates(const csm::daemon::CoreEvent &aEvent,
+                         std::vector<csm::daemon::CoreEvent*>& postEventList);
+
     void logSyslog(RasEvent &rasEvent);
 
     void onRasPoolExit(RasEvent &rasEvent,
@@ -98,6 +125,9 @@ private:
     std::map<uint64_t, std::shared_ptr<CSMIRasEventCreateContext> > _contextMap;
     boost::mutex _ctxMutex;
 
+    // Events waiting to be written by the next batch insert
+    RasEventBatch _rasCreateBatch;
+
 
 public:
   virtual int GetRespData(const std::string& argument,
@@ -284,7 +284,10 @@ bool CSMIRasEventQuery::CreateByteArray(
 			output->results[n] = rcsm_ras;
 		}
 
-		csm_serialize_struct(API_PARAMETER_OUTPUT_TYPE, output, stringBuffer, &bufferLength);
+		// Pack into the reply pack buffer of this thread, it is kept for the next reply.
+		ReplyPackBuffer& pack = GetReplyPackBuffer();
+		csm_serialize_struct_buffer(API_PARAMETER_OUTPUT_TYPE, output, &pack.Buffer, &bufferLength, &pack.Capacity);
+		*stringBuffer = pack.Buffer;
 		csm_free_struct_ptr(API_PARAMETER_OUTPUT_TYPE, output);
 	}
         
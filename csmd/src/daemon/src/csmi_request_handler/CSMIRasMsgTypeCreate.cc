@@ -20,6 +20,7 @@
 /* ## INCLUDES ## */
 /* Header for this file. */
 #include "CSMIRasMsgTypeCreate.h"
+#include <csmd/src/ras/include/RasMaster.h>
 /* ## DEFINES ## */
 //Used for debug prints
 #define STATE_NAME "CSMIRasMsgTypeCreate:"
@@ -200,6 +201,9 @@ bool CSMIRasMsgTypeCreate::CreateByteArray(
     *stringBuffer = NULL;
     bufferLength = 0;
 
+    // The csm_ras_type table changed, drop the message types cached for CSMIRasEventCreate
+    g_ras_master.invalidateMsgTypes();
+
     uint32_t numberOfInsertedRecords = tuples.size();
 
     if(numberOfInsertedRecords == 0)
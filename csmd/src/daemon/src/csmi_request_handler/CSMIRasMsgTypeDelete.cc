@@ -20,6 +20,7 @@
 /* ## INCLUDES ## */
 /* Header for this file. */
 #include "CSMIRasMsgTypeDelete.h"
+#include <csmd/src/ras/include/RasMaster.h>
 /* ## DEFINES ## */
 //Used for debug prints
 #define STATE_NAME "CSMIRasMsgTypeDelete:"
@@ -97,6 +98,9 @@ bool CSMIRasMsgTypeDelete::CreateByteArray(
     
 	*stringBuffer = NULL;
     bufferLength = 0;
+
+    // The csm_ras_type table changed, drop the message types cached for CSMIRasEventCreate
+    g_ras_master.invalidateMsgTypes();
 	
 	/*If we want to return stuff*/
 	/*Implement code here*/
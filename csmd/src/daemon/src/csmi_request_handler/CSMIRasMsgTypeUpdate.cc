@@ -20,6 +20,7 @@
 /* ## INCLUDES ## */
 /* Header for this file. */
 #include "CSMIRasMsgTypeUpdate.h"
+#include <csmd/src/ras/include/RasMaster.h>
 /* ## DEFINES ## */
 //Used for debug prints
 #define STATE_NAME "CSMIRasMsgTypeUpdate:"
@@ -161,6 +162,9 @@ bool CSMIRasMsgTypeUpdate::CreateByteArray(
     *stringBuffer = NULL;
     bufferLength = 0;
 
+    // The csm_ras_type table changed, drop the message types cached for CSMIRasEventCreate
+    g_ras_master.invalidateMsgTypes();
+
     uint32_t numberOfInsertedRecords = tuples.size();
 
     if(numberOfInsertedRecords == 0)
@@ -15,6 +15,7 @@
 #include <sys/resource.h>
 
 #include "csm_ctrl_cmd_handler.h"
+#include "include/csm_metrics.h"
 
 #include "logging.h"
 
@@ -84,6 +85,11 @@ void CSM_CTRL_CMD_HANDLER::Process( const csm::daemon::CoreEvent &aEvent,
     reply_payload.append( GetDaemonState()->DumpMapSize() );
   }
 
+  if (option.get_dump_metrics())
+  {
+    reply_payload.append( csm::daemon::Metrics::Instance().Dump() );
+  }
+
   if( option.get_agg_reset() )
   {
     LOG( csmd, info ) << "Resetting Primary aggregator on user request.";
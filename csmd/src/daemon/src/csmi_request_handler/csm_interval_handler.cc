@@ -22,6 +22,9 @@
 #include "helpers/EventHelpers.h"
 #include "csmd/include/csm_daemon_config.h"
 #include "csmi/include/csm_api.h"
+#include "include/csm_metrics.h"
+
+#include <sys/time.h>
 //#incllude "csmd/src/daemon/include/csm_recurring_tasks.h"
 
 
@@ -34,40 +37,77 @@ CSM_INTERVAL_HANDLER::Process( const csm::daemon::CoreEvent &aEvent,
     // Get the config.
     csm::daemon::RecurringTasks RT = csm::daemon::Configuration::Instance()->GetRecurringTasks();
 
+    // The handler triggers at the common interval, each task runs when its own interval is up.
+    uint64_t elapsed = ++_Ticks * RT.GetMinInterval();
+
     // Create an event for Soft Failure.
     csm::daemon::SoftFailRecovery_t sfRec = RT.GetSoftFailRecovery();
-    if ( sfRec._Enabled )
-    {
-        // Construct the buffer.
-        char *buffer = nullptr;
-        uint32_t bufferLen = 0;
+    if ( sfRec._Enabled && ( elapsed % sfRec._Interval == 0 ))
+        SoftFailureRecovery( sfRec, postEventList );
 
-        csm_soft_failure_recovery_input_t sfInput;
-        csm_init_struct_versioning(&sfInput);
-        sfInput.retry_count = sfRec._Retry;
+    csm::daemon::MetricsExport_t metrics = RT.GetMetricsExport();
+    if ( metrics._Enabled && ( elapsed % metrics._Interval == 0 ))
+        ExportMetrics( postEventList );
+}
 
-        csm_serialize_struct( csm_soft_failure_recovery_input_t, &sfInput, &buffer, &bufferLen );
+void
+CSM_INTERVAL_HANDLER::SoftFailureRecovery( const csm::daemon::SoftFailRecovery_t &sfRec,
+                                           std::vector<csm::daemon::CoreEvent*>& postEventList )
+{
+    // Construct the buffer.
+    char *buffer = nullptr;
+    uint32_t bufferLen = 0;
 
-        if( buffer == nullptr )
-        {
-          CSMLOG( csmd, info ) << "INTERVAL: soft_failure data serialization failed. Skipping.";
-          return;
-        }
+    csm_soft_failure_recovery_input_t sfInput;
+    csm_init_struct_versioning(&sfInput);
+    sfInput.retry_count = sfRec._Retry;
 
-        // Construct the message with a random messageID and a SELF send.
-        csm::network::AddressAbstract_sptr sfAddr =
-            std::make_shared<csm::network::AddressAbstract>(csm::network::ABSTRACT_ADDRESS_SELF);
+    csm_serialize_struct( csm_soft_failure_recovery_input_t, &sfInput, &buffer, &bufferLen );
 
-        uint32_t msgID = random();
-        csm::network::Message sfMessage;
-        sfMessage.Init( CSM_CMD_soft_failure_recovery, 0, CSM_PRIORITY_DEFAULT,
-            msgID, 0x1234, 0x4321, geteuid(), getegid(), std::string(buffer, bufferLen) );
+    if( buffer == nullptr )
+    {
+      CSMLOG( csmd, info ) << "INTERVAL: soft_failure data serialization failed. Skipping.";
+      return;
+    }
 
-        // Make sure the buffer is totally free.
-        if ( buffer )
-            free(buffer);
+    // Construct the message with a random messageID and a SELF send.
+    csm::network::AddressAbstract_sptr sfAddr =
+        std::make_shared<csm::network::AddressAbstract>(csm::network::ABSTRACT_ADDRESS_SELF);
 
-        // Push the Network event.
-        postEventList.push_back(csm::daemon::helper::CreateNetworkEvent(sfMessage,sfAddr));
-    }
+    uint32_t msgID = random();
+    csm::network::Message sfMessage;
+    sfMessage.Init( CSM_CMD_soft_failure_recovery, 0, CSM_PRIORITY_DEFAULT,
+        msgID, 0x1234, 0x4321, geteuid(), getegid(), std::string(buffer, bufferLen) );
+
+    // Make sure the buffer is totally free.
+    if ( buffer )
+        free(buffer);
+
+    // Push the Network event.
+    postEventList.push_back(csm::daemon::helper::CreateNetworkEvent(sfMessage,sfAddr));
+}
+
+void
+CSM_INTERVAL_HANDLER::ExportMetrics( std::vector<csm::daemon::CoreEvent*>& postEventList )
+{
+    // Same timestamp format as the environmental data.
+    char timeStamp[80];
+    char timeStampUsec[120];
+    struct timeval now;
+    struct tm info;
+    gettimeofday( &now, NULL );
+    localtime_r( &now.tv_sec, &info );
+    strftime( timeStamp, sizeof( timeStamp ), "%Y-%m-%d %H:%M:%S", &info );
+    snprintf( timeStampUsec, sizeof( timeStampUsec ), "%s.%06lu", timeStamp, now.tv_usec );
+
+    std::string json = csm::daemon::Metrics::Instance().GetJsonString(
+        csm::daemon::Configuration::Instance()->GetHostname(), timeStampUsec );
+    if ( json.empty() )
+        return;
+
+    // Only the aggregator has a BDS connection, the other daemons write the export to their log.
+    if ( GetRole() == CSM_DAEMON_ROLE_AGGREGATOR )
+        postEventList.push_back( CreateBDSEvent( json ) );
+    else
+        CSMLOG( csmd, info ) << "INTERVAL: metrics " << json;
 }
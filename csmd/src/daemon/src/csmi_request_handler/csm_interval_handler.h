@@ -15,6 +15,8 @@
 #ifndef __CSM_DAEMON_SRC_CSM_DAEMON_INTERVAL_HANDLER_H__
 #define __CSM_DAEMON_SRC_CSM_DAEMON_INTERVAL_HANDLER_H__
 
+#include <atomic>
+
 #include "csmi_base.h"
 #include "csm_daemon_config.h"
 
@@ -22,7 +24,8 @@ class CSM_INTERVAL_HANDLER: public CSMI_BASE {
 
 public:
   CSM_INTERVAL_HANDLER(csm::daemon::HandlerOptions& options)
-  : CSMI_BASE(CSM_CMD_UNDEFINED, options)
+  : CSMI_BASE(CSM_CMD_UNDEFINED, options),
+    _Ticks( 0 )
   {
     setCmdName(std::string("CSM_INTERVAL"));
   }
@@ -30,6 +33,13 @@ public:
   virtual void Process( const csm::daemon::CoreEvent &aEvent,
                 std::vector<csm::daemon::CoreEvent*>& postEventList );
 
+private:
+  void SoftFailureRecovery( const csm::daemon::SoftFailRecovery_t &sfRec,
+                            std::vector<csm::daemon::CoreEvent*>& postEventList );
+  void ExportMetrics( std::vector<csm::daemon::CoreEvent*>& postEventList );
+
+  std::atomic<uint64_t> _Ticks;   ///< number of triggers, each one is GetMinInterval() seconds apart
+
 };
 
 class CSM_INTERVAL_HANDLER_MASTER : public CSM_INTERVAL_HANDLER
@@ -109,9 +109,8 @@ void CSMI_AGG_MTC_HANDLER::Process( const csm::daemon::CoreEvent &aEvent, std::v
 
         // any new msg (no context) that hits the MTC handler from the master
         // has to be a multicast message
-        std::vector< std::string > node_list;
         csm::network::Message outMsg;
-        if ( !DecodeMulticastMessage( inMsg, node_list, outMsg) )
+        if ( !DecodeMulticastMessage( inMsg, outMsg) )
         {
           CSMLOG( mtccomp, warning ) << "Failed to Decode a multicast msg: cmd="
               << csm::network::cmd_to_string( inMsg.GetCommandType() );
@@ -120,35 +119,34 @@ void CSMI_AGG_MTC_HANDLER::Process( const csm::daemon::CoreEvent &aEvent, std::v
           return;
         }
 
-        CSMLOG( mtccomp, debug ) << "NodeList size=" << node_list.size();
-
         context = CreateContext(aEvent, this, 0);
         int responses = 0;
         csm::daemon::DaemonStateAgg * daemonState = (csm::daemon::DaemonStateAgg *) GetDaemonState();
-        for( auto node : node_list )
+        // walk the node list in place, no need to build a list of names first
+        int nodeCount = ForEachMulticastNode( inMsg, [&]( const std::string &node )
         {
           const csm::network::Address_sptr addr = daemonState->GetAddrForCN( node );
           if( addr == nullptr )
           {
             CSMLOG( mtccomp, debug ) << "this aggregator is not responsible for " << node;
-            continue;
+            return;
           }
           csm::daemon::ConnectedNodeStatus *nInfo = daemonState->GetNodeInfo( addr );
           if( nInfo == nullptr )
           {
             CSMLOG( mtccomp, debug ) << "requested node " << node << " is in UNKNOWN state.";
             // possibly inconsistent state: MTC failure; check if and how the 2 lists might get out of sync
-            continue;
+            return;
           }
           if( nInfo->_NodeMode != csm::daemon::RUN_MODE::READY_RUNNING )
           {
             CSMLOG( mtccomp, debug ) << "requested node " << node << " is DISCONNECTED.";
-            continue;
+            return;
           }
           if( nInfo->_ConnectionType == csm::daemon::ConnectionType::SECONDARY )
           {
             CSMLOG( mtccomp, trace ) << "connection to node " << node << " is marked SECONDARY. Skipping send.";
-            continue;
+            return;
           }
 
 
@@ -168,7 +166,9 @@ void CSMI_AGG_MTC_HANDLER::Process( const csm::daemon::CoreEvent &aEvent, std::v
             postEventList.push_back( CreateErrorEvent(EINVAL, "Multicast msg forward.", aEvent ) );
             // don't stop fan-out of mtc just because of one msg failing
           }
-        }
+        } );
+
+        CSMLOG( mtccomp, debug ) << "NodeList size=" << nodeCount;
         // if we post anything, we should set a timeout before getting back to master
         if( responses > 0 )
         {
@@ -78,6 +78,14 @@ public:
         csm::daemon::DBRespEvent *db_event = (csm::daemon::DBRespEvent *) &aEvent;
         csm::db::DBResult_sptr db_res = db_event->GetContent().GetDBResult(); 
         std::vector<csm::db::DBTuple *> tuples;                              
+
+        // Binary values can't be represented as string tuples, pass on the result itself.
+        if( db_res && db_res->IsBinary() )
+        {
+            if ( !HandleDBResult(db_res, postEventList, ctx) )
+                HandleError( ctx, *(ctx->GetReqEvent()), postEventList );
+            return;
+        }
     
         if( db_res && !(csm::daemon::helper::GetTuplesFromDBResult(db_res, tuples)) )
         {
@@ -115,6 +123,27 @@ protected:
         const std::vector<csm::db::DBTuple *>& tuples,
         std::vector<csm::daemon::CoreEvent*>& postEventList,
         csm::daemon::EventContextHandlerState_sptr& ctx )   = 0;
+
+    /** @brief Handles a DBResp carrying binary values, see @ref csm::db::DBReqContent::SetBinaryResults.
+     *  @note States that request binary results must override this, the values have to be
+     *      decoded with the typed accessors of @ref csm::db::DBResult.
+     *
+     *  @param[in] db_res The result received from the database.
+     *  @param[in] postEventList The Event Queue.
+     *  @param[in,out] ctx The context of the event, holds details persistent across states.
+     *
+     *  @return true Everything went as planned and no errors were found.
+     *  @return false An error was detected and details were placed in the context.
+     */
+    virtual bool HandleDBResult(
+        csm::db::DBResult_sptr db_res,
+        std::vector<csm::daemon::CoreEvent*>& postEventList,
+        csm::daemon::EventContextHandlerState_sptr& ctx )
+    {
+        ctx->SetErrorCode(CSMERR_DB_ERROR);
+        ctx->SetErrorMessage("Received binary database results in a state that can't decode them.");
+        return false;
+    }
 };
 
 #endif
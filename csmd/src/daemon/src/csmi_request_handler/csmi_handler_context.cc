@@ -36,7 +36,10 @@ EventContextHandlerState::EventContextHandlerState(
         _NodeErrors({}),
         _ErrorMessage(""),
         _UserData(nullptr),
-        _DataDestructor(nullptr)
+        _DataDestructor(nullptr),
+        _StartTime(std::chrono::steady_clock::now()),
+        _WaitStart(_StartTime),
+        _WaitCategory(csm::daemon::METRICS_CATEGORY_MAX)
     {
         if ( aReqEvent != nullptr &&
                 aReqEvent->HasSameContentTypeAs(csm::daemon::helper::NETWORK_EVENT_TYPE) )
@@ -62,7 +65,10 @@ EventContextHandlerState::EventContextHandlerState(const csm::daemon::EventConte
         _ErrorCode(CSMI_SUCCESS),
         _ErrorMessage(""),
         _UserData(nullptr),
-        _DataDestructor(nullptr)
+        _DataDestructor(nullptr),
+        _StartTime(std::chrono::steady_clock::now()),
+        _WaitStart(_StartTime),
+        _WaitCategory(csm::daemon::METRICS_CATEGORY_MAX)
     {}
    
 EventContextHandlerState::~EventContextHandlerState()
@@ -258,6 +264,28 @@ bool EventContextHandlerState::GetMCASTNoTargetFail()
     return _MCASTNoTargetFail;
 }
 
+void EventContextHandlerState::SetWait( 
+    csm::daemon::MetricsCategory category, 
+    std::chrono::steady_clock::time_point start )
+{
+    std::lock_guard<std::mutex> lock(_WaitMutex);
+    _WaitCategory = category;
+    _WaitStart = start;
+}
+
+bool EventContextHandlerState::TakeWait( 
+    csm::daemon::MetricsCategory &category, 
+    std::chrono::steady_clock::time_point &start )
+{
+    std::lock_guard<std::mutex> lock(_WaitMutex);
+    category = _WaitCategory;
+    start = _WaitStart;
+
+    // A wait is recorded once, a state that issues no new request must not record it again.
+    _WaitCategory = csm::daemon::METRICS_CATEGORY_MAX;
+    return category != csm::daemon::METRICS_CATEGORY_MAX;
+}
+
 
 
 void EventContextHandlerState::SetUserData( void* userData ) 
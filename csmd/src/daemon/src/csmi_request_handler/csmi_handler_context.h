@@ -16,6 +16,8 @@
 #define __CSMI_HANDLER_STATE_CONTEXT_H__
 
 #include "include/csm_core_event.h"
+#include "include/csm_metrics.h"
+#include <chrono>
 #include <mutex>
 #include <functional>
 #include <ostream>
@@ -79,6 +81,13 @@ private:
 
     std::function<void(void*)> _DataDestructor;  ///< Holds the destructor for the UserData.
     std::mutex                 _DestructorMutex; ///< A mutex for the Data Destructor.
+
+    // Metrics Data
+    std::chrono::steady_clock::time_point _StartTime; ///< When the context was created.
+    std::chrono::steady_clock::time_point _WaitStart; ///< When the context started waiting on a request.
+    csm::daemon::MetricsCategory _WaitCategory;       ///< What the context is waiting on, 
+                                                      ///< METRICS_CATEGORY_MAX if nothing.
+    std::mutex    _WaitMutex;                         ///< A mutex lock for the wait fields.
 public:
 
     EventContextHandlerState(
@@ -250,6 +259,24 @@ public:
      */
     bool GetMCASTNoTargetFail();
 
+    /** @brief Gets the creation time of the context, immutable over its lifetime.
+     * @return The time the context was created.
+     */
+    std::chrono::steady_clock::time_point GetStartTime() const { return _StartTime; }
+
+    /** @brief Records that the context started waiting on a request, retrieves a mutex lock.
+     * @param[in] category What the context is waiting on (e.g. METRICS_DB_WAIT).
+     * @param[in] start When the wait started.
+     */
+    void SetWait( csm::daemon::MetricsCategory category, std::chrono::steady_clock::time_point start );
+
+    /** @brief Retrieves and clears what the context is waiting on, retrieves a mutex lock.
+     * @param[out] category What the context is waiting on.
+     * @param[out] start When the wait started.
+     * @return False if the context is not waiting on a request.
+     */
+    bool TakeWait( csm::daemon::MetricsCategory &category, std::chrono::steady_clock::time_point &start );
+
     /** @brief Retrieves the user data, performing a static cast to the correct type.
      * 
      * @tparam T The class for the _UserData void pointer.
@@ -28,7 +28,7 @@
 #include "../csmi_handler_context.h"
 #include <string>
 #include <vector>
-#include <map>
+#include <unordered_map>
 #include <queue>
 
 /**
@@ -41,8 +41,16 @@ template<typename DataStruct, class ErrorCompare=std::less<int>>
 class CSMIMcast
 {
 protected:
-    std::map<std::string, std::pair<int,uint32_t>> _NodeStates; /**< The mapping of node to current 
-                                                            state and node index respectively. */
+    /** @brief The multicast state of a single node. */
+    struct NodeState
+    {
+        std::string name;   /**< The host name of the node. */
+        int         state;  /**< The current state of the node, see @ref GenerateErrorListing. */
+        uint32_t    index;  /**< The index of the node in @ref _Data's compute_nodes. */
+    };
+
+    std::vector<NodeState> _NodeStates; /**< The node states, indexed by node id. */
+    std::unordered_map<std::string, uint32_t> _NodeIds; /**< The mapping of host name to node id. */
 
     uint8_t     _CommandType;   /**< The type of the command for the multicast. */
 
@@ -113,9 +121,19 @@ public:
                 {
                     std::string node( _Data->compute_nodes[i] );
                     
-                    // Add the name to the list and initialize the map.
-                    nodeList.push_back( _Data->compute_nodes[i] );
-                    _NodeStates[node] = std::pair<int,uint32_t>(-1, i);
+                    // Add the name to the list and initialize the node state.
+                    auto nodeId = _NodeIds.find(node);
+                    if ( nodeId == _NodeIds.end() )
+                    {
+                        _NodeIds[node] = _NodeStates.size();
+                        _NodeStates.push_back( NodeState{ node, -1, i } );
+                    }
+                    else
+                    {
+                        _NodeStates[nodeId->second].state = -1;
+                        _NodeStates[nodeId->second].index = i;
+                    }
+                    nodeList.push_back( std::move(node) );
                 }
             }
         }
@@ -124,9 +142,9 @@ public:
 
     /** @brief Updates the nodeStates map based on the recovery state.
      * 
-     * If the _Recovery Flag is not set the contents of the map are initialized to -1.
+     * If the _Recovery Flag is not set the node states are initialized to -1.
      *
-     * Otherwise the map values are set using in the following transition matrix:
+     * Otherwise the node states are set using in the following transition matrix:
      *
      * | Input Value | Exit Value | Description                       |
      * |-------------|------------|-----------------------------------|
@@ -136,7 +154,7 @@ public:
      *
      * Each value uses the function *x<=0; f(x)=(x*2)-1* to perform this transition.
      *
-     * @return A list of the nodes present in the Map.
+     * @return A list of the nodes present in the node state table.
      */
     std::vector<std::string> UpdateNodeMap()
     {
@@ -148,19 +166,20 @@ public:
         }
         else
         {
-            // Iterate over the map, grab the node name and update the value.
-            for ( auto const& node : _NodeStates)
+            // Iterate over the node states, grab the node name and update the value.
+            nodeList.reserve(_NodeStates.size());
+            for ( auto& node : _NodeStates)
             {
-                nodeList.push_back(node.first);
+                nodeList.push_back(node.name);
     
-                if (node.second.first <= 0) _NodeStates[node.first].first = ( node.second.first * 2 ) -1;
+                if (node.state <= 0) node.state = ( node.state * 2 ) -1;
             }
         }
     
         return nodeList;
     }
 
-    /** @brief Sets the error code of a host name in the map.
+    /** @brief Sets the error code of a host name in the node state table.
      * 
      * @param[in] hostName The host name of the node to update the error code for.
      * @param[in] errorCode The new Error Code, this error code does not replace
@@ -171,25 +190,28 @@ public:
     uint32_t SetHostError( std::string hostName, int errorCode = 0, const char * errorString = "" )
     {
         int32_t hostIndex = UINT32_MAX;
-        // If the hostname is present and doesn't have an error code, update the map.
-        if ( _NodeStates.find(hostName) != _NodeStates.end() )
+        // If the hostname is present and doesn't have an error code, update the node state.
+        auto nodeId = _NodeIds.find(hostName);
+        if ( nodeId != _NodeIds.end() )
         {
+            NodeState& node = _NodeStates[nodeId->second];
+
             // If there was an older error, don't overwrite (timeout errors are fine to overwrite)
-            if (_NodeStates[hostName].first <= 0 ) 
+            if (node.state <= 0 ) 
             {
                 // If no error code was supplied simply add 1
                 if ( errorCode == 0 ) 
                 {
-                    _NodeStates[hostName].first = _NodeStates[hostName].first + 1;
+                    node.state = node.state + 1;
                 }
                 else
                 {
-                    _NodeStates[hostName].first = errorCode;
+                    node.state = errorCode;
                     _ErrorMsg.append(errorString).append(" ");
                 }
             }
 
-            hostIndex = _NodeStates[hostName].second;
+            hostIndex = node.index;
         }
 
         return hostIndex;
@@ -217,9 +239,9 @@ public:
 
         for ( auto const& node : _NodeStates )
         {
-            if ( (isSuccess && node.second.first == 0) || !(isSuccess || node.second.first == 0) )
+            if ( (isSuccess && node.state == 0) || !(isSuccess || node.state == 0) )
             {
-                nodeVector.push_back(node.first);
+                nodeVector.push_back(node.name);
             }
         }
 
@@ -228,7 +250,7 @@ public:
 
 
     /**
-     * @brief Creates an error listing from the @ref _NodeStates map.
+     * @brief Creates an error listing from the @ref _NodeStates table.
      *
      * @return A vector of node errors.
      */
@@ -238,12 +260,12 @@ public:
 
         for ( auto const& node : _NodeStates )
         {
-            if (  node.second.first != CSMI_SUCCESS )
+            if (  node.state != CSMI_SUCCESS )
             {
                 csm_node_error_t* temp;
                 csm_init_struct_ptr(csm_node_error_t, temp);
-                temp->errcode = node.second.first > CSMI_SUCCESS ? node.second.first : CSMERR_TIMEOUT ;
-                temp->source = strdup(node.first.c_str());
+                temp->errcode = node.state > CSMI_SUCCESS ? node.state : CSMERR_TIMEOUT ;
+                temp->source = strdup(node.name.c_str());
                 nodeVector.push_back(temp);
             }
         }
@@ -269,11 +291,11 @@ public:
 
         for ( auto const& node : _NodeStates )
         {
-            if ( node.second.first != 0 )
+            if ( node.state != 0 )
             {
                 failureCount++;
-                failures.append(node.first).append(" : ");
-                failures.append(std::to_string(node.second.first)).append(";");
+                failures.append(node.name).append(" : ");
+                failures.append(std::to_string(node.state)).append(";");
             }
         }
 
@@ -297,11 +319,11 @@ public:
         CSMI_BASE* handler = static_cast<CSMI_BASE*>(ctx->GetEventHandler());
         for ( auto const& node : _NodeStates )
         {
-            if ( node.second.first < 0 )
+            if ( node.state < 0 )
             {
                 csm::daemon::NetworkEvent *reply =
-                    csm::daemon::helper::CreateRasEventMessage(_RASMsgId, node.first, "",
-                        "rc=" +std::to_string(node.second.first), handler->GetAbstractMaster());
+                    csm::daemon::helper::CreateRasEventMessage(_RASMsgId, node.name, "",
+                        "rc=" +std::to_string(node.state), handler->GetAbstractMaster());
 
                 if(reply)
                     postEventList.push_back(reply);
@@ -18,6 +18,7 @@
 #include "csmi_base.h"
 #include "csmi_handler_state.h"
 #include "csmutil/include/timing.h"
+#include "include/csm_metrics.h"
 #include "csmi/include/csm_api.h"
 
 /** @brief The base class of stateful handlers.
@@ -41,6 +42,8 @@ public:
     {
         // Grab the start time of the state.
         START_TIMING()
+        std::chrono::steady_clock::time_point stateStart = std::chrono::steady_clock::now();
+        size_t firstPosted = postEventList.size();
 
         // Get the context as a Handler context.
         csm::daemon::EventContextHandlerState_sptr  ctx;
@@ -61,6 +64,13 @@ public:
             if( ! ctx )
                 throw csm::daemon::Exception(
                     "ERROR: Context type cannot be dyn-casted to EventContextHandlerState");
+
+            // Record how long the context waited on the request that resumed it.
+            csm::daemon::MetricsCategory waitCategory;
+            std::chrono::steady_clock::time_point waitStart;
+            if ( ctx->TakeWait( waitCategory, waitStart ) )
+                csm::daemon::Metrics::Instance().Record( _cmdType, waitCategory, 
+                    ElapsedMicros( waitStart, stateStart ) );
         }
     
         // Cache the state id for later.
@@ -82,6 +92,17 @@ public:
         // Grab the end time of the state.
         END_TIMING( csmapi, debug, ctx->GetRunID(), _cmdType, stateID )
 
+        // Record the state and, once the API is done, the whole request.
+        // Otherwise, if the state issued requests the context now waits on them.
+        std::chrono::steady_clock::time_point stateEnd = std::chrono::steady_clock::now();
+        csm::daemon::Metrics& metrics = csm::daemon::Metrics::Instance();
+        metrics.Record( _cmdType, csm::daemon::METRICS_HANDLER, ElapsedMicros( stateStart, stateEnd ) );
+        if( ctx->GetAuxiliaryId() >= _States.size() )
+            metrics.Record( _cmdType, csm::daemon::METRICS_TOTAL, 
+                ElapsedMicros( ctx->GetStartTime(), stateEnd ) );
+        else if ( postEventList.size() > firstPosted )
+            ctx->SetWait( GetWaitCategory( postEventList, firstPosted ), stateEnd );
+
         // Log when the API exits for a context.
         if( ctx->GetAuxiliaryId() >= _States.size() )
              LOG(csmapi, info) << ctx << _cmdName << " end";
@@ -119,6 +140,36 @@ protected:
         return std::make_shared<csm::daemon::EventContextHandlerState>(
             this, _InitialState, aReqEvent ); 
     }
+
+private:
+    static inline uint64_t ElapsedMicros( 
+        std::chrono::steady_clock::time_point start,
+        std::chrono::steady_clock::time_point end )
+    {
+        return end > start ? 
+            std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count() : 0;
+    }
+
+    /** @brief Determines what a context waits on from the events a state posted.
+     * A DB request takes precedence, a network event is a multicast wait if its message is multicast.
+     */
+    static csm::daemon::MetricsCategory GetWaitCategory(
+        const std::vector<csm::daemon::CoreEvent*>& postEventList, size_t first )
+    {
+        csm::daemon::MetricsCategory category = csm::daemon::METRICS_NETWORK_WAIT;
+        for ( size_t i = first; i < postEventList.size(); ++i )
+        {
+            const csm::daemon::CoreEvent* event = postEventList[i];
+            if ( event->GetEventType() == csm::daemon::EVENT_TYPE_DB_Request )
+                return csm::daemon::METRICS_DB_WAIT;
+
+            if ( event->HasSameContentTypeAs( 
+                    typeid( csm::daemon::EventContentContainer<csm::network::MessageAndAddress> ) ) &&
+                 ((const csm::daemon::NetworkEvent*)event)->GetContent()._Msg.GetMulticast() )
+                category = csm::daemon::METRICS_MCAST_WAIT;
+        }
+        return category;
+    }
 };
 
 
@@ -18,6 +18,9 @@
 #include "csmi_stateful_db/CSMIStatefulDBRecvDB.h"
 #include "csmi_stateful_db/CSMIStatefulDBRecvPrivate.h"
 
+// Each worker thread packs its replies into its own buffer.
+static thread_local CSMIStatefulDB::ReplyPackBuffer ReplyPackBuffer_tls;
+
 
 CSMIStatefulDB::CSMIStatefulDB(
     csmi_cmd_t cmd,
@@ -63,3 +66,24 @@ CSMIStatefulDB::CSMIStatefulDB(
         );
     }
 }
+
+CSMIStatefulDB::ReplyPackBuffer& CSMIStatefulDB::GetReplyPackBuffer()
+{
+    return ReplyPackBuffer_tls;
+}
+
+void CSMIStatefulDB::FreeReplyBuffer( char *buffer )
+{
+    ReplyPackBuffer &pack = ReplyPackBuffer_tls;
+
+    if ( buffer != pack.Buffer )
+    {
+        free(buffer);
+    }
+    else if ( pack.Capacity > CSM_REPLY_PACK_BUFFER_MAX )
+    {
+        free(pack.Buffer);
+        pack.Buffer   = nullptr;
+        pack.Capacity = 0;
+    }
+}
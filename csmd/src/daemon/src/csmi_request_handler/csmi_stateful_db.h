@@ -17,6 +17,9 @@
 
 #include "csmi_stateful.h"
 
+/// Reply pack buffers grown beyond this size are freed after the reply instead of being kept.
+#define CSM_REPLY_PACK_BUFFER_MAX ( 16 * 1024 * 1024 )
+
 enum StatefulStatesDefault
 {
     STATEFUL_DB_INIT = 0,
@@ -51,6 +54,35 @@ public:
         csm::daemon::HandlerOptions& options, 
         uint32_t numStates = STATEFUL_DB_DONE );
 
+    /**
+     * @brief A pack buffer kept by each worker thread across replies.
+     *
+     * Pack a reply into it with csm_serialize_struct_buffer and return @ref Buffer from
+     * @ref CreateByteArray. The reply is copied into the message, so the buffer is kept
+     * for the next reply of the thread instead of being freed.
+     */
+    struct ReplyPackBuffer
+    {
+        char     *Buffer;   ///< The buffer, NULL until the first pack.
+        uint32_t  Capacity; ///< The allocated size of @ref Buffer.
+
+        ReplyPackBuffer() : Buffer(nullptr), Capacity(0) {}
+        ~ReplyPackBuffer() { free(Buffer); }
+    };
+
+    /** @brief Returns the reply pack buffer of the calling thread. */
+    static ReplyPackBuffer& GetReplyPackBuffer();
+
+    /**
+     * @brief Frees a reply buffer returned by @ref CreateByteArray.
+     *
+     * The reply pack buffer of the calling thread is kept, unless it grew beyond
+     * @ref CSM_REPLY_PACK_BUFFER_MAX.
+     *
+     * @param[in] buffer The reply buffer, may be NULL.
+     */
+    static void FreeReplyBuffer( char *buffer );
+
   /**
    * @brief Creates a Database payload using parameterization. 
    *
@@ -82,6 +114,30 @@ public:
         char **buf, uint32_t &bufLen, 
         csm::daemon::EventContextHandlerState_sptr& ctx ) = 0;
 
+    /**
+     * @brief Assembles a buffer to respond to the user from a result with binary values.
+     *
+     * Only invoked if @ref CreatePayload requested binary results through
+     * csm::db::DBReqContent::SetBinaryResults; decode the fields with the typed
+     * accessors of csm::db::DBResult.
+     *
+     * @param[in]  dbRes  The result of the database query.
+     * @param[out] buf    A serialized message to send to the customer.
+     * @param[out] bufLen The length of the generated buffer.
+     * @param[in]  ctx    The context of the handler, error details and private check status.
+     * 
+     * @return The success of the generation of the Byte Array.
+     */
+    virtual bool CreateByteArrayFromResult(
+        csm::db::DBResult_sptr dbRes,
+        char **buf, uint32_t &bufLen, 
+        csm::daemon::EventContextHandlerState_sptr& ctx )
+    {
+        ctx->SetErrorCode(CSMERR_DB_ERROR);
+        ctx->SetErrorMessage("Handler received binary database results it can't decode.");
+        return false;
+    }
+
   /**
    * @brief Decodes the user data and assembles a query to perform a private check.
    *
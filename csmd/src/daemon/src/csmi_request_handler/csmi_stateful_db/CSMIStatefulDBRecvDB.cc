@@ -26,7 +26,36 @@ bool StatefulDBRecv::HandleDBResp(
     uint32_t bufferLength = 0;
 
     bool success = _Handler->CreateByteArray(tuples, &buffer, bufferLength, ctx);
+    success = PushByteArray( success, buffer, bufferLength, postEventList, ctx );
     
+    LOG( csmapi, trace ) << "StatefulDBRecv::HandleDBResp: Exit";
+    return success;
+}
+
+bool StatefulDBRecv::HandleDBResult(
+        csm::db::DBResult_sptr db_res,
+        std::vector<csm::daemon::CoreEvent*>& postEventList,
+        csm::daemon::EventContextHandlerState_sptr& ctx ) 
+{
+    LOG( csmapi, trace ) << "StatefulDBRecv::HandleDBResult: Enter";
+
+    char* buffer = nullptr;
+    uint32_t bufferLength = 0;
+
+    bool success = _Handler->CreateByteArrayFromResult(db_res, &buffer, bufferLength, ctx);
+    success = PushByteArray( success, buffer, bufferLength, postEventList, ctx );
+    
+    LOG( csmapi, trace ) << "StatefulDBRecv::HandleDBResult: Exit";
+    return success;
+}
+
+bool StatefulDBRecv::PushByteArray(
+        bool success,
+        char* buffer,
+        uint32_t bufferLength,
+        std::vector<csm::daemon::CoreEvent*>& postEventList,
+        csm::daemon::EventContextHandlerState_sptr& ctx )
+{
     if ( success )
     {
         this->PushReply( buffer, bufferLength, ctx, postEventList, false);
@@ -38,11 +67,7 @@ bool StatefulDBRecv::HandleDBResp(
             "CSM ERROR - Could not create responding byte array (Default error)");
     }
 
-    if ( buffer )
-    {
-        free(buffer);
-    }
-    
-    LOG( csmapi, trace ) << "StatefulDBRecv::HandleDBResp: Exit";
+    CSMIStatefulDB::FreeReplyBuffer(buffer);
+
     return success;
 }
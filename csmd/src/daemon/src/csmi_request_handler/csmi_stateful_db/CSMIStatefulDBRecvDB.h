@@ -50,6 +50,20 @@ protected:
         std::vector<csm::daemon::CoreEvent*>& postEventList,
         csm::daemon::EventContextHandlerState_sptr& ctx ) final;
 
+    virtual bool HandleDBResult(
+        csm::db::DBResult_sptr db_res,
+        std::vector<csm::daemon::CoreEvent*>& postEventList,
+        csm::daemon::EventContextHandlerState_sptr& ctx ) final;
+
+    /** @brief Pushes the reply buffer or sets the default error if it couldn't be created, then frees it
+     *      with @ref CSMIStatefulDB::FreeReplyBuffer. */
+    bool PushByteArray(
+        bool success,
+        char* buffer,
+        uint32_t bufferLength,
+        std::vector<csm::daemon::CoreEvent*>& postEventList,
+        csm::daemon::EventContextHandlerState_sptr& ctx );
+
 
     /** @brief See @ref CSMIHandlerState::DefaultHandleError for documentation. */
     virtual void HandleError(
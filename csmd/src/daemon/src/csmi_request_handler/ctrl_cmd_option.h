@@ -40,6 +40,7 @@ public:
     _dump_perf_data = false;
     _dump_mem_usage = false;
     _agg_reset = false;
+    _dump_metrics = false;
   }
   
 private:
@@ -57,6 +58,7 @@ private:
     ar & _dump_perf_data;
     ar & _dump_mem_usage;
     ar & _agg_reset;
+    ar & _dump_metrics;
   }
   
 public:
@@ -104,6 +106,9 @@ public:
   void set_agg_reset() { _agg_reset = true; }
   bool get_agg_reset() const { return _agg_reset; }
 
+  void set_dump_metrics() { _dump_metrics = true; }
+  bool get_dump_metrics() const { return _dump_metrics; }
+
 private:
   utility::bluecoral_sevs _log_csmdb;
   utility::bluecoral_sevs _log_csmnet;
@@ -114,6 +119,7 @@ private:
   bool _dump_perf_data;
   bool _dump_mem_usage;
   bool _agg_reset;
+  bool _dump_metrics;
 
 };
 
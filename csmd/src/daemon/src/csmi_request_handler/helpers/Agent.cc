@@ -196,14 +196,24 @@ int ForkAndExecAllocationCGroup(char * const argv[], uint64_t allocation_id, uid
     
     if ( execPid == 0  )
     {
+        // The migrating process holds the write end open until the migration finishes.
+        int migrated[2] = { -1, -1 };
+        if ( pipe2(migrated, O_CLOEXEC) != 0 )
+        {
+            migrated[0] = migrated[1] = -1;
+        }
+
         execPid = fork();
         if(execPid != 0)
         {
+            if ( migrated[0] >= 0 ) close(migrated[0]);
+
             // Setup the cgroup.
             csm::daemon::helper::CGroup cgroup = csm::daemon::helper::CGroup( allocation_id );
             cgroup.MigratePid(execPid);
             _Exit(0);
         }
+        if ( migrated[1] >= 0 ) close(migrated[1]);
 
         // Set the userid.
         passwd *pw = getpwuid(user_id);
@@ -243,7 +253,7 @@ int ForkAndExecAllocationCGroup(char * const argv[], uint64_t allocation_id, uid
                 csm::daemon::helper::CGroup cgroup = csm::daemon::helper::CGroup( allocation_id );
                 
                 LOG(csmapi, trace) << "Waiting on pid #" << getpid() << " migration allocation: " << allocation_id;
-                if(cgroup.WaitPidMigration(getpid()) && argv)
+                if(cgroup.WaitPidMigration(getpid(), 3, 1, migrated[0]) && argv)
                 {
                     LOG(csmapi, trace) << "Pid #" << getpid() << " migrated allocation: " << allocation_id;
                     LOG(csmapi, trace) << "Executing \"" << *argv << "\"";
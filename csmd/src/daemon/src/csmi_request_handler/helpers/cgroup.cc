@@ -24,6 +24,10 @@
 #include <errno.h>     ///< Errno
 #include <signal.h>    ///< Kill System call.
 #include <dirent.h>    ///< DIR and Directory sys calls.
+#include <poll.h>      ///< Poll for the migration notification.
+#include <thread>      ///< Parallel controller writes.
+#include <functional>  ///< Work items for the parallel controller writes.
+#include <exception>   ///< Forwarding exceptions from the worker threads.
 #include "csm_daemon_config.h"
 #include "logging.h"   ///< CSM logging.
 #include "cgroup.h" 
@@ -51,6 +55,11 @@
 #define _TASK_KILL SIGKILL
 #define _KILL_ATTEMPTS 5
 #define _SLEEP_FACTOR 1 // Number of seconds multiplied by kill attempt -1, clamped to zero.
+#define _CGROUP_PROC_FMT "/proc/%d/cgroup"
+
+///< Backoff for polling cgroupfs, in microseconds.
+#define _BACKOFF_MIN 1000
+#define _BACKOFF_MAX 64000
 
 ///< File helpers
 #define _DIR_DELIM "/"
@@ -82,6 +91,110 @@ static const char CPU_OFFLINE = '0';
 static const char ENABLE_CONTROLLER         = '1'; ///< Syntactic Sugar
 static const char DISABLE_CONTROLLER        = '0'; ///< Syntactic Sugar
 
+/// Closes an open group directory when it leaves scope.
+class GroupDescriptor
+{
+public:
+    explicit GroupDescriptor( int fd ) : _fd(fd) {}
+    ~GroupDescriptor() { if ( _fd >= 0 ) close( _fd ); }
+    int get() const { return _fd; }
+
+private:
+    GroupDescriptor( const GroupDescriptor& ) = delete;
+    GroupDescriptor& operator=( const GroupDescriptor& ) = delete;
+
+    int _fd;
+};
+
+/** @brief Runs each work item on its own thread.
+ * The controllers are independent hierarchies, so their writes don't need to be ordered.
+ *
+ * @param[in] work The work items to run.
+ *
+ * @throw The first exception thrown by a work item, after all of the work items finish.
+ */
+static void RunParallel( const std::vector<std::function<void()>>& work )
+{
+    std::vector<std::exception_ptr> errors( work.size() );
+
+    // Don't bother with a thread for a single item.
+    if ( work.size() == 1 )
+    {
+        work[0]();
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve( work.size() );
+    for ( size_t i = 0; i < work.size(); ++i )
+    {
+        workers.emplace_back( [&work, &errors, i]()
+        {
+            try
+            {
+                work[i]();
+            }
+            catch ( ... )
+            {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+
+    for ( std::thread& worker : workers ) worker.join();
+
+    for ( const std::exception_ptr& error : errors )
+    {
+        if ( error ) std::rethrow_exception( error );
+    }
+}
+
+/** @brief Write a value to an open parameter file and close it.
+ *
+ * @param[in] fileDescriptor The open parameter file.
+ * @param[in] parameterPath The path of the parameter, used for error reporting.
+ * @param[in] value The value to write to the parameter.
+ * @param[in] valueLen The length of the written value.
+ *
+ * @throw CSMHandlerException If the parameter couldn't be written to.
+ */
+static void WriteToDescriptor( int fileDescriptor, const std::string& parameterPath,
+    const void* value, const size_t valueLen )
+{
+    errno=0;
+    int errorCode = write( fileDescriptor, value, valueLen ) < 0 ? errno : 0;
+    close( fileDescriptor );
+    
+    // Build a verbose error for the user.
+    if ( errorCode != 0 )
+    {
+        csmi_cmd_err_t err = CSMERR_CGROUP_FAIL;
+
+        std::string error("Unable to write to parameter ");
+        error.append(parameterPath);
+
+        if( value ) 
+            error.append("; Value : ").append(std::string((const char*)value, valueLen));
+        
+        error.append("; Error : ").append(strerror(errorCode)); 
+        switch (errorCode){
+            case EINVAL:
+                error.append("; This error typically means the value written to the"
+                    " cgroup parameter was invalid.");
+                err = CSMERR_CGROUP_EINVAL;
+                break;
+            case EACCES:
+                error.append("; This error typically means the resources being requested are "
+                    "invalid.");
+                err = CSMERR_CGROUP_EACCES;
+                break;
+        }
+        //LOG( csmapi, error ) << _LOG_PREFIX << error;
+
+        throw CSMHandlerException( error, err );
+    }
+}
+
 // Constant definitions.
 #define CSM_SYSTEM "csm_system"
 const char* CGroup::SYSTEM_CGROUP    = "/" CSM_SYSTEM "/";
@@ -287,19 +400,20 @@ void CGroup::SetupCGroups(int64_t cores, int16_t smtMode)
     WriteToParameter( MEM_MIGRATE, sysCpuset, &ENABLE_CONTROLLER, sizeof(ENABLE_CONTROLLER));
  
     CopyParameter( MEMS, CGroup::CPUSET_DIR, sysCpuset );
-    MigrateTasks( CGroup::CPUSET_DIR, sysCpuset );
 
-    // Migrate the tasks.
+    // Migrate the tasks, each controller is migrated on its own thread.
+    std::vector<std::function<void()>> migrations;
+    migrations.push_back( [this, sysCpuset]() { MigrateTasks( CGroup::CPUSET_DIR, sysCpuset ); } );
     for( uint32_t controller = CG_CPUSET + 1;
         controller < csm_enum_max(csmi_cgroup_controller_t);
         ++controller )
     {
         std::string cg = CreateCGroup(csmi_cgroup_controller_t_strs[controller], CGroup::SYSTEM_CGROUP);
-        MigrateTasks( 
-            std::string(CGroup::CONTROLLER_DIR)
-                .append(csmi_cgroup_controller_t_strs[controller]).append("/"), 
-            cg );
+        std::string root = std::string(CGroup::CONTROLLER_DIR)
+                .append(csmi_cgroup_controller_t_strs[controller]).append("/");
+        migrations.push_back( [this, root, cg]() { MigrateTasks( root, cg ); } );
     }
+    RunParallel( migrations );
 
     LOG( csmapi, trace ) << _LOG_PREFIX "SetupCGroups Exit";
 }
@@ -430,24 +544,50 @@ void CGroup::CreateCGroup( const char* cgroupName,
     stepCGroup = CreateCGroup( controller, stepCGroup);
     // --------------------------------------------------------
 
+    // Hold the group open so the parameters are resolved relative to it.
+    GroupDescriptor stepDescriptor( OpenGroup( stepCGroup ) );
+
     // Write all of the values to the specified parameters.
     for( uint32_t i = 0; i < component->num_params; ++i )
     {
-        WriteToParameter( component->params[i], stepCGroup,
+        // Parameters may be supplied with the leading '/'.
+        const char* parameter = component->params[i];
+        while ( *parameter == '/' ) parameter++;
+
+        WriteToParameter( stepDescriptor.get(), parameter, stepCGroup,
                             component->values[i], strlen(component->values[i]) );
     }
 
     // If the pid was specified write to the tasks file.
     if ( pid != 0 )
     {
-        // TODO reduce the number of calls.
         std::string pidStr = std::to_string(pid);
-        WriteToParameter( "tasks", stepCGroup, pidStr.c_str(), pidStr.size() );
+        WriteToParameter( stepDescriptor.get(), "tasks", stepCGroup, pidStr.c_str(), pidStr.size() );
     }
 
     LOG( csmapi, trace ) << _LOG_PREFIX "CreateCGroup Exit";
 }
 
+void CGroup::CreateCGroups( const char* cgroupName, 
+                            csmi_cgroup_t** components, 
+                            uint32_t numComponents,
+                            pid_t pid ) const
+{
+    LOG( csmapi, trace ) << _LOG_PREFIX "CreateCGroups Enter; numComponents: " << numComponents;
+
+    // Each component is a different controller, so they can be written at the same time.
+    std::vector<std::function<void()>> creates;
+    for( uint32_t i = 0; i < numComponents; ++i )
+    {
+        csmi_cgroup_t* component = components[i];
+        creates.push_back( [this, cgroupName, component, pid]() 
+            { CreateCGroup( cgroupName, component, pid ); } );
+    }
+    RunParallel( creates );
+
+    LOG( csmapi, trace ) << _LOG_PREFIX "CreateCGroups Exit";
+}
+
 void CGroup::DeleteCGroup( 
     csmi_cgroup_controller_t controller,
     const char* stepCGroupName ) const
@@ -495,63 +635,49 @@ void CGroup::MigratePid( pid_t pid ) const
     LOG( csmapi, trace ) << _LOG_PREFIX "MigratePid Exit;";
 }
 
-bool CGroup::WaitPidMigration(pid_t pid, uint32_t sleepAttempts, uint32_t sleepTime) const
+bool CGroup::WaitPidMigration(pid_t pid, uint32_t sleepAttempts, uint32_t sleepTime, 
+    int notifyFd) const
 {
     LOG( csmapi, trace ) << _LOG_PREFIX "WaitPidMigration Enter; pid: "<< pid << "; sleepAttempts: " << 
-        sleepAttempts << "; sleepTime: "<< sleepTime;
+        sleepAttempts << "; sleepTime: "<< sleepTime << "; notifyFd: " << notifyFd;
 
-    bool success        = false; 
-    std::string pidStr  = std::to_string(pid); // The stringified pid.
-    uint32_t controller = CG_CPUSET; // Controller being checked.
-    uint32_t sleepCount = 0;         // Number of times the sleep has happened.
-    bool isFound        = false;     // The pid is found in a task list.
-    std::string line;                // Line for the getline operation.
+    // The total time the migration may take.
+    const int64_t timeout = (int64_t)sleepAttempts * sleepTime * 1000000;
+    int64_t waited = 0;
 
-    for (; controller < csm_enum_max(csmi_cgroup_controller_t) && sleepCount < sleepAttempts;)
+    // If the migrating process supplied a pipe, block until it finishes (closing its end).
+    if ( notifyFd >= 0 )
     {
-        // Path is rebuilt each time to add an additional wait.
-        std::string controllerPath(CONTROLLER_DIR);
-        controllerPath.append(csmi_cgroup_controller_t_strs[controller]);
-        controllerPath.append(_CGroupName).append("/tasks");
-        
-        try
-        { 
-            std::ifstream sourceStream(controllerPath);
-
-            while( getline(sourceStream, line) )
-            {
-                if ( line.compare(0, std::string::npos, pidStr) == 0 )
-                {
-                    isFound = true;
-                    break;
-                }
-            }
-
-            // If the pid was found move to the next pid 
-            if (isFound)
-            {
-                controller++;
-                sleepCount=0;
-                //sleepCount=sleepAttempts;
-            }
-            else
-            {
-                sleepCount++;
-                sleep(sleepTime);
-            }
-            isFound=false;
-        }
-        catch (const std::system_error& e)     
+        struct pollfd notify = { notifyFd, POLLIN, 0 };
+        int rc;
+        do
         {
-            LOG( csmapi, warning) << "Read error for " << controllerPath;
+            errno = 0;
+            rc = poll( &notify, 1, timeout / 1000 );
         }
+        while ( rc < 0 && errno == EINTR );
+
+        if ( rc == 0 ) waited = timeout;
+    }
+
+    // Verify the migration, the tasks files don't generate change notifications,
+    // so fall back to polling with a short backoff until the timeout expires.
+    uint32_t controller = CheckPidMigration( pid );
+    useconds_t backoff  = _BACKOFF_MIN;
+    while ( controller < csm_enum_max(csmi_cgroup_controller_t) && waited < timeout )
+    {
+        usleep(backoff);
+        waited += backoff;
+        backoff = backoff * 2 > _BACKOFF_MAX ? _BACKOFF_MAX : backoff * 2;
+
+        controller = CheckPidMigration( pid );
     }
     
     // If we didn't find everything  return false.
-    success= sleepAttempts != sleepCount;
+    bool success = controller >= csm_enum_max(csmi_cgroup_controller_t);
     if (!success)
     {
-        LOG(csmapi, error) << "Pid was not migrated successfully: " << pidStr << " ; Failed on cgroup " << 
+        LOG(csmapi, error) << "Pid was not migrated successfully: " << pid << " ; Failed on cgroup " << 
             csmi_cgroup_controller_t_strs[controller] << " controller;";
     }
     LOG( csmapi, trace ) << _LOG_PREFIX "WaitPidMigration Exit;";
@@ -559,6 +685,64 @@ bool CGroup::WaitPidMigration(pid_t pid, uint32_t sleepAttempts, uint32_t sleepT
     return success;
 }
 
+uint32_t CGroup::CheckPidMigration( pid_t pid ) const
+{
+    // The cgroup paths in /proc have no trailing delimiter.
+    std::string groupName(_CGroupName);
+    while ( groupName.size() > 1 && groupName.back() == '/' ) groupName.pop_back();
+    if ( groupName.empty() ) groupName = _DIR_DELIM;
+
+    bool migrated[csm_enum_max(csmi_cgroup_controller_t)] = { false };
+
+    char procPath[CPU_PATH_MAX];
+    snprintf( procPath, CPU_PATH_MAX, _CGROUP_PROC_FMT, pid );
+
+    try
+    {
+        // Each line is of the form <hierarchy>:<controller>[,<controller>...]:<path>
+        std::ifstream sourceStream(procPath);
+        std::string line;
+        while( getline(sourceStream, line) )
+        {
+            size_t controllersStart = line.find(':');
+            size_t pathStart = controllersStart == std::string::npos ? 
+                std::string::npos : line.find(':', controllersStart + 1);
+            if ( pathStart == std::string::npos ) continue;
+
+            if ( line.compare( pathStart + 1, std::string::npos, groupName ) != 0 ) continue;
+
+            std::string controllers = line.substr( controllersStart + 1, pathStart - controllersStart - 1 );
+            size_t start = 0;
+            do
+            {
+                size_t end = controllers.find( _GROUP_DELIM, start );
+                std::string name = controllers.substr( start, 
+                    end == std::string::npos ? std::string::npos : end - start );
+
+                for ( uint32_t controller = CG_CPUSET; 
+                        controller < csm_enum_max(csmi_cgroup_controller_t);
+                        ++controller )
+                {
+                    if ( name == csmi_cgroup_controller_t_strs[controller] ) 
+                        migrated[controller] = true;
+                }
+
+                start = end == std::string::npos ? end : end + 1;
+            }
+            while ( start != std::string::npos );
+        }
+    }
+    catch (const std::system_error& e)     
+    {
+        LOG( csmapi, warning) << "Read error for " << procPath;
+    }
+
+    uint32_t controller = CG_CPUSET;
+    while ( controller < csm_enum_max(csmi_cgroup_controller_t) && migrated[controller] ) controller++;
+
+    return controller;
+}
+
 void CGroup::ConfigSharedCGroup( int32_t projectedMemory, int32_t numGPUs, int32_t numProcessors ) 
 {
     LOG( csmapi, trace ) << _LOG_PREFIX "ConfigSharedCGroup Enter; projectedMemory: " << projectedMemory 
@@ -576,10 +760,12 @@ void CGroup::ConfigSharedCGroup( int32_t projectedMemory, int32_t numGPUs, int32
     std::string cpusetRoot(CONTROLLER_DIR);
     cpusetRoot.append(CPUSET);
 
-    // Set the projected memory
+    // Set the projected memory, the memory controller is written while the cpuset is computed.
     const char* MEM_LIMIT     = "memory.limit_in_bytes";
     std::string allocProjected = std::to_string(KB_TO_B(projectedMemory));
-    WriteToParameter( MEM_LIMIT, memCGroup, allocProjected.c_str(), allocProjected.size() );
+    std::vector<std::function<void()>> configs;
+    configs.push_back( [&memCGroup, &allocProjected, MEM_LIMIT]()
+        { WriteToParameter( MEM_LIMIT, memCGroup, allocProjected.c_str(), allocProjected.size() ); } );
     // =========================================================================================== 
     
     // Restrict the GPUs
@@ -594,6 +780,15 @@ void CGroup::ConfigSharedCGroup( int32_t projectedMemory, int32_t numGPUs, int32
 
     // TODO move to a function?
     // Restrict the CPUS
+    configs.push_back( [&]() { ConfigSharedCpuset( cpuCGroup, cpusetRoot, numProcessors ); } );
+    RunParallel( configs );
+
+    LOG( csmapi, trace ) << _LOG_PREFIX "ConfigSharedCGroup Exit;";
+}
+
+void CGroup::ConfigSharedCpuset( const std::string& cpuCGroup, const std::string& cpusetRoot, 
+    int32_t numProcessors ) const
+{
     const char* CPUS  = "cpuset.cpus";
 
     int32_t threads, sockets, threadsPerCore, coresPerSocket;
@@ -684,7 +879,6 @@ void CGroup::ConfigSharedCGroup( int32_t projectedMemory, int32_t numGPUs, int32
         // TODO Should this throw an exception?
         WriteToParameter(CPUS, cpuCGroup, " ", 1);
     }
-    LOG( csmapi, trace ) << _LOG_PREFIX "ConfigSharedCGroup Exit;";
 }
 
 int64_t CGroup::GetCPUUsage(const char* stepCGroupName) const
@@ -925,29 +1119,21 @@ void CGroup::DeleteCGroup(
         bool cgroup_removed = rmdir(groupPath.c_str()) == 0;
         if( !cgroup_removed )
         {
-            // FIXME ThiS is a major slow down point!
             // EBUSY 
             LOG( csmapi, warning ) << _LOG_PREFIX "DeleteCGroup: cgroup directory removal failed, "
-                "sleeping for 1 second and retrying. Directory : " << groupPath;
-
-            // First try to sync the file system.
-            errno = 0;
-            std::string taskFile = groupPath + _CGROUP_TASK;
-            int fileDescriptor = open( taskFile.c_str(),  O_WRONLY | O_CLOEXEC );
+                "retrying for up to 1 second. Directory : " << groupPath;
 
-            if( fileDescriptor > 0 )
+            // Retry the rmdir with a backoff to let the task migration/kill go through.
+            // cgroupfs has nothing to sync, so a syncfs would only add latency.
+            useconds_t backoff = _BACKOFF_MIN;
+            for ( useconds_t waited = 0; !cgroup_removed && waited < 1000000; waited += backoff )
             {
-                syncfs( fileDescriptor );
-                close( fileDescriptor );
+                usleep(backoff);
+                backoff = backoff * 2 > _BACKOFF_MAX ? _BACKOFF_MAX : backoff * 2;
+                errno = 0;
+                cgroup_removed = rmdir(groupPath.c_str()) == 0;
             }
 
-            // FIXME Add a more robust fix to this block of code.
-            // Then Sleep the rmdir for a second to let the task migration/kill go through.
-            // This is not in the critical path, so a second slow down is not terrible.
-            sleep(1);
-            errno = 0;
-            cgroup_removed = rmdir(groupPath.c_str()) == 0;
-
             // If the cgroup is still not removed throw an exception.
             if( !cgroup_removed )
             {
@@ -1188,39 +1374,7 @@ void CGroup::WriteToParameter(
     int fileDescriptor = open( parameterPath.c_str(),  O_WRONLY | O_CLOEXEC );
     if( fileDescriptor >= 0 )
     {
-        errno=0;
-        write( fileDescriptor, value, valueLen );
-        int errorCode = errno;
-        close( fileDescriptor );
-        
-        // Build a verbose error for the user.
-        if ( errorCode != 0 )
-        {
-            csmi_cmd_err_t err = CSMERR_CGROUP_FAIL;
-
-            std::string error("Unable to write to parameter ");
-            error.append(parameterPath);
-
-            if( value ) 
-                error.append("; Value : ").append(std::string((const char*)value, valueLen));
-            
-            error.append("; Error : ").append(strerror(errorCode)); 
-            switch (errorCode){
-                case EINVAL:
-                    error.append("; This error typically means the value written to the"
-                        " cgroup parameter was invalid.");
-                    err = CSMERR_CGROUP_EINVAL;
-                    break;
-                case EACCES:
-                    error.append("; This error typically means the resources being requested are "
-                        "invalid.");
-                    err = CSMERR_CGROUP_EACCES;
-                    break;
-            }
-            //LOG( csmapi, error ) << _LOG_PREFIX << error;
-
-            throw CSMHandlerException( error, err );
-        }
+        WriteToDescriptor( fileDescriptor, parameterPath, value, valueLen );
     }
     else
     {
@@ -1235,6 +1389,46 @@ void CGroup::WriteToParameter(
     //LOG( csmapi, trace ) << _LOG_PREFIX "WriteToParameter Exit";
 }
 
+void CGroup::WriteToParameter( 
+    int groupDescriptor,
+    const char* parameter, 
+    const std::string& groupController, 
+    const void* value, 
+    const size_t valueLen )
+{
+    // Open the parameter file relative to the group, skipping the path walk.
+    errno=0;
+    int fileDescriptor = openat( groupDescriptor, parameter, O_WRONLY | O_CLOEXEC );
+    if( fileDescriptor >= 0 )
+    {
+        WriteToDescriptor( fileDescriptor, groupController + parameter, value, valueLen );
+    }
+    else
+    {
+        std::string error = "WriteToParameter; Error unable to open parameter: " +
+            groupController + parameter + "; Error: ";
+        error.append(strerror(errno));
+
+        throw CSMHandlerException( error, CSMERR_CGROUP_FAIL );
+    }
+}
+
+int CGroup::OpenGroup( const std::string& groupController )
+{
+    errno=0;
+    int groupDescriptor = open( groupController.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC );
+    if( groupDescriptor < 0 )
+    {
+        std::string error = "OpenGroup; Error unable to open cgroup: " +
+            groupController + "; Error: ";
+        error.append(strerror(errno));
+
+        throw CSMHandlerException( error, CSMERR_CGROUP_FAIL );
+    }
+
+    return groupDescriptor;
+}
+
 int64_t CGroup::ReadNumeric( const std::string component ) const 
 {
     int64_t value = -1;
@@ -1342,7 +1536,6 @@ uint64_t CGroup::MigrateTasks(
                     " could not be transfered: " << strerror(errno);
             }
         }
-        syncfs(fileDescriptor);
 
         close( fileDescriptor );
     } 
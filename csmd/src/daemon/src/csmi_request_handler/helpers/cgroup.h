@@ -109,6 +109,21 @@ public:
                         csmi_cgroup_t* component, 
                         pid_t pid = 0 ) const ;
 
+    /**@brief Creates a CGroup for each of the specified components in parallel.
+     * Each component is written by its own thread, see @ref CreateCGroup.
+     *
+     * @param[in] cgroupName    The name of the cgroup to create.
+     * @param[in] components    The cgroup structs containing the controller type,
+     *                            parameters and values.
+     * @param[in] numComponents The number of entries in @p components.
+     * @param[in] pid           A PID to place in the tasks file of each cgroup, optional.
+     *
+     * @throw CSMHandlerException If any of the cgroups could not be created.
+     */
+    void CreateCGroups( const char* cgroupName, 
+                        csmi_cgroup_t** components, 
+                        uint32_t numComponents,
+                        pid_t pid = 0 ) const ;
 
     /** @brief Deletes the specified cgroup.
      *
@@ -141,13 +156,19 @@ public:
      * @brief Wait for the pid to appear in the task list of the allocation cgroup*
      * This function is to be used in conjunction with @ref MigratePid asynchronously.
      *
+     * If @p notifyFd is supplied the wait blocks on it until the migrating process
+     * closes (or writes to) the other end, otherwise the membership of the pid is
+     * polled with a short backoff.
+     *
      * @param[in] pid The process id to to scan the tasks file for.
      * @param[in] sleepAttempts The number of times to wait for the pid write to be a success.
      * @param[in] sleepTime The time in seconds to wait between pid tests.
+     * @param[in] notifyFd The read end of a pipe held open by the migrating process, optional.
      *
      * @return True if the pid was successfully migrated.
      */
-    bool WaitPidMigration(pid_t pid, uint32_t sleepAttempts=3, uint32_t sleepTime=1) const;
+    bool WaitPidMigration(pid_t pid, uint32_t sleepAttempts=3, uint32_t sleepTime=1, 
+        int notifyFd=-1) const;
 
     /**
      * @brief Performs the configuration step on the cgroups created by @ref SetupCGroups.
@@ -269,6 +290,39 @@ private:
     static void WriteToParameter( const char* parameter, const std::string& groupController,
         const void* value, const size_t valueLen );
 
+    /** @brief Write the supplied value to the specified parameter relative to an open group.
+     *
+     * @param[in] groupDescriptor The open directory of the group, see @ref OpenGroup.
+     * @param[in] parameter The parameter to write to (e.g. "cpuset.cpus"), relative to the group.
+     * @param[in] groupController The path of the group, used for error reporting.
+     * @param[in] value The value to write to the parameter (typically either an int or char*).
+     * @param[in] valueLen The length of the written value.
+     *
+     * @throw CSMHandlerException If the parameter couldn't be open or written to.
+     */
+    static void WriteToParameter( int groupDescriptor, const char* parameter, 
+        const std::string& groupController, const void* value, const size_t valueLen );
+
+    /** @brief Opens the directory of a group so its parameters can be written with openat.
+     *
+     * @param[in] groupController The path of the group (e.g. "/sys/fs/cgroup/cpuset/allocation_1/")
+     *
+     * @return The directory file descriptor, the invoker is responsible for closing it.
+     *
+     * @throw CSMHandlerException If the directory couldn't be opened.
+     */
+    static int OpenGroup( const std::string& groupController );
+
+    /** @brief Determines which controllers already list the pid in the allocation cgroup.
+     * Parses /proc/<pid>/cgroup rather than scanning each tasks file.
+     *
+     * @param[in] pid The process id to check.
+     *
+     * @return The first controller the pid has not been migrated to, 
+     *      csm_enum_max(csmi_cgroup_controller_t) if the pid is in all of them.
+     */
+    uint32_t CheckPidMigration( pid_t pid ) const;
+
     /**
      * @brief Reads a numeric value from the supplied component.
      *
@@ -356,6 +410,16 @@ private:
      */
     void GetCoreIsolation(int64_t cores, std::string &sysCores, std::string &groupCores);
 
+    /**
+     * @brief Restricts the cpuset of a shared allocation to cores not reserved by other allocations.
+     *
+     * @param[in] cpuCGroup The cpuset cgroup of the allocation.
+     * @param[in] cpusetRoot The root of the cpuset controller.
+     * @param[in] numProcessors The number of cores to assign to the allocation.
+     */
+    void ConfigSharedCpuset(const std::string& cpuCGroup, const std::string& cpusetRoot, 
+        int32_t numProcessors) const;
+
 public:
     /** @brief Retrieve the node's cpu counts.
      *
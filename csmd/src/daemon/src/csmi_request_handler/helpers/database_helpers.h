@@ -95,6 +95,44 @@ inline bool InspectDBResult(
     return InspectDBResult(dbResp, errcode, errmsg);
 }
 
+/** @name Typed result fields
+ * @brief Decode a field of a text or binary result into a struct member, picked by the member type.
+ *
+ * Meant for X-macro expansions of a csmi struct definition, see CSMINodeAttributesQuery.
+ * NULL leaves numeric members at their init value; strings become empty as they are in tuples.
+ * @{*/
+inline void ReadResultField( csm::db::DBResult_sptr dbRes, int row, int col, char* &value )
+{
+    std::string time;
+    value = strdup( dbRes->GetTimestampString( row, col, time ) ? time.c_str() : dbRes->GetValue( row, col ) );
+}
+
+inline void ReadResultField( csm::db::DBResult_sptr dbRes, int row, int col, int64_t &value )
+{
+    int64_t number;
+    if ( dbRes->GetInt64( row, col, number ) ) value = number;
+}
+
+inline void ReadResultField( csm::db::DBResult_sptr dbRes, int row, int col, int32_t &value )
+{
+    int64_t number;
+    if ( dbRes->GetInt64( row, col, number ) ) value = number;
+}
+
+inline void ReadResultField( csm::db::DBResult_sptr dbRes, int row, int col, uint32_t &value )
+{
+    int64_t number;
+    if ( dbRes->GetInt64( row, col, number ) ) value = number;
+}
+
+/** @brief csm_bool */
+inline void ReadResultField( csm::db::DBResult_sptr dbRes, int row, int col, char &value )
+{
+    bool flag;
+    if ( dbRes->GetBool( row, col, flag ) ) value = flag ? 1 : 0;
+}
+/** @} */
+
 } // End namespace helpers
 } // End namespace daemon
 } // End namespace csm
@@ -32,8 +32,6 @@ std::map<boost::thread::id, std::string> csm::daemon::ThreadPool::TidToHandlerMa
 
 std::mutex csm::daemon::ThreadPool::LockForCrashedThreadList;
 std::mutex csm::daemon::ThreadPool::LockForTidToHandlerMap;
-
-std::map<CSMI_BASE *, csm::daemon::ThreadPool::strand_sptr> csm::daemon::ThreadPool::HandlerToStrand;
  
 void csm::daemon::ThreadPool::Recover(bool doRecreate)
 {
@@ -67,6 +65,8 @@ void csm::daemon::ThreadPool::Recover(bool doRecreate)
     LOG(csmd, debug) << "ThreadPool::Recover(): Next, recreate the thread for the crashed one " << tid;
     
     TidToThreadMap.erase(tid);
+    unsigned slot = _TidToSlot[tid];
+    _TidToSlot.erase(tid);
     // sanity check: before removing it from thread_group, check if the thread is in
     if ( !_thread_grp.is_thread_in( thd ) )
     {
@@ -74,7 +74,7 @@ void csm::daemon::ThreadPool::Recover(bool doRecreate)
     }
     _thread_grp.remove_thread(thd);
     
-    if (doRecreate) addThread();
+    if (doRecreate) addThread( slot );
     
     { // start locking
     std::lock_guard<std::mutex> guard(LockForTidToHandlerMap);
@@ -98,6 +98,8 @@ int ParseCommandLineOptions( int argc, char **argv, CtrlCmdOption &o_cmd_option
         ("help,h", "Show this help")
         ("dump_perf_data",
             "Dump the performance data")
+        ("dump_metrics",
+            "Dump the latency percentiles and queue depths")
 /*
         ("dump_mem_usage",
             "Dump current memory usage")
@@ -232,6 +234,12 @@ int ParseCommandLineOptions( int argc, char **argv, CtrlCmdOption &o_cmd_option
     count++;
   }
 
+  if( vm.count( "dump_metrics" ) )
+  {
+    o_cmd_option.set_dump_metrics();
+    count++;
+  }
+
   if( vm.count( "agg.reset"))
   {
     o_cmd_option.set_agg_reset();
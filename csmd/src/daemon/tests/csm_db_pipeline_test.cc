@@ -0,0 +1,153 @@
+/*================================================================================
+
+    csmd/src/daemon/tests/csm_db_pipeline_test.cc
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+
+#include <sys/epoll.h>
+#include <string.h>
+
+#include <chrono>
+#include <climits>
+#include <deque>
+#include <thread>
+
+#include <logging.h>
+#include "csm_test_utils.h"
+#include "include/csm_db_inflight.h"
+
+struct Request
+{
+  int _Id;
+};
+
+static PGresult* MakeResult( ExecStatusType aStatus )
+{
+  return PQmakeEmptyPGresult( nullptr, aStatus );
+}
+
+int main( int argc, char **argv )
+{
+  int rc = 0;
+  Request req[ 4 ] = { { 0 }, { 1 }, { 2 }, { 3 } };
+  PGresult *res = nullptr;
+
+  // requests complete in order of submission, each with the result collected before
+  csm::daemon::DBInFlight<Request> inflight;
+  rc += TEST( inflight.Empty(), true );
+  inflight.Push( &req[ 0 ] );
+  inflight.Push( &req[ 1 ] );
+  inflight.Push( &req[ 2 ] );
+  rc += TEST( inflight.Size(), 3 );
+
+  PGresult *first = MakeResult( PGRES_COMMAND_OK );
+  inflight.Collect( first );
+  rc += TEST( inflight.Complete( &res ), &req[ 0 ] );
+  rc += TEST( res, first );
+  PQ_RES_FREE( res );
+
+  // the last result of a request wins
+  PGresult *last = MakeResult( PGRES_TUPLES_OK );
+  inflight.Collect( MakeResult( PGRES_COMMAND_OK ) );
+  inflight.Collect( last );
+  rc += TEST( inflight.Complete( &res ), &req[ 1 ] );
+  rc += TEST( res, last );
+  PQ_RES_FREE( res );
+
+  // unless an error came first, which is what the request gets
+  PGresult *error = MakeResult( PGRES_FATAL_ERROR );
+  inflight.Collect( error );
+  inflight.Collect( MakeResult( PGRES_TUPLES_OK ) );
+  rc += TEST( inflight.Complete( &res ), &req[ 2 ] );
+  rc += TEST( res, error );
+  rc += TEST( PQ_RES_SUCCESS( res ), false );
+  PQ_RES_FREE( res );
+
+  // no result at all is a failed request, nothing is left over from the one before
+  inflight.Push( &req[ 3 ] );
+  rc += TEST( inflight.Complete( &res ), &req[ 3 ] );
+  rc += TEST( res, nullptr );
+  rc += TEST( inflight.Empty(), true );
+
+  // a failed connection hands everything back, restoring to the front keeps the order
+  std::deque<Request*> queue;
+  queue.push_back( &req[ 3 ] );
+  for( int i = 0; i < 3; ++i )
+    inflight.Push( &req[ i ] );
+  inflight.Collect( MakeResult( PGRES_TUPLES_OK ) );  // freed by Fail
+  rc += TEST( inflight.Fail( [&queue]( Request *aRequest ) { queue.push_front( aRequest ); } ), 3 );
+  rc += TEST( inflight.Empty(), true );
+  rc += TEST( queue.size(), 4 );
+  for( int i = 0; i < 4; ++i )
+    rc += TEST( queue[ i ]->_Id, i );
+
+  // and the next request doesn't see a result of the failed ones
+  inflight.Push( &req[ 0 ] );
+  inflight.Complete( &res );
+  rc += TEST( res, nullptr );
+  rc += TEST( inflight.Fail( []( Request *aRequest ) {} ), 0 );
+
+  // failures in a row double the hold back time up to the max, a completed request resets it
+  const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  csm::daemon::DBFailBackOff backoff( 1, 1000 );
+  rc += TEST( backoff.CanDispatch( now ), true );
+  rc += TEST( backoff.Failed( now ), 1 );
+  rc += TEST( backoff.CanDispatch( now ), false );
+  rc += TEST( backoff.CanDispatch( now + std::chrono::milliseconds( 1 ) ), true );
+  rc += TEST( backoff.Failed( now ), 2 );
+  rc += TEST( backoff.Failed( now ), 4 );
+  rc += TEST( backoff.CanDispatch( now + std::chrono::milliseconds( 3 ) ), false );
+  for( int i = 3; i < 40; ++i )
+    backoff.Failed( now );
+  rc += TEST( backoff.GetStreak(), 40 );
+  rc += TEST( backoff.Failed( now ), 1000 );
+  rc += TEST( backoff.CanDispatch( now + std::chrono::milliseconds( 999 ) ), false );
+
+  backoff.Succeeded();
+  rc += TEST( backoff.GetStreak(), 0 );
+  rc += TEST( backoff.CanDispatch( now ), true );
+  rc += TEST( backoff.Failed( now ), 1 );
+  rc += TEST( backoff.GetRetryAt() == now + std::chrono::milliseconds( 1 ), true );
+
+  // the epoll timeout ends at the deadline, not before
+  rc += TEST( csm::daemon::DBPollTimeout( now, now ), 0 );
+  rc += TEST( csm::daemon::DBPollTimeout( now - std::chrono::seconds( 1 ), now ), 0 );
+  rc += TEST( csm::daemon::DBPollTimeout( now + std::chrono::milliseconds( 5 ), now ), 5 );
+  rc += TEST( csm::daemon::DBPollTimeout( now + std::chrono::microseconds( 1 ), now ), 1 );
+  rc += TEST( csm::daemon::DBPollTimeout( now + std::chrono::hours( 24 * 365 ), now ), INT_MAX );
+
+  // queued requests wake up an epoll_wait without timeout, signals coalesce until drained
+  csm::daemon::DBRequestWakeup wakeup;
+  rc += TEST( wakeup.GetFD() >= 0, true );
+  int epfd = epoll_create1( EPOLL_CLOEXEC );
+  struct epoll_event ev;
+  memset( &ev, 0, sizeof( ev ) );
+  ev.events = EPOLLIN;
+  rc += TEST( epoll_ctl( epfd, EPOLL_CTL_ADD, wakeup.GetFD(), &ev ), 0 );
+  rc += TEST( epoll_wait( epfd, &ev, 1, 0 ), 0 );
+  rc += TEST( wakeup.Drain(), false );
+
+  std::thread poster( [&wakeup]() {
+    std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+    wakeup.Signal();
+    wakeup.Signal();
+  } );
+  rc += TEST( epoll_wait( epfd, &ev, 1, -1 ), 1 );
+  poster.join();
+  rc += TEST( wakeup.Drain(), true );
+  rc += TEST( epoll_wait( epfd, &ev, 1, 0 ), 0 );
+  rc += TEST( wakeup.Drain(), false );
+  close( epfd );
+
+  LOG(csmd, always) << "Test complete rc=" << rc;
+  return rc;
+}
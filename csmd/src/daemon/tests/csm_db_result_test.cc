@@ -0,0 +1,249 @@
+/*================================================================================
+
+    csmd/src/daemon/tests/csm_db_result_test.cc
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+
+#include <endian.h>
+#include <string>
+#include <vector>
+
+#include <logging.h>
+#include "csm_test_utils.h"
+#include "csmd/src/db/include/DBResult.h"
+#include "csmd/src/daemon/src/csmi_request_handler/CSMIAllocationQueryDetails.h"
+
+// builds a one row result the way libpq would hand it out
+static PGresult* MakeResult( int format, const std::vector<Oid> &types,
+                             const std::vector<std::string> &values,
+                             const std::vector<std::string> &names = {} )
+{
+  PGresult *res = PQmakeEmptyPGresult( nullptr, PGRES_TUPLES_OK );
+  std::vector<PGresAttDesc> attrs( types.size() );
+  for( size_t i = 0; i < types.size(); ++i )
+  {
+    attrs[ i ] = PGresAttDesc();
+    attrs[ i ].name = (char*)( i < names.size() ? names[ i ].c_str() : "c" );
+    attrs[ i ].format = format;
+    attrs[ i ].typid = types[ i ];
+  }
+  PQsetResultAttrs( res, attrs.size(), attrs.data() );
+  for( size_t i = 0; i < values.size(); ++i )
+    PQsetvalue( res, 0, i, (char*)values[ i ].data(), values[ i ].size() );
+  return res;
+}
+
+static std::string BE32( uint32_t v ) { v = htobe32( v ); return std::string( (char*)&v, sizeof(v) ); }
+static std::string BE64( uint64_t v ) { v = htobe64( v ); return std::string( (char*)&v, sizeof(v) ); }
+
+// the output column names of a query, taken from the select list of its first SELECT
+static std::vector<std::string> SelectNames( const std::string &stmt )
+{
+  std::vector<std::string> names;
+  size_t begin = stmt.find( "SELECT " ) + 7;
+  size_t end = stmt.find( "FROM ", begin );
+  std::string item;
+  int depth = 0;
+  bool quoted = false;
+
+  for( size_t i = begin; i <= end; ++i )
+  {
+    char c = stmt[ i ];
+    if( c == '\'' ) quoted = !quoted;
+    else if( !quoted && c == '(' ) ++depth;
+    else if( !quoted && c == ')' ) --depth;
+
+    if( i == end || ( c == ',' && depth == 0 && !quoted ) )
+    {
+      item.erase( item.find_last_not_of( ' ' ) + 1 );
+      size_t cut = item.find_last_of( " ." );
+      names.push_back( cut == std::string::npos ? item : item.substr( cut + 1 ) );
+      item.clear();
+    }
+    else
+      item += c;
+  }
+  return names;
+}
+
+int main( int argc, char **argv )
+{
+  int rc = 0;
+
+  rc += TEST( csm::db::DBResult::FormatTimestamp( 0 ), std::string( "1970-01-01 00:00:00" ) );
+  rc += TEST( csm::db::DBResult::FormatTimestamp( INT64_C(1552305296120000) ),
+              std::string( "2019-03-11 11:54:56.12" ) );
+  rc += TEST( csm::db::DBResult::FormatTimestamp( -1 ), std::string( "1969-12-31 23:59:59.999999" ) );
+  rc += TEST( csm::db::DBResult::FormatTimestamp( INT64_C(1552305296120000), true ), std::string( "2019-03-11" ) );
+  rc += TEST( csm::db::DBResult::FormatTimestamp( INT64_MAX ), std::string( "infinity" ) );
+
+  // text results
+  {
+    csm::db::DBResult res( MakeResult( 0,
+        { csm::db::DB_INT8_OID, csm::db::DB_FLOAT8_OID, csm::db::DB_BOOL_OID,
+          csm::db::DB_TIMESTAMP_OID, csm::db::DB_TEXT_OID },
+        { "-42", "2.5", "t", "2019-03-11 11:54:56.12", "{a,\"b c\",NULL,\"d\\\"e\"}" } ));
+    int64_t i = 0;
+    double d = 0;
+    bool b = false;
+    int64_t ts = 0;
+    std::string s;
+    std::vector<std::string> arr;
+
+    rc += TEST( res.IsBinary(), false );
+    rc += TEST( res.GetFieldNumber( "c" ), 0 );
+    rc += TEST( res.GetFieldNumber( "missing" ), -1 );
+    rc += TEST( res.GetInt64( 0, 0, i ), true );
+    rc += TEST( i, -42 );
+    rc += TEST( res.GetDouble( 0, 1, d ), true );
+    rc += TEST( d, 2.5 );
+    rc += TEST( res.GetBool( 0, 2, b ), true );
+    rc += TEST( b, true );
+    rc += TEST( res.GetTimestamp( 0, 3, ts ), true );
+    rc += TEST( ts, INT64_C(1552305296120000) );
+    rc += TEST( res.GetTimestampString( 0, 3, s ), true );
+    rc += TEST( s, std::string( "2019-03-11 11:54:56.12" ) );
+    rc += TEST( res.GetTextArray( 0, 4, arr ), true );
+    rc += TEST( arr.size(), 4 );
+    rc += TEST( arr[ 1 ], std::string( "b c" ) );
+    rc += TEST( arr[ 2 ], std::string( "" ) );
+    rc += TEST( arr[ 3 ], std::string( "d\"e" ) );
+
+    // text that isn't a number doesn't touch the output
+    i = 7;
+    rc += TEST( res.GetInt64( 0, 4, i ), false );
+    rc += TEST( i, 7 );
+  }
+
+  // binary results
+  {
+    const int64_t pgEpoch = INT64_C(946684800000000);
+    double f8 = -0.25;
+    uint64_t f8bits;
+    memcpy( &f8bits, &f8, sizeof(f8bits) );
+
+    std::string array = BE32( 1 ) + BE32( 1 ) + BE32( csm::db::DB_TEXT_OID ) + BE32( 3 ) + BE32( 1 ) +
+                        BE32( 3 ) + "abc" + BE32( 0xFFFFFFFF ) + BE32( 1 ) + "z";
+
+    csm::db::DBResult res( MakeResult( 1,
+        { csm::db::DB_INT4_OID, csm::db::DB_FLOAT8_OID, csm::db::DB_BOOL_OID,
+          csm::db::DB_TIMESTAMP_OID, 1009, csm::db::DB_TEXT_OID, csm::db::DB_INT8_OID },
+        { BE32( (uint32_t)-5 ), BE64( f8bits ), std::string( 1, '\0' ),
+          BE64( INT64_C(1552305296120000) - pgEpoch ), array, "IN_SERVICE", BE64( 1ULL << 40 ) } ));
+    int64_t i = 0;
+    double d = 0;
+    bool b = true;
+    std::string s;
+    std::vector<std::string> arr;
+
+    rc += TEST( res.IsBinary(), true );
+    rc += TEST( res.GetInt64( 0, 0, i ), true );
+    rc += TEST( i, -5 );
+    rc += TEST( res.GetInt64( 0, 6, i ), true );
+    rc += TEST( i, INT64_C(1) << 40 );
+    rc += TEST( res.GetDouble( 0, 1, d ), true );
+    rc += TEST( d, -0.25 );
+    rc += TEST( res.GetDouble( 0, 0, d ), true );
+    rc += TEST( d, -5.0 );
+    rc += TEST( res.GetBool( 0, 2, b ), true );
+    rc += TEST( b, false );
+    rc += TEST( res.GetTimestampString( 0, 3, s ), true );
+    rc += TEST( s, std::string( "2019-03-11 11:54:56.12" ) );
+    rc += TEST( res.GetTextArray( 0, 4, arr ), true );
+    rc += TEST( arr.size(), 3 );
+    rc += TEST( arr[ 0 ], std::string( "abc" ) );
+    rc += TEST( arr[ 1 ], std::string( "" ) );
+    rc += TEST( arr[ 2 ], std::string( "z" ) );
+    rc += TEST( std::string( res.GetValue( 0, 5 ) ), std::string( "IN_SERVICE" ) );
+
+    // a type mismatch is refused instead of misinterpreted
+    rc += TEST( res.GetInt64( 0, 1, i ), false );
+  }
+
+  // timestamptz: the text result is in the session time zone, both formats print UTC
+  {
+    const int64_t pgEpoch = INT64_C(946684800000000);
+    const int64_t bc = INT64_C(-62167219200000000); // 0001-01-01 00:00:00 BC
+    std::string array = BE32( 1 ) + BE32( 0 ) + BE32( csm::db::DB_TIMESTAMPTZ_OID ) + BE32( 2 ) + BE32( 1 ) +
+                        BE32( 8 ) + BE64( INT64_C(1552305296120000) - pgEpoch ) + BE32( 8 ) + BE64( bc - pgEpoch );
+
+    csm::db::DBResult text( MakeResult( 0,
+        { csm::db::DB_TIMESTAMPTZ_OID, csm::db::DB_TIMESTAMPTZ_OID, csm::db::DB_TIMESTAMPTZ_OID,
+          csm::db::DB_TIMESTAMPTZ_ARRAY_OID },
+        { "2019-03-11 13:54:56.12+02", "infinity", "0001-01-01 02:00:00+02 BC",
+          "{\"2019-03-11 07:24:56.12-04:30\",\"0001-01-01 02:00:00+02 BC\"}" } ));
+    csm::db::DBResult binary( MakeResult( 1,
+        { csm::db::DB_TIMESTAMPTZ_OID, csm::db::DB_TIMESTAMPTZ_OID, csm::db::DB_TIMESTAMPTZ_OID,
+          csm::db::DB_TIMESTAMPTZ_ARRAY_OID },
+        { BE64( INT64_C(1552305296120000) - pgEpoch ), BE64( INT64_MAX ), BE64( bc - pgEpoch ), array } ));
+    const char *expected[] = { "2019-03-11 11:54:56.12+00", "infinity", "0001-01-01 00:00:00+00 BC" };
+    std::string s, b;
+    std::vector<std::string> textArr, binaryArr;
+
+    for( int col = 0; col < 3; ++col )
+    {
+      rc += TEST( text.GetTimestampString( 0, col, s ), true );
+      rc += TEST( binary.GetTimestampString( 0, col, b ), true );
+      rc += TEST( s, std::string( expected[ col ] ) );
+      rc += TEST( s, b );
+    }
+    rc += TEST( text.GetTextArray( 0, 3, textArr ), true );
+    rc += TEST( binary.GetTextArray( 0, 3, binaryArr ), true );
+    rc += TEST( textArr.size(), 2 );
+    rc += TEST( textArr == binaryArr, true );
+    rc += TEST( textArr[ 0 ], std::string( expected[ 0 ] ) );
+  }
+
+  // NULL fields
+  {
+    PGresult *pgres = MakeResult( 1, { csm::db::DB_INT8_OID }, {} );
+    PQsetvalue( pgres, 0, 0, nullptr, -1 );
+    csm::db::DBResult res( pgres );
+    int64_t i = -1;
+    rc += TEST( res.IsNull( 0, 0 ), true );
+    rc += TEST( res.GetInt64( 0, 0, i ), false );
+    rc += TEST( i, -1 );
+  }
+
+  // allocation steps: every member of the step struct has a column in the step query
+  {
+    std::vector<std::string> names = SelectNames( CSMIAllocationQueryDetails::StepQuery() );
+    rc += TEST( names.size(), 4 );
+
+    std::vector<Oid> types;
+    std::vector<std::string> values;
+    for( const std::string &name : names )
+    {
+      if( name == "step_id" )        { types.push_back( csm::db::DB_INT8_OID ); values.push_back( BE64( 7 ) ); }
+      else if( name == "num_nodes" ) { types.push_back( csm::db::DB_INT4_OID ); values.push_back( BE32( 2 ) ); }
+      else                           { types.push_back( csm::db::DB_TEXT_OID ); values.push_back( name == "compute_nodes" ? "c01,c02" : "" ); }
+    }
+
+    csm::db::DBResult_sptr res = std::make_shared<csm::db::DBResult>( MakeResult( 1, types, values, names ) );
+    std::vector<int> columns = CSMIAllocationQueryDetails::StepColumns( res );
+    int unmapped = 0;
+    for( int col : columns )
+      if( col < 0 ) ++unmapped;
+    rc += TEST( unmapped, 0 );
+
+    csmi_allocation_step_list_t *step = nullptr;
+    CSMIAllocationQueryDetails::CreateOutputStruct( res, 0, columns, &step );
+    rc += TEST( step->step_id, 7 );
+    rc += TEST( step->num_nodes, 2 );
+    rc += TEST( step->compute_nodes != nullptr, true );
+    rc += TEST( std::string( step->compute_nodes ? step->compute_nodes : "" ), std::string( "c01,c02" ) );
+    csm_free_struct_ptr( csmi_allocation_step_list_t, step );
+  }
+
+  LOG(csmd, always) << "Test complete rc=" << rc;
+  return rc;
+}
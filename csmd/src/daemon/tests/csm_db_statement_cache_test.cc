@@ -0,0 +1,98 @@
+/*================================================================================
+
+    csmd/src/daemon/tests/csm_db_statement_cache_test.cc
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+
+#include <string>
+#include <vector>
+
+#include <logging.h>
+#include "csm_test_utils.h"
+#include "csmd/src/db/include/DBStatementCache.h"
+
+int main( int argc, char **argv )
+{
+  int rc = 0;
+
+  // normalization collapses whitespace, but not inside of literals
+  rc += TEST( csm::db::DBStatementCache::Normalize( "  SELECT a,\n\t b   FROM t WHERE x = $1 " ),
+              std::string( "SELECT a, b FROM t WHERE x = $1" ) );
+  rc += TEST( csm::db::DBStatementCache::Normalize( "SELECT 'a  b'  ,  \"C  d\" FROM t" ),
+              std::string( "SELECT 'a  b' , \"C  d\" FROM t" ) );
+  rc += TEST( csm::db::DBStatementCache::Normalize( "SELECT $$ a  b $$" ),
+              std::string( "SELECT $$ a  b $$" ) );
+  rc += TEST( csm::db::DBStatementCache::Normalize( "SELECT /* a  b */ 1" ),
+              std::string( "SELECT /* a  b */ 1" ) );
+
+  // an escaped quote does not end an E'...' literal, a doubled quote doesn't end any literal
+  rc += TEST( csm::db::DBStatementCache::Normalize( "SELECT E'a\\'  b'  ,  e'\\\\'  FROM t" ),
+              std::string( "SELECT E'a\\'  b' , e'\\\\' FROM t" ) );
+  rc += TEST( csm::db::DBStatementCache::Normalize( "SELECT E'a''  \\'  b' ,  'c''  d'" ),
+              std::string( "SELECT E'a''  \\'  b' , 'c''  d'" ) );
+  rc += TEST( csm::db::DBStatementCache::Normalize( "SELECT name'a  b'" ),
+              std::string( "SELECT name'a  b'" ) );
+
+  // line comments are whitespace, but not inside of literals
+  rc += TEST( csm::db::DBStatementCache::Normalize( "SELECT a -- first  column\n , '--  b'--x" ),
+              std::string( "SELECT a , '--  b'" ) );
+  rc += TEST( csm::db::DBStatementCache::Normalize( "SELECT a--x\nFROM t" ),
+              std::string( "SELECT a FROM t" ) );
+
+  csm::db::DBStatementCache cache( 2 );
+  std::vector<std::string> evicted;
+
+  rc += TEST( cache.IsEnabled(), true );
+  rc += TEST( cache.Lookup( "q1" ), nullptr );
+
+  std::string n1 = cache.Insert( "q1", evicted );
+  std::string n2 = cache.Insert( "q2", evicted );
+  rc += TEST( evicted.empty(), true );
+  rc += TEST( n1 != n2, true );
+  rc += TEST( *cache.Lookup( "q1" ), n1 );
+
+  // q2 is least recently used now
+  std::string n3 = cache.Insert( "q3", evicted );
+  rc += TEST( evicted.size(), 1 );
+  rc += TEST( evicted[ 0 ], n2 );
+  rc += TEST( cache.Lookup( "q2" ), nullptr );
+  rc += TEST( cache.GetSize(), 2 );
+
+  // names are never reused
+  cache.Erase( "q1" );
+  std::string n4 = cache.Insert( "q1", evicted );
+  rc += TEST( n4 != n1, true );
+  rc += TEST( n4 != n3, true );
+
+  cache.Clear();
+  rc += TEST( cache.GetSize(), 0 );
+  rc += TEST( cache.Lookup( "q3" ), nullptr );
+
+  // statements are only worth preparing after a few uses
+  csm::db::DBStatementCache counted( 2, 3 );
+  rc += TEST( counted.CountUse( "q1" ), false );
+  rc += TEST( counted.CountUse( "q2" ), false );
+  rc += TEST( counted.CountUse( "q1" ), false );
+  rc += TEST( counted.CountUse( "q1" ), true );
+  rc += TEST( counted.CountUse( "q2" ), false );
+  counted.Clear();
+  rc += TEST( counted.CountUse( "q2" ), false );
+
+  csm::db::DBStatementCache eager( 2, 1 );
+  rc += TEST( eager.CountUse( "q1" ), true );
+
+  csm::db::DBStatementCache disabled( 0 );
+  rc += TEST( disabled.IsEnabled(), false );
+
+  LOG(csmd, always) << "Test complete rc=" << rc;
+  return rc;
+}
@@ -0,0 +1,101 @@
+/*================================================================================
+
+    csmd/src/daemon/tests/csm_metrics_test.cc
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+
+#include <thread>
+#include <vector>
+
+#include <logging.h>
+#include "csm_test_utils.h"
+#include "include/csm_metrics.h"
+
+#define THREADS ( 4 )
+#define RECORDS_PER_THREAD ( 10000 )
+
+int main( int argc, char **argv )
+{
+  int rc = 0;
+
+  // buckets are contiguous and every value is within its bucket
+  {
+    unsigned last = 0;
+    for( uint64_t v = 0; v < 100000; ++v )
+    {
+      unsigned idx = csm::daemon::LatencyHistogram::BucketIndex( v );
+      rc += TEST( ( idx == last ) || ( idx == last + 1 ), true );
+      rc += TEST( v <= csm::daemon::LatencyHistogram::BucketUpperBound( idx ), true );
+      last = idx;
+    }
+    rc += TEST( csm::daemon::LatencyHistogram::BucketIndex( UINT64_MAX ) < CSM_METRICS_BUCKETS, true );
+    rc += TEST( csm::daemon::LatencyHistogram::BucketUpperBound( CSM_METRICS_BUCKETS - 1 ), UINT64_MAX );
+  }
+
+  // percentiles of a uniform distribution are within the bucket error
+  {
+    csm::daemon::LatencyHistogram histogram;
+    for( uint64_t v = 1; v <= 1000; ++v )
+      histogram.Record( v );
+
+    csm::daemon::LatencySnapshot snapshot;
+    snapshot.Add( histogram );
+    rc += TEST( snapshot.GetCount(), 1000 );
+    rc += TEST( snapshot.GetMean(), 500 );
+    uint64_t p50 = snapshot.GetPercentile( 0.5 );
+    uint64_t p99 = snapshot.GetPercentile( 0.99 );
+    rc += TEST( ( p50 >= 500 ) && ( p50 <= 500 * 9 / 8 ), true );
+    rc += TEST( ( p99 >= 990 ) && ( p99 <= 990 * 9 / 8 ), true );
+    rc += TEST( snapshot.GetMax() >= 1000, true );
+
+    csm::daemon::LatencySnapshot empty;
+    rc += TEST( empty.GetPercentile( 0.5 ), 0 );
+    rc += TEST( empty.GetMax(), 0 );
+  }
+
+  // records from several threads are merged, exports only report the interval
+  {
+    csm::daemon::Metrics &metrics = csm::daemon::Metrics::Instance();
+
+    std::vector<std::thread> threads;
+    for( int t = 0; t < THREADS; ++t )
+      threads.push_back( std::thread( [ &metrics ]()
+      {
+        for( int i = 0; i < RECORDS_PER_THREAD; ++i )
+          metrics.Record( CSM_CMD_ECHO, csm::daemon::METRICS_DB_WAIT, i );
+      } ) );
+    for( auto &t : threads )
+      t.join();
+
+    metrics.RegisterGauge( "test.gauge", []() { return (int64_t)42; } );
+
+    std::string dump = metrics.Dump();
+    rc += TEST( dump.find( "db_wait" ) != std::string::npos, true );
+    rc += TEST( dump.find( std::to_string( THREADS * RECORDS_PER_THREAD ) ) != std::string::npos, true );
+    rc += TEST( dump.find( "test.gauge = 42" ) != std::string::npos, true );
+
+    std::string json = metrics.GetJsonString( "node", "now" );
+    rc += TEST( json.find( "\"count\":" + std::to_string( THREADS * RECORDS_PER_THREAD ) ) != std::string::npos, true );
+    rc += TEST( json.find( "\"test.gauge\":42" ) != std::string::npos, true );
+
+    // nothing new since the previous export, only the gauges are left
+    metrics.UnregisterGauge( "test.gauge" );
+    rc += TEST( metrics.GetJsonString( "node", "now" ), std::string() );
+
+    metrics.Record( CSM_CMD_ECHO, csm::daemon::METRICS_DB_WAIT, 7 );
+    json = metrics.GetJsonString( "node", "now" );
+    rc += TEST( json.find( "\"count\":1," ) != std::string::npos, true );
+  }
+
+  LOG(csmd, always) << "Test complete rc=" << rc;
+  return rc;
+}
@@ -0,0 +1,191 @@
+/*================================================================================
+
+    csmd/src/daemon/tests/csm_work_executor_test.cc
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <logging.h>
+#include "csm_test_utils.h"
+#include "include/csm_work_executor.h"
+
+#define WORKERS ( 4 )
+#define OWNERS ( 8 )
+#define TASKS_PER_OWNER ( 5000 )
+// more owners than the fixed set of strands owners used to be hashed onto
+#define MANY_OWNERS ( 2048 )
+
+int main( int argc, char **argv )
+{
+  int rc = 0;
+
+  // queue basics including wrap-around and the full condition
+  {
+    csm::daemon::ExecutorQueue queue( 3 );
+    csm::daemon::ExecutorTask *tasks[ 5 ];
+    for( int i = 0; i < 5; ++i )
+      tasks[ i ] = new csm::daemon::ExecutorTask();
+
+    rc += TEST( queue.Pop(), nullptr );
+    for( int round = 0; round < 3; ++round )
+    {
+      for( int i = 0; i < 4; ++i )
+        rc += TEST( queue.Push( tasks[ i ] ), true );
+      rc += TEST( queue.Push( tasks[ 4 ] ), false );
+      rc += TEST( queue.SizeApprox(), 4 );
+      for( int i = 0; i < 4; ++i )
+        rc += TEST( queue.Pop(), tasks[ i ] );
+      rc += TEST( queue.Pop(), nullptr );
+    }
+    for( int i = 0; i < 5; ++i )
+      delete tasks[ i ];
+  }
+
+  // each owner gets its own strand, which is dropped once it is idle
+  {
+    csm::daemon::ExecutorStrandRegistry registry;
+    int owners[ 2 ];
+    bool idle = false;
+    csm::daemon::ExecutorStrand *s0 = registry.Push( &owners[ 0 ], []() {} );
+    rc += TESTFAIL( s0, nullptr );
+    // already scheduled
+    rc += TEST( registry.Push( &owners[ 0 ], []() {} ), nullptr );
+    csm::daemon::ExecutorStrand *s1 = registry.Push( &owners[ 1 ], []() {} );
+    rc += TESTFAIL( s1, nullptr );
+    rc += TESTFAIL( s1, s0 );
+    rc += TEST( registry.Size(), 2 );
+
+    // not dropped while a task is pending
+    registry.Release( &owners[ 0 ], s0 );
+    rc += TEST( registry.Size(), 2 );
+    s0->Run( 1, idle );
+    rc += TEST( idle, false );
+    s0->Run( 1, idle );
+    rc += TEST( idle, true );
+    registry.Release( &owners[ 0 ], s0 );
+    rc += TEST( registry.Size(), 1 );
+    // a runner that is late to release a dropped strand does not drop the new one
+    rc += TESTFAIL( registry.Push( &owners[ 0 ], []() {} ), nullptr );
+    registry.Release( &owners[ 0 ], s0 );
+    rc += TEST( registry.Size(), 2 );
+  }
+
+  // exceptions of a task end the worker; a worker started again for the slot runs the rest of the strand
+  {
+    csm::daemon::WorkStealingExecutor executor( 1 );
+    std::atomic<int> ran( 0 );
+    int caught = 0;
+    int owner;
+    std::thread worker( [ &executor, &caught ]()
+    {
+      while( true )
+      {
+        try { executor.WorkerLoop( 0 ); break; }
+        catch( int ) { ++caught; }
+      }
+    } );
+    executor.Submit( []() { throw 42; }, &owner );
+    executor.Submit( [ &ran ]() { ++ran; }, &owner );
+    executor.Submit( []() { throw 42; } );
+    executor.Submit( [ &ran ]() { ++ran; }, &owner );
+    executor.Shutdown();
+    worker.join();
+    rc += TEST( ran.load(), 2 );
+    rc += TEST( caught, 2 );
+    rc += TEST( executor.GetQueuedCount(), 0 );
+    rc += TEST( executor.GetStrandCount(), 0 );
+  }
+
+  // an owner blocked in a task does not hold up any other owner
+  {
+    csm::daemon::WorkStealingExecutor executor( 2 );
+    std::atomic<int> ran( 0 );
+    std::atomic<bool> unblocked( false );
+    int owner_ids[ MANY_OWNERS ];
+    std::vector<std::thread> threads;
+    for( unsigned i = 0; i < 2; ++i )
+      threads.push_back( std::thread( [ &executor, i ]() { executor.WorkerLoop( i ); } ) );
+
+    executor.Submit( [ &ran, &unblocked ]()
+    {
+      auto end = std::chrono::steady_clock::now() + std::chrono::seconds( 10 );
+      while(( ran.load() < MANY_OWNERS - 1 ) && ( std::chrono::steady_clock::now() < end ))
+        std::this_thread::yield();
+      unblocked = ( ran.load() == MANY_OWNERS - 1 );
+    }, &owner_ids[ 0 ] );
+    for( int o = 1; o < MANY_OWNERS; ++o )
+      executor.Submit( [ &ran ]() { ++ran; }, &owner_ids[ o ] );
+
+    executor.Shutdown();
+    for( auto &t : threads )
+      t.join();
+    rc += TEST( unblocked.load(), true );
+    rc += TEST( executor.GetStrandCount(), 0 );
+  }
+
+  // small queues force the overflow path; strands must keep the order per owner
+  {
+    csm::daemon::WorkStealingExecutor executor( WORKERS, 64 );
+    std::atomic<int> plain( 0 );
+    std::vector<int> last( OWNERS, -1 );
+    std::atomic<int> order_errors( 0 );
+    std::atomic<int> active[ OWNERS ];
+    std::atomic<int> overlap_errors( 0 );
+    int owner_ids[ OWNERS ];
+    for( int o = 0; o < OWNERS; ++o )
+      active[ o ].store( 0 );
+
+    std::vector<std::thread> threads;
+    for( unsigned i = 0; i < WORKERS; ++i )
+      threads.push_back( std::thread( [ &executor, i ]() { executor.WorkerLoop( i ); } ) );
+
+    for( int n = 0; n < TASKS_PER_OWNER; ++n )
+    {
+      for( int o = 0; o < OWNERS; ++o )
+      {
+        executor.Submit( [ &, o, n ]()
+        {
+          if( active[ o ].fetch_add( 1 ) != 0 )
+            ++overlap_errors;
+          if( last[ o ] != n - 1 )
+            ++order_errors;
+          last[ o ] = n;
+          active[ o ].fetch_sub( 1 );
+        }, &owner_ids[ o ] );
+      }
+      executor.Submit( [ &plain ]() { ++plain; } );
+    }
+
+    // tasks submitted from a worker stay with that worker's queue
+    executor.Submit( [ &executor, &plain ]() { executor.Submit( [ &plain ]() { ++plain; } ); } );
+
+    executor.Shutdown();
+    for( auto &t : threads )
+      t.join();
+
+    rc += TEST( plain.load(), TASKS_PER_OWNER + 1 );
+    rc += TEST( order_errors.load(), 0 );
+    rc += TEST( overlap_errors.load(), 0 );
+    rc += TEST( executor.GetQueuedCount(), 0 );
+    rc += TEST( executor.GetStrandCount(), 0 );
+    for( int o = 0; o < OWNERS; ++o )
+      rc += TEST( last[ o ], TASKS_PER_OWNER - 1 );
+    LOG( csmd, always ) << "steals: " << executor.GetStealCount();
+  }
+
+  LOG(csmd, always) << "Test complete rc=" << rc;
+  return rc;
+}
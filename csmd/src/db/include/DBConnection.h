@@ -20,10 +20,13 @@
 #include <libpq-fe.h>
 #include <memory>
 #include <string.h>
+#include <deque>
+#include <vector>
 
 #include "logging.h"
 #include "PostgreSql.h"
 #include "DBResult.h"
+#include "DBStatementCache.h"
 
 namespace csm {
 namespace db {
@@ -39,9 +42,10 @@ enum DBCONN_STATE {
 class DBConnection {
 
 public:
-  DBConnection(PGconn *aConn, unsigned aId)
+  DBConnection(PGconn *aConn, unsigned aId, unsigned aStatementCacheSize = 0)
   : _pg_conn(nullptr),
-    _id(aId)
+    _id(aId),
+    _stmt_cache(aStatementCacheSize)
   {
     _pg_conn = aConn;
     _state = DBCONN_FREE;
@@ -53,10 +57,14 @@ public:
   inline unsigned GetId() { return _id;}
   
     /** @brief Executes a parameterized sql query and generates the shared pointer.
+     *
+     * If the statement cache is enabled, the query is prepared once it was used
+     * DEFAULT_STATEMENT_PREPARE_AFTER times and executed as a prepared statement from then on.
      *
      * @param[in] command The paramerterized query.
      * @param[in] paramCount The number of parameters handled by the query.
      * @param[in] paramValues An array of parameters.
+     * @param[in] resultFormat 0 to receive the result in text format, 1 for binary.
      * const csm::db::DBReqContent &reqContent
      */
     inline csm::db::DBResult_sptr ExecParamSql(
@@ -64,19 +72,61 @@ public:
         int paramCount,
         const char * const *paramValues,
         const int * paramSizes,
-        const int * paramFormats )
+        const int * paramFormats,
+        int resultFormat = 0 )
     {
         csm::db::DBResult_sptr ret = nullptr;
+        PGresult *res = nullptr;
+
+        if ( _stmt_cache.IsEnabled() )
+        {
+            std::string key = DBStatementCache::Normalize( command );
+            const std::string *name = _stmt_cache.Lookup( key );
+            if (( name == nullptr ) && _stmt_cache.CountUse( key ))
+            {
+                FlushDeallocations();
+                std::vector<std::string> evicted;
+                name = &_stmt_cache.Insert( key, evicted );
+                _pending_dealloc.insert( _pending_dealloc.end(), evicted.begin(), evicted.end() );
 
-        PGresult *res = PQexecParams( 
-            _pg_conn, 
-            command,
-            paramCount,
-            NULL, 
-            paramValues,
-            paramSizes,
-            paramFormats,
-            0 );
+                res = PQprepare( _pg_conn, name->c_str(), command, paramCount, NULL );
+                if ( !res || !PQ_RES_SUCCESS(res) )
+                {
+                    // report the failure of the prepare, it's the same error the query would have
+                    _stmt_cache.Erase( key );
+                    return res ? std::make_shared<csm::db::DBResult>(res) : nullptr;
+                }
+                PQ_RES_FREE(res);
+                res = nullptr;
+            }
+
+            if ( name != nullptr )
+            {
+                res = PQexecPrepared( _pg_conn, name->c_str(), paramCount, paramValues, paramSizes, paramFormats, resultFormat );
+
+                // the server lost or invalidated the statement; retry unprepared unless it broke a transaction
+                if ( res && IsStalePrepared(res) )
+                {
+                    _stmt_cache.Erase( key );
+                    if ( PQtransactionStatus(_pg_conn) == PQTRANS_IDLE )
+                    {
+                        PQ_RES_FREE(res);
+                        res = nullptr;
+                    }
+                }
+            }
+        }
+
+        if ( res == nullptr )
+            res = PQexecParams( 
+                _pg_conn, 
+                command,
+                paramCount,
+                NULL, 
+                paramValues,
+                paramSizes,
+                paramFormats,
+                resultFormat );
 
         if ( res )
         {
@@ -97,6 +147,158 @@ public:
     return ret;
   }
   
+  /** @brief Switches the connection to non-blocking mode for the pipelined DB manager.
+   *
+   * @param[in] aPipelined Also enter libpq pipeline mode (if available) so that several
+   *                       requests can be queued on the connection before results are read.
+   *
+   * @return True if the connection is ready for asynchronous use.
+   */
+  inline bool EnterAsyncMode( const bool aPipelined )
+  {
+    if ( !_pg_conn || PQsetnonblocking(_pg_conn, 1) != 0 )
+      return false;
+    return SetPipelineMode( aPipelined );
+  }
+
+  /** @brief Restores the blocking, non-pipelined mode expected by the synchronous calls. */
+  inline void LeaveAsyncMode()
+  {
+    if (!_pg_conn) return;
+    SetPipelineMode( false );
+    PQsetnonblocking(_pg_conn, 0);
+
+    // statements prepared by requests that never completed are in unknown state
+    while ( !_async_prepared.empty() )
+    {
+      if ( _async_prepared.front()._Created )
+        ForgetPrepared( _async_prepared.front() );
+      _async_prepared.pop_front();
+    }
+    FlushDeallocations();
+  }
+
+  /** @brief Enters or exits pipeline mode; only possible while no results are pending.
+   *
+   * @return True if the connection is in the requested mode afterwards.
+   */
+  inline bool SetPipelineMode( const bool aPipelined )
+  {
+#ifdef LIBPQ_HAS_PIPELINING
+    if ( aPipelined == IsPipelined() )
+      return true;
+    if ( aPipelined )
+      return ( PQenterPipelineMode(_pg_conn) == 1 );
+    return ( PQexitPipelineMode(_pg_conn) == 1 );
+#else
+    return !aPipelined;
+#endif
+  }
+
+  inline bool IsPipelined() const
+  {
+#ifdef LIBPQ_HAS_PIPELINING
+    return ( _pg_conn && PQpipelineStatus(_pg_conn) != PQ_PIPELINE_OFF );
+#else
+    return false;
+#endif
+  }
+
+  /** @brief Queues a parameterized sql query without waiting for the result.
+   *
+   * In pipeline mode a sync point is queued after the query, so every request
+   * runs in its own implicit transaction and an error only affects this request.
+   *
+   * @return True if the query was queued, false if the connection failed.
+   */
+  inline bool SendParamSql(
+      const char *command,
+      int paramCount,
+      const char * const *paramValues,
+      const int * paramSizes,
+      const int * paramFormats,
+      int resultFormat = 0 )
+  {
+    AsyncPrepared prep;
+    if ( _stmt_cache.IsEnabled() )
+    {
+      prep._Key = DBStatementCache::Normalize( command );
+      const std::string *name = _stmt_cache.Lookup( prep._Key );
+
+      // a prepare can only be queued ahead of its execution in pipeline mode
+      if (( name == nullptr ) && IsPipelined() && _stmt_cache.CountUse( prep._Key ))
+      {
+        std::vector<std::string> evicted;
+        name = &_stmt_cache.Insert( prep._Key, evicted );
+        _pending_dealloc.insert( _pending_dealloc.end(), evicted.begin(), evicted.end() );
+        if ( PQsendPrepare( _pg_conn, name->c_str(), command, paramCount, NULL ) != 1 )
+        {
+          _stmt_cache.Erase( prep._Key );
+          return false;
+        }
+        prep._Created = true;
+      }
+      if ( name != nullptr )
+        prep._Name = *name;
+    }
+
+    int rc;
+    if ( prep._Name.empty() )
+      rc = PQsendQueryParams( _pg_conn, command, paramCount, NULL,
+                              paramValues, paramSizes, paramFormats, resultFormat );
+    else
+      rc = PQsendQueryPrepared( _pg_conn, prep._Name.c_str(), paramCount,
+                                paramValues, paramSizes, paramFormats, resultFormat );
+    _async_prepared.push_back( prep );
+    if ( rc != 1 )
+      return false;
+#ifdef LIBPQ_HAS_PIPELINING
+    if ( IsPipelined() && PQpipelineSync(_pg_conn) != 1 )
+      return false;
+#endif
+    return true;
+  }
+
+  /** @brief Queues a plain sql string; not allowed in pipeline mode since the string may contain several commands. */
+  inline bool SendSql(const char *sql)
+  {
+    if ( IsPipelined() ) return false;
+    _async_prepared.push_back( AsyncPrepared() );
+    return ( PQsendQuery(_pg_conn, sql) == 1 );
+  }
+
+  /** @brief Bookkeeping for the statement cache when an asynchronous request completed.
+   *
+   * Has to be called once per SendSql/SendParamSql in order of submission.
+   *
+   * @param[in] aRes The result that is returned for the request (may be nullptr).
+   */
+  inline void AsyncRequestDone( const PGresult *aRes )
+  {
+    if ( _async_prepared.empty() ) return;
+
+    AsyncPrepared prep = _async_prepared.front();
+    _async_prepared.pop_front();
+    if ( prep._Name.empty() ) return;
+
+    // a new statement might not have made it to the server; an old one might be stale
+    if (( aRes == nullptr ) || ( !PQ_RES_SUCCESS(aRes) && ( prep._Created || IsStalePrepared(aRes) )))
+      ForgetPrepared( prep );
+  }
+
+  /** @brief Flushes queued output. @return 0 if done, 1 if data remains to be sent, -1 on failure. */
+  inline int Flush() { return PQflush(_pg_conn); }
+
+  /** @brief Reads available input from the socket. @return False if the connection failed. */
+  inline bool ConsumeInput() { return ( PQconsumeInput(_pg_conn) == 1 ); }
+
+  inline bool IsBusy() { return ( PQisBusy(_pg_conn) == 1 ); }
+
+  /** @brief Returns the next result of the current request or nullptr at the end of the request. */
+  inline PGresult* GetNextResult() { return PQgetResult(_pg_conn); }
+
+  inline int GetSocket() const { return _pg_conn ? PQsocket(_pg_conn) : -1; }
+
   inline bool IsIdleConnection()
   {
     bool ret = (_pg_conn == nullptr)? false: (PQtransactionStatus(_pg_conn) == PQTRANS_IDLE);
@@ -126,8 +328,15 @@ public:
     if (status != PQTRANS_IDLE)
     {
       PQreset(_pg_conn);
+
+      // new server session, all prepared statements are gone
+      _stmt_cache.Clear();
+      _pending_dealloc.clear();
+      _async_prepared.clear();
     }
   }
+
+  inline const DBStatementCache& GetStatementCache() const { return _stmt_cache; }
   
   ~DBConnection()
   {
@@ -136,9 +345,51 @@ public:
   }
   
 private:
+  struct AsyncPrepared
+  {
+    std::string _Key;    ///< normalized statement text
+    std::string _Name;   ///< prepared statement used by the request, empty if unprepared
+    bool _Created;       ///< the request also prepared the statement
+
+    AsyncPrepared() : _Created( false ) {}
+  };
+
+  // invalid_sql_statement_name or a cached plan that doesn't match the table definitions anymore
+  static inline bool IsStalePrepared( const PGresult *aRes )
+  {
+    const char *state = PQresultErrorField( aRes, PG_DIAG_SQLSTATE );
+    return ( state != nullptr ) && (( strcmp( state, "26000" ) == 0 ) || ( strcmp( state, "0A000" ) == 0 ));
+  }
+
+  inline void ForgetPrepared( const AsyncPrepared &aPrep )
+  {
+    const std::string *name = _stmt_cache.Lookup( aPrep._Key );
+    if (( name != nullptr ) && ( *name == aPrep._Name ))
+      _stmt_cache.Erase( aPrep._Key );
+    _pending_dealloc.push_back( aPrep._Name );
+  }
+
+  // deallocate evicted statements; only outside of transactions and asynchronous requests
+  inline void FlushDeallocations()
+  {
+    if ( _pending_dealloc.empty() || !_pg_conn ||
+         PQisnonblocking(_pg_conn) || ( PQtransactionStatus(_pg_conn) != PQTRANS_IDLE ))
+      return;
+
+    for ( const std::string &name : _pending_dealloc )
+    {
+      PGresult *res = PQ_Exec( _pg_conn, ( "DEALLOCATE " + name ).c_str() );
+      if ( res ) PQ_RES_FREE( res );
+    }
+    _pending_dealloc.clear();
+  }
+
   PGconn* _pg_conn;
   unsigned _id;
   DBCONN_STATE _state;
+  DBStatementCache _stmt_cache;                 ///< statements prepared on this connection
+  std::vector<std::string> _pending_dealloc;    ///< evicted statements still allocated on the server
+  std::deque<AsyncPrepared> _async_prepared;    ///< statement cache state of requests in flight
 };
 
 typedef std::shared_ptr<DBConnection> DBConnection_sptr;
@@ -28,6 +28,7 @@
 #include "DBConnection.h"
 
 #define DEFAULT_CONNECTION_POOL_SIZE (1)
+#define DEFAULT_STATEMENT_CACHE_SIZE (128)
 #define DB_HEARTBEAT 15
 #define WAIT_INTERVAL 2
 
@@ -40,16 +41,19 @@ struct DBConnInfo
   std::string user;
   std::string passwd;
   std::string dbName;
+  unsigned statementCacheSize;   ///< prepared statements per connection (0 = disabled)
 
-  DBConnInfo(std::string aServer, std::string aUser, std::string aPasswd, std::string aDBName)
+  DBConnInfo(std::string aServer, std::string aUser, std::string aPasswd, std::string aDBName,
+             unsigned aStatementCacheSize = DEFAULT_STATEMENT_CACHE_SIZE)
   {
     server = aServer;
     user = aUser;
     passwd = aPasswd;
     dbName = aDBName;
+    statementCacheSize = aStatementCacheSize;
   };
 
-  DBConnInfo() {}
+  DBConnInfo() : statementCacheSize(DEFAULT_STATEMENT_CACHE_SIZE) {}
 
 };
   
@@ -172,7 +176,7 @@ public:
       PGconn *pgconn = PQ_CreateConn(_DBInfo.server.c_str(), _DBInfo.user.c_str(), _DBInfo.passwd.c_str(), _DBInfo.dbName.c_str());
       if (pgconn && PQ_CONN_SUCCESS(pgconn))
       {
-        DBConnection_sptr dbconn = std::make_shared<DBConnection>(pgconn, NumConns++);
+        DBConnection_sptr dbconn = std::make_shared<DBConnection>(pgconn, NumConns++, _DBInfo.statementCacheSize);
         _FreeConnPool.push_front(dbconn);
         
         _ConnPool.push_back(dbconn);
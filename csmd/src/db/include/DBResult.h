@@ -22,6 +22,9 @@
 #include <memory>
 #include <string.h>
 #include <cstdlib>
+#include <stdint.h>
+#include <string>
+#include <vector>
 
 #include "logging.h"
 
@@ -38,6 +41,29 @@ enum BooleanEnum {
 typedef enum BooleanEnum DB_BOOL;
 
 
+/**
+ \brief Type oids of the builtin types decoded by the typed accessors of DBResult.
+ */
+enum DBTypeOid {
+  DB_BOOL_OID        = 16,
+  DB_BYTEA_OID       = 17,
+  DB_CHAR_OID        = 18,
+  DB_NAME_OID        = 19,
+  DB_INT8_OID        = 20,
+  DB_INT2_OID        = 21,
+  DB_INT4_OID        = 23,
+  DB_TEXT_OID        = 25,
+  DB_OID_OID         = 26,
+  DB_FLOAT4_OID      = 700,
+  DB_FLOAT8_OID      = 701,
+  DB_BPCHAR_OID      = 1042,
+  DB_VARCHAR_OID     = 1043,
+  DB_DATE_OID        = 1082,
+  DB_TIMESTAMP_OID   = 1114,
+  DB_TIMESTAMPTZ_OID = 1184,
+  DB_TIMESTAMPTZ_ARRAY_OID = 1185
+};
+
 /**
  \brief Table results from the database
  */
@@ -103,6 +129,13 @@ public:
     return nullptr;
   }
 
+  /** @brief The column of a field name, -1 if the result has no such field. */
+  int GetFieldNumber(const char *name)
+  {
+    if (_pgres) return PQfnumber(_pgres, name);
+    return -1;
+  }
+
   // note: callers should use DB_TupleFree() to free the returned pointer
   DBTuple *GetAllFieldNames()
   {
@@ -151,6 +184,65 @@ public:
     return nullptr;
   }
   
+  /** @defgroup Typed_Accessors
+   *
+   * The typed accessors decode a field independent of the format it was transferred in,
+   * so a handler can request binary results (see DBReqContent::SetBinaryResults) and still
+   * cope with a text result. Each returns false if the field is NULL or can't be decoded,
+   * in which case the output value is left untouched.
+   * @{*/
+
+  /** @brief True if the values of this result were transferred in binary format. */
+  bool IsBinary()
+  {
+    return ( _pgres && PQnfields(_pgres) > 0 && PQfformat(_pgres, 0) == 1 );
+  }
+
+  bool IsNull(int row, int col)
+  {
+    return ( !_pgres || PQgetisnull(_pgres, row, col) );
+  }
+
+  int GetLength(int row, int col)
+  {
+    if (_pgres) return PQgetlength(_pgres, row, col);
+    return 0;
+  }
+
+  Oid GetFieldType(int col)
+  {
+    if (_pgres) return PQftype(_pgres, col);
+    return InvalidOid;
+  }
+
+  /** @brief Integer types (int2, int4, int8, oid). */
+  bool GetInt64(int row, int col, int64_t &aValue);
+
+  /** @brief Floating point types (float4, float8) and the integer types. */
+  bool GetDouble(int row, int col, double &aValue);
+
+  bool GetBool(int row, int col, bool &aValue);
+
+  /** @brief Timestamps and dates as microseconds since the unix epoch (UTC). */
+  bool GetTimestamp(int row, int col, int64_t &aMicroSeconds);
+
+  /** @brief The text representation of a timestamp or date, as the server would print it in ISO style.
+   *
+   * timestamptz values are printed in UTC with a +00 offset, in text and binary results alike,
+   * instead of in the session time zone.
+   */
+  bool GetTimestampString(int row, int col, std::string &aValue);
+
+  /** @brief The elements of a one dimensional array, converted to text.
+   *
+   * NULL elements result in an empty string. timestamptz elements are printed in UTC.
+   */
+  bool GetTextArray(int row, int col, std::vector<std::string> &aValues);
+
+  /** @brief Formats microseconds since the unix epoch like the server's ISO timestamp output. */
+  static std::string FormatTimestamp( int64_t aMicroSeconds, bool aDateOnly = false );
+  /** @} */
+
   size_t GetNumOfAffectedRows()
   {
     size_t n = 0;
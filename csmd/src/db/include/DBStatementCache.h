@@ -0,0 +1,99 @@
+/*================================================================================
+
+    csmd/src/db/include/DBStatementCache.h
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+#ifndef _CSM_DB_SRC_DBSTATEMENTCACHE_H
+#define _CSM_DB_SRC_DBSTATEMENTCACHE_H
+
+#include <stdint.h>
+#include <list>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace csm {
+namespace db {
+
+// number of uses after which a statement is prepared; one-off statements aren't worth a round trip
+#define DEFAULT_STATEMENT_PREPARE_AFTER (3)
+
+/**
+ \brief LRU map of sql statement text to the name of a server-side prepared statement.
+
+ The cache only tracks names; the owning DBConnection prepares and deallocates
+ the statements. Names are never reused on a connection, so a statement that
+ got lost on the server can't be confused with a newer one.
+ */
+class DBStatementCache
+{
+public:
+  DBStatementCache( const unsigned aCapacity, const unsigned aPrepareAfter = DEFAULT_STATEMENT_PREPARE_AFTER )
+  : _Capacity( aCapacity ),
+    _PrepareAfter( aPrepareAfter ),
+    _NextId( 0 )
+  {}
+
+  inline bool IsEnabled() const { return _Capacity > 0; }
+  inline unsigned GetCapacity() const { return _Capacity; }
+  inline size_t GetSize() const { return _Entries.size(); }
+
+  /** @brief Removes formatting differences that don't change the statement.
+   *
+   * Whitespace runs and -- comments outside of quoted literals and identifiers are collapsed
+   * into a single blank and leading/trailing whitespace is dropped. Backslash escapes are
+   * honored inside of E'...' literals. Statements with dollar-quoting or block comments are
+   * returned unchanged.
+   */
+  static std::string Normalize( const std::string &aStmt );
+
+  /** @brief Returns the statement name for a normalized key and marks it most recently used.
+   *
+   * @return nullptr if the statement is not cached.
+   */
+  const std::string* Lookup( const std::string &aKey );
+
+  /** @brief Counts a use of a statement that is not cached.
+   *
+   * @return True once the statement was used often enough to be prepared.
+   */
+  bool CountUse( const std::string &aKey );
+
+  /** @brief Adds a key and returns the newly assigned statement name.
+   *
+   * @param[out] aEvicted Names of least recently used statements pushed out of the cache;
+   *                      the caller is responsible to deallocate them on the server.
+   */
+  const std::string& Insert( const std::string &aKey, std::vector<std::string> &aEvicted );
+
+  /** @brief Removes a key, e.g. after the statement failed to prepare. */
+  void Erase( const std::string &aKey );
+
+  /** @brief Drops all entries, e.g. after the server side session was reset. */
+  void Clear();
+
+private:
+  typedef std::pair<std::string, std::string> Entry;  ///< key, statement name
+  typedef std::list<Entry> EntryList;
+
+  unsigned _Capacity;
+  unsigned _PrepareAfter;
+  uint64_t _NextId;
+  EntryList _Entries;                                            ///< most recently used first
+  std::unordered_map<std::string, EntryList::iterator> _Index;
+  std::unordered_map<std::string, unsigned> _Uses;                ///< use counts of statements not cached yet
+};
+
+} // end namespace db
+} // end namespace csm
+
+#endif
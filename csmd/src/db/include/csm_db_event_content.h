@@ -104,6 +104,7 @@ private:
     char  **_ParamValues;  //: An array of pointers to parameters, if text acts as a c_str otherwise treated as binary.
     int    *_ParamSizes; //:
     int    *_ParamFormats; //: An array of formats for the parameterization : 0 - text, 1 - binaray
+    int    _ResultFormat;  //: The format of the result values : 0 - text, 1 - binary
 
 public:
 
@@ -119,7 +120,8 @@ public:
         _NumParams(0),
         _ParamValues(nullptr),
         _ParamSizes(nullptr),
-        _ParamFormats(nullptr)
+        _ParamFormats(nullptr),
+        _ResultFormat(0)
     {}
 
     /** @brief Creates a Request for a parameterized database query, recommended for safety and code readability.
@@ -135,7 +137,8 @@ public:
         DBConnection_sptr aDBConn = nullptr) : DBContent(CSM_DB_REQ, aDBConn),
         _SqlStmt(aSqlStmt),
         _ParamIndex(0),
-        _NumParams(numParams)
+        _NumParams(numParams),
+        _ResultFormat(0)
     {
         // Initialize the arrays.
         _ParamValues  = (char **)calloc( numParams, sizeof(char*));
@@ -278,6 +281,14 @@ public:
 
     int* GetParamFormats() { return _ParamFormats; }
     int* GetParamSizes()   { return _ParamSizes; } 
+
+    /** @brief Requests the result values in binary format.
+     *
+     * Binary results skip the text conversion on both ends, the receiving handler state has
+     * to decode them through the typed accessors of @ref DBResult (see @ref DBResult::IsBinary).
+     */
+    void SetBinaryResults( bool binary = true ) { _ResultFormat = binary ? 1 : 0; }
+    int GetResultFormat() const { return _ResultFormat; }
     /** @} */
 };
 
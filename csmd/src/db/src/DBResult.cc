@@ -15,11 +15,469 @@
 #include "../include/DBResult.h"
 #include "../include/DBConnectionPool.h"
 
+#include <endian.h>
+#include <strings.h>
+#include <cctype>
+#include <cstdio>
+
 namespace csm {
 namespace db {
 
 DBConnectionPool* DBConnectionPool::_instance = nullptr;
 
+namespace {
+
+// binary timestamps and dates count from 2000-01-01
+const int64_t USECS_PER_DAY = INT64_C(86400000000);
+const int64_t PG_EPOCH_DAYS = 10957;
+const int64_t PG_EPOCH_USECS = PG_EPOCH_DAYS * USECS_PER_DAY;
+
+inline uint16_t ReadBE16( const char *aData ) { uint16_t v; memcpy( &v, aData, sizeof(v) ); return be16toh( v ); }
+inline uint32_t ReadBE32( const char *aData ) { uint32_t v; memcpy( &v, aData, sizeof(v) ); return be32toh( v ); }
+inline uint64_t ReadBE64( const char *aData ) { uint64_t v; memcpy( &v, aData, sizeof(v) ); return be64toh( v ); }
+
+inline int64_t FloorDiv( int64_t a, int64_t b )
+{
+  return ( a / b ) - ((( a % b ) != 0 ) && (( a < 0 ) != ( b < 0 )) ? 1 : 0 );
+}
+
+// proleptic gregorian calendar conversions, year 0 is 1 BC
+int64_t DaysFromCivil( int64_t y, unsigned m, unsigned d )
+{
+  y -= ( m <= 2 );
+  const int64_t era = FloorDiv( y, 400 );
+  const unsigned yoe = (unsigned)( y - era * 400 );
+  const unsigned doy = ( 153 * ( m > 2 ? m - 3 : m + 9 ) + 2 ) / 5 + d - 1;
+  const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + (int64_t)doe - 719468;
+}
+
+void CivilFromDays( int64_t z, int64_t &y, unsigned &m, unsigned &d )
+{
+  z += 719468;
+  const int64_t era = FloorDiv( z, 146097 );
+  const unsigned doe = (unsigned)( z - era * 146097 );
+  const unsigned yoe = ( doe - doe / 1460 + doe / 36524 - doe / 146096 ) / 365;
+  const unsigned doy = doe - ( 365 * yoe + yoe / 4 - yoe / 100 );
+  const unsigned mp = ( 5 * doy + 2 ) / 153;
+  d = doy - ( 153 * mp + 2 ) / 5 + 1;
+  m = mp < 10 ? mp + 3 : mp - 9;
+  y = (int64_t)yoe + era * 400 + ( m <= 2 );
+}
+
+bool DecodeBinaryInt( Oid aType, const char *aData, int aLen, int64_t &aValue )
+{
+  switch( aType )
+  {
+    case DB_INT2_OID:
+      if( aLen != 2 ) return false;
+      aValue = (int16_t)ReadBE16( aData );
+      return true;
+    case DB_INT4_OID:
+      if( aLen != 4 ) return false;
+      aValue = (int32_t)ReadBE32( aData );
+      return true;
+    case DB_OID_OID:
+      if( aLen != 4 ) return false;
+      aValue = ReadBE32( aData );
+      return true;
+    case DB_INT8_OID:
+      if( aLen != 8 ) return false;
+      aValue = (int64_t)ReadBE64( aData );
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool DecodeBinaryDouble( Oid aType, const char *aData, int aLen, double &aValue )
+{
+  if(( aType == DB_FLOAT4_OID ) && ( aLen == 4 ))
+  {
+    uint32_t bits = ReadBE32( aData );
+    float f;
+    memcpy( &f, &bits, sizeof(f) );
+    aValue = f;
+    return true;
+  }
+  if(( aType == DB_FLOAT8_OID ) && ( aLen == 8 ))
+  {
+    uint64_t bits = ReadBE64( aData );
+    memcpy( &aValue, &bits, sizeof(aValue) );
+    return true;
+  }
+
+  int64_t i;
+  if( ! DecodeBinaryInt( aType, aData, aLen, i ) )
+    return false;
+  aValue = (double)i;
+  return true;
+}
+
+// timestamps are kept as microseconds since the unix epoch, +/-infinity map to INT64_MAX/MIN
+bool DecodeBinaryTimestamp( Oid aType, const char *aData, int aLen, int64_t &aValue )
+{
+  if((( aType == DB_TIMESTAMP_OID ) || ( aType == DB_TIMESTAMPTZ_OID )) && ( aLen == 8 ))
+  {
+    int64_t ts = (int64_t)ReadBE64( aData );
+    if(( ts == INT64_MAX ) || ( ts == INT64_MIN ))
+      aValue = ts;
+    else
+      aValue = ts + PG_EPOCH_USECS;
+    return true;
+  }
+  if(( aType == DB_DATE_OID ) && ( aLen == 4 ))
+  {
+    int32_t days = (int32_t)ReadBE32( aData );
+    if( days == INT32_MAX )
+      aValue = INT64_MAX;
+    else if( days == INT32_MIN )
+      aValue = INT64_MIN;
+    else
+      aValue = ( days + PG_EPOCH_DAYS ) * USECS_PER_DAY;
+    return true;
+  }
+  return false;
+}
+
+// parses the ISO output of timestamp, timestamptz and date: YYYY-MM-DD[ HH:MM:SS[.ffffff]][+HH[:MM]][ BC]
+bool ParseTimestamp( const char *aText, int64_t &aValue )
+{
+  if( strcasecmp( aText, "infinity" ) == 0 ) { aValue = INT64_MAX; return true; }
+  if( strcasecmp( aText, "-infinity" ) == 0 ) { aValue = INT64_MIN; return true; }
+
+  int year, mon, day, hour = 0, min = 0, sec = 0, n = 0;
+  if( sscanf( aText, "%d-%d-%d%n", &year, &mon, &day, &n ) != 3 )
+    return false;
+  const char *p = aText + n;
+  if(( *p == ' ' ) || ( *p == 'T' ))
+  {
+    if( sscanf( p + 1, "%d:%d:%d%n", &hour, &min, &sec, &n ) == 3 )
+      p += n + 1;
+  }
+
+  int64_t usec = 0;
+  if( *p == '.' )
+  {
+    int64_t scale = 100000;
+    for( ++p; ( *p >= '0' ) && ( *p <= '9' ); ++p, scale /= 10 )
+      usec += ( *p - '0' ) * scale;
+  }
+
+  int64_t offset = 0;
+  if(( *p == '+' ) || ( *p == '-' ))
+  {
+    const int sign = ( *p == '-' ) ? -1 : 1;
+    int oh = 0, om = 0, os = 0;
+    int fields = sscanf( p + 1, "%d:%d:%d%n", &oh, &om, &os, &n );
+    if( fields < 1 ) return false;
+    while(( *p != '\0' ) && ( *p != ' ' )) ++p;
+    offset = sign * ( oh * 3600 + om * 60 + os );
+  }
+
+  if( strcmp( p, " BC" ) == 0 )
+    year = 1 - year;
+
+  int64_t days = DaysFromCivil( year, mon, day );
+  aValue = ( days * 86400 + hour * 3600 + min * 60 + sec - offset ) * 1000000 + usec;
+  return true;
+}
+
+// timestamptz text is printed in the session time zone and binary values carry none,
+// both are printed in UTC so the string does not depend on the result format
+std::string FormatTimestamptz( int64_t aMicroSeconds )
+{
+  std::string ret = DBResult::FormatTimestamp( aMicroSeconds );
+  if(( aMicroSeconds == INT64_MAX ) || ( aMicroSeconds == INT64_MIN ))
+    return ret;
+  size_t bc = ret.find( " BC" );
+  ret.insert( bc == std::string::npos ? ret.size() : bc, "+00" );
+  return ret;
+}
+
+// text that doesn't parse is kept as the server sent it
+std::string TimestamptzTextToUTC( const char *aText )
+{
+  int64_t usec;
+  if( ! ParseTimestamp( aText, usec ) )
+    return std::string( aText );
+  return FormatTimestamptz( usec );
+}
+
+std::string DecodeBinaryElement( Oid aType, const char *aData, int aLen )
+{
+  int64_t i;
+  double d;
+  switch( aType )
+  {
+    case DB_BOOL_OID:
+      return std::string( ( aLen == 1 && aData[0] ) ? "t" : "f" );
+    case DB_INT2_OID:
+    case DB_INT4_OID:
+    case DB_INT8_OID:
+    case DB_OID_OID:
+      if( DecodeBinaryInt( aType, aData, aLen, i ) )
+        return std::to_string( i );
+      break;
+    case DB_FLOAT4_OID:
+    case DB_FLOAT8_OID:
+      if( DecodeBinaryDouble( aType, aData, aLen, d ) )
+      {
+        char buf[32];
+        snprintf( buf, sizeof(buf), ( aType == DB_FLOAT4_OID ) ? "%.6g" : "%.15g", d );
+        return std::string( buf );
+      }
+      break;
+    case DB_TIMESTAMP_OID:
+    case DB_DATE_OID:
+      if( DecodeBinaryTimestamp( aType, aData, aLen, i ) )
+        return DBResult::FormatTimestamp( i, aType == DB_DATE_OID );
+      break;
+    case DB_TIMESTAMPTZ_OID:
+      if( DecodeBinaryTimestamp( aType, aData, aLen, i ) )
+        return FormatTimestamptz( i );
+      break;
+    default:
+      // text, varchar, name, enum labels, ... are sent as raw bytes
+      break;
+  }
+  return std::string( aData, aLen );
+}
+
+// parses the text output of an array: [optional dimensions=]{a,"b c",NULL,{nested}}
+bool ParseTextArray( const char *aText, std::vector<std::string> &aValues )
+{
+  const char *p = strchr( aText, '{' );
+  if( p == nullptr )
+    return false;
+
+  while( *p != '\0' )
+  {
+    if(( *p == '{' ) || ( *p == '}' ) || ( *p == ',' ) || isspace( (unsigned char)*p ))
+    {
+      ++p;
+      continue;
+    }
+
+    std::string element;
+    if( *p == '"' )
+    {
+      for( ++p; ( *p != '\0' ) && ( *p != '"' ); ++p )
+      {
+        if(( *p == '\\' ) && ( p[1] != '\0' ))
+          ++p;
+        element.push_back( *p );
+      }
+      if( *p == '"' ) ++p;
+    }
+    else
+    {
+      const char *start = p;
+      while(( *p != '\0' ) && ( *p != ',' ) && ( *p != '}' ))
+        ++p;
+      const char *end = p;
+      while(( end > start ) && isspace( (unsigned char)end[-1] ))
+        --end;
+      element.assign( start, end - start );
+      if( strcasecmp( element.c_str(), "NULL" ) == 0 )
+        element.clear();
+    }
+    aValues.push_back( element );
+  }
+  return true;
+}
+
+} // end anonymous namespace
+
+bool DBResult::GetInt64(int row, int col, int64_t &aValue)
+{
+  if( IsNull( row, col ) )
+    return false;
+
+  const char *data = PQgetvalue( _pgres, row, col );
+  if( PQfformat( _pgres, col ) == 1 )
+    return DecodeBinaryInt( PQftype( _pgres, col ), data, PQgetlength( _pgres, row, col ), aValue );
+
+  char *end = nullptr;
+  int64_t v = strtoll( data, &end, 10 );
+  if( end == data )
+    return false;
+  aValue = v;
+  return true;
+}
+
+bool DBResult::GetDouble(int row, int col, double &aValue)
+{
+  if( IsNull( row, col ) )
+    return false;
+
+  const char *data = PQgetvalue( _pgres, row, col );
+  if( PQfformat( _pgres, col ) == 1 )
+    return DecodeBinaryDouble( PQftype( _pgres, col ), data, PQgetlength( _pgres, row, col ), aValue );
+
+  char *end = nullptr;
+  double v = strtod( data, &end );
+  if( end == data )
+    return false;
+  aValue = v;
+  return true;
+}
+
+bool DBResult::GetBool(int row, int col, bool &aValue)
+{
+  if( IsNull( row, col ) )
+    return false;
+
+  const char *data = PQgetvalue( _pgres, row, col );
+  if( PQfformat( _pgres, col ) == 1 )
+  {
+    if(( PQftype( _pgres, col ) != DB_BOOL_OID ) || ( PQgetlength( _pgres, row, col ) != 1 ))
+      return false;
+    aValue = ( data[0] != 0 );
+    return true;
+  }
+
+  if(( data[0] != 't' ) && ( data[0] != 'f' ))
+    return false;
+  aValue = ( data[0] == 't' );
+  return true;
+}
+
+bool DBResult::GetTimestamp(int row, int col, int64_t &aMicroSeconds)
+{
+  if( IsNull( row, col ) )
+    return false;
+
+  const char *data = PQgetvalue( _pgres, row, col );
+  if( PQfformat( _pgres, col ) == 1 )
+    return DecodeBinaryTimestamp( PQftype( _pgres, col ), data, PQgetlength( _pgres, row, col ), aMicroSeconds );
+
+  return ParseTimestamp( data, aMicroSeconds );
+}
+
+bool DBResult::GetTimestampString(int row, int col, std::string &aValue)
+{
+  if( IsNull( row, col ) )
+    return false;
+
+  const Oid type = PQftype( _pgres, col );
+  if( PQfformat( _pgres, col ) == 0 )
+  {
+    if( type == DB_TIMESTAMPTZ_OID )
+      aValue = TimestamptzTextToUTC( PQgetvalue( _pgres, row, col ) );
+    else
+      aValue = PQgetvalue( _pgres, row, col );
+    return true;
+  }
+
+  int64_t usec;
+  if( ! DecodeBinaryTimestamp( type, PQgetvalue( _pgres, row, col ), PQgetlength( _pgres, row, col ), usec ) )
+    return false;
+
+  if( type == DB_TIMESTAMPTZ_OID )
+    aValue = FormatTimestamptz( usec );
+  else
+    aValue = FormatTimestamp( usec, type == DB_DATE_OID );
+  return true;
+}
+
+bool DBResult::GetTextArray(int row, int col, std::vector<std::string> &aValues)
+{
+  if( IsNull( row, col ) )
+    return false;
+
+  const char *data = PQgetvalue( _pgres, row, col );
+  if( PQfformat( _pgres, col ) == 0 )
+  {
+    aValues.clear();
+    if( ! ParseTextArray( data, aValues ) )
+      return false;
+    if( PQftype( _pgres, col ) == DB_TIMESTAMPTZ_ARRAY_OID )
+      for( std::string &value : aValues )
+        if( ! value.empty() )
+          value = TimestamptzTextToUTC( value.c_str() );
+    return true;
+  }
+
+  // binary array: ndim, has-null flag, element oid, ndim * (size, lower bound), elements
+  const char *end = data + PQgetlength( _pgres, row, col );
+  if( end - data < 12 )
+    return false;
+
+  const int32_t ndim = (int32_t)ReadBE32( data );
+  const Oid elemType = ReadBE32( data + 8 );
+  const char *p = data + 12;
+
+  if( ( ndim < 0 ) || ( end - p < 8 * (int64_t)ndim ) )
+    return false;
+
+  int64_t count = ( ndim > 0 ) ? 1 : 0;
+  for( int32_t d = 0; d < ndim; ++d, p += 8 )
+    count *= (int32_t)ReadBE32( p );
+
+  std::vector<std::string> values;
+  values.reserve( count > 0 ? count : 0 );
+  for( int64_t i = 0; i < count; ++i )
+  {
+    if( end - p < 4 )
+      return false;
+    const int32_t len = (int32_t)ReadBE32( p );
+    p += 4;
+
+    if( len < 0 )
+    {
+      values.push_back( std::string() );
+      continue;
+    }
+    if( end - p < len )
+      return false;
+    values.push_back( DecodeBinaryElement( elemType, p, len ) );
+    p += len;
+  }
+
+  aValues.swap( values );
+  return true;
+}
+
+std::string DBResult::FormatTimestamp( int64_t aMicroSeconds, bool aDateOnly )
+{
+  if( aMicroSeconds == INT64_MAX ) return "infinity";
+  if( aMicroSeconds == INT64_MIN ) return "-infinity";
+
+  const int64_t days = FloorDiv( aMicroSeconds, USECS_PER_DAY );
+  int64_t usec = aMicroSeconds - days * USECS_PER_DAY;
+
+  int64_t year;
+  unsigned mon, day;
+  CivilFromDays( days, year, mon, day );
+  const bool bc = ( year <= 0 );
+  if( bc )
+    year = 1 - year;
+
+  char buf[64];
+  int len = snprintf( buf, sizeof(buf), "%04lld-%02u-%02u", (long long)year, mon, day );
+  if( ! aDateOnly )
+  {
+    const int64_t secs = usec / 1000000;
+    usec %= 1000000;
+    len += snprintf( buf + len, sizeof(buf) - len, " %02d:%02d:%02d",
+                     (int)( secs / 3600 ), (int)(( secs / 60 ) % 60 ), (int)( secs % 60 ));
+
+    // the server only prints significant fractional digits
+    if( usec != 0 )
+    {
+      len += snprintf( buf + len, sizeof(buf) - len, ".%06d", (int)usec );
+      while( buf[len - 1] == '0' )
+        buf[--len] = '\0';
+    }
+  }
+
+  std::string ret( buf, len );
+  if( bc )
+    ret.append( " BC" );
+  return ret;
+}
+
 void DB_TupleFree(DBTuple *tuple)
 {
   if (tuple) {
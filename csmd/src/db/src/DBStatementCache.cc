@@ -0,0 +1,141 @@
+/*================================================================================
+
+    csmd/src/db/src/DBStatementCache.cc
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+#include "../include/DBStatementCache.h"
+
+#include <cctype>
+
+namespace csm {
+namespace db {
+
+std::string DBStatementCache::Normalize( const std::string &aStmt )
+{
+  // dollar-quoted bodies and (nestable) block comments can't be tokenized this simply
+  if(( aStmt.find( "$$" ) != std::string::npos ) || ( aStmt.find( "/*" ) != std::string::npos ))
+    return aStmt;
+
+  std::string ret;
+  ret.reserve( aStmt.size() );
+
+  char quote = 0;
+  bool escapes = false;     // inside of an E'...' literal a backslash escapes the next character
+  bool pendingBlank = false;
+  const size_t len = aStmt.size();
+  for( size_t i = 0; i < len; ++i )
+  {
+    const char c = aStmt[ i ];
+    if( quote != 0 )
+    {
+      ret.push_back( c );
+      if(( escapes ) && ( c == '\\' ) && ( i + 1 < len ))
+        ret.push_back( aStmt[ ++i ] );
+      else if(( c == quote ) && ( i + 1 < len ) && ( aStmt[ i + 1 ] == quote ))
+        ret.push_back( aStmt[ ++i ] );    // doubled quote, the literal goes on
+      else if( c == quote )
+        quote = 0;
+      continue;
+    }
+
+    // a line comment counts as whitespace
+    if(( c == '-' ) && ( i + 1 < len ) && ( aStmt[ i + 1 ] == '-' ))
+    {
+      while(( i < len ) && ( aStmt[ i ] != '\n' ))
+        ++i;
+      pendingBlank = ! ret.empty();
+      continue;
+    }
+
+    if( isspace( (unsigned char)c ) )
+    {
+      pendingBlank = ! ret.empty();
+      continue;
+    }
+
+    if( pendingBlank )
+      ret.push_back( ' ' );
+    pendingBlank = false;
+
+    if(( c == '\'' ) || ( c == '"' ))
+    {
+      // E'...' only if the E starts a token, not for e.g. name'...'
+      size_t n = ret.size();
+      escapes = ( c == '\'' ) && ( n > 0 ) && (( ret[ n - 1 ] == 'E' ) || ( ret[ n - 1 ] == 'e' )) &&
+                (( n == 1 ) || ! ( isalnum( (unsigned char)ret[ n - 2 ] ) || ( ret[ n - 2 ] == '_' ) || ( ret[ n - 2 ] == '$' ) ));
+      quote = c;
+    }
+    ret.push_back( c );
+  }
+  return ret;
+}
+
+const std::string* DBStatementCache::Lookup( const std::string &aKey )
+{
+  auto it = _Index.find( aKey );
+  if( it == _Index.end() )
+    return nullptr;
+
+  _Entries.splice( _Entries.begin(), _Entries, it->second );
+  return &( it->second->second );
+}
+
+bool DBStatementCache::CountUse( const std::string &aKey )
+{
+  if( _PrepareAfter <= 1 )
+    return true;
+
+  // keep the candidates bounded; statements in real use quickly count up again
+  if(( _Uses.size() >= 4 * (size_t)_Capacity ) && ( _Uses.find( aKey ) == _Uses.end() ))
+    _Uses.clear();
+
+  if( ++_Uses[ aKey ] < _PrepareAfter )
+    return false;
+
+  _Uses.erase( aKey );
+  return true;
+}
+
+const std::string& DBStatementCache::Insert( const std::string &aKey, std::vector<std::string> &aEvicted )
+{
+  Erase( aKey );
+
+  while(( _Capacity > 0 ) && ( _Entries.size() >= _Capacity ))
+  {
+    aEvicted.push_back( _Entries.back().second );
+    _Index.erase( _Entries.back().first );
+    _Entries.pop_back();
+  }
+
+  _Entries.push_front( Entry( aKey, "csm_stmt_" + std::to_string( _NextId++ ) ) );
+  _Index[ aKey ] = _Entries.begin();
+  return _Entries.front().second;
+}
+
+void DBStatementCache::Erase( const std::string &aKey )
+{
+  auto it = _Index.find( aKey );
+  if( it == _Index.end() )
+    return;
+  _Entries.erase( it->second );
+  _Index.erase( it );
+}
+
+void DBStatementCache::Clear()
+{
+  _Index.clear();
+  _Entries.clear();
+  _Uses.clear();
+}
+
+} // end namespace db
+} // end namespace csm
@@ -27,7 +27,8 @@ namespace db {
 DBReqContent::DBReqContent( const DBReqContent &obj ):
     DBContent(obj),
     _SqlStmt(obj._SqlStmt),
-    _ParamIndex(obj._ParamIndex)
+    _ParamIndex(obj._ParamIndex),
+    _ResultFormat(obj._ResultFormat)
 {
     if (obj._NumParams == 0 )
     {
@@ -22,5 +22,6 @@ set(CSMD_DB_SRC_DIR
 set(CSM_DB_SRC
   ${CSMD_DB_SRC_DIR}/DBResult.cc
   ${CSMD_DB_SRC_DIR}/PostgreSql.cc
+  ${CSMD_DB_SRC_DIR}/DBStatementCache.cc
   ${CSMD_DB_SRC_DIR}/csm_db_event_content.cc
 )
@@ -0,0 +1,115 @@
+/*================================================================================
+
+    csmd/src/ras/include/RasEventBatch.h
+
+  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+
+#ifndef __RAS_EVENT_BATCH_H__
+#define __RAS_EVENT_BATCH_H__
+
+#include <stdint.h>
+#include <vector>
+
+/**
+ * Ras events waiting to be written by one INSERT ... SELECT FROM unnest().
+ *
+ * Events are identified by the context id of their handler. The batch is
+ * written once it holds max_events events or when the batch window timer
+ * started by its first event expires. One bad row fails the whole insert,
+ * so the events of a failed batch are written again one at a time and only
+ * the bad row is lost.
+ *
+ * The batch does no locking, the owner serializes access.
+ */
+class RasEventBatch
+{
+public:
+    enum Action {
+        WAIT,           // the batch window timer is already running
+        ARM_TIMER,      // start the batch window timer
+        WRITE           // write the batch now
+    };
+
+    RasEventBatch(uint64_t window = 10, uint32_t max_events = 250) :
+        _timerArmed(false)
+    {
+        configure(window, max_events);
+    }
+
+    /**
+     * @param window milliseconds to collect events for, 0 writes every event on its own.
+     * @param max_events events written by one insert at most, 0 is taken as 1.
+     */
+    void configure(uint64_t window, uint32_t max_events)
+    {
+        _window = window;
+        _maxEvents = (max_events == 0) ? 1 : max_events;
+    }
+
+    uint64_t window() const { return(_window); }
+
+    /**
+     * add an event to the batch.
+     *
+     * @return what the owner has to do next.
+     */
+    Action queue(uint64_t ctx_id)
+    {
+        _pending.push_back(ctx_id);
+        if ((_window == 0) || (_pending.size() >= _maxEvents))
+            return(WRITE);
+        if (_timerArmed)
+            return(WAIT);
+        _timerArmed = true;
+        return(ARM_TIMER);
+    }
+
+    /**
+     * the batch window timer went off, the next event starts it again.
+     */
+    void timerExpired() { _timerArmed = false; }
+
+    /**
+     * take the events of the batch to be written.
+     *
+     * @return false if no events are waiting.
+     */
+    bool take(std::vector<uint64_t> &o_batch)
+    {
+        o_batch.clear();
+        o_batch.swap(_pending);
+        return(!o_batch.empty());
+    }
+
+    /**
+     * sort the events of a written batch by what happens to them next.
+     *
+     * @param batch the events taken for the insert.
+     * @param failed the insert failed.
+     * @param o_complete the events that were written.
+     * @param o_retry the events to write again with an insert of their own.
+     */
+    static void written(const std::vector<uint64_t> &batch, bool failed,
+                        std::vector<uint64_t> &o_complete, std::vector<uint64_t> &o_retry)
+    {
+        std::vector<uint64_t> &target = failed ? o_retry : o_complete;
+        target.insert(target.end(), batch.begin(), batch.end());
+    }
+
+private:
+    std::vector<uint64_t> _pending;
+    bool _timerArmed;
+    uint64_t _window;               // milliseconds, 0 writes every event on its own
+    uint32_t _maxEvents;
+};
+
+#endif
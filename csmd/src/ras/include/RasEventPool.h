@@ -18,12 +18,13 @@
 #include <boost/thread.hpp>
 #include "RasRc.h"
 #include "RasEvent.h"
+#include "RasTimerWheel.h"
 
 #include "time.h"
 #include <string>
 #include <vector>
-#include <map>
-#include <set>
+#include <list>
+#include <unordered_map>
 
 
 class RasEventPool
@@ -65,25 +66,47 @@ public:
      */
     bool FatalErrorInPool(std::string locationName);
 protected:
+    // events in the pool for a location and the fatal error count for the location,
+    // increment on insert, decrement on exit...
+    class LocationData
+    {
+    public:
+        LocationData() : fatalCount(0) {}
+
+        std::list<std::shared_ptr<RasEvent> > events;
+        unsigned long fatalCount;
+    };
+
     /**
      * add a an expired to expired event queue...
      * 
      * 
      * @param expiredEvents 
+     * @param locationData 
      * @param rasEvent 
      */
     void AddExpiredEvent(std::vector<std::shared_ptr<RasEvent> > &expiredEvents, 
+                         LocationData &locationData,
                          std::shared_ptr<RasEvent> rasEvent);
 private:
 
+    typedef std::unordered_map<std::string, LocationData>::iterator LocationMapIter;
+    typedef std::unordered_map<std::string, LocationData>::value_type LocationMapValue;
+
+    // timer wheel entry, references the event in its location list so it can be
+    // removed without searching...
+    class PoolEntry
+    {
+    public:
+        PoolEntry() : location(nullptr) {}
+
+        LocationMapValue *location;
+        std::list<std::shared_ptr<RasEvent> >::iterator event;
+    };
+
     boost::mutex _poolMutex;
-    typedef std::multimap<time_t, std::shared_ptr<RasEvent>>::iterator TimePoolIter;
-    std::multimap<time_t, std::shared_ptr<RasEvent>> _timePool;          // pool index by time.
-    typedef std::multimap<std::string, std::shared_ptr<RasEvent> >::iterator LocationMapIter;
-    std::multimap<std::string, std::shared_ptr<RasEvent> > _locationMap;       // event indexed by msgid/location
-    // map of fatal error count for a location, increment on insert, decrement on exit...
-    typedef std::map<std::string, unsigned long >::iterator LocationFatalIter;
-    std::map<std::string, unsigned long > _locationFatalMap;
+    RasTimerWheel<PoolEntry> _timePool;                                 // pool index by time.
+    std::unordered_map<std::string, LocationData> _locationMap;         // events indexed by location
 
 
 };
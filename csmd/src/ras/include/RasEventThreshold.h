@@ -21,19 +21,23 @@
  */
 
 #include <boost/thread.hpp>
+#include <boost/circular_buffer.hpp>
 #include "RasRc.h"
 #include "RasEvent.h"
+#include "RasKeyTable.h"
+#include "RasTimerWheel.h"
 
 #include "time.h"
 #include <string>
 #include <vector>
-#include <map>
-#include <set>
+#include <unordered_map>
 
 
 class RasEventThreshold
 {
 public:
+    RasEventThreshold() : _numTimers(0) {}
+
     /**
      * New thresholded ras event to the event with a 
      * threshold count and threshold period.... 
@@ -74,7 +78,7 @@ public:
      */
     int GetThresholdCount(const std::string &msg_id, const std::string &location);
 
-    int GetNumTimers() { return(_timeToEventMap.size()); };
+    int GetNumTimers() { return(_numTimers); };
     int GetLocationMapCount() { return(_locationMap.size()); };
 
 
@@ -94,16 +98,23 @@ protected:
      */
     void TimerExpired();
 
-    std::string MsgIdLocation(const std::string &msg_id, const std::string &location) {
-        return(msg_id + "@" + location);
-    }
-
-    typedef std::multimap<time_t, std::shared_ptr<RasEvent>>::iterator TimeToEventMapIter;
-    std::multimap<time_t, std::shared_ptr<RasEvent>> _timeToEventMap;          // time events, ordered time list.
-    // map of location#msgid to current ras event count...  
-    //    represents total number of events in the threshold interval..
-    typedef std::map<std::string, unsigned long >::iterator LocationMapIter;
-    std::map<std::string, unsigned long > _locationMap;       // event indexed by location/msgid
+    // timeouts of the events in the threshold interval for a msgid/location, oldest first...
+    //    only the last threshold_count events can matter, so the ring holds at most that many.
+    class ThresholdKeyData
+    {
+    public:
+        ThresholdKeyData() : timeouts(0), scheduled(false) {}
+
+        boost::circular_buffer<time_t> timeouts;
+        bool scheduled;             // the oldest timeout is in the timer wheel
+    };
+
+    RasKeyTable _keys;                                      // interned msgid/location keys
+    // map of msgid/location to the events in the threshold interval...
+    typedef std::unordered_map<RasKey_t, ThresholdKeyData>::iterator LocationMapIter;
+    std::unordered_map<RasKey_t, ThresholdKeyData> _locationMap;
+    RasTimerWheel<RasKey_t> _timerWheel;                    // one timer per msgid/location, for the oldest event
+    int _numTimers;                                         // events in the threshold interval, all keys
 
     boost::mutex _thresholdMutex;
 
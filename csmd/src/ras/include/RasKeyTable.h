@@ -0,0 +1,71 @@
+/*================================================================================
+
+    csmd/src/ras/include/RasKeyTable.h
+
+  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+#ifndef __RAS_KEY_TABLE_H__
+#define __RAS_KEY_TABLE_H__
+
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+
+// msg_id index in the upper 32 bits, location index in the lower 32 bits
+typedef uint64_t RasKey_t;
+
+/**
+ * Interned (msg_id, location) keys.
+ *
+ * msg_ids and location names are each assigned a small integer the first
+ * time they are seen, so per msg_id/location state can be indexed without
+ * building a combined string for every event. The tables only grow, their
+ * size is bounded by the number of message types and locations.
+ *
+ * The table does no locking, the owner serializes access.
+ */
+class RasKeyTable
+{
+public:
+    /**
+     * get the key for a msg_id and location, interning new values.
+     */
+    RasKey_t key(const std::string &msg_id, const std::string &location)
+    {
+        return(((RasKey_t)intern(_msgIds, msg_id) << 32) | intern(_locations, location));
+    }
+
+    /**
+     * look up the key for a msg_id and location without interning.
+     *
+     * @return false if the msg_id or location was never seen.
+     */
+    bool findKey(const std::string &msg_id, const std::string &location, RasKey_t &o_key) const
+    {
+        std::unordered_map<std::string, uint32_t>::const_iterator miter = _msgIds.find(msg_id);
+        std::unordered_map<std::string, uint32_t>::const_iterator liter = _locations.find(location);
+        if ((miter == _msgIds.end()) || (liter == _locations.end()))
+            return(false);
+        o_key = ((RasKey_t)miter->second << 32) | liter->second;
+        return(true);
+    }
+
+private:
+    static uint32_t intern(std::unordered_map<std::string, uint32_t> &table, const std::string &value)
+    {
+        return(table.insert(std::make_pair(value, (uint32_t)table.size())).first->second);
+    }
+
+    std::unordered_map<std::string, uint32_t> _msgIds;
+    std::unordered_map<std::string, uint32_t> _locations;
+};
+
+#endif
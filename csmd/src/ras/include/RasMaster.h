@@ -17,9 +17,12 @@
 #define __RASMASTER_H__
 
 #include "RasEvent.h"
+#include "RasKeyTable.h"
+#include "RasMessageTypeRec.h"
 
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <chrono>
 
 #include <boost/thread.hpp>
@@ -38,11 +41,54 @@ public:
    time_point_t expiration_time;      // Expiration time of the active threshold period
 };
 
+class MsgTypeData
+{
+public:
+   MsgTypeData();
+
+   RasMessageTypeRec rec;             // Cached csm_ras_type row
+   time_point_t expiration_time;      // Time after which the row has to be read from the database again
+};
+
 class RasMaster
 {
 public:
    RasMaster();
 
+   /**
+    * Look up a csm_ras_type row in the message type cache.
+    *
+    * @param msg_id The msg_id of the row.
+    * @param o_rec The cached row.
+    * @return true if the row was found and has not timed out, otherwise false.
+    */
+   bool getMsgType(const string &msg_id, RasMessageTypeRec &o_rec);
+
+   /**
+    * Current generation of the message type cache, to be passed to setMsgType().
+    */
+   uint64_t getMsgTypeGeneration();
+
+   /**
+    * Drop all rows from the message type cache.
+    * Called by the handlers that create, update or delete csm_ras_type rows.
+    */
+   void invalidateMsgTypes();
+
+   /**
+    * Set the number of seconds a row is kept in the message type cache, 0 disables the cache.
+    */
+   void setMsgTypeTimeout(uint32_t timeout);
+
+   /**
+    * Add a csm_ras_type row to the message type cache.
+    *
+    * @param rec The row read from the database.
+    * @param generation The cache generation from before the row was read.  The row is
+    *                   not cached if the cache was invalidated since then.
+    */
+   void setMsgType(const RasMessageTypeRec &rec, uint64_t generation);
+
    /**
     * Check to see if the event has hit treshold and increment the threshold count in the event. 
     * 
@@ -54,14 +100,15 @@ public:
 
 private:
 
-   /**
-    * Generate a string containing the msg_id and location
-    */
-   string msgIdLocation(const string &msg_id, const string &location);
+   boost::mutex m_msg_type_mutex;
+   std::map<std::string, MsgTypeData> m_msg_type_map;
+   uint64_t m_msg_type_generation;
+   uint32_t m_msg_type_timeout;
 
    boost::mutex m_threshold_mutex;
-   std::map<std::string, ThresholdData> m_threshold_map;
-   typedef std::map<std::string, ThresholdData>::iterator ThresholdMapItr_t;
+   RasKeyTable m_threshold_keys;      // Interned msg_id and location keys for m_threshold_map
+   std::unordered_map<RasKey_t, ThresholdData> m_threshold_map;
+   typedef std::unordered_map<RasKey_t, ThresholdData>::iterator ThresholdMapItr_t;
 };
 
 // Single global shared instance
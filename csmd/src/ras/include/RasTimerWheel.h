@@ -0,0 +1,151 @@
+/*================================================================================
+
+    csmd/src/ras/include/RasTimerWheel.h
+
+  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+#ifndef __RAS_TIMER_WHEEL_H__
+#define __RAS_TIMER_WHEEL_H__
+
+#include "time.h"
+#include <vector>
+
+/**
+ * Hashed timer wheel with one second slots.
+ *
+ * Items are hashed to the slot for their expiration time, items more
+ * than one revolution out stay in their slot until the wheel comes
+ * around to their expiration. Adding an item is O(1), and expiring
+ * walks only the slots for the seconds that passed since the previous
+ * call.
+ *
+ * The wheel does no locking, the owner serializes access.
+ */
+template <class T>
+class RasTimerWheel
+{
+public:
+    /**
+     * @param slotBits -- the wheel has 2^slotBits one second slots.
+     */
+    RasTimerWheel(unsigned slotBits = 10) :
+        _slots(1UL << slotBits),
+        _mask((1UL << slotBits) - 1),
+        _cursor(0),
+        _size(0)
+    {
+    }
+
+    /**
+     * add an item to the wheel.
+     *
+     * @param expiration -- absolute time since epoc. Times already
+     *                      passed expire on the next call to expire.
+     * @param item
+     */
+    void add(time_t expiration, const T &item)
+    {
+        time_t slotTime = (expiration < _cursor) ? _cursor : expiration;
+        _slots[slotTime & _mask].push_back(Entry(expiration, item));
+        _size++;
+    }
+
+    /**
+     * remove the items that expired by now.
+     *
+     * @param now -- absolute time since epoc.
+     * @param expired -- [out] expired items are appended in
+     *                         expiration order, to the second.
+     */
+    void expire(time_t now, std::vector<T> &expired)
+    {
+        if ((now < _cursor) || (_size == 0)) {
+            if (_size == 0)
+                _cursor = now + 1;
+            return;
+        }
+
+        time_t steps = now - _cursor + 1;
+        if (steps > (time_t)_slots.size())
+            steps = _slots.size();      // gone around at least once, look at every slot
+
+        for (time_t t = now - steps + 1; t <= now; t++) {
+            std::vector<Entry> &slot = _slots[t & _mask];
+            size_t keep = 0;
+            for (size_t n = 0; n < slot.size(); n++) {
+                if (slot[n].expiration <= now) {
+                    expired.push_back(slot[n].item);
+                }
+                else {
+                    if (keep != n)
+                        slot[keep] = slot[n];
+                    keep++;
+                }
+            }
+            _size -= (slot.size() - keep);
+            slot.resize(keep);
+        }
+        _cursor = now + 1;
+    }
+
+    /**
+     * earliest expiration time in the wheel.
+     *
+     * @return -- absolute time since epoc, 0 if the wheel is empty.
+     */
+    time_t next() const
+    {
+        if (_size == 0)
+            return(0);
+
+        // the first slot holding an item due in this revolution has the earliest item
+        for (time_t t = _cursor; t < _cursor + (time_t)_slots.size(); t++) {
+            const std::vector<Entry> &slot = _slots[t & _mask];
+            time_t first = 0;
+            for (size_t n = 0; n < slot.size(); n++) {
+                if ((slot[n].expiration <= t) && ((first == 0) || (slot[n].expiration < first)))
+                    first = slot[n].expiration;
+            }
+            if (first)
+                return(first);
+        }
+
+        // everything is more than one revolution out...
+        time_t first = 0;
+        for (size_t s = 0; s < _slots.size(); s++) {
+            for (size_t n = 0; n < _slots[s].size(); n++) {
+                if ((first == 0) || (_slots[s][n].expiration < first))
+                    first = _slots[s][n].expiration;
+            }
+        }
+        return(first);
+    }
+
+    size_t size() const { return(_size); };
+
+private:
+    class Entry
+    {
+    public:
+        Entry() : expiration(0), item() {}
+        Entry(time_t e, const T &i) : expiration(e), item(i) {}
+
+        time_t expiration;
+        T item;
+    };
+
+    std::vector<std::vector<Entry> > _slots;
+    time_t _mask;
+    time_t _cursor;     // first second not yet expired
+    size_t _size;
+};
+
+#endif
@@ -32,11 +32,13 @@ using namespace std;
  */
 int RasEventThreshold::GetThresholdCount(const std::string &msg_id, const std::string &location)
 {
-    string msgIdLocation = MsgIdLocation(msg_id,location);
-    LocationMapIter liter = _locationMap.find(location);
+    RasKey_t key;
+    if (!_keys.findKey(msg_id, location, key))
+        return(0);
+    LocationMapIter liter = _locationMap.find(key);
     if (liter == _locationMap.end()) 
         return(0);
-    return(liter->second);
+    return(liter->second.timeouts.size());
 }
 
 /**
@@ -81,25 +83,34 @@ bool RasEventThreshold::NewRasEvent(std::shared_ptr<RasEvent> rasEvent)
         return(true);
     }
 
-    // now we have something to consider... put it in the list of stuff in the pool...
-    // keep a count of the ids...
-    string msgIdLocation = MsgIdLocation(msg_id,location);
-    LocationMapIter liter = _locationMap.find(msgIdLocation);
-    int currCount;
-    if (liter == _locationMap.end()) {
-        _locationMap.insert(pair<string, unsigned long >(msgIdLocation, 1) );
-        currCount = 1;
+    // now we have something to consider... put it in the ring of events for the id...
+    RasKey_t key = _keys.key(msg_id, location);
+    ThresholdKeyData &data = _locationMap[key];
+
+    // the threshold count may have changed since the last event for the id, 
+    // keep the newest events that still matter...
+    if (data.timeouts.capacity() != (unsigned)threshold_count) {
+        int before = data.timeouts.size();
+        data.timeouts.rset_capacity(threshold_count);
+        _numTimers -= (before - data.timeouts.size());
     }
-    else {
-        currCount = ++(liter->second);
+    if (data.timeouts.full()) {
+        data.timeouts.pop_front();      // no longer needed to reach the threshold
+        _numTimers--;
     }
 
     time_t now;                             // pickup the epoc time...
     time(&now);
     time_t timeout = now + periodSecs;
-    _timeToEventMap.insert(pair<time_t, std::shared_ptr<RasEvent> >(timeout, rasEvent) );
+    data.timeouts.push_back(timeout);
+    _numTimers++;
+
+    if (!data.scheduled) {
+        _timerWheel.add(data.timeouts.front(), key);
+        data.scheduled = true;
+    }
 
-    if (currCount >= threshold_count) 
+    if ((int)data.timeouts.size() >= threshold_count) 
         return(true);
     else
         return(false);
@@ -119,41 +130,30 @@ void RasEventThreshold::TimerExpired()
     time_t now;                             // pickup the epoc time...
     time(&now);
 
+    std::vector<RasKey_t> expiredKeys;
+    _timerWheel.expire(now, expiredKeys);
 
-    std::vector<std::shared_ptr<RasEvent> > expiredEvents;
-
-    TimeToEventMapIter iter;
-    for (iter = _timeToEventMap.begin(); iter != _timeToEventMap.end(); iter++) {
-        shared_ptr<RasEvent> re(iter->second);
-        if (now < iter->first)
-            break;
-        expiredEvents.push_back(re);
-    }
-    _timeToEventMap.erase(_timeToEventMap.begin(), iter);        
-
-    std::vector<std::shared_ptr<RasEvent> >::iterator eiter;
-    for (eiter = expiredEvents.begin(); eiter != expiredEvents.end(); eiter++) {
-        string msg_id;
-        string location;
-        shared_ptr<RasEvent> rasEvent(*eiter);
-
-
-        msg_id = rasEvent->getValue(CSM_RAS_FKEY_MSG_ID);
-        location = rasEvent->getValue(CSM_RAS_FKEY_LOCATION_NAME);
-        string msgIdLocation = MsgIdLocation(msg_id,location);
-        LocationMapIter liter = _locationMap.find(msgIdLocation);
+    std::vector<RasKey_t>::iterator kiter;
+    for (kiter = expiredKeys.begin(); kiter != expiredKeys.end(); kiter++) {
+        LocationMapIter liter = _locationMap.find(*kiter);
 
         if (liter == _locationMap.end())    // nothign here, probably something wrong, but bug out...
             continue;
-        if (liter->second > 0)
-            liter->second--;
 
-        if (liter->second <= 0)
+        ThresholdKeyData &data = liter->second;
+        while ((!data.timeouts.empty()) && (data.timeouts.front() <= now)) {
+            data.timeouts.pop_front();
+            _numTimers--;
+        }
+
+        if (data.timeouts.empty()) {
             _locationMap.erase(liter);      // if our counter reached zero, ditch the value...
+        }
+        else {
+            _timerWheel.add(data.timeouts.front(), *kiter);     // wait for the next oldest event...
+        }
     }
 
-    
-
     return;
 }
 
@@ -30,8 +30,75 @@ ThresholdData::ThresholdData() :
 {
 }
 
-RasMaster::RasMaster()
+MsgTypeData::MsgTypeData() :
+   rec(),
+   expiration_time()
+{
+}
+
+RasMaster::RasMaster() :
+   m_msg_type_generation(0),
+   m_msg_type_timeout(60)
+{
+}
+
+bool RasMaster::getMsgType(const string &msg_id, RasMessageTypeRec &o_rec)
+{
+   boost::unique_lock<boost::mutex> guard(m_msg_type_mutex);
+
+   std::map<std::string, MsgTypeData>::iterator itr = m_msg_type_map.find(msg_id);
+   if (itr == m_msg_type_map.end())
+   {
+      return false;
+   }
+   if (itr->second.expiration_time <= steady_clock::now())
+   {
+      // The row may have been changed directly in the database, read it again
+      m_msg_type_map.erase(itr);
+      return false;
+   }
+
+   o_rec = itr->second.rec;
+   return true;
+}
+
+uint64_t RasMaster::getMsgTypeGeneration()
 {
+   boost::unique_lock<boost::mutex> guard(m_msg_type_mutex);
+   return m_msg_type_generation;
+}
+
+void RasMaster::invalidateMsgTypes()
+{
+   boost::unique_lock<boost::mutex> guard(m_msg_type_mutex);
+   m_msg_type_map.clear();
+   m_msg_type_generation++;
+}
+
+void RasMaster::setMsgTypeTimeout(uint32_t timeout)
+{
+   boost::unique_lock<boost::mutex> guard(m_msg_type_mutex);
+   m_msg_type_timeout = timeout;
+   if (timeout == 0)
+   {
+      m_msg_type_map.clear();
+   }
+}
+
+void RasMaster::setMsgType(const RasMessageTypeRec &rec, uint64_t generation)
+{
+   boost::unique_lock<boost::mutex> guard(m_msg_type_mutex);
+
+   // A create, update or delete of a csm_ras_type row raced with the read of this row
+   if ((generation != m_msg_type_generation) || (m_msg_type_timeout == 0))
+   {
+      return;
+   }
+
+   MsgTypeData msg_type_data;
+   msg_type_data.rec = rec;
+   msg_type_data.expiration_time = steady_clock::now() + seconds(m_msg_type_timeout);
+   m_msg_type_map[rec._msg_id] = msg_type_data;
 }
 
 bool RasMaster::handleRasEventThreshold(RasEvent &io_event)
@@ -46,10 +113,10 @@ bool RasMaster::handleRasEventThreshold(RasEvent &io_event)
    {
       string msg_id = io_event.getValue(CSM_RAS_FKEY_MSG_ID);
       string location = io_event.getValue(CSM_RAS_FKEY_LOCATION_NAME);
-      string msg_id_location = msgIdLocation(msg_id,location);
 
       boost::unique_lock<boost::mutex> guard(m_threshold_mutex);
 
+      RasKey_t msg_id_location = m_threshold_keys.key(msg_id, location);
       ThresholdMapItr_t threshold_data_itr = m_threshold_map.find(msg_id_location);      
       if (threshold_data_itr == m_threshold_map.end())
       {
@@ -59,7 +126,7 @@ bool RasMaster::handleRasEventThreshold(RasEvent &io_event)
          io_event.setCount(1);         
          threshold_data.expiration_time = steady_clock::now() + seconds(io_event.getThresholdPeriod());
 
-         m_threshold_map.insert(std::pair<string,ThresholdData>(msg_id_location, threshold_data));
+         m_threshold_map.insert(std::pair<RasKey_t,ThresholdData>(msg_id_location, threshold_data));
          return false;
       }
       else
@@ -96,9 +163,3 @@ bool RasMaster::handleRasEventThreshold(RasEvent &io_event)
       }
    }
 }
-
-string RasMaster::msgIdLocation(const string &msg_id, const string &location) 
-{
-   return(msg_id + "@" + location);
-}
-
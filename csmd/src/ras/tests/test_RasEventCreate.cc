@@ -0,0 +1,189 @@
+/*================================================================================
+
+    csmd/src/ras/tests/test_RasEventCreate.cc
+
+  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+
+#include <iostream>
+#include <assert.h>
+#include <unistd.h>
+#include <vector>
+#include <csmd/src/ras/include/RasMaster.h>
+#include <csmd/src/ras/include/RasEventBatch.h>
+
+
+
+using namespace std;
+
+//
+// Covers the two caches of the ras event create handler that run without
+// a database: the csm_ras_type row cache with its generation guard, and the
+// batch of events written by one insert with its fallback to one insert per
+// event when the batch insert fails.
+//
+class TestRasEventCreate {
+public:
+    int main(int argc, char **argv);
+
+protected:
+    void testMsgTypeGeneration();
+    void testMsgTypeTimeout();
+    void testBatchQueue();
+    void testBatchWritten();
+
+    RasMessageTypeRec createMsgType(const std::string &msg_id, const std::string &severity);
+};
+
+int TestRasEventCreate::main(int argc, char **argv)
+{
+    testMsgTypeGeneration();
+    testMsgTypeTimeout();
+    testBatchQueue();
+    testBatchWritten();
+
+    cout << "TEST PASSED" << endl;
+    return(0);
+}
+
+void TestRasEventCreate::testMsgTypeGeneration()
+{
+    RasMaster master;
+    RasMessageTypeRec rec;
+
+    // a row read in the current generation is cached
+    uint64_t gen = master.getMsgTypeGeneration();
+    assert(!master.getMsgType("test.create.01", rec));
+    master.setMsgType(createMsgType("test.create.01", "INFO"), gen);
+    assert(master.getMsgType("test.create.01", rec));
+    assert(rec._severity == "INFO");
+
+    // a csm_ras_type update drops the cached rows
+    master.invalidateMsgTypes();
+    assert(master.getMsgTypeGeneration() == gen + 1);
+    assert(!master.getMsgType("test.create.01", rec));
+
+    // a row read before the update finishes after it, so it may be stale
+    // and is not cached
+    master.setMsgType(createMsgType("test.create.01", "INFO"), gen);
+    assert(!master.getMsgType("test.create.01", rec));
+
+    // the row read again after the update is
+    gen = master.getMsgTypeGeneration();
+    master.setMsgType(createMsgType("test.create.01", "FATAL"), gen);
+    assert(master.getMsgType("test.create.01", rec));
+    assert(rec._severity == "FATAL");
+
+    // a read that raced with several updates is still stale
+    uint64_t before = master.getMsgTypeGeneration();
+    master.invalidateMsgTypes();
+    master.invalidateMsgTypes();
+    master.setMsgType(createMsgType("test.create.02", "INFO"), before);
+    assert(!master.getMsgType("test.create.02", rec));
+    master.setMsgType(createMsgType("test.create.02", "INFO"), before + 2);
+    assert(master.getMsgType("test.create.02", rec));
+}
+
+void TestRasEventCreate::testMsgTypeTimeout()
+{
+    RasMaster master;
+    RasMessageTypeRec rec;
+
+    // a timeout of 0 disables the cache and drops what is in it
+    master.setMsgType(createMsgType("test.create.01", "INFO"), master.getMsgTypeGeneration());
+    master.setMsgTypeTimeout(0);
+    assert(!master.getMsgType("test.create.01", rec));
+    master.setMsgType(createMsgType("test.create.01", "INFO"), master.getMsgTypeGeneration());
+    assert(!master.getMsgType("test.create.01", rec));
+
+    // a row changed directly in the database is read again after the timeout
+    master.setMsgTypeTimeout(1);
+    master.setMsgType(createMsgType("test.create.01", "INFO"), master.getMsgTypeGeneration());
+    assert(master.getMsgType("test.create.01", rec));
+    usleep(1100000);
+    assert(!master.getMsgType("test.create.01", rec));
+}
+
+void TestRasEventCreate::testBatchQueue()
+{
+    RasEventBatch batch(10, 3);
+    std::vector<uint64_t> events;
+
+    // the first event starts the window, the batch is written when full
+    assert(!batch.take(events));
+    assert(batch.queue(1) == RasEventBatch::ARM_TIMER);
+    assert(batch.queue(2) == RasEventBatch::WAIT);
+    assert(batch.queue(3) == RasEventBatch::WRITE);
+    assert(batch.take(events));
+    assert((events == std::vector<uint64_t>{1, 2, 3}));
+    assert(!batch.take(events) && events.empty());
+
+    // the timer is still running, it writes the next events
+    assert(batch.queue(4) == RasEventBatch::WAIT);
+    batch.timerExpired();
+    assert(batch.take(events));
+    assert((events == std::vector<uint64_t>{4}));
+    assert(batch.queue(5) == RasEventBatch::ARM_TIMER);
+    batch.take(events);
+
+    // without a window every event is written on its own
+    batch.configure(0, 250);
+    assert(batch.window() == 0);
+    assert(batch.queue(6) == RasEventBatch::WRITE);
+    assert(batch.take(events));
+    assert((events == std::vector<uint64_t>{6}));
+
+    // a batch holds at least one event
+    batch.configure(10, 0);
+    assert(batch.queue(7) == RasEventBatch::WRITE);
+}
+
+void TestRasEventCreate::testBatchWritten()
+{
+    std::vector<uint64_t> events = {11, 12, 13};
+    std::vector<uint64_t> complete;
+    std::vector<uint64_t> retry;
+
+    // a written batch completes every event
+    RasEventBatch::written(events, false, complete, retry);
+    assert(complete == events);
+    assert(retry.empty());
+
+    // a failed batch insert is retried with one insert per event, in order,
+    // and none of its events is reported complete
+    complete.clear();
+    RasEventBatch::written(events, true, complete, retry);
+    assert(complete.empty());
+    assert(retry == events);
+
+    // nothing to do for an empty batch
+    retry.clear();
+    RasEventBatch::written(std::vector<uint64_t>(), true, complete, retry);
+    assert(complete.empty() && retry.empty());
+}
+
+RasMessageTypeRec TestRasEventCreate::createMsgType(const std::string &msg_id, const std::string &severity)
+{
+    RasMessageTypeRec rec;
+    rec._msg_id = msg_id;
+    rec._severity = severity;
+    rec._threshold_count = 0;
+    rec._threshold_period = 0;
+    rec._enabled = true;
+    rec._visible_to_users = true;
+    return(rec);
+}
+
+int main(int argc, char **argv)
+{
+    TestRasEventCreate rt;
+    return rt.main(argc, argv);
+}
@@ -625,7 +625,42 @@
  *  @param[in]  buffer_len uint32_t:  The length of the buffer.
  */
 #define csm_deserialize_struct( STRUCT_NAME, dest, buffer, buffer_len ) \
-    CSM_FUNCT_CAT(deserialize_,STRUCT_NAME)(dest, buffer, buffer_len) 
+    CSM_FUNCT_CAT(deserialize_,STRUCT_NAME)(dest, buffer, buffer_len)
+
+/** @brief Serializes a pointer to a struct into a buffer that may be reused across calls.
+ *
+ *  @param      STRUCT_NAME                 The type of the struct.
+ *  @param[in]  target        STRUCT_NAME*: A pointer to a struct to be serialized.
+ *  @param[in,out] buffer           char**: A buffer to place the results of the serialization,
+ *                                          grown through realloc if too small.
+ *  @param[out] buffer_len       uint32_t*: A container for the length of the serialized struct.
+ *  @param[in,out] buffer_capacity uint32_t*: The allocated size of @p buffer.
+ */
+#define csm_serialize_struct_buffer(STRUCT_NAME, target, buffer, buffer_len, buffer_capacity ) \
+    CSM_FUNCT_CAT(serialize_buffer_,STRUCT_NAME)( target, buffer, buffer_len, buffer_capacity)
+
+/** @brief Deserializes a struct of type @p STRUCT_NAME from the supplied @p buffer into one
+ *      heap allocation.
+ *
+ *  @warning The result must be released with @ref csm_free_struct_arena, not
+ *      @ref csm_free_struct_ptr.
+ *
+ *  @param      STRUCT_NAME           The type of the struct.
+ *  @param[out] dest  STRUCT_NAME**:  The destination of the deserialization.
+ *  @param[in]  buffer  const char*:  The buffer containing the struct in serial form.
+ *  @param[in]  buffer_len uint32_t:  The length of the buffer.
+ */
+#define csm_deserialize_struct_arena( STRUCT_NAME, dest, buffer, buffer_len ) \
+    CSM_FUNCT_CAT(deserialize_arena_,STRUCT_NAME)(dest, buffer, buffer_len, NULL, 0)
+
+/** @brief Frees a struct deserialized by @ref csm_deserialize_struct_arena.
+ *  @note The members live in the same allocation, the @p target is set to NULL.
+ *
+ *  @param[in] target STRUCT_NAME*: A pointer to the arena deserialized struct.
+ */
+#define csm_free_struct_arena( target ) \
+    free(target);                       \
+    target = NULL
 
 /** @} */
 
@@ -58,6 +58,42 @@ void free_csmi_diag_run_t( csmi_diag_run_t *target );
 */
 void init_csmi_diag_run_t( csmi_diag_run_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_diag_run_t( csmi_diag_run_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_diag_run_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_diag_run_t( csmi_diag_run_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -89,6 +125,42 @@ void free_csmi_diag_run_query_details_result_t( csmi_diag_run_query_details_resu
 */
 void init_csmi_diag_run_query_details_result_t( csmi_diag_run_query_details_result_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_diag_run_query_details_result_t( csmi_diag_run_query_details_result_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_diag_run_query_details_result_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_diag_run_query_details_result_t( csmi_diag_run_query_details_result_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -120,6 +192,42 @@ void free_csm_diag_run_end_input_t( csm_diag_run_end_input_t *target );
 */
 void init_csm_diag_run_end_input_t( csm_diag_run_end_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_diag_run_end_input_t( csm_diag_run_end_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_diag_run_end_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_diag_run_end_input_t( csm_diag_run_end_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -151,6 +259,42 @@ void free_csm_diag_result_create_input_t( csm_diag_result_create_input_t *target
 */
 void init_csm_diag_result_create_input_t( csm_diag_result_create_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_diag_result_create_input_t( csm_diag_result_create_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_diag_result_create_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_diag_result_create_input_t( csm_diag_result_create_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -182,6 +326,42 @@ void free_csm_diag_run_begin_input_t( csm_diag_run_begin_input_t *target );
 */
 void init_csm_diag_run_begin_input_t( csm_diag_run_begin_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_diag_run_begin_input_t( csm_diag_run_begin_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_diag_run_begin_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_diag_run_begin_input_t( csm_diag_run_begin_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -213,6 +393,42 @@ void free_csm_diag_run_query_input_t( csm_diag_run_query_input_t *target );
 */
 void init_csm_diag_run_query_input_t( csm_diag_run_query_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_diag_run_query_input_t( csm_diag_run_query_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_diag_run_query_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_diag_run_query_input_t( csm_diag_run_query_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -244,6 +460,42 @@ void free_csm_diag_run_query_output_t( csm_diag_run_query_output_t *target );
 */
 void init_csm_diag_run_query_output_t( csm_diag_run_query_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_diag_run_query_output_t( csm_diag_run_query_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_diag_run_query_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_diag_run_query_output_t( csm_diag_run_query_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -275,6 +527,42 @@ void free_csm_diag_run_query_details_input_t( csm_diag_run_query_details_input_t
 */
 void init_csm_diag_run_query_details_input_t( csm_diag_run_query_details_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_diag_run_query_details_input_t( csm_diag_run_query_details_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_diag_run_query_details_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_diag_run_query_details_input_t( csm_diag_run_query_details_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -306,6 +594,42 @@ void free_csm_diag_run_query_details_output_t( csm_diag_run_query_details_output
 */
 void init_csm_diag_run_query_details_output_t( csm_diag_run_query_details_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_diag_run_query_details_output_t( csm_diag_run_query_details_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_diag_run_query_details_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_diag_run_query_details_output_t( csm_diag_run_query_details_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
 
 #ifdef __cplusplus
@@ -58,6 +58,42 @@ void free_csmi_dimm_record_t( csmi_dimm_record_t *target );
 */
 void init_csmi_dimm_record_t( csmi_dimm_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_dimm_record_t( csmi_dimm_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_dimm_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_dimm_record_t( csmi_dimm_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -89,6 +125,42 @@ void free_csmi_gpu_record_t( csmi_gpu_record_t *target );
 */
 void init_csmi_gpu_record_t( csmi_gpu_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_gpu_record_t( csmi_gpu_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_gpu_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_gpu_record_t( csmi_gpu_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -120,6 +192,42 @@ void free_csmi_hca_record_t( csmi_hca_record_t *target );
 */
 void init_csmi_hca_record_t( csmi_hca_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_hca_record_t( csmi_hca_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_hca_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_hca_record_t( csmi_hca_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -151,6 +259,42 @@ void free_csmi_ib_cable_record_t( csmi_ib_cable_record_t *target );
 */
 void init_csmi_ib_cable_record_t( csmi_ib_cable_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_ib_cable_record_t( csmi_ib_cable_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_ib_cable_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_ib_cable_record_t( csmi_ib_cable_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -182,6 +326,42 @@ void free_csmi_ib_cable_history_record_t( csmi_ib_cable_history_record_t *target
 */
 void init_csmi_ib_cable_history_record_t( csmi_ib_cable_history_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_ib_cable_history_record_t( csmi_ib_cable_history_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_ib_cable_history_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_ib_cable_history_record_t( csmi_ib_cable_history_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -213,6 +393,42 @@ void free_csmi_node_attributes_record_t( csmi_node_attributes_record_t *target )
 */
 void init_csmi_node_attributes_record_t( csmi_node_attributes_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_node_attributes_record_t( csmi_node_attributes_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_node_attributes_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_node_attributes_record_t( csmi_node_attributes_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -244,6 +460,42 @@ void free_csmi_node_attributes_history_record_t( csmi_node_attributes_history_re
 */
 void init_csmi_node_attributes_history_record_t( csmi_node_attributes_history_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_node_attributes_history_record_t( csmi_node_attributes_history_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_node_attributes_history_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_node_attributes_history_record_t( csmi_node_attributes_history_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -275,6 +527,42 @@ void free_csmi_node_query_state_history_record_t( csmi_node_query_state_history_
 */
 void init_csmi_node_query_state_history_record_t( csmi_node_query_state_history_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_node_query_state_history_record_t( csmi_node_query_state_history_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_node_query_state_history_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_node_query_state_history_record_t( csmi_node_query_state_history_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -306,6 +594,42 @@ void free_csmi_processor_record_t( csmi_processor_record_t *target );
 */
 void init_csmi_processor_record_t( csmi_processor_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_processor_record_t( csmi_processor_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_processor_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_processor_record_t( csmi_processor_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -337,6 +661,42 @@ void free_csmi_ssd_record_t( csmi_ssd_record_t *target );
 */
 void init_csmi_ssd_record_t( csmi_ssd_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_ssd_record_t( csmi_ssd_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_ssd_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_ssd_record_t( csmi_ssd_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -368,6 +728,42 @@ void free_csmi_switch_record_t( csmi_switch_record_t *target );
 */
 void init_csmi_switch_record_t( csmi_switch_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_switch_record_t( csmi_switch_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_switch_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_switch_record_t( csmi_switch_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -399,6 +795,42 @@ void free_csmi_switch_inventory_record_t( csmi_switch_inventory_record_t *target
 */
 void init_csmi_switch_inventory_record_t( csmi_switch_inventory_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_switch_inventory_record_t( csmi_switch_inventory_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_switch_inventory_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_switch_inventory_record_t( csmi_switch_inventory_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -430,6 +862,42 @@ void free_csmi_switch_ports_record_t( csmi_switch_ports_record_t *target );
 */
 void init_csmi_switch_ports_record_t( csmi_switch_ports_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_switch_ports_record_t( csmi_switch_ports_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_switch_ports_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_switch_ports_record_t( csmi_switch_ports_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -461,6 +929,42 @@ void free_csmi_switch_details_t( csmi_switch_details_t *target );
 */
 void init_csmi_switch_details_t( csmi_switch_details_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_switch_details_t( csmi_switch_details_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_switch_details_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_switch_details_t( csmi_switch_details_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -492,6 +996,42 @@ void free_csmi_switch_history_record_t( csmi_switch_history_record_t *target );
 */
 void init_csmi_switch_history_record_t( csmi_switch_history_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_switch_history_record_t( csmi_switch_history_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_switch_history_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_switch_history_record_t( csmi_switch_history_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -523,6 +1063,42 @@ void free_csmi_node_env_data_t( csmi_node_env_data_t *target );
 */
 void init_csmi_node_env_data_t( csmi_node_env_data_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_node_env_data_t( csmi_node_env_data_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_node_env_data_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_node_env_data_t( csmi_node_env_data_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -554,6 +1130,42 @@ void free_csmi_switch_env_data_t( csmi_switch_env_data_t *target );
 */
 void init_csmi_switch_env_data_t( csmi_switch_env_data_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_switch_env_data_t( csmi_switch_env_data_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_switch_env_data_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_switch_env_data_t( csmi_switch_env_data_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -585,6 +1197,42 @@ void free_csmi_fabric_topology_t( csmi_fabric_topology_t *target );
 */
 void init_csmi_fabric_topology_t( csmi_fabric_topology_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_fabric_topology_t( csmi_fabric_topology_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_fabric_topology_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_fabric_topology_t( csmi_fabric_topology_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -616,6 +1264,42 @@ void free_csmi_node_details_t( csmi_node_details_t *target );
 */
 void init_csmi_node_details_t( csmi_node_details_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_node_details_t( csmi_node_details_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_node_details_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_node_details_t( csmi_node_details_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -647,6 +1331,42 @@ void free_csmi_cluster_query_state_record_t( csmi_cluster_query_state_record_t *
 */
 void init_csmi_cluster_query_state_record_t( csmi_cluster_query_state_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_cluster_query_state_record_t( csmi_cluster_query_state_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_cluster_query_state_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_cluster_query_state_record_t( csmi_cluster_query_state_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -678,6 +1398,42 @@ void free_csmi_node_find_job_record_t( csmi_node_find_job_record_t *target );
 */
 void init_csmi_node_find_job_record_t( csmi_node_find_job_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_node_find_job_record_t( csmi_node_find_job_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_node_find_job_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_node_find_job_record_t( csmi_node_find_job_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -709,6 +1465,42 @@ void free_csm_ib_cable_inventory_collection_input_t( csm_ib_cable_inventory_coll
 */
 void init_csm_ib_cable_inventory_collection_input_t( csm_ib_cable_inventory_collection_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_ib_cable_inventory_collection_input_t( csm_ib_cable_inventory_collection_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_ib_cable_inventory_collection_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_ib_cable_inventory_collection_input_t( csm_ib_cable_inventory_collection_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -740,6 +1532,42 @@ void free_csm_ib_cable_inventory_collection_output_t( csm_ib_cable_inventory_col
 */
 void init_csm_ib_cable_inventory_collection_output_t( csm_ib_cable_inventory_collection_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_ib_cable_inventory_collection_output_t( csm_ib_cable_inventory_collection_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_ib_cable_inventory_collection_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_ib_cable_inventory_collection_output_t( csm_ib_cable_inventory_collection_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -771,6 +1599,42 @@ void free_csm_ib_cable_query_input_t( csm_ib_cable_query_input_t *target );
 */
 void init_csm_ib_cable_query_input_t( csm_ib_cable_query_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_ib_cable_query_input_t( csm_ib_cable_query_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_ib_cable_query_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_ib_cable_query_input_t( csm_ib_cable_query_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -802,6 +1666,42 @@ void free_csm_ib_cable_query_output_t( csm_ib_cable_query_output_t *target );
 */
 void init_csm_ib_cable_query_output_t( csm_ib_cable_query_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_ib_cable_query_output_t( csm_ib_cable_query_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_ib_cable_query_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_ib_cable_query_output_t( csm_ib_cable_query_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -833,6 +1733,42 @@ void free_csm_ib_cable_query_history_input_t( csm_ib_cable_query_history_input_t
 */
 void init_csm_ib_cable_query_history_input_t( csm_ib_cable_query_history_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_ib_cable_query_history_input_t( csm_ib_cable_query_history_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_ib_cable_query_history_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_ib_cable_query_history_input_t( csm_ib_cable_query_history_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -864,6 +1800,42 @@ void free_csm_ib_cable_query_history_output_t( csm_ib_cable_query_history_output
 */
 void init_csm_ib_cable_query_history_output_t( csm_ib_cable_query_history_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_ib_cable_query_history_output_t( csm_ib_cable_query_history_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_ib_cable_query_history_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_ib_cable_query_history_output_t( csm_ib_cable_query_history_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -895,6 +1867,42 @@ void free_csm_ib_cable_update_input_t( csm_ib_cable_update_input_t *target );
 */
 void init_csm_ib_cable_update_input_t( csm_ib_cable_update_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_ib_cable_update_input_t( csm_ib_cable_update_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_ib_cable_update_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_ib_cable_update_input_t( csm_ib_cable_update_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -926,6 +1934,42 @@ void free_csm_ib_cable_update_output_t( csm_ib_cable_update_output_t *target );
 */
 void init_csm_ib_cable_update_output_t( csm_ib_cable_update_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_ib_cable_update_output_t( csm_ib_cable_update_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_ib_cable_update_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_ib_cable_update_output_t( csm_ib_cable_update_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -957,6 +2001,42 @@ void free_csm_node_attributes_query_input_t( csm_node_attributes_query_input_t *
 */
 void init_csm_node_attributes_query_input_t( csm_node_attributes_query_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_attributes_query_input_t( csm_node_attributes_query_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_attributes_query_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_attributes_query_input_t( csm_node_attributes_query_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -988,6 +2068,42 @@ void free_csm_node_attributes_query_output_t( csm_node_attributes_query_output_t
 */
 void init_csm_node_attributes_query_output_t( csm_node_attributes_query_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_attributes_query_output_t( csm_node_attributes_query_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_attributes_query_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_attributes_query_output_t( csm_node_attributes_query_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1019,6 +2135,42 @@ void free_csm_node_attributes_query_details_input_t( csm_node_attributes_query_d
 */
 void init_csm_node_attributes_query_details_input_t( csm_node_attributes_query_details_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_attributes_query_details_input_t( csm_node_attributes_query_details_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_attributes_query_details_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_attributes_query_details_input_t( csm_node_attributes_query_details_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1050,6 +2202,42 @@ void free_csm_node_attributes_query_details_output_t( csm_node_attributes_query_
 */
 void init_csm_node_attributes_query_details_output_t( csm_node_attributes_query_details_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_attributes_query_details_output_t( csm_node_attributes_query_details_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_attributes_query_details_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_attributes_query_details_output_t( csm_node_attributes_query_details_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1081,6 +2269,42 @@ void free_csm_node_attributes_query_history_input_t( csm_node_attributes_query_h
 */
 void init_csm_node_attributes_query_history_input_t( csm_node_attributes_query_history_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_attributes_query_history_input_t( csm_node_attributes_query_history_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_attributes_query_history_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_attributes_query_history_input_t( csm_node_attributes_query_history_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1112,6 +2336,42 @@ void free_csm_node_attributes_query_history_output_t( csm_node_attributes_query_
 */
 void init_csm_node_attributes_query_history_output_t( csm_node_attributes_query_history_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_attributes_query_history_output_t( csm_node_attributes_query_history_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_attributes_query_history_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_attributes_query_history_output_t( csm_node_attributes_query_history_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1143,6 +2403,42 @@ void free_csm_node_query_state_history_input_t( csm_node_query_state_history_inp
 */
 void init_csm_node_query_state_history_input_t( csm_node_query_state_history_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_query_state_history_input_t( csm_node_query_state_history_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_query_state_history_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_query_state_history_input_t( csm_node_query_state_history_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1174,6 +2470,42 @@ void free_csm_node_query_state_history_output_t( csm_node_query_state_history_ou
 */
 void init_csm_node_query_state_history_output_t( csm_node_query_state_history_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_query_state_history_output_t( csm_node_query_state_history_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_query_state_history_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_query_state_history_output_t( csm_node_query_state_history_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1205,6 +2537,42 @@ void free_csm_node_attributes_update_input_t( csm_node_attributes_update_input_t
 */
 void init_csm_node_attributes_update_input_t( csm_node_attributes_update_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_attributes_update_input_t( csm_node_attributes_update_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_attributes_update_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_attributes_update_input_t( csm_node_attributes_update_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1236,6 +2604,42 @@ void free_csm_node_attributes_update_output_t( csm_node_attributes_update_output
 */
 void init_csm_node_attributes_update_output_t( csm_node_attributes_update_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_attributes_update_output_t( csm_node_attributes_update_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_attributes_update_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_attributes_update_output_t( csm_node_attributes_update_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1267,6 +2671,42 @@ void free_csm_node_delete_input_t( csm_node_delete_input_t *target );
 */
 void init_csm_node_delete_input_t( csm_node_delete_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_delete_input_t( csm_node_delete_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_delete_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_delete_input_t( csm_node_delete_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1298,6 +2738,42 @@ void free_csm_node_delete_output_t( csm_node_delete_output_t *target );
 */
 void init_csm_node_delete_output_t( csm_node_delete_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_delete_output_t( csm_node_delete_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_delete_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_delete_output_t( csm_node_delete_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1329,6 +2805,42 @@ void free_csm_node_find_job_input_t( csm_node_find_job_input_t *target );
 */
 void init_csm_node_find_job_input_t( csm_node_find_job_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_find_job_input_t( csm_node_find_job_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_find_job_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_find_job_input_t( csm_node_find_job_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1360,6 +2872,42 @@ void free_csm_node_find_job_output_t( csm_node_find_job_output_t *target );
 */
 void init_csm_node_find_job_output_t( csm_node_find_job_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_find_job_output_t( csm_node_find_job_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_find_job_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_find_job_output_t( csm_node_find_job_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1391,6 +2939,42 @@ void free_csm_switch_attributes_query_input_t( csm_switch_attributes_query_input
 */
 void init_csm_switch_attributes_query_input_t( csm_switch_attributes_query_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_switch_attributes_query_input_t( csm_switch_attributes_query_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_switch_attributes_query_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_switch_attributes_query_input_t( csm_switch_attributes_query_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1422,6 +3006,42 @@ void free_csm_switch_attributes_query_output_t( csm_switch_attributes_query_outp
 */
 void init_csm_switch_attributes_query_output_t( csm_switch_attributes_query_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_switch_attributes_query_output_t( csm_switch_attributes_query_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_switch_attributes_query_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_switch_attributes_query_output_t( csm_switch_attributes_query_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1453,6 +3073,42 @@ void free_csm_switch_attributes_query_details_input_t( csm_switch_attributes_que
 */
 void init_csm_switch_attributes_query_details_input_t( csm_switch_attributes_query_details_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_switch_attributes_query_details_input_t( csm_switch_attributes_query_details_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_switch_attributes_query_details_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_switch_attributes_query_details_input_t( csm_switch_attributes_query_details_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1484,6 +3140,42 @@ void free_csm_switch_attributes_query_details_output_t( csm_switch_attributes_qu
 */
 void init_csm_switch_attributes_query_details_output_t( csm_switch_attributes_query_details_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_switch_attributes_query_details_output_t( csm_switch_attributes_query_details_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_switch_attributes_query_details_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_switch_attributes_query_details_output_t( csm_switch_attributes_query_details_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1515,6 +3207,42 @@ void free_csm_switch_attributes_query_history_input_t( csm_switch_attributes_que
 */
 void init_csm_switch_attributes_query_history_input_t( csm_switch_attributes_query_history_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_switch_attributes_query_history_input_t( csm_switch_attributes_query_history_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_switch_attributes_query_history_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_switch_attributes_query_history_input_t( csm_switch_attributes_query_history_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1546,6 +3274,42 @@ void free_csm_switch_attributes_query_history_output_t( csm_switch_attributes_qu
 */
 void init_csm_switch_attributes_query_history_output_t( csm_switch_attributes_query_history_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_switch_attributes_query_history_output_t( csm_switch_attributes_query_history_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_switch_attributes_query_history_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_switch_attributes_query_history_output_t( csm_switch_attributes_query_history_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1577,6 +3341,42 @@ void free_csm_switch_attributes_update_input_t( csm_switch_attributes_update_inp
 */
 void init_csm_switch_attributes_update_input_t( csm_switch_attributes_update_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_switch_attributes_update_input_t( csm_switch_attributes_update_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_switch_attributes_update_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_switch_attributes_update_input_t( csm_switch_attributes_update_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1608,6 +3408,42 @@ void free_csm_switch_attributes_update_output_t( csm_switch_attributes_update_ou
 */
 void init_csm_switch_attributes_update_output_t( csm_switch_attributes_update_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_switch_attributes_update_output_t( csm_switch_attributes_update_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_switch_attributes_update_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_switch_attributes_update_output_t( csm_switch_attributes_update_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1639,6 +3475,42 @@ void free_csm_switch_inventory_collection_input_t( csm_switch_inventory_collecti
 */
 void init_csm_switch_inventory_collection_input_t( csm_switch_inventory_collection_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_switch_inventory_collection_input_t( csm_switch_inventory_collection_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_switch_inventory_collection_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_switch_inventory_collection_input_t( csm_switch_inventory_collection_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1670,6 +3542,42 @@ void free_csm_switch_inventory_collection_output_t( csm_switch_inventory_collect
 */
 void init_csm_switch_inventory_collection_output_t( csm_switch_inventory_collection_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_switch_inventory_collection_output_t( csm_switch_inventory_collection_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_switch_inventory_collection_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_switch_inventory_collection_output_t( csm_switch_inventory_collection_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1701,6 +3609,42 @@ void free_csm_switch_children_inventory_collection_input_t( csm_switch_children_
 */
 void init_csm_switch_children_inventory_collection_input_t( csm_switch_children_inventory_collection_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_switch_children_inventory_collection_input_t( csm_switch_children_inventory_collection_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_switch_children_inventory_collection_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_switch_children_inventory_collection_input_t( csm_switch_children_inventory_collection_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1732,6 +3676,42 @@ void free_csm_switch_children_inventory_collection_output_t( csm_switch_children
 */
 void init_csm_switch_children_inventory_collection_output_t( csm_switch_children_inventory_collection_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_switch_children_inventory_collection_output_t( csm_switch_children_inventory_collection_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_switch_children_inventory_collection_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_switch_children_inventory_collection_output_t( csm_switch_children_inventory_collection_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1763,6 +3743,42 @@ void free_csm_cluster_query_state_input_t( csm_cluster_query_state_input_t *targ
 */
 void init_csm_cluster_query_state_input_t( csm_cluster_query_state_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_cluster_query_state_input_t( csm_cluster_query_state_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_cluster_query_state_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_cluster_query_state_input_t( csm_cluster_query_state_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1794,6 +3810,42 @@ void free_csm_cluster_query_state_output_t( csm_cluster_query_state_output_t *ta
 */
 void init_csm_cluster_query_state_output_t( csm_cluster_query_state_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_cluster_query_state_output_t( csm_cluster_query_state_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_cluster_query_state_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_cluster_query_state_output_t( csm_cluster_query_state_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
 
 #ifdef __cplusplus
@@ -58,6 +58,42 @@ void free_csmi_allocation_history_t( csmi_allocation_history_t *target );
 */
 void init_csmi_allocation_history_t( csmi_allocation_history_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_allocation_history_t( csmi_allocation_history_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_allocation_history_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_allocation_history_t( csmi_allocation_history_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -89,6 +125,42 @@ void free_csmi_allocation_t( csmi_allocation_t *target );
 */
 void init_csmi_allocation_t( csmi_allocation_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_allocation_t( csmi_allocation_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_allocation_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_allocation_t( csmi_allocation_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -120,6 +192,42 @@ void free_csmi_allocation_accounting_t( csmi_allocation_accounting_t *target );
 */
 void init_csmi_allocation_accounting_t( csmi_allocation_accounting_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_allocation_accounting_t( csmi_allocation_accounting_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_allocation_accounting_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_allocation_accounting_t( csmi_allocation_accounting_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -151,6 +259,42 @@ void free_csmi_allocation_step_list_t( csmi_allocation_step_list_t *target );
 */
 void init_csmi_allocation_step_list_t( csmi_allocation_step_list_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_allocation_step_list_t( csmi_allocation_step_list_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_allocation_step_list_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_allocation_step_list_t( csmi_allocation_step_list_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -182,6 +326,42 @@ void free_csmi_allocation_state_history_t( csmi_allocation_state_history_t *targ
 */
 void init_csmi_allocation_state_history_t( csmi_allocation_state_history_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_allocation_state_history_t( csmi_allocation_state_history_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_allocation_state_history_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_allocation_state_history_t( csmi_allocation_state_history_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -213,6 +393,42 @@ void free_csmi_allocation_details_t( csmi_allocation_details_t *target );
 */
 void init_csmi_allocation_details_t( csmi_allocation_details_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_allocation_details_t( csmi_allocation_details_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_allocation_details_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_allocation_details_t( csmi_allocation_details_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -244,6 +460,42 @@ void free_csmi_allocation_step_history_t( csmi_allocation_step_history_t *target
 */
 void init_csmi_allocation_step_history_t( csmi_allocation_step_history_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_allocation_step_history_t( csmi_allocation_step_history_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_allocation_step_history_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_allocation_step_history_t( csmi_allocation_step_history_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -275,6 +527,42 @@ void free_csmi_allocation_step_t( csmi_allocation_step_t *target );
 */
 void init_csmi_allocation_step_t( csmi_allocation_step_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_allocation_step_t( csmi_allocation_step_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_allocation_step_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_allocation_step_t( csmi_allocation_step_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -306,6 +594,42 @@ void free_csmi_ssd_resources_record_t( csmi_ssd_resources_record_t *target );
 */
 void init_csmi_ssd_resources_record_t( csmi_ssd_resources_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_ssd_resources_record_t( csmi_ssd_resources_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_ssd_resources_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_ssd_resources_record_t( csmi_ssd_resources_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -337,6 +661,42 @@ void free_csmi_node_resources_record_t( csmi_node_resources_record_t *target );
 */
 void init_csmi_node_resources_record_t( csmi_node_resources_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_node_resources_record_t( csmi_node_resources_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_node_resources_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_node_resources_record_t( csmi_node_resources_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -368,6 +728,42 @@ void free_csmi_cgroup_t( csmi_cgroup_t *target );
 */
 void init_csmi_cgroup_t( csmi_cgroup_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_cgroup_t( csmi_cgroup_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_cgroup_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_cgroup_t( csmi_cgroup_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -399,6 +795,42 @@ void free_csmi_allocation_resources_record_t( csmi_allocation_resources_record_t
 */
 void init_csmi_allocation_resources_record_t( csmi_allocation_resources_record_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csmi_allocation_resources_record_t( csmi_allocation_resources_record_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csmi_allocation_resources_record_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csmi_allocation_resources_record_t( csmi_allocation_resources_record_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /** @see serialize_csmi_allocation_t */
 #define serialize_csm_allocation_create_input_t( target, buf, buffer_len )\
@@ -414,6 +846,17 @@ void init_csmi_allocation_resources_record_t( csmi_allocation_resources_record_t
 /** @see init_csmi_allocation_t */
 #define init_csm_allocation_create_input_t( target ) init_csmi_allocation_t(target)
 
+/** @see serialize_buffer_csmi_allocation_t */
+#define serialize_buffer_csm_allocation_create_input_t( target, buf, buffer_len, buffer_capacity )\
+    serialize_buffer_csmi_allocation_t( target, buf, buffer_len, buffer_capacity )
+
+/** @see arena_size_csmi_allocation_t */
+#define arena_size_csm_allocation_create_input_t( buffer, buffer_len ) arena_size_csmi_allocation_t( buffer, buffer_len )
+
+/** @see deserialize_arena_csmi_allocation_t */
+#define deserialize_arena_csm_allocation_create_input_t( dest, buffer, buffer_len, arena, arena_size )\
+    deserialize_arena_csmi_allocation_t( dest, buffer, buffer_len, arena, arena_size )
+
  /**  @brief Serializes the supplied structure into a char buffer.
 *
 * @param[in]  target     The structure to pack into the char buffer.
@@ -444,6 +887,42 @@ void free_csm_allocation_query_details_input_t( csm_allocation_query_details_inp
 */
 void init_csm_allocation_query_details_input_t( csm_allocation_query_details_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_query_details_input_t( csm_allocation_query_details_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_query_details_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_query_details_input_t( csm_allocation_query_details_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -475,6 +954,42 @@ void free_csm_allocation_query_details_output_t( csm_allocation_query_details_ou
 */
 void init_csm_allocation_query_details_output_t( csm_allocation_query_details_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_query_details_output_t( csm_allocation_query_details_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_query_details_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_query_details_output_t( csm_allocation_query_details_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -506,6 +1021,42 @@ void free_csm_allocation_update_state_input_t( csm_allocation_update_state_input
 */
 void init_csm_allocation_update_state_input_t( csm_allocation_update_state_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_update_state_input_t( csm_allocation_update_state_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_update_state_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_update_state_input_t( csm_allocation_update_state_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /** @see serialize_csmi_allocation_step_t */
 #define serialize_csm_allocation_step_begin_input_t( target, buf, buffer_len )\
@@ -521,6 +1072,17 @@ void init_csm_allocation_update_state_input_t( csm_allocation_update_state_input
 /** @see init_csmi_allocation_step_t */
 #define init_csm_allocation_step_begin_input_t( target ) init_csmi_allocation_step_t(target)
 
+/** @see serialize_buffer_csmi_allocation_step_t */
+#define serialize_buffer_csm_allocation_step_begin_input_t( target, buf, buffer_len, buffer_capacity )\
+    serialize_buffer_csmi_allocation_step_t( target, buf, buffer_len, buffer_capacity )
+
+/** @see arena_size_csmi_allocation_step_t */
+#define arena_size_csm_allocation_step_begin_input_t( buffer, buffer_len ) arena_size_csmi_allocation_step_t( buffer, buffer_len )
+
+/** @see deserialize_arena_csmi_allocation_step_t */
+#define deserialize_arena_csm_allocation_step_begin_input_t( dest, buffer, buffer_len, arena, arena_size )\
+    deserialize_arena_csmi_allocation_step_t( dest, buffer, buffer_len, arena, arena_size )
+
  /**  @brief Serializes the supplied structure into a char buffer.
 *
 * @param[in]  target     The structure to pack into the char buffer.
@@ -551,19 +1113,55 @@ void free_csm_allocation_step_end_input_t( csm_allocation_step_end_input_t *targ
 */
 void init_csm_allocation_step_end_input_t( csm_allocation_step_end_input_t *target );
 
-
- /**  @brief Serializes the supplied structure into a char buffer.
+/** @brief Serializes the supplied structure into a reusable buffer.
 *
-* @param[in]  target     The structure to pack into the char buffer.
-* @param[out] buf        Contains the structure as char buffer.
-* @param[out] buffer_len Contains the length of the buffer.
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
 */
-int serialize_csm_allocation_step_query_input_t( csm_allocation_step_query_input_t *target, char **buf , uint32_t *buffer_len);
+int serialize_buffer_csm_allocation_step_end_input_t( csm_allocation_step_end_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
 
-/** @brief Deserializes the supplied character buffer.
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
 *
-* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
-* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_step_end_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_step_end_input_t( csm_allocation_step_end_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
+
+ /**  @brief Serializes the supplied structure into a char buffer.
+*
+* @param[in]  target     The structure to pack into the char buffer.
+* @param[out] buf        Contains the structure as char buffer.
+* @param[out] buffer_len Contains the length of the buffer.
+*/
+int serialize_csm_allocation_step_query_input_t( csm_allocation_step_query_input_t *target, char **buf , uint32_t *buffer_len);
+
+/** @brief Deserializes the supplied character buffer.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
 * @param[in]  buffer_len The size of the buffer provided (for overflows).
 */
 int deserialize_csm_allocation_step_query_input_t( csm_allocation_step_query_input_t **dest, const char *buffer, uint32_t buffer_len);
@@ -582,6 +1180,42 @@ void free_csm_allocation_step_query_input_t( csm_allocation_step_query_input_t *
 */
 void init_csm_allocation_step_query_input_t( csm_allocation_step_query_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_step_query_input_t( csm_allocation_step_query_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_step_query_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_step_query_input_t( csm_allocation_step_query_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -613,6 +1247,42 @@ void free_csm_allocation_step_query_output_t( csm_allocation_step_query_output_t
 */
 void init_csm_allocation_step_query_output_t( csm_allocation_step_query_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_step_query_output_t( csm_allocation_step_query_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_step_query_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_step_query_output_t( csm_allocation_step_query_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -644,6 +1314,42 @@ void free_csm_allocation_step_query_details_input_t( csm_allocation_step_query_d
 */
 void init_csm_allocation_step_query_details_input_t( csm_allocation_step_query_details_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_step_query_details_input_t( csm_allocation_step_query_details_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_step_query_details_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_step_query_details_input_t( csm_allocation_step_query_details_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /** @see serialize_csm_allocation_step_query_output_t */
 #define serialize_csm_allocation_step_query_details_output_t( target, buf, buffer_len )\
@@ -659,6 +1365,17 @@ void init_csm_allocation_step_query_details_input_t( csm_allocation_step_query_d
 /** @see init_csm_allocation_step_query_output_t */
 #define init_csm_allocation_step_query_details_output_t( target ) init_csm_allocation_step_query_output_t(target)
 
+/** @see serialize_buffer_csm_allocation_step_query_output_t */
+#define serialize_buffer_csm_allocation_step_query_details_output_t( target, buf, buffer_len, buffer_capacity )\
+    serialize_buffer_csm_allocation_step_query_output_t( target, buf, buffer_len, buffer_capacity )
+
+/** @see arena_size_csm_allocation_step_query_output_t */
+#define arena_size_csm_allocation_step_query_details_output_t( buffer, buffer_len ) arena_size_csm_allocation_step_query_output_t( buffer, buffer_len )
+
+/** @see deserialize_arena_csm_allocation_step_query_output_t */
+#define deserialize_arena_csm_allocation_step_query_details_output_t( dest, buffer, buffer_len, arena, arena_size )\
+    deserialize_arena_csm_allocation_step_query_output_t( dest, buffer, buffer_len, arena, arena_size )
+
  /**  @brief Serializes the supplied structure into a char buffer.
 *
 * @param[in]  target     The structure to pack into the char buffer.
@@ -689,6 +1406,42 @@ void free_csm_allocation_step_query_active_all_input_t( csm_allocation_step_quer
 */
 void init_csm_allocation_step_query_active_all_input_t( csm_allocation_step_query_active_all_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_step_query_active_all_input_t( csm_allocation_step_query_active_all_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_step_query_active_all_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_step_query_active_all_input_t( csm_allocation_step_query_active_all_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /** @see serialize_csm_allocation_step_query_output_t */
 #define serialize_csm_allocation_step_query_active_all_output_t( target, buf, buffer_len )\
@@ -704,6 +1457,17 @@ void init_csm_allocation_step_query_active_all_input_t( csm_allocation_step_quer
 /** @see init_csm_allocation_step_query_output_t */
 #define init_csm_allocation_step_query_active_all_output_t( target ) init_csm_allocation_step_query_output_t(target)
 
+/** @see serialize_buffer_csm_allocation_step_query_output_t */
+#define serialize_buffer_csm_allocation_step_query_active_all_output_t( target, buf, buffer_len, buffer_capacity )\
+    serialize_buffer_csm_allocation_step_query_output_t( target, buf, buffer_len, buffer_capacity )
+
+/** @see arena_size_csm_allocation_step_query_output_t */
+#define arena_size_csm_allocation_step_query_active_all_output_t( buffer, buffer_len ) arena_size_csm_allocation_step_query_output_t( buffer, buffer_len )
+
+/** @see deserialize_arena_csm_allocation_step_query_output_t */
+#define deserialize_arena_csm_allocation_step_query_active_all_output_t( dest, buffer, buffer_len, arena, arena_size )\
+    deserialize_arena_csm_allocation_step_query_output_t( dest, buffer, buffer_len, arena, arena_size )
+
  /**  @brief Serializes the supplied structure into a char buffer.
 *
 * @param[in]  target     The structure to pack into the char buffer.
@@ -734,6 +1498,42 @@ void free_csm_node_resources_query_input_t( csm_node_resources_query_input_t *ta
 */
 void init_csm_node_resources_query_input_t( csm_node_resources_query_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_resources_query_input_t( csm_node_resources_query_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_resources_query_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_resources_query_input_t( csm_node_resources_query_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -765,6 +1565,42 @@ void free_csm_node_resources_query_output_t( csm_node_resources_query_output_t *
 */
 void init_csm_node_resources_query_output_t( csm_node_resources_query_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_resources_query_output_t( csm_node_resources_query_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_resources_query_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_resources_query_output_t( csm_node_resources_query_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -796,6 +1632,42 @@ void free_csm_node_resources_query_all_input_t( csm_node_resources_query_all_inp
 */
 void init_csm_node_resources_query_all_input_t( csm_node_resources_query_all_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_resources_query_all_input_t( csm_node_resources_query_all_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_resources_query_all_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_resources_query_all_input_t( csm_node_resources_query_all_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -827,6 +1699,42 @@ void free_csm_node_resources_query_all_output_t( csm_node_resources_query_all_ou
 */
 void init_csm_node_resources_query_all_output_t( csm_node_resources_query_all_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_node_resources_query_all_output_t( csm_node_resources_query_all_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_node_resources_query_all_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_node_resources_query_all_output_t( csm_node_resources_query_all_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -858,6 +1766,42 @@ void free_csm_allocation_step_cgroup_create_input_t( csm_allocation_step_cgroup_
 */
 void init_csm_allocation_step_cgroup_create_input_t( csm_allocation_step_cgroup_create_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_step_cgroup_create_input_t( csm_allocation_step_cgroup_create_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_step_cgroup_create_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_step_cgroup_create_input_t( csm_allocation_step_cgroup_create_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -889,6 +1833,42 @@ void free_csm_allocation_step_cgroup_delete_input_t( csm_allocation_step_cgroup_
 */
 void init_csm_allocation_step_cgroup_delete_input_t( csm_allocation_step_cgroup_delete_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_step_cgroup_delete_input_t( csm_allocation_step_cgroup_delete_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_step_cgroup_delete_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_step_cgroup_delete_input_t( csm_allocation_step_cgroup_delete_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -920,6 +1900,42 @@ void free_csm_allocation_resources_query_input_t( csm_allocation_resources_query
 */
 void init_csm_allocation_resources_query_input_t( csm_allocation_resources_query_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_resources_query_input_t( csm_allocation_resources_query_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_resources_query_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_resources_query_input_t( csm_allocation_resources_query_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -951,6 +1967,42 @@ void free_csm_allocation_resources_query_output_t( csm_allocation_resources_quer
 */
 void init_csm_allocation_resources_query_output_t( csm_allocation_resources_query_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_resources_query_output_t( csm_allocation_resources_query_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_resources_query_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_resources_query_output_t( csm_allocation_resources_query_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -982,6 +2034,42 @@ void free_csm_allocation_update_history_input_t( csm_allocation_update_history_i
 */
 void init_csm_allocation_update_history_input_t( csm_allocation_update_history_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_update_history_input_t( csm_allocation_update_history_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_update_history_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_update_history_input_t( csm_allocation_update_history_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1013,6 +2101,42 @@ void free_csm_allocation_query_input_t( csm_allocation_query_input_t *target );
 */
 void init_csm_allocation_query_input_t( csm_allocation_query_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_query_input_t( csm_allocation_query_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_query_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_query_input_t( csm_allocation_query_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1044,6 +2168,42 @@ void free_csm_allocation_query_output_t( csm_allocation_query_output_t *target )
 */
 void init_csm_allocation_query_output_t( csm_allocation_query_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_query_output_t( csm_allocation_query_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_query_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_query_output_t( csm_allocation_query_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1075,6 +2235,42 @@ void free_csm_allocation_query_active_all_input_t( csm_allocation_query_active_a
 */
 void init_csm_allocation_query_active_all_input_t( csm_allocation_query_active_all_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_query_active_all_input_t( csm_allocation_query_active_all_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_query_active_all_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_query_active_all_input_t( csm_allocation_query_active_all_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1106,6 +2302,42 @@ void free_csm_allocation_query_active_all_output_t( csm_allocation_query_active_
 */
 void init_csm_allocation_query_active_all_output_t( csm_allocation_query_active_all_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_query_active_all_output_t( csm_allocation_query_active_all_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_query_active_all_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_query_active_all_output_t( csm_allocation_query_active_all_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1137,6 +2369,42 @@ void free_csm_allocation_delete_input_t( csm_allocation_delete_input_t *target )
 */
 void init_csm_allocation_delete_input_t( csm_allocation_delete_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_allocation_delete_input_t( csm_allocation_delete_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_allocation_delete_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_allocation_delete_input_t( csm_allocation_delete_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1168,6 +2436,42 @@ void free_csm_cgroup_login_input_t( csm_cgroup_login_input_t *target );
 */
 void init_csm_cgroup_login_input_t( csm_cgroup_login_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_cgroup_login_input_t( csm_cgroup_login_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_cgroup_login_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_cgroup_login_input_t( csm_cgroup_login_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1199,6 +2503,42 @@ void free_csm_jsrun_cmd_input_t( csm_jsrun_cmd_input_t *target );
 */
 void init_csm_jsrun_cmd_input_t( csm_jsrun_cmd_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_jsrun_cmd_input_t( csm_jsrun_cmd_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_jsrun_cmd_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_jsrun_cmd_input_t( csm_jsrun_cmd_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1230,6 +2570,42 @@ void free_csm_soft_failure_recovery_node_t( csm_soft_failure_recovery_node_t *ta
 */
 void init_csm_soft_failure_recovery_node_t( csm_soft_failure_recovery_node_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_soft_failure_recovery_node_t( csm_soft_failure_recovery_node_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_soft_failure_recovery_node_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_soft_failure_recovery_node_t( csm_soft_failure_recovery_node_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1261,6 +2637,42 @@ void free_csm_soft_failure_recovery_input_t( csm_soft_failure_recovery_input_t *
 */
 void init_csm_soft_failure_recovery_input_t( csm_soft_failure_recovery_input_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_soft_failure_recovery_input_t( csm_soft_failure_recovery_input_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_soft_failure_recovery_input_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_soft_failure_recovery_input_t( csm_soft_failure_recovery_input_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
  /**  @brief Serializes the supplied structure into a char buffer.
 *
@@ -1292,6 +2704,42 @@ void free_csm_soft_failure_recovery_output_t( csm_soft_failure_recovery_output_t
 */
 void init_csm_soft_failure_recovery_output_t( csm_soft_failure_recovery_output_t *target );
 
+/** @brief Serializes the supplied structure into a reusable buffer.
+*
+* The buffer is only grown (through realloc) if it can't hold the serialized struct,
+* so a buffer kept across calls is allocated once.
+*
+* @param[in]     target          The structure to pack into the char buffer.
+* @param[in,out] buf             The buffer to pack into, may point to NULL.
+* @param[out]    buffer_len      Contains the length of the serialized struct.
+* @param[in,out] buffer_capacity The allocated size of @p buf.
+*/
+int serialize_buffer_csm_soft_failure_recovery_output_t( csm_soft_failure_recovery_output_t *target, char **buf , uint32_t *buffer_len, uint32_t *buffer_capacity);
+
+/** @brief Computes the arena size needed to deserialize the supplied character buffer.
+*
+* @param[in]  buffer     The buffer to read.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+*
+* @return The size in bytes, 0 if the buffer is malformed.
+*/
+uint64_t arena_size_csm_soft_failure_recovery_output_t( const char *buffer, uint32_t buffer_len);
+
+/** @brief Deserializes the supplied character buffer into a single block of memory.
+*
+* The struct and all of its members are carved from one arena, so the result 
+* must not be released by the free function; free the arena instead.
+*
+* @param[out] dest       A pointer to a struct to output the contents of the buffer to.
+* @param[in]  buffer     The buffer to read into the destination struct.
+* @param[in]  buffer_len The size of the buffer provided (for overflows).
+* @param[in]  arena      An 8 byte aligned block of at least @p arena_size bytes, if NULL
+*                        a block of the required size is allocated and @p dest points at
+*                        its start (release it with free).
+* @param[in]  arena_size The size of @p arena, see the arena_size function.
+*/
+int deserialize_arena_csm_soft_failure_recovery_output_t( csm_soft_failure_recovery_output_t **dest, const char *buffer, uint32_t buffer_len, void *arena, uint64_t arena_size);
+
 
 
 #ifdef __cplusplus
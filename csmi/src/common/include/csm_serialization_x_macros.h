@@ -86,6 +86,79 @@
         void CSM_FUNCT_CAT(init_,STRUCT_NAME)(      \
             STRUCT_NAME  *target )
 
+// Defines the serialize_buffer_* function prototype generator.
+#define SERIALIZE_BUFFER_FUNCT(STRUCT_NAME)        \
+    int CSM_FUNCT_CAT(serialize_buffer_,STRUCT_NAME)(  \
+        STRUCT_NAME  *target,                      \
+        char        **buf   ,                      \
+        uint32_t     *buffer_len,                  \
+        uint32_t     *buffer_capacity)
+
+// Defines the arena_len_* function prototype generator.
+#define ARENA_LEN_FUNCT(STRUCT_NAME)               \
+    uint64_t CSM_FUNCT_CAT(arena_len_,STRUCT_NAME)(    \
+        const char   *buffer,                      \
+        uint32_t     *offset,                      \
+        uint32_t      len   ,                      \
+        uint64_t      version_id )
+
+// Defines the unpack_arena_* function prototype generator.
+#define UNPACK_ARENA_FUNCT(STRUCT_NAME)            \
+    void CSM_FUNCT_CAT(unpack_arena_,STRUCT_NAME)(     \
+        STRUCT_NAME **dest,                        \
+        const char   *buffer,                      \
+        uint32_t     *offset,                      \
+        uint32_t      len   ,                      \
+        uint64_t      version_id,                  \
+        csmi_arena_t *arena )
+
+// Defines the arena_size_* function prototype generator.
+#define ARENA_SIZE_FUNCT(STRUCT_NAME)              \
+    uint64_t CSM_FUNCT_CAT(arena_size_,STRUCT_NAME)(   \
+        const char   *buffer,                      \
+        uint32_t      buffer_len)
+
+// Defines the deserialize_arena_* function prototype generator.
+#define DESERIALIZE_ARENA_FUNCT(STRUCT_NAME)       \
+    int CSM_FUNCT_CAT(deserialize_arena_,STRUCT_NAME)( \
+        STRUCT_NAME **dest,                        \
+        const char   *buffer,                      \
+        uint32_t      buffer_len,                  \
+        void         *arena,                       \
+        uint64_t      arena_size)
+
+// ==============================================================
+// Arena
+// ==============================================================
+
+/** The length of the serialization header: struct sum, version id and struct count. */
+#define CSMI_SERIAL_HEADER_LEN ( UINT64_T_SIZE + UINT64_T_SIZE + UINT32_T_SIZE )
+
+/** Alignment of every allocation carved from an arena. */
+#define CSMI_ARENA_ALIGN 8
+#define CSMI_ARENA_ROUND(size) \
+    ( ( (uint64_t)(size) + CSMI_ARENA_ALIGN - 1 ) & ~(uint64_t)( CSMI_ARENA_ALIGN - 1 ) )
+
+/** A zeroed block of memory that an unpack carves the struct and all of its members from. */
+typedef struct {
+    char    *base; ///< The start of the block.
+    uint64_t size; ///< The size of the block in bytes.
+    uint64_t used; ///< The number of bytes handed out so far.
+} csmi_arena_t;
+
+/** Returns @p size bytes from the arena, NULL if the arena is exhausted. */
+static inline void* csmi_arena_alloc( csmi_arena_t *arena, uint64_t size )
+{
+    void *ptr = NULL;
+    size = CSMI_ARENA_ROUND(size);
+    if ( size <= arena->size - arena->used )
+    {
+        ptr = arena->base + arena->used;
+        arena->used += size;
+    }
+    return ptr;
+}
+
 
     // ==============================================================
     // Length Serial Macros - Invoked in LEN_FUNCT(STRUCT_NAME)
@@ -366,6 +439,177 @@
 
 #define UNPACK_NONE(type, name, length_member, metadata)
 
+    // ==============================================================
+    // Arena Length Serial Macros - Invoked in ARENA_LEN_FUNCT(STRUCT_NAME)
+    // Walks the buffer exactly like the UNPACK_ARENA macros and sums the
+    // arena space they will use. Assumes a field "arena_len" exists.
+    // ==============================================================
+
+#define ARENA_LEN_BASIC(type, name, length_member, metadata)                  \
+        if ( (*offset + sizeof(((CSMI_STRUCT_NAME*)0)->name)) <= len)        \
+            *offset += sizeof(((CSMI_STRUCT_NAME*)0)->name);
+
+#define ARENA_LEN_STRING(type, name, length_member, metadata)     \
+        UNPACK_SIZE()                                            \
+        if ( ((uint64_t)*offset + size_dump) <= len) {           \
+            arena_len += CSMI_ARENA_ROUND(size_dump);            \
+            *offset += size_dump; }                              \
+        else *offset = len + 2;
+
+#define ARENA_LEN_STRING_FIXED(type, name, length, metadata) \
+        if( (*offset + length) <= len ) *offset += length;   \
+        else *offset = len + 2;
+
+#define ARENA_LEN_ARRAY(type, name, length_member, metadata)                       \
+        UNPACK_SIZE()                                                              \
+        if ( size_dump > 0 && *offset <= len ) {                                   \
+            if ( ((uint64_t)*offset + (uint64_t)size_dump * sizeof(metadata)) <= len ) { \
+                arena_len += CSMI_ARENA_ROUND((uint64_t)size_dump * sizeof(metadata));  \
+                *offset += size_dump * sizeof(metadata); }                         \
+            else *offset = len + 2;                                                \
+        }
+
+#define ARENA_LEN_ARRAY_FIXED(type, name, length, metadata)  \
+        if( (*offset + sizeof(metadata) ) <= len )           \
+            *offset += length;                               \
+        else *offset = len + 2;
+
+#define ARENA_LEN_ARRAY_STR_FIXED(type, name, length, metadata)                         \
+        if( length > 0 && *offset <= len ){                                             \
+            if ( ((uint64_t)*offset + (uint64_t)length * UINT32_T_SIZE) <= len ) {      \
+                arena_len += CSMI_ARENA_ROUND(PTR_SIZE * (uint64_t)length);             \
+                for ( i=0; i < length; i++) {                                           \
+                    memcpy( &str_offset, buffer + *offset, sizeof(str_offset) );        \
+                    *offset += sizeof(str_offset);                                      \
+                    if( ((uint64_t)*offset + str_offset) > len ) {                      \
+                        *offset = len + 2;                                              \
+                        break; }                                                        \
+                    arena_len += CSMI_ARENA_ROUND(str_offset);                          \
+                    *offset += str_offset;                                              \
+                    if( (*offset + sizeof(str_offset)) > len && i + 1 < length ) {      \
+                        *offset = len + 2;                                              \
+                        break; }                                                        \
+                }                                                                       \
+            }                                                                           \
+            else *offset = len + 2;                                                     \
+        }
+
+#define ARENA_LEN_ARRAY_STR(type, name, length_member, metadata)  \
+        UNPACK_SIZE()                                             \
+        ARENA_LEN_ARRAY_STR_FIXED(type, name, size_dump, metadata);
+
+#define ARENA_LEN_STRUCT(type, name, length_member, metadata)                     \
+        UNPACK_SIZE()                                                             \
+        if( size_dump > 0 && *offset <= len )                                     \
+            arena_len += arena_len_##metadata( buffer, offset, len, version_id);
+
+#define ARENA_LEN_ARRAY_STRUCT(type, name, length_member, metadata)               \
+        UNPACK_SIZE()                                                             \
+        if ( size_dump > 0 && *offset <= len ){                                   \
+            arena_len += CSMI_ARENA_ROUND(sizeof(type) * (uint64_t)size_dump);    \
+            for ( i=0; i < size_dump && *offset <= len; i++)                      \
+                arena_len += arena_len_##metadata( buffer, offset, len, version_id); \
+        }
+
+#define ARENA_LEN_ARRAY_STRUCT_FIXED(type, name, length, metadata)                \
+        for ( i=0; i < length; i++)                                               \
+            arena_len += arena_len_##metadata( buffer, offset, len, version_id);
+
+#define ARENA_LEN_NONE(type, name, length_member, metadata)
+
+    // ==============================================================
+    // Arena Unpacking Serial Macros - Invoked in UNPACK_ARENA_FUNCT(STRUCT_NAME)
+    // Same wire handling as the UNPACK macros, but every allocation is carved
+    // from the zeroed "arena" instead of the heap.
+    // ==============================================================
+
+#define UNPACK_ARENA_BASIC(type, name, length_member, metadata)  \
+        UNPACK_BASIC(type, name, length_member, metadata)
+
+#define UNPACK_ARENA_STRING(type, name, length_member, metadata)             \
+        UNPACK_SIZE()                                                        \
+        if ( ((uint64_t)*offset + size_dump) <= len &&                       \
+             (target->name = (char*) csmi_arena_alloc(arena, size_dump)) ) { \
+         memcpy( target->name, buffer + *offset, size_dump);                 \
+         *offset += size_dump;}                                              \
+        else {                                                               \
+            target->name = NULL;                                             \
+            *offset = len + 2;                                               \
+        }
+
+#define UNPACK_ARENA_STRING_FIXED(type, name, length, metadata) \
+        UNPACK_STRING_FIXED(type, name, length, metadata)
+
+#define UNPACK_ARENA_ARRAY(type, name, length_member, metadata)                        \
+        UNPACK_SIZE()                                                                  \
+        if ( size_dump > 0 && *offset <= len ) {                                       \
+            if ( ((uint64_t)*offset + (uint64_t)size_dump * sizeof(metadata)) <= len &&\
+                 (target->name = (type) csmi_arena_alloc(arena,                        \
+                                        (uint64_t)size_dump * sizeof(metadata))) ) {   \
+                memcpy(target->name, buffer + *offset, size_dump * sizeof(metadata)); \
+                *offset += size_dump * sizeof(metadata); }                             \
+            else {                                                                     \
+                target->name = NULL;                                                   \
+                *offset = len + 2; }                                                   \
+        } else                                                                         \
+            target->name = NULL;
+
+#define UNPACK_ARENA_ARRAY_FIXED(type, name, length, metadata) \
+        UNPACK_ARRAY_FIXED(type, name, length, metadata)
+
+#define UNPACK_ARENA_ARRAY_STR_FIXED(type, name, length, metadata)                      \
+        if( length > 0 && *offset <= len ){                                             \
+            if ( ((uint64_t)*offset + (uint64_t)length * UINT32_T_SIZE) <= len &&       \
+                 (target->name = (type) csmi_arena_alloc(arena, PTR_SIZE * (uint64_t)length)) ) { \
+                for ( i=0; i < length; i++) {                                           \
+                    memcpy( &str_offset, buffer + *offset, sizeof(str_offset) );        \
+                    *offset += sizeof(str_offset);                                      \
+                    if( ((uint64_t)*offset + str_offset) > len ||                       \
+                        !(target->name[i] = (char*) csmi_arena_alloc(arena, str_offset)) ) { \
+                        *offset = len + 2;                                              \
+                        break; }                                                        \
+                    memcpy(target->name[i], buffer + *offset, str_offset);              \
+                    *offset += str_offset;                                              \
+                    if( (*offset + sizeof(str_offset)) > len && i + 1 < length ) {      \
+                        *offset = len + 2;                                              \
+                        break; }                                                        \
+                }                                                                       \
+            }                                                                           \
+            else {                                                                      \
+                target->name = NULL;                                                    \
+                *offset = len + 2; }                                                    \
+        } else                                                                          \
+            target->name = NULL;
+
+#define UNPACK_ARENA_ARRAY_STR(type, name, length_member, metadata)  \
+        UNPACK_SIZE()                                                \
+        UNPACK_ARENA_ARRAY_STR_FIXED(type, name, size_dump, metadata);
+
+#define UNPACK_ARENA_STRUCT(type, name, length_member, metadata)                            \
+        UNPACK_SIZE()                                                                       \
+        if( size_dump > 0 && *offset <= len )                                               \
+            unpack_arena_##metadata( &(target->name), buffer, offset, len, version_id, arena); \
+        else                                                                                \
+            target->name = NULL;
+
+#define UNPACK_ARENA_ARRAY_STRUCT(type, name, length_member, metadata)                     \
+        UNPACK_SIZE()                                                                      \
+        if ( size_dump > 0 && *offset <= len ){                                            \
+            if ( (target->name = (type) csmi_arena_alloc(arena,                            \
+                                        sizeof(type) * (uint64_t)size_dump)) ) {           \
+                for ( i=0; i < size_dump && *offset <= len; i++)                           \
+                    unpack_arena_##metadata( &(target->name[i]), buffer, offset, len, version_id, arena); \
+            }                                                                              \
+            else *offset = len + 2;                                                        \
+        } else                                                                             \
+            target->name = NULL;
+
+#define UNPACK_ARENA_ARRAY_STRUCT_FIXED(type, name, length, metadata) \
+        for ( i=0; i < length; i++)                                   \
+            unpack_arena_##metadata( &(target->name[i]), buffer, offset, len, version_id, arena);
+
+#define UNPACK_ARENA_NONE(type, name, length_member, metadata)
+
     // ==============================================================
     // Free Array Serial Macros - Invoked in FREE_FUNCT(STRUCT_NAME)
     // ==============================================================
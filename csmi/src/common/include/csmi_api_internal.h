@@ -39,6 +39,8 @@ typedef struct {
 
   uint32_t errorlist_count;      ///< The number of node errors.
   csm_node_error_t** errlist;    ///< The errors reported by nodes.
+
+  void *pending;                 ///< The request in flight, see csmi_submit_cmd.
 } csmi_api_internal;
 
 #ifdef __cplusplus
@@ -38,6 +38,103 @@ extern "C"
  */
 int csmi_sendrecv_cmd(csm_api_object *csm_obj, csmi_cmd_t cmd, const char *sendPayload, uint32_t sendPayloadLen, char **recvPayload, uint32_t *recvPayloadLen);
 
+/** @brief Sends a command with explicit header flags and priority and waits for a response.
+ *
+ * Several threads may have commands in flight on the daemon connection at the
+ * same time, responses are matched to their command by message id.
+ *
+ * @param csm_obj
+ * @param cmd
+ * @param flags
+ * @param priority
+ * @param sendPayload
+ * @param sendPayloadLen
+ * @param recvPayload
+ * @param recvPayloadLen
+ *
+ * @return 0 If everything went well.
+ */
+int csmi_sendrecv_cmd_ext(csm_api_object *csm_obj, csmi_cmd_t cmd, uint8_t flags, uint8_t priority,
+                          const char *sendPayload, uint32_t sendPayloadLen,
+                          char **recvPayload, uint32_t *recvPayloadLen);
+
+/** @brief Sends a command without waiting for its response.
+ *
+ * The request is attached to @p csm_obj, which acts as its future until the
+ * response is collected with @ref csmi_wait_cmd. A @ref csm_api_object holds
+ * at most one request in flight.
+ *
+ * @param csm_obj
+ * @param cmd
+ * @param sendPayload
+ * @param sendPayloadLen
+ *
+ * @return 0 If the command was sent, the error is also set on @p csm_obj otherwise.
+ */
+int csmi_submit_cmd(csm_api_object *csm_obj, csmi_cmd_t cmd, const char *sendPayload, uint32_t sendPayloadLen);
+
+/** @brief @ref csmi_submit_cmd with explicit header flags and priority.
+ */
+int csmi_submit_cmd_ext(csm_api_object *csm_obj, csmi_cmd_t cmd, uint8_t flags, uint8_t priority,
+                        const char *sendPayload, uint32_t sendPayloadLen);
+
+/** @brief Checks whether the response to the request of @p csm_obj arrived.
+ *
+ * Never blocks. Responses already waiting on the connection are received if
+ * no other thread is receiving.
+ *
+ * @param csm_obj
+ *
+ * @return 1 If @ref csmi_wait_cmd will not block (or nothing is in flight), 0 otherwise.
+ */
+int csmi_poll_cmd(csm_api_object *csm_obj);
+
+/** @brief Waits for and collects the response to the request of @p csm_obj.
+ *
+ * @param csm_obj
+ * @param timeout_ms Time to wait in milliseconds, <= 0 for the client timeout of the command.
+ * @param recvPayload
+ * @param recvPayloadLen
+ *
+ * @return 0 If everything went well, the error code set on @p csm_obj otherwise.
+ */
+int csmi_wait_cmd(csm_api_object *csm_obj, int timeout_ms, char **recvPayload, uint32_t *recvPayloadLen);
+
+/** @brief Forgets the request in flight on @p csm_obj, a late response is dropped.
+ *
+ * @param csm_obj
+ */
+void csmi_cancel_cmd(csm_api_object *csm_obj);
+
+/** @brief A command of a @ref csmi_submit_batch call.
+ */
+typedef struct {
+    csm_api_object *csm_obj;     ///< Object receiving the future of the command.
+    csmi_cmd_t cmd;              ///< The command to send.
+    const char *sendPayload;     ///< The serialized arguments of the command.
+    uint32_t sendPayloadLen;     ///< The length of @ref sendPayload.
+} csmi_batch_entry_t;
+
+/** @brief Sends a batch of commands back to back without waiting for responses.
+ *
+ * Each response is collected with @ref csmi_wait_cmd on the entry's csm_obj.
+ * Entries that failed to send have their error set and nothing in flight.
+ *
+ * @param entries
+ * @param count
+ *
+ * @return 0 If all commands were sent, the first error code otherwise.
+ */
+int csmi_submit_batch(csmi_batch_entry_t *entries, uint32_t count);
+
+/** @brief Fails every request in flight with @p errcode.
+ *
+ * Used when the daemon connection goes away, waiting callers return the error.
+ *
+ * @param errcode
+ */
+void csmi_fail_pending(int errcode);
+
 /** @brief TODO
  *
  * @param msgId 
@@ -16,6 +16,8 @@
 #include <stdio.h>
 #include <sys/time.h>
 #include <pthread.h>
+#include <poll.h>
+#include <sys/socket.h>
 
 #include "csmnet/src/C/csm_network_internal_api_c.h"
 #include "csmutil/include/csmutil_logging.h"
@@ -30,7 +32,9 @@
 
 static volatile int initialized = 0;
 static csm_net_endpoint_t *ep=NULL;
-static pthread_mutex_t disconnect_lock;
+// Send and receive only read ep, so concurrent API calls share the lock;
+// init and term replace ep and need it exclusively.
+static pthread_rwlock_t disconnect_lock = PTHREAD_RWLOCK_INITIALIZER;
 
 static int on_disconnect( csm_net_msg_t *aMsg )
 {
@@ -55,8 +59,8 @@ static int on_disconnect( csm_net_msg_t *aMsg )
  *   CSM_LOGLEVEL   allows to control the amount of logging (default: info)
  *   CSM_SSOCKET    set the socket path of the daemon (default: /run/csmd.sock)
  *
- * \todo library is not fork or thread safe yet, the caller is responsible to prevent
- *       shared use of the calls
+ * \note the library may be used from several threads once initialized, requests
+ *       are multiplexed over the connection (see csmi_common_utils.c)
  */
 int csm_init_lib_vers(int64_t version_id)
 {
@@ -74,10 +78,10 @@ int csm_init_lib_vers(int64_t version_id)
   }
   csmutil_logging(debug, "Log Level retrieved");
 
-  pthread_mutex_lock( &disconnect_lock );
+  pthread_rwlock_wrlock( &disconnect_lock );
   if (initialized) {
     csmutil_logging(warning, "csm_init_lib() already called");
-    pthread_mutex_unlock( &disconnect_lock );
+    pthread_rwlock_unlock( &disconnect_lock );
     return 0;
   }
   csmutil_logging(debug, "Not initialized");
@@ -85,7 +89,7 @@ int csm_init_lib_vers(int64_t version_id)
   if ( (ep = csm_net_unix_Init(0)) == NULL) {
     perror("csm_net_unit_Init");
     csmutil_logging(error, "csm_net_unix_Init() returned NULL");
-    pthread_mutex_unlock( &disconnect_lock );
+    pthread_rwlock_unlock( &disconnect_lock );
     return EBADFD;
   }
   csmutil_logging(debug, "Net inited");
@@ -96,7 +100,7 @@ int csm_init_lib_vers(int64_t version_id)
     perror("csm_net_unix_Connect");
     csmutil_logging(error, "csm_net_unix_Connect() failed: %s", socket_name);
     csm_net_unix_Exit(ep);
-    pthread_mutex_unlock( &disconnect_lock );
+    pthread_rwlock_unlock( &disconnect_lock );
     return rc;
   }
 
@@ -114,7 +118,7 @@ int csm_init_lib_vers(int64_t version_id)
 
   csmutil_logging(trace, "csm_init_lib initialized (init_msg_id=%" PRIu64")", init_msgId);
 
-  pthread_mutex_unlock( &disconnect_lock );
+  pthread_rwlock_unlock( &disconnect_lock );
   return 0;
 }
 
@@ -132,31 +136,41 @@ int csm_term_lib()
 {
   int rc = 0;
 
-  /* cases to handle disconnect/lib termination
-   * - locked+initialized: wait for lock and check initialized again
-   * - unlocked+initialized: get lock and proceed
-   * - locked+uninitialized: return without wait - nothing to do
-   * - unlocked+uninitialized: return without wait - nothing to do */
-
   if (!initialized) {
     csmutil_logging(warning, "not initialized or already terminated\n");
     return ENOTCONN;
   }
 
-  while( pthread_mutex_trylock( &disconnect_lock ) != 0 )
+  /* A caller blocked in a receive holds the lock shared until a response
+   * arrives. Shut the socket down for reading to wake it up, the receive
+   * then fails with ENOTCONN and the lock is released. */
+  if( pthread_rwlock_trywrlock( &disconnect_lock ) != 0 )
   {
-    if (!initialized) {
-      csmutil_logging(warning, "not initialized or already terminated\n");
-      return ENOTCONN;
-    }
+    pthread_rwlock_rdlock( &disconnect_lock );
+    if (initialized)
+      shutdown( ep->_ep->_Socket, SHUT_RD );
+    pthread_rwlock_unlock( &disconnect_lock );
+
+    pthread_rwlock_wrlock( &disconnect_lock );
+  }
+
+  // somebody else terminated while we waited for the lock
+  if (!initialized) {
+    csmutil_logging(warning, "not initialized or already terminated\n");
+    pthread_rwlock_unlock( &disconnect_lock );
+    return ENOTCONN;
   }
 
   initialized = 0;
   rc = csm_net_unix_Exit(ep);
   ep = NULL;
 
+  pthread_rwlock_unlock( &disconnect_lock );
+
+  // requests still in flight will never see their response
+  csmi_fail_pending( CSMERR_SENDRCV_ERROR );
+
   csmutil_logging(trace, "csm_term_lib() done");
-  pthread_mutex_unlock( &disconnect_lock );
   return rc;
 }
 
@@ -179,11 +193,11 @@ int csmi_net_unix_Send(csm_net_msg_t *msg)
       csm_init_lib();
     }
 
-    pthread_mutex_lock( &disconnect_lock );
+    pthread_rwlock_rdlock( &disconnect_lock );
     if (!initialized) {
       csmutil_logging(warning, "%s-%d: csmi_init_lib() unable to initialize. Giving up...\n", __FILE__, __LINE__);
       errno = ENOTCONN;
-      pthread_mutex_unlock( &disconnect_lock );
+      pthread_rwlock_unlock( &disconnect_lock );
       return -1;
     }
 
@@ -193,7 +207,7 @@ int csmi_net_unix_Send(csm_net_msg_t *msg)
         perror("csm_net_unix_Send");
         csmutil_logging(error, "%s-%d: csm_net_unix_send() failed\n", __FILE__, __LINE__);
     }
-    pthread_mutex_unlock( &disconnect_lock );
+    pthread_rwlock_unlock( &disconnect_lock );
 
   return rc;
 }
@@ -215,10 +229,11 @@ csm_net_msg_t* csmi_net_unix_Recv(csmi_cmd_t cmd)
   csm_net_msg_t *msg = NULL;
   csm_net_unix_CallBack dfn;
 
-  pthread_mutex_lock( &disconnect_lock );
+  pthread_rwlock_rdlock( &disconnect_lock );
   if (!initialized) {
     csmutil_logging(warning, "%s-%d: csmi_init_lib() has not been called yet\n", __FILE__, __LINE__);
-    pthread_mutex_unlock( &disconnect_lock );
+    pthread_rwlock_unlock( &disconnect_lock );
+    errno = ENOTCONN;
     return NULL;
   }
   msg = csm_net_unix_BlockingRecv(ep->_ep, cmd);
@@ -232,15 +247,44 @@ csm_net_msg_t* csmi_net_unix_Recv(csmi_cmd_t cmd)
     {
       // need to preserve the disconnect fnptr because ep might be NULL after the unlock
       dfn = ep->_on_disconnect;
-      pthread_mutex_unlock( &disconnect_lock ); // unlock to allow disconnect processing
+      pthread_rwlock_unlock( &disconnect_lock ); // unlock to allow disconnect processing
       dfn( NULL );
+      errno = stored_errno;
       return NULL;
     }
   }
-  pthread_mutex_unlock( &disconnect_lock );
+  pthread_rwlock_unlock( &disconnect_lock );
   return msg;
 }
 
+/**
+ * \brief Wait until a message from the daemon can be received without blocking
+ *
+ * @param[in] timeout_ms  how long to wait for the message, 0 to only check
+ *
+ * @return  1 if a message (or the start of one) is buffered or waiting on the
+ *          socket, or if a receive would fail right away because the library
+ *          is not initialized, 0 otherwise
+ */
+int csmi_net_unix_Ready( int timeout_ms )
+{
+  int ready = 1;
+
+  pthread_rwlock_rdlock( &disconnect_lock );
+  if (initialized) {
+    if ( ep->_ep->_BufferState._BufferedDataLen == 0 )
+    {
+      struct pollfd pfd;
+      pfd.fd = ep->_ep->_Socket;
+      pfd.events = POLLIN;
+      pfd.revents = 0;
+      ready = ( poll( &pfd, 1, timeout_ms ) > 0 );
+    }
+  }
+  pthread_rwlock_unlock( &disconnect_lock );
+  return ready;
+}
+
 /**
  * \brief register a callback function
  *
@@ -363,6 +407,9 @@ void csm_api_object_destroy(csm_api_object *csm_obj)
         csmutil_logging(error, "csmi_api_object_destroy: csmi_api_object not valid");
         return;
     }
+    // a response arriving after this is dropped
+    csmi_cancel_cmd(csm_obj);
+
     csmi_hdl = (csmi_api_internal *) csm_obj->hdl;
     freeFunc = csmi_hdl->csmi_free_func;
     if (freeFunc) freeFunc(csm_obj);
@@ -277,6 +277,224 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
@@ -530,6 +748,224 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
@@ -14,22 +14,56 @@
 ================================================================================*/
 #include "csmutil/include/csmutil_logging.h"
 #include "csmnet/src/C/csm_network_internal_api_c.h"
+#include "csmnet/include/csm_timing.h"
 #include "csmi/include/csm_api_common.h"
 #include "csmi/src/common/include/csmi_common_utils.h"
 #include "csmi/src/common/include/csmi_serialization.h"
 #include "csmi/src/common/include/csmi_api_internal.h"
 
 #include <assert.h>
+#include <errno.h>
 #include <pthread.h>
 #include <stdlib.h>
+#include <time.h>
 
 extern int csmi_net_unix_Send(csm_net_msg_t *);
 extern csm_net_msg_t* csmi_net_unix_Recv(csmi_cmd_t cmd);
+extern int csmi_net_unix_Ready(int timeout_ms);
 
 
 static pthread_mutex_t MSGID_MUTEX;
 static uint64_t globalMsgId;
-static pthread_mutex_t SEND_RECV_MUTEX;
+
+/*
+ * Requests are multiplexed over the single daemon connection: a request is
+ * registered in the pending table by its msgId before it is sent, and responses
+ * are matched back to it by msgId.  Sends are serialized by SEND_MUTEX only.
+ *
+ * There is no receive thread.  Whichever waiting caller finds no receiver
+ * active becomes the receiver (RECEIVER_ACTIVE) and dispatches every response
+ * it reads to its pending entry until its own response arrived.  It then hands
+ * the receiver role to another waiting caller.  PENDING_MUTEX protects the
+ * table, the entries and RECEIVER_ACTIVE.
+ */
+#define CSMI_PENDING_BUCKETS ( 64 )
+
+typedef struct csmi_pending
+{
+  uint64_t msgId;               ///< message id of the request
+  csmi_cmd_t cmd;               ///< command of the request
+  uint32_t traceId;             ///< trace id of the request
+  int done;                     ///< response received or request failed
+  int waiting;                  ///< a caller is blocked on cond
+  int errcode;                  ///< transport error, CSMI_SUCCESS if rsp is valid
+  csm_net_msg_t *rsp;           ///< response, header and data in one allocation
+  pthread_cond_t cond;          ///< signalled when done or the receiver role is free
+  struct csmi_pending *next;    ///< next entry in the bucket
+} csmi_pending_t;
+
+static pthread_mutex_t SEND_MUTEX = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t PENDING_MUTEX = PTHREAD_MUTEX_INITIALIZER;
+static csmi_pending_t *PENDING[ CSMI_PENDING_BUCKETS ];
+static int RECEIVER_ACTIVE = 0;
 
 // initialize the starting msg id
 void csmi_set_init_msgId( int msgId)
@@ -39,88 +73,176 @@ void csmi_set_init_msgId( int msgId)
 
 static uint64_t get_msgId()
 {
+    uint64_t msgId;
     pthread_mutex_lock(&MSGID_MUTEX);
-    globalMsgId++;
+    msgId = ++globalMsgId;
     pthread_mutex_unlock(&MSGID_MUTEX);
-    return globalMsgId;
+    return msgId;
 }
 
-// return 0 if sucessfully get the "expected" response
-int csmi_sendrecv_cmd_ext(
-    csm_api_object *csm_obj, 
-    csmi_cmd_t cmd, 
-    uint8_t flags,
-    uint8_t priority,
-    const char *sendPayload, 
-    uint32_t sendPayloadLen, 
-    char **recvPayload, 
-    uint32_t *recvPayloadLen )
-//    uint64_t *recvMsgId)
+/* The following pending table helpers expect PENDING_MUTEX to be held. */
+static csmi_pending_t** pending_slot( uint64_t msgId )
 {
-    csm_net_msg_t *netMsg;        //<
-    uint8_t recvCmd;              //<
-    uint64_t recvMsgId;           //<
-    csm_net_msg_t *recvNetMsg;    //<
-    const char *recvData;         //<
-    uint32_t recvDataLen;         //<
-
-    uint32_t traceId;             ///< The trace id of the send recv command.
-    uint64_t msgId;               ///< The message id of the send recv command.
+  csmi_pending_t **slot = &PENDING[ msgId % CSMI_PENDING_BUCKETS ];
+  while( *slot && (*slot)->msgId != msgId )
+    slot = &(*slot)->next;
+  return slot;
+}
 
-    csmi_err_t *cdata_err;        //<
-    int errcode=CSMERR_SENDRCV_ERROR;
-    char *errmsg=NULL;            //<
-    *recvPayload = NULL;          //<
-    *recvPayloadLen = 0;          //<
+static void pending_complete( csmi_pending_t *pending, int errcode, csm_net_msg_t *rsp )
+{
+  pending->done = 1;
+  pending->errcode = errcode;
+  pending->rsp = rsp;
+  pthread_cond_signal( &pending->cond );
+}
 
-    msgId = get_msgId();
+static void pending_fail_all( int errcode )
+{
+  int i;
+  csmi_pending_t *pending;
+  for( i = 0; i < CSMI_PENDING_BUCKETS; ++i )
+    for( pending = PENDING[ i ]; pending; pending = pending->next )
+      if( !pending->done )
+        pending_complete( pending, errcode, NULL );
+}
 
-    // TODO In the future we may want to reserve ~ 13 bits for the node information?
-    // Add a trace id derived from the msg id 
-    traceId = msgId % 0xFFFFFFFF;
+// let another waiting caller take over receiving
+static void pending_handoff_receiver()
+{
+  int i;
+  csmi_pending_t *pending;
+  RECEIVER_ACTIVE = 0;
+  for( i = 0; i < CSMI_PENDING_BUCKETS; ++i )
+    for( pending = PENDING[ i ]; pending; pending = pending->next )
+      if( pending->waiting && !pending->done )
+      {
+        pthread_cond_signal( &pending->cond );
+        return;
+      }
+}
 
-    netMsg = csm_net_msg_Init( cmd, flags, priority,
-                              msgId, geteuid(), getegid(), 
-                              sendPayload, sendPayloadLen, traceId);
+void csmi_fail_pending( int errcode )
+{
+  pthread_mutex_lock( &PENDING_MUTEX );
+  pending_fail_all( errcode );
+  pthread_mutex_unlock( &PENDING_MUTEX );
+}
 
-    if (netMsg == NULL) 
-    {
-      csmutil_logging(error, "%s-%d: csm_net_msg_Init return null\n", __FILE__, __LINE__);
-      csm_api_object_trace_set(csm_obj, traceId);
-      csm_api_object_errcode_set(csm_obj, CSMERR_SENDRCV_ERROR);
-      csm_api_object_errmsg_set(csm_obj, strdup(csm_get_string_from_enum(csmi_cmd_err_t,CSMERR_SENDRCV_ERROR)));
-      return errcode;
-    }
+static csmi_pending_t* pending_new( csmi_cmd_t cmd, uint64_t msgId, uint32_t traceId )
+{
+  csmi_pending_t *pending = (csmi_pending_t*)calloc( 1, sizeof( csmi_pending_t ) );
+  if( pending == NULL )
+    return NULL;
+
+  pending->msgId = msgId;
+  pending->cmd = cmd;
+  pending->traceId = traceId;
+  pthread_cond_init( &pending->cond, NULL );
+
+  pthread_mutex_lock( &PENDING_MUTEX );
+  csmi_pending_t **slot = &PENDING[ msgId % CSMI_PENDING_BUCKETS ];
+  pending->next = *slot;
+  *slot = pending;
+  pthread_mutex_unlock( &PENDING_MUTEX );
+
+  return pending;
+}
 
-    pthread_mutex_lock( &SEND_RECV_MUTEX );
+static void pending_free( csmi_pending_t *pending )
+{
+  pthread_mutex_lock( &PENDING_MUTEX );
+  csmi_pending_t **slot = pending_slot( pending->msgId );
+  if( *slot == pending )
+    *slot = pending->next;
+  pthread_mutex_unlock( &PENDING_MUTEX );
+
+  pthread_cond_destroy( &pending->cond );
+  if( pending->rsp ) free( pending->rsp );
+  free( pending );
+}
 
-    // csmi_net_unix_Send returns the number of bytes sent
-    if (csmi_net_unix_Send(netMsg) <= 0) 
+/*
+ * Receive one message as the receiver and hand it to its pending entry.
+ * Called and returns with PENDING_MUTEX held, drops it around the receive.
+ */
+static void pending_receive( csmi_pending_t *self )
+{
+  csm_net_msg_t *recvNetMsg;
+  csm_net_msg_t *rsp = NULL;
+  int stored_errno;
+
+  pthread_mutex_unlock( &PENDING_MUTEX );
+
+  recvNetMsg = csmi_net_unix_Recv( self->cmd );
+  stored_errno = errno;
+  if( recvNetMsg )
+  {
+    // the received message lives in the endpoint buffer until the next receive
+    uint32_t recvDataLen = csm_net_msg_GetDataLen( recvNetMsg );
+    rsp = (csm_net_msg_t*)malloc( sizeof( csm_net_msg_t ) + recvDataLen );
+    if( rsp )
     {
-      csmutil_logging(error, "%s-%d: csm_net_msg_Send failed\n", __FILE__, __LINE__);
-      csm_api_object_trace_set(csm_obj, traceId);
-      csm_api_object_errcode_set(csm_obj, CSMERR_SENDRCV_ERROR);
-      csm_api_object_errmsg_set(csm_obj, strdup(csm_get_string_from_enum(csmi_cmd_err_t,CSMERR_SENDRCV_ERROR)));
-      pthread_mutex_unlock( &SEND_RECV_MUTEX );
-      csm_term_lib();
-      return errcode;
+      rsp->_Header = recvNetMsg->_Header;
+      rsp->_Data = (char*)( rsp + 1 );
+      if( recvDataLen > 0 )
+        memcpy( rsp->_Data, csm_net_msg_GetData( recvNetMsg ), recvDataLen );
     }
+    else
+      csmutil_logging(error, "%s-%d: Failed to copy response for msgId %" PRIu64"", __FILE__, __LINE__,
+                      csm_net_msg_GetMessageID( recvNetMsg ));
+  }
+
+  pthread_mutex_lock( &PENDING_MUTEX );
+
+  if( recvNetMsg == NULL )
+  {
+    csmutil_logging(error, "%s-%d: csm_net_msg_Recv returned NULL\n", __FILE__, __LINE__);
+    // a receive timeout only concerns the request of the receiver,
+    // anything else means the connection is unusable for everybody
+    if(( stored_errno == ETIMEDOUT ) || ( stored_errno == EAGAIN ))
+      pending_complete( self, CSMERR_TIMEOUT, NULL );
+    else if( stored_errno == EINTR )
+      pending_complete( self, CSMERR_SENDRCV_ERROR, NULL );
+    else
+      pending_fail_all( CSMERR_SENDRCV_ERROR );
+    return;
+  }
+
+  uint64_t recvMsgId = csm_net_msg_GetMessageID( recvNetMsg );
+  csmi_pending_t *target = *pending_slot( recvMsgId );
+  if( target == NULL || target->done )
+  {
+    csmutil_logging(warning, "%s-%d: Dropping response for unknown msgId %" PRIu64". Previous timeout?",
+                    __FILE__, __LINE__, recvMsgId);
+    if( rsp ) free( rsp );
+    return;
+  }
+
+  pending_complete( target, rsp ? CSMI_SUCCESS : CSMERR_MEM_ERROR, rsp );
+}
 
-    csmutil_logging(trace, "%s-%d: The msg for cmd %d sent", __FILE__, __LINE__, cmd);
-
-    free(netMsg);
-
-    if ( (recvNetMsg = csmi_net_unix_Recv( cmd )) == NULL ) 
-    {
-      csmutil_logging(error, "%s-%d: csm_net_msg_Recv returned NULL\n", __FILE__, __LINE__);
-      csm_api_object_trace_set(csm_obj, traceId);
-      csm_api_object_errcode_set(csm_obj, CSMERR_SENDRCV_ERROR);
-      csm_api_object_errmsg_set(csm_obj, strdup(csm_get_string_from_enum(csmi_cmd_err_t,CSMERR_SENDRCV_ERROR)));
-      pthread_mutex_unlock( &SEND_RECV_MUTEX );
-      return errcode;
-    }
+/*
+ * Turn the response of a request into the error code, error message and
+ * payload reported to the caller.
+ */
+static int csmi_process_response(
+    csm_api_object *csm_obj,
+    csmi_cmd_t cmd,
+    uint64_t msgId,
+    csm_net_msg_t *recvNetMsg,
+    char **recvPayload,
+    uint32_t *recvPayloadLen,
+    char **errmsg_out )
+{
+    uint8_t recvCmd;              //<
+    uint64_t recvMsgId;           //<
+    const char *recvData;         //<
+    uint32_t recvDataLen;         //<
 
-    csmutil_logging(trace, "%s-%d: Got response for cmd %d", __FILE__, __LINE__, cmd);
+    csmi_err_t *cdata_err;        //<
+    int errcode=CSMERR_SENDRCV_ERROR;
+    char *errmsg=NULL;            //<
 
     // get the header and payload
     // check Ack; ack = csm_net_msg_GetAck(recvNetMsg);
@@ -231,18 +353,354 @@ int csmi_sendrecv_cmd_ext(
           errcode = CSMI_SUCCESS;
     }
 
-    // FIXME This fails to free the rbuffer created in the mutex lock! - John Dunham
-    // NOTE: the header and payload in recvNetMsg will be contiguous, so one free is enough.
-    pthread_mutex_unlock( &SEND_RECV_MUTEX );
+    *errmsg_out = errmsg;
+    return errcode;
+}
+
+static void csmi_record_error( csm_api_object *csm_obj, uint32_t traceId, int errcode )
+{
+  csm_api_object_trace_set(csm_obj, traceId);
+  csm_api_object_errcode_set(csm_obj, errcode);
+  csm_api_object_errmsg_set(csm_obj, strdup(csm_get_string_from_enum(csmi_cmd_err_t,errcode)));
+}
+
+static csmi_pending_t* csmi_pending_get( csm_api_object *csm_obj )
+{
+  if (csm_obj == NULL || csm_obj->hdl == NULL)
+    return NULL;
+  return (csmi_pending_t*)((csmi_api_internal *) csm_obj->hdl)->pending;
+}
+
+/*
+ * Build the message of a request and register it as pending on csm_obj.
+ * Returns the message to send, NULL on failure with the error set on csm_obj.
+ */
+static csm_net_msg_t* csmi_prepare_cmd(
+    csm_api_object *csm_obj, 
+    csmi_cmd_t cmd, 
+    uint8_t flags,
+    uint8_t priority,
+    const char *sendPayload, 
+    uint32_t sendPayloadLen )
+{
+    csm_net_msg_t *netMsg;        //<
+    uint32_t traceId;             ///< The trace id of the send recv command.
+    uint64_t msgId;               ///< The message id of the send recv command.
+    csmi_pending_t *pending;      //<
+
+    if (csm_obj == NULL || csm_obj->hdl == NULL)
+    {
+      csmutil_logging(error, "%s-%d: csmi_api_object not valid", __FILE__, __LINE__);
+      return NULL;
+    }
+
+    if ( csmi_pending_get( csm_obj ) != NULL )
+    {
+      csmutil_logging(error, "%s-%d: csmi_api_object has a request in flight", __FILE__, __LINE__);
+      csmi_record_error(csm_obj, 0, CSMERR_CMD_MISMATCH);
+      return NULL;
+    }
+
+    msgId = get_msgId();
+
+    // TODO In the future we may want to reserve ~ 13 bits for the node information?
+    // Add a trace id derived from the msg id 
+    traceId = msgId % 0xFFFFFFFF;
+
+    // The ACK of a request is received inside the send. With several requests in
+    // flight it would race with the receiver for the socket, so requests are sent
+    // without; the response itself confirms delivery.
+    if ( priority >= CSM_PRIORITY_WITH_ACK )
+      priority = CSM_PRIORITY_NO_ACK;
+
+    netMsg = csm_net_msg_Init( cmd, flags, priority,
+                              msgId, geteuid(), getegid(), 
+                              sendPayload, sendPayloadLen, traceId);
+
+    if (netMsg == NULL) 
+    {
+      csmutil_logging(error, "%s-%d: csm_net_msg_Init return null\n", __FILE__, __LINE__);
+      csmi_record_error(csm_obj, traceId, CSMERR_SENDRCV_ERROR);
+      return NULL;
+    }
+
+    if ( (pending = pending_new( cmd, msgId, traceId )) == NULL )
+    {
+      csmutil_logging(error, "%s-%d: Failed to allocate pending request\n", __FILE__, __LINE__);
+      csmi_record_error(csm_obj, traceId, CSMERR_MEM_ERROR);
+      free(netMsg);
+      return NULL;
+    }
+    ((csmi_api_internal *) csm_obj->hdl)->pending = pending;
+
+    return netMsg;
+}
+
+// Drop the request of csm_obj after its message could not be sent.
+static void csmi_send_failed( csm_api_object *csm_obj )
+{
+    csmi_pending_t *pending = csmi_pending_get( csm_obj );
+
+    csmutil_logging(error, "%s-%d: csm_net_msg_Send failed\n", __FILE__, __LINE__);
+    csmi_record_error(csm_obj, pending->traceId, CSMERR_SENDRCV_ERROR);
+    ((csmi_api_internal *) csm_obj->hdl)->pending = NULL;
+    pending_free( pending );
+}
+
+int csmi_submit_cmd_ext(
+    csm_api_object *csm_obj, 
+    csmi_cmd_t cmd, 
+    uint8_t flags,
+    uint8_t priority,
+    const char *sendPayload, 
+    uint32_t sendPayloadLen )
+{
+    csm_net_msg_t *netMsg;
+    int rc;
+
+    netMsg = csmi_prepare_cmd( csm_obj, cmd, flags, priority, sendPayload, sendPayloadLen );
+    if (netMsg == NULL)
+      return csm_api_object_errcode_get( csm_obj );
+
+    // csmi_net_unix_Send returns the number of bytes sent
+    pthread_mutex_lock( &SEND_MUTEX );
+    rc = csmi_net_unix_Send(netMsg);
+    pthread_mutex_unlock( &SEND_MUTEX );
+    free(netMsg);
+
+    if (rc <= 0) 
+    {
+      csmi_send_failed( csm_obj );
+      csm_term_lib();
+      return CSMERR_SENDRCV_ERROR;
+    }
+
+    csmutil_logging(trace, "%s-%d: The msg for cmd %d sent", __FILE__, __LINE__, cmd);
+    return CSMI_SUCCESS;
+}
+
+int csmi_submit_cmd(
+    csm_api_object *csm_obj,
+    csmi_cmd_t cmd,
+    const char *sendPayload,
+    uint32_t sendPayloadLen )
+{
+  return csmi_submit_cmd_ext( csm_obj, cmd, 0, CSM_PRIORITY_DEFAULT, sendPayload, sendPayloadLen );
+}
+
+int csmi_submit_batch( csmi_batch_entry_t *entries, uint32_t count )
+{
+    csm_net_msg_t **netMsgs;
+    uint32_t i;
+    int errcode = CSMI_SUCCESS;
+    int sendFailed = 0;
+
+    if ( entries == NULL || count == 0 )
+      return CSMERR_INVALID_PARAM;
+
+    if ( (netMsgs = (csm_net_msg_t**)calloc( count, sizeof( csm_net_msg_t* ) )) == NULL )
+      return CSMERR_MEM_ERROR;
+
+    for ( i = 0; i < count; ++i )
+    {
+      netMsgs[i] = csmi_prepare_cmd( entries[i].csm_obj, entries[i].cmd, 0, CSM_PRIORITY_DEFAULT,
+                                     entries[i].sendPayload, entries[i].sendPayloadLen );
+      if ( netMsgs[i] == NULL && errcode == CSMI_SUCCESS )
+        errcode = entries[i].csm_obj ? csm_api_object_errcode_get( entries[i].csm_obj ) : CSMERR_INVALID_PARAM;
+    }
+
+    // one pass over the socket for the whole batch
+    pthread_mutex_lock( &SEND_MUTEX );
+    for ( i = 0; i < count; ++i )
+    {
+      if ( netMsgs[i] == NULL )
+        continue;
+
+      if ( sendFailed || csmi_net_unix_Send( netMsgs[i] ) <= 0 )
+      {
+        sendFailed = 1;
+        csmi_send_failed( entries[i].csm_obj );
+        if ( errcode == CSMI_SUCCESS )
+          errcode = CSMERR_SENDRCV_ERROR;
+      }
+      free( netMsgs[i] );
+    }
+    pthread_mutex_unlock( &SEND_MUTEX );
+    free( netMsgs );
+
+    if ( sendFailed )
+      csm_term_lib();
+
+    csmutil_logging(trace, "%s-%d: Batch of %u requests submitted, rc=%d", __FILE__, __LINE__, count, errcode);
+    return errcode;
+}
+
+int csmi_poll_cmd( csm_api_object *csm_obj )
+{
+    csmi_pending_t *pending = csmi_pending_get( csm_obj );
+    int done;
+
+    if ( pending == NULL )
+      return 1;
+
+    pthread_mutex_lock( &PENDING_MUTEX );
+    // receive whatever is already waiting if nobody else is receiving
+    while( !pending->done && !RECEIVER_ACTIVE && csmi_net_unix_Ready( 0 ) )
+    {
+      RECEIVER_ACTIVE = 1;
+      pending_receive( pending );
+      pending_handoff_receiver();
+    }
+    done = pending->done;
+    pthread_mutex_unlock( &PENDING_MUTEX );
+
+    return done;
+}
+
+static int csmi_remaining_ms( const struct timespec *deadline )
+{
+  struct timespec now;
+  clock_gettime( CLOCK_REALTIME, &now );
+  int64_t remaining = (int64_t)( deadline->tv_sec - now.tv_sec ) * 1000 +
+                      ( deadline->tv_nsec - now.tv_nsec ) / 1000000L;
+  return remaining > 0 ? (int)remaining : 0;
+}
+
+int csmi_wait_cmd(
+    csm_api_object *csm_obj,
+    int timeout_ms,
+    char **recvPayload,
+    uint32_t *recvPayloadLen )
+{
+    csmi_pending_t *pending = csmi_pending_get( csm_obj );
+    struct timespec deadline;
+    int errcode;
+    char *errmsg = NULL;
+
+    *recvPayload = NULL;
+    *recvPayloadLen = 0;
+
+    if ( pending == NULL )
+    {
+      csmutil_logging(error, "%s-%d: No request in flight", __FILE__, __LINE__);
+      return csm_obj && csm_obj->hdl ? csm_api_object_errcode_get( csm_obj ) : CSMERR_INVALID_PARAM;
+    }
+
+    if ( timeout_ms <= 0 )
+      timeout_ms = csm_get_client_timeout( pending->cmd ) + 1000;
+    clock_gettime( CLOCK_REALTIME, &deadline );
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)( timeout_ms % 1000 ) * 1000000L;
+    if ( deadline.tv_nsec >= 1000000000L )
+    {
+      deadline.tv_sec += 1;
+      deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock( &PENDING_MUTEX );
+    while( !pending->done )
+    {
+      if( !RECEIVER_ACTIVE )
+      {
+        RECEIVER_ACTIVE = 1;
+        while( !pending->done )
+        {
+          // only block in the receive once something arrived, so the
+          // receiver honors its own deadline too
+          int remaining_ms = csmi_remaining_ms( &deadline );
+          int ready = 0;
+          if( remaining_ms > 0 )
+          {
+            pthread_mutex_unlock( &PENDING_MUTEX );
+            ready = csmi_net_unix_Ready( remaining_ms );
+            pthread_mutex_lock( &PENDING_MUTEX );
+          }
+
+          if( ready )
+            pending_receive( pending );
+          else if( !pending->done )
+          {
+            csmutil_logging(error, "%s-%d: Timeout waiting for response to msgId %" PRIu64"",
+                            __FILE__, __LINE__, pending->msgId);
+            pending_complete( pending, CSMERR_TIMEOUT, NULL );
+          }
+        }
+        pending_handoff_receiver();
+      }
+      else
+      {
+        pending->waiting = 1;
+        int rc = pthread_cond_timedwait( &pending->cond, &PENDING_MUTEX, &deadline );
+        pending->waiting = 0;
+        if(( rc == ETIMEDOUT ) && !pending->done )
+        {
+          csmutil_logging(error, "%s-%d: Timeout waiting for response to msgId %" PRIu64"",
+                          __FILE__, __LINE__, pending->msgId);
+          pending_complete( pending, CSMERR_TIMEOUT, NULL );
+        }
+      }
+    }
+    pthread_mutex_unlock( &PENDING_MUTEX );
+
+    csmutil_logging(trace, "%s-%d: Got response for cmd %d", __FILE__, __LINE__, pending->cmd);
+
+    if ( pending->errcode == CSMI_SUCCESS )
+      errcode = csmi_process_response( csm_obj, pending->cmd, pending->msgId, pending->rsp,
+                                       recvPayload, recvPayloadLen, &errmsg );
+    else
+    {
+      errcode = pending->errcode;
+      errmsg = strdup(csm_get_string_from_enum(csmi_cmd_err_t,errcode));
+    }
 
     // record the err/trace info before return
-    csm_api_object_trace_set(csm_obj, traceId);
+    csm_api_object_trace_set(csm_obj, pending->traceId);
     csm_api_object_errcode_set(csm_obj, errcode);
     if (errmsg) csm_api_object_errmsg_set(csm_obj, errmsg);
 
+    ((csmi_api_internal *) csm_obj->hdl)->pending = NULL;
+    pending_free( pending );
+
     return errcode;
 }
 
+void csmi_cancel_cmd( csm_api_object *csm_obj )
+{
+    csmi_pending_t *pending = csmi_pending_get( csm_obj );
+    if ( pending == NULL )
+      return;
+
+    // Only the owner of csm_obj waits on or receives for its request, so
+    // nobody else references the entry. A late response finds no entry
+    // and is dropped by the receiver.
+    csmutil_logging(debug, "%s-%d: Cancelling request msgId %" PRIu64"", __FILE__, __LINE__, pending->msgId);
+    ((csmi_api_internal *) csm_obj->hdl)->pending = NULL;
+    pending_free( pending );
+}
+
+// return 0 if sucessfully get the "expected" response
+int csmi_sendrecv_cmd_ext(
+    csm_api_object *csm_obj, 
+    csmi_cmd_t cmd, 
+    uint8_t flags,
+    uint8_t priority,
+    const char *sendPayload, 
+    uint32_t sendPayloadLen, 
+    char **recvPayload, 
+    uint32_t *recvPayloadLen )
+{
+    int errcode;
+
+    *recvPayload = NULL;          //<
+    *recvPayloadLen = 0;          //<
+
+    errcode = csmi_submit_cmd_ext( csm_obj, cmd, flags, priority, sendPayload, sendPayloadLen );
+    if ( errcode != CSMI_SUCCESS )
+      return errcode;
+
+    return csmi_wait_cmd( csm_obj, 0, recvPayload, recvPayloadLen );
+}
+
 
 int csmi_sendrecv_cmd(
     csm_api_object *csm_obj,
@@ -0,0 +1,297 @@
+/*================================================================================
+
+    csmi/src/common/tests/test_csmi_arena_serialization.c
+
+  © Copyright IBM Corporation 2015-2017. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+// Unpacks structs into a single arena: the result matches the packed struct, is
+// released with one free, malformed buffers are rejected and one caller supplied
+// arena is reused across structs of different sizes. Packing into a reused buffer
+// gives the same bytes as a one-shot pack and only grows the buffer when needed.
+#include "csmi/include/csm_api_ras.h"
+#include "csmutil/include/csm_test_utils.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+static int failures = 0;
+
+#define NUM_EVENTS 3
+
+// Packs a query output with NUM_EVENTS events, the caller frees the buffer.
+static char* pack_query_output(uint32_t *buffer_len)
+{
+    csm_ras_event_query_output_t *output;
+    char    *buffer = NULL;
+    char     text[64];
+    uint32_t i;
+
+    csm_init_struct_ptr(csm_ras_event_query_output_t, output);
+    output->results_count = NUM_EVENTS;
+    output->results = (csmi_ras_event_t**) calloc(NUM_EVENTS, sizeof(csmi_ras_event_t*));
+
+    for ( i = 0; i < NUM_EVENTS; ++i )
+    {
+        csm_init_struct_ptr(csmi_ras_event_t, output->results[i]);
+        output->results[i]->count = (int32_t) i + 1;
+        snprintf(text, sizeof(text), "test.arena.%u", i);
+        output->results[i]->msg_id = strdup(text);
+        snprintf(text, sizeof(text), "c650f0%up0%u", i, i);
+        output->results[i]->location_name = strdup(text);
+    }
+    // Left NULL in the last event, a NULL string unpacks as an empty one.
+    for ( i = 0; i < NUM_EVENTS - 1; ++i )
+        output->results[i]->raw_data = strdup("raw data");
+
+    csm_serialize_struct(csm_ras_event_query_output_t, output, &buffer, buffer_len);
+    csm_free_struct_ptr(csm_ras_event_query_output_t, output);
+    return buffer;
+}
+
+// Packs a create input, the caller frees the buffer.
+static char* pack_create_input(uint32_t *buffer_len)
+{
+    csm_ras_event_create_input_t *input;
+    char *buffer = NULL;
+
+    csm_init_struct_ptr(csm_ras_event_create_input_t, input);
+    input->msg_id        = strdup("test.arena.create");
+    input->location_name = strdup("c650f01p01");
+
+    csm_serialize_struct(csm_ras_event_create_input_t, input, &buffer, buffer_len);
+    csm_free_struct_ptr(csm_ras_event_create_input_t, input);
+    return buffer;
+}
+
+static int check_query_output(const csm_ras_event_query_output_t *output)
+{
+    char     text[64];
+    uint32_t i;
+
+    if ( !output || output->results_count != NUM_EVENTS || !output->results ) return 0;
+
+    for ( i = 0; i < NUM_EVENTS; ++i )
+    {
+        const csmi_ras_event_t *event = output->results[i];
+        if ( !event || event->count != (int32_t) i + 1 ) return 0;
+
+        snprintf(text, sizeof(text), "test.arena.%u", i);
+        if ( !event->msg_id || strcmp(event->msg_id, text) ) return 0;
+
+        snprintf(text, sizeof(text), "c650f0%up0%u", i, i);
+        if ( !event->location_name || strcmp(event->location_name, text) ) return 0;
+
+        if ( !event->raw_data ||
+             strcmp(event->raw_data, i < NUM_EVENTS - 1 ? "raw data" : "") ) return 0;
+        if ( !event->message || event->message[0] ) return 0;
+    }
+    return 1;
+}
+
+void test_arena_unpack(void)
+{
+    csm_ras_event_query_output_t *output = NULL;
+    csm_ras_event_query_output_t *heap   = NULL;
+    uint32_t buffer_len = 0;
+    char    *buffer     = pack_query_output(&buffer_len);
+
+    printf("Testing deserialize_arena and csm_free_struct_arena...\n");
+
+    CHECK(buffer && buffer_len, "query output not packed");
+
+    CHECK(csm_deserialize_struct_arena(csm_ras_event_query_output_t, &output,
+            buffer, buffer_len) == 0, "arena unpack failed");
+    CHECK(check_query_output(output), "arena unpacked struct differs from the packed one");
+
+    // The arena unpack must agree with the member by member unpack.
+    CHECK(csm_deserialize_struct(csm_ras_event_query_output_t, &heap,
+            buffer, buffer_len) == 0, "heap unpack failed");
+    CHECK(check_query_output(heap), "heap unpacked struct differs from the packed one");
+
+    // Every member lives in the one block sized by arena_size.
+    if ( output )
+    {
+        uint64_t  size  = arena_size_csm_ras_event_query_output_t(buffer, buffer_len);
+        char     *begin = (char*) output;
+        char     *end   = begin + size;
+        uint32_t  i;
+
+        CHECK(size >= sizeof(*output) + NUM_EVENTS * sizeof(csmi_ras_event_t),
+            "arena size %lu too small for the struct", (unsigned long) size);
+        CHECK((char*) output->results >= begin && (char*) output->results < end,
+            "results array outside the arena");
+        for ( i = 0; i < NUM_EVENTS; ++i )
+        {
+            CHECK((char*) output->results[i] >= begin && (char*) output->results[i] < end,
+                "event %u outside the arena", i);
+            CHECK(output->results[i]->msg_id >= begin && output->results[i]->msg_id < end,
+                "msg_id %u outside the arena", i);
+        }
+    }
+
+    csm_free_struct_arena(output);
+    CHECK(output == NULL, "csm_free_struct_arena did not reset the pointer");
+    csm_free_struct_ptr(csm_ras_event_query_output_t, heap);
+    free(buffer);
+}
+
+void test_arena_malformed(void)
+{
+    csm_ras_event_query_output_t  *output = NULL;
+    csm_ras_event_create_input_t  *input  = NULL;
+    uint32_t buffer_len = 0;
+    uint32_t len;
+    char    *buffer     = pack_query_output(&buffer_len);
+
+    printf("Testing deserialize_arena with malformed buffers...\n");
+
+    CHECK(arena_size_csm_ras_event_query_output_t(NULL, buffer_len) == 0,
+        "size of a NULL buffer");
+    CHECK(csm_deserialize_struct_arena(csm_ras_event_query_output_t, &output,
+            NULL, buffer_len) == 1 && output == NULL, "NULL buffer unpacked");
+
+    // Every truncation of the header or of a string is rejected. Like the
+    // member by member unpack, a missing trailing basic member is skipped.
+    for ( len = 0; len < buffer_len; ++len )
+    {
+        int rc;
+
+        output = NULL;
+        rc = csm_deserialize_struct_arena(csm_ras_event_query_output_t, &output, buffer, len);
+        if ( (rc == 0) != (output != NULL) ||
+             (len < buffer_len - sizeof(int64_t) && rc != 1) )
+        {
+            CHECK(0, "buffer truncated to %u of %u bytes unpacked", len, buffer_len);
+            len = buffer_len;
+        }
+        csm_free_struct_arena(output);
+    }
+
+    // A buffer of another struct type fails the magic check.
+    CHECK(csm_deserialize_struct_arena(csm_ras_event_create_input_t, &input,
+            buffer, buffer_len) == 1 && input == NULL, "struct of another type unpacked");
+
+    free(buffer);
+}
+
+void test_arena_reuse(void)
+{
+    csm_ras_event_query_output_t *output = NULL;
+    csm_ras_event_create_input_t *input  = NULL;
+    uint32_t output_len = 0;
+    uint32_t input_len  = 0;
+    char    *output_buf = pack_query_output(&output_len);
+    char    *input_buf  = pack_create_input(&input_len);
+    uint64_t output_size = arena_size_csm_ras_event_query_output_t(output_buf, output_len);
+    uint64_t input_size  = arena_size_csm_ras_event_create_input_t(input_buf, input_len);
+    void    *arena;
+
+    printf("Testing deserialize_arena into a reused caller arena...\n");
+
+    CHECK(output_size > input_size, "create input not smaller than the query output");
+    arena = malloc(output_size);
+
+    // Too small an arena is rejected without touching it.
+    memset(arena, 0xA5, output_size);
+    CHECK(deserialize_arena_csm_ras_event_query_output_t(&output, output_buf, output_len,
+            arena, output_size - 1) == 1 && output == NULL, "unpacked into too small an arena");
+    CHECK(((unsigned char*) arena)[0] == 0xA5, "too small an arena was written");
+
+    // The larger struct first, then the smaller one over what it left behind.
+    CHECK(deserialize_arena_csm_ras_event_query_output_t(&output, output_buf, output_len,
+            arena, output_size) == 0 && (void*) output == arena, "unpack into the arena failed");
+    CHECK(check_query_output(output), "struct in the arena differs from the packed one");
+
+    CHECK(deserialize_arena_csm_ras_event_create_input_t(&input, input_buf, input_len,
+            arena, output_size) == 0 && (void*) input == arena, "reuse of the arena failed");
+    CHECK(input && input->msg_id && !strcmp(input->msg_id, "test.arena.create") &&
+          input->location_name && !strcmp(input->location_name, "c650f01p01") &&
+          input->time_stamp && !input->time_stamp[0] && input->raw_data &&
+          !input->raw_data[0] && input->kvcsv && !input->kvcsv[0],
+          "struct in the reused arena has stale or wrong members");
+
+    // And back to the larger struct.
+    CHECK(deserialize_arena_csm_ras_event_query_output_t(&output, output_buf, output_len,
+            arena, output_size) == 0 && check_query_output(output),
+            "larger struct after a smaller one in the same arena");
+
+    // The caller owns the arena, the structs are not freed.
+    free(arena);
+    free(output_buf);
+    free(input_buf);
+}
+
+void test_pack_buffer_reuse(void)
+{
+    csm_ras_event_query_output_t *output = NULL;
+    csm_ras_event_create_input_t *input  = NULL;
+    uint32_t output_len = 0;
+    uint32_t input_len  = 0;
+    char    *output_buf = pack_query_output(&output_len);
+    char    *input_buf  = pack_create_input(&input_len);
+    char    *buffer     = NULL;
+    char    *first;
+    uint32_t buffer_len = 0;
+    uint32_t capacity   = 0;
+
+    printf("Testing csm_serialize_struct_buffer into a reused buffer...\n");
+
+    CHECK(csm_deserialize_struct(csm_ras_event_query_output_t, &output,
+            output_buf, output_len) == 0, "query output unpack failed");
+    CHECK(csm_deserialize_struct(csm_ras_event_create_input_t, &input,
+            input_buf, input_len) == 0, "create input unpack failed");
+
+    // The first pack allocates the buffer.
+    CHECK(csm_serialize_struct_buffer(csm_ras_event_query_output_t, output,
+            &buffer, &buffer_len, &capacity) == 0, "pack into a NULL buffer failed");
+    CHECK(buffer && buffer_len == output_len && capacity == output_len &&
+          !memcmp(buffer, output_buf, output_len), "pack differs from the one-shot pack");
+    first = buffer;
+
+    // A smaller struct is packed into the same buffer.
+    CHECK(csm_serialize_struct_buffer(csm_ras_event_create_input_t, input,
+            &buffer, &buffer_len, &capacity) == 0, "pack into the reused buffer failed");
+    CHECK(buffer == first && capacity == output_len, "buffer reallocated for a smaller struct");
+    CHECK(buffer_len == input_len && !memcmp(buffer, input_buf, input_len),
+        "pack into the reused buffer differs from the one-shot pack");
+
+    // The larger struct fits in what is already there.
+    CHECK(csm_serialize_struct_buffer(csm_ras_event_query_output_t, output,
+            &buffer, &buffer_len, &capacity) == 0 && buffer == first &&
+          buffer_len == output_len && !memcmp(buffer, output_buf, output_len),
+          "larger struct after a smaller one in the same buffer");
+
+    // Too small a buffer grows.
+    capacity = input_len;
+    CHECK(csm_serialize_struct_buffer(csm_ras_event_query_output_t, output,
+            &buffer, &buffer_len, &capacity) == 0 && capacity == output_len &&
+          buffer_len == output_len && !memcmp(buffer, output_buf, output_len),
+          "buffer not grown for a larger struct");
+
+    csm_free_struct_ptr(csm_ras_event_query_output_t, output);
+    csm_free_struct_ptr(csm_ras_event_create_input_t, input);
+    free(buffer);
+    free(output_buf);
+    free(input_buf);
+}
+
+int main(int argc, char *argv[]) {
+    test_arena_unpack();
+    test_arena_malformed();
+    test_arena_reuse();
+    test_pack_buffer_reuse();
+
+    printf("test_csmi_arena_serialization: %d failure(s)\n", failures);
+
+    return failures ? 1 : 0;
+}
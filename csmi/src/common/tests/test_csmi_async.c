@@ -0,0 +1,305 @@
+/*================================================================================
+
+    csmi/src/common/tests/test_csmi_async.c
+
+  © Copyright IBM Corporation 2015-2017. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+/*
+ * Exercises csmi_submit_cmd/csmi_poll_cmd/csmi_wait_cmd/csmi_submit_batch and
+ * csm_term_lib with requests in flight against a minimal in-process daemon.
+ * The daemon echoes the payload of every request except for payloads starting
+ * with "hold", which are never answered.
+ */
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <time.h>
+
+#include "csmnet/src/C/csm_network_msg_c.h"
+#include "csmi/include/csm_api_common.h"
+#include "csmi/src/common/include/csmi_api_internal.h"
+#include "csmi/src/common/include/csmi_common_utils.h"
+#include "csmutil/include/csm_test_utils.h"
+
+#define TEST_CMD ( CSM_CMD_ECHO )
+#define BATCH_SIZE ( 4 )
+
+static int failures = 0;
+
+static int srv_socket = -1;
+static volatile int srv_running = 1;
+static char srv_path[ 108 ];
+
+static void daemon_reply( const struct sockaddr_un *aClient, socklen_t aClientLen,
+                          uint8_t aCmd, uint8_t aFlags, uint64_t aMsgId,
+                          const char *aData, size_t aDataLen )
+{
+  csm_net_msg_t *msg = csm_net_msg_Init( aCmd, aFlags, CSM_PRIORITY_NO_ACK, aMsgId,
+                                         geteuid(), getegid(), aData, aDataLen, 0 );
+  if( msg == NULL )
+    return;
+
+  struct iovec iov[2];
+  struct msghdr mh;
+  iov[0].iov_base = csm_net_msg_GetHeaderBuffer( msg );
+  iov[0].iov_len = sizeof( csm_network_header_t );
+  iov[1].iov_base = (void*)aData;
+  iov[1].iov_len = aDataLen;
+  memset( &mh, 0, sizeof( mh ) );
+  mh.msg_name = (void*)aClient;
+  mh.msg_namelen = aClientLen;
+  mh.msg_iov = iov;
+  mh.msg_iovlen = aDataLen ? 2 : 1;
+
+  sendmsg( srv_socket, &mh, 0 );
+  free( msg );
+}
+
+static void* daemon_loop( void *aIn )
+{
+  // too big for the stack of a thread
+  char *buf = (char*)malloc( DGRAM_PAYLOAD_MAX );
+
+  while( srv_running )
+  {
+    struct sockaddr_un client;
+    socklen_t clientLen = sizeof( client );
+    ssize_t rlen = recvfrom( srv_socket, buf, DGRAM_PAYLOAD_MAX, 0, (struct sockaddr*)&client, &clientLen );
+    if( rlen < (ssize_t)sizeof( csm_network_header_t ) )
+      continue;
+
+    csm_network_header_t *hdr = (csm_network_header_t*)buf;
+    char *data = buf + sizeof( csm_network_header_t );
+    size_t dataLen = hdr->_DataLen;
+
+    if( CSM_HEADER_GET_ACK( hdr ) )
+      continue;
+
+    if( hdr->_CommandType == CSM_CMD_STATUS )
+    {
+      if(( dataLen == CSM_DISCONNECT_MSG_LEN ) && ( strncmp( data, CSM_DISCONNECT_MSG, dataLen ) == 0 ))
+      {
+        if( hdr->_Priority > CSM_PRIORITY_NO_ACK )
+          daemon_reply( &client, clientLen, CSM_CMD_STATUS, CSM_HEADER_INT_BIT | CSM_HEADER_ACK_BIT,
+                        hdr->_MessageID, NULL, 0 );
+      }
+      else
+        // version handshake, keep the default timeouts
+        daemon_reply( &client, clientLen, CSM_CMD_STATUS, CSM_HEADER_INT_BIT | CSM_HEADER_RESP_BIT,
+                      hdr->_MessageID, NULL, 0 );
+      continue;
+    }
+
+    if(( dataLen >= 4 ) && ( strncmp( data, "hold", 4 ) == 0 ))
+      continue;
+
+    daemon_reply( &client, clientLen, hdr->_CommandType, CSM_HEADER_RESP_BIT,
+                  hdr->_MessageID, data, dataLen );
+  }
+  free( buf );
+  return NULL;
+}
+
+static pthread_t daemon_start()
+{
+  pthread_t thread;
+  struct sockaddr_un addr;
+  struct timeval timeout = { 0, 100000 };
+
+  snprintf( srv_path, sizeof( srv_path ), "/tmp/test_csmi_async.%d.sock", getpid() );
+  unlink( srv_path );
+
+  srv_socket = socket( AF_UNIX, SOCK_DGRAM, 0 );
+  memset( &addr, 0, sizeof( addr ) );
+  addr.sun_family = AF_UNIX;
+  strncpy( addr.sun_path, srv_path, sizeof( addr.sun_path ) - 1 );
+  if(( srv_socket < 0 ) ||
+     ( bind( srv_socket, (struct sockaddr*)&addr, sizeof( addr ) ) != 0 ))
+  {
+    perror( "daemon socket" );
+    exit( 1 );
+  }
+  setsockopt( srv_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof( timeout ) );
+  setenv( "CSM_SSOCKET", srv_path, 1 );
+
+  pthread_create( &thread, NULL, daemon_loop, NULL );
+  return thread;
+}
+
+static void sleep_ms( long ms )
+{
+  struct timespec ts = { ms / 1000, ( ms % 1000 ) * 1000000L };
+  nanosleep( &ts, NULL );
+}
+
+static csm_api_object* new_obj()
+{
+  return csm_api_object_new( TEST_CMD, NULL );
+}
+
+static int submit_str( csm_api_object *csm_obj, const char *payload )
+{
+  return csmi_submit_cmd( csm_obj, TEST_CMD, payload, strlen( payload ) + 1 );
+}
+
+static void test_submit_poll_wait()
+{
+  csm_api_object *csm_obj = new_obj();
+  char *recv = NULL;
+  uint32_t recvLen = 0;
+  int i;
+
+  printf("Testing csmi_submit_cmd, csmi_poll_cmd and csmi_wait_cmd...\n");
+
+  CHECK( submit_str( csm_obj, "ping" ) == CSMI_SUCCESS, "submit failed" );
+
+  for( i = 0; ( i < 1000 ) && !csmi_poll_cmd( csm_obj ); ++i )
+    sleep_ms( 1 );
+  CHECK( csmi_poll_cmd( csm_obj ) == 1, "response did not arrive" );
+
+  CHECK( csmi_wait_cmd( csm_obj, 1000, &recv, &recvLen ) == CSMI_SUCCESS, "wait failed" );
+  CHECK(( recv != NULL ) && ( recvLen == 5 ) && ( strcmp( recv, "ping" ) == 0 ), "wrong response payload" );
+  free( recv );
+
+  // nothing in flight any more
+  CHECK( csmi_poll_cmd( csm_obj ) == 1, "poll without request in flight" );
+
+  csm_api_object_destroy( csm_obj );
+}
+
+static void test_batch()
+{
+  csmi_batch_entry_t entries[ BATCH_SIZE ];
+  char payloads[ BATCH_SIZE ][ 16 ];
+  int i;
+
+  printf("Testing csmi_submit_batch...\n");
+
+  for( i = 0; i < BATCH_SIZE; ++i )
+  {
+    snprintf( payloads[ i ], sizeof( payloads[ i ] ), "batch-%d", i );
+    entries[ i ].csm_obj = new_obj();
+    entries[ i ].cmd = TEST_CMD;
+    entries[ i ].sendPayload = payloads[ i ];
+    entries[ i ].sendPayloadLen = strlen( payloads[ i ] ) + 1;
+  }
+
+  CHECK( csmi_submit_batch( entries, BATCH_SIZE ) == CSMI_SUCCESS, "batch submit failed" );
+
+  // collect in reverse order, earlier responses wait in their entries
+  for( i = BATCH_SIZE - 1; i >= 0; --i )
+  {
+    char *recv = NULL;
+    uint32_t recvLen = 0;
+    CHECK( csmi_wait_cmd( entries[ i ].csm_obj, 1000, &recv, &recvLen ) == CSMI_SUCCESS, "wait %d failed", i );
+    CHECK(( recv != NULL ) && ( strcmp( recv, payloads[ i ] ) == 0 ), "wrong response for %d", i );
+    free( recv );
+    csm_api_object_destroy( entries[ i ].csm_obj );
+  }
+}
+
+static void test_wait_timeout()
+{
+  csm_api_object *csm_obj = new_obj();
+  char *recv = NULL;
+  uint32_t recvLen = 0;
+
+  printf("Testing csmi_wait_cmd timeout...\n");
+
+  CHECK( submit_str( csm_obj, "hold-timeout" ) == CSMI_SUCCESS, "submit failed" );
+  CHECK( csmi_poll_cmd( csm_obj ) == 0, "unanswered request polled as done" );
+  CHECK( csmi_wait_cmd( csm_obj, 200, &recv, &recvLen ) == CSMERR_TIMEOUT, "wait did not time out" );
+  CHECK( recv == NULL, "payload returned on timeout" );
+
+  csm_api_object_destroy( csm_obj );
+}
+
+typedef struct
+{
+  csm_api_object *csm_obj;
+  int rc;
+} waiter_t;
+
+static void* waiter( void *aIn )
+{
+  waiter_t *w = (waiter_t*)aIn;
+  char *recv = NULL;
+  uint32_t recvLen = 0;
+  w->rc = csmi_wait_cmd( w->csm_obj, 0, &recv, &recvLen );
+  free( recv );
+  return NULL;
+}
+
+static void test_term_outstanding()
+{
+  waiter_t w;
+  pthread_t thread;
+  csm_api_object *idle = new_obj();
+  char *recv = NULL;
+  uint32_t recvLen = 0;
+
+  printf("Testing csm_term_lib with requests in flight...\n");
+
+  w.csm_obj = new_obj();
+  w.rc = -1;
+  CHECK( submit_str( w.csm_obj, "hold-waited" ) == CSMI_SUCCESS, "submit failed" );
+  CHECK( submit_str( idle, "hold-idle" ) == CSMI_SUCCESS, "submit failed" );
+
+  // let the waiter block in the receive
+  pthread_create( &thread, NULL, waiter, &w );
+  sleep_ms( 200 );
+
+  csm_term_lib();
+  pthread_join( thread, NULL );
+
+  CHECK( w.rc == CSMERR_SENDRCV_ERROR, "blocked waiter returned %d", w.rc );
+  CHECK( csmi_poll_cmd( idle ) == 1, "request without waiter still in flight" );
+  CHECK( csmi_wait_cmd( idle, 1000, &recv, &recvLen ) == CSMERR_SENDRCV_ERROR, "request without waiter not failed" );
+
+  csm_api_object_destroy( w.csm_obj );
+  csm_api_object_destroy( idle );
+}
+
+int main(int argc, char *argv[])
+{
+  // a hang is a failure
+  alarm( 60 );
+
+  pthread_t daemon = daemon_start();
+
+  if( csm_init_lib() != 0 )
+  {
+    printf("csm_init_lib() failed\n");
+    return 1;
+  }
+
+  test_submit_poll_wait();
+  test_batch();
+  test_wait_timeout();
+  test_term_outstanding();
+
+  CHECK( csm_term_lib() == ENOTCONN, "second csm_term_lib() did not report ENOTCONN" );
+
+  srv_running = 0;
+  pthread_join( daemon, NULL );
+  close( srv_socket );
+  unlink( srv_path );
+
+  printf("test_csmi_async: %d failure(s)\n", failures);
+  return failures ? 1 : 0;
+}
@@ -266,71 +266,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_gpu_record.def"
-#define STRUCT_SUM 0x51378a01
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
 
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
-
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -339,8 +284,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -356,24 +311,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -387,21 +369,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -423,110 +410,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_hca_record.def"
-#define STRUCT_SUM 0xe97d6932
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_gpu_record.def"
+#define STRUCT_SUM 0x51378a01
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -772,71 +737,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_ib_cable_record.def"
-#define STRUCT_SUM 0x74ceab82
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -845,8 +755,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -862,52 +782,84 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
-    // If the buffer is null or zero length, don't even bother trying to unpack it.
-    if( !(buffer && len && *offset <= len) ) 
-    {
-        *dest = NULL; 
-        return;
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
     }
 
     #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -929,110 +881,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_ib_cable_history_record.def"
-#define STRUCT_SUM 0xf3d5948c
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_hca_record.def"
+#define STRUCT_SUM 0xe97d6932
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -1278,71 +1208,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_node_attributes_record.def"
-#define STRUCT_SUM 0x43c2795d
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -1351,8 +1226,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -1368,24 +1253,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -1399,21 +1311,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -1435,110 +1352,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_node_attributes_history_record.def"
-#define STRUCT_SUM 0x98a498f9
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_ib_cable_record.def"
+#define STRUCT_SUM 0x74ceab82
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -1784,71 +1679,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_node_query_state_history_record.def"
-#define STRUCT_SUM 0x3e382487
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -1857,8 +1697,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -1874,24 +1724,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -1905,21 +1782,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -1941,110 +1823,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_processor_record.def"
-#define STRUCT_SUM 0x63bb9fec
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_ib_cable_history_record.def"
+#define STRUCT_SUM 0xf3d5948c
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -2290,72 +2150,17 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
 
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_ssd_record.def"
-#define STRUCT_SUM 0x997bfadf
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
-
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
-{
-    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
-    uint32_t size = 1;                        //< The number of elements being serialized.
-    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
-
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
-    int      ret_code = 0;
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
 
     // If the version id is above the MIN Version
     if ( version_id >= CSM_MIN_VERSION ) 
@@ -2363,8 +2168,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -2380,24 +2195,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -2411,21 +2253,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -2447,110 +2294,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_switch_record.def"
-#define STRUCT_SUM 0xfb63c39f
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_node_attributes_record.def"
+#define STRUCT_SUM 0x43c2795d
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -2796,71 +2621,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_switch_inventory_record.def"
-#define STRUCT_SUM 0x442c1b02
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -2869,8 +2639,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -2886,177 +2666,187 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
-    // If the buffer is null or zero length, don't even bother trying to unpack it.
-    if( !(buffer && len && *offset <= len) ) 
-    {
-        *dest = NULL; 
-        return;
-    }
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
 
     #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
-    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
 
-    // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
     #include STRUCT_DEF
 
-    // Test the offeset against the length
-    if ( *offset <= len )
-    {
-        // If the version id is not equal to released version, test for initialization.
-        if ( version_id < CSM_VERSION_ID )
-        {
-            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-                INIT_##serial_type(name, init_value, length_member)
+    return arena_len;
+}
 
-            #define CSMI_VERSION_START(version) if ( version_id < version ) {
-            #define CSMI_VERSION_END(hash) }
-            #include STRUCT_DEF
-        }
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_switch_ports_record.def"
-#define STRUCT_SUM 0xe27c3e26
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_node_attributes_history_record.def"
+#define STRUCT_SUM 0x98a498f9
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -3302,71 +3092,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_switch_details.def"
-#define STRUCT_SUM 0x7db6f656
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -3375,8 +3110,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -3392,24 +3137,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -3423,21 +3195,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -3459,110 +3236,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_switch_history_record.def"
-#define STRUCT_SUM 0xe6628868
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_node_query_state_history_record.def"
+#define STRUCT_SUM 0x3e382487
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -3808,71 +3563,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_node_env_data.def"
-#define STRUCT_SUM 0x29ff8335
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -3881,8 +3581,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -3898,24 +3608,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -3929,21 +3666,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -3965,110 +3707,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_switch_env_data.def"
-#define STRUCT_SUM 0x78fd10b3
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_processor_record.def"
+#define STRUCT_SUM 0x63bb9fec
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -4314,72 +4034,17 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
 
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_fabric_topology.def"
-#define STRUCT_SUM 0x1600a9bd
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
-
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
-{
-    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
-    uint32_t size = 1;                        //< The number of elements being serialized.
-    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
-
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
-    int      ret_code = 0;
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
 
     // If the version id is above the MIN Version
     if ( version_id >= CSM_MIN_VERSION ) 
@@ -4387,8 +4052,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -4404,24 +4079,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -4435,21 +4137,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -4471,110 +4178,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_node_details.def"
-#define STRUCT_SUM 0x6bc11d5e
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_ssd_record.def"
+#define STRUCT_SUM 0x997bfadf
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -4820,71 +4505,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_cluster_query_state_record.def"
-#define STRUCT_SUM 0x91a89bf7
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -4893,8 +4523,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -4910,62 +4550,94 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
-    // If the buffer is null or zero length, don't even bother trying to unpack it.
-    if( !(buffer && len && *offset <= len) ) 
-    {
-        *dest = NULL; 
-        return;
-    }
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
 
     #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
-    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
 
-    // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
     #include STRUCT_DEF
 
-    // Test the offeset against the length
-    if ( *offset <= len )
-    {
-        // If the version id is not equal to released version, test for initialization.
-        if ( version_id < CSM_VERSION_ID )
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
         {
             #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
                 INIT_##serial_type(name, init_value, length_member)
@@ -4977,110 +4649,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_node_find_job_record.def"
-#define STRUCT_SUM 0x64ce3bf8
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_switch_record.def"
+#define STRUCT_SUM 0xfb63c39f
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -5326,71 +4976,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_inventory_collection_input.def"
-#define STRUCT_SUM 0xd5701e2e
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -5399,8 +4994,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -5416,24 +5021,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -5447,21 +5079,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -5483,110 +5120,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_inventory_collection_output.def"
-#define STRUCT_SUM 0xb807aaa9
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_switch_inventory_record.def"
+#define STRUCT_SUM 0x442c1b02
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -5832,71 +5447,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_query_input.def"
-#define STRUCT_SUM 0x040b9492
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -5905,8 +5465,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -5922,24 +5492,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -5953,21 +5550,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -5989,110 +5591,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_query_output.def"
-#define STRUCT_SUM 0x06527c4e
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_switch_ports_record.def"
+#define STRUCT_SUM 0xe27c3e26
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -6338,72 +5918,17 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
 
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_query_history_input.def"
-#define STRUCT_SUM 0x87f78799
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
-
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
-{
-    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
-    uint32_t size = 1;                        //< The number of elements being serialized.
-    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
-
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
-    int      ret_code = 0;
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
 
     // If the version id is above the MIN Version
     if ( version_id >= CSM_MIN_VERSION ) 
@@ -6411,8 +5936,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -6428,24 +5963,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -6459,21 +6021,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -6495,110 +6062,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_query_history_output.def"
-#define STRUCT_SUM 0x409527c6
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_switch_details.def"
+#define STRUCT_SUM 0x7db6f656
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -6844,71 +6389,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_update_input.def"
-#define STRUCT_SUM 0x5af92e73
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -6917,8 +6407,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -6934,177 +6434,187 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
-    // If the buffer is null or zero length, don't even bother trying to unpack it.
-    if( !(buffer && len && *offset <= len) ) 
-    {
-        *dest = NULL; 
-        return;
-    }
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
 
     #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
-    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
 
-    // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
     #include STRUCT_DEF
 
-    // Test the offeset against the length
-    if ( *offset <= len )
-    {
-        // If the version id is not equal to released version, test for initialization.
-        if ( version_id < CSM_VERSION_ID )
-        {
-            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-                INIT_##serial_type(name, init_value, length_member)
+    return arena_len;
+}
 
-            #define CSMI_VERSION_START(version) if ( version_id < version ) {
-            #define CSMI_VERSION_END(hash) }
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
             #include STRUCT_DEF
         }
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_update_output.def"
-#define STRUCT_SUM 0xf6567f5a
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_switch_history_record.def"
+#define STRUCT_SUM 0xe6628868
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -7350,71 +6860,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_query_input.def"
-#define STRUCT_SUM 0x7232b69d
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -7423,8 +6878,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -7440,24 +6905,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -7471,21 +6963,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -7507,110 +7004,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
-    // Fail buffer overflows.
-    if(offset > buffer_len)
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_query_output.def"
-#define STRUCT_SUM 0xd715989b
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_node_env_data.def"
+#define STRUCT_SUM 0x29ff8335
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -7856,71 +7331,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_query_details_input.def"
-#define STRUCT_SUM 0xa52fdfa8
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -7929,8 +7349,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -7946,24 +7376,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -7977,21 +7434,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -8013,110 +7475,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_query_details_output.def"
-#define STRUCT_SUM 0xf160e454
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_switch_env_data.def"
+#define STRUCT_SUM 0x78fd10b3
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -8362,72 +7802,17 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
 
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_query_history_input.def"
-#define STRUCT_SUM 0x93061b51
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
-
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
-{
-    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
-    uint32_t size = 1;                        //< The number of elements being serialized.
-    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
-
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
-    int      ret_code = 0;
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
 
     // If the version id is above the MIN Version
     if ( version_id >= CSM_MIN_VERSION ) 
@@ -8435,8 +7820,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -8452,24 +7847,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -8483,21 +7905,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -8519,110 +7946,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_query_history_output.def"
-#define STRUCT_SUM 0x4ba074ec
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_fabric_topology.def"
+#define STRUCT_SUM 0x1600a9bd
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -8868,71 +8273,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_query_state_history_input.def"
-#define STRUCT_SUM 0xec80d714
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -8941,8 +8291,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -8958,62 +8318,94 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
-    // If the buffer is null or zero length, don't even bother trying to unpack it.
-    if( !(buffer && len && *offset <= len) ) 
-    {
-        *dest = NULL; 
-        return;
-    }
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
 
     #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
-    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
 
-    // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
     #include STRUCT_DEF
 
-    // Test the offeset against the length
-    if ( *offset <= len )
-    {
-        // If the version id is not equal to released version, test for initialization.
-        if ( version_id < CSM_VERSION_ID )
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
         {
             #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
                 INIT_##serial_type(name, init_value, length_member)
@@ -9025,110 +8417,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_query_state_history_output.def"
-#define STRUCT_SUM 0xa99cc56e
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_node_details.def"
+#define STRUCT_SUM 0x6bc11d5e
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -9374,71 +8744,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_update_input.def"
-#define STRUCT_SUM 0x1773fa5e
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -9447,8 +8762,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -9464,24 +8789,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -9495,21 +8847,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -9531,110 +8888,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_update_output.def"
-#define STRUCT_SUM 0x5c0349a4
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_cluster_query_state_record.def"
+#define STRUCT_SUM 0x91a89bf7
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -9880,71 +9215,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_delete_input.def"
-#define STRUCT_SUM 0x965ccd2f
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -9953,8 +9233,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -9970,24 +9260,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -10001,21 +9318,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -10037,110 +9359,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_delete_output.def"
-#define STRUCT_SUM 0x09080062
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csmi_node_find_job_record.def"
+#define STRUCT_SUM 0x64ce3bf8
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -10386,72 +9686,17 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
 
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_find_job_input.def"
-#define STRUCT_SUM 0xad5fa8fa
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
-
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
-{
-    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
-    uint32_t size = 1;                        //< The number of elements being serialized.
-    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
-
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
-    int      ret_code = 0;
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
 
     // If the version id is above the MIN Version
     if ( version_id >= CSM_MIN_VERSION ) 
@@ -10459,8 +9704,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -10476,24 +9731,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -10507,21 +9789,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -10543,110 +9830,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_find_job_output.def"
-#define STRUCT_SUM 0xf013d68c
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_inventory_collection_input.def"
+#define STRUCT_SUM 0xd5701e2e
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -10892,71 +10157,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_query_input.def"
-#define STRUCT_SUM 0x3d189cb9
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -10965,8 +10175,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -10982,177 +10202,187 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
-    // If the buffer is null or zero length, don't even bother trying to unpack it.
-    if( !(buffer && len && *offset <= len) ) 
-    {
-        *dest = NULL; 
-        return;
-    }
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
 
     #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
-    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
 
-    // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
     #include STRUCT_DEF
 
-    // Test the offeset against the length
-    if ( *offset <= len )
-    {
-        // If the version id is not equal to released version, test for initialization.
-        if ( version_id < CSM_VERSION_ID )
-        {
-            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-                INIT_##serial_type(name, init_value, length_member)
+    return arena_len;
+}
 
-            #define CSMI_VERSION_START(version) if ( version_id < version ) {
-            #define CSMI_VERSION_END(hash) }
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
             #include STRUCT_DEF
         }
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_query_output.def"
-#define STRUCT_SUM 0xc8f44323
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_inventory_collection_output.def"
+#define STRUCT_SUM 0xb807aaa9
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -11398,71 +10628,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_query_details_input.def"
-#define STRUCT_SUM 0x72e3bcee
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -11471,8 +10646,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -11488,24 +10673,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -11519,21 +10731,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -11555,110 +10772,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
-    // Fail buffer overflows.
-    if(offset > buffer_len)
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_query_details_output.def"
-#define STRUCT_SUM 0xc41d9c20
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_query_input.def"
+#define STRUCT_SUM 0x040b9492
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -11904,71 +11099,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_query_history_input.def"
-#define STRUCT_SUM 0x7314d731
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -11977,8 +11117,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -11994,24 +11144,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -12025,21 +11202,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -12061,110 +11243,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_query_history_output.def"
-#define STRUCT_SUM 0xf3ef3656
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_query_output.def"
+#define STRUCT_SUM 0x06527c4e
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -12410,14 +11570,13420 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_query_history_input.def"
+#define STRUCT_SUM 0x87f78799
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_query_history_output.def"
+#define STRUCT_SUM 0x409527c6
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_update_input.def"
+#define STRUCT_SUM 0x5af92e73
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_ib_cable_update_output.def"
+#define STRUCT_SUM 0xf6567f5a
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_query_input.def"
+#define STRUCT_SUM 0x7232b69d
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_query_output.def"
+#define STRUCT_SUM 0xd715989b
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_query_details_input.def"
+#define STRUCT_SUM 0xa52fdfa8
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_query_details_output.def"
+#define STRUCT_SUM 0xf160e454
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_query_history_input.def"
+#define STRUCT_SUM 0x93061b51
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_query_history_output.def"
+#define STRUCT_SUM 0x4ba074ec
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_query_state_history_input.def"
+#define STRUCT_SUM 0xec80d714
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_query_state_history_output.def"
+#define STRUCT_SUM 0xa99cc56e
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_update_input.def"
+#define STRUCT_SUM 0x1773fa5e
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_attributes_update_output.def"
+#define STRUCT_SUM 0x5c0349a4
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_delete_input.def"
+#define STRUCT_SUM 0x965ccd2f
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_delete_output.def"
+#define STRUCT_SUM 0x09080062
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_find_job_input.def"
+#define STRUCT_SUM 0xad5fa8fa
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_node_find_job_output.def"
+#define STRUCT_SUM 0xf013d68c
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_query_input.def"
+#define STRUCT_SUM 0x3d189cb9
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_query_output.def"
+#define STRUCT_SUM 0xc8f44323
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_query_details_input.def"
+#define STRUCT_SUM 0x72e3bcee
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_query_details_output.def"
+#define STRUCT_SUM 0xc41d9c20
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_query_history_input.def"
+#define STRUCT_SUM 0x7314d731
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_query_history_output.def"
+#define STRUCT_SUM 0xf3ef3656
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_update_input.def"
+#define STRUCT_SUM 0xd1877483
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_update_output.def"
+#define STRUCT_SUM 0xcfcb8570
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_inventory_collection_input.def"
+#define STRUCT_SUM 0xe6348b90
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_inventory_collection_output.def"
+#define STRUCT_SUM 0x4c2f9e66
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_update_input.def"
-#define STRUCT_SUM 0xd1877483
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_children_inventory_collection_input.def"
+#define STRUCT_SUM 0xa3a58ed8
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -12663,71 +25229,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_attributes_update_output.def"
-#define STRUCT_SUM 0xcfcb8570
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -12736,8 +25247,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -12753,24 +25274,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -12784,21 +25332,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -12820,110 +25373,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_inventory_collection_input.def"
-#define STRUCT_SUM 0xe6348b90
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_children_inventory_collection_output.def"
+#define STRUCT_SUM 0xcf128483
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -13154,86 +25685,31 @@ FREE_FUNCT(CSMI_STRUCT_NAME)
     #include STRUCT_DEF
 }
 
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_inventory_collection_output.def"
-#define STRUCT_SUM 0x4c2f9e66
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
 
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -13242,8 +25718,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -13259,24 +25745,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -13290,21 +25803,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -13326,110 +25844,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_children_inventory_collection_input.def"
-#define STRUCT_SUM 0xa3a58ed8
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_cluster_query_state_input.def"
+#define STRUCT_SUM 0xf74c1b8f
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -13675,71 +26171,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_switch_children_inventory_collection_output.def"
-#define STRUCT_SUM 0xcf128483
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -13748,8 +26189,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -13765,24 +26216,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -13796,21 +26274,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -13832,110 +26315,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
-        target = NULL;
-    }
-
-    *dest = target;
-}
-
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
-{
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
+        // The memory is released with the arena.
+        target = NULL;
     }
 
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_cluster_query_state_input.def"
-#define STRUCT_SUM 0xf74c1b8f
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_cluster_query_state_output.def"
+#define STRUCT_SUM 0xf923293c
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -14181,71 +26642,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/inv/csm_cluster_query_state_output.def"
-#define STRUCT_SUM 0xf923293c
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -14254,8 +26660,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -14271,24 +26687,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -14302,21 +26745,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -14338,102 +26786,80 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
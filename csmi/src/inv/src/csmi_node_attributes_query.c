@@ -136,7 +136,7 @@ int csm_node_attributes_query(
     {
         if ( return_buffer )
         {
-            if ( csm_deserialize_struct(API_PARAMETER_OUTPUT_TYPE, output, 
+            if ( csm_deserialize_struct_arena(API_PARAMETER_OUTPUT_TYPE, output, 
                     return_buffer, return_buffer_length ) == 0 )
             {
                 csm_api_object_set_retdata(*csm_obj, 1, *output);
@@ -195,7 +195,7 @@ void csmi_node_attributes_query_destroy(csm_api_object *csm_obj)
     /* Do the free */
 	/* Set the data. */
     output = (API_PARAMETER_OUTPUT_TYPE *) csmi_hdl->ret_cdata;
-	/* Free the API output struct */
-	csm_free_struct_ptr(API_PARAMETER_OUTPUT_TYPE, output);
+	/* Free the API output struct, its members share the single arena allocation. */
+	csm_free_struct_arena(output);
 }
 
@@ -110,7 +110,7 @@ int csm_ras_event_query(csm_api_object **csm_obj,
     {
         if ( return_buffer )
         {
-            if ( csm_deserialize_struct(API_PARAMETER_OUTPUT_TYPE, output,
+            if ( csm_deserialize_struct_arena(API_PARAMETER_OUTPUT_TYPE, output,
                     return_buffer, return_buffer_length ) == 0 )
             {
                 csm_api_object_set_retdata(*csm_obj, 1, *output);
@@ -164,7 +164,7 @@ void csm_ras_event_query_destroy(csm_api_object *csm_obj)
     }
 
     output = (API_PARAMETER_OUTPUT_TYPE*) csmi_hdl->ret_cdata;
-    csm_free_struct_ptr( API_PARAMETER_OUTPUT_TYPE, output );
+    csm_free_struct_arena(output);
 }
 
 
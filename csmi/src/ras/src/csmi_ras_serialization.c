@@ -266,71 +266,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_event_create_input.def"
-#define STRUCT_SUM 0xa7d5c0c6
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
 
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
-
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -339,8 +284,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -356,24 +311,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -387,21 +369,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -423,110 +410,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csmi_ras_event_action_record.def"
-#define STRUCT_SUM 0x8592e47c
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_event_create_input.def"
+#define STRUCT_SUM 0xa7d5c0c6
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -772,71 +737,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csmi_ras_event_action.def"
-#define STRUCT_SUM 0xa3e62e3e
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -845,8 +755,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -862,52 +782,84 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
-    // If the buffer is null or zero length, don't even bother trying to unpack it.
-    if( !(buffer && len && *offset <= len) ) 
-    {
-        *dest = NULL; 
-        return;
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
     }
 
     #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -929,110 +881,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csmi_ras_event.def"
-#define STRUCT_SUM 0x24aee8dc
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csmi_ras_event_action_record.def"
+#define STRUCT_SUM 0x8592e47c
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -1278,71 +1208,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csmi_ras_event_vector.def"
-#define STRUCT_SUM 0x634cacbb
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -1351,8 +1226,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -1368,24 +1253,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -1399,21 +1311,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -1435,110 +1352,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_event_query_input.def"
-#define STRUCT_SUM 0xb7d20b73
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csmi_ras_event_action.def"
+#define STRUCT_SUM 0xa3e62e3e
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -1784,71 +1679,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_event_query_output.def"
-#define STRUCT_SUM 0x4706e74d
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -1857,8 +1697,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -1874,24 +1724,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -1905,21 +1782,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -1941,110 +1823,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_event_query_allocation_input.def"
-#define STRUCT_SUM 0x949bb396
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csmi_ras_event.def"
+#define STRUCT_SUM 0x24aee8dc
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -2290,72 +2150,17 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
 
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_event_query_allocation_output.def"
-#define STRUCT_SUM 0x2d7b82f0
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
-
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
-{
-    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
-    uint32_t size = 1;                        //< The number of elements being serialized.
-    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
-
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
-    int      ret_code = 0;
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
 
     // If the version id is above the MIN Version
     if ( version_id >= CSM_MIN_VERSION ) 
@@ -2363,8 +2168,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -2380,24 +2195,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -2411,21 +2253,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -2447,110 +2294,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_create_input.def"
-#define STRUCT_SUM 0x26ad5fdb
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csmi_ras_event_vector.def"
+#define STRUCT_SUM 0x634cacbb
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -2796,71 +2621,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_create_output.def"
-#define STRUCT_SUM 0x12a01c2e
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -2869,8 +2639,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -2886,70 +2666,4572 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
-    // If the buffer is null or zero length, don't even bother trying to unpack it.
-    if( !(buffer && len && *offset <= len) ) 
-    {
-        *dest = NULL; 
-        return;
-    }
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
 
     #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
-    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
 
-    // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
     #include STRUCT_DEF
 
-    // Test the offeset against the length
-    if ( *offset <= len )
-    {
-        // If the version id is not equal to released version, test for initialization.
-        if ( version_id < CSM_VERSION_ID )
-        {
-            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-                INIT_##serial_type(name, init_value, length_member)
+    return arena_len;
+}
 
-            #define CSMI_VERSION_START(version) if ( version_id < version ) {
-            #define CSMI_VERSION_END(hash) }
-            #include STRUCT_DEF
-        }
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_event_query_input.def"
+#define STRUCT_SUM 0xb7d20b73
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_event_query_output.def"
+#define STRUCT_SUM 0x4706e74d
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_event_query_allocation_input.def"
+#define STRUCT_SUM 0x949bb396
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_event_query_allocation_output.def"
+#define STRUCT_SUM 0x2d7b82f0
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_create_input.def"
+#define STRUCT_SUM 0x26ad5fdb
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_create_output.def"
+#define STRUCT_SUM 0x12a01c2e
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_delete_input.def"
+#define STRUCT_SUM 0xb62f32ea
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_delete_output.def"
+#define STRUCT_SUM 0x3e349c71
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_update_input.def"
+#define STRUCT_SUM 0xdd538ca4
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_update_output.def"
+#define STRUCT_SUM 0xb5541596
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
     }
     else
     {
@@ -3049,14 +7331,232 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_delete_input.def"
-#define STRUCT_SUM 0xb62f32ea
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_query_input.def"
+#define STRUCT_SUM 0x4281d358
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -3302,71 +7802,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_delete_output.def"
-#define STRUCT_SUM 0x3e349c71
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -3375,8 +7820,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -3392,24 +7847,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -3423,21 +7905,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -3459,110 +7946,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_update_input.def"
-#define STRUCT_SUM 0xdd538ca4
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_query_output.def"
+#define STRUCT_SUM 0x4e0c5b23
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -3793,86 +8258,31 @@ FREE_FUNCT(CSMI_STRUCT_NAME)
     #include STRUCT_DEF
 }
 
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_update_output.def"
-#define STRUCT_SUM 0xb5541596
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
 
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -3881,8 +8291,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -3898,24 +8318,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -3929,21 +8376,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -3965,110 +8417,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_query_input.def"
-#define STRUCT_SUM 0x4281d358
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_subscribe_input.def"
+#define STRUCT_SUM 0x0d6a8525
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -4314,71 +8744,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_msg_type_query_output.def"
-#define STRUCT_SUM 0x4e0c5b23
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -4387,8 +8762,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -4404,24 +8789,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -4435,21 +8847,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -4471,110 +8888,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
-        target = NULL;
-    }
-
-    *dest = target;
-}
-
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
-{
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
+        // The memory is released with the arena.
+        target = NULL;
     }
 
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_subscribe_input.def"
-#define STRUCT_SUM 0x0d6a8525
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_unsubscribe_input.def"
+#define STRUCT_SUM 0x8d6c51c6
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -4820,71 +9215,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/ras/csm_ras_unsubscribe_input.def"
-#define STRUCT_SUM 0x8d6c51c6
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -4893,8 +9233,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -4910,24 +9260,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -4941,21 +9318,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -4977,102 +9359,80 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
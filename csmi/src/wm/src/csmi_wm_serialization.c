@@ -275,71 +275,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation.def"
-#define STRUCT_SUM 0x13a86231
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
 
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
-
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -348,8 +293,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -365,24 +320,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -396,21 +378,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -432,110 +419,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_accounting.def"
-#define STRUCT_SUM 0xbb8fa4d7
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation.def"
+#define STRUCT_SUM 0x13a86231
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -781,71 +746,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_step_list.def"
-#define STRUCT_SUM 0x8d0cbc56
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -854,8 +764,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -871,52 +791,84 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
-    // If the buffer is null or zero length, don't even bother trying to unpack it.
-    if( !(buffer && len && *offset <= len) ) 
-    {
-        *dest = NULL; 
-        return;
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
     }
 
     #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -938,110 +890,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_state_history.def"
-#define STRUCT_SUM 0xbb89762d
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_accounting.def"
+#define STRUCT_SUM 0xbb8fa4d7
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -1287,71 +1217,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_details.def"
-#define STRUCT_SUM 0x60f39275
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -1360,8 +1235,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -1377,24 +1262,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -1408,21 +1320,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -1444,110 +1361,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_step_history.def"
-#define STRUCT_SUM 0x2604775a
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_step_list.def"
+#define STRUCT_SUM 0x8d0cbc56
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -1793,71 +1688,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_step.def"
-#define STRUCT_SUM 0xd7905381
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -1866,8 +1706,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -1883,24 +1733,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -1914,21 +1791,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -1950,110 +1832,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_ssd_resources_record.def"
-#define STRUCT_SUM 0x988b4548
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_state_history.def"
+#define STRUCT_SUM 0xbb89762d
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -2299,72 +2159,17 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
 
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_node_resources_record.def"
-#define STRUCT_SUM 0x7b18f280
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
-
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
-{
-    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
-    uint32_t size = 1;                        //< The number of elements being serialized.
-    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
-
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
-    int      ret_code = 0;
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
 
     // If the version id is above the MIN Version
     if ( version_id >= CSM_MIN_VERSION ) 
@@ -2372,8 +2177,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -2389,24 +2204,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -2420,21 +2262,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -2456,110 +2303,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_cgroup.def"
-#define STRUCT_SUM 0xf430c40d
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_details.def"
+#define STRUCT_SUM 0x60f39275
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -2805,71 +2630,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_resources_record.def"
-#define STRUCT_SUM 0xb9238f74
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -2878,8 +2648,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -2895,177 +2675,187 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
-    // If the buffer is null or zero length, don't even bother trying to unpack it.
-    if( !(buffer && len && *offset <= len) ) 
-    {
-        *dest = NULL; 
-        return;
-    }
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
 
     #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
-    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
 
-    // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
     #include STRUCT_DEF
 
-    // Test the offeset against the length
-    if ( *offset <= len )
-    {
-        // If the version id is not equal to released version, test for initialization.
-        if ( version_id < CSM_VERSION_ID )
-        {
-            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-                INIT_##serial_type(name, init_value, length_member)
+    return arena_len;
+}
 
-            #define CSMI_VERSION_START(version) if ( version_id < version ) {
-            #define CSMI_VERSION_END(hash) }
-            #include STRUCT_DEF
-        }
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_query_details_input.def"
-#define STRUCT_SUM 0xb78f96a2
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_step_history.def"
+#define STRUCT_SUM 0x2604775a
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -3311,71 +3101,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_query_details_output.def"
-#define STRUCT_SUM 0xfbcd04f8
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -3384,8 +3119,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -3401,24 +3146,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -3432,21 +3204,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -3468,110 +3245,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_update_state_input.def"
-#define STRUCT_SUM 0xea496f1b
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_step.def"
+#define STRUCT_SUM 0xd7905381
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -3817,71 +3572,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_end_input.def"
-#define STRUCT_SUM 0xbafd2527
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -3890,8 +3590,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -3907,24 +3617,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -3938,21 +3675,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -3974,110 +3716,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_query_input.def"
-#define STRUCT_SUM 0xacd9938b
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_ssd_resources_record.def"
+#define STRUCT_SUM 0x988b4548
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -4323,72 +4043,17 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
 
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_query_output.def"
-#define STRUCT_SUM 0x62517485
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
-
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
-{
-    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
-    uint32_t size = 1;                        //< The number of elements being serialized.
-    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
-
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
-    int      ret_code = 0;
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
 
     // If the version id is above the MIN Version
     if ( version_id >= CSM_MIN_VERSION ) 
@@ -4396,8 +4061,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -4413,24 +4088,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -4444,21 +4146,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -4480,110 +4187,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_query_details_input.def"
-#define STRUCT_SUM 0xf6d23071
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_node_resources_record.def"
+#define STRUCT_SUM 0x7b18f280
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -4829,71 +4514,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_query_active_all_input.def"
-#define STRUCT_SUM 0xc00191cd
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -4902,8 +4532,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -4919,62 +4559,94 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
-    // If the buffer is null or zero length, don't even bother trying to unpack it.
-    if( !(buffer && len && *offset <= len) ) 
-    {
-        *dest = NULL; 
-        return;
-    }
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
 
     #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
-    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
 
-    // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
     #include STRUCT_DEF
 
-    // Test the offeset against the length
-    if ( *offset <= len )
-    {
-        // If the version id is not equal to released version, test for initialization.
-        if ( version_id < CSM_VERSION_ID )
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
         {
             #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
                 INIT_##serial_type(name, init_value, length_member)
@@ -4986,110 +4658,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_node_resources_query_input.def"
-#define STRUCT_SUM 0x49606b4a
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_cgroup.def"
+#define STRUCT_SUM 0xf430c40d
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -5335,71 +4985,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_node_resources_query_output.def"
-#define STRUCT_SUM 0xf451998b
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -5408,8 +5003,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -5425,24 +5030,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -5456,21 +5088,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -5492,110 +5129,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_node_resources_query_all_input.def"
-#define STRUCT_SUM 0x7296a9d1
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_resources_record.def"
+#define STRUCT_SUM 0xb9238f74
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -5841,71 +5456,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_node_resources_query_all_output.def"
-#define STRUCT_SUM 0xfa34fef2
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -5914,8 +5474,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -5931,24 +5501,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -5962,21 +5559,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -5998,110 +5600,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_cgroup_create_input.def"
-#define STRUCT_SUM 0x11619b09
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_query_details_input.def"
+#define STRUCT_SUM 0xb78f96a2
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -6347,72 +5927,17 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
 
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_cgroup_delete_input.def"
-#define STRUCT_SUM 0x0ed19130
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
-
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
-{
-    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
-    uint32_t size = 1;                        //< The number of elements being serialized.
-    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
-
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
-    int      ret_code = 0;
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
 
     // If the version id is above the MIN Version
     if ( version_id >= CSM_MIN_VERSION ) 
@@ -6420,8 +5945,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -6437,24 +5972,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -6468,21 +6030,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -6504,110 +6071,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_resources_query_input.def"
-#define STRUCT_SUM 0x06d0c617
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_query_details_output.def"
+#define STRUCT_SUM 0xfbcd04f8
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -6853,71 +6398,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_resources_query_output.def"
-#define STRUCT_SUM 0x423ea695
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -6926,8 +6416,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -6943,177 +6443,187 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
-    // If the buffer is null or zero length, don't even bother trying to unpack it.
-    if( !(buffer && len && *offset <= len) ) 
-    {
-        *dest = NULL; 
-        return;
-    }
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
 
     #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
-    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
 
-    // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
     #include STRUCT_DEF
 
-    // Test the offeset against the length
-    if ( *offset <= len )
-    {
-        // If the version id is not equal to released version, test for initialization.
-        if ( version_id < CSM_VERSION_ID )
-        {
-            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-                INIT_##serial_type(name, init_value, length_member)
+    return arena_len;
+}
 
-            #define CSMI_VERSION_START(version) if ( version_id < version ) {
-            #define CSMI_VERSION_END(hash) }
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
             #include STRUCT_DEF
         }
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_update_history_input.def"
-#define STRUCT_SUM 0x1e280ea5
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_update_state_input.def"
+#define STRUCT_SUM 0xea496f1b
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -7359,71 +6869,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_query_input.def"
-#define STRUCT_SUM 0xb5e80ccc
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -7432,8 +6887,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -7449,24 +6914,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -7480,21 +6972,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -7516,110 +7013,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
-    // Fail buffer overflows.
-    if(offset > buffer_len)
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_query_output.def"
-#define STRUCT_SUM 0xce8c3f6c
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_end_input.def"
+#define STRUCT_SUM 0xbafd2527
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -7865,71 +7340,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_query_active_all_input.def"
-#define STRUCT_SUM 0xe891ea52
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -7938,8 +7358,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -7955,24 +7385,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -7986,21 +7443,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -8022,110 +7484,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_query_active_all_output.def"
-#define STRUCT_SUM 0xa7a53b58
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_query_input.def"
+#define STRUCT_SUM 0xacd9938b
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -8371,72 +7811,17 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
 
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_delete_input.def"
-#define STRUCT_SUM 0x123c30f6
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
-
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
-{
-    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
-    uint32_t size = 1;                        //< The number of elements being serialized.
-    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
-
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
-    int      ret_code = 0;
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
 
     // If the version id is above the MIN Version
     if ( version_id >= CSM_MIN_VERSION ) 
@@ -8444,8 +7829,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -8461,24 +7856,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -8492,21 +7914,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -8528,110 +7955,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_cgroup_login_input.def"
-#define STRUCT_SUM 0x4774836d
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_query_output.def"
+#define STRUCT_SUM 0x62517485
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -8877,71 +8282,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_gpu_metrics.def"
-#define STRUCT_SUM 0xdb569bbb
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -8950,8 +8300,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -8967,62 +8327,94 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
-    // If the buffer is null or zero length, don't even bother trying to unpack it.
-    if( !(buffer && len && *offset <= len) ) 
-    {
-        *dest = NULL; 
-        return;
-    }
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
 
     #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
-    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
 
-    // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
     #include STRUCT_DEF
 
-    // Test the offeset against the length
-    if ( *offset <= len )
-    {
-        // If the version id is not equal to released version, test for initialization.
-        if ( version_id < CSM_VERSION_ID )
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
         {
             #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
                 INIT_##serial_type(name, init_value, length_member)
@@ -9034,110 +8426,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_mcast_context.def"
-#define STRUCT_SUM 0x12421ecd
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_query_details_input.def"
+#define STRUCT_SUM 0xf6d23071
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -9383,71 +8753,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_mcast_payload_request.def"
-#define STRUCT_SUM 0xcf6373b0
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -9456,8 +8771,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -9473,24 +8798,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -9504,21 +8856,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -9540,101 +8897,10912 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_query_active_all_input.def"
+#define STRUCT_SUM 0xc00191cd
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_node_resources_query_input.def"
+#define STRUCT_SUM 0x49606b4a
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_node_resources_query_output.def"
+#define STRUCT_SUM 0xf451998b
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_node_resources_query_all_input.def"
+#define STRUCT_SUM 0x7296a9d1
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_node_resources_query_all_output.def"
+#define STRUCT_SUM 0xfa34fef2
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_cgroup_create_input.def"
+#define STRUCT_SUM 0x11619b09
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_step_cgroup_delete_input.def"
+#define STRUCT_SUM 0x0ed19130
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_resources_query_input.def"
+#define STRUCT_SUM 0x06d0c617
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_resources_query_output.def"
+#define STRUCT_SUM 0x423ea695
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_update_history_input.def"
+#define STRUCT_SUM 0x1e280ea5
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_query_input.def"
+#define STRUCT_SUM 0xb5e80ccc
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_query_output.def"
+#define STRUCT_SUM 0xce8c3f6c
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_query_active_all_input.def"
+#define STRUCT_SUM 0xe891ea52
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_query_active_all_output.def"
+#define STRUCT_SUM 0xa7a53b58
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_allocation_delete_input.def"
+#define STRUCT_SUM 0x123c30f6
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_cgroup_login_input.def"
+#define STRUCT_SUM 0x4774836d
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_gpu_metrics.def"
+#define STRUCT_SUM 0xdb569bbb
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_mcast_context.def"
+#define STRUCT_SUM 0x12421ecd
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_mcast_payload_request.def"
+#define STRUCT_SUM 0xcf6373b0
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_mcast_payload_response.def"
+#define STRUCT_SUM 0x6a94218c
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_step_mcast_context.def"
+#define STRUCT_SUM 0xebdbd907
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_step_mcast_payload.def"
+#define STRUCT_SUM 0xb2dd7599
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
+#undef STRUCT_DEF
+#undef STRUCT_SUM
+#undef CSMI_STRUCT_NAME
+
+
+
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_jsrun_cmd_payload.def"
+#define STRUCT_SUM 0x81258bd8
+#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
+#define CSMI_VERSION_START(version)
+#define CSMI_VERSION_END(hash)
+#include STRUCT_DEF
+LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return 0;
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;
+    #endif
+
+    uint32_t len = 0;
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        LEN_##serial_type(type, name, length_member, metadata);                              
+    
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    return len;
+}
+
+PACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the target is null, don't even bother trying to pack it.
+    if(!target) return;
+
+    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
+    uint32_t size_dump = 0;           //< A dump variable to store sizes.
+    #endif
+    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
+    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
+    uint32_t i = 0;                   //< A counter variable.
+    #endif
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        PACK_##serial_type(type, name, length_member, metadata);                         
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+}
+
+SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
+                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = NULL;              //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                 //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Allocate the buffer.
+        buffer = (char*) calloc(len, sizeof(char));
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
+        ret_code = offset == len ? 2 : 0;
+        
+        // Save the final values.
+        *buffer_len = len; 
+        *buf        = buffer;
+    }
+    else
+    {
+        *buffer_len = 0;
+        *buf = NULL;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+UNPACK_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
+        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    // If the destination is not defined or the buffer doesn't contain the struct count return.
+    if( !dest || buffer_len < UINT32_T_SIZE )
+    {
+        if(dest) *dest = NULL;
+        return 1;
+    }
+
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+
+    // Retrieve the magic bytes from the front of the struct.
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    // Extract the version id of the struct.
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    // The number of elements always leads the buffer.
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+    
+    // Verify the buffer has any structs AND the struct sum is valid.
+    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+    {
+        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+    }
+    else
+    {
+        *dest = NULL;
+        return 1;
+    }
+    
+    // Fail buffer overflows.
+    if(offset > buffer_len)
+    {
+        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
         return 1;
     }
 
-    // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    // Cache the version id in the metadata field.
+    if ( *dest ) (*dest)->_metadata = version_id;
+
+    return 0;
+}
+
+FREE_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return;    //< If the target is null return.
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
+        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
+    uint32_t i = 0;             //< A counter variable.
+    #endif
+
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        FREE_##serial_type(type, name, length_member, metadata)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
+    #include STRUCT_DEF
+}
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
-    return 0;
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
 }
 
-FREE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
 
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
 
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
 }
 
-INIT_FUNCT(CSMI_STRUCT_NAME)
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
+    if( !dest ) return 1;
+    *dest = NULL;
 
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
 }
 #undef STRUCT_DEF
 #undef STRUCT_SUM
@@ -9642,8 +19810,8 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_mcast_payload_response.def"
-#define STRUCT_SUM 0x6a94218c
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_jsrun_cmd_input.def"
+#define STRUCT_SUM 0x3421b09a
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -9889,14 +20057,232 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
+
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
+{
+    const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
+    uint32_t size = 1;                        //< The number of elements being serialized.
+    uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
+
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
+    int      ret_code = 0;
+
+    // If the version id is above the MIN Version
+    if ( version_id >= CSM_MIN_VERSION ) 
+    {
+        // Get the buffer length. 
+        len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
+
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
+    
+        //Add the magic bytes to the front of the struct.
+        memcpy( buffer, &struct_magic, sizeof(uint64_t) );
+        offset = sizeof(uint64_t);
+
+        // Copy the version info of the struct.
+        memcpy(buffer+offset, &version_id, UINT64_T_SIZE);
+        offset += UINT64_T_SIZE;
+
+        // Copy the buffer starting with the number of structs present.
+        memcpy(buffer + offset, &size, UINT32_T_SIZE);
+        offset += UINT32_T_SIZE;
+        
+        CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
+
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
+        
+        *buffer_len = len; 
+    }
+    else
+    {
+        *buffer_len = 0;
+        ret_code = 1;
+    }
+
+    return ret_code;
+}
+
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // If the buffer is null or zero length, don't even bother trying to unpack it.
+    if( !(buffer && len && *offset <= len) ) 
+    {
+        *dest = NULL; 
+        return;
+    }
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
+
+    // Unpack IFF the field has been prepared, else initialize to the default.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    // Test the offeset against the length
+    if ( *offset <= len )
+    {
+        // If the version id is not equal to released version, test for initialization.
+        if ( version_id < CSM_VERSION_ID )
+        {
+            #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+                INIT_##serial_type(name, init_value, length_member)
+
+            #define CSMI_VERSION_START(version) if ( version_id < version ) {
+            #define CSMI_VERSION_END(hash) }
+            #include STRUCT_DEF
+        }
+    }
+    else
+    {
+        // The memory is released with the arena.
+        target = NULL;
+    }
+
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
+    uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
+    uint32_t offset        = 0;  //< The offset for the buffer.
+    uint32_t structs_found = 0;  //< The number of structs found in the serialization.
+    uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
+
+    memcpy( &struct_magic, buffer, sizeof(uint64_t) );
+    offset = sizeof(uint64_t);
+
+    memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
+    offset += UINT64_T_SIZE;
+
+    memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
+    offset += UINT32_T_SIZE;
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
+    {
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
+    }
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
+    {
+        return 1;
+    }
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
+    // Fail buffer overflows.
+    if( offset > buffer_len || !*dest )
+    {
+        if ( !arena ) free( block.base );
+        *dest = NULL;
+        return 1;
+    }
+
+    // Cache the version id in the metadata field.
+    (*dest)->_metadata = version_id;
+
+    return 0;
+}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_step_mcast_context.def"
-#define STRUCT_SUM 0xebdbd907
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_soft_failure_recovery_payload.def"
+#define STRUCT_SUM 0x466f4649
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -10142,71 +20528,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_allocation_step_mcast_payload.def"
-#define STRUCT_SUM 0xb2dd7599
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -10215,8 +20546,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -10232,24 +20573,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -10263,21 +20631,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -10299,110 +20672,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_jsrun_cmd_payload.def"
-#define STRUCT_SUM 0x81258bd8
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_soft_failure_recovery_node.def"
+#define STRUCT_SUM 0xb75fca32
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -10633,86 +20984,31 @@ FREE_FUNCT(CSMI_STRUCT_NAME)
     #include STRUCT_DEF
 }
 
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_jsrun_cmd_input.def"
-#define STRUCT_SUM 0x3421b09a
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
+INIT_FUNCT(CSMI_STRUCT_NAME)
+{
+    if (!target) return; //< If the target is null return. TODO Error throwing.
+    
+    // Get the version the user is supplying.
+    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
 
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
+    
+    // Initialize the members.
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
+        INIT_##serial_type(name, init_value, length_member)
+    #define CSMI_VERSION_START(version) if (version_id >= version ) {
+    #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -10721,8 +21017,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -10738,24 +21044,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -10769,21 +21102,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -10805,110 +21143,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csmi_soft_failure_recovery_payload.def"
-#define STRUCT_SUM 0x466f4649
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_soft_failure_recovery_input.def"
+#define STRUCT_SUM 0xb7c1a2ea
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -11154,71 +21470,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_soft_failure_recovery_node.def"
-#define STRUCT_SUM 0xb75fca32
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -11227,8 +21488,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -11244,24 +21515,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -11275,21 +21573,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -11311,110 +21614,88 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
-        target = NULL;
-    }
-
-    *dest = target;
-}
-
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
-{
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
+        // The memory is released with the arena.
+        target = NULL;
     }
 
+    *dest = target;
+}
+
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
+{
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
 
 
 
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_soft_failure_recovery_input.def"
-#define STRUCT_SUM 0xb7c1a2ea
+#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_soft_failure_recovery_output.def"
+#define STRUCT_SUM 0x14a422c9
 #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
 #define CSMI_VERSION_START(version)
 #define CSMI_VERSION_END(hash)
@@ -11660,71 +21941,16 @@ INIT_FUNCT(CSMI_STRUCT_NAME)
     #define CSMI_VERSION_END(hash) } 
     #include STRUCT_DEF
 }
-#undef STRUCT_DEF
-#undef STRUCT_SUM
-#undef CSMI_STRUCT_NAME
-
-
-
-#define STRUCT_DEF "csmi/include/csm_types/struct_defs/wm/csm_soft_failure_recovery_output.def"
-#define STRUCT_SUM 0x14a422c9
-#define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)
-#define CSMI_VERSION_START(version)
-#define CSMI_VERSION_END(hash)
-#include STRUCT_DEF
-LEN_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return 0;
-
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
-    uint32_t i = 0;
-    #endif
-
-    uint32_t len = 0;
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        LEN_##serial_type(type, name, length_member, metadata);                              
-    
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    return len;
-}
-
-PACK_FUNCT(CSMI_STRUCT_NAME)
-{
-    // EARLY RETURN!
-    // If the target is null, don't even bother trying to pack it.
-    if(!target) return;
-
-    #if CSMI_STRING || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT || CSMI_ARRAY
-    uint32_t size_dump = 0;           //< A dump variable to store sizes.
-    #endif
-    #if CSMI_ARRAY ||  CSMI_ARRAY_FIXED || CSMI_ARRAY_STR || \
-    CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED  
-    uint32_t i = 0;                   //< A counter variable.
-    #endif
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        PACK_##serial_type(type, name, length_member, metadata);                         
-
-    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
-    #define CSMI_VERSION_END(hash) }
-    #include STRUCT_DEF
-}
 
-SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+SERIALIZE_BUFFER_FUNCT(CSMI_STRUCT_NAME)
 {
     const uint64_t struct_magic = STRUCT_SUM; //< The md5 sum of the struct, used for authentication.
     uint32_t size = 1;                        //< The number of elements being serialized.
     uint64_t version_id  = target->_metadata; //< The metadata object for the struct.
-    uint32_t len  = sizeof(uint64_t) + UINT32_T_SIZE + 
-                            UINT64_T_SIZE;   //< Length of the buffer, start with size offset.
+    uint32_t len  = CSMI_SERIAL_HEADER_LEN;   //< Length of the buffer, start with size offset.
 
-    char    *buffer = NULL;              //< The buffer that will hold the packing results.
-    uint32_t offset = 0;                 //< The offset of the pack so far.
+    char    *buffer = *buf;                   //< The buffer that will hold the packing results.
+    uint32_t offset = 0;                      //< The offset of the pack so far.
     int      ret_code = 0;
 
     // If the version id is above the MIN Version
@@ -11733,8 +21959,18 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         // Get the buffer length. 
         len += CSM_FUNCT_CAT( len_, CSMI_STRUCT_NAME )(target, version_id);
 
-        // Allocate the buffer.
-        buffer = (char*) calloc(len, sizeof(char));
+        // Only grow the buffer if the struct doesn't fit, every byte gets overwritten.
+        if ( !buffer || len > *buffer_capacity )
+        {
+            buffer = (char*) realloc(buffer, len);
+            if ( !buffer )
+            {
+                *buffer_len = 0;
+                return 1;
+            }
+            *buf             = buffer;
+            *buffer_capacity = len;
+        }
     
         //Add the magic bytes to the front of the struct.
         memcpy( buffer, &struct_magic, sizeof(uint64_t) );
@@ -11750,24 +21986,51 @@ SERIALIZE_FUNCT(CSMI_STRUCT_NAME)
         
         CSM_FUNCT_CAT( pack_, CSMI_STRUCT_NAME )(target, buffer, &offset, len, version_id);
 
-        // If the offset exceeds the length and somehow didn't seg fault throw an exception, update the ret_code.
-        ret_code = offset == len ? 2 : 0;
+        // The pack has to fill the buffer exactly.
+        ret_code = offset == len ? 0 : 2;
         
-        // Save the final values.
         *buffer_len = len; 
-        *buf        = buffer;
     }
     else
     {
         *buffer_len = 0;
-        *buf = NULL;
         ret_code = 1;
     }
 
     return ret_code;
 }
 
-UNPACK_FUNCT(CSMI_STRUCT_NAME)
+ARENA_LEN_FUNCT(CSMI_STRUCT_NAME)
+{
+    // EARLY RETURN!
+    // Mirrors the early return of the arena unpack.
+    if( !(buffer && len && *offset <= len) ) return 0;
+
+    #if CSMI_STRING || CSMI_ARRAY || CSMI_ARRAY_STR || CSMI_STRUCT || CSMI_ARRAY_STRUCT 
+    uint32_t size_dump = 0;             //< A dump variable to store sizes.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    uint32_t i = 0;                     //< A counter variable.
+    #endif
+
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
+    uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
+    #endif
+
+    uint64_t arena_len = CSMI_ARENA_ROUND(sizeof(CSMI_STRUCT_NAME));
+
+    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
+        ARENA_LEN_##serial_type(type, name, length_member, metadata);
+
+    #define CSMI_VERSION_START(version) if ( version_id >= version ) {
+    #define CSMI_VERSION_END(hash) }
+    #include STRUCT_DEF
+
+    return arena_len;
+}
+
+UNPACK_ARENA_FUNCT(CSMI_STRUCT_NAME)
 {
     // EARLY RETURN!
     // If the buffer is null or zero length, don't even bother trying to unpack it.
@@ -11781,21 +22044,26 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     uint32_t size_dump = 0;             //< A dump variable to store sizes.
     #endif
 
-    #if CSMI_ARRAY || CSMI_ARRAY_FIXED || CSMI_ARRAY_STR ||\
-        CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || CSMI_ARRAY_STRUCT || CSMI_ARRAY_STRUCT_FIXED
     uint32_t i = 0;                     //< A counter variable.
     #endif
 
-    #if CSMI_ARRAY_STR  || ARRAY_STR_FIXED
+    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED
     uint32_t str_offset = 0;            //< An additional offset for a string in a loop.
     #endif
 
     CSMI_STRUCT_NAME *target;  //< The destination,the target will be unpacked to.
-    target = (CSMI_STRUCT_NAME*) calloc(1, sizeof(CSMI_STRUCT_NAME));
+    target = (CSMI_STRUCT_NAME*) csmi_arena_alloc(arena, sizeof(CSMI_STRUCT_NAME));
+    if ( !target )
+    {
+        *dest = NULL;
+        *offset = len + 2;
+        return;
+    }
 
     // Unpack IFF the field has been prepared, else initialize to the default.
     #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        UNPACK_##serial_type(type, name, length_member, metadata);
+        UNPACK_ARENA_##serial_type(type, name, length_member, metadata);
 
     #define CSMI_VERSION_START(version) if ( version_id >= version ) {
     #define CSMI_VERSION_END(hash) }
@@ -11817,102 +22085,80 @@ UNPACK_FUNCT(CSMI_STRUCT_NAME)
     }
     else
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, target);
+        // The memory is released with the arena.
         target = NULL;
     }
 
     *dest = target;
 }
 
-DESERIALIZE_FUNCT(CSMI_STRUCT_NAME)
+ARENA_SIZE_FUNCT(CSMI_STRUCT_NAME)
 {
-    // If the destination is not defined or the buffer doesn't contain the struct count return.
-    if( !dest || buffer_len < UINT32_T_SIZE )
-    {
-        if(dest) *dest = NULL;
-        return 1;
-    }
-
     uint64_t struct_magic  = 0;  //< The md5 sum of the struct, used for authentication.
     uint32_t offset        = 0;  //< The offset for the buffer.
     uint32_t structs_found = 0;  //< The number of structs found in the serialization.
     uint64_t version_id    = 0;  //< The version of the supplied struct.
+    uint64_t arena_len     = 0;  //< The size of the arena.
+
+    if( !buffer || buffer_len < CSMI_SERIAL_HEADER_LEN ) return 0;
 
-    // Retrieve the magic bytes from the front of the struct.
     memcpy( &struct_magic, buffer, sizeof(uint64_t) );
     offset = sizeof(uint64_t);
 
-    // Extract the version id of the struct.
     memcpy(&version_id, buffer + offset, UINT64_T_SIZE);
     offset += UINT64_T_SIZE;
 
-    // The number of elements always leads the buffer.
     memcpy(&structs_found, buffer + offset, UINT32_T_SIZE);
     offset += UINT32_T_SIZE;
-    
-    // Verify the buffer has any structs AND the struct sum is valid.
-    if (structs_found == 1 && struct_magic == STRUCT_SUM)
+
+    if ( structs_found != 1 || struct_magic != STRUCT_SUM ) return 0;
+
+    arena_len = CSM_FUNCT_CAT( arena_len_, CSMI_STRUCT_NAME )( buffer, &offset, buffer_len, version_id);
+
+    return offset <= buffer_len ? arena_len : 0;
+}
+
+DESERIALIZE_ARENA_FUNCT(CSMI_STRUCT_NAME)
+{
+    if( !dest ) return 1;
+    *dest = NULL;
+
+    uint32_t offset     = CSMI_SERIAL_HEADER_LEN;  //< The offset for the buffer.
+    uint64_t version_id = 0;                       //< The version of the supplied struct.
+    csmi_arena_t block;                            //< The block the struct is unpacked to.
+
+    // Validates the header and walks the buffer once to size the arena.
+    block.size = CSM_FUNCT_CAT( arena_size_, CSMI_STRUCT_NAME )( buffer, buffer_len );
+    block.used = 0;
+    if ( block.size == 0 || ( arena && arena_size < block.size ) ) return 1;
+
+    if ( arena )
     {
-        CSM_FUNCT_CAT( unpack_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id);
+        block.base = (char*) arena;
+        memset( block.base, 0, block.size );
     }
-    else
+    else if ( !( block.base = (char*) calloc( 1, block.size ) ) )
     {
-        *dest = NULL;
         return 1;
     }
-    
+
+    memcpy(&version_id, buffer + sizeof(uint64_t), UINT64_T_SIZE);
+
+    CSM_FUNCT_CAT( unpack_arena_, CSMI_STRUCT_NAME )( dest, buffer, &offset, buffer_len, version_id, &block);
+
     // Fail buffer overflows.
-    if(offset > buffer_len)
+    if( offset > buffer_len || !*dest )
     {
-        csm_free_struct_ptr(CSMI_STRUCT_NAME, *dest);
+        if ( !arena ) free( block.base );
+        *dest = NULL;
         return 1;
     }
 
     // Cache the version id in the metadata field.
-    if ( *dest ) (*dest)->_metadata = version_id;
+    (*dest)->_metadata = version_id;
 
     return 0;
 }
-
-FREE_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return;    //< If the target is null return.
-    #if CSMI_ARRAY_STR || CSMI_ARRAY_STR_FIXED || \
-        CSMI_ARRAY_STRUCT_FIXED || CSMI_ARRAY_STRUCT
-    uint32_t i = 0;             //< A counter variable.
-    #endif
-
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_ARRAY_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata) \
-        FREE_##serial_type(type, name, length_member, metadata)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
-
-INIT_FUNCT(CSMI_STRUCT_NAME)
-{
-    if (!target) return; //< If the target is null return. TODO Error throwing.
-    
-    // Get the version the user is supplying.
-    uint64_t version_id    = target->_metadata <= CSM_VERSION_ID ? target->_metadata : CSM_MIN_VERSION;
-
-    
-    // Initialize the members.
-    #define CSMI_STRUCT_MEMBER(type, name, serial_type, length_member, init_value, metadata)\
-        INIT_##serial_type(name, init_value, length_member)
-    #define CSMI_VERSION_START(version) if (version_id >= version ) {
-    #define CSMI_VERSION_END(hash) } 
-    #include STRUCT_DEF
-}
 #undef STRUCT_DEF
 #undef STRUCT_SUM
 #undef CSMI_STRUCT_NAME
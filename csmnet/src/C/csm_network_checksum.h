@@ -0,0 +1,227 @@
+/*================================================================================
+
+    csmnet/src/C/csm_network_checksum.h
+
+  © Copyright IBM Corporation 2015-2019. All Rights Reserved
+
+    This program is licensed under the terms of the Eclipse Public License
+    v1.0 as published by the Eclipse Foundation and available at
+    http://www.eclipse.org/legal/epl-v10.html
+
+    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+    restricted by GSA ADP Schedule Contract with IBM Corp.
+
+================================================================================*/
+
+#ifndef CSM_NETWORK_SRC_C_CSM_NETWORK_CHECKSUM_H_
+#define CSM_NETWORK_SRC_C_CSM_NETWORK_CHECKSUM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined( __x86_64__ )
+#include <immintrin.h>
+#elif defined( __VSX__ )
+#include <altivec.h>
+#undef bool
+#undef vector
+#undef pixel
+#endif
+
+/** @file csm_network_checksum.h
+ * @brief checksum kernels for the csm network message header
+ *
+ * The legacy checksum is a plain xor of all 32bit words, so wide vector
+ * registers can be used without changing the result. The best variant
+ * for the running cpu is picked at runtime.
+ */
+
+/** @brief checksum algorithm of a message
+ *
+ * CSM_CHECKSUM_XOR is the wire format understood by every peer.
+ * Any other type is only used on connections where both peers announced support during
+ * the version handshake.
+ */
+typedef enum {
+  CSM_CHECKSUM_XOR = 0,
+  CSM_CHECKSUM_CRC32C = 1,
+  CSM_CHECKSUM_TYPE_MAX
+} csm_checksum_type_t;
+
+/** @def CSM_CHECKSUM_CAPABILITY
+ * @brief bit to announce support of a checksum type in the version handshake
+ */
+#define CSM_CHECKSUM_CAPABILITY( type ) ( 1u << (type) )
+
+// small buffers are not worth the setup of the vector loop
+#define CSM_CHECKSUM_VECTOR_MIN_WORDS ( 32 )
+
+static inline
+uint32_t csm_checksum_xor32_scalar( const char *aBuf, size_t aWords )
+{
+  uint32_t ChkSum = 0;
+  uint32_t word;
+  size_t i;
+  for( i=0; i < aWords; ++i )
+  {
+    memcpy( &word, aBuf + i * sizeof( uint32_t ), sizeof( uint32_t ) );
+    ChkSum ^= word;
+  }
+  return ChkSum;
+}
+
+#if defined( __x86_64__ )
+
+static inline
+uint32_t csm_checksum_fold128( __m128i aVal )
+{
+  aVal = _mm_xor_si128( aVal, _mm_srli_si128( aVal, 8 ) );
+  aVal = _mm_xor_si128( aVal, _mm_srli_si128( aVal, 4 ) );
+  return (uint32_t)_mm_cvtsi128_si32( aVal );
+}
+
+static inline
+uint32_t csm_checksum_xor32_sse2( const char *aBuf, size_t aWords )
+{
+  __m128i acc0 = _mm_setzero_si128();
+  __m128i acc1 = _mm_setzero_si128();
+  size_t blocks = aWords / 8;
+  size_t i;
+  for( i=0; i < blocks; ++i )
+  {
+    acc0 = _mm_xor_si128( acc0, _mm_loadu_si128( (const __m128i*)( aBuf + i * 32 ) ) );
+    acc1 = _mm_xor_si128( acc1, _mm_loadu_si128( (const __m128i*)( aBuf + i * 32 + 16 ) ) );
+  }
+  return csm_checksum_fold128( _mm_xor_si128( acc0, acc1 ) )
+      ^ csm_checksum_xor32_scalar( aBuf + blocks * 32, aWords - blocks * 8 );
+}
+
+__attribute__((target("avx2")))
+static inline
+uint32_t csm_checksum_xor32_avx2( const char *aBuf, size_t aWords )
+{
+  __m256i acc0 = _mm256_setzero_si256();
+  __m256i acc1 = _mm256_setzero_si256();
+  size_t blocks = aWords / 16;
+  size_t i;
+  for( i=0; i < blocks; ++i )
+  {
+    acc0 = _mm256_xor_si256( acc0, _mm256_loadu_si256( (const __m256i*)( aBuf + i * 64 ) ) );
+    acc1 = _mm256_xor_si256( acc1, _mm256_loadu_si256( (const __m256i*)( aBuf + i * 64 + 32 ) ) );
+  }
+  acc0 = _mm256_xor_si256( acc0, acc1 );
+  __m128i val = _mm_xor_si128( _mm256_castsi256_si128( acc0 ), _mm256_extracti128_si256( acc0, 1 ) );
+  return csm_checksum_fold128( val )
+      ^ csm_checksum_xor32_scalar( aBuf + blocks * 64, aWords - blocks * 16 );
+}
+
+#elif defined( __VSX__ )
+
+static inline
+uint32_t csm_checksum_xor32_vsx( const char *aBuf, size_t aWords )
+{
+  __vector unsigned int acc0 = vec_splats( (unsigned int)0 );
+  __vector unsigned int acc1 = vec_splats( (unsigned int)0 );
+  size_t blocks = aWords / 8;
+  size_t i;
+  for( i=0; i < blocks; ++i )
+  {
+    acc0 = vec_xor( acc0, vec_xl( 0, (const unsigned int*)( aBuf + i * 32 ) ) );
+    acc1 = vec_xor( acc1, vec_xl( 16, (const unsigned int*)( aBuf + i * 32 ) ) );
+  }
+  acc0 = vec_xor( acc0, acc1 );
+  return ( acc0[0] ^ acc0[1] ^ acc0[2] ^ acc0[3] )
+      ^ csm_checksum_xor32_scalar( aBuf + blocks * 32, aWords - blocks * 8 );
+}
+
+#endif
+
+/** @brief xor of aWords unaligned 32bit words starting at aBuf
+ *
+ * @param aBuf     pointer to the data
+ * @param aWords   number of complete 32bit words to include
+ *
+ * @return xor of all words, 0 for an empty buffer
+ */
+static inline
+uint32_t csm_checksum_xor32( const char *aBuf, size_t aWords )
+{
+  if( aWords < CSM_CHECKSUM_VECTOR_MIN_WORDS )
+    return csm_checksum_xor32_scalar( aBuf, aWords );
+#if defined( __x86_64__ )
+  if( __builtin_cpu_supports( "avx2" ) )
+    return csm_checksum_xor32_avx2( aBuf, aWords );
+  return csm_checksum_xor32_sse2( aBuf, aWords );
+#elif defined( __VSX__ )
+  return csm_checksum_xor32_vsx( aBuf, aWords );
+#else
+  return csm_checksum_xor32_scalar( aBuf, aWords );
+#endif
+}
+
+
+#define CSM_CRC32C_POLY ( 0x82F63B78 )
+
+static inline
+uint32_t csm_crc32c_sw( uint32_t aCrc, const char *aBuf, size_t aLen )
+{
+  static uint32_t table[ 256 ];
+  static volatile int table_ready = 0;
+  size_t i;
+  if( ! table_ready )
+  {
+    uint32_t n, k;
+    for( n=0; n < 256; ++n )
+    {
+      uint32_t c = n;
+      for( k=0; k < 8; ++k )
+        c = ( c & 1 ) ? ( c >> 1 ) ^ CSM_CRC32C_POLY : ( c >> 1 );
+      table[ n ] = c;
+    }
+    __sync_synchronize();
+    table_ready = 1;
+  }
+  for( i=0; i < aLen; ++i )
+    aCrc = table[ ( aCrc ^ (uint8_t)aBuf[ i ] ) & 0xFF ] ^ ( aCrc >> 8 );
+  return aCrc;
+}
+
+#if defined( __x86_64__ )
+__attribute__((target("sse4.2")))
+static inline
+uint32_t csm_crc32c_sse42( uint32_t aCrc, const char *aBuf, size_t aLen )
+{
+  uint64_t crc = aCrc;
+  uint64_t word;
+  size_t i = 0;
+  for( ; i + 8 <= aLen; i += 8 )
+  {
+    memcpy( &word, aBuf + i, sizeof( uint64_t ) );
+    crc = _mm_crc32_u64( crc, word );
+  }
+  for( ; i < aLen; ++i )
+    crc = _mm_crc32_u8( (uint32_t)crc, (uint8_t)aBuf[ i ] );
+  return (uint32_t)crc;
+}
+#endif
+
+/** @brief continues a crc32c (Castagnoli) over aLen bytes
+ *
+ * @param aCrc   crc of the previous data (pre-inverted start value 0xFFFFFFFF)
+ * @param aBuf   pointer to the data
+ * @param aLen   number of bytes
+ *
+ * @return updated crc without final inversion
+ */
+static inline
+uint32_t csm_crc32c_update( uint32_t aCrc, const char *aBuf, size_t aLen )
+{
+#if defined( __x86_64__ )
+  if( __builtin_cpu_supports( "sse4.2" ) )
+    return csm_crc32c_sse42( aCrc, aBuf, aLen );
+#endif
+  return csm_crc32c_sw( aCrc, aBuf, aLen );
+}
+
+#endif /* CSM_NETWORK_SRC_C_CSM_NETWORK_CHECKSUM_H_ */
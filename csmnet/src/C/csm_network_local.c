@@ -1018,6 +1018,14 @@ ssize_t FillReceiveBuffer( csm_net_unix_t *aEP, csmi_cmd_t cmd, const int partia
         }
     };
 
+    // messages always carry a header, so an empty read without error means
+    // the socket was shut down for reading (see csm_term_lib)
+    if(( rlen == 0 ) && ( stored_errno == 0 ))
+    {
+      errno = ENOTCONN;
+      return -1;
+    }
+
     switch( msg.msg_flags )
     {
         case MSG_TRUNC:
@@ -1156,8 +1164,10 @@ csm_net_msg_t * csm_net_unix_RecvMain(
         // any errors or nothing received?
         if( rlen < 0 )
         {
+            int stored_errno = errno;
             csmutil_logging( error, "RECEIVE ERROR. rlen=%d", rlen );
             BufferStateReset( aEP );
+            errno = stored_errno;
             return NULL;
         }
 
@@ -24,6 +24,7 @@
 #include <sys/socket.h>
 
 #include "csm_network_header.h"
+#include "csm_network_checksum.h"
 
 
 
@@ -78,7 +79,7 @@
 #define CSM_PAYLOAD_LIMIT ( DGRAM_PAYLOAD_MAX - sizeof( csm_network_header_t ) - CSM_UNIX_CREDENTIAL_LENGTH )
 
 
-/** @brief calculates the header checksum over header and data
+/** @brief calculates the header checksum over header and data with the selected algorithm
  *
  * Checksum is calculated over header and data section of the
  * message (excluding the checksum field).
@@ -87,50 +88,83 @@
  *
  * @param aHeader   pointer to header of message
  * @param aData     pointer to data buffer
+ * @param aType     checksum algorithm, see csm_checksum_type_t
  *
  * @return checksum integer
  * @return 0 in case of any errors
  */
 static inline
-uint32_t csm_header_check_sum( csm_network_header_t const *aHeader,
-                               char const *aData )
+uint32_t csm_header_check_sum_type( csm_network_header_t const *aHeader,
+                                    char const *aData,
+                                    const csm_checksum_type_t aType )
 {
   if( ! aHeader ) return 0;
   if( ( aHeader->_DataLen > 0 ) && ( !aData ) ) return 0;
 
-  uint32_t *Pos = (uint32_t*)aHeader;
-
-  // preset to value of current chksum in header (will be removed by
-  // later xor to exclude any existing chksum value from calculation
-  uint32_t ChkSum = Pos[ offsetof(csm_network_header_t, _CheckSum) / sizeof( uint32_t ) ];
+  uint32_t ChkSum = 0;
   size_t DataLen = aHeader->_DataLen;
 
-  size_t i;
-  for( i=0; i < sizeof( csm_network_header_t ) / sizeof( uint32_t ); ++i )
-    ChkSum ^= Pos[i];
-
-  if( aData )
+  switch( aType )
   {
-    Pos = (uint32_t*)aData;
-    for( i=0; i<(DataLen / sizeof( uint32_t )); ++i )
-      ChkSum ^= Pos[i];
-
-    if( DataLen % sizeof( uint32_t ) )
+    case CSM_CHECKSUM_XOR:
     {
-      uint32_t endval = 0;
-      char *endchars = (char*)(&(Pos[ DataLen / sizeof( uint32_t ) ]));
-      for( i=0; i < (DataLen % sizeof( uint32_t )); ++i )
-        endval = (endval << 8) + (uint32_t)endchars[i];
-      ChkSum ^= endval;
+      // xor-ing the current chksum in again excludes it from the calculation
+      ChkSum = aHeader->_CheckSum;
+      ChkSum ^= csm_checksum_xor32( (char const*)aHeader, sizeof( csm_network_header_t ) / sizeof( uint32_t ) );
+
+      if( aData )
+      {
+        ChkSum ^= csm_checksum_xor32( aData, DataLen / sizeof( uint32_t ) );
+
+        if( DataLen % sizeof( uint32_t ) )
+        {
+          size_t i;
+          uint32_t endval = 0;
+          char const *endchars = aData + ( DataLen / sizeof( uint32_t ) ) * sizeof( uint32_t );
+          for( i=0; i < (DataLen % sizeof( uint32_t )); ++i )
+            endval = (endval << 8) + (uint32_t)endchars[i];
+          ChkSum ^= endval;
+        }
+      }
+      break;
     }
+    case CSM_CHECKSUM_CRC32C:
+    {
+      csm_network_header_t hdr = *aHeader;
+      hdr._CheckSum = 0;
+      uint32_t crc = csm_crc32c_update( 0xFFFFFFFF, (char const*)&hdr, sizeof( csm_network_header_t ) );
+      if( aData )
+        crc = csm_crc32c_update( crc, aData, DataLen );
+      ChkSum = ~crc;
+      break;
+    }
+    default:
+      return 0;
   }
 
   // prevent checksum being 0
-  if( ! ChkSum ) ChkSum = 0x2EB0C114;
+  if( ! ChkSum ) ChkSum = CSM_HEADER_CHECKSUM_MAGIC;
 
   return ChkSum;
 }
 
+/** @brief calculates the header checksum over header and data
+ *
+ * Uses the xor checksum that's understood by all peers.
+ *
+ * @param aHeader   pointer to header of message
+ * @param aData     pointer to data buffer
+ *
+ * @return checksum integer
+ * @return 0 in case of any errors
+ */
+static inline
+uint32_t csm_header_check_sum( csm_network_header_t const *aHeader,
+                               char const *aData )
+{
+  return csm_header_check_sum_type( aHeader, aData, CSM_CHECKSUM_XOR );
+}
+
 
 /** @brief validates the header content
  *
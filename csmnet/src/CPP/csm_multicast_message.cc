@@ -14,56 +14,121 @@
 ================================================================================*/
 #include "csm_multicast_message.h"
 
-#include <boost/algorithm/string/split.hpp>
-#include <boost/algorithm/string/trim.hpp>
-#include <boost/algorithm/string/classification.hpp>
+#include <string.h>
 
 namespace csm {
 namespace network {
 
+#define MULTICAST_RANGE_MAX_DIGITS ( 9 )   // largest number of digits that fits a uint32_t
+
+// size of the fixed fields of a range: prefix length, digits, first, count
+#define MULTICAST_RANGE_HDR_LEN ( 2 * sizeof(uint8_t) + 2 * sizeof(uint32_t) )
+
+// split a node name into prefix and numeric suffix
+static void SplitNodeName( const std::string &name, size_t *prefix_len, uint8_t *digits, uint32_t *number )
+{
+  size_t pos = name.length();
+  while(( pos > 0 ) && ( name.length() - pos < MULTICAST_RANGE_MAX_DIGITS ) &&
+        ( name[ pos-1 ] >= '0' ) && ( name[ pos-1 ] <= '9' ))
+    --pos;
+
+  *prefix_len = pos;
+  *digits = (uint8_t)( name.length() - pos );
+  *number = 0;
+  for( size_t n = pos; n < name.length(); ++n )
+    *number = *number * 10 + ( name[n] - '0' );
+}
+
+// append the node list as range list, returns false if a name can't be represented
+static bool EncodeNodeRanges( const std::vector<std::string> &node_list, std::string &out )
+{
+  out.push_back( CSM_MULTICAST_RANGE_LIST_MARKER );
+
+  size_t range = std::string::npos;  // offset of the last range
+  for( auto &node : node_list )
+  {
+    size_t prefix_len;
+    uint8_t digits;
+    uint32_t number;
+    SplitNodeName( node, &prefix_len, &digits, &number );
+    if( prefix_len > UINT8_MAX )
+      return false;
+
+    // extend the last range if this is the next number with the same prefix
+    if(( range != std::string::npos ) && ( digits > 0 ))
+    {
+      const char *r = out.data() + range;
+      uint32_t first, count;
+      memcpy( &first, r + 2 + (uint8_t)r[0], sizeof(uint32_t) );
+      memcpy( &count, r + 2 + (uint8_t)r[0] + sizeof(uint32_t), sizeof(uint32_t) );
+      if(( (uint8_t)r[0] == prefix_len ) && ( (uint8_t)r[ 1 + prefix_len ] == digits ) &&
+         ( (uint64_t)first + count == number ) &&
+         ( memcmp( r + 1, node.data(), prefix_len ) == 0 ))
+      {
+        ++count;
+        out.replace( range + 2 + prefix_len + sizeof(uint32_t), sizeof(uint32_t), (const char*)&count, sizeof(uint32_t) );
+        continue;
+      }
+    }
+
+    range = out.length();
+    uint32_t count = 1;
+    out.push_back( (char)prefix_len );
+    out.append( node.data(), prefix_len );
+    out.push_back( (char)digits );
+    out.append( (const char*)&number, sizeof(uint32_t) );
+    out.append( (const char*)&count, sizeof(uint32_t) );
+  }
+  return true;
+}
+
 //Create a multi-cast message with a node list
 bool CreateMulticastMessage(const csm::network::Message &msg, const std::vector<std::string> &node_list,
             csm::network::Message& outMsg)
 {
+  std::string payload;
+  payload.reserve( sizeof(uint32_t) + node_list.size() * 4 + msg.GetData().length() );
+  payload.append( sizeof(uint32_t), '\0' );   // node list length, filled in below
 
-    // first, combine a list of nodes to a long string separated by ;
-    std::ostringstream oss;
-    std::copy( node_list.begin(), node_list.end(), std::ostream_iterator<std::string>(oss, ";") );
-
-    std::stringstream payload;
-    // write a 4 byte integer number for the node string length
-    uint32_t len = (uint32_t) (oss.str().length());
-    payload.write((const char *)&len, sizeof(uint32_t));
-    // write node list
-    payload << oss.str();
-    // write original payload
-    payload << msg.GetData();
-
-    // enable multicast flag
-    uint8_t flags = msg.GetFlags() | CSM_HEADER_MTC_BIT;
-
-    bool hdrvalid = outMsg.Init(msg.GetCommandType(),
-                        flags,
-                        msg.GetPriority(),
-                        msg.GetMessageID(),
-                        msg.GetSrcAddr(),
-                        msg.GetDstAddr(),
-                        msg.GetUserID(),
-                        msg.GetGroupID(),
-                        payload.str(),
-                        msg.GetReservedID());
-
-    if (!hdrvalid)
-    {
-      LOG(csmapi, error) << "CreateMultiCastMessage(): fail in Message.Init()...";
-      return false;
-    }
-    else return true;
+  if( ! EncodeNodeRanges( node_list, payload ) )
+  {
+    // fall back to a list of nodes separated by ;
+    payload.resize( sizeof(uint32_t) );
+    for( auto &node : node_list )
+      payload.append( node ).push_back( ';' );
+  }
+
+  // write a 4 byte integer number for the node string length
+  uint32_t len = (uint32_t) ( payload.length() - sizeof(uint32_t) );
+  payload.replace( 0, sizeof(uint32_t), (const char*)&len, sizeof(uint32_t) );
+  // write original payload
+  payload.append( msg.GetData() );
+
+  // enable multicast flag
+  uint8_t flags = msg.GetFlags() | CSM_HEADER_MTC_BIT;
+
+  bool hdrvalid = outMsg.Init(msg.GetCommandType(),
+                      flags,
+                      msg.GetPriority(),
+                      msg.GetMessageID(),
+                      msg.GetSrcAddr(),
+                      msg.GetDstAddr(),
+                      msg.GetUserID(),
+                      msg.GetGroupID(),
+                      payload,
+                      msg.GetReservedID());
+
+  if (!hdrvalid)
+  {
+    LOG(csmapi, error) << "CreateMultiCastMessage(): fail in Message.Init()...";
+    return false;
+  }
+  else return true;
 }
 
-int ExtractMulticastNodelist( const csm::network::Message &msg,
-                              std::vector< std::string > &node_list,
-                              uint32_t *node_string_len )
+int ForEachMulticastNode( const csm::network::Message &msg,
+                          const std::function<void( const std::string & )> &visit,
+                          uint32_t *node_string_len )
 {
   if (!msg.GetMulticast())
   {
@@ -71,32 +136,125 @@ int ExtractMulticastNodelist( const csm::network::Message &msg,
     return -1;
   }
 
-  std::string payload = msg.GetData();
-  const char *byte_payload = payload.c_str();
+  const std::string &payload = msg.GetData();
+  uint32_t len;
+  if( payload.length() < sizeof(uint32_t) )
+  {
+    LOG(csmapi, error) << "DecodeMultiCastMessage: payload too short";
+    return -1;
+  }
 
   // get the length of the node string list
-  memcpy(node_string_len, byte_payload, sizeof(uint32_t));
+  memcpy( &len, payload.data(), sizeof(uint32_t) );
+  if( len > payload.length() - sizeof(uint32_t) )
+  {
+    LOG(csmapi, error) << "DecodeMultiCastMessage: node list exceeds payload";
+    return -1;
+  }
+  if( node_string_len )
+    *node_string_len = len;
+
+  const char *pos = payload.data() + sizeof(uint32_t);
+  const char *end = pos + len;
+  std::string node;
+  int count = 0;
 
-  // tokenize the node string list
-  std::string node_list_str = payload.substr(sizeof(uint32_t), *node_string_len);
-  boost::trim_if(node_list_str, boost::is_any_of(";"));
-  boost::split(node_list, node_list_str, boost::is_any_of(";"), boost::token_compress_on);
+  if(( pos < end ) && ( *pos == CSM_MULTICAST_RANGE_LIST_MARKER ))
+  {
+    ++pos;
+    while( pos < end )
+    {
+      uint8_t prefix_len = (uint8_t)*pos;
+      if( (size_t)( end - pos ) < MULTICAST_RANGE_HDR_LEN + prefix_len )
+      {
+        LOG(csmapi, error) << "DecodeMultiCastMessage: truncated node range";
+        return -1;
+      }
+      uint8_t digits = (uint8_t)pos[ 1 + prefix_len ];
+      uint32_t first, range_count;
+      memcpy( &first, pos + 2 + prefix_len, sizeof(uint32_t) );
+      memcpy( &range_count, pos + 2 + prefix_len + sizeof(uint32_t), sizeof(uint32_t) );
 
-  return node_list.size();
+      for( uint32_t n = 0; n < range_count; ++n )
+      {
+        node.assign( pos + 1, prefix_len );
+        if( digits > 0 )
+        {
+          char number[ 16 ];
+          snprintf( number, sizeof( number ), "%0*u", (int)digits, first + n );
+          node.append( number );
+        }
+        visit( node );
+        ++count;
+      }
+      pos += MULTICAST_RANGE_HDR_LEN + prefix_len;
+    }
+  }
+  else
+  {
+    // tokenize the node string list
+    while( pos < end )
+    {
+      const char *sep = (const char*)memchr( pos, ';', end - pos );
+      if( sep == nullptr )
+        sep = end;
+      if( sep > pos )
+      {
+        node.assign( pos, sep - pos );
+        visit( node );
+        ++count;
+      }
+      pos = sep + 1;
+    }
+  }
+
+  return count;
 }
 
+int ExtractMulticastNodelist( const csm::network::Message &msg,
+                              std::vector< std::string > &node_list,
+                              uint32_t *node_string_len )
+{
+  return ForEachMulticastNode( msg,
+                               [&node_list]( const std::string &node ) { node_list.push_back( node ); },
+                               node_string_len );
+}
 
 bool DecodeMulticastMessage(const csm::network::Message &msg,
                             std::vector< std::string >& node_list, csm::network::Message &outMsg)
 {
-  uint32_t node_string_len;
-  int node_count = ExtractMulticastNodelist( msg, node_list, &node_string_len );
+  int node_count = ExtractMulticastNodelist( msg, node_list, nullptr );
 
   if( node_count < 0 )
     return false;
 
+  return DecodeMulticastMessage( msg, outMsg );
+}
+
+bool DecodeMulticastMessage(const csm::network::Message &msg, csm::network::Message &outMsg)
+{
+  if (!msg.GetMulticast())
+  {
+    LOG(csmapi, error) << "DecodeMultiCastMessage: MTC is not set";
+    return false;
+  }
+
+  const std::string &payload = msg.GetData();
+  uint32_t node_string_len;
+  if( payload.length() < sizeof(uint32_t) )
+  {
+    LOG(csmapi, error) << "DecodeMultiCastMessage: payload too short";
+    return false;
+  }
+  memcpy( &node_string_len, payload.data(), sizeof(uint32_t) );
+  if( node_string_len > payload.length() - sizeof(uint32_t) )
+  {
+    LOG(csmapi, error) << "DecodeMultiCastMessage: node list exceeds payload";
+    return false;
+  }
+
   // get the original payload after node string list
-  std::string real_payload = msg.GetData().substr( sizeof(uint32_t)+node_string_len );
+  std::string real_payload( payload, sizeof(uint32_t)+node_string_len );
 
   // clear out the multicast bit
   uint8_t flags = msg.GetFlags();
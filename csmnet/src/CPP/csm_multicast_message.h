@@ -18,14 +18,37 @@
 
 #include "csmnet/src/CPP/csm_network_msg_cpp.h"
 #include "logging.h"
+#include <functional>
 #include <vector>
 
 namespace csm {
 namespace network {
 
+/*
+ * The node list of a multicast message is stored in front of the original payload:
+ *   uint32_t length of the node list section
+ *   node list section
+ *
+ * The node list section is a range list, starting with a 0 byte:
+ *   per range: uint8_t prefix length, prefix, uint8_t digits, uint32_t first, uint32_t count
+ * A range covers count nodes named prefix + number, number printed with
+ * (zero-padded to) digits, starting at first. Names without a numeric suffix
+ * are stored with digits=0 and count=1.
+ *
+ * Node lists from older daemons are ';'-joined names and are still decoded.
+ */
+#define CSM_MULTICAST_RANGE_LIST_MARKER ( '\0' )
+
 bool CreateMulticastMessage(const csm::network::Message &msg, const std::vector<std::string> &node_list,
             csm::network::Message& outMsg);
 
+// call visit for each node of the multicast node list without creating a list
+// the string passed to visit is reused for the next node
+// returns the number of nodes or -1 if the message is not a valid multicast message
+int ForEachMulticastNode( const csm::network::Message &msg,
+                          const std::function<void( const std::string & )> &visit,
+                          uint32_t *node_string_len = nullptr );
+
 int ExtractMulticastNodelist( const csm::network::Message &msg,
                               std::vector< std::string > &node_list,
                               uint32_t *node_string_len );
@@ -33,6 +56,9 @@ int ExtractMulticastNodelist( const csm::network::Message &msg,
 bool DecodeMulticastMessage(const csm::network::Message &msg,
                             std::vector< std::string >& node_list, csm::network::Message &outMsg);
 
+// restore the original message without decoding the node list
+bool DecodeMulticastMessage(const csm::network::Message &msg, csm::network::Message &outMsg);
+
 } // namespace network
 } //namespace csm
 #endif
@@ -132,6 +132,7 @@ public:
 
   inline uint32_t GetCheckSum() const { return _Header._CheckSum; }
   inline uint32_t CheckSumCalculate() const { return csm_header_check_sum( &_Header, _Data.c_str() ); }
+  inline uint32_t CheckSumCalculate( const csm_checksum_type_t aType ) const { return csm_header_check_sum_type( &_Header, _Data.c_str(), aType ); }
   inline uint32_t CheckSumUpdate() { _Header._CheckSum = CheckSumCalculate(); return _Header._CheckSum; }
 
   inline uint32_t GetDataLen() const { return _Header._DataLen; }
@@ -93,7 +93,7 @@ csm::network::ExtractVersionEfix( const std::string &vStr )
 
 csm::network::VersionMsg::VersionMsg( const std::string v,
             const std::string h )
-: _Hostname( h ), _Sequence(0)
+: _Hostname( h ), _Sequence(0), _Checksums( CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_XOR ) )
 {
   SetVersion( v );
 }
@@ -125,3 +125,12 @@ csm::network::VersionMsg::Acceptable( const csm::network::VersionStruct &vStruct
    */
   return supported;
 }
+
+csm_checksum_type_t
+csm::network::VersionMsg::NegotiateChecksum( const csm::network::VersionStruct &vStruct ) const
+{
+  uint32_t common = _Checksums & vStruct._Checksums;
+  if( common & CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_CRC32C ) )
+    return CSM_CHECKSUM_CRC32C;
+  return CSM_CHECKSUM_XOR;
+}
@@ -27,6 +27,7 @@
 
 #include "csm_version.h"
 #include "csm_network_exception.h"
+#include "../C/csm_network_checksum.h"
 
 namespace csm {
 namespace network {
@@ -35,6 +36,7 @@ typedef struct {
   std::string _Version;
   std::string _Hostname;
   uint64_t _Sequence;
+  uint32_t _Checksums = CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_XOR );  ///< not part of serialize(), see ConvertToClass()
 
   template <class Archive>
   void serialize(Archive &ar, const unsigned int version)
@@ -55,6 +57,7 @@ class VersionMsg {
   std::string _Hostname;
   uint64_t _Sequence;
   unsigned _VersionNumbers[ 3 ];
+  uint32_t _Checksums;
 
   VersionMsg( const std::string v,
               const std::string h );
@@ -86,6 +89,10 @@ public:
     std::stringstream ss;
     boost::archive::text_oarchive oa(ss);
     oa << *msg;
+    // optional checksum capabilities go behind the object, older peers don't read that far
+    // (explicit member call, operator<< would be ambiguous with the address stream operators)
+    if( msg->_Checksums != CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_XOR ) )
+      oa.operator<<( msg->_Checksums );
     msg->Next();  // bump the sequence number each time we generate a string
     return ss.str();
   }
@@ -96,6 +103,16 @@ public:
     ss << i_payload;
     boost::archive::text_iarchive ia(ss);
     ia >> msg;
+    msg._Checksums = CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_XOR );
+    try
+    {
+      ia.operator>>( msg._Checksums );
+    }
+    catch( ... )
+    {
+      // peer doesn't support anything but xor
+    }
+    msg._Checksums |= CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_XOR );
   }
 
   inline std::string GetVersion() const { return _Version; }
@@ -104,6 +121,16 @@ public:
 
   inline void Next() { ++_Sequence; }
 
+  /** @brief Sets the checksum types announced to peers as bitmask of CSM_CHECKSUM_CAPABILITY()
+   *
+   * xor is always included. Connections use the strongest type supported by both sides.
+   */
+  inline void SetChecksumCapabilities( const uint32_t aCapabilities )
+  { _Checksums = aCapabilities | CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_XOR ); }
+  inline uint32_t GetChecksumCapabilities() const { return _Checksums; }
+
+  csm_checksum_type_t NegotiateChecksum( const csm::network::VersionStruct &vStruct ) const;
+
   bool operator==( const VersionMsg &msg )
   {
     return ( 0 == _Version.compare( msg._Version ) );
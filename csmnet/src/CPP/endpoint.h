@@ -150,6 +150,20 @@ public:
    */
   void SetVerified() { _Verified = true; }
 
+  /** \brief Set the checksum algorithm negotiated with the peer
+   *
+   * \param [in]  i_Type    checksum type to use for messages on this connection
+   *
+   * \note endpoints without support for other algorithms keep using CSM_CHECKSUM_XOR
+   */
+  virtual void SetChecksumType( const csm_checksum_type_t i_Type ) { }
+
+  /** \brief Return the checksum algorithm used on this connection
+   *
+   * \return checksum type of the messages on the wire
+   */
+  virtual csm_checksum_type_t GetChecksumType() const { return CSM_CHECKSUM_XOR; }
+
   /** \brief Return the address/endpoint type
    *
    * \return AddressType of the endpoint
@@ -16,12 +16,50 @@
 #ifndef CSM_NETWORK_SRC_CPP_ENDPOINT_BUFFER_H_
 #define CSM_NETWORK_SRC_CPP_ENDPOINT_BUFFER_H_
 
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
 #include "address.h"
 #include "csm_message_and_address.h"
 
 namespace csm {
 namespace network {
 
+/**
+ * Size-class pool of receive buffers shared by all endpoints of a process.
+ *
+ * Buffer sizes are powers of two starting at MIN_BUFFER_SIZE and capped at
+ * DGRAM_PAYLOAD_MAX. Released buffers are kept for reuse up to
+ * MAX_CACHED_BYTES per size class, anything beyond that is returned to the heap.
+ * Buffers are handed out without clearing their content.
+ */
+class EndpointBufferPool
+{
+public:
+  static const size_t MIN_BUFFER_SIZE = 4096;
+  static const size_t MAX_CACHED_BYTES = 64 * 1024 * 1024;
+  static const unsigned CLASS_COUNT = 24;
+
+  static EndpointBufferPool& Instance();
+
+  /** @brief Returns a buffer of at least io_Size bytes (at most DGRAM_PAYLOAD_MAX).
+   *  @param[in,out] io_Size requested size, updated to the actual size of the buffer
+   */
+  char* Acquire( size_t &io_Size );
+  void Release( char *aBuffer, const size_t aSize );
+
+  static size_t ClassSize( const size_t aSize );
+  size_t GetCachedBytes();
+
+private:
+  EndpointBufferPool() {}
+  static unsigned ClassIndex( const size_t aSize );
+
+  std::mutex _Lock;
+  std::vector<char*> _FreeList[ CLASS_COUNT ];
+};
+
 class EndpointBuffer {
   enum EndpointBufferStates {
     BUFFER_EMPTY = 0,
@@ -35,21 +73,51 @@ class EndpointBuffer {
   char *_BufferHead;
   char *_BufferTail;
   size_t _DataLen;
+  size_t _Capacity;
+  size_t _InitialSize;
   EndpointBufferStates _BufferState;
+  csm_checksum_type_t _ChecksumType;
 
 public:
-  EndpointBuffer()
-  : _BufferBase( new char[ DGRAM_PAYLOAD_MAX ] ),
-    _BufferHead( _BufferBase ),
-    _BufferTail( _BufferBase ),
+  // the buffer memory is only taken from the pool when data is about to be received
+  EndpointBuffer( const size_t aInitialSize = EndpointBufferPool::MIN_BUFFER_SIZE )
+  : _BufferBase( nullptr ),
+    _BufferHead( nullptr ),
+    _BufferTail( nullptr ),
+    _DataLen( 0 ),
+    _Capacity( 0 ),
+    _InitialSize( EndpointBufferPool::ClassSize( aInitialSize ) ),
+    _BufferState( BUFFER_EMPTY ),
+    _ChecksumType( CSM_CHECKSUM_XOR )
+  {}
+
+  EndpointBuffer( const EndpointBuffer &aBuffer )
+  : _BufferBase( nullptr ),
+    _BufferHead( nullptr ),
+    _BufferTail( nullptr ),
     _DataLen( 0 ),
-    _BufferState( BUFFER_EMPTY )
+    _Capacity( 0 ),
+    _InitialSize( aBuffer._InitialSize ),
+    _BufferState( BUFFER_EMPTY ),
+    _ChecksumType( aBuffer._ChecksumType )
   {
-      memset(_BufferBase, 0x0, DGRAM_PAYLOAD_MAX);
+    CopyPending( aBuffer );
+  }
+
+  EndpointBuffer& operator=( const EndpointBuffer &aBuffer )
+  {
+    if( this != &aBuffer )
+    {
+      ReleaseBuffer();
+      _InitialSize = aBuffer._InitialSize;
+      _ChecksumType = aBuffer._ChecksumType;
+      CopyPending( aBuffer );
+    }
+    return *this;
   }
 
   virtual ~EndpointBuffer()
-  { delete[] _BufferBase; }
+  { ReleaseBuffer(); }
 
   ssize_t Recv( csm::network::Message &o_Msg )
   {
@@ -62,7 +130,13 @@ public:
       case BUFFER_MSG_COMPLETE:
         LOG( csmnet, debug ) << "RecvBuffer Valid-msg offset=" << ProcessedData();
         o_Msg.InitHdr( _BufferHead );
-        o_Msg.SetData( std::string( _BufferHead+sizeof( csm_network_header ), o_Msg.GetDataLen() ) );
+        if( _ChecksumType == CSM_CHECKSUM_XOR )
+          o_Msg.SetData( std::string( _BufferHead+sizeof( csm_network_header ), o_Msg.GetDataLen() ) );
+        else if( ! SetVerifiedData( o_Msg ) )
+        {
+          Progress();
+          throw csm::network::ExceptionEndpointDown( "Invalid Checksum", EBADMSG );
+        }
         break;
       case BUFFER_MSG_INVALID:
       {
@@ -89,17 +163,36 @@ public:
   inline bool IsEmpty() const { return _BufferTail == _BufferHead; }
   inline bool HasPartialMsg() const
   { return (_BufferState == BUFFER_MSG_PARTIAL) || ( _BufferState == BUFFER_HDR_PARTIAL ); }
-  ssize_t GetRecvSpace() const { return DGRAM_PAYLOAD_MAX - ( _BufferTail - _BufferBase ); }
-  char * GetRecvBufferPtr() const { return _BufferTail; }
+  inline size_t GetCapacity() const { return _Capacity; }
+
+  /* Messages are received with the given checksum type. Incoming checksums are only verified for
+   * types other than CSM_CHECKSUM_XOR, those connections still accept xor checksums from a peer that
+   * didn't switch yet. Either way, the returned message carries an xor checksum.
+   */
+  inline void SetChecksumType( const csm_checksum_type_t aType ) { _ChecksumType = aType; }
+  inline csm_checksum_type_t GetChecksumType() const { return _ChecksumType; }
+  ssize_t GetRecvSpace() const
+  {
+    if( _BufferBase == nullptr )
+      return _InitialSize;
+    return _Capacity - ( _BufferTail - _BufferBase );
+  }
+  char * GetRecvBufferPtr()
+  {
+    if( _BufferBase == nullptr )
+      AcquireBuffer( _InitialSize );
+    return _BufferTail;
+  }
   virtual void Update( const ssize_t i_Skip,  const struct sockaddr *i_SrcAddr = nullptr )
   {
-    if( _DataLen + i_Skip > DGRAM_PAYLOAD_MAX )
+    if(( _BufferBase == nullptr ) || ( i_Skip > GetRecvSpace() ))
       throw csm::network::ExceptionProtocol("Buffer State protocol failure: Buffer overflow.");
     else
     {
       _DataLen += i_Skip;
       _BufferTail += i_Skip;
       _BufferState = Transition();
+      Reserve();
       LOG( csmnet, trace ) << "Updating buffer. recvd=" << i_Skip
           << " data=" << _DataLen
           << " new state=" << _BufferState;
@@ -110,10 +203,8 @@ protected:
   inline size_t ProcessedData() const { return _BufferHead - _BufferBase; }
   virtual void Reset()
   {
-    bzero( _BufferBase, _DataLen );
+    ReleaseBuffer();
     _DataLen = 0;
-    _BufferHead = _BufferBase;
-    _BufferTail = _BufferBase;
     _BufferState = BUFFER_EMPTY;
     LOG( csmnet, trace ) << "Reset buffer.";
   }
@@ -159,8 +250,8 @@ protected:
         break;
       case BUFFER_MSG_COMPLETE:
       {
-        ssize_t skip = sizeof( csm_network_header ) + hdr->_DataLen;
-        if( skip + ProcessedData() < DGRAM_PAYLOAD_MAX )
+        size_t skip = sizeof( csm_network_header ) + hdr->_DataLen;
+        if( skip + ProcessedData() <= _Capacity )
           _BufferHead += skip;
         else
         {
@@ -171,6 +262,7 @@ protected:
         if( ProcessedData() == _DataLen )
           Reset();
         _BufferState = Transition();
+        Reserve();
         LOG( csmnet, trace ) << "Updating buffer. new state=" << _BufferState;
         break;
       }
@@ -184,14 +276,108 @@ protected:
         break;
     }
   }
+
+private:
+  inline size_t PendingData() const { return _DataLen - ProcessedData(); }
+
+  bool SetVerifiedData( csm::network::Message &o_Msg ) const
+  {
+    uint32_t recvdChkSum = o_Msg.GetCheckSum();
+    o_Msg.SetDataOnly( std::string( _BufferHead+sizeof( csm_network_header ), o_Msg.GetDataLen() ) );
+    if( o_Msg.CheckSumCalculate( _ChecksumType ) != recvdChkSum )
+    {
+      if( o_Msg.CheckSumUpdate() != recvdChkSum )
+      {
+        LOG( csmnet, error ) << "RecvBuffer checksum mismatch. type=" << _ChecksumType << " msg=" << o_Msg;
+        return false;
+      }
+      return true;
+    }
+    o_Msg.CheckSumUpdate();
+    return true;
+  }
+
+  void AcquireBuffer( size_t aSize )
+  {
+    _BufferBase = EndpointBufferPool::Instance().Acquire( aSize );
+    _Capacity = aSize;
+    _BufferHead = _BufferBase;
+    _BufferTail = _BufferBase;
+  }
+
+  void ReleaseBuffer()
+  {
+    if( _BufferBase != nullptr )
+      EndpointBufferPool::Instance().Release( _BufferBase, _Capacity );
+    _BufferBase = nullptr;
+    _BufferHead = nullptr;
+    _BufferTail = nullptr;
+    _Capacity = 0;
+  }
+
+  /*
+   * Makes sure the unprocessed data plus the rest of a pending message (or at least
+   * one more header) fit behind the head. The pending bytes are moved to the start of
+   * the buffer and the buffer is replaced by one of a larger size class if needed.
+   */
+  void Reserve()
+  {
+    if( _BufferBase == nullptr )
+      return;
+
+    size_t pending = PendingData();
+    size_t needed = pending + sizeof( csm_network_header );
+    if( _BufferState == BUFFER_MSG_PARTIAL )
+      needed = sizeof( csm_network_header ) + ((csm_network_header*)_BufferHead)->_DataLen;
+    if( needed > DGRAM_PAYLOAD_MAX )
+      needed = DGRAM_PAYLOAD_MAX;
+
+    if( needed <= _Capacity - ProcessedData() )
+      return;
+
+    if( needed <= _Capacity )
+    {
+      memmove( _BufferBase, _BufferHead, pending );
+    }
+    else
+    {
+      char *old = _BufferBase;
+      char *oldHead = _BufferHead;
+      size_t oldCapacity = _Capacity;
+      AcquireBuffer( needed );
+      memcpy( _BufferBase, oldHead, pending );
+      EndpointBufferPool::Instance().Release( old, oldCapacity );
+      LOG( csmnet, debug ) << "Buffer grown to " << _Capacity << " bytes for pending=" << pending
+          << " needed=" << needed;
+    }
+    _BufferHead = _BufferBase;
+    _BufferTail = _BufferBase + pending;
+    _DataLen = pending;
+  }
+
+  void CopyPending( const EndpointBuffer &aBuffer )
+  {
+    _DataLen = 0;
+    _BufferState = BUFFER_EMPTY;
+    if( aBuffer.IsEmpty() )
+      return;
+
+    size_t pending = aBuffer.PendingData();
+    AcquireBuffer( std::max( pending, aBuffer._Capacity ) );
+    memcpy( _BufferBase, aBuffer._BufferHead, pending );
+    _BufferTail = _BufferBase + pending;
+    _DataLen = pending;
+    _BufferState = aBuffer._BufferState;
+  }
 };
 
 class EndpointStateUnix : public EndpointBuffer {
   AddressUnix_sptr _SrcAddr;
 
 public:
+  // datagrams can't be received in pieces, so this buffer always has the full size
   EndpointStateUnix( )
-  : EndpointBuffer(),
+  : EndpointBuffer( DGRAM_PAYLOAD_MAX ),
     _SrcAddr()
   {}
 
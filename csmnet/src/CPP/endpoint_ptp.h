@@ -83,6 +83,9 @@ public:
 
   virtual bool DataPending() const { return ! _RecvBufferState.IsEmpty(); }
 
+  virtual void SetChecksumType( const csm_checksum_type_t i_Type ) { _RecvBufferState.SetChecksumType( i_Type ); }
+  virtual csm_checksum_type_t GetChecksumType() const { return _RecvBufferState.GetChecksumType(); }
+
   /* data synchronization, e.g. flush any buffers */
   virtual NetworkCtrlInfo* Sync( const SyncAction aSync = SYNC_ACTION_ALL );
 
@@ -132,6 +135,17 @@ public:
 
 protected:
   virtual ssize_t SendMsgWrapper( const struct msghdr *aMsg, const int aFlags );
+
+  // messages carry an xor checksum, connections with a different checksum type get an updated copy of the header
+  inline char* GetWireHeader( const csm::network::Message &aMsg, csm_network_header_t &o_Header ) const
+  {
+    csm_checksum_type_t type = _RecvBufferState.GetChecksumType();
+    if( type == CSM_CHECKSUM_XOR )
+      return aMsg.GetHeaderBuffer();
+    memcpy( &o_Header, aMsg.GetHeaderBuffer(), sizeof( csm_network_header_t ) );
+    o_Header._CheckSum = csm_header_check_sum_type( &o_Header, aMsg.GetDataPtr(), type );
+    return (char*)&o_Header;
+  }
   int SetGeneralSockopts();
   void SetHeartbeatAddress( const Address_sptr &aAddr ) { _Heartbeat.setAddr( aAddr ); }
 
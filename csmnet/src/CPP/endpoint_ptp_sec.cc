@@ -253,8 +253,9 @@ csm::network::EndpointPTP_sec_base::SendMsgWrapper( const struct msghdr *aMsg, c
 
 ssize_t csm::network::EndpointPTP_sec_base::Send( const csm::network::Message &aMsg )
 {
+  csm_network_header_t header;
   struct iovec iov[2];
-  iov[0].iov_base = aMsg.GetHeaderBuffer();
+  iov[0].iov_base = GetWireHeader( aMsg, header );
   iov[0].iov_len = sizeof( csm_network_header_t );
   iov[1].iov_base = (void*)aMsg.GetDataPtr();
   iov[1].iov_len = aMsg.GetDataLen();
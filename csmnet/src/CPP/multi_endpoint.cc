@@ -29,8 +29,83 @@
 #include "endpoint_aggregator.h"
 #include "endpoint_multi_unix.h"
 #include "network_ctrl_path.h"
+#include "endpoint_buffer.h"
 #include "multi_endpoint.h"
 
+// the pool outlives any endpoint that might release a buffer during process exit
+csm::network::EndpointBufferPool&
+csm::network::EndpointBufferPool::Instance()
+{
+  static csm::network::EndpointBufferPool *pool = new csm::network::EndpointBufferPool();
+  return *pool;
+}
+
+unsigned
+csm::network::EndpointBufferPool::ClassIndex( const size_t aSize )
+{
+  unsigned index = 0;
+  size_t size = MIN_BUFFER_SIZE;
+  while(( size < aSize ) && ( size < DGRAM_PAYLOAD_MAX ) && ( index < CLASS_COUNT - 1 ))
+  {
+    size <<= 1;
+    ++index;
+  }
+  return index;
+}
+
+size_t
+csm::network::EndpointBufferPool::ClassSize( const size_t aSize )
+{
+  size_t size = MIN_BUFFER_SIZE << ClassIndex( aSize );
+  return std::min( size, (size_t)DGRAM_PAYLOAD_MAX );
+}
+
+char*
+csm::network::EndpointBufferPool::Acquire( size_t &io_Size )
+{
+  unsigned index = ClassIndex( io_Size );
+  io_Size = ClassSize( io_Size );
+  {
+    std::lock_guard<std::mutex> guard( _Lock );
+    if( ! _FreeList[ index ].empty() )
+    {
+      char *buffer = _FreeList[ index ].back();
+      _FreeList[ index ].pop_back();
+      return buffer;
+    }
+  }
+  return new char[ io_Size ];
+}
+
+void
+csm::network::EndpointBufferPool::Release( char *aBuffer, const size_t aSize )
+{
+  if( aBuffer == nullptr )
+    return;
+
+  unsigned index = ClassIndex( aSize );
+  size_t limit = std::max( MAX_CACHED_BYTES / aSize, (size_t)1 );
+  {
+    std::lock_guard<std::mutex> guard( _Lock );
+    if( _FreeList[ index ].size() < limit )
+    {
+      _FreeList[ index ].push_back( aBuffer );
+      return;
+    }
+  }
+  delete [] aBuffer;
+}
+
+size_t
+csm::network::EndpointBufferPool::GetCachedBytes()
+{
+  std::lock_guard<std::mutex> guard( _Lock );
+  size_t bytes = 0;
+  for( unsigned n = 0; n < CLASS_COUNT; ++n )
+    bytes += _FreeList[ n ].size() * ClassSize( MIN_BUFFER_SIZE << n );
+  return bytes;
+}
+
 
 csm::network::MultiEndpoint::MultiEndpoint()
 : _EPL(), _Epoll( EPOLLIN | EPOLLERR | EPOLLRDHUP | EPOLLPRI ),
@@ -108,6 +108,10 @@ retry:
   // normally the ERR flag will be cleared for the ACK
   bool KeepErrorFlag = false;
 
+  // checksum type to activate on the passive side once the version ACK is out
+  csm::network::Endpoint *checksumEP = nullptr;
+  csm_checksum_type_t checksumType = CSM_CHECKSUM_XOR;
+
   // DANGER: when set to true, make sure there's no ctrl event created!!!!
   bool disconnect = false;
   csm::network::NetworkCtrlEventType event_type = csm::network::NET_CTL_OTHER;
@@ -186,6 +190,23 @@ retry:
             else
             {
               ep->SetVerified();
+              // the passive side picks the checksum type and returns it in the reserved field of the ACK
+              // older peers leave that field untouched (0) and ignore it
+              if( ! aMsgAddr._Msg.GetAck() )
+              {
+                checksumType = csm::network::VersionMsg::Get()->NegotiateChecksum( versionMsg );
+                if( checksumType != CSM_CHECKSUM_XOR )
+                {
+                  aMsgAddr._Msg.SetReservedID( CSM_CHECKSUM_CAPABILITY( checksumType ) );
+                  checksumEP = ep;
+                }
+              }
+              else if(( aMsgAddr._Msg.GetReservedID() == CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_CRC32C ) ) &&
+                      ( csm::network::VersionMsg::Get()->GetChecksumCapabilities() & CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_CRC32C ) ))
+              {
+                ep->SetChecksumType( CSM_CHECKSUM_CRC32C );
+                LOG( csmnet, info ) << "ReliableMsg: Using CRC32C checksums with " << aMsgAddr.GetAddr()->Dump();
+              }
               AddCtrlEvent( csm::network::NET_CTL_CONNECT, aMsgAddr.GetAddr(), &versionMsg );
             }
           }
@@ -261,6 +282,11 @@ retry:
       try
       {
         GenerateAndSendACK( aMsgAddr, KeepErrorFlag );
+        if(( checksumEP != nullptr ) && ( ! disconnect ))
+        {
+          checksumEP->SetChecksumType( checksumType );
+          LOG( csmnet, info ) << "ReliableMsg: Using CRC32C checksums with " << aMsgAddr.GetAddr()->Dump();
+        }
       }
       catch( csm::network::Exception &e )
       {
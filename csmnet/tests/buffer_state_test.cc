@@ -15,6 +15,8 @@
 
 #include <string>
 #include <iostream>
+#include <vector>
+#include <algorithm>
 
 #include "logging.h"
 #include "CPP/csm_network_msg_cpp.h"
@@ -35,20 +37,25 @@ ssize_t GenerateMsgBuffer( char * o_Buffer, const char *i_Content, ssize_t i_Max
 {
   csm::network::Message msg;
 
-  ssize_t stlen = random() % i_MaxLen;
-  char *stpos = (char*)i_Content + (random() % DGRAM_PAYLOAD_MAX);
-
-  std::string data = std::string( stpos, stlen );
-
-  msg.Init( (random()+1) % CSM_CMD_MAX,
-            random() & CSM_HEADER_FLAGS_MASK,
-            random() % CSM_NETWORK_MAX_PRIORITY,
-            random(),
-            random(),
-            random(),
-            random(),
-            random(),
-            data );
+  // not every random command type is valid, retry a few times
+  int attempts = 100;
+  do
+  {
+    ssize_t stlen = random() % i_MaxLen;
+    char *stpos = (char*)i_Content + (random() % DGRAM_PAYLOAD_MAX);
+
+    std::string data = std::string( stpos, stlen );
+
+    msg.Init( (random()+1) % CSM_CMD_MAX,
+              random() & CSM_HEADER_FLAGS_MASK,
+              random() % CSM_NETWORK_MAX_PRIORITY,
+              random(),
+              random(),
+              random(),
+              random(),
+              random(),
+              data );
+  } while(( ! msg.Validate() ) && ( --attempts > 0 ));
   if( ! msg.Validate() )
     return -1;
 
@@ -60,6 +67,23 @@ ssize_t GenerateMsgBuffer( char * o_Buffer, const char *i_Content, ssize_t i_Max
   return sizeof( csm_network_header ) + msg.GetDataLen();
 }
 
+// copy data into the buffer in chunks of the available recv space, like a stream socket would
+template<class BufferType>
+void FeedBuffer( BufferType &io_Buf, const char *i_Data, ssize_t i_Len, const struct sockaddr *i_Addr = nullptr )
+{
+  while( i_Len > 0 )
+  {
+    char *dest = io_Buf.GetRecvBufferPtr();
+    ssize_t chunk = std::min( i_Len, io_Buf.GetRecvSpace() );
+    if( chunk <= 0 )
+      throw csm::network::ExceptionProtocol("No recv space left.");
+    memcpy( dest, i_Data, chunk );
+    io_Buf.Update( chunk, i_Addr );
+    i_Data += chunk;
+    i_Len -= chunk;
+  }
+}
+
 
 
 int main( int argc, char **argv )
@@ -72,16 +96,19 @@ int main( int argc, char **argv )
   ssize_t len;
 
   char *content = RandomStringBuffer();
+  char *scratch = new char[ DGRAM_PAYLOAD_MAX ];
 
-  // test initialization
+  // test initialization: no memory is taken before data arrives
+  rc += TEST( epbuf.GetCapacity(), 0 );
+  rc += TEST( epbuf.GetRecvSpace(), csm::network::EndpointBufferPool::MIN_BUFFER_SIZE );
   rc += TEST( epbuf.GetRecvBufferPtr() != nullptr, true );
-  rc += TEST( epbuf.GetRecvSpace(), DGRAM_PAYLOAD_MAX );
+  rc += TEST( epbuf.GetCapacity(), csm::network::EndpointBufferPool::MIN_BUFFER_SIZE );
 
   // insert a single message and try retrieve
-  rc += TESTFAIL( len = GenerateMsgBuffer( epbuf.GetRecvBufferPtr(), content, epbuf.GetRecvSpace() ), -1 );
+  rc += TESTFAIL( len = GenerateMsgBuffer( scratch, content, DGRAM_PAYLOAD_MAX / 2 ), -1 );
   try
   {
-    epbuf.Update( len );
+    FeedBuffer( epbuf, scratch, len );
   }
   catch (csm::network::ExceptionProtocol &e )
   {
@@ -91,18 +118,20 @@ int main( int argc, char **argv )
   rc += TEST( testMsg.Validate(), true );  // message needs to be valid
 
   rc += TEST( epbuf.Recv( testMsg ), 0 );  // make sure msg is consumed
+  rc += TEST( epbuf.GetCapacity(), 0 );    // idle buffer went back to the pool
 
   // force a half-msg
-  len = GenerateMsgBuffer( epbuf.GetRecvBufferPtr(), content, epbuf.GetRecvSpace() );
-  epbuf.Update( len - 1 );
+  len = GenerateMsgBuffer( scratch, content, DGRAM_PAYLOAD_MAX / 2 );
+  FeedBuffer( epbuf, scratch, len - 1 );
   rc += TEST( epbuf.Recv( testMsg ), 0 );  // nothing to recv
   rc += TEST( testMsg.Validate(), true );  // validation should still find the previous valid msg
+  rc += TEST( epbuf.GetCapacity() >= (size_t)len, true );  // grown to fit the announced msg
 
   // adjust to fit message end
-  epbuf.Update( 1 );
+  FeedBuffer( epbuf, scratch + len - 1, 1 );
   // add another message before doing Recv()
-  len = GenerateMsgBuffer( epbuf.GetRecvBufferPtr(), content, epbuf.GetRecvSpace() );
-  epbuf.Update( len );
+  len = GenerateMsgBuffer( scratch, content, DGRAM_PAYLOAD_MAX / 2 );
+  FeedBuffer( epbuf, scratch, len );
 
   rc += TESTFAIL( epbuf.Recv( testMsg ), 0 );  // there should be a msg now ...
   rc += TEST( testMsg.Validate(), true );      // ... a valid message
@@ -110,16 +139,17 @@ int main( int argc, char **argv )
   rc += TEST( testMsg.Validate(), true );      // ... a valid message
 
   // invalid messages
-  epbuf.Update(200);
+  memset( scratch, 0, 200 );
+  FeedBuffer( epbuf, scratch, 200 );
   rc += TEST( epbuf.Recv(testMsg), 200 );
   rc += TEST( testMsg.GetErr(), true );
   rc += TEST( testMsg.Validate(), false );
   rc += TEST( epbuf.IsEmpty(), true );
 
 
-  len = GenerateMsgBuffer(epbuf.GetRecvBufferPtr(), RandomStringBuffer(), DGRAM_PAYLOAD_MAX-100);
-  epbuf.Update(len);
-  epbuf.Update(100);
+  len = GenerateMsgBuffer(scratch, RandomStringBuffer(), DGRAM_PAYLOAD_MAX-100-sizeof(csm_network_header));
+  memset( scratch + len, 0, 100 );
+  FeedBuffer( epbuf, scratch, len + 100 );
 
   epbuf.Recv(testMsg);  // valid message
   rc += TEST( testMsg.GetDataLen(), len-sizeof(csm_network_header) );
@@ -140,7 +170,7 @@ int main( int argc, char **argv )
   header._Flags = random() & CSM_HEADER_FLAGS_MASK;
   header._Priority = random() % CSM_NETWORK_MAX_PRIORITY;
 
-  std::string long_msg = std::string(RandomStringBuffer()).substr(0, DGRAM_PAYLOAD_MAX+1);
+  std::string long_msg = std::string(RandomStringBuffer(), DGRAM_PAYLOAD_MAX+1);
   header._DataLen = long_msg.length();
   header._CheckSum = csm_header_check_sum( &header, long_msg.c_str() );
 
@@ -172,8 +202,9 @@ int main( int argc, char **argv )
 
   rc += TEST( epbuf_unix.GetAddr().get()->Dump(), CSM_NETWORK_LOCAL_SSOCKET);
 
-  // Update, Recv
-  len = GenerateMsgBuffer(epbuf_unix.GetRecvBufferPtr(), RandomStringBuffer(), DGRAM_PAYLOAD_MAX);
+  // Update, Recv: datagram buffers always provide the full payload size
+  rc += TEST( epbuf_unix.GetRecvSpace(), DGRAM_PAYLOAD_MAX );
+  len = GenerateMsgBuffer(epbuf_unix.GetRecvBufferPtr(), RandomStringBuffer(), DGRAM_PAYLOAD_MAX - sizeof( csm_network_header ));
   epbuf_unix.Update(len, (struct sockaddr*)&s);
   rc += TEST( epbuf_unix.GetAddr().get()->Dump(), CSM_NETWORK_LOCAL_SSOCKET );
   rc += TEST( epbuf_unix.IsEmpty(), false );
@@ -186,6 +217,33 @@ int main( int argc, char **argv )
   rc += TEST( epbuf_unix.GetAddr().get()->Dump(), CSM_NETWORK_LOCAL_SSOCKET );
   rc += TEST( epbuf_unix.IsEmpty(), true );
 
+  // copies carry over pending data into their own buffer
+  len = GenerateMsgBuffer( scratch, content, 1000 );
+  FeedBuffer( epbuf, scratch, len - 10 );
+  csm::network::EndpointBuffer epcopy( epbuf );
+  FeedBuffer( epcopy, scratch + len - 10, 10 );
+  rc += TESTFAIL( epcopy.Recv( testMsg ), 0 );
+  rc += TEST( testMsg.Validate(), true );
+  rc += TEST( epbuf.HasPartialMsg(), true );
+
+  // released buffers are cached, but only up to the per-class limit
+  rc += TEST( csm::network::EndpointBufferPool::Instance().GetCachedBytes() > 0, true );
+  {
+    csm::network::EndpointBufferPool &pool = csm::network::EndpointBufferPool::Instance();
+    size_t cached = pool.GetCachedBytes();
+    std::vector<char*> many;
+    for( int n = 0; n < 20; ++n )
+    {
+      size_t size = DGRAM_PAYLOAD_MAX;
+      many.push_back( pool.Acquire( size ) );
+      rc += TEST( size, DGRAM_PAYLOAD_MAX );
+    }
+    for( auto b : many )
+      pool.Release( b, DGRAM_PAYLOAD_MAX );
+    rc += TEST( pool.GetCachedBytes() - cached <= csm::network::EndpointBufferPool::MAX_CACHED_BYTES, true );
+  }
+
+  delete [] scratch;
   std::cout << "Exiting with rc=" << rc << std::endl;
   return rc;
 }
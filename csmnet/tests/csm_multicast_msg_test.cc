@@ -59,6 +59,34 @@ int main( int argc, char **argv )
   rc += TEST( orgMsg.GetPriority(), msg.GetPriority() );
 
   std::cout << "GetData after decoding: \"" << orgMsg.GetData() << "\"" << std::endl;
+  rc += TEST( orgMsg.GetData(), msg.GetData() );
+
+  // node names with numeric suffixes are sent as ranges
+  std::vector< std::string > range_list;
+  for( int n = 1; n <= 4000; ++n )
+  {
+    char name[ 32 ];
+    snprintf( name, sizeof( name ), "c650f%02dp%02d", n / 100, n % 100 );
+    range_list.push_back( std::string( name ) );
+  }
+  range_list.push_back( std::string("login") );
+  range_list.push_back( std::string("n9") );
+  range_list.push_back( std::string("n10") );
+  range_list.push_back( std::string("n11") );
+  range_list.push_back( std::string("x0012345678901") );
+
+  ret = CreateMulticastMessage(msg, range_list, outMsg);
+  rc += TEST(ret, true);
+
+  uint32_t node_string_len = 0;
+  node_list.clear();
+  rc += TEST( ExtractMulticastNodelist( outMsg, node_list, &node_string_len ), (int)range_list.size() );
+  rc += TEST( node_list == range_list, true );
+  rc += TEST( node_string_len < 4000 * 4, true );
+
+  ret = DecodeMulticastMessage(outMsg, orgMsg);
+  rc += TEST(ret, true);
+  rc += TEST( orgMsg.GetData(), msg.GetData() );
 
   std::cout << " rc = " << rc << std::endl;
   return rc;
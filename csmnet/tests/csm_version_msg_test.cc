@@ -126,6 +126,24 @@ int main( int argc, char **argv )
   ret += TEST( vmsg->Acceptable( vstruct ), false );
   LOG( csmd, always ) << "Version supported: " << vmsg->Acceptable( vstruct ) << " current: " << vmsg->GetVersion();
 
+  // default archive stays in the old format and announces xor only
+  vmsg->SetVersion( "1.0.0" );
+  archive = csm::network::VersionMsg::ConvertToBytes( vmsg );
+  csm::network::VersionStruct vcaps;
+  csm::network::VersionMsg::ConvertToClass( archive, vcaps );
+  ret += TEST( vcaps._Checksums, CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_XOR ) );
+  ret += TEST( vmsg->NegotiateChecksum( vcaps ), CSM_CHECKSUM_XOR );
+
+  // crc32c is only picked if both sides offer it
+  vmsg->SetChecksumCapabilities( CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_CRC32C ) );
+  ret += TEST( vmsg->NegotiateChecksum( vcaps ), CSM_CHECKSUM_XOR );
+  archive = csm::network::VersionMsg::ConvertToBytes( vmsg );
+  csm::network::VersionMsg::ConvertToClass( archive, vcaps );
+  ret += TEST( vcaps._Checksums, CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_XOR ) | CSM_CHECKSUM_CAPABILITY( CSM_CHECKSUM_CRC32C ) );
+  ret += TEST( vcaps._Hostname.compare( "localhost" ), 0 );
+  ret += TEST( vmsg->NegotiateChecksum( vcaps ), CSM_CHECKSUM_CRC32C );
+  LOG( csmd, always ) << "Serialized with checksum capabilities: " << archive;
+
   LOG(csmd, info) << "Exit test: " << ret;
 
   return ret;
@@ -20,7 +20,14 @@
 #ifndef __CSM_TEST_UTILS_H__
 #define __CSM_TEST_UTILS_H__
 
+#include <stdio.h>
+
 #define TEST( function, expect ) ( !( (expect) == (function) ) )
 #define TESTFAIL( function, expect ) ( !TEST(function, expect) )
 
+/** @brief Reports a failed condition with a printf style message and counts it in
+ *         the test's own @c failures counter, the test keeps going. */
+#define CHECK( cond, ... ) \
+  do { if( !(cond) ) { printf( "FAIL %s:%d: ", __FILE__, __LINE__ ); printf( __VA_ARGS__ ); printf( "\n" ); ++failures; } } while( 0 )
+
 #endif // __CSM_TEST_UTILS_H__
@@ -24,11 +24,13 @@
 #define __FSHIP_FUSE_OPS_HANDLER_H__
 
 #include "CnxSock.h"
+#include "FuseChannelMap.h"
 #include "MemChunk.h"
 #include "Msg.h"
 #include "NodeNameNetworkedRoot.h"
 #include "ResponseHandler.h"
 #include "util.h"
+#include <vector>
 
 const unsigned int MAX_INDEX_FUNC_OP = FUSE_RENAME2;
 const unsigned int ARRAY_SIZE_FUNC_OP = MAX_INDEX_FUNC_OP + 1;
@@ -37,6 +39,16 @@ void set_doXattr(int pVal);
 
 void set_fuseDirectIO(int pVal);
 
+class FshipFuseOpsHandler;
+
+//! \brief A /dev/fuse descriptor with its own reader
+struct FuseChannel {
+  FshipFuseOpsHandler *handler;
+  int fd;            //!< device descriptor or a clone of it
+  int cpu;           //!< cpu the reader is pinned to, -1 if not pinned
+  pthread_t thread;  //!< reader, 0 for the channel read by the main thread
+  __u64 last_unique; //!< to watch for missing operations
+};
 
 
 class FshipFuseOpsHandler  {
@@ -75,6 +87,11 @@ public:
   void setNumRDMAchunks(uint32_t pNumRDMAchunks) {
     _numRDMAchunks = pNumRDMAchunks;
   }
+  //! \brief Set the number of /dev/fuse channels read in parallel
+  //! \note  Channels past the first are clones of the device descriptor
+  void setNumChannels(int pNumChannels) {
+    _numChannels = (pNumChannels > 0) ? pNumChannels : 1;
+  }
 
   void setInit(struct fuse_init_in &pInit) {
     _init_in.major = pInit.major;
@@ -94,24 +111,26 @@ public:
   }
  inline int getDeviceFD() { return _deviceFD; }
  
-  __u64 last_unique;
   int _max_read;
   int _deviceFD;
+  FuseChannelMap _channelMap;
   std::string _mountName;
   char mountParameters[512];
 
   inline __s64 error_send(inMsgGeneric *in, __s32 error) {
+    if (_rootNodePtr)
+      _rootNodePtr->cacheReplied(in->hdr.unique);
     outMsgGeneric err(in->hdr.unique, error);
     return writedeviceFD(&err, in->hdr.opcode);
   }
   inline __s64 sendOutMsg(const fuse_out_header &hdr) {
     __s64 retval = 0;
-    retval = (__s64)write(_deviceFD, &hdr, hdr.len);
+    retval = (__s64)write(_channelMap.replyFD(hdr.unique), &hdr, hdr.len);
     return retval;
   }
 
-  ssize_t readFuseMessage(char *buf, size_t bufSize);
-  ssize_t readFuseMessage(memItemPtr mi);
+  ssize_t readFuseMessage(FuseChannel &pChannel, char *buf, size_t bufSize);
+  ssize_t readFuseMessage(FuseChannel &pChannel, memItemPtr mi);
 
   //! \brief  Send error back to module for request
   //! \param  unique ID of request
@@ -196,6 +215,16 @@ private:
   void responseHandler();
   pthread_t _responseHandlerThread;
 
+  int _numChannels;
+  std::vector<FuseChannel> _channels;
+  int openChannels();
+  int cloneDevice();
+  void pinChannel(FuseChannel &pChannel);
+  void stopChannels();
+  int readChannel(FuseChannel &pChannel, memItemPtr mip);
+  static void *startChannelReader(void *object);
+  void channelReader(FuseChannel &pChannel);
+
   enum readState {
     activeState = 0,
     quiescingState = 1,
@@ -0,0 +1,87 @@
+/*******************************************************************************
+ |    FuseChannelMap.h
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//! \file  FuseChannelMap.h
+//! \brief class FuseChannelMap
+#ifndef __FUSE_CHANNEL_MAP_H__
+#define __FUSE_CHANNEL_MAP_H__
+
+#include <assert.h>
+#include <linux/fuse.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <unordered_map>
+
+//! \brief Route fuse replies to the channel their request was read from
+//! \note  The fuse module keeps a processing queue per /dev/fuse descriptor,
+//!        so with cloned descriptors a reply written on another channel than
+//!        the one the request was read from is rejected by the module.
+//!        With a single channel every reply goes to the device descriptor
+//!        and no routes are kept.
+class FuseChannelMap {
+public:
+  FuseChannelMap(int &pDeviceFD) : _deviceFD(pDeviceFD), _multiChannel(0) {
+    int l_RC = pthread_mutex_init(&_mutex, NULL);
+    assert_perror(l_RC);
+  }
+
+  ~FuseChannelMap() { pthread_mutex_destroy(&_mutex); }
+
+  void setMultiChannel(int pVal) { _multiChannel = pVal; }
+  int isMultiChannel() { return _multiChannel; }
+
+  //! \brief Remember the channel a request was read from
+  //! \param pHdr  fuse header of the request
+  //! \param pFD   channel descriptor the request was read from
+  void route(const struct fuse_in_header &pHdr, int pFD) {
+    if (!_multiChannel)
+      return;
+    // no reply is sent for a forget
+    if ((pHdr.opcode == FUSE_FORGET) || (pHdr.opcode == FUSE_BATCH_FORGET))
+      return;
+    int l_RC = pthread_mutex_lock(&_mutex);
+    assert_perror(l_RC);
+    _route[pHdr.unique] = pFD;
+    l_RC = pthread_mutex_unlock(&_mutex);
+    assert_perror(l_RC);
+  }
+
+  //! \brief Channel descriptor to write the reply for a request on
+  //! \param pUnique  unique ID of the request, 0 for a notification
+  //! \return descriptor of the channel the request was read from, the
+  //!         device descriptor for notifications and unknown requests
+  //! \note  The route is dropped, a request gets exactly one reply
+  int replyFD(uint64_t pUnique) {
+    if ((!_multiChannel) || (!pUnique))
+      return _deviceFD;
+    int l_FD = _deviceFD;
+    int l_RC = pthread_mutex_lock(&_mutex);
+    assert_perror(l_RC);
+    std::unordered_map<uint64_t, int>::iterator it = _route.find(pUnique);
+    if (it != _route.end()) {
+      l_FD = it->second;
+      _route.erase(it);
+    }
+    l_RC = pthread_mutex_unlock(&_mutex);
+    assert_perror(l_RC);
+    return l_FD;
+  }
+
+private:
+  int &_deviceFD;
+  volatile int _multiChannel;
+  pthread_mutex_t _mutex; // control access to the routes
+  std::unordered_map<uint64_t, int> _route;
+};
+
+#endif /* __FUSE_CHANNEL_MAP_H__ */
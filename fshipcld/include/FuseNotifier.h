@@ -0,0 +1,173 @@
+/*******************************************************************************
+ |    FuseNotifier.h
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//! \file  FuseNotifier.h
+//! \brief class FuseNotifier
+#ifndef __FUSE_NOTIFIER_H__
+#define __FUSE_NOTIFIER_H__
+
+#include "FuseChannelMap.h"
+#include "fshipcld.h"
+#include "logging.h"
+#include <assert.h>
+#include <deque>
+#include <errno.h>
+#include <linux/fuse.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <sys/uio.h>
+
+//! \brief Invalidate names and nodes cached by the fuse module
+//! \note  The module takes the lock of the directory to invalidate a name in
+//!        it, which a lookup in the directory holds until fshipcld replies.
+//!        The notifications are written by a thread of their own, so the
+//!        thread writing the replies is never blocked by them.
+class FuseNotifier {
+public:
+  //! \brief Notifications queued at most, further ones are dropped and the
+  //!        fuse module keeps the names and attributes for their timeouts
+  static const size_t MAX_QUEUED = 65536;
+
+  FuseNotifier(FuseChannelMap &pChannelMap)
+      : _channelMap(pChannelMap), _started(0), _stopped(0), _dropped(0) {
+    int l_RC = pthread_mutex_init(&_mutex, NULL);
+    assert_perror(l_RC);
+    l_RC = pthread_cond_init(&_cond, NULL);
+    assert_perror(l_RC);
+  }
+
+  ~FuseNotifier() {
+    stop();
+    pthread_cond_destroy(&_cond);
+    pthread_mutex_destroy(&_mutex);
+  }
+
+  //! \brief Start the thread writing the notifications
+  //! \return 0 or the pthread_create error
+  int start() {
+    if (_started)
+      return 0;
+    int l_RC = pthread_create(&_thread, NULL, writer, this);
+    if (!l_RC)
+      _started = 1;
+    return l_RC;
+  }
+
+  //! \brief Write what is queued and join the thread
+  void stop() {
+    if (!_started)
+      return;
+    int l_RC = pthread_mutex_lock(&_mutex);
+    assert_perror(l_RC);
+    _stopped = 1;
+    pthread_cond_signal(&_cond);
+    l_RC = pthread_mutex_unlock(&_mutex);
+    assert_perror(l_RC);
+    pthread_join(_thread, NULL);
+    _started = 0;
+  }
+
+  //! \brief Invalidate a name in a directory
+  void invalEntry(const uint64_t pParent, const char *pName) {
+    queue(pParent, pName);
+  }
+
+  //! \brief Invalidate the attributes and cached data of a node
+  void invalInode(const uint64_t pNodeid) { queue(pNodeid, NULL); }
+
+private:
+  struct Notify {
+    uint64_t nodeid;  //!< directory of the name, or the node
+    std::string name; //!< empty for a node
+  };
+
+  void queue(const uint64_t pNodeid, const char *pName) {
+    if (!_started)
+      return;
+    int l_RC = pthread_mutex_lock(&_mutex);
+    assert_perror(l_RC);
+    if (_queue.size() < MAX_QUEUED) {
+      Notify l_Notify;
+      l_Notify.nodeid = pNodeid;
+      if (pName)
+        l_Notify.name = pName;
+      _queue.push_back(l_Notify);
+      pthread_cond_signal(&_cond);
+    } else if (!(_dropped++ % MAX_QUEUED))
+      LOG(fshipcld, warning) << "fuse notifications dropped=" << _dropped;
+    l_RC = pthread_mutex_unlock(&_mutex);
+    assert_perror(l_RC);
+  }
+
+  static void *writer(void *pNotifier) {
+    ((FuseNotifier *)pNotifier)->run();
+    return NULL;
+  }
+
+  void run() {
+    int l_RC = pthread_mutex_lock(&_mutex);
+    assert_perror(l_RC);
+    while (1) {
+      while (_queue.empty() && !_stopped)
+        pthread_cond_wait(&_cond, &_mutex);
+      if (_queue.empty())
+        break;
+      Notify l_Notify = _queue.front();
+      _queue.pop_front();
+      l_RC = pthread_mutex_unlock(&_mutex);
+      assert_perror(l_RC);
+      write(l_Notify);
+      l_RC = pthread_mutex_lock(&_mutex);
+      assert_perror(l_RC);
+    }
+    l_RC = pthread_mutex_unlock(&_mutex);
+    assert_perror(l_RC);
+  }
+
+  void write(const Notify &pNotify) {
+    ssize_t l_Length;
+    if (pNotify.name.empty()) {
+      outMsgInvalInodeNotify l_Msg(pNotify.nodeid);
+      l_Length = ::write(_channelMap.replyFD(0), &l_Msg, sizeof(l_Msg));
+    } else {
+      outMsgInvalEntryNotify l_Msg;
+      memset(&l_Msg.inval_entry_out, 0, sizeof(l_Msg.inval_entry_out));
+      l_Msg.inval_entry_out.parent = pNotify.nodeid;
+      l_Msg.inval_entry_out.namelen = pNotify.name.size();
+      l_Msg.notify.len += pNotify.name.size() + 1; // name and its nul
+      struct iovec l_Iov[2];
+      l_Iov[0].iov_base = &l_Msg;
+      l_Iov[0].iov_len = sizeof(l_Msg);
+      l_Iov[1].iov_base = (void *)pNotify.name.c_str();
+      l_Iov[1].iov_len = pNotify.name.size() + 1;
+      l_Length = ::writev(_channelMap.replyFD(0), l_Iov, 2);
+    }
+    // ENOENT, the module does not have the name or node cached
+    if ((l_Length < 0) && (errno != ENOENT))
+      LOG(fshipcld, debug) << "fuse notification nodeid=" << pNotify.nodeid
+                           << " errno=" << errno << ":" << strerror(errno);
+  }
+
+  FuseChannelMap &_channelMap;
+  pthread_mutex_t _mutex; // control access to the queue
+  pthread_cond_t _cond;
+  pthread_t _thread;
+  int _started;
+  int _stopped;
+  uint64_t _dropped;
+  std::deque<Notify> _queue;
+};
+
+#endif /* __FUSE_NOTIFIER_H__ */
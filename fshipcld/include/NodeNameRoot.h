@@ -16,6 +16,11 @@
 #define NODENAMEROOT_H
 #include "MemChunk.h"
 #include "NodeName.h"
+#include <algorithm>
+#include <string>
+#include <time.h>
+#include <unordered_map>
+#include <unordered_set>
 
 #if 0
 #define _LOGLOCK                                                               \
@@ -28,6 +33,41 @@
 #define _LOGUNLOCK
 #endif
 
+//! \brief Key of a cached lookup, parent fuse nodeid and name
+struct EntryKey {
+  uint64_t parent;
+  std::string name;
+  EntryKey(uint64_t pParent, const char *pName)
+      : parent(pParent), name(pName) {}
+  EntryKey(uint64_t pParent, const char *pName, size_t pLength)
+      : parent(pParent), name(pName, pLength) {}
+  bool operator==(const EntryKey &pOther) const {
+    return (parent == pOther.parent) && (name == pOther.name);
+  }
+};
+
+struct EntryKeyHash {
+  size_t operator()(const EntryKey &pKey) const {
+    return std::hash<std::string>()(pKey.name) ^
+           (pKey.parent * 0x9E3779B97F4A7C15ULL);
+  }
+};
+
+//! \brief Cached lookup reply, entry_out.nodeid 0 is a negative entry
+struct CachedEntry {
+  uint64_t expires; //!< CLOCK_MONOTONIC_COARSE nanoseconds
+  struct fuse_entry_out entry_out;
+};
+
+//! \brief Cached getattr reply for a fuse nodeid
+struct CachedAttr {
+  uint64_t expires; //!< CLOCK_MONOTONIC_COARSE nanoseconds
+  struct fuse_attr_out attr_out;
+};
+
+typedef std::unordered_map<EntryKey, CachedEntry, EntryKeyHash> EntryCacheMap;
+typedef std::unordered_map<uint64_t, CachedAttr> AttrCacheMap;
+
 class NodeNameRoot : public NodeName {
 public:
   static uint64_t entryValidsec;
@@ -38,6 +78,13 @@ public:
   static uint64_t rootEntryValidnsec;
   static uint64_t rootAttrValidsec;
   static uint64_t rootAttrValidnsec;
+  static uint64_t cacheLeasesec;         // 0 disables the lookup/getattr cache
+  static uint64_t cacheNegativeLeasesec; // 0 disables negative entries
+  static uint64_t cacheMaxEntries;
+  //! \brief Longest lease of metadata fshipd does not push invalidations
+  //!        for, changes made through other clients or directly on the
+  //!        server file system are seen at most this late
+  static const uint64_t cacheLeaseMaxsec = 5;
 
   const int MAXCHUNKSIZE = 64 * 1024;
   NodeNameRoot(char *dir);
@@ -181,6 +228,52 @@ public:
     return;
   }
 
+  //! \brief Metadata cache answering repeated lookups and getattrs locally
+  //! \note  Entries hold for the lease unless a mutating request from this
+  //!        client or an invalidation pushed by fshipd touches them.  Replies
+  //!        to lookups or getattrs sent before, or while, a mutation from
+  //!        this client is outstanding are not cached.  Replies fshipd pushes
+  //!        invalidations for hold for the configured lease.  Changes to
+  //!        anything else are only seen once the lease expires, so its lease
+  //!        is capped at cacheLeaseMaxsec.
+  int lookupCached(const uint64_t pUnique, const uint64_t pParent,
+                   const char *pName, struct fuse_entry_out &pEntryOut);
+  int getattrCached(const uint64_t pUnique, const uint64_t pInode,
+                    struct fuse_attr_out &pAttrOut);
+  //! \param pEntryOut  reply with local nodeids, NULL for a negative entry
+  //! \param pPushed    fshipd pushes an invalidation if the reply changes
+  void cacheLookup(const uint64_t pUnique, const uint64_t pParent,
+                   const char *pName, const struct fuse_entry_out *pEntryOut,
+                   const int pPushed = 0);
+  void cacheGetattr(const uint64_t pUnique, const uint64_t pInode,
+                    const struct fuse_attr_out &pAttrOut,
+                    const int pPushed = 0);
+  //! \brief Remember a request whose reply fills the cache
+  void cacheNoteRequest(const uint64_t pUnique);
+  //! \brief Fill entries and attributes from a readdirplus window
+  //! \param pBuffer  fuse_direntplus records with local nodeids
+  void cacheReaddirPlus(const uint64_t pUnique, const uint64_t pParent,
+                        const char *pBuffer, const size_t pSize);
+  //! \brief Drop what a mutating request changes before it is sent
+  //! \param pInode  node whose attributes change, 0 if none
+  //! \param pParent directory of the changed name, 0 if none
+  void cacheInvalidate(const uint64_t pUnique, const uint64_t pInode,
+                       const uint64_t pParent = 0, const char *pName = NULL);
+  //! \brief Drop what an invalidation pushed by fshipd names
+  //! \param pCode    FSHIP_INVAL_* code
+  //! \param pNodeid  directory of the name, or the node
+  //! \param pName    name for FSHIP_INVAL_ENTRY
+  //! \return nodeid the dropped name was cached for, 0 if none
+  uint64_t cachePushedInvalidate(const uint32_t pCode, const uint64_t pNodeid,
+                                 const char *pName);
+  //! \brief A reply was sent to fuse for the request
+  void cacheReplied(const uint64_t pUnique);
+  int cacheEnabled() { return (cacheLeasesec || cacheNegativeLeasesec); }
+  //! \brief Set the leases, replies not covered by pushed invalidations are
+  //!        cached for at most cacheLeaseMaxsec
+  static void setCacheLeases(const uint64_t pLeasesec,
+                             const uint64_t pNegativeLeasesec);
+
   int forgetNode(const __ino64_t pInode, const uint64_t pNlookup);
   void rmdirNode(const __ino64_t pInode);
 
@@ -272,6 +365,23 @@ private:
   // lock presumed
   void insertIntoMap(NodeNamePTR nnp);
 
+private:
+  static uint64_t cacheNow() {
+    struct timespec l_now;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &l_now);
+    return (uint64_t)l_now.tv_sec * 1000000000ULL + l_now.tv_nsec;
+  }
+  static uint64_t cacheLease(const uint64_t pLease, const int pPushed) {
+    return pPushed ? pLease : std::min(pLease, cacheLeaseMaxsec);
+  }
+  // lock presumed
+  int cacheFillAllowed(const uint64_t pUnique);
+  void cacheSweepNoLock(const uint64_t pNow);
+  void cacheEntryNoLock(const EntryKey &pKey,
+                        const struct fuse_entry_out &pEntryOut,
+                        const uint64_t pExpires);
+  void invalidateEntryNoLock(const uint64_t pParent, const char *pName);
+
 protected:
   pthread_mutex_t _mutex; // control access to avoid race conditions
   txp::MemChunkPtr _memChunkPtr;
@@ -279,6 +389,12 @@ protected:
   NodeNameMap _FileMap;  // not a directory but a regular file or sym link
   NodeNameMap _AliasMap; // alias remote node ID to fshipcld nodeid
   unsigned char _readdir_d_type; // file system supports type field?
+
+  EntryCacheMap _entryCache;
+  AttrCacheMap _attrCache;
+  uint64_t _cacheGeneration; // bumped whenever cached metadata may be stale
+  std::unordered_map<uint64_t, uint64_t> _cachePending; // unique, generation
+  std::unordered_set<uint64_t> _cacheMutations; // outstanding mutating uniques
 };
 
 typedef NodeNameRoot *NodeNameRootPTR;
@@ -26,6 +26,9 @@
 #include <errno.h>
 #include <linux/fuse.h>
 #include "NodeNameNetworkedRoot.h"
+#include "FuseChannelMap.h"
+#include "FuseNotifier.h"
+#include <sys/uio.h>
 
 /*
 txp::Attribute* retrieveAttr(const int32_t pNameValue);
@@ -38,11 +41,12 @@ typedef AttrMap::iterator AttrMapIterator;
 class ResponseHandler {
 public:
   ResponseHandler(NodeNameNetworkedRoot *pRootNodePtr,
-                  txp::ConnexPtr pConnectPtr, int &pFuseFD,
+                  txp::ConnexPtr pConnectPtr, FuseChannelMap &pChannelMap,
                   int &pPipe2FuseReader)
       : _HEADERLENGTH(txp::OFFSET_TO_FIRST_ATTRIBUTE),
         _rootNodePtr(pRootNodePtr), _connectPtr(pConnectPtr),
-        _deviceFD(pFuseFD), _pipe2FuseReader(pPipe2FuseReader) {
+        _channelMap(pChannelMap), _pipe2FuseReader(pPipe2FuseReader),
+        _notifier(pChannelMap) {
     txp::Log _txplog(txp::Log::OPEN); // writes to stdout
     _clientMajor4Msg = 0;
     _clientMinor4Msg = 0;
@@ -103,9 +107,23 @@ private:
   __s64 setlkwOp(txp::Msg *pMsg);
   __s64 getlkOp(txp::Msg *pMsg);
   __s64 signal(txp::Msg *pMsg);
+  __s64 invalidateOp(txp::Msg *pMsg);
 
   __s64 writedeviceFD(outMsgGeneric *outMsg, uint32_t opcode);
 
+  //! \brief Write a reply on the fuse channel its request was read from
+  //! \note  Every reply starts with a fuse_out_header
+  ssize_t replyWrite(const void *pBuf, size_t pLen) {
+    __u64 l_unique = ((const struct fuse_out_header *)pBuf)->unique;
+    _rootNodePtr->cacheReplied(l_unique);
+    return write(_channelMap.replyFD(l_unique), pBuf, pLen);
+  }
+  ssize_t replyWritev(const struct iovec *pIov, int pIovcnt) {
+    __u64 l_unique = ((const struct fuse_out_header *)pIov->iov_base)->unique;
+    _rootNodePtr->cacheReplied(l_unique);
+    return writev(_channelMap.replyFD(l_unique), pIov, pIovcnt);
+  }
+
   void dump2txplog(char *buff, int buffSize) {
     txp::Log::dump_buffer_raw(_txplog, buff, buffSize, "dumpbuffer");
   };
@@ -121,10 +139,11 @@ private:
   uint64_t _clientPid;
   int _clientMajor4Msg;
   int _clientMinor4Msg;
-  int &_deviceFD;
+  FuseChannelMap &_channelMap;
   int &_pipe2FuseReader;
   char *_mountPath;
   txp::Log _txplog;
+  FuseNotifier _notifier; //!< invalidations pushed by fshipd to fuse
 
   // for using file in future
   // txp::Log d_log(txp::Log::LOGFILE, "fshipcld.log");
@@ -92,6 +92,15 @@ typedef struct outMsgInvalEntryNotify{
         outMsgInvalEntryNotify(){ notify.len=sizeof(outMsgInvalEntryNotify); notify.unique=0; notify.error=FUSE_NOTIFY_INVAL_ENTRY;}
 }outMsgInvalEntryNotify;
 
+// invalidates the attributes of the node and its cached data from off for len
+// (to the end if len is 0)
+// if no kernel inode, ENOENT is returned
+typedef struct outMsgInvalInodeNotify{
+        fuse_out_notify notify;
+        fuse_notify_inval_inode_out inval_inode_out;
+        outMsgInvalInodeNotify(uint64_t in_ino){ notify.len=sizeof(outMsgInvalInodeNotify); notify.unique=0; notify.error=FUSE_NOTIFY_INVAL_INODE; inval_inode_out.ino=in_ino; inval_inode_out.off=0; inval_inode_out.len=0;}
+}outMsgInvalInodeNotify;
+
 typedef struct inMsgGeneric {
 	struct fuse_in_header hdr;
 	char argsIn[0];
@@ -527,6 +536,17 @@ typedef struct inHello{
         uint32_t openOutFlags;
 } inHello;
 
+/* Codes of the CORAL_INVALIDATE pushes from fshipd, in the notify attribute.
+   A client asks for them with a notify attribute in CORAL_HELLO. Lookup and
+   getattr replies carry a notify attribute if a change of what they return
+   will be pushed. */
+enum {
+	FSHIP_INVAL_ENTRY = 1,	/* name in the directory nodeid */
+	FSHIP_INVAL_ATTR = 2,	/* attributes of the node nodeid */
+	FSHIP_INVAL_DIR = 3,	/* every name in the directory nodeid */
+	FSHIP_INVAL_ALL = 4	/* everything, changes were lost */
+};
+
 typedef struct outHello{
         int outHelloVersion;
 	int fuse_version_major;
@@ -19,7 +19,9 @@
 #include "fshipcld_flightlog.h"
 #include "fshipmount.h"
 #include "logging.h"
+#include <sched.h>
 #include <stdio.h>
+#include <sys/ioctl.h>
 #include <sys/mount.h>
 #include "../include/FshipFuseOpsHandler.h"
 
@@ -45,6 +47,8 @@ FshipFuseOpsHandler::~FshipFuseOpsHandler() {
     delete[] _remotePath;
     _remotePath = 0;
   }
+  for (size_t i = 1; i < _channels.size(); i++)
+    close(_channels[i].fd);
   if (_mountDir) {
     close(_deviceFD);
     unmountDevice();
@@ -70,9 +74,9 @@ void FshipFuseOpsHandler::createNodeNameRoot(const char *pRemoteMount) {
 FshipFuseOpsHandler::FshipFuseOpsHandler(txp::ConnexPtr pConnectPtr,
                                      char *pMountDir, char *pRemoteMount)
     : _connectPtr(pConnectPtr) 
-      ,last_unique(0)
       ,_max_read(0)
       ,_deviceFD(-1)
+      ,_channelMap(_deviceFD)
 {
   _rootNodePtr = new NodeNameNetworkedRoot(
       pMountDir, pRemoteMount); // need for FshipFuseOpsHandler & ResponseHandler
@@ -97,6 +101,7 @@ FshipFuseOpsHandler::FshipFuseOpsHandler(txp::ConnexPtr pConnectPtr,
 
   _signalPipeThread = 0;
   _responseHandlerThread = 0;
+  _numChannels = 1;
   _fuseReadState = disconnectedState;
   for(unsigned int i=0;i<ARRAY_SIZE_FUNC_OP; i++) _FshipFuseOp[i]=&FshipFuseOpsHandler::errENOSYS;  //default to ENOSYS for a fuse opcode
   _FshipFuseOp[FUSE_LOOKUP] = &FshipFuseOpsHandler::lookup_op;
@@ -150,7 +155,8 @@ FshipFuseOpsHandler::FshipFuseOpsHandler(txp::ConnexPtr pConnectPtr,
 }
 
 FshipFuseOpsHandler::FshipFuseOpsHandler()
-    : _mountDir(NULL), _connectPtr(NULL), _remotePath(NULL), _rootNodePtr(NULL)
+    : _mountDir(NULL), _connectPtr(NULL), _remotePath(NULL), _rootNodePtr(NULL),
+      _deviceFD(-1), _channelMap(_deviceFD)
 
 {
   _numChunks = 8;
@@ -164,6 +170,7 @@ FshipFuseOpsHandler::FshipFuseOpsHandler()
 
   _signalPipeThread = 0;
   _responseHandlerThread = 0;
+  _numChannels = 1;
   _fuseReadState = disconnectedState;
   for(unsigned int i=0;i<ARRAY_SIZE_FUNC_OP; i++) _FshipFuseOp[i]=&FshipFuseOpsHandler::errENOSYS;  //default to ENOSYS for a fuse opcode
   _FshipFuseOp[FUSE_LOOKUP] = &FshipFuseOpsHandler::lookup_op;
@@ -501,6 +508,192 @@ void *FshipFuseOpsHandler::startResponseHandler(void *object) {
   return NULL;
 }
 
+int FshipFuseOpsHandler::cloneDevice() {
+  int l_FD = open("/dev/fuse", O_RDWR | O_NONBLOCK | O_CLOEXEC);
+  if (l_FD < 0)
+    return -errno;
+  uint32_t l_deviceFD = _deviceFD;
+  if (ioctl(l_FD, FUSE_DEV_IOC_CLONE, &l_deviceFD)) {
+    int l_errno = errno;
+    close(l_FD);
+    return -l_errno;
+  }
+  return l_FD;
+}
+
+// return number of channels opened
+int FshipFuseOpsHandler::openChannels() {
+  std::vector<int> l_cpuList;
+  if (_numChannels > 1) {
+    cpu_set_t l_cpus;
+    CPU_ZERO(&l_cpus);
+    if (!sched_getaffinity(0, sizeof(l_cpus), &l_cpus)) {
+      for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        if (CPU_ISSET(cpu, &l_cpus))
+          l_cpuList.push_back(cpu);
+    }
+  }
+
+  FuseChannel l_Channel;
+  l_Channel.handler = this;
+  l_Channel.fd = _deviceFD;
+  l_Channel.cpu = -1;
+  l_Channel.thread = 0;
+  l_Channel.last_unique = 0;
+  _channels.push_back(l_Channel);
+  for (int i = 1; i < _numChannels; i++) {
+    l_Channel.fd = cloneDevice();
+    if (l_Channel.fd < 0) {
+      LOG(fshipcld, error) << "clone of fuse device fd=" << _deviceFD
+                           << " errno=" << -l_Channel.fd << ":"
+                           << strerror(-l_Channel.fd) << ", reading "
+                           << _channels.size() << " channel(s)";
+      break;
+    }
+    _channels.push_back(l_Channel);
+  }
+
+  if ((_channels.size() > 1) && (l_cpuList.size())) {
+    for (size_t i = 0; i < _channels.size(); i++)
+      _channels[i].cpu = l_cpuList[i % l_cpuList.size()];
+  }
+  // every reader keeps a chunk for the header of the message it reads
+  if ((int)_channels.size() > _numChunks) {
+    delete _readChunksPtr;
+    _numChunks = _channels.size();
+    _readChunksPtr = new txp::MemChunk(_numChunks, _chunkSizeRead);
+  }
+  _channelMap.setMultiChannel(_channels.size() > 1);
+
+  for (size_t i = 0; i < _channels.size(); i++)
+    LOG(fshipcld, always) << "fuse channel fd=" << _channels[i].fd
+                          << " cpu=" << _channels[i].cpu;
+  return _channels.size();
+}
+
+void FshipFuseOpsHandler::pinChannel(FuseChannel &pChannel) {
+  if (pChannel.cpu < 0)
+    return;
+  cpu_set_t l_cpus;
+  CPU_ZERO(&l_cpus);
+  CPU_SET(pChannel.cpu, &l_cpus);
+  int l_RC = pthread_setaffinity_np(pthread_self(), sizeof(l_cpus), &l_cpus);
+  if (l_RC)
+    LOG(fshipcld, always) << "pinning fuse channel fd=" << pChannel.fd
+                          << " to cpu=" << pChannel.cpu << " rc=" << l_RC
+                          << ":" << strerror(l_RC);
+}
+
+void FshipFuseOpsHandler::stopChannels() {
+  if (_fuseReadState == activeState)
+    _fuseReadState = disconnectPending;
+  for (size_t i = 1; i < _channels.size(); i++) {
+    if (_channels[i].thread) {
+      pthread_join(_channels[i].thread, NULL);
+      _channels[i].thread = 0;
+    }
+  }
+}
+
+// read and process messages until the channel would block
+// return 0 or -errno
+int FshipFuseOpsHandler::readChannel(FuseChannel &pChannel, memItemPtr mip) {
+  int rc = 0;
+  ssize_t rc_ssize = 1;
+  while (rc_ssize > 0) {
+    if (!mip->next) {
+      mip->next = _connectPtr->getRDMAChunk();
+      if (__glibc_unlikely(!mip->next)) {
+        sayError((char *)"NULL from getRDMAChunk--timeout");
+        assert(mip != NULL);
+      }
+    }
+    rc_ssize = readFuseMessage(pChannel, mip);
+
+    if (__glibc_unlikely(rc_ssize < 0)) {
+      rc = 0;
+      if (-rc_ssize == EWOULDBLOCK)
+        break;
+      if (-rc_ssize == EINTR) {
+
+        break;
+      }
+      /* clang-format off */ 
+      FL_Write(FL_FUSE, FUSEREADERR, "Fuse read error %ld line=%ld", rc_ssize, __LINE__,0,0);
+      /* clang-format on */
+      rc = rc_ssize;
+      break;
+    }
+    if (__glibc_likely(rc_ssize > 0)) {
+      inMsgGeneric *in = (inMsgGeneric *)mip->address;
+      /* clang-format off */ 
+      FL_Write6(FL_FUSE, FUSEMSG, "Fuse Message opcode=%ld length=%ld unique=%ld nodeid=%ld uid=%ld pid=%ld", in->hdr.opcode, in->hdr.len, in->hdr.unique, in->hdr.nodeid, in->hdr.uid, in->hdr.pid);
+      /* clang-format on */
+      // if (rc_ssize>65536) LOG(fshipcld,always)<< "hex
+      // len="<<std::hex<<in->hdr.len<<" dec="<<std::dec<<in->hdr.len;
+
+      // before processing, the reply may be written by the response handler
+      _channelMap.route(in->hdr, pChannel.fd);
+
+      if (in->hdr.opcode == FUSE_WRITE)
+        write_op(mip);
+      else if (in->hdr.opcode == FUSE_READ)
+        read_op(mip);
+      else
+        (this->*_FshipFuseOp[in->hdr.opcode])(in);  
+        //processMsg(in);
+
+      memset(in, 0, sizeof(inMsgGeneric));
+    }
+  }
+  return rc;
+}
+
+void *FshipFuseOpsHandler::startChannelReader(void *object) {
+  FuseChannel *l_Channel = (FuseChannel *)object;
+  l_Channel->handler->channelReader(*l_Channel);
+  return NULL;
+}
+
+// reader for a cloned channel, the main thread reads the device descriptor
+void FshipFuseOpsHandler::channelReader(FuseChannel &pChannel) {
+  pinChannel(pChannel);
+  memItemPtr mip =
+      _readChunksPtr->getChunk(); // get memorychunk for read of header
+
+  struct pollfd pollInfo;
+  pollInfo.fd = pChannel.fd;
+  pollInfo.events = POLLIN;
+  int rc = 0;
+  // not woken by the wakeup pipe, time out to notice the daemon quiescing
+  const int channel_wait_timeout = 1000;
+  while ((rc >= 0) && (_fuseReadState == activeState)) {
+    pollInfo.revents = 0;
+    rc = poll(&pollInfo, 1, channel_wait_timeout);
+    if (__glibc_unlikely(rc == -1)) {
+      if (errno != EINTR) {
+        rc = -errno;
+        break;
+      }
+      rc = 0;
+      continue;
+    }
+    if (!rc)
+      continue;
+    if (pollInfo.revents & (POLLERR | POLLHUP | POLLNVAL)) { // error!
+      /* clang-format off */ 
+      FL_Write(FL_FUSE, FUSECHANPOLLEND, "Fuse channel fd=%ld POLLERR|POLLHUP|POLLNVAL revents=%lx", pChannel.fd, pollInfo.revents, 0,0);
+      /* clang-format on */
+      rc = -1;
+      break;
+    }
+    rc = readChannel(pChannel, mip);
+  }
+
+  LOG(fshipcld, always) << "fuse channel fd=" << pChannel.fd
+                        << " reader ending with rc=" << rc;
+}
+
 int FshipFuseOpsHandler::readMonitorFuseDevice() {
   // Need a running ResponseHandler
   int RCpipe2 = pipe2(_pipe_descriptor, O_DIRECT | O_NONBLOCK);
@@ -512,7 +705,7 @@ int FshipFuseOpsHandler::readMonitorFuseDevice() {
                        << _pipe_descriptor[0] << " [1]=" << _pipe_descriptor[1];
   if (!_responseHandlerPtr)
     _responseHandlerPtr = new ResponseHandler(_rootNodePtr, _connectPtr,
-                                              _deviceFD, _pipe_descriptor[1]);
+                                              _channelMap, _pipe_descriptor[1]);
   assert(_pipe_descriptor[1] == writePipeFd());
   assert(_pipe_descriptor[1] > 0);
 
@@ -528,6 +721,17 @@ int FshipFuseOpsHandler::readMonitorFuseDevice() {
                      FshipFuseOpsHandler::startProcessSignalPipe, this);
   if (RCpthreadsignal)
     abort();
+
+  openChannels();
+  for (size_t i = 1; i < _channels.size(); i++) {
+    int RCpthreadchannel =
+        pthread_create(&_channels[i].thread, NULL,
+                       FshipFuseOpsHandler::startChannelReader, &_channels[i]);
+    if (RCpthreadchannel)
+      abort();
+  }
+  pinChannel(_channels[0]);
+
   memItemPtr mip =
       _readChunksPtr->getChunk(); // get memorychunk for read of header
 
@@ -536,7 +740,7 @@ int FshipFuseOpsHandler::readMonitorFuseDevice() {
   const int numFds = 2;
 
   struct pollfd pollInfo[numFds];
-  pollInfo[fuseDevice].fd = _deviceFD;
+  pollInfo[fuseDevice].fd = _channels[0].fd;
   pollInfo[fuseDevice].events = POLLIN;
   pollInfo[fuseDevice].revents = 0;
   pollInfo[wakeupPipe].fd = readPipeFd();
@@ -544,7 +748,6 @@ int FshipFuseOpsHandler::readMonitorFuseDevice() {
   pollInfo[wakeupPipe].revents = 0;
   LOG(fshipcld, always) << "wakup fd =" << pollInfo[wakeupPipe].fd;
   int rc = 0;
-  int rc_ssize = 0;
   int connect_wait_timeout =
       -1; // minimum number of milliseconds poll will block -1=forever
   while (rc >= 0) {
@@ -571,6 +774,7 @@ int FshipFuseOpsHandler::readMonitorFuseDevice() {
       if (__glibc_likely(pipeRead > 0)) {
         LOG(fshipcld, always) << "wakeupPipe id=" << wPM.id;
         if (wPM.id == WAKEUP_RESPONSETHREADEND) {
+          stopChannels();
           return 0;
         } else {
           pollInfo[fuseDevice].events = 0; // stop polling the fuse device
@@ -590,53 +794,11 @@ int FshipFuseOpsHandler::readMonitorFuseDevice() {
       rc = -1;
       break;
     }
-    rc_ssize = 1;
-    while (rc_ssize > 0) {
-      if (!mip->next) {
-        mip->next = _connectPtr->getRDMAChunk();
-        if (__glibc_unlikely(!mip->next)) {
-          sayError((char *)"NULL from getRDMAChunk--timeout");
-          assert(mip != NULL);
-        }
-      }
-      rc_ssize = readFuseMessage(mip);
-
-      if (__glibc_unlikely(rc_ssize < 0)) {
-        rc = 0;
-        if (-rc_ssize == EWOULDBLOCK)
-          break;
-        if (-rc_ssize == EINTR) {
-
-          break;
-        }
-        /* clang-format off */ 
-        FL_Write(FL_FUSE, FUSEREADERR, "Fuse read error %ld line=%ld", rc_ssize, __LINE__,0,0);
-        /* clang-format on */
-        rc = rc_ssize;
-        break;
-      }
-      if (__glibc_likely(rc_ssize > 0)) {
-        pollInfo[fuseDevice].revents = 0;
-        inMsgGeneric *in = (inMsgGeneric *)mip->address;
-        /* clang-format off */ 
-        FL_Write6(FL_FUSE, FUSEMSG, "Fuse Message opcode=%ld length=%ld unique=%ld nodeid=%ld uid=%ld pid=%ld", in->hdr.opcode, in->hdr.len, in->hdr.unique, in->hdr.nodeid, in->hdr.uid, in->hdr.pid);
-        /* clang-format on */
-        // if (rc_ssize>65536) LOG(fshipcld,always)<< "hex
-        // len="<<std::hex<<in->hdr.len<<" dec="<<std::dec<<in->hdr.len;
-
-        if (in->hdr.opcode == FUSE_WRITE)
-          write_op(mip);
-        else if (in->hdr.opcode == FUSE_READ)
-          read_op(mip);
-        else
-          (this->*_FshipFuseOp[in->hdr.opcode])(in);  
-          //processMsg(in);
-
-        memset(in, 0, sizeof(inMsgGeneric));
-      }
-    }
+    pollInfo[fuseDevice].revents = 0;
+    rc = readChannel(_channels[0], mip);
   }
 
+  stopChannels();
   LOG(fshipcld, error)
       << "FshipFuseOpsHandler::readMonitorFuseDevice(): Ending with rc=" << rc;
   return rc;
@@ -780,6 +942,9 @@ __s64 FshipFuseOpsHandler::sayHello(inMsgInit *inMsg) {
 
   trackPath.addStruct(txp::inHello, &l_Hello, sizeof(l_Hello));
   trackPath.addString(txp::name, _remotePath);
+  // cached metadata holds past cacheLeaseMaxsec if fshipd pushes its changes
+  if (_rootNodePtr->cacheEnabled())
+    trackPath.addUint32(txp::notify, 1);
 
   ssize_t retSSize = trackPath.sendMsg(_connectPtr);
   if (retSSize == -1) {
@@ -848,6 +1013,7 @@ __s64 FshipFuseOpsHandler::setattr_op(inMsgGeneric *in) {
   inMsgSetattr *inMsg = (inMsgSetattr *)in;
   uint64_t l_remoteNodeID = 0;
   TrackPathFreeMsg trackPath(txp::FUSE_SETATTR);
+  _rootNodePtr->cacheInvalidate(in->hdr.unique, in->hdr.nodeid);
   trackPath.addFuseHeaderItems(in);
   if (!(inMsg->setattr_in.valid & FATTR_FH)) {
     l_remoteNodeID = trackPath.addFQPN(_rootNodePtr, txp::name);
@@ -882,6 +1048,10 @@ __s64 FshipFuseOpsHandler::getattr_op(inMsgGeneric *in) {
   if (inMsg->getattr_in.getattr_flags & FUSE_GETATTR_FH) { // Use file-handle
     trackPath.addFD2msg(txp::fh, inMsg->getattr_in.fh);
   } else {
+    outMsgGetattr outMsg(in->hdr.unique);
+    if (_rootNodePtr->getattrCached(in->hdr.unique, in->hdr.nodeid,
+                                    outMsg.getattr_out))
+      return sendOutMsg(outMsg.hdr);
     l_remoteNodeID = trackPath.addFQPN(_rootNodePtr, txp::name);
     if (!l_remoteNodeID) {
       retval = error_send(in, -ENOENT);
@@ -998,6 +1168,8 @@ __s64 FshipFuseOpsHandler::open_op(inMsgGeneric *in) {
   FL_Write6(FL_fshipcldfuseop, OPEN, "open_op=%ld  unique=%ld nodeid=%ld line=%ld", in->hdr.opcode, in->hdr.unique, in->hdr.nodeid,__LINE__,0,0);
   /* clang-format on */
   TrackPathFreeMsg trackPath(txp::FUSE_OPEN);
+  if (inMsg->open_in.flags & O_TRUNC)
+    _rootNodePtr->cacheInvalidate(in->hdr.unique, in->hdr.nodeid);
   trackPath.addFuseHeaderItems(in);
   trackPath.addFQPN(_rootNodePtr, txp::name);
   trackPath.addUint32(txp::flags, inMsg->open_in.flags);
@@ -1036,6 +1208,10 @@ __s64 FshipFuseOpsHandler::lookup_op(inMsgGeneric *in) {
   FL_Write6(FL_fshipcldfuseop, LOOKUP, "lookup_op=%ld  unique=%ld nodeid=%ld line=%ld", in->hdr.opcode, in->hdr.unique, in->hdr.nodeid,__LINE__,0,0);
   /* clang-format on */
   LOG(fshipcld, debug) << "lookupname=" << inMsg->lookupname;
+  outMsgLookup outMsg(in->hdr.unique);
+  if (_rootNodePtr->lookupCached(in->hdr.unique, in->hdr.nodeid,
+                                 inMsg->lookupname, outMsg.entry_out))
+    return sendOutMsg(outMsg.hdr);
   TrackPathFreeMsg trackPath(txp::FUSE_LOOKUP, inMsg->lookupname);
   trackPath.addFuseHeaderItems(in);
   trackPath.addPath2Msg4lookup(_rootNodePtr, txp::name);
@@ -1056,6 +1232,8 @@ __s64 FshipFuseOpsHandler::create_op(inMsgGeneric *in) {
   /* clang-format on */
 
   LOG(fshipcld, debug) << "create name=" << inMsg->name;
+  _rootNodePtr->cacheInvalidate(in->hdr.unique, 0, in->hdr.nodeid,
+                                inMsg->name);
   TrackPathFreeMsg trackPath(txp::FUSE_CREATE, inMsg->name);
   trackPath.addFuseHeaderItems(in);
   trackPath.addPath2Msg4lookup(_rootNodePtr, txp::name);
@@ -1079,6 +1257,8 @@ __s64 FshipFuseOpsHandler::mknod_op(inMsgGeneric *in) {
   /* clang-format on */
 
   LOG(fshipcld, debug) << "create name=" << inMsg->name;
+  _rootNodePtr->cacheInvalidate(in->hdr.unique, 0, in->hdr.nodeid,
+                                inMsg->name);
   TrackPathFreeMsg trackPath(txp::FUSE_MKNOD, inMsg->name);
   trackPath.addFuseHeaderItems(in);
   trackPath.addPath2Msg4lookup(_rootNodePtr, txp::name);
@@ -1101,6 +1281,8 @@ __s64 FshipFuseOpsHandler::mkdir_op(inMsgGeneric *in) {
   FL_Write6(FL_fshipcldfuseop, MKDIR, "mkdir_op=%ld octal mode=%lo unique=%ld nodeid=%ld origMode=%lo umask=%lo", in->hdr.opcode, (uint64_t)mode, in->hdr.unique, in->hdr.nodeid, inMsg->mkdir_in.mode,inMsg->mkdir_in.umask);
   /* clang-format on */
   LOG(fshipcld, debug) << "mkdir name=" << inMsg->name;
+  _rootNodePtr->cacheInvalidate(in->hdr.unique, 0, in->hdr.nodeid,
+                                inMsg->name);
   TrackPathFreeMsg trackPath(txp::FUSE_MKDIR, inMsg->name);
   trackPath.addFuseHeaderItems(in);
   trackPath.addPath2Msg4lookup(_rootNodePtr, txp::name);
@@ -1122,6 +1304,8 @@ __s64 FshipFuseOpsHandler::rmdir_op(inMsgGeneric *in) {
   FL_Write6(FL_fshipcldfuseop, RMDIR,  "rmdir_op=%ld  unique=%ld nodeid=%ld line=%ld", in->hdr.opcode, in->hdr.unique, in->hdr.nodeid,__LINE__,0,0);
   /* clang-format on */
   LOG(fshipcld, debug) << "rmdir name=" << inMsg->unlinkatname;
+  _rootNodePtr->cacheInvalidate(in->hdr.unique, 0, in->hdr.nodeid,
+                                inMsg->unlinkatname);
   TrackPathFreeMsg trackPath(txp::FUSE_RMDIR, inMsg->unlinkatname);
   trackPath.addFuseHeaderItems(in);
   trackPath.addPath2Msg4lookup(_rootNodePtr, txp::name);
@@ -1142,6 +1326,8 @@ __s64 FshipFuseOpsHandler::unlink_op(inMsgGeneric *in) {
   FL_Write6(FL_fshipcldfuseop, UNLINK,  "unlink_op=%ld  unique=%ld nodeid=%ld line=%ld", in->hdr.opcode, in->hdr.unique, in->hdr.nodeid,__LINE__,0,0);
   /* clang-format on */
   LOG(fshipcld, debug) << "unlink name=" << inMsg->unlinkatname;
+  _rootNodePtr->cacheInvalidate(in->hdr.unique, 0, in->hdr.nodeid,
+                                inMsg->unlinkatname);
   TrackPathFreeMsg trackPath(txp::FUSE_UNLINK, inMsg->unlinkatname);
   trackPath.addFuseHeaderItems(in);
   trackPath.addPath2Msg4lookup(_rootNodePtr, txp::name);
@@ -1178,6 +1364,10 @@ __s64 FshipFuseOpsHandler::rename_op(inMsgGeneric *in) {
 
   int nextname = strlen(inMsg->oldname) + 1;
   char *newName = inMsg->oldname + nextname;
+  _rootNodePtr->cacheInvalidate(in->hdr.unique, 0, in->hdr.nodeid,
+                                inMsg->oldname);
+  _rootNodePtr->cacheInvalidate(in->hdr.unique, 0, inMsg->newdirInode,
+                                newName);
 
   TrackPathNoFreeMsg trackPath2(newName, trackPath.getMsgPtr());
   trackPath2.setOffsetAttr2lastName(txp::offset2newname);
@@ -1203,6 +1393,8 @@ __s64 FshipFuseOpsHandler::link_op(inMsgGeneric *in) {
   inMsgLink *inMsg = (inMsgLink *)in;
 
   LOG(fshipcld, debug) << "link_op new name=" << inMsg->newname;
+  _rootNodePtr->cacheInvalidate(in->hdr.unique, inMsg->link_in.oldnodeid,
+                                in->hdr.nodeid, inMsg->newname);
   TrackPathFreeMsg trackPath(txp::FUSE_LINK, inMsg->newname);
   trackPath.addFuseHeaderItems(in);
   trackPath.addPath2Msg4lookup(_rootNodePtr, txp::newname);
@@ -1239,6 +1431,8 @@ __s64 FshipFuseOpsHandler::symlink_op(inMsgGeneric *in) {
   FL_Write6(FL_fshipcldfuseop, SYMLINK,  "link_op=%ld  unique=%ld nodeid=%ld line=%ld", in->hdr.opcode, in->hdr.unique, in->hdr.nodeid,__LINE__,0,0);
   /* clang-format on */
   LOG(fshipcld, debug) << "symlink_op new name=" << inMsg->newname;
+  _rootNodePtr->cacheInvalidate(in->hdr.unique, 0, in->hdr.nodeid,
+                                inMsg->newname);
   TrackPathFreeMsg trackPath(txp::FUSE_SYMLINK, inMsg->newname);
   trackPath.setOffsetAttr2lastName(txp::offset2newname);
   trackPath.addFuseHeaderItems(
@@ -1304,7 +1498,8 @@ __s64 FshipFuseOpsHandler::statfs_op(inMsgGeneric *in) {
   outMsg.kstatfs.namelen = 255;
   outMsg.kstatfs.frsize = 65536;
   outMsg.kstatfs.bsize = 65536;
-  return (__s64)write(_deviceFD, &outMsg, outMsg.hdr.len);
+  return (__s64)write(_channelMap.replyFD(outMsg.hdr.unique), &outMsg,
+                      outMsg.hdr.len);
 }
 
 __s64 FshipFuseOpsHandler::interrupt_op(inMsgGeneric *in) {
@@ -1358,6 +1553,7 @@ __s64 FshipFuseOpsHandler::readdirplus_op(inMsgGeneric *in) {
   /* clang-format off */ 
   FL_Write6(FL_fshipcldfuseop, READDIRPLUS,  "readdirplus_op=%ld  unique=%ld nodeid=%ld line=%ld", in->hdr.opcode, in->hdr.unique, in->hdr.nodeid,__LINE__,0,0);
   /* clang-format on */
+  _rootNodePtr->cacheNoteRequest(in->hdr.unique);
   ssize_t retSSize = trackPath.sendMsg(_connectPtr);
   if (retSSize == -1) {
     LOGERRNO(fshipcld, error, errno);
@@ -1441,6 +1637,7 @@ __s64 FshipFuseOpsHandler::write_op(inMsgPwrite *inMsg, char *writeData) {
   inMsgGeneric *in = (inMsgGeneric *)inMsg;
   txp::Msg *l_Msg = 0;
   txp::Msg::buildMsg(txp::FUSE_WRITE, l_Msg);
+  _rootNodePtr->cacheInvalidate(in->hdr.unique, in->hdr.nodeid);
 
   int l_RC = addFuseHeaderItems(l_Msg, in);
   // printf("write_op(inMsgPwrite>>>>write_op=%d  unique=%ld nodeid=%ld size=%d
@@ -1479,6 +1676,7 @@ __s64 FshipFuseOpsHandler::write_op(memItemPtr mipfromRead) {
   inMsgGeneric *in = (inMsgGeneric *)mipfromRead->address;
   txp::Msg *l_Msg = 0;
   txp::Msg::buildMsg(txp::FUSE_WRITE, l_Msg);
+  _rootNodePtr->cacheInvalidate(in->hdr.unique, in->hdr.nodeid);
   int l_RC = addFuseHeaderItems(l_Msg, in);
 
   /* clang-format off */ 
@@ -1551,6 +1749,7 @@ __s64 FshipFuseOpsHandler::fallocate_op(inMsgGeneric *in) {
   FL_Write6(FL_fshipcldfuseop, FALLOCATEOP,  "fallocate_op=%ld  unique=%ld nodeid=%ld line=%ld", in->hdr.opcode, in->hdr.unique, in->hdr.nodeid,__LINE__,0,0);
   /* clang-format on */
   TrackPathFreeMsg trackPath(txp::FUSE_FALLOCATE);
+  _rootNodePtr->cacheInvalidate(in->hdr.unique, in->hdr.nodeid);
   trackPath.addFuseHeaderItems(in);
   trackPath.addUint64(txp::fh, inMsg->fallocate_in.fh);
   trackPath.addUint64(txp::offset, inMsg->fallocate_in.offset);
@@ -1665,7 +1864,8 @@ __s64 FshipFuseOpsHandler::fsyncdir_op(inMsgGeneric *in) {
 }
 
 /* ssize_t read(int fd, void *buf, size_t count); */
-ssize_t FshipFuseOpsHandler::readFuseMessage(char *buf, size_t bufSize) {
+ssize_t FshipFuseOpsHandler::readFuseMessage(FuseChannel &pChannel, char *buf,
+                                             size_t bufSize) {
 
   inMsgGeneric *in = (inMsgGeneric *)buf;
 
@@ -1674,7 +1874,7 @@ ssize_t FshipFuseOpsHandler::readFuseMessage(char *buf, size_t bufSize) {
 
   if (bufSize < readSize)
     return (-EINVAL);
-  ssize_t retcode = read(_deviceFD, buf, bufSize);
+  ssize_t retcode = read(pChannel.fd, buf, bufSize);
   if (retcode == -1) {
     return -errno; // Let caller handle EINTR and EWOULDBLOCK
   }
@@ -1682,26 +1882,28 @@ ssize_t FshipFuseOpsHandler::readFuseMessage(char *buf, size_t bufSize) {
   if (retcode == 0)
     return 0;
   // retcode > 0, of course
-  last_unique++;
+  pChannel.last_unique++;
   if (retcode == in->hdr.len) {
     // clang-format off
         FL_Write6(FL_FUSE, FCL_INMSGFUSE,"op=%-3ld uniq=%-24ld nID=%-24ld uID=%-9ld gID=%-9ld pID=%ld", in->hdr.opcode,in->hdr.unique,in->hdr.nodeid,in->hdr.uid,in->hdr.gid, in->hdr.pid); 
     // clang-format on   
-        if (last_unique != in->hdr.unique){
+        if ((pChannel.last_unique != in->hdr.unique) &&
+            (!_channelMap.isMultiChannel())){
           // clang-format off 
-          FL_Write(FL_FUSE, VFS_SKIPPED, "last_unique=%lld unique=%lld uid=%lld gid=%lld pid=%lld", last_unique,in->hdr.unique,0,0 );
+          FL_Write(FL_FUSE, VFS_SKIPPED, "last_unique=%lld unique=%lld uid=%lld gid=%lld pid=%lld", pChannel.last_unique,in->hdr.unique,0,0 );
       // clang-format on
     }
-    last_unique = in->hdr.unique;
+    pChannel.last_unique = in->hdr.unique;
     return retcode;
   }
   if (retcode >= (signed)sizeof(struct fuse_in_header)) {
-    if (last_unique != in->hdr.unique) {
+    if ((pChannel.last_unique != in->hdr.unique) &&
+        (!_channelMap.isMultiChannel())) {
       // clang-format off
-          FL_Write(FL_FUSE, VFS_SKIPPED2, "last_unique=%lld unique=%lld uid=%lld gid=%lld pid=%lld", last_unique,in->hdr.unique,0,0 );
+          FL_Write(FL_FUSE, VFS_SKIPPED2, "last_unique=%lld unique=%lld uid=%lld gid=%lld pid=%lld", pChannel.last_unique,in->hdr.unique,0,0 );
       // clang-format on
     }
-    last_unique = in->hdr.unique;
+    pChannel.last_unique = in->hdr.unique;
     // clang-format off
         FL_Write6(FL_FUSE, VFS_READ2, "in->hdr.len=%lld, opcode=%lld unique=%lld uid=%lld gid=%lld pid=%lld", in->hdr.len, in->hdr.opcode,in->hdr.unique,in->hdr.uid,in->hdr.gid,in->hdr.pid );
     // clang-format on
@@ -1711,12 +1913,13 @@ ssize_t FshipFuseOpsHandler::readFuseMessage(char *buf, size_t bufSize) {
     // clang-format off
       FL_Write6(FL_FUSE, VFS_READE2BIG, "in->hdr.len=%lld, opcode=%lld unique=%lld uid=%lld gid=%lld pid=%lld", in->hdr.len, in->hdr.opcode,in->hdr.unique,in->hdr.uid,in->hdr.gid,in->hdr.pid );
     // clang-format on
+    _channelMap.route(in->hdr, pChannel.fd);
     error_send(in, -E2BIG); /*interrupt finished */
     return -E2BIG;
   }
   bufSize = in->hdr.len - retcode;
   buf += retcode;
-  retcode = read(_deviceFD, buf, bufSize);
+  retcode = read(pChannel.fd, buf, bufSize);
   if (retcode == (ssize_t)bufSize)
     return (in->hdr.len);
   if ((retcode < 0) && (errno != EINTR))
@@ -1726,7 +1929,8 @@ ssize_t FshipFuseOpsHandler::readFuseMessage(char *buf, size_t bufSize) {
   return -ENODATA;
 };
 
-ssize_t FshipFuseOpsHandler::readFuseMessage(memItemPtr mip) {
+ssize_t FshipFuseOpsHandler::readFuseMessage(FuseChannel &pChannel,
+                                             memItemPtr mip) {
   struct iovec iov[2]; // expect 2 buffers
   int iovcnt = sizeof(iov) / sizeof(struct iovec);
 
@@ -1743,21 +1947,22 @@ ssize_t FshipFuseOpsHandler::readFuseMessage(memItemPtr mip) {
   iov[1].iov_base = l_mip2nd->address;
   iov[1].iov_len = l_mip2nd->chunkSize;
 
-  ssize_t retcode = readv(_deviceFD, iov, iovcnt);
+  ssize_t retcode = readv(pChannel.fd, iov, iovcnt);
 
   if (retcode > 0) {
     if (retcode != in->hdr.len)
       abort(); // should not happen
 
-    last_unique++; // use this to watch for missing operations since fuse will
-                   // eat a unique ID if not enough buffer is provided and fails
-                   // to dmesg as such
-    if (last_unique != in->hdr.unique) {
+    pChannel.last_unique++; // use this to watch for missing operations since
+                            // fuse will eat a unique ID if not enough buffer
+                            // is provided and fails to dmesg as such
+    if ((pChannel.last_unique != in->hdr.unique) &&
+        (!_channelMap.isMultiChannel())) {
       // clang-format off
-      FL_Write(FL_FUSE, VFS_SKIPPED3, "last_unique=%lld unique=%lld uid=%lld gid=%lld pid=%lld", last_unique,in->hdr.unique,0,0 );
+      FL_Write(FL_FUSE, VFS_SKIPPED3, "last_unique=%lld unique=%lld uid=%lld gid=%lld pid=%lld", pChannel.last_unique,in->hdr.unique,0,0 );
       // clang-format on
     }
-    last_unique = in->hdr.unique;
+    pChannel.last_unique = in->hdr.unique;
     // clang-format off
     FL_Write6(FL_FUSE, FCL_INMSGFUSE2,"op=%-3ld uniq=%-24ld nID=%-24ld uID=%-9ld gID=%-9ld pID=%ld", in->hdr.opcode,in->hdr.unique,in->hdr.nodeid,in->hdr.uid,in->hdr.gid, in->hdr.pid);
     // clang-format on
@@ -1785,5 +1990,6 @@ __s64 FshipFuseOpsHandler::writedeviceFD(outMsgGeneric *outMsg, uint32_t opcode)
   // clang-format off
   FL_Write(FL_FUSE, FCL_BACK2FUSE,"op=%-3ld uniq=%-24ld len=%-12ld err=%-12ld  ", opcode,outMsg->hdr.unique,outMsg->hdr.len,outMsg->hdr.error);
   // clang-format on
-  return (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+  return (__s64)write(_channelMap.replyFD(outMsg->hdr.unique), outMsg,
+                      outMsg->hdr.len);
 }
@@ -12,14 +12,20 @@
  *******************************************************************************/
 
 #include "../include/NodeNameRoot.h"
+#include "fshipcld.h"
 #include "fshipcld_flightlog.h"
 #include "logging.h"
+#include <algorithm>
 
 // globally initialize in gcc .init
 uint64_t NodeNameRoot::entryValidsec = 0;
 uint64_t NodeNameRoot::entryValidnsec = 0;
 uint64_t NodeNameRoot::attrValidsec = 0;
 uint64_t NodeNameRoot::attrValidnsec = 0;
+uint64_t NodeNameRoot::cacheLeasesec = 0;
+uint64_t NodeNameRoot::cacheNegativeLeasesec = 0;
+uint64_t NodeNameRoot::cacheMaxEntries = 65536;
+const uint64_t NodeNameRoot::cacheLeaseMaxsec;
 
 int NodeNameRoot::forgetNode(const __ino64_t pInode, const uint64_t pNlookup) {
   if (pInode == FUSE_ROOT_ID)
@@ -28,6 +34,7 @@ int NodeNameRoot::forgetNode(const __ino64_t pInode, const uint64_t pNlookup) {
   _LOGLOCK;
   assert_perror(l_RC);
   int count = 0;
+  _attrCache.erase(pInode);
   NodeNameIterator it = _dirMap.find(pInode);
   if (__glibc_unlikely(it != _dirMap.end())) {
     NodeNamePTR nnp = it->second;
@@ -70,6 +77,7 @@ NodeNameRoot::NodeNameRoot(char *dir) : NodeName(FUSE_ROOT_ID, dir) {
   _readdir_d_type =
       0; // will do discovery on whether readdir type is UNKNOWN by file system
   _memChunkPtr = new txp::MemChunk(64, MAXCHUNKSIZE);
+  _cacheGeneration = 0;
   LOG(fshipcld, debug) << "created FUSE_ROOT_ID=" << FUSE_ROOT_ID
                        << " dir=" << dir;
   int mutexRC = pthread_mutex_init(&_mutex, NULL);
@@ -594,3 +602,338 @@ void NodeNameRoot::createChildNodeForResponse(struct fuse_entry_out *pEntryOut,
   assert_perror(l_RC);
   return;
 }
+
+void NodeNameRoot::setCacheLeases(const uint64_t pLeasesec,
+                                  const uint64_t pNegativeLeasesec) {
+  if ((pLeasesec > cacheLeaseMaxsec) || (pNegativeLeasesec > cacheLeaseMaxsec))
+    LOG(fshipcld, info) << "metadata cache leases capped at "
+                        << cacheLeaseMaxsec
+                        << " seconds unless fshipd pushes invalidations";
+  cacheLeasesec = pLeasesec;
+  cacheNegativeLeasesec = pNegativeLeasesec;
+}
+
+// locked
+int NodeNameRoot::lookupCached(const uint64_t pUnique, const uint64_t pParent,
+                               const char *pName,
+                               struct fuse_entry_out &pEntryOut) {
+  if (!cacheEnabled())
+    return 0;
+  int l_RC = pthread_mutex_lock(&_mutex);
+  _LOGLOCK;
+  assert_perror(l_RC);
+  int hit = 0;
+  EntryCacheMap::iterator it = _entryCache.find(EntryKey(pParent, pName));
+  if (it != _entryCache.end()) {
+    uint64_t now = cacheNow();
+    if (it->second.expires > now) {
+      uint64_t nodeid = it->second.entry_out.nodeid;
+      if (!nodeid) {
+        pEntryOut = it->second.entry_out;
+        hit = 1;
+      } else if (getNodeFuse(nodeid)) {
+        // attributes in the entry are only as current as the attribute cache
+        AttrCacheMap::iterator ait = _attrCache.find(nodeid);
+        if ((ait != _attrCache.end()) && (ait->second.expires > now)) {
+          pEntryOut = it->second.entry_out;
+          pEntryOut.attr = ait->second.attr_out.attr;
+          hit = 1;
+        }
+      }
+    }
+    if (!hit)
+      _entryCache.erase(it);
+  }
+  if (!hit)
+    _cachePending[pUnique] = _cacheGeneration;
+  l_RC = pthread_mutex_unlock(&_mutex);
+  _LOGUNLOCK;
+  assert_perror(l_RC);
+  return hit;
+}
+
+// locked
+int NodeNameRoot::getattrCached(const uint64_t pUnique, const uint64_t pInode,
+                                struct fuse_attr_out &pAttrOut) {
+  if (!cacheEnabled())
+    return 0;
+  int l_RC = pthread_mutex_lock(&_mutex);
+  _LOGLOCK;
+  assert_perror(l_RC);
+  int hit = 0;
+  AttrCacheMap::iterator it = _attrCache.find(pInode);
+  if (it != _attrCache.end()) {
+    if ((it->second.expires > cacheNow()) && getNodeFuse(pInode)) {
+      pAttrOut = it->second.attr_out;
+      hit = 1;
+    } else {
+      _attrCache.erase(it);
+    }
+  }
+  if (!hit)
+    _cachePending[pUnique] = _cacheGeneration;
+  l_RC = pthread_mutex_unlock(&_mutex);
+  _LOGUNLOCK;
+  assert_perror(l_RC);
+  return hit;
+}
+
+// lock presumed
+// a reply may be cached if nothing changed since its request was sent
+int NodeNameRoot::cacheFillAllowed(const uint64_t pUnique) {
+  std::unordered_map<uint64_t, uint64_t>::iterator it =
+      _cachePending.find(pUnique);
+  if (it == _cachePending.end())
+    return 0;
+  int allowed =
+      (it->second == _cacheGeneration) && (_cacheMutations.empty());
+  _cachePending.erase(it);
+  return allowed;
+}
+
+// lock presumed
+void NodeNameRoot::cacheSweepNoLock(const uint64_t pNow) {
+  if ((_entryCache.size() + _attrCache.size()) < cacheMaxEntries)
+    return;
+  for (EntryCacheMap::iterator it = _entryCache.begin();
+       it != _entryCache.end();) {
+    if (it->second.expires <= pNow)
+      it = _entryCache.erase(it);
+    else
+      ++it;
+  }
+  for (AttrCacheMap::iterator it = _attrCache.begin();
+       it != _attrCache.end();) {
+    if (it->second.expires <= pNow)
+      it = _attrCache.erase(it);
+    else
+      ++it;
+  }
+  // still full of live entries, start over rather than sweep on every fill
+  if ((_entryCache.size() + _attrCache.size()) >= cacheMaxEntries) {
+    LOG(fshipcld, info) << "metadata cache full, dropping "
+                        << _entryCache.size() << " entries and "
+                        << _attrCache.size() << " attributes";
+    _entryCache.clear();
+    _attrCache.clear();
+  }
+}
+
+// locked
+void NodeNameRoot::cacheLookup(const uint64_t pUnique, const uint64_t pParent,
+                               const char *pName,
+                               const struct fuse_entry_out *pEntryOut,
+                               const int pPushed) {
+  if (!cacheEnabled())
+    return;
+  uint64_t lease =
+      cacheLease(pEntryOut ? cacheLeasesec : cacheNegativeLeasesec, pPushed);
+  int l_RC = pthread_mutex_lock(&_mutex);
+  _LOGLOCK;
+  assert_perror(l_RC);
+  if (cacheFillAllowed(pUnique) && lease) {
+    uint64_t now = cacheNow();
+    cacheSweepNoLock(now);
+    uint64_t expires = now + lease * 1000000000ULL;
+    if (pEntryOut) {
+      cacheEntryNoLock(EntryKey(pParent, pName), *pEntryOut, expires);
+    } else {
+      CachedEntry &l_entry = _entryCache[EntryKey(pParent, pName)];
+      l_entry.expires = expires;
+      memset(&l_entry.entry_out, 0, sizeof(l_entry.entry_out));
+      l_entry.entry_out.entry_valid = entryValidsec;
+      l_entry.entry_out.entry_valid_nsec = entryValidnsec;
+    }
+  }
+  l_RC = pthread_mutex_unlock(&_mutex);
+  _LOGUNLOCK;
+  assert_perror(l_RC);
+}
+
+// lock presumed
+// a positive entry and the attributes of its node
+void NodeNameRoot::cacheEntryNoLock(const EntryKey &pKey,
+                                    const struct fuse_entry_out &pEntryOut,
+                                    const uint64_t pExpires) {
+  CachedEntry &l_entry = _entryCache[pKey];
+  l_entry.expires = pExpires;
+  l_entry.entry_out = pEntryOut;
+  CachedAttr &l_attr = _attrCache[pEntryOut.nodeid];
+  l_attr.expires = pExpires;
+  memset(&l_attr.attr_out, 0, sizeof(l_attr.attr_out));
+  l_attr.attr_out.attr_valid = pEntryOut.attr_valid;
+  l_attr.attr_out.attr_valid_nsec = pEntryOut.attr_valid_nsec;
+  l_attr.attr_out.attr = pEntryOut.attr;
+}
+
+// locked
+void NodeNameRoot::cacheNoteRequest(const uint64_t pUnique) {
+  if (!cacheLeasesec)
+    return;
+  int l_RC = pthread_mutex_lock(&_mutex);
+  _LOGLOCK;
+  assert_perror(l_RC);
+  _cachePending[pUnique] = _cacheGeneration;
+  l_RC = pthread_mutex_unlock(&_mutex);
+  _LOGUNLOCK;
+  assert_perror(l_RC);
+}
+
+// locked
+// stats after a directory listing are then answered without a round trip
+void NodeNameRoot::cacheReaddirPlus(const uint64_t pUnique,
+                                    const uint64_t pParent,
+                                    const char *pBuffer, const size_t pSize) {
+  if (!cacheEnabled())
+    return;
+  int l_RC = pthread_mutex_lock(&_mutex);
+  _LOGLOCK;
+  assert_perror(l_RC);
+  // names listed are not watched by fshipd
+  uint64_t lease = cacheLease(cacheLeasesec, 0);
+  if (cacheFillAllowed(pUnique) && lease) {
+    uint64_t now = cacheNow();
+    cacheSweepNoLock(now);
+    uint64_t expires = now + lease * 1000000000ULL;
+    size_t nbytes = 0;
+    while (nbytes < pSize) {
+      const struct fuse_direntplus *l_Fusedentplus =
+          (const struct fuse_direntplus *)(pBuffer + nbytes);
+      const struct fuse_dirent *l_Fusedent = &l_Fusedentplus->dirent;
+      nbytes += FUSE_DIRENTPLUS_SIZE(l_Fusedentplus);
+      // skip "." and ".." and names fshipd could not stat
+      if ((l_Fusedent->name[0] == '.') &&
+          ((l_Fusedent->namelen == 1) ||
+           ((l_Fusedent->namelen == 2) && (l_Fusedent->name[1] == '.'))))
+        continue;
+      if (!l_Fusedentplus->entry_out.attr.mode)
+        continue;
+      cacheEntryNoLock(
+          EntryKey(pParent, l_Fusedent->name, l_Fusedent->namelen),
+          l_Fusedentplus->entry_out, expires);
+    }
+  }
+  l_RC = pthread_mutex_unlock(&_mutex);
+  _LOGUNLOCK;
+  assert_perror(l_RC);
+}
+
+// locked
+void NodeNameRoot::cacheGetattr(const uint64_t pUnique, const uint64_t pInode,
+                                const struct fuse_attr_out &pAttrOut,
+                                const int pPushed) {
+  if (!cacheEnabled())
+    return;
+  uint64_t lease = cacheLease(cacheLeasesec, pPushed);
+  int l_RC = pthread_mutex_lock(&_mutex);
+  _LOGLOCK;
+  assert_perror(l_RC);
+  if (cacheFillAllowed(pUnique) && lease) {
+    uint64_t now = cacheNow();
+    cacheSweepNoLock(now);
+    CachedAttr &l_attr = _attrCache[pInode];
+    l_attr.expires = now + lease * 1000000000ULL;
+    l_attr.attr_out = pAttrOut;
+  }
+  l_RC = pthread_mutex_unlock(&_mutex);
+  _LOGUNLOCK;
+  assert_perror(l_RC);
+}
+
+// lock presumed
+void NodeNameRoot::invalidateEntryNoLock(const uint64_t pParent,
+                                         const char *pName) {
+  EntryCacheMap::iterator it = _entryCache.find(EntryKey(pParent, pName));
+  if (it == _entryCache.end())
+    return;
+  // link count and ctime of the target change with the name
+  if (it->second.entry_out.nodeid)
+    _attrCache.erase(it->second.entry_out.nodeid);
+  _entryCache.erase(it);
+}
+
+// locked
+void NodeNameRoot::cacheInvalidate(const uint64_t pUnique,
+                                   const uint64_t pInode,
+                                   const uint64_t pParent, const char *pName) {
+  if (!cacheEnabled())
+    return;
+  int l_RC = pthread_mutex_lock(&_mutex);
+  _LOGLOCK;
+  assert_perror(l_RC);
+  _cacheGeneration++;
+  _cacheMutations.insert(pUnique);
+  if (pInode)
+    _attrCache.erase(pInode);
+  if (pParent) {
+    _attrCache.erase(pParent); // directory size and times change
+    if (pName)
+      invalidateEntryNoLock(pParent, pName);
+  }
+  l_RC = pthread_mutex_unlock(&_mutex);
+  _LOGUNLOCK;
+  assert_perror(l_RC);
+}
+
+// locked
+uint64_t NodeNameRoot::cachePushedInvalidate(const uint32_t pCode,
+                                             const uint64_t pNodeid,
+                                             const char *pName) {
+  if (!cacheEnabled())
+    return 0;
+  uint64_t nodeid = 0;
+  int l_RC = pthread_mutex_lock(&_mutex);
+  _LOGLOCK;
+  assert_perror(l_RC);
+  // replies to requests sent before the change are not cached either
+  _cacheGeneration++;
+  switch (pCode) {
+  case FSHIP_INVAL_ENTRY: {
+    if (!pName)
+      break;
+    EntryCacheMap::iterator it = _entryCache.find(EntryKey(pNodeid, pName));
+    if (it != _entryCache.end())
+      nodeid = it->second.entry_out.nodeid;
+    invalidateEntryNoLock(pNodeid, pName);
+    break;
+  }
+  case FSHIP_INVAL_ATTR:
+    _attrCache.erase(pNodeid);
+    break;
+  case FSHIP_INVAL_DIR:
+    _attrCache.erase(pNodeid);
+    for (EntryCacheMap::iterator it = _entryCache.begin();
+         it != _entryCache.end();) {
+      if (it->first.parent == pNodeid) {
+        if (it->second.entry_out.nodeid)
+          _attrCache.erase(it->second.entry_out.nodeid);
+        it = _entryCache.erase(it);
+      } else
+        ++it;
+    }
+    break;
+  default: // FSHIP_INVAL_ALL
+    _entryCache.clear();
+    _attrCache.clear();
+    break;
+  }
+  l_RC = pthread_mutex_unlock(&_mutex);
+  _LOGUNLOCK;
+  assert_perror(l_RC);
+  return nodeid;
+}
+
+// locked
+void NodeNameRoot::cacheReplied(const uint64_t pUnique) {
+  if (!cacheEnabled())
+    return;
+  int l_RC = pthread_mutex_lock(&_mutex);
+  _LOGLOCK;
+  assert_perror(l_RC);
+  _cachePending.erase(pUnique);
+  if (_cacheMutations.erase(pUnique))
+    _cacheGeneration++; // this client's change is complete on the server
+  l_RC = pthread_mutex_unlock(&_mutex);
+  _LOGUNLOCK;
+  assert_perror(l_RC);
+}
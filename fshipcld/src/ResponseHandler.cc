@@ -136,7 +136,7 @@ __s64 ResponseHandler::symlinkOp(txp::Msg *pMsg) {
   txp::Attribute *l_outHdrAttribute = pMsg->retrieveAttr(txp::outMsgGeneric);
   if (l_outHdrAttribute) {
     outMsgGeneric *outMsg = (outMsgGeneric *)l_outHdrAttribute->getDataPtr();
-    return (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+    return (__s64)replyWrite(outMsg, outMsg->hdr.len);
   }
 
   txp::Attribute *l_inHdrAttribute = pMsg->retrieveAttr(txp::fuse_in_header);
@@ -153,7 +153,7 @@ __s64 ResponseHandler::symlinkOp(txp::Msg *pMsg) {
   } else {
     abort();
   }
-  __s64 retval = (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+  __s64 retval = (__s64)replyWrite(outMsg, outMsg->hdr.len);
   return retval;
 }
 
@@ -168,7 +168,7 @@ __s64 ResponseHandler::setxattrOp(txp::Msg *pMsg) {
     /* clang-format off */ 
     FL_Write(fl_fshipcldfusetx, FCL_SETXATTRRESP,"setxattr unique==%ld len=%ld err=%ld LINE=%ld" , outMsg->hdr.unique, outMsg->hdr.len, outMsg->hdr.error,__LINE__);
     /* clang-format on */
-    return (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+    return (__s64)replyWrite(outMsg, outMsg->hdr.len);
   } else
     abort();
   return 0;
@@ -184,7 +184,7 @@ __s64 ResponseHandler::getxattrOp(txp::Msg *pMsg) {
     /* clang-format off */ 
     FL_Write(fl_fshipcldfusetx, FCL_GETXATTRRESP,"getxattr unique==%ld len=%ld err=%ld LINE=%ld" , outMsg->hdr.unique, outMsg->hdr.len, outMsg->hdr.error,__LINE__);
     /* clang-format on */
-    return (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+    return (__s64)replyWrite(outMsg, outMsg->hdr.len);
   }
   __s64 retval = 0;
 
@@ -211,9 +211,9 @@ __s64 ResponseHandler::getxattrOp(txp::Msg *pMsg) {
         iov->iov_len +
         iov[1].iov_len; // correct header len for not including getxattr_out
     int iovcnt = sizeof(iov) / sizeof(struct iovec);
-    retval = writev(_deviceFD, iov, iovcnt);
+    retval = replyWritev(iov, iovcnt);
   } else {
-    retval = (__s64)write(_deviceFD, outMsgPtr, outMsgPtr->hdr.len);
+    retval = (__s64)replyWrite(outMsgPtr, outMsgPtr->hdr.len);
   }
   return retval;
 }
@@ -229,7 +229,7 @@ __s64 ResponseHandler::removexattrOp(txp::Msg *pMsg) {
     /* clang-format off */ 
     FL_Write(fl_fshipcldfusetx, FCL_RMVXATTRRESP,"removexattr unique==%ld len=%ld err=%ld LINE=%ld" , outMsg->hdr.unique, outMsg->hdr.len, outMsg->hdr.error,__LINE__);
     /* clang-format on */
-    return (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+    return (__s64)replyWrite(outMsg, outMsg->hdr.len);
   } else
     abort();
   return 0;
@@ -244,7 +244,7 @@ __s64 ResponseHandler::listxattrOp(txp::Msg *pMsg) {
       LOG(fshipcld, info) << "listxattr unique=" << outMsg->hdr.unique
                           << " errno=" << (-outMsg->hdr.error) << ":"
                           << strerror(-outMsg->hdr.error);
-    return (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+    return (__s64)replyWrite(outMsg, outMsg->hdr.len);
   }
   __s64 retval = 0;
 
@@ -270,9 +270,9 @@ __s64 ResponseHandler::listxattrOp(txp::Msg *pMsg) {
     iov[1].iov_len = outMsgPtr->getxattr_out.size;
     outMsgPtr->hdr.len += outMsgPtr->getxattr_out.size;
     int iovcnt = sizeof(iov) / sizeof(struct iovec);
-    retval = writev(_deviceFD, iov, iovcnt);
+    retval = replyWritev(iov, iovcnt);
   } else {
-    retval = (__s64)write(_deviceFD, outMsgPtr, outMsgPtr->hdr.len);
+    retval = (__s64)replyWrite(outMsgPtr, outMsgPtr->hdr.len);
   }
   return retval;
 }
@@ -281,7 +281,7 @@ __s64 ResponseHandler::rmdirOp(txp::Msg *pMsg) {
   txp::Attribute *l_outHdrAttribute = pMsg->retrieveAttr(txp::outMsgGeneric);
   outMsgGeneric *outMsg = (outMsgGeneric *)l_outHdrAttribute->getDataPtr();
   if (outMsg->hdr.error) {
-    return (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+    return (__s64)replyWrite(outMsg, outMsg->hdr.len);
   }
   txp::Attribute *l_inHdrAttribute = pMsg->retrieveAttr(txp::fuse_in_header);
   if (!l_inHdrAttribute) {
@@ -299,7 +299,7 @@ __s64 ResponseHandler::rmdirOp(txp::Msg *pMsg) {
     }
   }
 
-  __s64 retval = (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+  __s64 retval = (__s64)replyWrite(outMsg, outMsg->hdr.len);
   return retval;
 }
 
@@ -307,7 +307,7 @@ __s64 ResponseHandler::unlinkOp(txp::Msg *pMsg) {
 
   txp::Attribute *l_outHdrAttribute = pMsg->retrieveAttr(txp::outMsgGeneric);
   outMsgGeneric *outMsg = (outMsgGeneric *)l_outHdrAttribute->getDataPtr();
-  __s64 retval = (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+  __s64 retval = (__s64)replyWrite(outMsg, outMsg->hdr.len);
   return retval;
 }
 
@@ -370,7 +370,7 @@ __s64 ResponseHandler::mkdirOp(txp::Msg *pMsg) {
     /* clang-format off */ 
     FL_Write(fl_fshipcldfusetx, MKDIRRESP,"setattr unique==%ld len=%ld err=%ld LINE=%ld" , outMsg->hdr.unique, outMsg->hdr.len, outMsg->hdr.error,__LINE__);
     /* clang-format on */
-    return (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+    return (__s64)replyWrite(outMsg, outMsg->hdr.len);
   }
   txp::Attribute *l_inHdrAttribute = pMsg->retrieveAttr(txp::fuse_in_header);
   if (!l_inHdrAttribute) {
@@ -456,7 +456,7 @@ __s64 ResponseHandler::interruptOp(txp::Msg *pMsg) {
   }
   inMsgGeneric *in = (inMsgGeneric *)l_inHdrAttribute->getDataPtr();
   outMsgGeneric outMsg(in->hdr.unique);
-  __s64 retval = (__s64)write(_deviceFD, &outMsg, outMsg.hdr.len);
+  __s64 retval = (__s64)replyWrite(&outMsg, outMsg.hdr.len);
   return retval;
 }
 
@@ -544,6 +544,15 @@ __s64 ResponseHandler::Hello(txp::Msg *pMsg) {
           << " mount flags=0x" << (int)HelloResponse->sfs.f_flags << std::dec;
     }
   }
+  if (pMsg->retrieveAttr(txp::notify)) {
+    int l_RC = _notifier.start();
+    LOG(fshipcld, always) << "fshipd pushes metadata invalidations, notifier rc="
+                          << l_RC;
+  } else if (_rootNodePtr->cacheEnabled()) {
+    LOG(fshipcld, always) << "fshipd does not push metadata invalidations, "
+                             "cache leases capped at "
+                          << NodeNameRoot::cacheLeaseMaxsec << " seconds";
+  }
   outMsgInit outMsg(in->hdr.unique, _connectPtr->getRDMAchunkSize());
   // outMsg.init_out.max_write = _connectPtr->getRDMAchunkSize();
   LOG(fshipcld, always) << "Hello outMsgInit Fuse major="
@@ -567,7 +576,7 @@ __s64 ResponseHandler::setattrOp(txp::Msg *pMsg) {
     /* clang-format off */ 
     FL_Write(fl_fshipcldfusetx, FCL_SETATTRRESP,"setattr unique==%ld len=%ld err=%ld LINE=%ld" , outMsg->hdr.unique, outMsg->hdr.len, outMsg->hdr.error,__LINE__);
     /* clang-format on */
-    return (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+    return (__s64)replyWrite(outMsg, outMsg->hdr.len);
   }
   // bounce back fuse_in_header for nodeid and perhaps other tracking
   txp::Attribute *l_inHdrAttribute = pMsg->retrieveAttr(txp::fuse_in_header);
@@ -625,7 +634,7 @@ __s64 ResponseHandler::getattrOp(txp::Msg *pMsg) {
     /* clang-format off */ 
     FL_Write(fl_fshipcldfusetx, FCL_GETATTRRESP,"getattr unique==%ld len=%ld err=%ld LINE=%ld" , outMsg->hdr.unique, outMsg->hdr.len, outMsg->hdr.error,__LINE__);
     /* clang-format on */
-    return (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+    return (__s64)replyWrite(outMsg, outMsg->hdr.len);
   }
   // bounce back fuse_in_header for nodeid and perhaps other tracking
   txp::Attribute *l_inHdrAttribute = pMsg->retrieveAttr(txp::fuse_in_header);
@@ -664,6 +673,10 @@ __s64 ResponseHandler::getattrOp(txp::Msg *pMsg) {
           600; // 10 minutes on attribute refreshes for root node
       outMsg->getattr_out.attr_valid_nsec = 1;
     }
+    if (!outMsg->hdr.error)
+      _rootNodePtr->cacheGetattr(in->hdr.unique, in->hdr.nodeid,
+                                 outMsg->getattr_out,
+                                 pMsg->retrieveAttr(txp::notify) != NULL);
     retval = writedeviceFD((outMsgGeneric *)outMsg, FUSE_GETATTR);
   } else {
     l_inHdrAttribute = pMsg->retrieveAttr(txp::outMsgGeneric);
@@ -691,12 +704,6 @@ __s64 ResponseHandler::lookupOp(txp::Msg *pMsg) {
   txp::Attribute *l_inOutMsgAttribute = pMsg->retrieveAttr(txp::outMsgLookup);
   outMsgLookup *outMsg = (outMsgLookup *)l_inOutMsgAttribute->getDataPtr();
 
-  if (outMsg->hdr.error) {
-    outMsgGeneric outMsgError(outMsg->hdr.unique, outMsg->hdr.error);
-    __s64 local_val = (__s64)writedeviceFD(&outMsgError, in->hdr.opcode);
-    return local_val;
-  }
-
   txp::Attribute *lookUpNameAttribute = pMsg->retrieveAttr(txp::lookupname);
   char *lookUpName = NULL;
 
@@ -704,9 +711,23 @@ __s64 ResponseHandler::lookupOp(txp::Msg *pMsg) {
     lookUpName = (char *)lookUpNameAttribute
                      ->getDataPtr(); // to get addressability to the data
   }
+
+  // fshipd pushes an invalidation if the name changes
+  int l_Pushed = (pMsg->retrieveAttr(txp::notify) != NULL);
+  if (outMsg->hdr.error) {
+    if ((outMsg->hdr.error == -ENOENT) && lookUpName)
+      _rootNodePtr->cacheLookup(in->hdr.unique, in->hdr.nodeid, lookUpName,
+                                NULL, l_Pushed);
+    outMsgGeneric outMsgError(outMsg->hdr.unique, outMsg->hdr.error);
+    __s64 local_val = (__s64)writedeviceFD(&outMsgError, in->hdr.opcode);
+    return local_val;
+  }
+
   if (lookUpName) {
     _rootNodePtr->updateChildNodeForLookup(&outMsg->entry_out, lookUpName,
                                            parent);
+    _rootNodePtr->cacheLookup(in->hdr.unique, in->hdr.nodeid, lookUpName,
+                              &outMsg->entry_out, l_Pushed);
   }
   // ensure the inode/name is in the list of directories or regular files
   // need parent inode, file inode, and name
@@ -718,7 +739,7 @@ __s64 ResponseHandler::writedeviceFD(outMsgGeneric *outMsg, uint32_t opcode) {
   /* clang-format off */ 
   FL_Write(fl_fshipcldfusetx, FCL_SEND2FUSE,"op=%-3ld uniq=%-24ld len=%-12ld err=%-12ld  ", opcode,outMsg->hdr.unique,outMsg->hdr.len,outMsg->hdr.error);
   /* clang-format on */
-  return (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+  return (__s64)replyWrite(outMsg, outMsg->hdr.len);
 }
 
 __s64 ResponseHandler::readdirOp(txp::Msg *pMsg) {
@@ -782,7 +803,7 @@ __s64 ResponseHandler::readdirOp(txp::Msg *pMsg) {
     /* clang-format off */ 
     FL_Write(fl_fshipcldfusetx, FCL_READDIR__,"op=%-3ld uniq=%-24ld len=%-12ld err=%-12ld  ", FUSE_READDIR, outMsgPtr->hdr.unique,outMsgPtr->hdr.len,outMsgPtr->hdr.error);
     /* clang-format on */
-    int retval = writev(_deviceFD, iov, iovcnt);
+    int retval = replyWritev(iov, iovcnt);
     _connectPtr->releaseBuffer(charMemoryPtr);
     return retval;
   } else {
@@ -843,6 +864,8 @@ __s64 ResponseHandler::readdirPlusOp(txp::Msg *pMsg) {
 
       l_Fusedentplus = (struct fuse_direntplus *)(charMemoryPtr + nbytes);
     }
+    _rootNodePtr->cacheReaddirPlus(in->hdr.unique, in->hdr.nodeid,
+                                   charMemoryPtr, sizeOfDataBuffer);
 
     // Send response to fuse module using message followed by data
     struct iovec iov[2];
@@ -854,7 +877,7 @@ __s64 ResponseHandler::readdirPlusOp(txp::Msg *pMsg) {
     /* clang-format off */ 
     FL_Write(fl_fshipcldfusetx, FCL_READDIRPLUS,"op=%-3ld uniq=%-24ld len=%-12ld err=%-12ld  ", FUSE_READDIR, outMsgPtr->hdr.unique,outMsgPtr->hdr.len,outMsgPtr->hdr.error);
     /* clang-format on */
-    int retval = writev(_deviceFD, iov, iovcnt);
+    int retval = replyWritev(iov, iovcnt);
     _connectPtr->releaseBuffer(charMemoryPtr);
     return retval;
   } else {
@@ -873,7 +896,7 @@ __s64 ResponseHandler::readOp(txp::Msg *pMsg) {
   }
   outMsgGeneric *outMsgPtr = (outMsgGeneric *)l_outMsgGenericAttr->getDataPtr();
   if (outMsgPtr->hdr.error)
-    return write(_deviceFD, outMsgPtr, outMsgPtr->hdr.len);
+    return replyWrite(outMsgPtr, outMsgPtr->hdr.len);
 
   txp::Attribute *size32Attr = pMsg->retrieveAttr(txp::size);
   uint32_t sizeOfDataBuffer = 0;
@@ -884,7 +907,7 @@ __s64 ResponseHandler::readOp(txp::Msg *pMsg) {
   FL_Write(FL_fshipcldreadop, READOPRSP,"unique=%ld error=%ld sizeRead=%ld line=%ld\n", outMsgPtr->hdr.unique, outMsgPtr->hdr.error,sizeOfDataBuffer,__LINE__);
   /* clang-format on */
   if (!sizeOfDataBuffer)
-    return write(_deviceFD, outMsgPtr, outMsgPtr->hdr.len);
+    return replyWrite(outMsgPtr, outMsgPtr->hdr.len);
 
   memItemPtr mipRDMAfromOriginal = NULL;
   txp::Attribute *l_memItemAttribute = pMsg->retrieveAttr(txp::memItem);
@@ -903,7 +926,7 @@ __s64 ResponseHandler::readOp(txp::Msg *pMsg) {
     iov[1].iov_base = charMemoryPtr;
     iov[1].iov_len = sizeOfDataBuffer;
     int iovcnt = sizeof(iov) / sizeof(struct iovec);
-    int retval = writev(_deviceFD, iov, iovcnt);
+    int retval = replyWritev(iov, iovcnt);
     _connectPtr->freeRDMAChunk(mipRDMAfromOriginal);
     return retval;
 
@@ -917,7 +940,7 @@ __s64 ResponseHandler::readOp(txp::Msg *pMsg) {
     iov[1].iov_base = charMemoryPtr;
     iov[1].iov_len = sizeOfDataBuffer;
     int iovcnt = sizeof(iov) / sizeof(struct iovec);
-    int retval = writev(_deviceFD, iov, iovcnt);
+    int retval = replyWritev(iov, iovcnt);
     _connectPtr->releaseBuffer(charMemoryPtr);
     return retval;
   }
@@ -945,12 +968,12 @@ __s64 ResponseHandler::writeOp(txp::Msg *pMsg) {
     }
     // printf("Response writeOp(txp::Msg*>>>> wroteSize=%d
     // error=%d\n",outMsg->write_out.size,outMsg->hdr.error);
-    return write(_deviceFD, outMsg, outMsg->hdr.len);
+    return replyWrite(outMsg, outMsg->hdr.len);
   }
   l_outHdrAttribute = pMsg->retrieveAttr(txp::outMsgGeneric);
   if (l_outHdrAttribute) {
     outMsgGeneric *outMsg = (outMsgGeneric *)l_outHdrAttribute->getDataPtr();
-    return write(_deviceFD, outMsg, outMsg->hdr.len);
+    return replyWrite(outMsg, outMsg->hdr.len);
   } else
     abort();
   return 0;
@@ -970,7 +993,7 @@ __s64 ResponseHandler::fallocateOp(txp::Msg *pMsg) {
   txp::Attribute *l_outHdrAttribute = pMsg->retrieveAttr(txp::outMsgGeneric);
   outMsgGeneric *outMsg = (outMsgGeneric *)l_outHdrAttribute->getDataPtr();
 
-  __s64 retval = (__s64)write(_deviceFD, outMsg, outMsg->hdr.len);
+  __s64 retval = (__s64)replyWrite(outMsg, outMsg->hdr.len);
   return retval;
 }
 
@@ -996,6 +1019,43 @@ __s64 ResponseHandler::signal(txp::Msg *pMsg) {
   return 0;
 }
 
+// a change fshipd saw to metadata this client may have cached
+__s64 ResponseHandler::invalidateOp(txp::Msg *pMsg) {
+  uint32_t l_Code = 0;
+  uint64_t l_Nodeid = 0;
+  const char *l_Name = NULL;
+  txp::Attribute *l_Attr = pMsg->retrieveAttr(txp::notify);
+  if (l_Attr)
+    l_Attr->cpyData(&l_Code, sizeof(l_Code));
+  l_Attr = pMsg->retrieveAttr(txp::nodeid);
+  if (l_Attr)
+    l_Attr->cpyData(&l_Nodeid, sizeof(l_Nodeid));
+  l_Attr = pMsg->retrieveAttr(txp::name);
+  if (l_Attr)
+    l_Name = (const char *)l_Attr->getDataPtr();
+
+  uint64_t l_Child =
+      _rootNodePtr->cachePushedInvalidate(l_Code, l_Nodeid, l_Name);
+  switch (l_Code) {
+  case FSHIP_INVAL_ENTRY:
+    if (l_Name)
+      _notifier.invalEntry(l_Nodeid, l_Name);
+    if (l_Child)
+      _notifier.invalInode(l_Child);
+    break;
+  case FSHIP_INVAL_ATTR:
+  case FSHIP_INVAL_DIR:
+    _notifier.invalInode(l_Nodeid);
+    break;
+  default:
+    // the fuse module keeps what it has for the entry and attribute timeouts
+    LOG(fshipcld, info) << "metadata cache dropped, fshipd invalidation code="
+                        << l_Code;
+    break;
+  }
+  return 0;
+}
+
 __s64 ResponseHandler::setlkOp(txp::Msg *pMsg) {
   txp::Attribute *l_outHdrAttribute = pMsg->retrieveAttr(txp::outMsgGeneric);
   outMsgGeneric *outMsg = (outMsgGeneric *)l_outHdrAttribute->getDataPtr();
@@ -1044,7 +1104,7 @@ __s64 ResponseHandler::readlinkOp(txp::Msg *pMsg) {
     abort();
 
   if (!sizeOfDataBuffer) {
-    int retval = write(_deviceFD, outMsgPtr, outMsgPtr->hdr.len);
+    int retval = replyWrite(outMsgPtr, outMsgPtr->hdr.len);
     return retval;
   }
 
@@ -1062,7 +1122,7 @@ __s64 ResponseHandler::readlinkOp(txp::Msg *pMsg) {
   /* clang-format off */ 
   FL_Write(fl_fshipcldfusetx, FCL_READLINK_, "op=%-3ld uniq=%-24ld len=%-12ld err=%-12ld  ", FUSE_READLINK, outMsgPtr->hdr.unique,outMsgPtr->hdr.len,outMsgPtr->hdr.error);
   /* clang-format on */
-  int retval = writev(_deviceFD, iov, iovcnt);
+  int retval = replyWritev(iov, iovcnt);
 
   return retval;
 }
@@ -1199,6 +1259,9 @@ int ResponseHandler::readInMessage() {
       break;
     case txp::CORAL_READY:
       break;
+    case txp::CORAL_INVALIDATE:
+      invalidateOp(l_MsgPtr);
+      break;
     case txp::CORAL_SIGNAL:
       signal(l_MsgPtr);
       break;
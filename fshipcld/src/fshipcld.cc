@@ -485,6 +485,11 @@ int processArgs(int argc, char *argv[], FshipFuseOpsHandler &rCON) {
   LOG(fshipcld, always) << "fship.client.fusedirectio=" << directIOVal;
   set_fuseDirectIO(directIOVal);
 
+  int fuseChannels = config.get("fship.client.fusechannels",
+                                1); // default is to read only the fuse device
+  LOG(fshipcld, always) << "fship.client.fusechannels=" << fuseChannels;
+  rCON.setNumChannels(fuseChannels);
+
   NodeNameRoot::entryValidsec = config.get("fship.client.entry_valid_sec",
                                            1); // dentry valid time in seconds
   NodeNameRoot::entryValidnsec =
@@ -501,6 +506,19 @@ int processArgs(int argc, char *argv[], FshipFuseOpsHandler &rCON) {
                         << NodeNameRoot::attrValidsec
                         << " fship.client.attr_valid_nsec="
                         << NodeNameRoot::attrValidnsec;
+  NodeNameRoot::setCacheLeases(
+      config.get("fship.client.cache_lease_sec",
+                 0), // lookup/getattr cache, 0 is off
+      config.get("fship.client.cache_negative_lease_sec",
+                 0)); // failed lookups, 0 is off
+  NodeNameRoot::cacheMaxEntries =
+      config.get("fship.client.cache_max_entries", 65536);
+  LOG(fshipcld, always) << "fship.client.cache_lease_sec="
+                        << NodeNameRoot::cacheLeasesec
+                        << " fship.client.cache_negative_lease_sec="
+                        << NodeNameRoot::cacheNegativeLeasesec
+                        << " fship.client.cache_max_entries="
+                        << NodeNameRoot::cacheMaxEntries;
 
   uint16_t remotePort = config.get("fship.monitor.listenport", 5049);
   std::string remoteAddr = config.get("fship.client.remoteIPv4", "0.0.0.0");
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ |    fusechannelmap_test.cc
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//
+// Exercises the reply routing of FuseChannelMap without a fuse mount: with a
+// single channel every reply goes to the device descriptor, with cloned
+// channels a reply goes to the channel its request was read from, exactly
+// once.  Forgets get no reply and are not routed, notifications (unique 0)
+// and unknown requests go to the device descriptor.
+//
+
+#include "../include/FuseChannelMap.h"
+#include "csmutil/include/csm_test_utils.h"
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+static int failures = 0;
+
+static struct fuse_in_header headerFor(const uint32_t pOpcode,
+                                       const uint64_t pUnique) {
+  struct fuse_in_header l_hdr;
+  memset(&l_hdr, 0, sizeof(l_hdr));
+  l_hdr.opcode = pOpcode;
+  l_hdr.unique = pUnique;
+  return l_hdr;
+}
+
+static void testSingleChannel() {
+  int l_deviceFD = 10;
+  FuseChannelMap l_map(l_deviceFD);
+
+  CHECK(!l_map.isMultiChannel(), "new map is multi channel");
+  l_map.route(headerFor(FUSE_LOOKUP, 1), 11);
+  CHECK(l_map.replyFD(1) == 10, "single channel reply not on the device fd");
+
+  // the device descriptor is looked up when replying
+  l_deviceFD = 20;
+  CHECK(l_map.replyFD(2) == 20, "reply on a stale device fd");
+}
+
+static void testMultiChannel() {
+  int l_deviceFD = 10;
+  FuseChannelMap l_map(l_deviceFD);
+  l_map.setMultiChannel(1);
+  CHECK(l_map.isMultiChannel(), "map not multi channel");
+
+  l_map.route(headerFor(FUSE_LOOKUP, 1), 11);
+  l_map.route(headerFor(FUSE_GETATTR, 2), 12);
+  l_map.route(headerFor(FUSE_READ, 3), 10);
+  CHECK(l_map.replyFD(2) == 12, "reply not on the channel of its request");
+  CHECK(l_map.replyFD(1) == 11, "reply not on the channel of its request");
+  CHECK(l_map.replyFD(3) == 10, "reply not on the device channel");
+
+  // a request gets one reply, the route is gone after it
+  CHECK(l_map.replyFD(1) == 10, "route kept after the reply");
+
+  // forgets are never replied to, so they leave no route behind
+  l_map.route(headerFor(FUSE_FORGET, 4), 11);
+  l_map.route(headerFor(FUSE_BATCH_FORGET, 5), 12);
+  CHECK(l_map.replyFD(4) == 10 && l_map.replyFD(5) == 10, "forget routed");
+
+  // notifications have no request, they go to the device descriptor
+  l_map.route(headerFor(FUSE_LOOKUP, 6), 11);
+  CHECK(l_map.replyFD(0) == 10, "notification not on the device fd");
+  CHECK(l_map.replyFD(6) == 11, "notification took the route of a request");
+
+  // a reused unique is routed to the channel it was read from last
+  l_map.route(headerFor(FUSE_LOOKUP, 7), 11);
+  l_map.route(headerFor(FUSE_LOOKUP, 7), 12);
+  CHECK(l_map.replyFD(7) == 12, "reply not on the latest channel");
+}
+
+static void testConcurrent() {
+  static const int CHANNELS = 4;
+  static const uint64_t PER_CHANNEL = 20000;
+
+  int l_deviceFD = 100;
+  FuseChannelMap l_map(l_deviceFD);
+  l_map.setMultiChannel(1);
+
+  // each channel thread reads requests and replies to the requests of the
+  // channel next to it, as the worker threads of fshipcld do
+  std::vector<int> l_wrong(CHANNELS, 0);
+  std::vector<std::thread> l_threads;
+  for (int c = 0; c < CHANNELS; c++)
+    l_threads.push_back(std::thread([&l_map, &l_wrong, c]() {
+      for (uint64_t i = 1; i <= PER_CHANNEL; i++)
+        l_map.route(headerFor(FUSE_READ, i * CHANNELS + c), 100 + c);
+    }));
+  for (auto &l_thread : l_threads)
+    l_thread.join();
+  l_threads.clear();
+  for (int c = 0; c < CHANNELS; c++)
+    l_threads.push_back(std::thread([&l_map, &l_wrong, c]() {
+      int l_other = (c + 1) % CHANNELS;
+      for (uint64_t i = 1; i <= PER_CHANNEL; i++)
+        l_wrong[c] +=
+            (l_map.replyFD(i * CHANNELS + l_other) != 100 + l_other);
+    }));
+  for (auto &l_thread : l_threads)
+    l_thread.join();
+
+  int l_total = 0;
+  for (int c = 0; c < CHANNELS; c++)
+    l_total += l_wrong[c];
+  CHECK(!l_total, "%d replies routed to the wrong channel", l_total);
+}
+
+int main(int argc, char **argv) {
+  testSingleChannel();
+  testMultiChannel();
+  testConcurrent();
+
+  printf("fusechannelmap_test: %d failure(s)\n", failures);
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,271 @@
+/*******************************************************************************
+ |    nodenameroot_test.cc
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//
+// Exercises the fshipcld metadata cache in NodeNameRoot without a fuse mount:
+// a reply only fills the cache if no mutation from this client was requested
+// or outstanding since its request, mutations and invalidations pushed by
+// fshipd drop what they touch, leases expire and are capped for replies
+// fshipd does not push invalidations for.
+//
+
+#include "../include/NodeNameRoot.h"
+#include "csmutil/include/csm_test_utils.h"
+#include "fshipcld.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+static int failures = 0;
+
+static uint64_t unique = 0;
+
+static struct fuse_entry_out entryFor(const uint64_t pNodeid) {
+  struct fuse_entry_out l_entry;
+  memset(&l_entry, 0, sizeof(l_entry));
+  l_entry.nodeid = pNodeid;
+  l_entry.attr.ino = pNodeid;
+  l_entry.attr.mode = S_IFDIR | 0755;
+  l_entry.attr.size = 4096;
+  return l_entry;
+}
+
+// a lookup that misses and is answered with pEntryOut, NULL for ENOENT
+static void lookupReplied(NodeNameRoot &pRoot, const uint64_t pUnique,
+                          const uint64_t pParent, const char *pName,
+                          const struct fuse_entry_out *pEntryOut,
+                          const int pPushed = 0) {
+  struct fuse_entry_out l_out;
+  pRoot.lookupCached(pUnique, pParent, pName, l_out);
+  pRoot.cacheLookup(pUnique, pParent, pName, pEntryOut, pPushed);
+  pRoot.cacheReplied(pUnique);
+}
+
+static int hit(NodeNameRoot &pRoot, const uint64_t pParent, const char *pName,
+               struct fuse_entry_out &pEntryOut) {
+  uint64_t l_unique = ++unique;
+  int rc = pRoot.lookupCached(l_unique, pParent, pName, pEntryOut);
+  if (!rc)
+    pRoot.cacheReplied(l_unique); // as the reply to the miss would
+  return rc;
+}
+
+static void testFill(NodeNameRoot &pRoot) {
+  struct fuse_entry_out l_out;
+  struct fuse_entry_out l_entry = entryFor(FUSE_ROOT_ID);
+
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "a", l_out), "empty cache hit");
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "a", &l_entry);
+  CHECK(hit(pRoot, FUSE_ROOT_ID, "a", l_out) &&
+            (l_out.nodeid == FUSE_ROOT_ID) && (l_out.attr.size == 4096),
+        "positive entry not cached");
+
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "missing", NULL);
+  CHECK(hit(pRoot, FUSE_ROOT_ID, "missing", l_out) && !l_out.nodeid,
+        "negative entry not cached");
+  CHECK(!hit(pRoot, 2, "missing", l_out), "entry hit under another parent");
+
+  // the cached attributes are returned for getattr and with the entry
+  struct fuse_attr_out l_attr;
+  uint64_t l_unique = ++unique;
+  CHECK(pRoot.getattrCached(l_unique, FUSE_ROOT_ID, l_attr) &&
+            (l_attr.attr.size == 4096),
+        "attributes of a looked up entry not cached");
+  l_attr.attr.size = 8192;
+  l_unique = ++unique;
+  pRoot.cacheNoteRequest(l_unique);
+  pRoot.cacheGetattr(l_unique, FUSE_ROOT_ID, l_attr);
+  pRoot.cacheReplied(l_unique);
+  CHECK(hit(pRoot, FUSE_ROOT_ID, "a", l_out) && (l_out.attr.size == 8192),
+        "entry not returned with the newer attributes");
+
+  // a reply for a request the cache did not see is not cached
+  pRoot.cacheLookup(++unique, FUSE_ROOT_ID, "unseen", &l_entry);
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "unseen", l_out),
+        "reply without a pending request cached");
+}
+
+static void testGeneration(NodeNameRoot &pRoot) {
+  struct fuse_entry_out l_out;
+  struct fuse_entry_out l_entry = entryFor(FUSE_ROOT_ID);
+
+  // a mutation requested and completed while the lookup was outstanding
+  uint64_t l_lookup = ++unique;
+  uint64_t l_mutation = ++unique;
+  pRoot.lookupCached(l_lookup, FUSE_ROOT_ID, "b", l_out);
+  pRoot.cacheInvalidate(l_mutation, 0, FUSE_ROOT_ID, "b");
+  pRoot.cacheReplied(l_mutation);
+  pRoot.cacheLookup(l_lookup, FUSE_ROOT_ID, "b", &l_entry);
+  pRoot.cacheReplied(l_lookup);
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "b", l_out),
+        "reply sent before a completed mutation cached");
+
+  // a lookup sent and answered while a mutation is outstanding
+  l_mutation = ++unique;
+  pRoot.cacheInvalidate(l_mutation, 0, FUSE_ROOT_ID, "c");
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "c", &l_entry);
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "c", l_out),
+        "reply while a mutation is outstanding cached");
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "unrelated", NULL);
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "unrelated", l_out),
+        "unrelated reply while a mutation is outstanding cached");
+
+  // once the mutation is replied to, lookups sent afterwards are cached
+  pRoot.cacheReplied(l_mutation);
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "c", &l_entry);
+  CHECK(hit(pRoot, FUSE_ROOT_ID, "c", l_out),
+        "reply after the mutation completed not cached");
+
+  // an error reply completes a mutation as well, replying twice is harmless
+  l_mutation = ++unique;
+  pRoot.cacheInvalidate(l_mutation, FUSE_ROOT_ID);
+  pRoot.cacheReplied(l_mutation);
+  pRoot.cacheReplied(l_mutation);
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "d", NULL);
+  CHECK(hit(pRoot, FUSE_ROOT_ID, "d", l_out), "cache stuck after a mutation");
+}
+
+static void testInvalidate(NodeNameRoot &pRoot) {
+  struct fuse_entry_out l_out;
+  struct fuse_attr_out l_attr;
+  struct fuse_entry_out l_entry = entryFor(FUSE_ROOT_ID);
+
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "e", &l_entry);
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "f", NULL);
+  lookupReplied(pRoot, ++unique, 2, "f", NULL);
+
+  // dropping a name drops its entry, the attributes of its node and of the
+  // directory, names elsewhere stay
+  uint64_t l_mutation = ++unique;
+  pRoot.cacheInvalidate(l_mutation, 0, FUSE_ROOT_ID, "e");
+  pRoot.cacheReplied(l_mutation);
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "e", l_out), "invalidated entry hit");
+  uint64_t l_unique = ++unique;
+  CHECK(!pRoot.getattrCached(l_unique, FUSE_ROOT_ID, l_attr),
+        "attributes of an invalidated entry hit");
+  pRoot.cacheReplied(l_unique);
+  CHECK(hit(pRoot, FUSE_ROOT_ID, "f", l_out), "invalidate dropped another name");
+  CHECK(hit(pRoot, 2, "f", l_out),
+        "invalidate dropped a name in another directory");
+
+  // a negative entry is dropped by the create of the name
+  l_mutation = ++unique;
+  pRoot.cacheInvalidate(l_mutation, 0, 2, "f");
+  pRoot.cacheReplied(l_mutation);
+  CHECK(!hit(pRoot, 2, "f", l_out), "negative entry hit after a create");
+}
+
+static void testPushed(NodeNameRoot &pRoot) {
+  struct fuse_entry_out l_out;
+  struct fuse_attr_out l_attr;
+  struct fuse_entry_out l_entry = entryFor(FUSE_ROOT_ID);
+  uint64_t l_unique;
+
+  // a name changed: its entry and the attributes of its node are dropped
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "i", &l_entry, 1);
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "j", NULL, 1);
+  CHECK(pRoot.cachePushedInvalidate(FSHIP_INVAL_ENTRY, FUSE_ROOT_ID, "i") ==
+            FUSE_ROOT_ID,
+        "nodeid of the pushed name not returned");
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "i", l_out), "pushed entry hit");
+  l_unique = ++unique;
+  CHECK(!pRoot.getattrCached(l_unique, FUSE_ROOT_ID, l_attr),
+        "attributes of a pushed entry hit");
+  pRoot.cacheReplied(l_unique);
+  CHECK(hit(pRoot, FUSE_ROOT_ID, "j", l_out), "push dropped another name");
+  CHECK(!pRoot.cachePushedInvalidate(FSHIP_INVAL_ENTRY, FUSE_ROOT_ID, "j"),
+        "nodeid returned for a negative entry");
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "j", l_out), "pushed negative entry hit");
+
+  // attributes changed
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "k", &l_entry, 1);
+  pRoot.cachePushedInvalidate(FSHIP_INVAL_ATTR, FUSE_ROOT_ID, NULL);
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "k", l_out),
+        "entry hit without the pushed attributes");
+
+  // a directory is gone: every name in it is dropped, names elsewhere stay
+  lookupReplied(pRoot, ++unique, 2, "l", NULL, 1);
+  lookupReplied(pRoot, ++unique, 2, "m", NULL, 1);
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "n", NULL, 1);
+  pRoot.cachePushedInvalidate(FSHIP_INVAL_DIR, 2, NULL);
+  CHECK(!hit(pRoot, 2, "l", l_out) && !hit(pRoot, 2, "m", l_out),
+        "name in a pushed directory hit");
+  CHECK(hit(pRoot, FUSE_ROOT_ID, "n", l_out),
+        "push dropped a name in another directory");
+
+  // changes were lost: everything is dropped
+  pRoot.cachePushedInvalidate(FSHIP_INVAL_ALL, 0, NULL);
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "n", l_out), "entry hit after a lost push");
+
+  // a push while a lookup is outstanding, its reply may predate the change
+  l_unique = ++unique;
+  pRoot.lookupCached(l_unique, FUSE_ROOT_ID, "o", l_out);
+  pRoot.cachePushedInvalidate(FSHIP_INVAL_ENTRY, FUSE_ROOT_ID, "o");
+  pRoot.cacheLookup(l_unique, FUSE_ROOT_ID, "o", &l_entry, 1);
+  pRoot.cacheReplied(l_unique);
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "o", l_out),
+        "reply sent before a push cached");
+}
+
+static void testLease(NodeNameRoot &pRoot) {
+  struct fuse_entry_out l_out;
+  struct fuse_entry_out l_entry = entryFor(FUSE_ROOT_ID);
+
+  // changes made through other clients are only seen when the lease expires
+  NodeNameRoot::setCacheLeases(1, 1);
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "g", &l_entry);
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "h", NULL);
+  CHECK(hit(pRoot, FUSE_ROOT_ID, "g", l_out), "entry not cached");
+  usleep(1100000);
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "g", l_out), "expired entry hit");
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "h", l_out), "expired negative entry hit");
+
+  // no negative lease, failed lookups are not cached
+  NodeNameRoot::setCacheLeases(1, 0);
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "h", NULL);
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "h", l_out),
+        "negative entry cached without a negative lease");
+
+  // only replies fshipd pushes invalidations for hold past the cap
+  NodeNameRoot::setCacheLeases(3600, 3600);
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "p", &l_entry, 1);
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "q", NULL, 1);
+  lookupReplied(pRoot, ++unique, FUSE_ROOT_ID, "r", NULL);
+  usleep(NodeNameRoot::cacheLeaseMaxsec * 1000000 + 100000);
+  CHECK(hit(pRoot, FUSE_ROOT_ID, "p", l_out) &&
+            hit(pRoot, FUSE_ROOT_ID, "q", l_out),
+        "pushed entry expired at the cap");
+  CHECK(!hit(pRoot, FUSE_ROOT_ID, "r", l_out),
+        "entry without pushes not capped");
+  NodeNameRoot::setCacheLeases(0, 0);
+  CHECK(!pRoot.cacheEnabled(), "cache enabled without a lease");
+}
+
+int main(int argc, char **argv) {
+  char l_dir[] = "/";
+  NodeNameRoot::setCacheLeases(NodeNameRoot::cacheLeaseMaxsec,
+                               NodeNameRoot::cacheLeaseMaxsec);
+  NodeNameRoot *l_root = new NodeNameRoot(l_dir);
+
+  testFill(*l_root);
+  testGeneration(*l_root);
+  testInvalidate(*l_root);
+  testPushed(*l_root);
+  testLease(*l_root);
+
+  delete l_root;
+
+  printf("nodenameroot_test: %d failure(s)\n", failures);
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ |    InvalidationWatcher.h
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#ifndef INVALIDATION_WATCHER_H
+#define INVALIDATION_WATCHER_H
+//!
+//! \file   InvalidationWatcher.h
+//!
+//! \brief  inotify watches on the names and nodes a client caches, pushing
+//!         an invalidation to the client when they change.
+//! \defgroup fshipdInvalidationWatcher fshipd InvalidationWatcher
+//!
+
+#include <functional>
+#include <mutex>
+#include <pthread.h>
+#include <stdint.h>
+#include <string>
+#include <sys/types.h>
+#include <unordered_map>
+#include <unordered_set>
+
+//! \brief Watches what a client caches metadata of
+//!
+//! A lookup registers its name in the watch of the directory and a getattr
+//! registers its node in the watch of the node itself.  Registrations are
+//! one-shot: the first change reported for one is pushed to the client and
+//! the registration is dropped.  The client registers again with its next
+//! lookup or getattr, so a file being written or a busy directory costs one
+//! push and not one per change.
+//!
+//! inotify reports the changes made through the kernel of this host, by any
+//! client of it or locally.  Changes made on other nodes of a cluster file
+//! system are not reported.
+class InvalidationWatcher {
+public:
+  //! \brief Registrations kept at most, further ones are not watched
+  static const size_t MAX_REGISTRATIONS = 1024 * 1024;
+
+  //! \brief Sends one push to the client
+  //! \param pCode [in] FSHIP_INVAL_* code
+  //! \param pNodeid [in] client nodeid of the directory or node
+  //! \param pName [in] name in the directory, NULL if none
+  typedef std::function<void(uint32_t pCode, uint64_t pNodeid,
+                             const char *pName)>
+      PushFunc;
+
+  InvalidationWatcher() : _fd(-1), _registrations(0), _full(0), _failed(0) {
+    _stopPipe[0] = _stopPipe[1] = -1;
+  }
+  ~InvalidationWatcher() { stop(); }
+
+  //! \brief Create the inotify instance and start the thread reading it
+  //! \return 0 or errno
+  int start(PushFunc pPush);
+
+  //! \brief Stop and join the thread
+  void stop();
+
+  int active() const { return _fd >= 0; }
+
+  //! \brief Watch a name looked up in a directory, also if it does not exist
+  //! \param pDirPath [in] path of the directory
+  //! \param pParent [in] client nodeid of the directory
+  //! \param pName [in] name in the directory
+  //! \return 1 if a change of the name will be pushed
+  //! \note  Call before the name is stat'ed, so no change after the stat is
+  //!        missed
+  int watchEntry(const char *pDirPath, uint64_t pParent, const char *pName);
+
+  //! \brief Watch the attributes of a node
+  //! \param pPath [in] path of the node
+  //! \param pNodeid [in] client nodeid of the node
+  //! \return 1 if a change of the attributes will be pushed
+  int watchAttr(const char *pPath, uint64_t pNodeid);
+
+private:
+  struct Watch {
+    uint64_t parent; //!< client nodeid of the directory, 0 if no names
+    uint64_t self;   //!< client nodeid of the watched node, 0 if not cached
+    std::unordered_set<std::string> names; //!< names cached in the directory
+    Watch() : parent(0), self(0) {}
+  };
+  struct Push {
+    uint32_t code;
+    uint64_t nodeid;
+    std::string name;
+    Push(uint32_t pCode, uint64_t pNodeid, const char *pName = "")
+        : code(pCode), nodeid(pNodeid), name(pName) {}
+  };
+
+  // lock presumed
+  Watch *addWatch(const char *pPath, uint32_t pFlags);
+  void handleEvents(const char *pBuffer, ssize_t pLength);
+  static void *reader(void *pWatcher);
+  void run();
+
+  std::mutex _lock;
+  std::unordered_map<int, Watch> _watches; //!< by watch descriptor
+  int _fd;                                 //!< inotify instance
+  int _stopPipe[2];
+  pthread_t _thread;
+  size_t _registrations; //!< names and nodes registered in _watches
+  int _full;             //!< watch limit or MAX_REGISTRATIONS was logged
+  int _failed;           //!< the thread stopped reading events
+  PushFunc _push;
+};
+
+#endif // INVALIDATION_WATCHER_H
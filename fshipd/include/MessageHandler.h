@@ -41,8 +41,11 @@ The requests are file-system function-ship requests.  These include:
 
 
 #include "CnxSock.h"
+#include "InvalidationWatcher.h"
 #include "Log.h"
 #include "Msg.h"
+#include "RequestQueue.h"
+#include "StatPool.h"
 #include "fshipcld.h"
 #include <errno.h>
 #include <linux/fuse.h>
@@ -56,6 +59,7 @@ txp::Attribute* retrieveAttr(const int32_t pNameValue);
 */
 
 #define FSHIPD_VERSIONSTR "Bringup" ///< Version string for fshipd
+#define FSHIPD_REQUEST_QUEUE_SIZE 4096 ///< Requests read ahead of the workers
 
 typedef txp::Msg::AttributeMap AttrMap;
 typedef AttrMap::iterator AttrMapIterator;
@@ -85,7 +89,7 @@ public:
   //!
   MessageHandler(txp::ConnexPtr pConnectPtr)
       : _HEADERLENGTH(txp::OFFSET_TO_FIRST_ATTRIBUTE),
-        _connectPtr(pConnectPtr) {
+        _connectPtr(pConnectPtr), _requests(FSHIPD_REQUEST_QUEUE_SIZE) {
     txp::Log _txplog(txp::Log::OPEN); // writes to stdout
     _clientMajor4Msg = 0;
     _clientMinor4Msg = 0;
@@ -100,7 +104,8 @@ public:
     _attr_valid = 120; /* Cache timeout for the attributes */
     _entry_valid_nsec = 1;
     _attr_valid_nsec = 1;
-    sem_init(&threadSerialSem, 0, 1);
+    _numWorkers = 0;
+    _statsInterval = 60;
     _openOutFlags = FOPEN_DIRECT_IO; // FOPEN_DIRECT_IO;;// choices are in
                                      // fuse.h,.e.g FOPEN_DIRECT_IO
                                      // FOPEN_KEEP_CACHE FOPEN_NONSEEKABLE
@@ -113,17 +118,41 @@ public:
       _mountPath = 0;
     }
   }
-  //! \brief  Read in a message and handle
+  //! \brief  Read in a message and queue it for the worker threads
   //!
-  //! \return 
+  //! \return 0=Success, 1=no read chunk, otherwise the read failure
   //!
   int readInMessage();
+  //! \brief  Handle a message taken off the request queue
+  //! \param pRequest [in] request to handle
+  //!
+  //! \return 0=Success, nonzero ends the worker thread
+  //!
+  int handleMessage(Request &pRequest);
   const int _HEADERLENGTH; // txp::OFFSET_TO_FIRST_ATTRIBUTE in Common.h is the
                            // header length.
-  void *run(); //!< method for running a thread when threads get coded
-  void *run(unsigned numthreads); //!< method for running a thread when threads
-                                  //!get coded
+  void *run(); //!< worker thread body, handles queued requests
+  void *run(unsigned numthreads); //!< starts the worker threads and reads
+                                  //!requests until the connection ends
+  //! \brief Set how often the request queue stats are logged
+  //! \param pSeconds [in] interval in seconds, 0 logs them only at the end
+  //!
+  void setStatsInterval(unsigned pSeconds) { _statsInterval = pSeconds; }
+  //! \brief Start the threads stat'ing readdirplus windows in parallel
+  //! \param pThreads [in] number of threads, 0 stats on the worker thread
+  //!
+  void setStatThreads(unsigned pThreads) { _statPool.start(pThreads); }
  private:
+  //! \brief Log the depth of the request queue and the ordering stats
+  //! \param pWhen [in] text identifying the point in time
+  //!
+  void logQueueStats(const char *pWhen);
+  //! \brief Nodeid a request has to be ordered on
+  //! \param pMsg [in] request message
+  //!
+  //! \return nodeid, or 0 if the request can run in any order
+  //!
+  uint64_t orderingNodeid(txp::Msg *pMsg);
   //! \brief Take a stat struct and build a fuse_attr_out
   //! \param pStat [in] stat struct
   //! \param attrOut [out] fuse_attr_out 
@@ -217,6 +246,12 @@ public:
   __s64 listxattrOp(txp::Msg *pMsg); //!< \brief Handle message named by method
   __s64 removexattrOp(txp::Msg *pMsg);//!< \brief Handle message named by method
   int signal(txp::Msg *pMsg);//!< \brief Handle signal message sent by remote (not a function-ship/syscall)
+  //! \brief Send a CORAL_INVALIDATE push to fshipcld
+  //! \param pCode [in] FSHIP_INVAL_* code
+  //! \param pNodeid [in] client nodeid of the directory or node
+  //! \param pName [in] name in the directory, NULL if none
+  //!
+  void sendInvalidate(uint32_t pCode, uint64_t pNodeid, const char *pName);
   /* data */
   txp::ConnexPtr _connectPtr;
   uint32_t _clientMajor;
@@ -226,7 +261,12 @@ public:
   int _clientMinor4Msg;
   char *_mountPath;
   txp::Log _txplog;
-  sem_t threadSerialSem;
+  RequestQueue _requests;  //!< messages read, waiting for a worker
+  NodeOrdering _ordering;  //!< per-nodeid ordering of the requests
+  StatPool _statPool;      //!< parallel fstatat for readdirplus windows
+  InvalidationWatcher _watcher; //!< pushes invalidations if the client asks
+  unsigned _numWorkers;    //!< number of worker threads running
+  unsigned _statsInterval; //!< seconds between request queue stats
   uint32_t _openOutFlags; //!< FOPEN_DIRECT_IO, etc settings back to fuse kernel
 
   //! \brief
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ |    RequestQueue.h
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#ifndef REQUEST_QUEUE_H
+#define REQUEST_QUEUE_H
+//!
+//! \file   RequestQueue.h
+//!
+//! \brief  Hand off of function-ship requests from the connection reader to
+//!         the worker threads of fshipd.
+//! \defgroup fshipdRequestQueue fshipd RequestQueue
+//!
+
+#include "Msg.h"
+#include "fshipcld.h"
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdint.h>
+
+//! \brief A message read off the connection together with its read chunk
+struct Request {
+  txp::Msg *msg;   //!< message, NULL asks the worker to stop
+  memItemPtr mip;  //!< read chunk holding the message
+  uint64_t nodeid; //!< FUSE nodeid the request must be ordered on, 0 for none
+};
+
+//! \brief Bounded lock-free multi-producer/multi-consumer queue of requests
+//!
+//! Workers block on a semaphore while the queue is empty, the reader blocks on
+//! a second one while it is full.  The queue keeps track of its depth for the
+//! stats logged by MessageHandler.
+class RequestQueue {
+public:
+  //! \brief Constructor
+  //! \param pCapacity [in] number of requests, rounded up to a power of 2
+  //!
+  explicit RequestQueue(size_t pCapacity);
+  ~RequestQueue();
+
+  //! \brief Queue a request, waits while the queue is full
+  //! \param pRequest [in] request to queue
+  //!
+  void push(const Request &pRequest);
+
+  //! \brief Wait for and remove the oldest request
+  //! \param pRequest [out] request removed
+  //!
+  void pop(Request &pRequest);
+
+  //! \brief Current number of queued requests
+  uint64_t depth() const { return _depth.load(std::memory_order_relaxed); }
+  //! \brief Highest number of queued requests seen
+  uint64_t maxDepth() const { return _maxDepth.load(std::memory_order_relaxed); }
+  //! \brief Total number of requests queued
+  uint64_t pushed() const { return _pushed.load(std::memory_order_relaxed); }
+  //! \brief Number of times the reader found the queue full
+  uint64_t fullWaits() const { return _fullWaits.load(std::memory_order_relaxed); }
+
+private:
+  struct Cell {
+    std::atomic<size_t> seq;
+    Request request;
+  };
+
+  bool tryPush(const Request &pRequest);
+  bool tryPop(Request &pRequest);
+
+  Cell *_cells;
+  size_t _mask;
+  std::atomic<size_t> _pushPos;
+  char _pad[128]; //!< keep producer and consumer positions on separate cache lines
+  std::atomic<size_t> _popPos;
+  sem_t _available; //!< published requests
+  sem_t _free;      //!< cells free to push into
+
+  std::atomic<uint64_t> _depth;
+  std::atomic<uint64_t> _maxDepth;
+  std::atomic<uint64_t> _pushed;
+  std::atomic<uint64_t> _fullWaits;
+};
+
+//! \brief Keeps requests for the same nodeid in the order they were read
+//!
+//! Requests are hashed on their nodeid into a fixed number of lanes.  The
+//! reader claims the lane of a request before queueing it, in the order the
+//! requests were read.  A request whose lane is busy is parked on the lane
+//! instead of queued; the worker owning the lane runs the parked requests
+//! when it is done.  Requests that need no ordering (nodeid 0) bypass the
+//! lanes.
+class NodeOrdering {
+public:
+  static const size_t NUMBER_OF_LANES = 256;
+
+  NodeOrdering() : _deferred(0) {}
+
+  //! \brief Claim the lane of a request, called by the reader only
+  //! \param pRequest [in] request about to be queued
+  //!
+  //! \return true if the request owns the lane and is to be queued,
+  //!         false if it was parked behind a queued or running one
+  //!
+  bool acquire(const Request &pRequest);
+
+  //! \brief Hand back the lane after running a request
+  //! \param pNodeid [in] nodeid of the request that was run
+  //! \param pNext [out] next parked request of the lane
+  //!
+  //! \return true if pNext has to be run by the caller, which still owns the lane
+  //!
+  bool release(uint64_t pNodeid, Request &pNext);
+
+  //! \brief Number of requests that had to wait on a lane
+  uint64_t deferred() const { return _deferred.load(std::memory_order_relaxed); }
+
+private:
+  struct Lane {
+    std::mutex lock;
+    bool busy = false;
+    std::deque<Request> parked;
+  };
+
+  Lane &lane(uint64_t pNodeid) {
+    return _lanes[(pNodeid * 0x9E3779B97F4A7C15ULL) >> 56];
+  }
+
+  Lane _lanes[NUMBER_OF_LANES];
+  std::atomic<uint64_t> _deferred;
+};
+
+#endif // REQUEST_QUEUE_H
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ |    StatPool.h
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#ifndef STAT_POOL_H
+#define STAT_POOL_H
+//!
+//! \file   StatPool.h
+//!
+//! \brief  Threads running the fstatat calls of a directory window in
+//!         parallel for readdirplus.
+//! \defgroup fshipdStatPool fshipd StatPool
+//!
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <limits.h>
+#include <mutex>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <vector>
+
+//! \brief One name of a directory to stat
+struct StatItem {
+  char name[NAME_MAX + 1]; //!< name relative to the directory
+  struct stat st;          //!< result of the fstatat
+  int rc;                  //!< fstatat return code
+};
+
+//! \brief Fixed pool of threads sharing the fstatat calls of a batch
+//!
+//! The thread posting a batch works on it as well, so a pool without threads
+//! or a small batch simply runs the calls inline.  The pool threads take on
+//! the file system identity of the requestor before stat'ing.
+class StatPool {
+public:
+  //! \brief Batches smaller than this are run by the caller alone
+  static const size_t MIN_PARALLEL = 16;
+
+  StatPool() : _stop(false) {}
+  ~StatPool() { stop(); }
+
+  //! \brief Start the pool threads
+  //! \param pThreads [in] number of threads helping the callers
+  //!
+  void start(unsigned pThreads);
+
+  //! \brief Stop and join the pool threads
+  void stop();
+
+  //! \brief fstatat every item relative to a directory
+  //! \param pDirfd [in] directory descriptor
+  //! \param pItems [in,out] names to stat, st and rc are filled in
+  //! \param pCount [in] number of items
+  //! \param pUid [in] user to stat as
+  //! \param pGid [in] group to stat as
+  //!
+  void statAt(int pDirfd, StatItem *pItems, size_t pCount, uid_t pUid,
+              gid_t pGid);
+
+private:
+  struct Batch {
+    int dirfd;
+    StatItem *items;
+    size_t count;
+    uid_t uid;
+    gid_t gid;
+    std::atomic<size_t> next; //!< next item to claim
+    unsigned users;           //!< pool threads working on the batch
+  };
+
+  static void *worker(void *pPool);
+  void run();
+  static void work(Batch &pBatch);
+
+  std::mutex _lock;
+  std::condition_variable _posted; //!< a batch was queued or the pool stops
+  std::condition_variable _idle;   //!< a pool thread left a batch
+  std::deque<Batch *> _batches;
+  std::vector<pthread_t> _threads;
+  bool _stop;
+};
+
+#endif // STAT_POOL_H
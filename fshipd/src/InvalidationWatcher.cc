@@ -0,0 +1,244 @@
+/*******************************************************************************
+ |    InvalidationWatcher.cc
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//! \file
+//! \brief Server pushed invalidation of the metadata cached by a client
+#include "InvalidationWatcher.h"
+#include "fshipcld.h"
+#include "logging.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <vector>
+
+// changes of a name, of the attributes of a node or of a directory's content
+static const uint32_t WATCH_MASK = IN_ATTRIB | IN_MODIFY | IN_CREATE |
+                                   IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                   IN_DELETE_SELF | IN_MOVE_SELF;
+// events that change the size and times of the directory they occur in
+static const uint32_t DIR_CHANGE_MASK =
+    IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+
+int InvalidationWatcher::start(PushFunc pPush) {
+  if (_fd >= 0)
+    return 0;
+  _push = pPush;
+  int l_FD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (l_FD < 0)
+    return errno;
+  if (pipe2(_stopPipe, O_CLOEXEC)) {
+    int l_Errno = errno;
+    close(l_FD);
+    return l_Errno;
+  }
+  _fd = l_FD;
+  int rc = pthread_create(&_thread, NULL, reader, this);
+  if (rc) {
+    close(_stopPipe[0]);
+    close(_stopPipe[1]);
+    _stopPipe[0] = _stopPipe[1] = -1;
+    close(_fd);
+    _fd = -1;
+    return rc;
+  }
+  LOG(fshipd, always) << "pushing metadata invalidations to the client";
+  return 0;
+}
+
+void InvalidationWatcher::stop() {
+  if (_fd < 0)
+    return;
+  char l_Byte = 0;
+  ssize_t rc = write(_stopPipe[1], &l_Byte, sizeof(l_Byte));
+  (void)rc;
+  pthread_join(_thread, NULL);
+  close(_stopPipe[0]);
+  close(_stopPipe[1]);
+  _stopPipe[0] = _stopPipe[1] = -1;
+  close(_fd);
+  _fd = -1;
+  std::lock_guard<std::mutex> l_Guard(_lock);
+  _watches.clear();
+  _registrations = 0;
+}
+
+// lock presumed
+InvalidationWatcher::Watch *InvalidationWatcher::addWatch(const char *pPath,
+                                                          uint32_t pFlags) {
+  if (_registrations >= MAX_REGISTRATIONS) {
+    if (!_full)
+      LOG(fshipd, warning) << "invalidation watcher full with "
+                           << _registrations << " registrations";
+    _full = 1;
+    return NULL;
+  }
+  // the same inode always gets the same watch descriptor
+  int l_Wd = inotify_add_watch(_fd, pPath, WATCH_MASK | pFlags);
+  if (l_Wd < 0) {
+    if ((errno == ENOSPC) && !_full) {
+      LOG(fshipd, warning) << "inotify watch limit reached, raise "
+                              "fs.inotify.max_user_watches for longer "
+                              "client leases";
+      _full = 1;
+    }
+    return NULL;
+  }
+  return &_watches[l_Wd];
+}
+
+int InvalidationWatcher::watchEntry(const char *pDirPath, uint64_t pParent,
+                                    const char *pName) {
+  if (_fd < 0)
+    return 0;
+  std::lock_guard<std::mutex> l_Guard(_lock);
+  if (_failed)
+    return 0;
+  Watch *l_Watch = addWatch(pDirPath, IN_ONLYDIR);
+  if (!l_Watch)
+    return 0;
+  l_Watch->parent = pParent;
+  if (l_Watch->names.insert(pName).second)
+    _registrations++;
+  return 1;
+}
+
+int InvalidationWatcher::watchAttr(const char *pPath, uint64_t pNodeid) {
+  if (_fd < 0)
+    return 0;
+  std::lock_guard<std::mutex> l_Guard(_lock);
+  if (_failed)
+    return 0;
+  Watch *l_Watch = addWatch(pPath, IN_DONT_FOLLOW);
+  if (!l_Watch)
+    return 0;
+  if (!l_Watch->self)
+    _registrations++;
+  l_Watch->self = pNodeid;
+  return 1;
+}
+
+void InvalidationWatcher::handleEvents(const char *pBuffer, ssize_t pLength) {
+  std::vector<Push> l_Pushes;
+  {
+    std::lock_guard<std::mutex> l_Guard(_lock);
+    for (ssize_t l_Offset = 0; l_Offset < pLength;) {
+      const struct inotify_event *l_Event =
+          (const struct inotify_event *)(pBuffer + l_Offset);
+      l_Offset += sizeof(struct inotify_event) + l_Event->len;
+
+      if (l_Event->mask & IN_Q_OVERFLOW) {
+        // events were lost, the client drops everything it caches
+        l_Pushes.push_back(Push(FSHIP_INVAL_ALL, 0));
+        for (auto &it : _watches) {
+          it.second.names.clear();
+          it.second.self = 0;
+        }
+        _registrations = 0;
+        continue;
+      }
+      std::unordered_map<int, Watch>::iterator it =
+          _watches.find(l_Event->wd);
+      if (it == _watches.end())
+        continue;
+      Watch &l_Watch = it->second;
+
+      if (l_Event->mask & IN_IGNORED) {
+        // the watched inode is gone, or the watch was removed
+        if (l_Watch.parent && !l_Watch.names.empty())
+          l_Pushes.push_back(Push(FSHIP_INVAL_DIR, l_Watch.parent));
+        if (l_Watch.self)
+          l_Pushes.push_back(Push(FSHIP_INVAL_ATTR, l_Watch.self));
+        _registrations -= l_Watch.names.size() + (l_Watch.self ? 1 : 0);
+        _watches.erase(it);
+        continue;
+      }
+      if (l_Event->len) {
+        if (l_Watch.names.erase(l_Event->name)) {
+          l_Pushes.push_back(
+              Push(FSHIP_INVAL_ENTRY, l_Watch.parent, l_Event->name));
+          _registrations--;
+        }
+        if (l_Watch.self && (l_Event->mask & DIR_CHANGE_MASK)) {
+          l_Pushes.push_back(Push(FSHIP_INVAL_ATTR, l_Watch.self));
+          l_Watch.self = 0;
+          _registrations--;
+        }
+      } else if (l_Watch.self) {
+        l_Pushes.push_back(Push(FSHIP_INVAL_ATTR, l_Watch.self));
+        l_Watch.self = 0;
+        _registrations--;
+      }
+      // nothing left to push for, the next registration adds it again
+      if (l_Watch.names.empty() && !l_Watch.self) {
+        inotify_rm_watch(_fd, it->first);
+        _watches.erase(it);
+      }
+    }
+    if (_registrations < MAX_REGISTRATIONS)
+      _full = 0;
+  }
+  // the pushes go out after the lock is dropped, lookups are not held up by a
+  // slow connection
+  for (auto &l_Push : l_Pushes)
+    _push(l_Push.code, l_Push.nodeid,
+          l_Push.name.empty() ? NULL : l_Push.name.c_str());
+}
+
+void *InvalidationWatcher::reader(void *pWatcher) {
+  ((InvalidationWatcher *)pWatcher)->run();
+  return NULL;
+}
+
+void InvalidationWatcher::run() {
+  char l_Buffer[64 * 1024]
+      __attribute__((aligned(__alignof__(struct inotify_event))));
+  struct pollfd l_Fds[2];
+  l_Fds[0].fd = _fd;
+  l_Fds[0].events = POLLIN;
+  l_Fds[1].fd = _stopPipe[0];
+  l_Fds[1].events = POLLIN;
+  while (1) {
+    int rc = poll(l_Fds, 2, -1);
+    if (rc < 0) {
+      if (errno == EINTR)
+        continue;
+      LOG(fshipd, error) << "invalidation watcher poll errno=" << errno << ":"
+                         << strerror(errno);
+      break;
+    }
+    if (l_Fds[1].revents)
+      break;
+    ssize_t l_Length = read(_fd, l_Buffer, sizeof(l_Buffer));
+    if (l_Length > 0)
+      handleEvents(l_Buffer, l_Length);
+    else if ((l_Length < 0) && (errno != EAGAIN) && (errno != EINTR)) {
+      LOG(fshipd, error) << "invalidation watcher read errno=" << errno << ":"
+                         << strerror(errno);
+      break;
+    }
+  }
+  if (l_Fds[1].revents)
+    return;
+  // nothing is pushed from here on, the client drops what it relied on pushes
+  // for and caps the leases of what it caches afterwards
+  {
+    std::lock_guard<std::mutex> l_Guard(_lock);
+    _failed = 1;
+    _watches.clear();
+    _registrations = 0;
+  }
+  _push(FSHIP_INVAL_ALL, 0, NULL);
+}
@@ -26,6 +26,7 @@
 #include <sys/syscall.h>
 #include <sys/types.h>
 #include <sys/xattr.h>
+#include <time.h>
 #include <vector>
 
 #ifndef GPFS_SUPER_MAGIC
@@ -1143,9 +1144,11 @@ int MessageHandler::readdirPlusOp(txp::Msg *pMsg) {
 
   struct dirent *result = NULL;
   struct dirent dent;
-  struct stat l_stat;
   int flags = AT_SYMLINK_NOFOLLOW;
-  int l_statRC = 0;
+  // names of the window, stat'ed together once the window is full
+  static thread_local std::vector<StatItem> l_Items;
+  std::vector<size_t> l_Offsets;
+  l_Items.clear();
   /* clang-format off */ 
   FL_Write6(fl_fshipdposix, POSIX_READDIRBEG3, "Starting readdir() operation.", 0,0,0,0,0,0);
   /* clang-format on */
@@ -1174,25 +1177,47 @@ int MessageHandler::readdirPlusOp(txp::Msg *pMsg) {
       // printf("dent.d_ino=%ld dent.d_type=%d dent.d_name=%s
       // \n",dent.d_ino,dent.d_type, dent.d_name);
     }
+    l_Items.resize(l_Items.size() + 1);
+    memcpy(l_Items.back().name, dent.d_name, l_direntPlusPtr->dirent.namelen);
+    l_Items.back().name[l_direntPlusPtr->dirent.namelen] = 0;
+    l_Offsets.push_back(bytes_written);
+
+    reclen = FUSE_DIRENTPLUS_SIZE(l_direntPlusPtr);
+    charMemoryPtr += reclen;
+    bytes_written += reclen;
+    if ((maxMemSize - bytes_written) < MAXDIRENTPLUSENTRY) {
+      break;
+    }
+    l_direntPlusPtr = (struct fuse_direntplus *)charMemoryPtr;
+
+    readdir_r(dirp, &dent, &result);
+  };
+
+  // one network round trip carries the attributes of the whole window, so
+  // stat the window in parallel rather than one name after the other
+  /* clang-format off */ 
+  FL_Write6(fl_fshipdposix, POSIX_STATATBEGDP, "Start statat DIRFD=%ld, flags=0x%lx count=%ld.", l_dirfd,flags,l_Items.size(),0,0,0);
+  /* clang-format on */
+  _statPool.statAt(l_dirfd, l_Items.data(), l_Items.size(), in->hdr.uid,
+                   in->hdr.gid);
+
+  for (size_t i = 0; i < l_Items.size(); i++) {
+    StatItem &l_Item = l_Items[i];
+    l_direntPlusPtr = (struct fuse_direntplus *)(mip->address + l_Offsets[i]);
     /* clang-format off */ 
-    FL_Write6(fl_fshipdposix, POSIX_STATATBEGDP, "Start statat DIRFD=%ld, flags=0x%lx.", l_dirfd,flags,0,0,0,0);
-    /* clang-format on */
-    memset(&l_stat, 0, sizeof(l_stat));
-    l_statRC = fstatat(l_dirfd, dent.d_name, &l_stat, flags);
-    /* clang-format off */ 
-    FL_Write6(fl_fshipdposix, POSIX_STATATFINDP, "End statat dirplus.  rc=%ld  errno=%ld st_ino=%ld mode=%o uid=%ld gid=%ld", l_statRC, errno,l_stat.st_ino,l_stat.st_mode, l_stat.st_uid,l_stat.st_gid);
+    FL_Write6(fl_fshipdposix, POSIX_STATATFINDP, "End statat dirplus.  rc=%ld  index=%ld st_ino=%ld mode=%o uid=%ld gid=%ld", l_Item.rc, i,l_Item.st.st_ino,l_Item.st.st_mode, l_Item.st.st_uid,l_Item.st.st_gid);
     /* clang-format on */
 
-    if (l_statRC == 0) {
-      setEntryOut(l_stat, l_direntPlusPtr->entry_out);
+    if (l_Item.rc == 0) {
+      setEntryOut(l_Item.st, l_direntPlusPtr->entry_out);
       // printf("dirplus st_ino=%ld mode-%o \n",l_stat.st_ino,l_stat.st_mode);
-      if (!dent.d_type) { // file system does not support doing type, so grab
-                          // from stat
-        if (S_ISDIR(l_stat.st_mode))
+      if (!l_direntPlusPtr->dirent.type) { // file system does not support
+                                           // doing type, so grab from stat
+        if (S_ISDIR(l_Item.st.st_mode))
           l_direntPlusPtr->dirent.type = DT_DIR;
-        else if (S_ISREG(l_stat.st_mode))
+        else if (S_ISREG(l_Item.st.st_mode))
           l_direntPlusPtr->dirent.type = DT_REG;
-        else if (S_ISLNK(l_stat.st_mode))
+        else if (S_ISLNK(l_Item.st.st_mode))
           l_direntPlusPtr->dirent.type = DT_LNK;
       }
     } else {
@@ -1204,17 +1229,7 @@ int MessageHandler::readdirPlusOp(txp::Msg *pMsg) {
       memset(&l_direntPlusPtr->entry_out.attr, 0,
              sizeof(l_direntPlusPtr->entry_out.attr));
     }
-
-    reclen = FUSE_DIRENTPLUS_SIZE(l_direntPlusPtr);
-    charMemoryPtr += reclen;
-    bytes_written += reclen;
-    if ((maxMemSize - bytes_written) < MAXDIRENTPLUSENTRY) {
-      break;
-    }
-    l_direntPlusPtr = (struct fuse_direntplus *)charMemoryPtr;
-
-    readdir_r(dirp, &dent, &result);
-  };
+  }
 
   // change value in Response header for bytes written to buffer
   outMsg.hdr.len += bytes_written;
@@ -1282,6 +1297,11 @@ int MessageHandler::getattrOp(txp::Msg *pMsg) {
 
   struct stat l_stat;
 
+  // registered before the stat, a change after it is pushed
+  uint32_t l_Notify = 0;
+  if (l_Path != NULL)
+    l_Notify = _watcher.watchAttr(l_Path, in->hdr.nodeid);
+
   int l_statRC = 0;
   if (l_Path != NULL) {
     /* clang-format off */ 
@@ -1331,6 +1351,8 @@ int MessageHandler::getattrOp(txp::Msg *pMsg) {
                               sizeof(outMsg));
   if (!l_RC)
     l_RC = l_ResponseMsg->addAttribute(txp::nodeid, prevRemoteInode);
+  if (!l_RC && l_Notify)
+    l_RC = l_ResponseMsg->addAttribute(txp::notify, l_Notify);
 
   if (!l_RC) {
     ssize_t retSSize = _connectPtr->write(l_ResponseMsg);
@@ -1416,6 +1438,14 @@ int MessageHandler::lookupOp(txp::Msg *pMsg) {
       lookUpName = l_Path + indexToLookupName;
   }
 
+  // registered before the stat, a change after it is pushed
+  uint32_t l_Notify = 0;
+  if (lookUpName && _watcher.active()) {
+    std::string l_Dir(l_Path, indexToLookupName);
+    l_Notify = _watcher.watchEntry(l_Dir.empty() ? "." : l_Dir.c_str(),
+                                   in->hdr.nodeid, lookUpName);
+  }
+
   struct stat l_stat;
   int flags = AT_SYMLINK_NOFOLLOW;
   int l_statRC = 0;
@@ -1468,6 +1498,8 @@ int MessageHandler::lookupOp(txp::Msg *pMsg) {
     // l_RC = addlookupname(l_ResponseMsg,lookUpName,
     // l_lookUpNameLength,txp::lookupname);
   };
+  if (!l_RC && l_Notify)
+    l_RC = l_ResponseMsg->addAttribute(txp::notify, l_Notify);
 
   if (!l_RC) {
     ssize_t retSSize = _connectPtr->write(l_ResponseMsg);
@@ -1542,6 +1574,20 @@ int MessageHandler::Hello(txp::Msg *pMsg) {
                           << " chdir errno=" << errno << ":" << strerror(errno);
     return sendErrorResponse(pMsg, in, errno);
   }
+  // fshipcld asks for pushes when it caches metadata with long leases
+  uint32_t l_Notify = 0;
+  if (pMsg->retrieveAttr(txp::notify)) {
+    int l_Errno = _watcher.start([this](uint32_t pCode, uint64_t pNodeid,
+                                        const char *pName) {
+      sendInvalidate(pCode, pNodeid, pName);
+    });
+    if (l_Errno) {
+      LOG(fshipd, warning) << "no invalidation pushes, inotify errno="
+                           << l_Errno << ":" << strerror(l_Errno);
+    } else
+      l_Notify = 1;
+  }
+
   outHello outMsg(getpid());
   outMsg.statfsRC = statfs(_mountPath, &outMsg.sfs);
   if (outMsg.statfsRC) {
@@ -1568,6 +1614,8 @@ int MessageHandler::Hello(txp::Msg *pMsg) {
   if (!l_RC)
     l_RC = l_ResponseMsg->addAttribute(txp::outHello, (const char *)&outMsg,
                                        sizeof(outHello));
+  if (!l_RC && l_Notify)
+    l_RC = l_ResponseMsg->addAttribute(txp::notify, l_Notify);
   if (!l_RC) {
 
     ssize_t retSSize = _connectPtr->write(l_ResponseMsg);
@@ -1587,6 +1635,27 @@ int MessageHandler::Hello(txp::Msg *pMsg) {
   return 0; // version check....
 };
 
+void MessageHandler::sendInvalidate(uint32_t pCode, uint64_t pNodeid,
+                                    const char *pName) {
+  txp::Msg *l_Msg = 0;
+  int l_RC = txp::Msg::buildMsg(txp::CORAL_INVALIDATE, l_Msg);
+  if (l_RC)
+    abort();
+  l_RC = l_Msg->addAttribute(txp::notify, pCode);
+  if (!l_RC)
+    l_RC = l_Msg->addAttribute(txp::nodeid, pNodeid);
+  if (!l_RC && pName)
+    l_RC = l_Msg->addAttribute(txp::name, pName, strlen(pName) + 1);
+  if (!l_RC) {
+    // fails once the connection is gone, the client cache goes with it
+    ssize_t retSSize = _connectPtr->write(l_Msg);
+    if (retSSize == -1)
+      LOG(fshipd, debug) << "CORAL_INVALIDATE code=" << pCode
+                         << " nodeid=" << pNodeid << " errno=" << errno;
+  }
+  delete l_Msg;
+}
+
 void *workerThread(void *MHPtr) {
   MessageHandler *mythis = (MessageHandler *)MHPtr;
   mythis->run();
@@ -1594,17 +1663,27 @@ void *workerThread(void *MHPtr) {
 }
 
 void *MessageHandler::run() {
-  int rc;
+  int rc = 0;
   pid_t tid = syscall(SYS_gettid);
   LOG(fshipd, always) << "fshipd thread lwp pid=" << tid;
   do {
-    sem_wait(&threadSerialSem);
-    rc = _connectPtr->poll4DataIn();
-    if (rc != 1) {
-      sem_post(&threadSerialSem);
-      break;
-    }
-    rc = readInMessage();
+    Request l_Request;
+    _requests.pop(l_Request);
+    if (!l_Request.msg)
+      break; // reader is done
+    // The reader claimed the lane of the request, run it and whatever got
+    // parked on its nodeid meanwhile
+    // A worker only ends on a stop request, otherwise the reader keeps
+    // queueing requests nobody drains
+    do {
+      uint64_t l_Nodeid = l_Request.nodeid;
+      int l_RC = handleMessage(l_Request);
+      if (l_RC)
+        LOG(fshipd, error) << "MessageHandler::run(): request ended with rc="
+                           << l_RC;
+      if (!_ordering.release(l_Nodeid, l_Request))
+        break;
+    } while (1);
   } while (1);
 
   if (rc == 0) {
@@ -1631,26 +1710,118 @@ void *MessageHandler::run(unsigned numthreads) {
     }
     blocklist.push_back(tid);
   }
+  _numWorkers = blocklist.size();
+
+  // This thread is the only reader of the connection.  It hands each message
+  // to the workers, so idle workers no longer take turns on the connection.
+  time_t l_LastStats = time(NULL);
+  while (_numWorkers) {
+    rc = _connectPtr->poll4DataIn();
+    if (rc != 1)
+      break;
+    rc = readInMessage();
+    if (rc)
+      break;
+    if (_statsInterval) {
+      time_t l_Now = time(NULL);
+      if (l_Now - l_LastStats >= (time_t)_statsInterval) {
+        logQueueStats("interval");
+        l_LastStats = l_Now;
+      }
+    }
+  }
+  LOG(fshipd, always) << "MessageHandler::run(unsigned): reader ending with rc="
+                      << rc;
+
+  // One stop request per worker, queued behind everything already read
+  for (x = 0; x < _numWorkers; x++) {
+    Request l_Stop = {NULL, NULL, 0};
+    _requests.push(l_Stop);
+  }
   for (auto tid : blocklist) {
     rc = pthread_join(tid, &rtnvalue);
   }
+  _watcher.stop();
+  logQueueStats("end");
   return NULL;
 }
 
+void MessageHandler::logQueueStats(const char *pWhen) {
+  LOG(fshipd, info) << "Request queue stats (" << pWhen
+                    << "): depth=" << _requests.depth()
+                    << " maxdepth=" << _requests.maxDepth()
+                    << " queued=" << _requests.pushed()
+                    << " fullwaits=" << _requests.fullWaits()
+                    << " nodeidwaits=" << _ordering.deferred()
+                    << " workers=" << _numWorkers;
+}
+
+uint64_t MessageHandler::orderingNodeid(txp::Msg *pMsg) {
+  // Requests that change or retire the state of an open file or inode have to
+  // run in the order fshipcld sent them.  Lookups, getattrs, reads and
+  // directory reads run in any order, which is what lets metadata heavy jobs
+  // use all worker threads.
+  switch (pMsg->getMsgId()) {
+  case txp::FUSE_WRITE:
+  case txp::FUSE_SETATTR:
+  case txp::FUSE_FLUSH:
+  case txp::FUSE_FSYNC:
+  case txp::FUSE_FALLOCATE:
+  case txp::FUSE_RELEASE:
+  case txp::FUSE_RELEASEDIR:
+  case txp::FUSE_GETLK:
+  case txp::FUSE_SETLK:
+  case txp::FUSE_SETLKW:
+  case txp::FUSE_SETXATTR:
+  case txp::FUSE_REMOVEXATTR:
+    break;
+  default:
+    return 0;
+  }
+
+  txp::AttrPtr_char_array *l_inHdrAttribute =
+      (txp::AttrPtr_char_array *)pMsg->retrieveAttr(txp::fuse_in_header);
+  if (!l_inHdrAttribute)
+    return 0;
+  inMsgGeneric *in = (inMsgGeneric *)l_inHdrAttribute->getDataPtr();
+  return in->hdr.nodeid;
+}
+
 int MessageHandler::readInMessage() {
   int l_RC = 0;
 
   txp::Msg *l_MsgPtr = 0;
   memItemPtr l_memItemPtr = _connectPtr->getReadChunk();
   if (!l_memItemPtr) {
-    sem_post(&threadSerialSem);
     return 1;
   }
   l_RC =
       _connectPtr->read(l_MsgPtr, l_memItemPtr->address, l_memItemPtr->length);
-  sem_post(&threadSerialSem);
 
   if (l_RC == 0) {
+    // Lanes are claimed here, in the order the requests were read, a request
+    // whose nodeid is busy waits on its lane instead of in the queue
+    Request l_Request = {l_MsgPtr, l_memItemPtr, orderingNodeid(l_MsgPtr)};
+    if (_ordering.acquire(l_Request))
+      _requests.push(l_Request);
+  } else {
+    if (l_MsgPtr) {
+      delete l_MsgPtr;
+      l_MsgPtr = 0;
+    }
+    _connectPtr->freeReadChunk(l_memItemPtr);
+  }
+
+  return l_RC;
+}
+
+int MessageHandler::handleMessage(Request &pRequest) {
+  int l_RC = 0;
+
+  txp::Msg *l_MsgPtr = pRequest.msg;
+  memItemPtr &l_memItemPtr = pRequest.mip;
+
+  if (l_MsgPtr) {
     txp::Id l_Id = l_MsgPtr->getMsgId();
     // LOG(info) << "FUSE ID="<<l_Id;
     switch (l_Id) {
@@ -1766,6 +1937,10 @@ int MessageHandler::readInMessage() {
       break;
     case txp::CORAL_NO_OP:
       break;
+    case txp::CORAL_INVALIDATE:
+      // pushed by fshipd, never received
+      LOG(fshipd, warning) << "CORAL_INVALIDATE received from fshipcld";
+      break;
 
     case txp::CORAL_AUTHENTICATE:
       abort();
@@ -1777,8 +1952,8 @@ int MessageHandler::readInMessage() {
       signal(l_MsgPtr);
       break;
     case txp::CORAL_ERROR:
-      return -1;
-      abort();
+      // e.g. fshipcld timed out getting an RDMA chunk, keep serving
+      LOG(fshipd, warning) << "CORAL_ERROR received from fshipcld";
       break;
     case txp::FUSE_GETXATTR:
       getxattrOp(l_MsgPtr);
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ |    RequestQueue.cc
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//! \file
+//! \brief Lock-free request queue and per-nodeid ordering for fshipd workers
+#include "RequestQueue.h"
+#include <errno.h>
+#include <sched.h>
+
+RequestQueue::RequestQueue(size_t pCapacity)
+    : _pushPos(0), _popPos(0), _depth(0), _maxDepth(0), _pushed(0),
+      _fullWaits(0) {
+  size_t l_Capacity = 2;
+  while (l_Capacity < pCapacity)
+    l_Capacity <<= 1;
+  _cells = new Cell[l_Capacity];
+  _mask = l_Capacity - 1;
+  for (size_t i = 0; i < l_Capacity; i++)
+    _cells[i].seq.store(i, std::memory_order_relaxed);
+  sem_init(&_available, 0, 0);
+  sem_init(&_free, 0, l_Capacity);
+}
+
+RequestQueue::~RequestQueue() {
+  sem_destroy(&_free);
+  sem_destroy(&_available);
+  delete[] _cells;
+}
+
+bool RequestQueue::tryPush(const Request &pRequest) {
+  size_t l_Pos = _pushPos.load(std::memory_order_relaxed);
+  for (;;) {
+    Cell *l_Cell = &_cells[l_Pos & _mask];
+    size_t l_Seq = l_Cell->seq.load(std::memory_order_acquire);
+    intptr_t l_Diff = (intptr_t)l_Seq - (intptr_t)l_Pos;
+    if (l_Diff == 0) {
+      if (_pushPos.compare_exchange_weak(l_Pos, l_Pos + 1,
+                                         std::memory_order_relaxed)) {
+        l_Cell->request = pRequest;
+        l_Cell->seq.store(l_Pos + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (l_Diff < 0) {
+      return false; // full
+    } else {
+      l_Pos = _pushPos.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool RequestQueue::tryPop(Request &pRequest) {
+  size_t l_Pos = _popPos.load(std::memory_order_relaxed);
+  for (;;) {
+    Cell *l_Cell = &_cells[l_Pos & _mask];
+    size_t l_Seq = l_Cell->seq.load(std::memory_order_acquire);
+    intptr_t l_Diff = (intptr_t)l_Seq - (intptr_t)(l_Pos + 1);
+    if (l_Diff == 0) {
+      if (_popPos.compare_exchange_weak(l_Pos, l_Pos + 1,
+                                        std::memory_order_relaxed)) {
+        pRequest = l_Cell->request;
+        l_Cell->seq.store(l_Pos + _mask + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (l_Diff < 0) {
+      return false; // empty
+    } else {
+      l_Pos = _popPos.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void RequestQueue::push(const Request &pRequest) {
+  if (sem_trywait(&_free)) {
+    _fullWaits.fetch_add(1, std::memory_order_relaxed);
+    while (sem_wait(&_free) && errno == EINTR)
+      ;
+  }
+  // A slot is free, but the consumer that freed the cell ahead of ours may
+  // still be copying the request out of it for a moment.
+  while (!tryPush(pRequest))
+    sched_yield();
+  _pushed.fetch_add(1, std::memory_order_relaxed);
+  uint64_t l_Depth = _depth.fetch_add(1, std::memory_order_relaxed) + 1;
+  uint64_t l_Max = _maxDepth.load(std::memory_order_relaxed);
+  while (l_Depth > l_Max &&
+         !_maxDepth.compare_exchange_weak(l_Max, l_Depth,
+                                          std::memory_order_relaxed))
+    ;
+  sem_post(&_available);
+}
+
+void RequestQueue::pop(Request &pRequest) {
+  while (sem_wait(&_available) && errno == EINTR)
+    ;
+  // The semaphore was posted after the request was published, but a
+  // concurrent consumer may still hold the cell ahead of ours for a moment.
+  while (!tryPop(pRequest))
+    sched_yield();
+  _depth.fetch_sub(1, std::memory_order_relaxed);
+  sem_post(&_free);
+}
+
+bool NodeOrdering::acquire(const Request &pRequest) {
+  if (!pRequest.nodeid)
+    return true;
+
+  Lane &l_Lane = lane(pRequest.nodeid);
+  std::lock_guard<std::mutex> l_Guard(l_Lane.lock);
+  if (l_Lane.busy) {
+    l_Lane.parked.push_back(pRequest);
+    _deferred.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  l_Lane.busy = true;
+  return true;
+}
+
+bool NodeOrdering::release(uint64_t pNodeid, Request &pNext) {
+  if (!pNodeid)
+    return false;
+
+  Lane &l_Lane = lane(pNodeid);
+  std::lock_guard<std::mutex> l_Guard(l_Lane.lock);
+  if (l_Lane.parked.empty()) {
+    l_Lane.busy = false;
+    return false;
+  }
+  pNext = l_Lane.parked.front();
+  l_Lane.parked.pop_front();
+  return true;
+}
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ |    StatPool.cc
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//! \file
+//! \brief Parallel fstatat of the names in a directory window
+#include "StatPool.h"
+#include "identity.h"
+#include "logging.h"
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+
+void StatPool::start(unsigned pThreads) {
+  for (unsigned x = 0; x < pThreads; x++) {
+    pthread_t l_Tid;
+    int rc = pthread_create(&l_Tid, NULL, worker, this);
+    if (rc != 0) {
+      LOG(fshipd, always) << "StatPool::start(): pthread_create rc=" << rc;
+      break;
+    }
+    _threads.push_back(l_Tid);
+  }
+  LOG(fshipd, always) << "stat threads=" << _threads.size();
+}
+
+void StatPool::stop() {
+  {
+    std::lock_guard<std::mutex> l_Guard(_lock);
+    _stop = true;
+  }
+  _posted.notify_all();
+  for (auto l_Tid : _threads)
+    pthread_join(l_Tid, NULL);
+  _threads.clear();
+}
+
+void *StatPool::worker(void *pPool) {
+  ((StatPool *)pPool)->run();
+  return NULL;
+}
+
+void StatPool::work(Batch &pBatch) {
+  size_t i;
+  while ((i = pBatch.next.fetch_add(1, std::memory_order_relaxed)) <
+         pBatch.count) {
+    StatItem &l_Item = pBatch.items[i];
+    l_Item.rc = fstatat(pBatch.dirfd, l_Item.name, &l_Item.st,
+                        AT_SYMLINK_NOFOLLOW);
+  }
+}
+
+void StatPool::run() {
+  std::unique_lock<std::mutex> l_Lock(_lock);
+  while (1) {
+    _posted.wait(l_Lock, [this] { return _stop || !_batches.empty(); });
+    if (_stop)
+      break;
+    Batch *l_Batch = _batches.front();
+    if (l_Batch->next.load(std::memory_order_relaxed) >= l_Batch->count) {
+      _batches.pop_front(); // all claimed, the poster takes it from here
+      continue;
+    }
+    l_Batch->users++;
+    l_Lock.unlock();
+    // becomeUser keeps the identity of the thread, so this is cheap when the
+    // same user lists many windows
+    if (becomeUser(l_Batch->uid, l_Batch->gid) == 0)
+      work(*l_Batch);
+    l_Lock.lock();
+    if (!--l_Batch->users)
+      _idle.notify_all();
+  }
+}
+
+void StatPool::statAt(int pDirfd, StatItem *pItems, size_t pCount,
+                      uid_t pUid, gid_t pGid) {
+  Batch l_Batch;
+  l_Batch.dirfd = pDirfd;
+  l_Batch.items = pItems;
+  l_Batch.count = pCount;
+  l_Batch.uid = pUid;
+  l_Batch.gid = pGid;
+  l_Batch.next.store(0, std::memory_order_relaxed);
+  l_Batch.users = 0;
+
+  if (_threads.empty() || (pCount < MIN_PARALLEL)) {
+    work(l_Batch);
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> l_Guard(_lock);
+    _batches.push_back(&l_Batch);
+  }
+  _posted.notify_all();
+
+  // the caller already is the requestor
+  work(l_Batch);
+
+  std::unique_lock<std::mutex> l_Lock(_lock);
+  std::deque<Batch *>::iterator it =
+      std::find(_batches.begin(), _batches.end(), &l_Batch);
+  if (it != _batches.end())
+    _batches.erase(it);
+  _idle.wait(l_Lock, [&l_Batch] { return l_Batch.users == 0; });
+}
@@ -492,6 +492,8 @@ int main(int argc, char *argv[]) {
 
   if (!l_RC) {
     MessageHandler mh(l_CnxPtr);
+    mh.setStatsInterval(config.get("fship.server.queuestatsinterval", 60));
+    mh.setStatThreads(config.get("fship.server.statthreads", 4));
     mh.run(config.get("fship.server.numthreads",
                       1)); // monitor for incoming messages
   } else {
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ |    invalidationwatcher_test.cc
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//
+// Exercises InvalidationWatcher on a scratch directory: a registered name is
+// pushed when it is created, removed or changed, a registered node when its
+// attributes change, a directory when a name in it changes and the names of a
+// removed directory all at once.  Registrations are one-shot, changes to what
+// is not registered are not pushed.
+//
+
+#include "../include/InvalidationWatcher.h"
+#include "csmutil/include/csm_test_utils.h"
+#include "fshipcld.h"
+#include <chrono>
+#include <condition_variable>
+#include <errno.h>
+#include <fcntl.h>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+static int failures = 0;
+
+struct Pushed {
+  uint32_t code;
+  uint64_t nodeid;
+  std::string name;
+};
+
+static std::mutex pushLock;
+static std::condition_variable pushCond;
+static std::vector<Pushed> pushes;
+
+static void collect(uint32_t pCode, uint64_t pNodeid, const char *pName) {
+  std::lock_guard<std::mutex> l_Guard(pushLock);
+  Pushed l_Pushed = {pCode, pNodeid, pName ? pName : ""};
+  pushes.push_back(l_Pushed);
+  pushCond.notify_all();
+}
+
+// the pushes seen once pCount arrived or the wait timed out
+static std::vector<Pushed> waitFor(size_t pCount, int pMsec = 2000) {
+  std::unique_lock<std::mutex> l_Guard(pushLock);
+  pushCond.wait_for(l_Guard, std::chrono::milliseconds(pMsec),
+                    [pCount] { return pushes.size() >= pCount; });
+  std::vector<Pushed> l_Seen;
+  l_Seen.swap(pushes);
+  return l_Seen;
+}
+
+static int pushed(const std::vector<Pushed> &pSeen, uint32_t pCode,
+                  uint64_t pNodeid, const char *pName = "") {
+  for (auto &l_Pushed : pSeen)
+    if ((l_Pushed.code == pCode) && (l_Pushed.nodeid == pNodeid) &&
+        (l_Pushed.name == pName))
+      return 1;
+  return 0;
+}
+
+static void touch(const std::string &pPath) {
+  int l_FD = open(pPath.c_str(), O_CREAT | O_WRONLY, 0644);
+  if (l_FD >= 0)
+    close(l_FD);
+}
+
+static void testEntry(InvalidationWatcher &pWatcher, const std::string &pDir) {
+  touch(pDir + "/a");
+  CHECK(pWatcher.watchEntry(pDir.c_str(), 7, "a"), "name not registered");
+  CHECK(pWatcher.watchEntry(pDir.c_str(), 7, "missing"),
+        "missing name not registered");
+
+  touch(pDir + "/other");
+  std::vector<Pushed> l_Seen = waitFor(1, 200);
+  CHECK(l_Seen.empty(), "%zu pushes for a name not registered",
+        l_Seen.size());
+
+  unlink((pDir + "/a").c_str());
+  l_Seen = waitFor(1);
+  CHECK((l_Seen.size() == 1) && pushed(l_Seen, FSHIP_INVAL_ENTRY, 7, "a"),
+        "removed name not pushed once");
+
+  // the registration of "a" is gone, "missing" is still registered
+  touch(pDir + "/a");
+  touch(pDir + "/missing");
+  l_Seen = waitFor(2, 500);
+  CHECK((l_Seen.size() == 1) &&
+            pushed(l_Seen, FSHIP_INVAL_ENTRY, 7, "missing"),
+        "created name not pushed once");
+}
+
+static void testAttr(InvalidationWatcher &pWatcher, const std::string &pDir) {
+  std::string l_File = pDir + "/b";
+  touch(l_File);
+  CHECK(pWatcher.watchAttr(l_File.c_str(), 9), "node not registered");
+  chmod(l_File.c_str(), 0600);
+  std::vector<Pushed> l_Seen = waitFor(1);
+  CHECK((l_Seen.size() == 1) && pushed(l_Seen, FSHIP_INVAL_ATTR, 9),
+        "changed attributes not pushed");
+  chmod(l_File.c_str(), 0644);
+  l_Seen = waitFor(1, 200);
+  CHECK(l_Seen.empty(), "attributes pushed again without a registration");
+
+  // a directory's size and times change with the names in it
+  CHECK(pWatcher.watchAttr(pDir.c_str(), 3), "directory not registered");
+  touch(pDir + "/c");
+  l_Seen = waitFor(1);
+  CHECK((l_Seen.size() == 1) && pushed(l_Seen, FSHIP_INVAL_ATTR, 3),
+        "directory change not pushed");
+}
+
+static void testRemovedDir(InvalidationWatcher &pWatcher,
+                           const std::string &pDir) {
+  std::string l_Sub = pDir + "/sub";
+  mkdir(l_Sub.c_str(), 0755);
+  CHECK(pWatcher.watchEntry(l_Sub.c_str(), 11, "x"), "name not registered");
+  rmdir(l_Sub.c_str());
+  std::vector<Pushed> l_Seen = waitFor(1);
+  CHECK(pushed(l_Seen, FSHIP_INVAL_DIR, 11),
+        "names of a removed directory not pushed");
+}
+
+int main(int argc, char **argv) {
+  char l_Template[] = "/tmp/invalidationwatcher_test.XXXXXX";
+  char *l_Dir = mkdtemp(l_Template);
+  if (!l_Dir) {
+    printf("invalidationwatcher_test: mkdtemp errno=%d\n", errno);
+    return 1;
+  }
+
+  InvalidationWatcher l_Watcher;
+  CHECK(!l_Watcher.watchEntry(l_Dir, 7, "a"), "registered before start");
+  int rc = l_Watcher.start(collect);
+  CHECK(!rc && l_Watcher.active(), "start rc=%d", rc);
+  if (!rc) {
+    testEntry(l_Watcher, l_Dir);
+    testAttr(l_Watcher, l_Dir);
+    testRemovedDir(l_Watcher, l_Dir);
+  }
+  l_Watcher.stop();
+  CHECK(!l_Watcher.active(), "active after stop");
+
+  std::string l_Cleanup = std::string("rm -rf ") + l_Dir;
+  rc = system(l_Cleanup.c_str());
+
+  printf("invalidationwatcher_test: %d failure(s)\n", failures);
+
+  return failures ? 1 : 0;
+}
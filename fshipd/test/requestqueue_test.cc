@@ -0,0 +1,220 @@
+/*******************************************************************************
+ |    requestqueue_test.cc
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//
+// Exercises the fshipd request hand off without a connection: every request
+// pushed by several producers is popped exactly once and in order per producer,
+// a full queue blocks the producer until a slot is freed, and requests for the
+// same nodeid run one at a time in the order the reader queued them.
+//
+
+#include "../include/RequestQueue.h"
+#include "csmutil/include/csm_test_utils.h"
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+static int failures = 0;
+
+static const uint64_t PRODUCERS = 4;
+static const uint64_t CONSUMERS = 4;
+static const uint64_t PER_PRODUCER = 20000;
+
+// a request carries its producer and sequence number in the nodeid, msg is
+// only NULL for the stop request
+static txp::Msg *const RUN = (txp::Msg *)&failures;
+
+static Request requestFor(uint64_t pProducer, uint64_t pSeq) {
+  Request l_Request = {RUN, NULL, (pProducer << 32) | pSeq};
+  return l_Request;
+}
+
+static void testMultiProducerConsumer() {
+  RequestQueue l_Queue(8); // small, producers keep finding it full
+  std::vector<std::vector<uint64_t> > l_Seen(CONSUMERS,
+                                             std::vector<uint64_t>());
+  std::vector<std::thread> l_Threads;
+
+  for (uint64_t c = 0; c < CONSUMERS; c++)
+    l_Threads.push_back(std::thread([&l_Queue, &l_Seen, c]() {
+      Request l_Request;
+      for (;;) {
+        l_Queue.pop(l_Request);
+        if (!l_Request.msg)
+          break;
+        l_Seen[c].push_back(l_Request.nodeid);
+      }
+    }));
+  for (uint64_t p = 0; p < PRODUCERS; p++)
+    l_Threads.push_back(std::thread([&l_Queue, p]() {
+      for (uint64_t i = 0; i < PER_PRODUCER; i++)
+        l_Queue.push(requestFor(p, i));
+    }));
+  for (uint64_t p = 0; p < PRODUCERS; p++)
+    l_Threads[CONSUMERS + p].join();
+  for (uint64_t c = 0; c < CONSUMERS; c++) {
+    Request l_Stop = {NULL, NULL, 0};
+    l_Queue.push(l_Stop);
+  }
+  for (uint64_t c = 0; c < CONSUMERS; c++)
+    l_Threads[c].join();
+
+  // each request once, and a consumer sees each producer's requests in order
+  std::vector<uint64_t> l_Count(PRODUCERS * PER_PRODUCER, 0);
+  for (uint64_t c = 0; c < CONSUMERS; c++) {
+    std::vector<uint64_t> l_Next(PRODUCERS, 0);
+    bool l_Ordered = true;
+    for (uint64_t l_Nodeid : l_Seen[c]) {
+      uint64_t l_Producer = l_Nodeid >> 32;
+      uint64_t l_Seq = l_Nodeid & 0xFFFFFFFF;
+      if (l_Producer >= PRODUCERS || l_Seq >= PER_PRODUCER) {
+        CHECK(0, "consumer %lu popped a request never pushed", c);
+        continue;
+      }
+      l_Count[l_Producer * PER_PRODUCER + l_Seq]++;
+      if (l_Seq < l_Next[l_Producer])
+        l_Ordered = false;
+      l_Next[l_Producer] = l_Seq + 1;
+    }
+    CHECK(l_Ordered, "consumer %lu popped a producer's requests out of order",
+          c);
+  }
+  uint64_t l_Wrong = 0;
+  for (uint64_t n : l_Count)
+    l_Wrong += (n != 1);
+  CHECK(!l_Wrong, "%lu requests not popped exactly once", l_Wrong);
+
+  CHECK(l_Queue.depth() == 0, "depth %lu after draining", l_Queue.depth());
+  CHECK(l_Queue.maxDepth() <= 8, "depth %lu beyond the capacity",
+        l_Queue.maxDepth());
+  CHECK(l_Queue.pushed() == PRODUCERS * PER_PRODUCER + CONSUMERS,
+        "%lu requests counted as pushed", l_Queue.pushed());
+}
+
+static void testFull() {
+  RequestQueue l_Queue(2);
+  Request l_Request;
+
+  l_Queue.push(requestFor(0, 0));
+  l_Queue.push(requestFor(0, 1));
+  CHECK(l_Queue.fullWaits() == 0, "full wait before the queue was full");
+
+  // the producer blocks until a consumer frees a slot
+  std::thread l_Producer([&l_Queue]() { l_Queue.push(requestFor(0, 2)); });
+  usleep(200000);
+  CHECK(l_Queue.pushed() == 2, "push into a full queue did not wait");
+  CHECK(l_Queue.fullWaits() == 1, "%lu full waits counted",
+        l_Queue.fullWaits());
+
+  l_Queue.pop(l_Request);
+  CHECK(l_Request.nodeid == 0, "oldest request not popped first");
+  l_Producer.join();
+  CHECK(l_Queue.pushed() == 3 && l_Queue.depth() == 2,
+        "blocked push not completed after a pop");
+  l_Queue.pop(l_Request);
+  l_Queue.pop(l_Request);
+  CHECK(l_Request.nodeid == 2, "blocked request not queued last");
+}
+
+// the reader and workers of MessageHandler::run() around a request counter
+static void testNodeOrdering() {
+  static const uint64_t NODEIDS = 2;
+  static const uint64_t REQUESTS = 50000;
+  static const uint64_t WORKERS = 8;
+
+  RequestQueue l_Queue(16);
+  NodeOrdering l_Ordering;
+  std::atomic<uint64_t> l_Next[NODEIDS + 1];
+  std::atomic<int> l_Running[NODEIDS + 1];
+  std::atomic<uint64_t> l_OutOfOrder(0);
+  std::atomic<uint64_t> l_Overlapped(0);
+  std::atomic<uint64_t> l_Unordered(0);
+  for (uint64_t n = 0; n <= NODEIDS; n++) {
+    l_Next[n] = 0;
+    l_Running[n] = 0;
+  }
+
+  std::vector<std::thread> l_Workers;
+  for (uint64_t w = 0; w < WORKERS; w++)
+    l_Workers.push_back(std::thread([&]() {
+      Request l_Request;
+      for (;;) {
+        l_Queue.pop(l_Request);
+        if (!l_Request.msg)
+          break;
+        do {
+          uint64_t l_Nodeid = l_Request.nodeid;
+          uint64_t l_Seq = (uint64_t)l_Request.mip;
+          if (!l_Nodeid) {
+            l_Unordered++;
+          } else {
+            if (l_Running[l_Nodeid]++)
+              l_Overlapped++;
+            if (l_Next[l_Nodeid].load() != l_Seq)
+              l_OutOfOrder++;
+            l_Next[l_Nodeid] = l_Seq + 1;
+            l_Running[l_Nodeid]--;
+          }
+          if (!l_Ordering.release(l_Nodeid, l_Request))
+            break;
+        } while (1);
+      }
+    }));
+
+  // the single reader claims lanes in the order it queues the requests
+  uint64_t l_Seq[NODEIDS + 1] = {0};
+  uint64_t l_Parked = 0;
+  for (uint64_t i = 0; i < REQUESTS; i++) {
+    uint64_t l_Nodeid = (i * 7) % (NODEIDS + 1); // 0 needs no ordering
+    Request l_Request = {RUN, (memItemPtr)l_Seq[l_Nodeid]++, l_Nodeid};
+    if (l_Ordering.acquire(l_Request))
+      l_Queue.push(l_Request);
+    else
+      l_Parked++;
+  }
+  for (uint64_t w = 0; w < WORKERS; w++) {
+    Request l_Stop = {NULL, NULL, 0};
+    l_Queue.push(l_Stop);
+  }
+  for (auto &l_Worker : l_Workers)
+    l_Worker.join();
+
+  CHECK(!l_OutOfOrder, "%lu requests ran out of order for their nodeid",
+        l_OutOfOrder.load());
+  CHECK(!l_Overlapped, "%lu requests ran alongside one for the same nodeid",
+        l_Overlapped.load());
+  uint64_t l_Ran = l_Unordered;
+  for (uint64_t n = 1; n <= NODEIDS; n++)
+    l_Ran += l_Next[n];
+  CHECK(l_Ran == REQUESTS, "%lu of %lu requests ran", l_Ran, REQUESTS);
+  CHECK(l_Ordering.deferred() == l_Parked, "%lu parked but %lu deferred",
+        l_Parked, l_Ordering.deferred());
+
+  // every lane is free again
+  Request l_Request = {RUN, NULL, 1};
+  Request l_Waiting;
+  CHECK(l_Ordering.acquire(l_Request) && !l_Ordering.release(1, l_Waiting),
+        "lane still busy after the workers drained it");
+}
+
+int main(int argc, char **argv) {
+  testMultiProducerConsumer();
+  testFull();
+  testNodeOrdering();
+
+  printf("requestqueue_test: %d failure(s)\n", failures);
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ |    statpool_test.cc
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//
+// Exercises the parallel fstatat of StatPool without a file system: fstatat
+// is replaced by a stand-in that counts the calls per item and the threads
+// making them.  A batch above MIN_PARALLEL is shared with the pool threads,
+// every item is stat'ed exactly once and statAt() only returns once the pool
+// threads are done with the batch.  Small batches and a pool without threads
+// run on the caller alone.
+//
+
+#include "../include/StatPool.h"
+#include "csmutil/include/csm_test_utils.h"
+#include "statpool_test_fl.h"
+#include <fcntl.h>
+#include <mutex>
+#include <set>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+
+static int failures = 0;
+
+static const int DIRFD = 1234;
+static const size_t MAX_ITEMS = 4096;
+
+static std::atomic<int> calls[MAX_ITEMS];
+static std::atomic<int> running[MAX_ITEMS]; // fstatat calls not returned yet
+static std::atomic<int> wrongArgs(0);
+static std::mutex threadsLock;
+static std::set<std::thread::id> threads;
+static std::set<std::thread::id> callers; // threads that posted a batch
+
+// Stands in for the fstatat of libc, also for StatPool.cc as it is built with
+// the same headers and flags.  The item name is its index, other directories
+// are stat'ed for real.
+int fstatat(int pDirfd, const char *pName, struct stat *pSt,
+            int pFlags) __THROW {
+  if (pDirfd != DIRFD)
+    return syscall(SYS_newfstatat, pDirfd, pName, pSt, pFlags);
+  size_t l_Index = strtoul(pName, NULL, 10);
+  if (pFlags != AT_SYMLINK_NOFOLLOW || l_Index >= MAX_ITEMS) {
+    wrongArgs++;
+    return -1;
+  }
+  running[l_Index]++;
+  calls[l_Index]++;
+  bool l_Helper;
+  {
+    std::lock_guard<std::mutex> l_Guard(threadsLock);
+    threads.insert(std::this_thread::get_id());
+    l_Helper = !callers.count(std::this_thread::get_id());
+  }
+  // pool threads are slow, so the poster runs out of items before they do
+  usleep(l_Helper ? 20000 : 100);
+  memset(pSt, 0, sizeof(*pSt));
+  pSt->st_ino = l_Index;
+  running[l_Index]--;
+  return (l_Index % 5) ? 0 : -1;
+}
+
+static void reset() {
+  for (size_t i = 0; i < MAX_ITEMS; i++)
+    calls[i] = 0;
+  std::lock_guard<std::mutex> l_Guard(threadsLock);
+  threads.clear();
+  callers.clear();
+}
+
+// statAt() pCount items from the current thread, returns the items not
+// filled exactly once and correctly
+static size_t statBatch(StatPool &pPool, size_t pFirst, size_t pCount) {
+  {
+    std::lock_guard<std::mutex> l_Guard(threadsLock);
+    callers.insert(std::this_thread::get_id());
+  }
+  std::vector<StatItem> l_Items(pCount);
+  for (size_t i = 0; i < pCount; i++) {
+    snprintf(l_Items[i].name, sizeof(l_Items[i].name), "%zu", pFirst + i);
+    l_Items[i].rc = 12345;
+  }
+  pPool.statAt(DIRFD, &l_Items[0], pCount, getuid(), getgid());
+
+  int l_Running = 0;
+  for (size_t i = 0; i < pCount; i++)
+    l_Running += running[pFirst + i].load();
+  CHECK(!l_Running, "statAt() returned with %d fstatat calls running",
+        l_Running);
+  size_t l_Wrong = 0;
+  for (size_t i = 0; i < pCount; i++) {
+    size_t l_Index = pFirst + i;
+    l_Wrong += (calls[l_Index].load() != 1 || l_Items[i].st.st_ino != l_Index ||
+                l_Items[i].rc != ((l_Index % 5) ? 0 : -1));
+  }
+  return l_Wrong;
+}
+
+static void testInline() {
+  // a pool without threads
+  StatPool l_Pool;
+  reset();
+  size_t l_Wrong = statBatch(l_Pool, 0, 64);
+  CHECK(!l_Wrong, "%zu items not stat'ed once without pool threads", l_Wrong);
+  CHECK(threads.size() == 1, "%zu threads stat'ed without pool threads",
+        threads.size());
+
+  // a small batch
+  l_Pool.start(4);
+  reset();
+  l_Wrong = statBatch(l_Pool, 0, StatPool::MIN_PARALLEL - 1);
+  CHECK(!l_Wrong, "%zu items of a small batch not stat'ed once", l_Wrong);
+  CHECK(threads.size() == 1, "%zu threads stat'ed a small batch",
+        threads.size());
+  l_Pool.stop();
+}
+
+static void testParallel() {
+  StatPool l_Pool;
+  l_Pool.start(4);
+
+  for (int l_Round = 0; l_Round < 5; l_Round++) {
+    reset();
+    size_t l_Wrong = statBatch(l_Pool, 0, 4 * StatPool::MIN_PARALLEL);
+    CHECK(!l_Wrong, "round %d: %zu items not stat'ed exactly once", l_Round,
+          l_Wrong);
+    CHECK(threads.size() > 1, "round %d: pool threads did not help",
+          l_Round);
+  }
+
+  // two callers share the pool threads
+  reset();
+  size_t l_Wrong[2] = {0, 0};
+  std::thread l_Other([&l_Pool, &l_Wrong]() {
+    for (int i = 0; i < 5; i++)
+      l_Wrong[1] += statBatch(l_Pool, 1000 + i * 100, 100);
+  });
+  for (int i = 0; i < 5; i++)
+    l_Wrong[0] += statBatch(l_Pool, 2000 + i * 100, 100);
+  l_Other.join();
+  CHECK(!l_Wrong[0] && !l_Wrong[1],
+        "%zu and %zu items of concurrent batches not stat'ed exactly once",
+        l_Wrong[0], l_Wrong[1]);
+
+  l_Pool.stop();
+  CHECK(!wrongArgs, "%d fstatat calls with wrong arguments", wrongArgs.load());
+}
+
+int main(int argc, char **argv) {
+  // the pool threads take on the requestor's identity, which is flight logged
+  FL_CreateAll("/tmp");
+
+  testInline();
+  testParallel();
+
+  printf("statpool_test: %d failure(s)\n", failures);
+
+  return failures ? 1 : 0;
+}
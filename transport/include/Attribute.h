@@ -31,7 +31,9 @@
 
 #include "crc.h"
 #include "HeapBuffer.h"
+#include "AttributeSlab.h"
 #include "Log.h"
+#include "ObjectPool.h"
 
 namespace txp {
 
@@ -98,18 +100,27 @@ namespace txp {
  */
 #define BUILD_ATTR(CLASS) { \
     int l_RC = 0; \
-    oAttribute = new CLASS(pName, pData); \
+    oAttribute = NEW_ATTR(CLASS, pName, pData); \
     if (!l_RC) { \
         oAttribute->setAllocatedFlag(1); \
     } else { \
         if (oAttribute) { \
-            delete oAttribute; \
+            txp::Attribute::destroyAttr(oAttribute); \
             oAttribute = 0; \
         } \
     } \
     return l_RC; \
 }
 
+/**
+ * \brief Instantiates a derived attribute class object in pSlab, or in pooled
+ *        storage if pSlab is not given
+ *
+ * \param[in]   CLASS Class of object
+ */
+#define NEW_ATTR(CLASS, ...) \
+    (pSlab ? txp::Attribute::markSlabAllocated(new (*pSlab) CLASS(__VA_ARGS__)) : new CLASS(__VA_ARGS__))
+
 /**
  * \brief Copies data value from attribute
  *
@@ -195,6 +206,7 @@ public:
      * \param[out]      pLength Returned length consumed in the serialized buffer for this attribute.
      * \param[in]       pOption Deserialize option.
      * \param[inout]    pCRC Pointer to CRC value.  Null indicates no CRC to be calculated..  Null indicates no CRC to be calculated.
+     * \param[in]       pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return          int  0 -> success;  <0 -> failure
      * \par Error codes
      * -419 If deserialize option is DO_NOT_COPY_DATA or COPY_DATA_TO_HEAP, and attribute type is invalid.\n
@@ -204,7 +216,7 @@ public:
      * -423 Invalid deserialize option.\n
      * Any error return code from new().
      */
-    static int buildAttr(txp::HeapBuffer* pBuffer, const size_t pOffset, txp::Attribute* &oAttribute, size_t &pLength, const txp::DeserializeOption &pOption, unsigned long* pCRC);
+    static int buildAttr(txp::HeapBuffer* pBuffer, const size_t pOffset, txp::Attribute* &oAttribute, size_t &pLength, const txp::DeserializeOption &pOption, unsigned long* pCRC, txp::AttributeSlab* pSlab=0);
 
     // Pure virtual methods
 
@@ -212,9 +224,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    virtual int clone(Attribute* &pTargetAttr)=0;
+    virtual int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0)=0;
 
     /**
      * \brief Copy data value.
@@ -256,6 +269,37 @@ public:
      */
     virtual ~Attribute();
 
+    /**
+     * \brief Allocate/release storage for an attribute
+     *
+     * Attributes are carved from slabs and recycled through a free-list
+     * per size class instead of the heap.  Attributes built by a message for
+     * itself are carved from the AttributeSlab() of that message instead and
+     * go away with it, see destroyAttr().
+     */
+    static void* operator new(size_t pSize) { return txp::ObjectPool::allocate(pSize); };
+    static void operator delete(void* pAttribute, size_t pSize) { txp::ObjectPool::release(pAttribute, pSize); };
+    static void* operator new(size_t pSize, void* pPlace) { return pPlace; };
+    static void operator delete(void* pAttribute, void* pPlace) { return; };
+    static void* operator new(size_t pSize, txp::AttributeSlab& pSlab) { return pSlab.allocate(pSize); };
+    static void operator delete(void* pAttribute, txp::AttributeSlab& pSlab) { return; };
+
+    /**
+     * \brief Destroy an attribute
+     *
+     * \param[in]   pAttribute Attribute to destroy.
+     * \note Attributes carved from an AttributeSlab() are only destructed, their
+     *       storage is released with the slab.  Others are deleted.
+     */
+    static inline void destroyAttr(txp::Attribute* pAttribute) {
+        if (pAttribute->isSlabAllocated()) {
+            pAttribute->~Attribute();
+        } else {
+            delete pAttribute;
+        }
+        return;
+    };
+
     // Inlined non-static methods
 
     /**
@@ -286,6 +330,13 @@ public:
      */
     inline int isAllocated() { return attrFlag.allocated; };
 
+    /**
+     * \brief Is Storage for Attribute Carved from the AttributeSlab() of a Msg()
+     *
+     * \return      int  0 -> not carved from a slab;  1 -> carved from a slab
+     */
+    inline int isSlabAllocated() { return attrFlag.slabAllocated; };
+
     /**
      * \brief Is Storage Allocated for Data by Facility
      *
@@ -461,6 +512,17 @@ protected:
      */
     inline void setDataAllocatedFlag(const int pValue) { attrFlag.dataAllocated = pValue; return; };
 
+    /**
+     * \brief Mark an attribute as carved from the AttributeSlab() of a Msg().
+     *
+     * \param[in]   pAttribute Attribute just constructed in the slab.
+     * \return      CLASS* pAttribute
+     */
+    template<class CLASS> static inline CLASS* markSlabAllocated(CLASS* pAttribute) {
+        ((txp::Attribute*)pAttribute)->attrFlag.slabAllocated = 1;
+        return pAttribute;
+    };
+
     /**
      * \brief Initialization
      *
@@ -529,7 +591,10 @@ private:
         struct {
             uint8_t reserved_1:8;
 
-            uint8_t reserved_2:5;
+            uint8_t reserved_2:4;
+            uint8_t slabAllocated:1;        //! Attribute() is carved from the AttributeSlab()
+                                            //! of a Msg() object and therefore, only destructed
+                                            //! when the message is deleted.
             uint8_t addedToMsg:1;           //! Attribute() has been added to a Msg() object
                                             //! and therefore, cannot be added to another message.
                                             //! Such an attribute will be cloned first.
@@ -564,6 +629,7 @@ public:
      * \param[in]   pName Attribute name.
      * \param[in]   pData Attribute data.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -572,7 +638,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttr_char(const txp::AttributeName pName, const char& pData, Attr_char* &oAttribute);
+    static int buildAttr_char(const txp::AttributeName pName, const char& pData, Attr_char* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     // Inlined pure virtual methods
 
@@ -589,9 +655,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -715,6 +782,7 @@ public:
      * \param[in]   pName Attribute name.
      * \param[in]   pData Attribute data.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -723,7 +791,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttr_uint8(const txp::AttributeName pName, const uint8_t& pData, Attr_uint8* &oAttribute);
+    static int buildAttr_uint8(const txp::AttributeName pName, const uint8_t& pData, Attr_uint8* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     // Inlined pure virtual methods
 
@@ -740,9 +808,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -865,6 +934,7 @@ public:
      * \param[in]   pName Attribute name.
      * \param[in]   pData Attribute data.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -873,7 +943,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttr_uint16(const txp::AttributeName pName, const uint16_t& pData, Attr_uint16* &oAttribute);
+    static int buildAttr_uint16(const txp::AttributeName pName, const uint16_t& pData, Attr_uint16* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     // Inlined pure virtual methods
 
@@ -890,9 +960,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -1015,6 +1086,7 @@ public:
      * \param[in]   pName Attribute name.
      * \param[in]   pData Attribute data.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -1023,7 +1095,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttr_uint32(const txp::AttributeName pName, const uint32_t& pData, Attr_uint32* &oAttribute);
+    static int buildAttr_uint32(const txp::AttributeName pName, const uint32_t& pData, Attr_uint32* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     // Inlined pure virtual methods
 
@@ -1040,9 +1112,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -1165,6 +1238,7 @@ public:
      * \param[in]   pName Attribute name.
      * \param[in]   pData Attribute data.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -1173,7 +1247,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttr_uint64(const txp::AttributeName pName, const uint64_t& pData, Attr_uint64* &oAttribute);
+    static int buildAttr_uint64(const txp::AttributeName pName, const uint64_t& pData, Attr_uint64* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     // Inlined pure virtual methods
 
@@ -1190,9 +1264,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -1315,6 +1390,7 @@ public:
      * \param[in]   pName Attribute name.
      * \param[in]   pData Attribute data.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -1323,7 +1399,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttr_int8(const txp::AttributeName pName, const int8_t& pData, Attr_int8* &oAttribute);
+    static int buildAttr_int8(const txp::AttributeName pName, const int8_t& pData, Attr_int8* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     // Inlined pure virtual methods
 
@@ -1340,9 +1416,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -1465,6 +1542,7 @@ public:
      * \param[in]   pName Attribute name.
      * \param[in]   pData Attribute data.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -1473,7 +1551,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttr_int16(txp::AttributeName pName, const int16_t& pData, Attr_int16* &oAttribute);
+    static int buildAttr_int16(txp::AttributeName pName, const int16_t& pData, Attr_int16* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     // Inlined pure virtual methods
 
@@ -1490,9 +1568,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -1615,6 +1694,7 @@ public:
      * \param[in]   pName Attribute name.
      * \param[in]   pData Attribute data.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -1623,7 +1703,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttr_int32(const txp::AttributeName pName, const int32_t& pData, Attr_int32* &oAttribute);
+    static int buildAttr_int32(const txp::AttributeName pName, const int32_t& pData, Attr_int32* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     // Inlined pure virtual methods
 
@@ -1640,9 +1720,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -1765,6 +1846,7 @@ public:
      * \param[in]   pName Attribute name.
      * \param[in]   pData Attribute data.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -1773,7 +1855,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttr_int64(const txp::AttributeName pName, const int64_t& pData, Attr_int64* &oAttribute);
+    static int buildAttr_int64(const txp::AttributeName pName, const int64_t& pData, Attr_int64* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     // Inlined pure virtual methods
 
@@ -1790,9 +1872,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -1916,6 +1999,7 @@ public:
      * \param[in]   pData Attribute data.
      * \note The storage associated with pData should not be freed until the associated Msg() object is destroyed.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -1924,7 +2008,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttrPtr_char(const txp::AttributeName pName, const char* pData, AttrPtr_char* &oAttribute);
+    static int buildAttrPtr_char(const txp::AttributeName pName, const char* pData, AttrPtr_char* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Destructor
@@ -1946,9 +2030,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -2075,6 +2160,7 @@ public:
      * \param[in]   pData Attribute data.
      * \note The storage associated with pData should not be freed until the associated Msg() object is destroyed.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -2083,7 +2169,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttrPtr_uint8(const txp::AttributeName pName, const uint8_t* pData, AttrPtr_uint8* &oAttribute);
+    static int buildAttrPtr_uint8(const txp::AttributeName pName, const uint8_t* pData, AttrPtr_uint8* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Destructor
@@ -2105,9 +2191,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -2234,6 +2321,7 @@ public:
      * \param[in]   pData Attribute data.
      * \note The storage associated with pData should not be freed until the associated Msg() object is destroyed.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -2242,7 +2330,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttrPtr_uint16(const txp::AttributeName pName, const uint16_t* pData, AttrPtr_uint16* &oAttribute);
+    static int buildAttrPtr_uint16(const txp::AttributeName pName, const uint16_t* pData, AttrPtr_uint16* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Destructor
@@ -2264,9 +2352,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -2393,6 +2482,7 @@ public:
      * \param[in]   pData Attribute data.
      * \note The storage associated with pData should not be freed until the associated Msg() object is destroyed.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -2401,7 +2491,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttrPtr_uint32(const txp::AttributeName pName, const uint32_t* pData, AttrPtr_uint32* &oAttribute);
+    static int buildAttrPtr_uint32(const txp::AttributeName pName, const uint32_t* pData, AttrPtr_uint32* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Destructor
@@ -2423,9 +2513,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -2552,6 +2643,7 @@ public:
      * \param[in]   pData Attribute data.
      * \note The storage associated with pData should not be freed until the associated Msg() object is destroyed.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -2560,7 +2652,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttrPtr_uint64(const txp::AttributeName pName, const uint64_t* pData, AttrPtr_uint64* &oAttribute);
+    static int buildAttrPtr_uint64(const txp::AttributeName pName, const uint64_t* pData, AttrPtr_uint64* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Destructor
@@ -2582,9 +2674,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -2711,6 +2804,7 @@ public:
      * \param[in]   pData Attribute data.
      * \note The storage associated with pData should not be freed until the associated Msg() object is destroyed.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -2719,7 +2813,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttrPtr_int8(const txp::AttributeName pName, const int8_t* pData, AttrPtr_int8* &oAttribute);
+    static int buildAttrPtr_int8(const txp::AttributeName pName, const int8_t* pData, AttrPtr_int8* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Destructor
@@ -2741,9 +2835,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -2870,6 +2965,7 @@ public:
      * \param[in]   pData Attribute data.
      * \note The storage associated with pData should not be freed until the associated Msg() object is destroyed.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -2878,7 +2974,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttrPtr_int16(const txp::AttributeName pName, const int16_t* pData, AttrPtr_int16* &oAttribute);
+    static int buildAttrPtr_int16(const txp::AttributeName pName, const int16_t* pData, AttrPtr_int16* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Destructor
@@ -2900,9 +2996,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -3029,6 +3126,7 @@ public:
      * \param[in]   pData Attribute data.
      * \note The storage associated with pData should not be freed until the associated Msg() object is destroyed.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -3037,7 +3135,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttrPtr_int32(const txp::AttributeName pName, const int32_t* pData, AttrPtr_int32* &oAttribute);
+    static int buildAttrPtr_int32(const txp::AttributeName pName, const int32_t* pData, AttrPtr_int32* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Destructor
@@ -3059,9 +3157,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -3188,6 +3287,7 @@ public:
      * \param[in]   pData Attribute data.
      * \note The storage associated with pData should not be freed until the associated Msg() object is destroyed.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -3196,7 +3296,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-    static int buildAttrPtr_int64(const txp::AttributeName pName, const int64_t* pData, AttrPtr_int64* &oAttribute);
+    static int buildAttrPtr_int64(const txp::AttributeName pName, const int64_t* pData, AttrPtr_int64* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Destructor
@@ -3218,9 +3318,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -3349,6 +3450,7 @@ public:
      * \param[in]   pLength Length of data.
      * \param[out]  oAttribute Pointer to returned attribute.
      * \param[in]   pCopyDataOption  0 -> Do not copy data;  Otherwise, copy data and message facility owns data storage.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -3357,7 +3459,7 @@ public:
      *       added to a Msg() object, it is the invoker's responsibility to delete this
      *       attribute object.
      */
-	static int buildAttrPtr_char_array(const txp::AttributeName pName, const char* pData, const size_t pLength, txp::AttrPtr_char_array* &oAttribute, const txp::COPY_DATA_OPTION pCopyDataOption=DO_NOT_COPY);
+	static int buildAttrPtr_char_array(const txp::AttributeName pName, const char* pData, const size_t pLength, txp::AttrPtr_char_array* &oAttribute, const txp::COPY_DATA_OPTION pCopyDataOption=DO_NOT_COPY, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Destructor
@@ -3379,9 +3481,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -3520,6 +3623,7 @@ public:
      * \param[in]   pName Attribute name.
      * \param[in]   pData Attribute data.
      * \param[out]  oAttribute Pointer to returned attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      * \par Error codes
      * Any error return code from new().
@@ -3533,7 +3637,7 @@ public:
      *       char* within each CharArray_Element should not be freed until the associated Msg() object is
      *       destroyed.
      */
-	static int buildAttrPtr_array_of_char_arrays(const txp::AttributeName pName, const txp::CharArray* pData, txp::AttrPtr_array_of_char_arrays* &oAttribute);
+	static int buildAttrPtr_array_of_char_arrays(const txp::AttributeName pName, const txp::CharArray* pData, txp::AttrPtr_array_of_char_arrays* &oAttribute, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Destructor
@@ -3555,9 +3659,10 @@ public:
      * \brief Clone attribute.
      *
      * \param[out]  pTargetAttr Pointer to target attribute.
+     * \param[in]   pSlab Slab of the Msg() object to carve the attribute from.  Null for pooled storage.
      * \return      int  0 -> success;  <0 -> failure
      */
-    int clone(Attribute* &pTargetAttr);
+    int clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab=0);
 
     /**
      * \brief Copy data value.
@@ -0,0 +1,136 @@
+/*******************************************************************************
+ |    AttributeIndex.h
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+
+/*
+ * \file  AttributeIndex.h
+ * \brief Header file for the AttributeIndex() class.
+ *
+ * \ingroup transport
+ */
+
+#ifndef ATTRIBUTEINDEX_H_
+#define ATTRIBUTEINDEX_H_
+
+#include <stdexcept>
+#include <utility>
+
+#include "stdint.h"
+#include "stdlib.h"
+
+#include "Common.h"
+
+namespace txp {
+
+class Attribute;
+
+/**
+ * \class AttributeIndex
+ * Attributes of a Msg() object, kept in the order they were added and indexed by name.
+ *
+ * Storage for the first INLINE_CAPACITY attributes is part of the object itself.  Only
+ * messages with more attributes than that allocate storage from the heap.
+ *
+ * Lookup supports the subset of the std::map interface used on Msg::retrieveAttrs(),
+ * i.e., at(), find(), begin(), end() and size().  Iteration using begin()/end() is in
+ * attribute name order.  Iteration using orderBegin()/orderEnd() is in the order the
+ * attributes were added, which is the order they are serialized in.
+ */
+class AttributeIndex {
+public:
+    // Type defs
+    typedef std::pair<txp::AttributeName, txp::Attribute*> value_type;
+    typedef value_type* iterator;
+
+    // Constants
+    static const size_t INLINE_CAPACITY = 16;
+
+    /**
+     * \brief Default constructor
+     */
+    AttributeIndex();
+
+    /**
+     * \brief Destructor
+     *
+     * \note The attributes themselves are not deleted.
+     */
+    ~AttributeIndex();
+
+    // Inlined non-static methods
+
+    inline iterator begin() { return sorted; };
+    inline iterator end() { return sorted + count; };
+    inline size_t size() const { return count; };
+    inline bool empty() const { return (count == 0); };
+
+    inline txp::Attribute** orderBegin() { return ordered; };
+    inline txp::Attribute** orderEnd() { return ordered + count; };
+    inline txp::Attribute* const* orderBegin() const { return ordered; };
+    inline txp::Attribute* const* orderEnd() const { return ordered + count; };
+
+    // Non-static methods
+
+    /**
+     * \brief Retrieve attribute, std::map::at() style.
+     *
+     * \param[in]   pName       Attribute name
+     * \return      Attribute*& Reference to the attribute pointer
+     * \note Throws std::out_of_range if there is no attribute with that name.
+     */
+    txp::Attribute*& at(const txp::AttributeName pName);
+
+    /**
+     * \brief Find attribute.
+     *
+     * \param[in]   pName       Attribute name
+     * \return      iterator    Entry for the attribute, or end() if not found
+     */
+    iterator find(const txp::AttributeName pName);
+
+    /**
+     * \brief Insert attribute.
+     *
+     * \param[in]   pAttribute  Attribute to insert
+     * \return      int  0 -> success;  <0 -> failure
+     * \par Error codes
+     * -1 Attribute with that name already exists\n
+     * -2 Storage could not be obtained
+     */
+    int insert(txp::Attribute* pAttribute);
+
+    /**
+     * \brief Remove all attributes.
+     *
+     * \note The attributes themselves are not deleted.
+     */
+    inline void clear() { count = 0; };
+
+private:
+    AttributeIndex(const AttributeIndex &pIndex);
+    AttributeIndex& operator=(const AttributeIndex &pIndex);
+
+    int grow();
+
+    // Data members
+    value_type*             sorted;                     //! Entries sorted by attribute name
+    txp::Attribute**        ordered;                    //! Attributes in the order added
+    size_t                  count;                      //! Number of attributes
+    size_t                  capacity;                   //! Number of entries available in sorted and ordered
+    value_type              inlineSorted[INLINE_CAPACITY];
+    txp::Attribute*         inlineOrdered[INLINE_CAPACITY];
+};
+
+} // namespace
+
+#endif /* ATTRIBUTEINDEX_H_ */
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ |    AttributeSlab.h
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+
+/*
+ * \file  AttributeSlab.h
+ * \brief Header file for the AttributeSlab() class.
+ *
+ * \ingroup transport
+ */
+
+#ifndef ATTRIBUTESLAB_H_
+#define ATTRIBUTESLAB_H_
+
+#include "stdint.h"
+#include "stdlib.h"
+
+namespace txp {
+
+/**
+ * \class AttributeSlab
+ * Storage for the attributes a Msg() object builds for itself.
+ *
+ * Attributes are carved out of the slab one after the other and are never freed
+ * individually.  The message runs their destructors and all of the storage goes
+ * away with the slab.  The first INLINE_SIZE bytes are part of the object itself,
+ * so a message with a handful of attributes does not allocate any storage for them.
+ * Further storage is obtained in chunks of CHUNK_SIZE bytes from the ObjectPool().
+ */
+class AttributeSlab {
+public:
+    // Constants
+    static const size_t ALIGNMENT = 16;
+    static const size_t INLINE_SIZE = 512;
+    static const size_t CHUNK_SIZE = 1024;
+
+    /**
+     * \brief Default constructor
+     */
+    AttributeSlab();
+
+    /**
+     * \brief Destructor
+     *
+     * \note The attributes carved from the slab must have been destroyed.
+     */
+    ~AttributeSlab();
+
+    // Non-static methods
+
+    /**
+     * \brief Allocate storage for an attribute.
+     *
+     * \param[in]   pSize   Size of the attribute.
+     * \return      void*   Pointer to the storage.
+     * \note Throws std::bad_alloc if no storage can be obtained.
+     */
+    void* allocate(const size_t pSize);
+
+private:
+    struct Chunk {
+        Chunk*  next;
+        size_t  size;
+    };
+
+    AttributeSlab(const AttributeSlab &pSlab);
+    AttributeSlab& operator=(const AttributeSlab &pSlab);
+
+    // Data members
+    char*                   next;                       //! Next free byte in the current chunk
+    char*                   limit;                      //! End of the current chunk
+    Chunk*                  chunks;                     //! Chunks obtained beyond the inline storage
+    char                    inlineStorage[INLINE_SIZE] __attribute__((aligned(ALIGNMENT)));
+};
+
+} // namespace
+
+#endif /* ATTRIBUTESLAB_H_ */
@@ -34,6 +34,8 @@
 #include "Common.h"
 
 #include "Attribute.h"
+#include "AttributeIndex.h"
+#include "AttributeSlab.h"
 #include "HeapBuffer.h"
 #include "Log.h"
 #include "State.h"
@@ -70,6 +72,7 @@ extern inline int isMsgIdToLogAsInfo(txp::Id pId)
         case CORAL_SETVAR:
         case CORAL_SIGNAL:
         case CORAL_STAGEOUT_START:
+        case CORAL_INVALIDATE:
 
         case BB_ALL_FILE_TRANSFERS_COMPLETE:
         case BB_TRANSFER_COMPLETE_FOR_CONTRIBID:
@@ -109,7 +112,7 @@ public:
 
 	// Type defs
 	typedef std::pair<txp::AttributeType, Attribute> AttributePair;
-	typedef std::map<txp::AttributeName, txp::Attribute*> AttributeMap;
+	typedef txp::AttributeIndex AttributeMap;
 
 	// Constants
 	static const size_t DEFAULT_DATA_ALIGNMENT_VALUE = 0;
@@ -307,6 +310,19 @@ public:
      */
 	virtual ~Msg();
 
+    /**
+     * \brief Allocate/release storage for a message
+     *
+     * Message objects are recycled through a free-list of up to MAXIMUM_FREE_MSGS
+     * messages instead of the heap.  A recycled message brings the inline storage
+     * of its AttributeSlab() along, so building a message with a handful of
+     * attributes does not allocate any storage.
+     */
+    static void* operator new(size_t pSize);
+    static void operator delete(void* pMsg, size_t pSize);
+
+    static const size_t MAXIMUM_FREE_MSGS = 256;
+
     static txp::CRC DEFAULT_CALCULATE_CRC;
 
     static uint16_t AttrType_CharValue;
@@ -511,9 +527,9 @@ public:
     /**
      * \brief Get Attributes Pointer
      *
-     * \return  std::vector<Attribute*>*  Pointer to message attributes vector
+     * \return  AttributeIndex*  Pointer to message attributes
      */
-    inline std::vector<Attribute*>* getAttributesPtr() { return msgAttributes; };
+    inline AttributeIndex* getAttributesPtr() { return &msgAttributes; };
 
     /**
      * \brief Get Heap Buffer Pointer
@@ -634,7 +650,7 @@ public:
      *
      * \return  int32_t  Number of message attributes
      */
-	inline int32_t getNumberOfAttributes() { return (msgAttributes ? msgAttributes->size() : 0); };
+	inline int32_t getNumberOfAttributes() { return msgAttributes.size(); };
 
     /**
      * \brief Get previous message number
@@ -1086,7 +1102,7 @@ public:
      * \param[in]   pLog
      * \param[in]   pPrefix Text to identify this operation.  Default is no prefix data.
      */
-	void dump_msgAttributes(std::vector<Attribute*>* pMsgAttributes, Log& pLog, const char* pPrefix=0);
+	void dump_msgAttributes(AttributeIndex* pMsgAttributes, Log& pLog, const char* pPrefix=0);
 
     /**
      * \brief Frees a heap buffer.
@@ -1141,9 +1157,9 @@ public:
     /**
      * \brief Retrieve attributes.
      *
-     * \return      std::map<txp::AttributeName, txp::Attribute*>* Pointer to the attribute map
+     * \return      AttributeMap* Pointer to the attributes, indexed by name
      */
-	std::map<txp::AttributeName, txp::Attribute*>* retrieveAttrs();
+	AttributeMap* retrieveAttrs();
 
     /**
      * \brief Sent
@@ -1291,8 +1307,8 @@ private:
 	Version 				msgVersion;                 //! Messate version
 	HeapBuffer*             msgHeapBuffer;              //! Pointer to heap buffer
     struct iovec*           msg_IO_Vector;              //! Pointer to I/O vector
-	AttributeMap*           msgAttrMap;                 //! Pointer to the message attribute map
-	std::vector<Attribute*>*	msgAttributes;          //! Pointer to the message attribute vector
+	AttributeIndex          msgAttributes;              //! Message attributes, in the order added and indexed by name
+	AttributeSlab           msgAttributeSlab;           //! Storage for the attributes built by the message itself
 };
 
 } // namespace
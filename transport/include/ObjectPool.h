@@ -0,0 +1,72 @@
+/*******************************************************************************
+ |    ObjectPool.h
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+
+/*
+ * \file  ObjectPool.h
+ * \brief Header file for the ObjectPool() class.
+ *
+ * \ingroup transport
+ */
+
+#ifndef OBJECTPOOL_H_
+#define OBJECTPOOL_H_
+
+#include "stdint.h"
+#include "stdlib.h"
+
+namespace txp {
+
+/**
+ * \class ObjectPool
+ * Free-list storage for Attribute() objects and AttributeSlab() chunks.
+ *
+ * Objects are carved out of slabs and grouped in size classes.  Freed objects
+ * go to a per-thread free-list and are handed out again for the next object of
+ * the same size class, so the steady state of building, sending and deleting
+ * messages no longer goes to the heap.  Per-thread free-lists that grow too long
+ * are spilled to a shared depot.  Slabs are never returned to the heap.
+ */
+class ObjectPool {
+public:
+    // Constants
+    static const size_t SIZE_CLASS_GRANULE = 16;
+    static const size_t MAXIMUM_POOLED_SIZE = 1024;
+    static const size_t NUMBER_OF_SIZE_CLASSES = MAXIMUM_POOLED_SIZE / SIZE_CLASS_GRANULE;
+    static const size_t OBJECTS_PER_SLAB = 64;
+    static const size_t MAXIMUM_PER_THREAD = 4 * OBJECTS_PER_SLAB;
+
+    // Static methods
+
+    /**
+     * \brief Allocate storage for an object.
+     *
+     * \param[in]   pSize   Size of the object.
+     * \return      void*   Pointer to the storage.
+     * \note Objects larger than MAXIMUM_POOLED_SIZE are allocated from the heap.
+     *       Throws std::bad_alloc if no storage can be obtained.
+     */
+    static void* allocate(const size_t pSize);
+
+    /**
+     * \brief Release storage for an object.
+     *
+     * \param[in]   pObject Pointer to the storage returned by allocate().
+     * \param[in]   pSize   Size of the object as passed to allocate().
+     */
+    static void release(void* pObject, const size_t pSize);
+};
+
+} // namespace
+
+#endif /* OBJECTPOOL_H_ */
@@ -0,0 +1,5233 @@
+(dp0
+S'FUSE_KERNEL_MINOR_VERSION'
+p1
+I38
+sS'NAMES_TO_ADD'
+p2
+(dp3
+(I4
+S'synccount'
+p4
+tp5
+I222
+s(I2
+S'asyncRequestFileSeqNbr'
+p6
+tp7
+I235
+s(I3
+S'synctime'
+p8
+tp9
+I223
+s(I1
+S'timeBaseScale'
+p10
+tp11
+I224
+ssS'IDS_NOT_VALID'
+p12
+(dp13
+I0
+S'ID_INVALID'
+p14
+ssS'FUSE_KERNEL_VERSION'
+p15
+I7
+sS'CORAL_IDS'
+p16
+(dp17
+I256
+S'BB_ALL_FILE_TRANSFERS_COMPLETE'
+p18
+sI257
+S'BB_CANCELTRANSFER'
+p19
+sI258
+S'BB_CHMOD'
+p20
+sI259
+S'BB_CHOWN'
+p21
+sI4
+S'CORAL_GETVAR'
+p22
+sI261
+S'BB_CREATELOGICALVOLUME'
+p23
+sI262
+S'BB_GETDEVICEUSAGE'
+p24
+sI263
+S'BB_GETUSAGE'
+p25
+sI8
+S'CORAL_NO_OP'
+p26
+sI9
+S'CORAL_READY'
+p27
+sI10
+S'CORAL_SETVAR'
+p28
+sI267
+S'BB_GETTRANSFERINFO'
+p29
+sI12
+S'CORAL_STAGEOUT_START'
+p30
+sI269
+S'BB_GETTRANSFERLIST'
+p31
+sI270
+S'BB_REMOVEDIR'
+p32
+sI271
+S'BB_REMOVELOGICALVOLUME'
+p33
+sI272
+S'BB_RESIZEMOUNTPOINT'
+p34
+sI273
+S'BB_REMOVEJOBINFO'
+p35
+sI274
+S'BB_SETTHROTTLERATE'
+p36
+sI3
+S'CORAL_ERROR'
+p37
+sI276
+S'BB_STARTTRANSFER'
+p38
+sI277
+S'BB_TRANSFER_COMPLETE_FOR_CONTRIBID'
+p39
+sI278
+S'BB_TRANSFER_COMPLETE_FOR_FILE'
+p40
+sI279
+S'BB_TRANSFER_COMPLETE_FOR_HANDLE'
+p41
+sI280
+S'BB_TRANSFER_PROGRESS'
+p42
+sI260
+S'BB_CREATEDIR'
+p43
+sI282
+S'BB_GETSERVER'
+p44
+sI283
+S'BB_SWITCHTRANSFER'
+p45
+sI284
+S'BB_RESTART_TRANSFERS'
+p46
+sI285
+S'BB_RETRIEVE_TRANSFERS'
+p47
+sI286
+S'BB_STOP_TRANSFERS'
+p48
+sI287
+S'BB_RESUME'
+p49
+sI288
+S'BB_SUSPEND'
+p50
+sI289
+S'BB_OPENSERVER'
+p51
+sI290
+S'BB_CLOSESERVER'
+p52
+sI291
+S'BB_GETSERVERBYNAME'
+p53
+sI1
+S'CORAL_AUTHENTICATE'
+p54
+sI293
+S'BB_SETSERVERCFGVALUE'
+p55
+sI294
+S'BB_GETSERVERCFGVALUE'
+p56
+sI295
+S'BB_GETFILEINFO'
+p57
+sI296
+S'BB_ASYNC_REQUEST'
+p58
+sI7
+S'CORAL_HELLO_MONITOR'
+p59
+sI264
+S'BB_GETLVKEY'
+p60
+sI265
+S'BB_GETTHROTTLERATE'
+p61
+sI6
+S'CORAL_HELLO'
+p62
+sI266
+S'BB_GETTRANSFERHANDLE'
+p63
+sI5
+S'CORAL_GOODBYE'
+p64
+sI11
+S'CORAL_SIGNAL'
+p65
+sI268
+S'BB_GETTRANSFERKEYS'
+p66
+sI292
+S'BB_GETTRANSFERCOUNT'
+p67
+sI275
+S'BB_SETUSAGELIMIT'
+p68
+sI281
+S'BB_SETSERVER'
+p69
+ssS'NAMES'
+p70
+(dp71
+S'max_background'
+p72
+c__builtin__
+set
+p73
+((lp74
+S'uint16_t'
+p75
+atp76
+Rp77
+sS'extents'
+p78
+g73
+((lp79
+tp80
+Rp81
+sS'clearMetaData'
+p82
+g73
+((lp83
+tp84
+Rp85
+sS'bsize'
+p86
+g73
+((lp87
+S'uint32_t'
+p88
+atp89
+Rp90
+sS'media_errors'
+p91
+g73
+((lp92
+tp93
+Rp94
+sS'configPath'
+p95
+g73
+((lp96
+S'char'
+p97
+atp98
+Rp99
+sS'data_read'
+p100
+g73
+((lp101
+tp102
+Rp103
+sS'numhandles'
+p104
+g73
+((lp105
+tp106
+Rp107
+sS'fh_out'
+p108
+g73
+((lp109
+S'uint64_t'
+p110
+atp111
+Rp112
+sS'writetime'
+p113
+g73
+((lp114
+tp115
+Rp116
+sS'fsync_flags'
+p117
+g73
+((lp118
+S'uint32_t'
+p119
+atp120
+Rp121
+sS'time_gran'
+p122
+g73
+((lp123
+S'uint32_t'
+p124
+atp125
+Rp126
+sS'transferhandle'
+p127
+g73
+((lp128
+tp129
+Rp130
+sS'localstatus'
+p131
+g73
+((lp132
+tp133
+Rp134
+sS'mntptuid'
+p135
+g73
+((lp136
+tp137
+Rp138
+sS'lkey'
+p139
+g73
+((lp140
+S'uint32_t'
+p141
+atp142
+Rp143
+sS'max_pages'
+p144
+g73
+((lp145
+S'uint16_t'
+p146
+atp147
+Rp148
+sS'unique'
+p149
+g73
+((lp150
+S'uint64_t'
+p151
+atp152
+Rp153
+sS'uuid'
+p154
+g73
+((lp155
+tp156
+Rp157
+sS'flags2'
+p158
+g73
+((lp159
+S'uint32_t'
+p160
+atp161
+Rp162
+sS'totalTransferKeyLength'
+p163
+g73
+((lp164
+tp165
+Rp166
+sS'umask'
+p167
+g73
+((lp168
+S'uint32_t'
+p169
+atp170
+Rp171
+sS'notify_unique'
+p172
+g73
+((lp173
+S'uint64_t'
+p174
+atp175
+Rp176
+sS'transferdefs'
+p177
+g73
+((lp178
+tp179
+Rp180
+sS'attr_valid'
+p181
+g73
+((lp182
+S'uint64_t'
+p183
+atp184
+Rp185
+sS'dummy3'
+p186
+g73
+((lp187
+S'uint64_t'
+p188
+atp189
+Rp190
+sS'oldname'
+p191
+g73
+((lp192
+S'char'
+p193
+atp194
+Rp195
+sS'transferHandle'
+p196
+g73
+((lp197
+tp198
+Rp199
+sS'markfailed'
+p200
+g73
+((lp201
+tp202
+Rp203
+sS'workitemspertransfertimeinterval'
+p204
+g73
+((lp205
+tp206
+Rp207
+sS'newmode'
+p208
+g73
+((lp209
+tp210
+Rp211
+sS'handle'
+p212
+g73
+((lp213
+S'uint64_t'
+p214
+atp215
+Rp216
+sS'numcontrib'
+p217
+g73
+((lp218
+tp219
+Rp220
+sS'argsOut'
+p221
+g73
+((lp222
+S'char'
+p223
+atp224
+Rp225
+sS'totalTransferSize'
+p226
+g73
+((lp227
+tp228
+Rp229
+sS'lk_flags'
+p230
+g73
+((lp231
+S'uint32_t'
+p232
+atp233
+Rp234
+sS'num_read_commands'
+p235
+g73
+((lp236
+tp237
+Rp238
+sS'out_size'
+p239
+g73
+((lp240
+S'uint32_t'
+p241
+atp242
+Rp243
+sS'unsafe_shutdowns'
+p244
+g73
+((lp245
+tp246
+Rp247
+sS'power_on_hours'
+p248
+g73
+((lp249
+tp250
+Rp251
+sS'congestion_threshold'
+p252
+g73
+((lp253
+S'uint16_t'
+p254
+atp255
+Rp256
+sS'chunkSize'
+p257
+g73
+((lp258
+S'uint64_t'
+p259
+atp260
+Rp261
+sS'nodeid_out'
+p262
+g73
+((lp263
+S'uint64_t'
+p264
+atp265
+Rp266
+sS'foffset'
+p267
+g73
+((lp268
+S'uint64_t'
+p269
+atp270
+Rp271
+sS'maxlba'
+p272
+g73
+((lp273
+tp274
+Rp275
+sS'knownSerials'
+p276
+g73
+((lp277
+tp278
+Rp279
+sS'ctime'
+p280
+g73
+((lp281
+S'uint64_t'
+p282
+atp283
+Rp284
+sS'dev_minor'
+p285
+g73
+((lp286
+S'uint32_t'
+p287
+atp288
+Rp289
+sS'cmd'
+p290
+g73
+((lp291
+S'uint32_t'
+p292
+atp293
+Rp294
+sS'userid'
+p295
+g73
+((lp296
+tp297
+Rp298
+sS'groupid'
+p299
+g73
+((lp300
+tp301
+Rp302
+sS'unused[7'
+p303
+g73
+((lp304
+S'uint32_t'
+p305
+atp306
+Rp307
+sS'mode'
+p308
+g73
+((lp309
+S'uint32_t'
+p310
+atp311
+Rp312
+sS'unlinkedInode'
+p313
+g73
+((lp314
+S'__u64'
+p315
+atp316
+Rp317
+sS'signal'
+p318
+g73
+((lp319
+S'int'
+p320
+atp321
+Rp322
+sS'burstBytesRead'
+p323
+g73
+((lp324
+tp325
+Rp326
+sS'localBytesWritten'
+p327
+g73
+((lp328
+tp329
+Rp330
+sS'generation'
+p331
+g73
+((lp332
+S'uint64_t'
+p333
+atp334
+Rp335
+sS'spare[6'
+p336
+g73
+((lp337
+S'uint32_t'
+p338
+atp339
+Rp340
+sS'read_flags'
+p341
+g73
+((lp342
+S'uint32_t'
+p343
+atp344
+Rp345
+sS'spare[1'
+p346
+g73
+((lp347
+S'uint32_t'
+p348
+atp349
+Rp350
+sS'owner'
+p351
+g73
+((lp352
+S'uint64_t'
+p353
+atp354
+Rp355
+sS'atimensec'
+p356
+g73
+((lp357
+S'uint32_t'
+p358
+atp359
+Rp360
+sS'nackSerials'
+p361
+g73
+((lp362
+tp363
+Rp364
+sS'result'
+p365
+g73
+((lp366
+S'int32_t'
+p367
+atp368
+Rp369
+sS'statfsRC'
+p370
+g73
+((lp371
+S'int'
+p372
+atp373
+Rp374
+sS'arg'
+p375
+g73
+((lp376
+S'uint64_t'
+p377
+atp378
+Rp379
+sS'dummy2'
+p380
+g73
+((lp381
+S'uint32_t'
+p382
+atp383
+Rp384
+sS'mountpoint'
+p385
+g73
+((lp386
+tp387
+Rp388
+sS'resultCode'
+p389
+g73
+((lp390
+tp391
+Rp392
+sS'dummy1'
+p393
+g73
+((lp394
+S'uint64_t'
+p395
+atp396
+Rp397
+sS'dummy4'
+p398
+g73
+((lp399
+S'uint64_t'
+p400
+atp401
+Rp402
+sS'entry_valid_nsec'
+p403
+g73
+((lp404
+S'uint32_t'
+p405
+atp406
+Rp407
+sS'mountsize'
+p408
+g73
+((lp409
+tp410
+Rp411
+sS'numBytesAvailable'
+p412
+g73
+((lp413
+tp414
+Rp415
+sS'totalProcessingTime'
+p416
+g73
+((lp417
+tp418
+Rp419
+sS'totalBytesWritten'
+p420
+g73
+((lp421
+tp422
+Rp423
+sS'serializeversion'
+p424
+g73
+((lp425
+tp426
+Rp427
+sS'unlinkatname'
+p428
+g73
+((lp429
+S'char'
+p430
+atp431
+Rp432
+sS'buffer'
+p433
+g73
+((lp434
+tp435
+Rp436
+sS'version'
+p437
+g73
+((lp438
+tp439
+Rp440
+sS'attributeData'
+p441
+g73
+((lp442
+S'char'
+p443
+atp444
+Rp445
+sS'dev_major'
+p446
+g73
+((lp447
+S'uint32_t'
+p448
+atp449
+Rp450
+sS'max_write'
+p451
+g73
+((lp452
+S'uint32_t'
+p453
+atp454
+Rp455
+sS'in_iovs'
+p456
+g73
+((lp457
+S'uint32_t'
+p458
+atp459
+Rp460
+sS'num_write_commands'
+p461
+g73
+((lp462
+tp463
+Rp464
+sS'out_iovs'
+p465
+g73
+((lp466
+S'uint32_t'
+p467
+atp468
+Rp469
+sS'nlookup'
+p470
+g73
+((lp471
+S'uint64_t'
+p472
+atp473
+Rp474
+sS'parent'
+p475
+g73
+((lp476
+S'uint64_t'
+p477
+atp478
+Rp479
+sS'openOutFlags'
+p480
+g73
+((lp481
+S'uint32_t'
+p482
+atp483
+Rp484
+sS'len'
+p485
+g73
+((lp486
+S'uint64_t'
+p487
+aS'uint32_t'
+p488
+aS'int64_t'
+p489
+atp490
+Rp491
+sS'nodeid'
+p492
+g73
+((lp493
+S'uint64_t'
+p494
+atp495
+Rp496
+sS'sourceindex'
+p497
+g73
+((lp498
+tp499
+Rp500
+sS'base'
+p501
+g73
+((lp502
+S'uint64_t'
+p503
+atp504
+Rp505
+sS'value64'
+p506
+g73
+((lp507
+tp508
+Rp509
+sS'blksize'
+p510
+g73
+((lp511
+S'uint32_t'
+p512
+atp513
+Rp514
+sS'statinfo'
+p515
+g73
+((lp516
+tp517
+Rp518
+sS'bfree'
+p519
+g73
+((lp520
+S'uint64_t'
+p521
+atp522
+Rp523
+sS'crc32'
+p524
+g73
+((lp525
+S'uint32_t'
+p526
+atp527
+Rp528
+sS'fuse_version_minor'
+p529
+g73
+((lp530
+S'int'
+p531
+atp532
+Rp533
+sS'version_minor'
+p534
+g73
+((lp535
+S'int'
+p536
+atp537
+Rp538
+sS'fh_in'
+p539
+g73
+((lp540
+S'uint64_t'
+p541
+atp542
+Rp543
+sS'newgroup'
+p544
+g73
+((lp545
+tp546
+Rp547
+sS'sizetransferred'
+p548
+g73
+((lp549
+tp550
+Rp551
+sS'checksum'
+p552
+g73
+((lp553
+tp554
+Rp555
+sS'secondsCleanup'
+p556
+g73
+((lp557
+S'int'
+p558
+atp559
+Rp560
+sS'off_in'
+p561
+g73
+((lp562
+S'uint64_t'
+p563
+atp564
+Rp565
+sS'whoami'
+p566
+g73
+((lp567
+tp568
+Rp569
+sS'length'
+p570
+g73
+((lp571
+S'uint64_t'
+p572
+atp573
+Rp574
+sS'opcode'
+p575
+g73
+((lp576
+S'uint32_t'
+p577
+atp578
+Rp579
+sS'moffset'
+p580
+g73
+((lp581
+S'uint64_t'
+p582
+atp583
+Rp584
+sS'write_flags'
+p585
+g73
+((lp586
+S'uint32_t'
+p587
+atp588
+Rp589
+sS'buffersize'
+p590
+g73
+((lp591
+tp592
+Rp593
+sS'block'
+p594
+g73
+((lp595
+S'uint64_t'
+p596
+atp597
+Rp598
+sS'attr_valid_nsec'
+p599
+g73
+((lp600
+S'uint32_t'
+p601
+atp602
+Rp603
+sS'size'
+p604
+g73
+((lp605
+S'uint64_t'
+p606
+aS'uint32_t'
+p607
+atp608
+Rp609
+sS'major'
+p610
+g73
+((lp611
+S'uint32_t'
+p612
+atp613
+Rp614
+sS'returncode'
+p615
+g73
+((lp616
+tp617
+Rp618
+sS'offset2newname'
+p619
+g73
+((lp620
+S'__u64'
+p621
+atp622
+Rp623
+sS'offset'
+p624
+g73
+((lp625
+S'uint64_t'
+p626
+atp627
+Rp628
+sS'localReadCount'
+p629
+g73
+((lp630
+tp631
+Rp632
+sS'numTransferDefs'
+p633
+g73
+((lp634
+tp635
+Rp636
+sS'lock_owner'
+p637
+g73
+((lp638
+S'uint64_t'
+p639
+atp640
+Rp641
+sS'connectionKey'
+p642
+g73
+((lp643
+tp644
+Rp645
+sS'fh'
+p646
+g73
+((lp647
+S'uint64_t'
+p648
+atp649
+Rp650
+sS'signalSent'
+p651
+g73
+((lp652
+S'int'
+p653
+atp654
+Rp655
+sS'notify'
+p656
+g73
+((lp657
+S'fuse_out_notify'
+p658
+atp659
+Rp660
+sS'total_extlen'
+p661
+g73
+((lp662
+S'uint16_t'
+p663
+atp664
+Rp665
+sS'getattr_out'
+p666
+g73
+((lp667
+S'attr_out'
+p668
+atp669
+Rp670
+sS'contrib'
+p671
+g73
+((lp672
+tp673
+Rp674
+sS'newpathname'
+p675
+g73
+((lp676
+tp677
+Rp678
+sS'next'
+p679
+g73
+((lp680
+S'memItem*'
+p681
+atp682
+Rp683
+sS'readtime'
+p684
+g73
+((lp685
+tp686
+Rp687
+sS'ctimensec'
+p688
+g73
+((lp689
+S'uint32_t'
+p690
+atp691
+Rp692
+sS'epochtimeinseconds'
+p693
+g73
+((lp694
+tp695
+Rp696
+sS'temperature'
+p697
+g73
+((lp698
+tp699
+Rp700
+sS'outHelloVersion'
+p701
+g73
+((lp702
+S'int'
+p703
+atp704
+Rp705
+sS'data'
+p706
+g73
+((lp707
+S'char'
+p708
+atp709
+Rp710
+sS'performoperation'
+p711
+g73
+((lp712
+tp713
+Rp714
+sS'localBytesRead'
+p715
+g73
+((lp716
+tp717
+Rp718
+sS'name'
+p719
+g73
+((lp720
+S'char'
+p721
+atp722
+Rp723
+sS'unused5'
+p724
+g73
+((lp725
+S'uint32_t'
+p726
+atp727
+Rp728
+sS'contribid'
+p729
+g73
+((lp730
+tp731
+Rp732
+sS'handles'
+p733
+g73
+((lp734
+tp735
+Rp736
+sS'gid'
+p737
+g73
+((lp738
+S'uint32_t'
+p739
+atp740
+Rp741
+sS'tag'
+p742
+g73
+((lp743
+tp744
+Rp745
+sS'in_size'
+p746
+g73
+((lp747
+S'uint32_t'
+p748
+atp749
+Rp750
+sS'start'
+p751
+g73
+((lp752
+S'uint64_t'
+p753
+atp754
+Rp755
+sS'minor'
+p756
+g73
+((lp757
+S'uint32_t'
+p758
+atp759
+Rp760
+sS'files'
+p761
+g73
+((lp762
+S'uint64_t'
+p763
+atp764
+Rp765
+sS'version_major'
+p766
+g73
+((lp767
+S'int'
+p768
+atp769
+Rp770
+sS'jobstepid'
+p771
+g73
+((lp772
+tp773
+Rp774
+sS'max_readahead'
+p775
+g73
+((lp776
+S'uint32_t'
+p777
+atp778
+Rp779
+sS'localTransferSize'
+p780
+g73
+((lp781
+tp782
+Rp783
+sS'newdirInode'
+p784
+g73
+((lp785
+S'__u64'
+p786
+atp787
+Rp788
+sS'ffree'
+p789
+g73
+((lp790
+S'uint64_t'
+p791
+atp792
+Rp793
+sS'padding'
+p794
+g73
+((lp795
+S'uint64_t'
+p796
+aS'uint16_t'
+p797
+aS'uint32_t'
+p798
+atp799
+Rp800
+sS'newowner'
+p801
+g73
+((lp802
+tp803
+Rp804
+sS'link'
+p805
+g73
+((lp806
+S'char'
+p807
+atp808
+Rp809
+sS'revents'
+p810
+g73
+((lp811
+S'uint32_t'
+p812
+atp813
+Rp814
+sS'child'
+p815
+g73
+((lp816
+S'uint64_t'
+p817
+atp818
+Rp819
+sS'burstBytesWritten'
+p820
+g73
+((lp821
+tp822
+Rp823
+sS'atime'
+p824
+g73
+((lp825
+S'uint64_t'
+p826
+atp827
+Rp828
+sS'frsize'
+p829
+g73
+((lp830
+S'uint32_t'
+p831
+atp832
+Rp833
+sS'mntptgid'
+p834
+g73
+((lp835
+tp836
+Rp837
+sS'count'
+p838
+g73
+((lp839
+S'uint32_t'
+p840
+atp841
+Rp842
+sS'off_out'
+p843
+g73
+((lp844
+S'uint64_t'
+p845
+atp846
+Rp847
+sS'numreportingcontribs'
+p848
+g73
+((lp849
+tp850
+Rp851
+sS'hdr'
+p852
+g73
+((lp853
+S'fuse_out_header'
+p854
+aS'fuse_in_header'
+p855
+atp856
+Rp857
+sS'num_err_log_entries'
+p858
+g73
+((lp859
+tp860
+Rp861
+sS'type'
+p862
+g73
+((lp863
+S'uint32_t'
+p864
+atp865
+Rp866
+sS'offset2oldname'
+p867
+g73
+((lp868
+S'__u64'
+p869
+atp870
+Rp871
+sS'rate'
+p872
+g73
+((lp873
+tp874
+Rp875
+sS'value'
+p876
+g73
+((lp877
+tp878
+Rp879
+sS'jobid'
+p880
+g73
+((lp881
+tp882
+Rp883
+sS'localWriteCount'
+p884
+g73
+((lp885
+tp886
+Rp887
+sS'power_cycles'
+p888
+g73
+((lp889
+tp890
+Rp891
+sS'values'
+p892
+g73
+((lp893
+tp894
+Rp895
+sS'pathname'
+p896
+g73
+((lp897
+tp898
+Rp899
+sS'error'
+p900
+g73
+((lp901
+S'int32_t'
+p902
+atp903
+Rp904
+sS'bavail'
+p905
+g73
+((lp906
+S'uint64_t'
+p907
+atp908
+Rp909
+sS'open_flags'
+p910
+g73
+((lp911
+S'uint32_t'
+p912
+atp913
+Rp914
+sS'readcount'
+p915
+g73
+((lp916
+tp917
+Rp918
+sS'responseHandle'
+p919
+g73
+((lp920
+tp921
+Rp922
+sS'rdev'
+p923
+g73
+((lp924
+S'uint32_t'
+p925
+atp926
+Rp927
+sS'uid'
+p928
+g73
+((lp929
+S'uint32_t'
+p930
+atp931
+Rp932
+sS'transfertimeinterval'
+p933
+g73
+((lp934
+tp935
+Rp936
+sS'newname'
+p937
+g73
+((lp938
+S'char'
+p939
+atp940
+Rp941
+sS'blocksize'
+p942
+g73
+((lp943
+S'uint32_t'
+p944
+atp945
+Rp946
+sS'percentage_used'
+p947
+g73
+((lp948
+tp949
+Rp950
+sS'pid'
+p951
+g73
+((lp952
+S'uint32_t'
+p953
+atp954
+Rp955
+sS'sourcefile'
+p956
+g73
+((lp957
+tp958
+Rp959
+sS'dataObtainedLocally'
+p960
+g73
+((lp961
+tp962
+Rp963
+sS'newdir'
+p964
+g73
+((lp965
+S'uint64_t'
+p966
+atp967
+Rp968
+sS'ino'
+p969
+g73
+((lp970
+S'uint64_t'
+p971
+atp972
+Rp973
+sS'variable'
+p974
+g73
+((lp975
+tp976
+Rp977
+sS'mtimensec'
+p978
+g73
+((lp979
+S'uint32_t'
+p980
+atp981
+Rp982
+sS'mtime'
+p983
+g73
+((lp984
+S'uint64_t'
+p985
+atp986
+Rp987
+sS'argsIn'
+p988
+g73
+((lp989
+S'char'
+p990
+atp991
+Rp992
+sS'id'
+p993
+g73
+((lp994
+S'int'
+p995
+atp996
+Rp997
+sS'option'
+p998
+g73
+((lp999
+tp1000
+Rp1001
+sS'map_alignment'
+p1002
+g73
+((lp1003
+S'uint16_t'
+p1004
+atp1005
+Rp1006
+sS'end'
+p1007
+g73
+((lp1008
+S'uint64_t'
+p1009
+atp1010
+Rp1011
+sS'oldnodeid'
+p1012
+g73
+((lp1013
+S'uint64_t'
+p1014
+atp1015
+Rp1016
+sS'hostname'
+p1017
+g73
+((lp1018
+tp1019
+Rp1020
+sS'whence'
+p1021
+g73
+((lp1022
+S'uint32_t'
+p1023
+atp1024
+Rp1025
+sS'objectversion'
+p1026
+g73
+((lp1027
+tp1028
+Rp1029
+sS'totalBytesRead'
+p1030
+g73
+((lp1031
+tp1032
+Rp1033
+sS'instance'
+p1034
+g73
+((lp1035
+tp1036
+Rp1037
+sS'critical_warning'
+p1038
+g73
+((lp1039
+tp1040
+Rp1041
+sS'valid'
+p1042
+g73
+((lp1043
+S'uint32_t'
+p1044
+atp1045
+Rp1046
+sS'nr_secctx'
+p1047
+g73
+((lp1048
+S'uint32_t'
+p1049
+atp1050
+Rp1051
+sS'nameOfAttribute'
+p1052
+g73
+((lp1053
+S'char'
+p1054
+atp1055
+Rp1056
+sS'entry_valid'
+p1057
+g73
+((lp1058
+S'uint64_t'
+p1059
+atp1060
+Rp1061
+sS'events'
+p1062
+g73
+((lp1063
+S'uint32_t'
+p1064
+atp1065
+Rp1066
+sS'status'
+p1067
+g73
+((lp1068
+tp1069
+Rp1070
+sS'blocks'
+p1071
+g73
+((lp1072
+S'uint64_t'
+p1073
+atp1074
+Rp1075
+sS'keys'
+p1076
+g73
+((lp1077
+tp1078
+Rp1079
+sS'available_spare'
+p1080
+g73
+((lp1081
+tp1082
+Rp1083
+sS'rkey'
+p1084
+g73
+((lp1085
+S'uint32_t'
+p1086
+atp1087
+Rp1088
+sS'lookupname'
+p1089
+g73
+((lp1090
+S'char'
+p1091
+atp1092
+Rp1093
+sS'setxattr_flags'
+p1094
+g73
+((lp1095
+S'uint32_t'
+p1096
+atp1097
+Rp1098
+sS'unused'
+p1099
+g73
+((lp1100
+S'uint32_t'
+p1101
+atp1102
+Rp1103
+sS'unused4'
+p1104
+g73
+((lp1105
+S'uint32_t'
+p1106
+atp1107
+Rp1108
+sS'unused[11'
+p1109
+g73
+((lp1110
+S'uint32_t'
+p1111
+atp1112
+Rp1113
+sS'daemon_pid'
+p1114
+g73
+((lp1115
+S'pid_t'
+p1116
+atp1117
+Rp1118
+sS'data_written'
+p1119
+g73
+((lp1120
+tp1121
+Rp1122
+sS'transfercontribid'
+p1123
+g73
+((lp1124
+tp1125
+Rp1126
+sS'devicenum'
+p1127
+g73
+((lp1128
+tp1129
+Rp1130
+sS'dummy'
+p1131
+g73
+((lp1132
+S'uint32_t'
+p1133
+atp1134
+Rp1135
+sS'off'
+p1136
+g73
+((lp1137
+S'uint64_t'
+p1138
+aS'int64_t'
+p1139
+atp1140
+Rp1141
+sS'max_read'
+p1142
+g73
+((lp1143
+S'int'
+p1144
+aS'uint32_t'
+p1145
+atp1146
+Rp1147
+sS'release_flags'
+p1148
+g73
+((lp1149
+S'uint32_t'
+p1150
+atp1151
+Rp1152
+sS'bbjob_serializeversion'
+p1153
+g73
+((lp1154
+tp1155
+Rp1156
+sS'matchstatus'
+p1157
+g73
+((lp1158
+tp1159
+Rp1160
+sS'kh'
+p1161
+g73
+((lp1162
+S'uint64_t'
+p1163
+atp1164
+Rp1165
+sS'mask'
+p1166
+g73
+((lp1167
+S'uint32_t'
+p1168
+atp1169
+Rp1170
+sS'fuse_version_major'
+p1171
+g73
+((lp1172
+S'int'
+p1173
+atp1174
+Rp1175
+sS'numavailhandles'
+p1176
+g73
+((lp1177
+tp1178
+Rp1179
+sS'bbjob_objectversion'
+p1180
+g73
+((lp1181
+tp1182
+Rp1183
+sS'namelen'
+p1184
+g73
+((lp1185
+S'uint32_t'
+p1186
+atp1187
+Rp1188
+sS'nlink'
+p1189
+g73
+((lp1190
+S'uint32_t'
+p1191
+atp1192
+Rp1193
+sS'flags'
+p1194
+g73
+((lp1195
+S'int'
+p1196
+aS'uint64_t'
+p1197
+aS'uint32_t'
+p1198
+atp1199
+Rp1200
+sS'writecount'
+p1201
+g73
+((lp1202
+tp1203
+Rp1204
+sS'inval_entry_out'
+p1205
+g73
+((lp1206
+S'fuse_notify_inval_entry_out'
+p1207
+atp1208
+Rp1209
+sS'getattr_flags'
+p1210
+g73
+((lp1211
+S'uint32_t'
+p1212
+atp1213
+Rp1214
+sS'busy_time'
+p1215
+g73
+((lp1216
+tp1217
+Rp1218
+ssS'FUSE_OPCODE'
+p1219
+(dp1220
+I4096
+S'CUSE_INIT'
+p1221
+sI1
+S'FUSE_LOOKUP'
+p1222
+sI2
+S'FUSE_FORGET'
+p1223
+sI3
+S'FUSE_GETATTR'
+p1224
+sI4
+S'FUSE_SETATTR'
+p1225
+sI5
+S'FUSE_READLINK'
+p1226
+sI6
+S'FUSE_SYMLINK'
+p1227
+sI8
+S'FUSE_MKNOD'
+p1228
+sI9
+S'FUSE_MKDIR'
+p1229
+sI10
+S'FUSE_UNLINK'
+p1230
+sI11
+S'FUSE_RMDIR'
+p1231
+sI12
+S'FUSE_RENAME'
+p1232
+sI13
+S'FUSE_LINK'
+p1233
+sI14
+S'FUSE_OPEN'
+p1234
+sI15
+S'FUSE_READ'
+p1235
+sI16
+S'FUSE_WRITE'
+p1236
+sI17
+S'FUSE_STATFS'
+p1237
+sI18
+S'FUSE_RELEASE'
+p1238
+sI20
+S'FUSE_FSYNC'
+p1239
+sI21
+S'FUSE_SETXATTR'
+p1240
+sI22
+S'FUSE_GETXATTR'
+p1241
+sI23
+S'FUSE_LISTXATTR'
+p1242
+sI24
+S'FUSE_REMOVEXATTR'
+p1243
+sI25
+S'FUSE_FLUSH'
+p1244
+sI26
+S'FUSE_INIT'
+p1245
+sI27
+S'FUSE_OPENDIR'
+p1246
+sI28
+S'FUSE_READDIR'
+p1247
+sI29
+S'FUSE_RELEASEDIR'
+p1248
+sI30
+S'FUSE_FSYNCDIR'
+p1249
+sI31
+S'FUSE_GETLK'
+p1250
+sI32
+S'FUSE_SETLK'
+p1251
+sI33
+S'FUSE_SETLKW'
+p1252
+sI34
+S'FUSE_ACCESS'
+p1253
+sI35
+S'FUSE_CREATE'
+p1254
+sI36
+S'FUSE_INTERRUPT'
+p1255
+sI37
+S'FUSE_BMAP'
+p1256
+sI38
+S'FUSE_DESTROY'
+p1257
+sI39
+S'FUSE_IOCTL'
+p1258
+sI40
+S'FUSE_POLL'
+p1259
+sI41
+S'FUSE_NOTIFY_REPLY'
+p1260
+sI42
+S'FUSE_BATCH_FORGET'
+p1261
+sI43
+S'FUSE_FALLOCATE'
+p1262
+sI44
+S'FUSE_READDIRPLUS'
+p1263
+sI45
+S'FUSE_RENAME2'
+p1264
+sI46
+S'FUSE_LSEEK'
+p1265
+sI47
+S'FUSE_COPY_FILE_RANGE'
+p1266
+sI48
+S'FUSE_SETUPMAPPING'
+p1267
+sI49
+S'FUSE_REMOVEMAPPING'
+p1268
+sI50
+S'FUSE_SYNCFS'
+p1269
+sI51
+S'FUSE_TMPFILE'
+p1270
+sI1048576
+S'CUSE_INIT_BSWAP_RESERVED'
+p1271
+sI436207616
+S'FUSE_INIT_BSWAP_RESERVED'
+p1272
+ssS'STRUCTS'
+p1273
+(dp1274
+S'inMsgFlush'
+p1275
+(dp1276
+S'Version'
+p1277
+(I7
+I38
+tp1278
+sS'struct'
+p1279
+(lp1280
+(S'fuse_in_header'
+p1281
+S'struct'
+p1282
+tp1283
+a(S'fuse_flush_in'
+p1284
+S'struct'
+p1285
+tp1286
+assS'fuse_attr_out'
+p1287
+(dp1288
+g1277
+(I7
+I38
+tp1289
+sg1279
+(lp1290
+(S'attr_out'
+p1291
+S'fuse_attr_out'
+p1292
+tp1293
+assS'outMsgInvalEntryNotify'
+p1294
+(dp1295
+g1277
+(I7
+I38
+tp1296
+sg1279
+(lp1297
+(S'notify'
+p1298
+S'fuse_out_notify'
+p1299
+tp1300
+a(S'inval_entry_out'
+p1301
+g1207
+tp1302
+a(S'name'
+p1303
+S'char'
+p1304
+tp1305
+assS'outMsgPoll'
+p1306
+(dp1307
+g1277
+(I7
+I38
+tp1308
+sg1279
+(lp1309
+(S'fuse_out_header'
+p1310
+S'struct'
+p1311
+tp1312
+a(S'fuse_poll_out'
+p1313
+S'struct'
+p1314
+tp1315
+assS'fuse_file_lock'
+p1316
+(dp1317
+g1277
+(I7
+I38
+tp1318
+sg1279
+(lp1319
+(S'fflock'
+p1320
+S'fuse_file_lock'
+p1321
+tp1322
+assS'fuse_statfs_out'
+p1323
+(dp1324
+g1277
+(I7
+I38
+tp1325
+sg1279
+(lp1326
+(S'fuse_kstatfs'
+p1327
+S'struct'
+p1328
+tp1329
+assS'outHello'
+p1330
+(dp1331
+g1277
+(I7
+I38
+tp1332
+sg1279
+(lp1333
+(S'outHelloVersion'
+p1334
+g703
+tp1335
+a(S'fuse_version_major'
+p1336
+g1173
+tp1337
+a(S'fuse_version_minor'
+p1338
+g531
+tp1339
+a(S'daemon_pid'
+p1340
+S'pid_t'
+p1341
+tp1342
+a(S'statfsRC'
+p1343
+g372
+tp1344
+a(S'statfs'
+p1345
+S'struct'
+p1346
+tp1347
+assS'signalMsg'
+p1348
+(dp1349
+g1277
+(I7
+I38
+tp1350
+sg1279
+(lp1351
+(S'signal'
+p1352
+g320
+tp1353
+a(S'flags'
+p1354
+g1196
+tp1355
+a(S'secondsCleanup'
+p1356
+g558
+tp1357
+assS'outMsgSymlink'
+p1358
+(dp1359
+g1277
+(I7
+I38
+tp1360
+sg1279
+(lp1361
+(S'fuse_out_header'
+p1362
+S'struct'
+p1363
+tp1364
+a(S'fuse_entry_out'
+p1365
+S'struct'
+p1366
+tp1367
+assS'outMsgGetXattr'
+p1368
+(dp1369
+g1277
+(I7
+I38
+tp1370
+sg1279
+(lp1371
+(S'fuse_out_header'
+p1372
+S'struct'
+p1373
+tp1374
+a(S'fuse_getxattr_out'
+p1375
+S'struct'
+p1376
+tp1377
+a(S'attributeData'
+p1378
+g443
+tp1379
+assS'inMsgLock'
+p1380
+(dp1381
+g1277
+(I7
+I38
+tp1382
+sg1279
+(lp1383
+(S'fuse_in_header'
+p1384
+S'struct'
+p1385
+tp1386
+a(S'fuse_lk_in'
+p1387
+S'struct'
+p1388
+tp1389
+assS'inMsgGetXattr'
+p1390
+(dp1391
+g1277
+(I7
+I38
+tp1392
+sg1279
+(lp1393
+(S'fuse_in_header'
+p1394
+S'struct'
+p1395
+tp1396
+a(S'fuse_getxattr_in'
+p1397
+S'struct'
+p1398
+tp1399
+a(S'nameOfAttribute'
+p1400
+g1054
+tp1401
+assS'fuse_ext_header'
+p1402
+(dp1403
+g1277
+(I7
+I38
+tp1404
+sg1279
+(lp1405
+(S'size'
+p1406
+S'uint32_t'
+p1407
+tp1408
+a(S'type'
+p1409
+S'uint32_t'
+p1410
+tp1411
+assS'fuse_mknod_in'
+p1412
+(dp1413
+g1277
+(I7
+I38
+tp1414
+sg1279
+(lp1415
+(S'mode'
+p1416
+S'uint32_t'
+p1417
+tp1418
+a(S'rdev'
+p1419
+S'uint32_t'
+p1420
+tp1421
+a(S'umask'
+p1422
+g169
+tp1423
+a(S'padding'
+p1424
+S'uint32_t'
+p1425
+tp1426
+assS'outMsgGetattr'
+p1427
+(dp1428
+g1277
+(I7
+I38
+tp1429
+sg1279
+(lp1430
+(S'hdr'
+p1431
+g854
+tp1432
+a(S'getattr_out'
+p1433
+g668
+tp1434
+assS'fuse_secctx_header'
+p1435
+(dp1436
+g1277
+(I7
+I38
+tp1437
+sg1279
+(lp1438
+(S'size'
+p1439
+S'uint32_t'
+p1440
+tp1441
+a(g1047
+g1049
+tp1442
+assS'inMsgPwrite'
+p1443
+(dp1444
+g1277
+(I7
+I38
+tp1445
+sg1279
+(lp1446
+(S'fuse_in_header'
+p1447
+S'struct'
+p1448
+tp1449
+a(S'fuse_write_in'
+p1450
+S'struct'
+p1451
+tp1452
+a(S'data'
+p1453
+g708
+tp1454
+assS'fuse_forget_one'
+p1455
+(dp1456
+g1277
+(I7
+I38
+tp1457
+sg1279
+(lp1458
+(S'nodeid'
+p1459
+S'uint64_t'
+p1460
+tp1461
+a(S'nlookup'
+p1462
+S'uint64_t'
+p1463
+tp1464
+assS'fuse_getattr_in'
+p1465
+(dp1466
+g1277
+(I7
+I38
+tp1467
+sg1279
+(lp1468
+(S'getattr_flags'
+p1469
+g1212
+tp1470
+a(S'dummy'
+p1471
+S'uint32_t'
+p1472
+tp1473
+a(S'fh'
+p1474
+g648
+tp1475
+assS'fuse_access_in'
+p1476
+(dp1477
+g1277
+(I7
+I38
+tp1478
+sg1279
+(lp1479
+(S'mask'
+p1480
+g1168
+tp1481
+a(S'padding'
+p1482
+S'uint32_t'
+p1483
+tp1484
+assS'inMsgFallocate'
+p1485
+(dp1486
+g1277
+(I7
+I38
+tp1487
+sg1279
+(lp1488
+(S'fuse_in_header'
+p1489
+S'struct'
+p1490
+tp1491
+a(S'fuse_fallocate_in'
+p1492
+S'struct'
+p1493
+tp1494
+assS'fuse_ioctl_in'
+p1495
+(dp1496
+g1277
+(I7
+I38
+tp1497
+sg1279
+(lp1498
+(S'fh'
+p1499
+S'uint64_t'
+p1500
+tp1501
+a(S'flags'
+p1502
+S'uint32_t'
+p1503
+tp1504
+a(S'cmd'
+p1505
+g292
+tp1506
+a(S'arg'
+p1507
+g377
+tp1508
+a(S'in_size'
+p1509
+g748
+tp1510
+a(S'out_size'
+p1511
+g241
+tp1512
+assS'fuse_init_out'
+p1513
+(dp1514
+g1277
+(I7
+I38
+tp1515
+sg1279
+(lp1516
+(S'major'
+p1517
+S'uint32_t'
+p1518
+tp1519
+a(S'minor'
+p1520
+S'uint32_t'
+p1521
+tp1522
+a(S'max_readahead'
+p1523
+S'uint32_t'
+p1524
+tp1525
+a(S'flags'
+p1526
+S'uint32_t'
+p1527
+tp1528
+a(S'max_background'
+p1529
+g75
+tp1530
+a(S'congestion_threshold'
+p1531
+g254
+tp1532
+a(S'max_write'
+p1533
+g453
+tp1534
+a(S'time_gran'
+p1535
+g124
+tp1536
+a(g144
+g146
+tp1537
+a(g1002
+g1004
+tp1538
+a(S'flags2'
+p1539
+S'uint32_t'
+p1540
+tp1541
+a(g303
+g305
+tp1542
+assS'fuse_write_out'
+p1543
+(dp1544
+g1277
+(I7
+I38
+tp1545
+sg1279
+(lp1546
+(S'size'
+p1547
+S'uint32_t'
+p1548
+tp1549
+a(S'padding'
+p1550
+S'uint32_t'
+p1551
+tp1552
+assS'fuse_setupmapping_in'
+p1553
+(dp1554
+g1277
+(I7
+I38
+tp1555
+sg1279
+(lp1556
+(S'fh'
+p1557
+S'uint64_t'
+p1558
+tp1559
+a(g267
+g269
+tp1560
+a(S'len'
+p1561
+S'uint64_t'
+p1562
+tp1563
+a(S'flags'
+p1564
+S'uint64_t'
+p1565
+tp1566
+a(g580
+g582
+tp1567
+assS'fuse_attr'
+p1568
+(dp1569
+g1277
+(I7
+I38
+tp1570
+sg1279
+(lp1571
+(S'ino'
+p1572
+g971
+tp1573
+a(S'size'
+p1574
+g606
+tp1575
+a(S'blocks'
+p1576
+g1073
+tp1577
+a(S'atime'
+p1578
+g826
+tp1579
+a(S'mtime'
+p1580
+g985
+tp1581
+a(S'ctime'
+p1582
+g282
+tp1583
+a(S'atimensec'
+p1584
+g358
+tp1585
+a(S'mtimensec'
+p1586
+g980
+tp1587
+a(S'ctimensec'
+p1588
+g690
+tp1589
+a(S'mode'
+p1590
+g310
+tp1591
+a(S'nlink'
+p1592
+g1191
+tp1593
+a(S'uid'
+p1594
+g930
+tp1595
+a(S'gid'
+p1596
+g739
+tp1597
+a(S'rdev'
+p1598
+g925
+tp1599
+a(S'blksize'
+p1600
+g512
+tp1601
+a(S'flags'
+p1602
+g1198
+tp1603
+assS'fuse_bmap_out'
+p1604
+(dp1605
+g1277
+(I7
+I38
+tp1606
+sg1279
+(lp1607
+(S'block'
+p1608
+S'uint64_t'
+p1609
+tp1610
+assS'inMsgInterrupt'
+p1611
+(dp1612
+g1277
+(I7
+I38
+tp1613
+sg1279
+(lp1614
+(S'fuse_in_header'
+p1615
+S'struct'
+p1616
+tp1617
+a(S'fuse_interrupt_in'
+p1618
+S'struct'
+p1619
+tp1620
+assS'outMsgMknod'
+p1621
+(dp1622
+g1277
+(I7
+I38
+tp1623
+sg1279
+(lp1624
+(S'fuse_out_header'
+p1625
+S'struct'
+p1626
+tp1627
+a(S'fuse_entry_out'
+p1628
+S'struct'
+p1629
+tp1630
+assS'fuse_bmap_in'
+p1631
+(dp1632
+g1277
+(I7
+I38
+tp1633
+sg1279
+(lp1634
+(S'block'
+p1635
+g596
+tp1636
+a(S'blocksize'
+p1637
+g944
+tp1638
+a(S'padding'
+p1639
+S'uint32_t'
+p1640
+tp1641
+assS'fuse_forget_in'
+p1642
+(dp1643
+g1277
+(I7
+I38
+tp1644
+sg1279
+(lp1645
+(S'nlookup'
+p1646
+g472
+tp1647
+assS'fuse_getxattr_out'
+p1648
+(dp1649
+g1277
+(I7
+I38
+tp1650
+sg1279
+(lp1651
+(S'size'
+p1652
+S'uint32_t'
+p1653
+tp1654
+a(S'padding'
+p1655
+S'uint32_t'
+p1656
+tp1657
+assS'fuse_poll_in'
+p1658
+(dp1659
+g1277
+(I7
+I38
+tp1660
+sg1279
+(lp1661
+(S'fh'
+p1662
+S'uint64_t'
+p1663
+tp1664
+a(S'kh'
+p1665
+g1163
+tp1666
+a(S'flags'
+p1667
+S'uint32_t'
+p1668
+tp1669
+a(S'events'
+p1670
+g1064
+tp1671
+assS'fuse_open_out'
+p1672
+(dp1673
+g1277
+(I7
+I38
+tp1674
+sg1279
+(lp1675
+(S'fh'
+p1676
+S'uint64_t'
+p1677
+tp1678
+a(S'open_flags'
+p1679
+S'uint32_t'
+p1680
+tp1681
+a(S'padding'
+p1682
+S'uint32_t'
+p1683
+tp1684
+assS'fuse_notify_retrieve_in'
+p1685
+(dp1686
+g1277
+(I7
+I38
+tp1687
+sg1279
+(lp1688
+(g393
+g395
+tp1689
+a(S'offset'
+p1690
+S'uint64_t'
+p1691
+tp1692
+a(S'size'
+p1693
+S'uint32_t'
+p1694
+tp1695
+a(g380
+g382
+tp1696
+a(g186
+g188
+tp1697
+a(g398
+g400
+tp1698
+assS'fuse_rename2_in'
+p1699
+(dp1700
+g1277
+(I7
+I38
+tp1701
+sg1279
+(lp1702
+(S'newdir'
+p1703
+S'uint64_t'
+p1704
+tp1705
+a(S'flags'
+p1706
+S'uint32_t'
+p1707
+tp1708
+a(S'padding'
+p1709
+S'uint32_t'
+p1710
+tp1711
+assS'fuse_entry_out'
+p1712
+(dp1713
+g1277
+(I7
+I38
+tp1714
+sg1279
+(lp1715
+(S'nodeid'
+p1716
+g494
+tp1717
+a(S'generation'
+p1718
+g333
+tp1719
+a(S'entry_valid'
+p1720
+g1059
+tp1721
+a(S'attr_valid'
+p1722
+g183
+tp1723
+a(S'entry_valid_nsec'
+p1724
+g405
+tp1725
+a(S'attr_valid_nsec'
+p1726
+g601
+tp1727
+a(S'fuse_attr'
+p1728
+S'struct'
+p1729
+tp1730
+assS'inMsgLookup'
+p1731
+(dp1732
+g1277
+(I7
+I38
+tp1733
+sg1279
+(lp1734
+(S'fuse_in_header'
+p1735
+S'struct'
+p1736
+tp1737
+a(S'lookupname'
+p1738
+g1091
+tp1739
+assS'renameOffset'
+p1740
+(dp1741
+g1277
+(I7
+I38
+tp1742
+sg1279
+(lp1743
+(S'offset2newname'
+p1744
+g621
+tp1745
+a(S'offset2oldname'
+p1746
+g869
+tp1747
+assS'inMsgCreate'
+p1748
+(dp1749
+g1277
+(I7
+I38
+tp1750
+sg1279
+(lp1751
+(S'fuse_in_header'
+p1752
+S'struct'
+p1753
+tp1754
+a(S'fuse_create_in'
+p1755
+S'struct'
+p1756
+tp1757
+a(S'name'
+p1758
+S'char'
+p1759
+tp1760
+assS'inMsgForget'
+p1761
+(dp1762
+g1277
+(I7
+I38
+tp1763
+sg1279
+(lp1764
+(S'fuse_in_header'
+p1765
+S'struct'
+p1766
+tp1767
+a(S'fuse_forget_in'
+p1768
+S'struct'
+p1769
+tp1770
+assS'fuse_notify_inval_inode_out'
+p1771
+(dp1772
+g1277
+(I7
+I38
+tp1773
+sg1279
+(lp1774
+(S'ino'
+p1775
+S'uint64_t'
+p1776
+tp1777
+a(S'off'
+p1778
+g1139
+tp1779
+a(S'len'
+p1780
+g489
+tp1781
+assS'outMsgReaddirPlus'
+p1782
+(dp1783
+g1277
+(I7
+I38
+tp1784
+sg1279
+(lp1785
+(S'fuse_out_header'
+p1786
+S'struct'
+p1787
+tp1788
+assS'memItem'
+p1789
+(dp1790
+g1277
+(I7
+I38
+tp1791
+sg1279
+(lp1792
+(S'length'
+p1793
+S'uint64_t'
+p1794
+tp1795
+a(S'next'
+p1796
+g681
+tp1797
+a(S'chunkSize'
+p1798
+g259
+tp1799
+a(S'handle'
+p1800
+g214
+tp1801
+a(S'opcode'
+p1802
+S'uint32_t'
+p1803
+tp1804
+a(S'lkey'
+p1805
+g141
+tp1806
+a(S'rkey'
+p1807
+g1086
+tp1808
+a(S'crc32'
+p1809
+g526
+tp1810
+assS'fuse_mkdir_in'
+p1811
+(dp1812
+g1277
+(I7
+I38
+tp1813
+sg1279
+(lp1814
+(S'mode'
+p1815
+S'uint32_t'
+p1816
+tp1817
+a(S'umask'
+p1818
+S'uint32_t'
+p1819
+tp1820
+assS'outMsgPwrite'
+p1821
+(dp1822
+g1277
+(I7
+I38
+tp1823
+sg1279
+(lp1824
+(S'fuse_out_header'
+p1825
+S'struct'
+p1826
+tp1827
+a(S'fuse_write_out'
+p1828
+S'struct'
+p1829
+tp1830
+assS'fuse_out_header'
+p1831
+(dp1832
+g1277
+(I7
+I38
+tp1833
+sg1279
+(lp1834
+(S'fuse_out_notify'
+p1835
+S'fuse_out_header'
+p1836
+tp1837
+assS'fuse_syncfs_in'
+p1838
+(dp1839
+g1277
+(I7
+I38
+tp1840
+sg1279
+(lp1841
+(S'padding'
+p1842
+g796
+tp1843
+assS'fuse_lseek_in'
+p1844
+(dp1845
+g1277
+(I7
+I38
+tp1846
+sg1279
+(lp1847
+(S'fh'
+p1848
+S'uint64_t'
+p1849
+tp1850
+a(S'offset'
+p1851
+S'uint64_t'
+p1852
+tp1853
+a(S'whence'
+p1854
+g1023
+tp1855
+a(S'padding'
+p1856
+S'uint32_t'
+p1857
+tp1858
+assS'inMsgOpen'
+p1859
+(dp1860
+g1277
+(I7
+I38
+tp1861
+sg1279
+(lp1862
+(S'fuse_in_header'
+p1863
+S'struct'
+p1864
+tp1865
+a(S'fuse_open_in'
+p1866
+S'struct'
+p1867
+tp1868
+assS'fuse_batch_forget_in'
+p1869
+(dp1870
+g1277
+(I7
+I38
+tp1871
+sg1279
+(lp1872
+(S'count'
+p1873
+g840
+tp1874
+a(g1131
+g1133
+tp1875
+assS'fuse_notify_poll_wakeup_out'
+p1876
+(dp1877
+g1277
+(I7
+I38
+tp1878
+sg1279
+(lp1879
+(S'kh'
+p1880
+S'uint64_t'
+p1881
+tp1882
+assS'outMsgOpen'
+p1883
+(dp1884
+g1277
+(I7
+I38
+tp1885
+sg1279
+(lp1886
+(S'fuse_out_header'
+p1887
+S'struct'
+p1888
+tp1889
+a(S'fuse_open_out'
+p1890
+S'struct'
+p1891
+tp1892
+assS'fuse_secctx'
+p1893
+(dp1894
+g1277
+(I7
+I38
+tp1895
+sg1279
+(lp1896
+(S'size'
+p1897
+S'uint32_t'
+p1898
+tp1899
+a(S'padding'
+p1900
+S'uint32_t'
+p1901
+tp1902
+assS'fuse_setattr_in'
+p1903
+(dp1904
+g1277
+(I7
+I38
+tp1905
+sg1279
+(lp1906
+(S'valid'
+p1907
+g1044
+tp1908
+a(S'padding'
+p1909
+S'uint32_t'
+p1910
+tp1911
+a(S'fh'
+p1912
+S'uint64_t'
+p1913
+tp1914
+a(S'size'
+p1915
+S'uint64_t'
+p1916
+tp1917
+a(S'lock_owner'
+p1918
+g639
+tp1919
+a(S'atime'
+p1920
+S'uint64_t'
+p1921
+tp1922
+a(S'mtime'
+p1923
+S'uint64_t'
+p1924
+tp1925
+a(S'ctime'
+p1926
+S'uint64_t'
+p1927
+tp1928
+a(S'atimensec'
+p1929
+S'uint32_t'
+p1930
+tp1931
+a(S'mtimensec'
+p1932
+S'uint32_t'
+p1933
+tp1934
+a(S'ctimensec'
+p1935
+S'uint32_t'
+p1936
+tp1937
+a(S'mode'
+p1938
+S'uint32_t'
+p1939
+tp1940
+a(g1104
+g1106
+tp1941
+a(S'uid'
+p1942
+S'uint32_t'
+p1943
+tp1944
+a(S'gid'
+p1945
+S'uint32_t'
+p1946
+tp1947
+a(g724
+g726
+tp1948
+assS'inMsgSetattr'
+p1949
+(dp1950
+g1277
+(I7
+I38
+tp1951
+sg1279
+(lp1952
+(S'fuse_in_header'
+p1953
+S'struct'
+p1954
+tp1955
+a(S'fuse_setattr_in'
+p1956
+S'struct'
+p1957
+tp1958
+assS'outMsgCreate'
+p1959
+(dp1960
+g1277
+(I7
+I38
+tp1961
+sg1279
+(lp1962
+(S'fuse_out_header'
+p1963
+S'struct'
+p1964
+tp1965
+a(S'fuse_entry_out'
+p1966
+S'struct'
+p1967
+tp1968
+a(S'fuse_open_out'
+p1969
+S'struct'
+p1970
+tp1971
+assS'inMsgBatchForget'
+p1972
+(dp1973
+g1277
+(I7
+I38
+tp1974
+sg1279
+(lp1975
+(S'fuse_in_header'
+p1976
+S'struct'
+p1977
+tp1978
+a(S'fuse_batch_forget_in'
+p1979
+S'struct'
+p1980
+tp1981
+a(S'fuse_forget_one'
+p1982
+S'struct'
+p1983
+tp1984
+assS'inMsgGetattr'
+p1985
+(dp1986
+g1277
+(I7
+I38
+tp1987
+sg1279
+(lp1988
+(S'hdr'
+p1989
+g855
+tp1990
+a(S'fuse_getattr_in'
+p1991
+S'struct'
+p1992
+tp1993
+assS'fuse_create_in'
+p1994
+(dp1995
+g1277
+(I7
+I38
+tp1996
+sg1279
+(lp1997
+(S'flags'
+p1998
+S'uint32_t'
+p1999
+tp2000
+a(S'mode'
+p2001
+S'uint32_t'
+p2002
+tp2003
+a(S'umask'
+p2004
+S'uint32_t'
+p2005
+tp2006
+a(S'open_flags'
+p2007
+S'uint32_t'
+p2008
+tp2009
+assS'fuse_link_in'
+p2010
+(dp2011
+g1277
+(I7
+I38
+tp2012
+sg1279
+(lp2013
+(S'oldnodeid'
+p2014
+g1014
+tp2015
+assS'fuse_lk_in'
+p2016
+(dp2017
+g1277
+(I7
+I38
+tp2018
+sg1279
+(lp2019
+(S'fh'
+p2020
+S'uint64_t'
+p2021
+tp2022
+a(S'owner'
+p2023
+g353
+tp2024
+a(S'fuse_file_lock'
+p2025
+S'struct'
+p2026
+tp2027
+a(S'lk_flags'
+p2028
+g232
+tp2029
+a(S'padding'
+p2030
+S'uint32_t'
+p2031
+tp2032
+assS'inMsgFsync'
+p2033
+(dp2034
+g1277
+(I7
+I38
+tp2035
+sg1279
+(lp2036
+(S'fuse_in_header'
+p2037
+S'struct'
+p2038
+tp2039
+a(S'fuse_fsync_in'
+p2040
+S'struct'
+p2041
+tp2042
+assS'configurationPath'
+p2043
+(dp2044
+g1277
+(I7
+I38
+tp2045
+sg1279
+(lp2046
+(S'configPath'
+p2047
+g97
+tp2048
+assS'outMsgSetXattr'
+p2049
+(dp2050
+g1277
+(I7
+I38
+tp2051
+sg1279
+(lp2052
+(S'fuse_out_header'
+p2053
+S'struct'
+p2054
+tp2055
+assS'fuse_release_in'
+p2056
+(dp2057
+g1277
+(I7
+I38
+tp2058
+sg1279
+(lp2059
+(S'fh'
+p2060
+S'uint64_t'
+p2061
+tp2062
+a(S'flags'
+p2063
+S'uint32_t'
+p2064
+tp2065
+a(S'release_flags'
+p2066
+g1150
+tp2067
+a(S'lock_owner'
+p2068
+S'uint64_t'
+p2069
+tp2070
+assS'fuse_kstatfs'
+p2071
+(dp2072
+g1277
+(I7
+I38
+tp2073
+sg1279
+(lp2074
+(S'blocks'
+p2075
+S'uint64_t'
+p2076
+tp2077
+a(S'bfree'
+p2078
+g521
+tp2079
+a(S'bavail'
+p2080
+g907
+tp2081
+a(S'files'
+p2082
+g763
+tp2083
+a(S'ffree'
+p2084
+g791
+tp2085
+a(S'bsize'
+p2086
+g88
+tp2087
+a(S'namelen'
+p2088
+g1186
+tp2089
+a(S'frsize'
+p2090
+g831
+tp2091
+a(g794
+g798
+tp2092
+a(g336
+g338
+tp2093
+assS'outMsgReaddir'
+p2094
+(dp2095
+g1277
+(I7
+I38
+tp2096
+sg1279
+(lp2097
+(S'fuse_out_header'
+p2098
+S'struct'
+p2099
+tp2100
+assS'outMsgLookup'
+p2101
+(dp2102
+g1277
+(I7
+I38
+tp2103
+sg1279
+(lp2104
+(S'fuse_out_header'
+p2105
+S'struct'
+p2106
+tp2107
+a(S'fuse_entry_out'
+p2108
+S'struct'
+p2109
+tp2110
+assS'inMsgIoctl'
+p2111
+(dp2112
+g1277
+(I7
+I38
+tp2113
+sg1279
+(lp2114
+(S'fuse_in_header'
+p2115
+S'struct'
+p2116
+tp2117
+a(S'fuse_ioctl_in'
+p2118
+S'struct'
+p2119
+tp2120
+a(S'data'
+p2121
+S'char'
+p2122
+tp2123
+assS'OutMsgPollNotify'
+p2124
+(dp2125
+g1277
+(I7
+I38
+tp2126
+sg1279
+(lp2127
+(S'notify'
+p2128
+S'fuse_out_notify'
+p2129
+tp2130
+a(S'fuse_notify_poll_wakeup_out'
+p2131
+S'struct'
+p2132
+tp2133
+assS'fuse_lseek_out'
+p2134
+(dp2135
+g1277
+(I7
+I38
+tp2136
+sg1279
+(lp2137
+(S'offset'
+p2138
+S'uint64_t'
+p2139
+tp2140
+assS'fuse_flush_in'
+p2141
+(dp2142
+g1277
+(I7
+I38
+tp2143
+sg1279
+(lp2144
+(S'fh'
+p2145
+S'uint64_t'
+p2146
+tp2147
+a(g1099
+g1101
+tp2148
+a(S'padding'
+p2149
+S'uint32_t'
+p2150
+tp2151
+a(S'lock_owner'
+p2152
+S'uint64_t'
+p2153
+tp2154
+assS'inMsgLink'
+p2155
+(dp2156
+g1277
+(I7
+I38
+tp2157
+sg1279
+(lp2158
+(S'fuse_in_header'
+p2159
+S'struct'
+p2160
+tp2161
+a(S'fuse_link_in'
+p2162
+S'struct'
+p2163
+tp2164
+a(S'newname'
+p2165
+S'char'
+p2166
+tp2167
+assS'fuse_removemapping_one'
+p2168
+(dp2169
+g1277
+(I7
+I38
+tp2170
+sg1279
+(lp2171
+(S'moffset'
+p2172
+S'uint64_t'
+p2173
+tp2174
+a(S'len'
+p2175
+S'uint64_t'
+p2176
+tp2177
+assS'fuse_setxattr_in'
+p2178
+(dp2179
+g1277
+(I7
+I38
+tp2180
+sg1279
+(lp2181
+(S'size'
+p2182
+S'uint32_t'
+p2183
+tp2184
+a(S'flags'
+p2185
+S'uint32_t'
+p2186
+tp2187
+a(g1094
+g1096
+tp2188
+a(S'padding'
+p2189
+S'uint32_t'
+p2190
+tp2191
+assS'fuse_notify_inval_entry_out'
+p2192
+(dp2193
+g1277
+(I7
+I38
+tp2194
+sg1279
+(lp2195
+(S'parent'
+p2196
+g477
+tp2197
+a(S'namelen'
+p2198
+S'uint32_t'
+p2199
+tp2200
+a(S'flags'
+p2201
+S'uint32_t'
+p2202
+tp2203
+assS'outMsgGenericNotify'
+p2204
+(dp2205
+g1277
+(I7
+I38
+tp2206
+sg1279
+(lp2207
+(S'notify'
+p2208
+g658
+tp2209
+assS'inMsgRelease'
+p2210
+(dp2211
+g1277
+(I7
+I38
+tp2212
+sg1279
+(lp2213
+(S'fuse_in_header'
+p2214
+S'struct'
+p2215
+tp2216
+a(S'fuse_release_in'
+p2217
+S'struct'
+p2218
+tp2219
+assS'outMsgSetattr'
+p2220
+(dp2221
+g1277
+(I7
+I38
+tp2222
+sg1279
+(lp2223
+(S'fuse_out_header'
+p2224
+S'struct'
+p2225
+tp2226
+a(S'fuse_attr_out'
+p2227
+S'struct'
+p2228
+tp2229
+assS'outMsgGeneric'
+p2230
+(dp2231
+g1277
+(I7
+I38
+tp2232
+sg1279
+(lp2233
+(S'fuse_out_header'
+p2234
+S'struct'
+p2235
+tp2236
+a(S'argsOut'
+p2237
+g223
+tp2238
+assS'cuse_init_in'
+p2239
+(dp2240
+g1277
+(I7
+I38
+tp2241
+sg1279
+(lp2242
+(S'major'
+p2243
+S'uint32_t'
+p2244
+tp2245
+a(S'minor'
+p2246
+S'uint32_t'
+p2247
+tp2248
+a(S'unused'
+p2249
+S'uint32_t'
+p2250
+tp2251
+a(S'flags'
+p2252
+S'uint32_t'
+p2253
+tp2254
+assS'inMsgPoll'
+p2255
+(dp2256
+g1277
+(I7
+I38
+tp2257
+sg1279
+(lp2258
+(S'fuse_in_header'
+p2259
+S'struct'
+p2260
+tp2261
+a(S'fuse_poll_in'
+p2262
+S'struct'
+p2263
+tp2264
+assS'fuse_notify_delete_out'
+p2265
+(dp2266
+g1277
+(I7
+I38
+tp2267
+sg1279
+(lp2268
+(S'parent'
+p2269
+S'uint64_t'
+p2270
+tp2271
+a(S'child'
+p2272
+g817
+tp2273
+a(S'namelen'
+p2274
+S'uint32_t'
+p2275
+tp2276
+a(S'padding'
+p2277
+S'uint32_t'
+p2278
+tp2279
+assS'inMsgUnlinkAtName'
+p2280
+(dp2281
+g1277
+(I7
+I38
+tp2282
+sg1279
+(lp2283
+(S'fuse_in_header'
+p2284
+S'struct'
+p2285
+tp2286
+a(S'unlinkatname'
+p2287
+g430
+tp2288
+assS'fuse_notify_store_out'
+p2289
+(dp2290
+g1277
+(I7
+I38
+tp2291
+sg1279
+(lp2292
+(S'nodeid'
+p2293
+S'uint64_t'
+p2294
+tp2295
+a(S'offset'
+p2296
+S'uint64_t'
+p2297
+tp2298
+a(S'size'
+p2299
+S'uint32_t'
+p2300
+tp2301
+a(S'padding'
+p2302
+S'uint32_t'
+p2303
+tp2304
+assS'inMsgSymlink'
+p2305
+(dp2306
+g1277
+(I7
+I38
+tp2307
+sg1279
+(lp2308
+(S'fuse_in_header'
+p2309
+S'struct'
+p2310
+tp2311
+a(S'oldname'
+p2312
+S'char'
+p2313
+tp2314
+a(S'newname'
+p2315
+S'char'
+p2316
+tp2317
+assS'fuse_ioctl_out'
+p2318
+(dp2319
+g1277
+(I7
+I38
+tp2320
+sg1279
+(lp2321
+(S'result'
+p2322
+g367
+tp2323
+a(S'flags'
+p2324
+S'uint32_t'
+p2325
+tp2326
+a(S'in_iovs'
+p2327
+g458
+tp2328
+a(S'out_iovs'
+p2329
+g467
+tp2330
+assS'fuse_rename_in'
+p2331
+(dp2332
+g1277
+(I7
+I38
+tp2333
+sg1279
+(lp2334
+(S'newdir'
+p2335
+g966
+tp2336
+assS'fuse_direntplus'
+p2337
+(dp2338
+g1277
+(I7
+I38
+tp2339
+sg1279
+(lp2340
+(S'fuse_entry_out'
+p2341
+S'struct'
+p2342
+tp2343
+a(S'fuse_dirent'
+p2344
+S'struct'
+p2345
+tp2346
+assS'fuse_lk_out'
+p2347
+(dp2348
+g1277
+(I7
+I38
+tp2349
+sg1279
+(lp2350
+(S'fuse_file_lock'
+p2351
+S'struct'
+p2352
+tp2353
+assS'fuse_fallocate_in'
+p2354
+(dp2355
+g1277
+(I7
+I38
+tp2356
+sg1279
+(lp2357
+(S'fh'
+p2358
+S'uint64_t'
+p2359
+tp2360
+a(S'offset'
+p2361
+S'uint64_t'
+p2362
+tp2363
+a(S'length'
+p2364
+g572
+tp2365
+a(S'mode'
+p2366
+S'uint32_t'
+p2367
+tp2368
+a(S'padding'
+p2369
+S'uint32_t'
+p2370
+tp2371
+assS'inMsgRename'
+p2372
+(dp2373
+g1277
+(I7
+I38
+tp2374
+sg1279
+(lp2375
+(S'fuse_in_header'
+p2376
+S'struct'
+p2377
+tp2378
+a(S'newdirInode'
+p2379
+g786
+tp2380
+a(S'oldname'
+p2381
+g193
+tp2382
+a(S'newname'
+p2383
+g939
+tp2384
+assS'inMsgListXattr'
+p2385
+(dp2386
+g1277
+(I7
+I38
+tp2387
+sg1279
+(lp2388
+(S'fuse_in_header'
+p2389
+S'struct'
+p2390
+tp2391
+a(S'fuse_getxattr_in'
+p2392
+S'struct'
+p2393
+tp2394
+assS'fuse_removemapping_in'
+p2395
+(dp2396
+g1277
+(I7
+I38
+tp2397
+sg1279
+(lp2398
+(S'count'
+p2399
+S'uint32_t'
+p2400
+tp2401
+assS'fuse_write_in'
+p2402
+(dp2403
+g1277
+(I7
+I38
+tp2404
+sg1279
+(lp2405
+(S'fh'
+p2406
+S'uint64_t'
+p2407
+tp2408
+a(S'offset'
+p2409
+S'uint64_t'
+p2410
+tp2411
+a(S'size'
+p2412
+S'uint32_t'
+p2413
+tp2414
+a(S'write_flags'
+p2415
+g587
+tp2416
+a(S'lock_owner'
+p2417
+S'uint64_t'
+p2418
+tp2419
+a(S'flags'
+p2420
+S'uint32_t'
+p2421
+tp2422
+a(S'padding'
+p2423
+S'uint32_t'
+p2424
+tp2425
+assS'outMsgInit'
+p2426
+(dp2427
+g1277
+(I7
+I38
+tp2428
+sg1279
+(lp2429
+(S'fuse_out_header'
+p2430
+S'struct'
+p2431
+tp2432
+a(S'fuse_init_out'
+p2433
+S'struct'
+p2434
+tp2435
+assS'wakeupPipeMsg'
+p2436
+(dp2437
+g1277
+(I7
+I38
+tp2438
+sg1279
+(lp2439
+(S'id'
+p2440
+g995
+tp2441
+a(S'signalSent'
+p2442
+g653
+tp2443
+assS'cuse_init_out'
+p2444
+(dp2445
+g1277
+(I7
+I38
+tp2446
+sg1279
+(lp2447
+(S'major'
+p2448
+S'uint32_t'
+p2449
+tp2450
+a(S'minor'
+p2451
+S'uint32_t'
+p2452
+tp2453
+a(S'unused'
+p2454
+S'uint32_t'
+p2455
+tp2456
+a(S'flags'
+p2457
+S'uint32_t'
+p2458
+tp2459
+a(S'max_read'
+p2460
+g1145
+tp2461
+a(S'max_write'
+p2462
+S'uint32_t'
+p2463
+tp2464
+a(S'dev_major'
+p2465
+g448
+tp2466
+a(S'dev_minor'
+p2467
+g287
+tp2468
+a(g346
+g348
+tp2469
+assS'inMsgAccess'
+p2470
+(dp2471
+g1277
+(I7
+I38
+tp2472
+sg1279
+(lp2473
+(S'fuse_in_header'
+p2474
+S'struct'
+p2475
+tp2476
+a(S'fuse_access_in'
+p2477
+S'struct'
+p2478
+tp2479
+assS'outMsgUnlinkAtName'
+p2480
+(dp2481
+g1277
+(I7
+I38
+tp2482
+sg1279
+(lp2483
+(S'fuse_out_header'
+p2484
+S'struct'
+p2485
+tp2486
+a(S'unlinkedInode'
+p2487
+g315
+tp2488
+assS'outMsgMkdir'
+p2489
+(dp2490
+g1277
+(I7
+I38
+tp2491
+sg1279
+(lp2492
+(S'fuse_out_header'
+p2493
+S'struct'
+p2494
+tp2495
+a(S'fuse_entry_out'
+p2496
+S'struct'
+p2497
+tp2498
+assS'fuse_notify_retrieve_out'
+p2499
+(dp2500
+g1277
+(I7
+I38
+tp2501
+sg1279
+(lp2502
+(S'notify_unique'
+p2503
+g174
+tp2504
+a(S'nodeid'
+p2505
+S'uint64_t'
+p2506
+tp2507
+a(S'offset'
+p2508
+S'uint64_t'
+p2509
+tp2510
+a(S'size'
+p2511
+S'uint32_t'
+p2512
+tp2513
+a(S'padding'
+p2514
+S'uint32_t'
+p2515
+tp2516
+assS'inHello'
+p2517
+(dp2518
+g1277
+(I7
+I38
+tp2519
+sg1279
+(lp2520
+(S'max_read'
+p2521
+g1144
+tp2522
+a(S'version_major'
+p2523
+g768
+tp2524
+a(S'version_minor'
+p2525
+g536
+tp2526
+a(S'daemon_pid'
+p2527
+g1116
+tp2528
+a(S'generation'
+p2529
+S'uint64_t'
+p2530
+tp2531
+a(S'entry_valid'
+p2532
+S'uint64_t'
+p2533
+tp2534
+a(S'attr_valid'
+p2535
+S'uint64_t'
+p2536
+tp2537
+a(S'entry_valid_nsec'
+p2538
+S'uint32_t'
+p2539
+tp2540
+a(S'attr_valid_nsec'
+p2541
+S'uint32_t'
+p2542
+tp2543
+a(S'openOutFlags'
+p2544
+g482
+tp2545
+assS'outMsgGetLock'
+p2546
+(dp2547
+g1277
+(I7
+I38
+tp2548
+sg1279
+(lp2549
+(S'fuse_out_header'
+p2550
+S'struct'
+p2551
+tp2552
+a(S'fuse_lk_out'
+p2553
+S'struct'
+p2554
+tp2555
+assS'inMsgRemoveXattr'
+p2556
+(dp2557
+g1277
+(I7
+I38
+tp2558
+sg1279
+(lp2559
+(S'fuse_in_header'
+p2560
+S'struct'
+p2561
+tp2562
+a(S'nameOfAttribute'
+p2563
+S'char'
+p2564
+tp2565
+assS'fuse_open_in'
+p2566
+(dp2567
+g1277
+(I7
+I38
+tp2568
+sg1279
+(lp2569
+(S'flags'
+p2570
+S'uint32_t'
+p2571
+tp2572
+a(S'open_flags'
+p2573
+g912
+tp2574
+assS'inMsgMknod'
+p2575
+(dp2576
+g1277
+(I7
+I38
+tp2577
+sg1279
+(lp2578
+(S'fuse_in_header'
+p2579
+S'struct'
+p2580
+tp2581
+a(S'fuse_mknod_in'
+p2582
+S'struct'
+p2583
+tp2584
+a(S'name'
+p2585
+S'char'
+p2586
+tp2587
+assS'outMsgLink'
+p2588
+(dp2589
+g1277
+(I7
+I38
+tp2590
+sg1279
+(lp2591
+(S'fuse_out_header'
+p2592
+S'struct'
+p2593
+tp2594
+a(S'fuse_entry_out'
+p2595
+S'struct'
+p2596
+tp2597
+assS'inMsgGeneric'
+p2598
+(dp2599
+g1277
+(I7
+I38
+tp2600
+sg1279
+(lp2601
+(S'fuse_in_header'
+p2602
+S'struct'
+p2603
+tp2604
+a(S'argsIn'
+p2605
+g990
+tp2606
+assS'outMsgStatfs'
+p2607
+(dp2608
+g1277
+(I7
+I38
+tp2609
+sg1279
+(lp2610
+(S'fuse_out_header'
+p2611
+S'struct'
+p2612
+tp2613
+a(S'fuse_kstatfs'
+p2614
+S'struct'
+p2615
+tp2616
+assS'fuse_init_in'
+p2617
+(dp2618
+g1277
+(I7
+I38
+tp2619
+sg1279
+(lp2620
+(S'major'
+p2621
+g612
+tp2622
+a(S'minor'
+p2623
+g758
+tp2624
+a(S'max_readahead'
+p2625
+g777
+tp2626
+a(S'flags'
+p2627
+S'uint32_t'
+p2628
+tp2629
+a(g158
+g160
+tp2630
+a(g1109
+g1111
+tp2631
+assS'inMsgPread'
+p2632
+(dp2633
+g1277
+(I7
+I38
+tp2634
+sg1279
+(lp2635
+(S'fuse_in_header'
+p2636
+S'struct'
+p2637
+tp2638
+a(S'fuse_read_in'
+p2639
+S'struct'
+p2640
+tp2641
+assS'inMsgInit'
+p2642
+(dp2643
+g1277
+(I7
+I38
+tp2644
+sg1279
+(lp2645
+(S'fuse_in_header'
+p2646
+S'struct'
+p2647
+tp2648
+a(S'fuse_init_in'
+p2649
+S'struct'
+p2650
+tp2651
+assS'fuse_copy_file_range_in'
+p2652
+(dp2653
+g1277
+(I7
+I38
+tp2654
+sg1279
+(lp2655
+(g539
+g541
+tp2656
+a(g561
+g563
+tp2657
+a(g262
+g264
+tp2658
+a(g108
+g110
+tp2659
+a(g843
+g845
+tp2660
+a(S'len'
+p2661
+S'uint64_t'
+p2662
+tp2663
+a(S'flags'
+p2664
+g1197
+tp2665
+assS'fuse_in_header'
+p2666
+(dp2667
+g1277
+(I7
+I38
+tp2668
+sg1279
+(lp2669
+(S'len'
+p2670
+g488
+tp2671
+a(S'opcode'
+p2672
+g577
+tp2673
+a(S'unique'
+p2674
+S'uint64_t'
+p2675
+tp2676
+a(S'nodeid'
+p2677
+S'uint64_t'
+p2678
+tp2679
+a(S'uid'
+p2680
+S'uint32_t'
+p2681
+tp2682
+a(S'gid'
+p2683
+S'uint32_t'
+p2684
+tp2685
+a(S'pid'
+p2686
+S'uint32_t'
+p2687
+tp2688
+a(g661
+g663
+tp2689
+a(S'padding'
+p2690
+g797
+tp2691
+assS'stat4Name'
+p2692
+(dp2693
+g1277
+(I7
+I38
+tp2694
+sg1279
+(lp2695
+(S'stat'
+p2696
+S'struct'
+p2697
+tp2698
+assS'inMsgMkdir'
+p2699
+(dp2700
+g1277
+(I7
+I38
+tp2701
+sg1279
+(lp2702
+(S'fuse_in_header'
+p2703
+S'struct'
+p2704
+tp2705
+a(S'fuse_mkdir_in'
+p2706
+S'struct'
+p2707
+tp2708
+a(S'name'
+p2709
+S'char'
+p2710
+tp2711
+assS'fuse_ioctl_iovec'
+p2712
+(dp2713
+g1277
+(I7
+I38
+tp2714
+sg1279
+(lp2715
+(S'base'
+p2716
+g503
+tp2717
+a(S'len'
+p2718
+g487
+tp2719
+assS'inMsgReaddir'
+p2720
+(dp2721
+g1277
+(I7
+I38
+tp2722
+sg1279
+(lp2723
+(S'fuse_in_header'
+p2724
+S'struct'
+p2725
+tp2726
+a(S'fuse_read_in'
+p2727
+S'struct'
+p2728
+tp2729
+assS'outMsgReadlink'
+p2730
+(dp2731
+g1277
+(I7
+I38
+tp2732
+sg1279
+(lp2733
+(S'fuse_out_header'
+p2734
+S'struct'
+p2735
+tp2736
+a(S'link'
+p2737
+g807
+tp2738
+assS'fuse_fsync_in'
+p2739
+(dp2740
+g1277
+(I7
+I38
+tp2741
+sg1279
+(lp2742
+(S'fh'
+p2743
+S'uint64_t'
+p2744
+tp2745
+a(S'fsync_flags'
+p2746
+g119
+tp2747
+a(S'padding'
+p2748
+S'uint32_t'
+p2749
+tp2750
+assS'fuse_interrupt_in'
+p2751
+(dp2752
+g1277
+(I7
+I38
+tp2753
+sg1279
+(lp2754
+(S'unique'
+p2755
+g151
+tp2756
+assS'fuse_poll_out'
+p2757
+(dp2758
+g1277
+(I7
+I38
+tp2759
+sg1279
+(lp2760
+(S'revents'
+p2761
+g812
+tp2762
+a(S'padding'
+p2763
+S'uint32_t'
+p2764
+tp2765
+assS'outMsgPread'
+p2766
+(dp2767
+g1277
+(I7
+I38
+tp2768
+sg1279
+(lp2769
+(S'fuse_out_header'
+p2770
+S'struct'
+p2771
+tp2772
+assS'inMsgReleasedir'
+p2773
+(dp2774
+g1277
+(I7
+I38
+tp2775
+sg1279
+(lp2776
+(S'fuse_in_header'
+p2777
+S'struct'
+p2778
+tp2779
+a(S'fuse_release_in'
+p2780
+S'struct'
+p2781
+tp2782
+assS'inMsgRename2'
+p2783
+(dp2784
+g1277
+(I7
+I38
+tp2785
+sg1279
+(lp2786
+(S'fuse_in_header'
+p2787
+S'struct'
+p2788
+tp2789
+a(S'fuse_rename2_in'
+p2790
+S'struct'
+p2791
+tp2792
+a(S'oldname'
+p2793
+S'char'
+p2794
+tp2795
+a(S'newname'
+p2796
+S'char'
+p2797
+tp2798
+assS'fuse_dirent'
+p2799
+(dp2800
+g1277
+(I7
+I38
+tp2801
+sg1279
+(lp2802
+(S'ino'
+p2803
+S'uint64_t'
+p2804
+tp2805
+a(S'off'
+p2806
+g1138
+tp2807
+a(S'namelen'
+p2808
+S'uint32_t'
+p2809
+tp2810
+a(S'type'
+p2811
+S'uint32_t'
+p2812
+tp2813
+a(S'name'
+p2814
+g721
+tp2815
+assS'fuse_read_in'
+p2816
+(dp2817
+g1277
+(I7
+I38
+tp2818
+sg1279
+(lp2819
+(S'fh'
+p2820
+S'uint64_t'
+p2821
+tp2822
+a(S'offset'
+p2823
+g626
+tp2824
+a(S'size'
+p2825
+g607
+tp2826
+a(S'read_flags'
+p2827
+g343
+tp2828
+a(S'lock_owner'
+p2829
+S'uint64_t'
+p2830
+tp2831
+a(S'flags'
+p2832
+S'uint32_t'
+p2833
+tp2834
+a(S'padding'
+p2835
+S'uint32_t'
+p2836
+tp2837
+assS'fuse_getxattr_in'
+p2838
+(dp2839
+g1277
+(I7
+I38
+tp2840
+sg1279
+(lp2841
+(S'size'
+p2842
+S'uint32_t'
+p2843
+tp2844
+a(S'padding'
+p2845
+S'uint32_t'
+p2846
+tp2847
+assS'inMsgSetXattr'
+p2848
+(dp2849
+g1277
+(I7
+I38
+tp2850
+sg1279
+(lp2851
+(S'fuse_in_header'
+p2852
+S'struct'
+p2853
+tp2854
+a(S'fuse_setxattr_in'
+p2855
+S'struct'
+p2856
+tp2857
+a(S'nameOfAttribute'
+p2858
+S'char'
+p2859
+tp2860
+a(S'data'
+p2861
+S'char'
+p2862
+tp2863
+asss.
\ No newline at end of file
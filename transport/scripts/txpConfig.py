@@ -271,6 +271,7 @@ ATTRIBUTE_NAMES_TO_ADD =   {
                                 'synccount':222,
                                 'synctime':223,
                                 'timeBaseScale':224,
+                                'asyncRequestFileSeqNbr':235,           # __s32
                            }
 
 # NOTE:  Add new CORAL message ids to either the end of the CORAL_ section or the end of the BB_ section
@@ -286,6 +287,7 @@ CORAL_IDS = {'CORAL_AUTHENTICATE':1,
              'CORAL_SETVAR':10,
              'CORAL_SIGNAL':11,
              'CORAL_STAGEOUT_START':12,
+             'CORAL_INVALIDATE':13,
              'BB_ALL_FILE_TRANSFERS_COMPLETE':256,
              'BB_CANCELTRANSFER':257,
              'BB_CHMOD':258,
@@ -326,6 +328,7 @@ CORAL_IDS = {'CORAL_AUTHENTICATE':1,
              'BB_SETSERVERCFGVALUE':293,
              'BB_GETSERVERCFGVALUE':294,
              'BB_GETFILEINFO':295,
+             'BB_ASYNC_REQUEST':296,
             }
 
 IDS_NOT_SUPPORTED = (
@@ -3065,11 +3065,11 @@ int txp::AttrPtr_array_of_char_arrays::addValue(HeapBuffer* pBuffer, unsigned lo
 //*****************************************************************************
 //  Clone routines for attributes
 //*****************************************************************************
-int txp::Attr_char::clone(Attribute* &pTargetAttr) {
+int txp::Attr_char::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		Attr_char* l_Attr = new Attr_char(*this);
+		Attr_char* l_Attr = NEW_ATTR(Attr_char, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3080,11 +3080,11 @@ int txp::Attr_char::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::Attr_uint8::clone(Attribute* &pTargetAttr) {
+int txp::Attr_uint8::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		Attr_uint8* l_Attr = new Attr_uint8(*this);
+		Attr_uint8* l_Attr = NEW_ATTR(Attr_uint8, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3095,11 +3095,11 @@ int txp::Attr_uint8::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::Attr_uint16::clone(Attribute* &pTargetAttr) {
+int txp::Attr_uint16::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		Attr_uint16* l_Attr = new Attr_uint16(*this);
+		Attr_uint16* l_Attr = NEW_ATTR(Attr_uint16, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3110,11 +3110,11 @@ int txp::Attr_uint16::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::Attr_uint32::clone(Attribute* &pTargetAttr) {
+int txp::Attr_uint32::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		Attr_uint32* l_Attr = new Attr_uint32(*this);
+		Attr_uint32* l_Attr = NEW_ATTR(Attr_uint32, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3125,11 +3125,11 @@ int txp::Attr_uint32::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::Attr_uint64::clone(Attribute* &pTargetAttr) {
+int txp::Attr_uint64::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		Attr_uint64* l_Attr = new Attr_uint64(*this);
+		Attr_uint64* l_Attr = NEW_ATTR(Attr_uint64, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3140,11 +3140,11 @@ int txp::Attr_uint64::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::Attr_int8::clone(Attribute* &pTargetAttr) {
+int txp::Attr_int8::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		Attr_int8* l_Attr = new Attr_int8(*this);
+		Attr_int8* l_Attr = NEW_ATTR(Attr_int8, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3155,11 +3155,11 @@ int txp::Attr_int8::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::Attr_int16::clone(Attribute* &pTargetAttr) {
+int txp::Attr_int16::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		Attr_int16* l_Attr = new Attr_int16(*this);
+		Attr_int16* l_Attr = NEW_ATTR(Attr_int16, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3170,11 +3170,11 @@ int txp::Attr_int16::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::Attr_int32::clone(Attribute* &pTargetAttr) {
+int txp::Attr_int32::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		Attr_int32* l_Attr = new Attr_int32(*this);
+		Attr_int32* l_Attr = NEW_ATTR(Attr_int32, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3185,11 +3185,11 @@ int txp::Attr_int32::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::Attr_int64::clone(Attribute* &pTargetAttr) {
+int txp::Attr_int64::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		Attr_int64* l_Attr = new Attr_int64(*this);
+		Attr_int64* l_Attr = NEW_ATTR(Attr_int64, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3200,11 +3200,11 @@ int txp::Attr_int64::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::AttrPtr_char::clone(Attribute* &pTargetAttr) {
+int txp::AttrPtr_char::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		AttrPtr_char* l_Attr = new AttrPtr_char(*this);
+		AttrPtr_char* l_Attr = NEW_ATTR(AttrPtr_char, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3215,11 +3215,11 @@ int txp::AttrPtr_char::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::AttrPtr_uint8::clone(Attribute* &pTargetAttr) {
+int txp::AttrPtr_uint8::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		AttrPtr_uint8* l_Attr = new AttrPtr_uint8(*this);
+		AttrPtr_uint8* l_Attr = NEW_ATTR(AttrPtr_uint8, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3230,11 +3230,11 @@ int txp::AttrPtr_uint8::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::AttrPtr_uint16::clone(Attribute* &pTargetAttr) {
+int txp::AttrPtr_uint16::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		AttrPtr_uint16* l_Attr = new AttrPtr_uint16(*this);
+		AttrPtr_uint16* l_Attr = NEW_ATTR(AttrPtr_uint16, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3245,11 +3245,11 @@ int txp::AttrPtr_uint16::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::AttrPtr_uint32::clone(Attribute* &pTargetAttr) {
+int txp::AttrPtr_uint32::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		AttrPtr_uint32* l_Attr = new AttrPtr_uint32(*this);
+		AttrPtr_uint32* l_Attr = NEW_ATTR(AttrPtr_uint32, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3260,11 +3260,11 @@ int txp::AttrPtr_uint32::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::AttrPtr_uint64::clone(Attribute* &pTargetAttr) {
+int txp::AttrPtr_uint64::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		AttrPtr_uint64* l_Attr = new AttrPtr_uint64(*this);
+		AttrPtr_uint64* l_Attr = NEW_ATTR(AttrPtr_uint64, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3275,11 +3275,11 @@ int txp::AttrPtr_uint64::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::AttrPtr_int8::clone(Attribute* &pTargetAttr) {
+int txp::AttrPtr_int8::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		AttrPtr_int8* l_Attr = new AttrPtr_int8(*this);
+		AttrPtr_int8* l_Attr = NEW_ATTR(AttrPtr_int8, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3290,11 +3290,11 @@ int txp::AttrPtr_int8::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::AttrPtr_int16::clone(Attribute* &pTargetAttr) {
+int txp::AttrPtr_int16::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		AttrPtr_int16* l_Attr = new AttrPtr_int16(*this);
+		AttrPtr_int16* l_Attr = NEW_ATTR(AttrPtr_int16, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3305,11 +3305,11 @@ int txp::AttrPtr_int16::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::AttrPtr_int32::clone(Attribute* &pTargetAttr) {
+int txp::AttrPtr_int32::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		AttrPtr_int32* l_Attr = new AttrPtr_int32(*this);
+		AttrPtr_int32* l_Attr = NEW_ATTR(AttrPtr_int32, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3320,11 +3320,11 @@ int txp::AttrPtr_int32::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::AttrPtr_int64::clone(Attribute* &pTargetAttr) {
+int txp::AttrPtr_int64::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		AttrPtr_int64* l_Attr = new AttrPtr_int64(*this);
+		AttrPtr_int64* l_Attr = NEW_ATTR(AttrPtr_int64, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3335,11 +3335,11 @@ int txp::AttrPtr_int64::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::AttrPtr_char_array::clone(Attribute* &pTargetAttr) {
+int txp::AttrPtr_char_array::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		AttrPtr_char_array* l_Attr = new AttrPtr_char_array(*this);
+		AttrPtr_char_array* l_Attr = NEW_ATTR(AttrPtr_char_array, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -3350,11 +3350,11 @@ int txp::AttrPtr_char_array::clone(Attribute* &pTargetAttr) {
 }
 
 
-int txp::AttrPtr_array_of_char_arrays::clone(Attribute* &pTargetAttr) {
+int txp::AttrPtr_array_of_char_arrays::clone(Attribute* &pTargetAttr, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (!pTargetAttr) {
-		AttrPtr_array_of_char_arrays* l_Attr = new AttrPtr_array_of_char_arrays(*this);
+		AttrPtr_array_of_char_arrays* l_Attr = NEW_ATTR(AttrPtr_array_of_char_arrays, *this);
 		l_Attr->setAllocatedFlag(1);
 		pTargetAttr = l_Attr;
 	} else {
@@ -4639,105 +4639,105 @@ int txp::Attribute::isAttrTypeValid(const int32_t pAttrTypeValue) {
 //*****************************************************************************
 //  Building attributes (facility allocated)
 //*****************************************************************************
-int txp::Attr_char::buildAttr_char(const txp::AttributeName pName, const char& pData, Attr_char* &oAttribute) {
+int txp::Attr_char::buildAttr_char(const txp::AttributeName pName, const char& pData, Attr_char* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(Attr_char);
 }
 
 
-int txp::Attr_uint8::buildAttr_uint8(const txp::AttributeName pName, const uint8_t& pData, Attr_uint8* &oAttribute) {
+int txp::Attr_uint8::buildAttr_uint8(const txp::AttributeName pName, const uint8_t& pData, Attr_uint8* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(Attr_uint8);
 }
 
 
-int txp::Attr_uint16::buildAttr_uint16(const txp::AttributeName pName, const uint16_t& pData, Attr_uint16* &oAttribute) {
+int txp::Attr_uint16::buildAttr_uint16(const txp::AttributeName pName, const uint16_t& pData, Attr_uint16* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(Attr_uint16);
 }
 
 
-int txp::Attr_uint32::buildAttr_uint32(const txp::AttributeName pName, const uint32_t& pData, Attr_uint32* &oAttribute) {
+int txp::Attr_uint32::buildAttr_uint32(const txp::AttributeName pName, const uint32_t& pData, Attr_uint32* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(Attr_uint32);
 }
 
 
-int txp::Attr_uint64::buildAttr_uint64(const txp::AttributeName pName, const uint64_t& pData, Attr_uint64* &oAttribute) {
+int txp::Attr_uint64::buildAttr_uint64(const txp::AttributeName pName, const uint64_t& pData, Attr_uint64* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(Attr_uint64);
 }
 
 
-int txp::Attr_int8::buildAttr_int8(const txp::AttributeName pName, const int8_t& pData, Attr_int8* &oAttribute) {
+int txp::Attr_int8::buildAttr_int8(const txp::AttributeName pName, const int8_t& pData, Attr_int8* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(Attr_int8);
 }
 
 
-int txp::Attr_int16::buildAttr_int16(const txp::AttributeName pName, const int16_t& pData, Attr_int16* &oAttribute) {
+int txp::Attr_int16::buildAttr_int16(const txp::AttributeName pName, const int16_t& pData, Attr_int16* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(Attr_int16);
 }
 
 
-int txp::Attr_int32::buildAttr_int32(const txp::AttributeName pName, const int32_t& pData, Attr_int32* &oAttribute) {
+int txp::Attr_int32::buildAttr_int32(const txp::AttributeName pName, const int32_t& pData, Attr_int32* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(Attr_int32);
 }
 
 
-int txp::Attr_int64::buildAttr_int64(const txp::AttributeName pName, const int64_t& pData, Attr_int64* &oAttribute) {
+int txp::Attr_int64::buildAttr_int64(const txp::AttributeName pName, const int64_t& pData, Attr_int64* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(Attr_int64);
 }
 
 
-int txp::AttrPtr_char::buildAttrPtr_char(const txp::AttributeName pName, const char* pData, AttrPtr_char* &oAttribute) {
+int txp::AttrPtr_char::buildAttrPtr_char(const txp::AttributeName pName, const char* pData, AttrPtr_char* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(AttrPtr_char);
 }
 
 
-int txp::AttrPtr_uint8::buildAttrPtr_uint8(const txp::AttributeName pName, const uint8_t* pData, AttrPtr_uint8* &oAttribute) {
+int txp::AttrPtr_uint8::buildAttrPtr_uint8(const txp::AttributeName pName, const uint8_t* pData, AttrPtr_uint8* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(AttrPtr_uint8);
 }
 
 
-int txp::AttrPtr_uint16::buildAttrPtr_uint16(const txp::AttributeName pName, const uint16_t* pData, AttrPtr_uint16* &oAttribute) {
+int txp::AttrPtr_uint16::buildAttrPtr_uint16(const txp::AttributeName pName, const uint16_t* pData, AttrPtr_uint16* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(AttrPtr_uint16);
 }
 
 
-int txp::AttrPtr_uint32::buildAttrPtr_uint32(const txp::AttributeName pName, const uint32_t* pData, AttrPtr_uint32* &oAttribute) {
+int txp::AttrPtr_uint32::buildAttrPtr_uint32(const txp::AttributeName pName, const uint32_t* pData, AttrPtr_uint32* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(AttrPtr_uint32);
 }
 
 
-int txp::AttrPtr_uint64::buildAttrPtr_uint64(const txp::AttributeName pName, const uint64_t* pData, AttrPtr_uint64* &oAttribute) {
+int txp::AttrPtr_uint64::buildAttrPtr_uint64(const txp::AttributeName pName, const uint64_t* pData, AttrPtr_uint64* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(AttrPtr_uint64);
 }
 
 
-int txp::AttrPtr_int8::buildAttrPtr_int8(const txp::AttributeName pName, const int8_t* pData, AttrPtr_int8* &oAttribute) {
+int txp::AttrPtr_int8::buildAttrPtr_int8(const txp::AttributeName pName, const int8_t* pData, AttrPtr_int8* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(AttrPtr_int8);
 }
 
 
-int txp::AttrPtr_int16::buildAttrPtr_int16(const txp::AttributeName pName, const int16_t* pData, AttrPtr_int16* &oAttribute) {
+int txp::AttrPtr_int16::buildAttrPtr_int16(const txp::AttributeName pName, const int16_t* pData, AttrPtr_int16* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(AttrPtr_int16);
 }
 
 
-int txp::AttrPtr_int32::buildAttrPtr_int32(const txp::AttributeName pName, const int32_t* pData, AttrPtr_int32* &oAttribute) {
+int txp::AttrPtr_int32::buildAttrPtr_int32(const txp::AttributeName pName, const int32_t* pData, AttrPtr_int32* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(AttrPtr_int32);
 }
 
 
-int txp::AttrPtr_int64::buildAttrPtr_int64(const txp::AttributeName pName, const int64_t* pData, AttrPtr_int64* &oAttribute) {
+int txp::AttrPtr_int64::buildAttrPtr_int64(const txp::AttributeName pName, const int64_t* pData, AttrPtr_int64* &oAttribute, txp::AttributeSlab* pSlab) {
     BUILD_ATTR(AttrPtr_int64);
 }
 
 
-int txp::AttrPtr_char_array::buildAttrPtr_char_array(const txp::AttributeName pName, const char* pData, const size_t pLength, txp::AttrPtr_char_array* &oAttribute, const txp::COPY_DATA_OPTION pCopyDataOption) {
+int txp::AttrPtr_char_array::buildAttrPtr_char_array(const txp::AttributeName pName, const char* pData, const size_t pLength, txp::AttrPtr_char_array* &oAttribute, const txp::COPY_DATA_OPTION pCopyDataOption, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
 	if (pCopyDataOption == COPY_TO_HEAP) {
 		char* l_Temp = new char[pLength];
 		strCpy(l_Temp, pData, pLength);
-		oAttribute = new AttrPtr_char_array(pName, l_Temp, pLength);
+		oAttribute = NEW_ATTR(AttrPtr_char_array, pName, l_Temp, pLength);
 	} else {
-		oAttribute = new AttrPtr_char_array(pName, pData, pLength);
+		oAttribute = NEW_ATTR(AttrPtr_char_array, pName, pData, pLength);
 	}
 
 	if (!l_RC) {
@@ -4747,7 +4747,7 @@ int txp::AttrPtr_char_array::buildAttrPtr_char_array(const txp::AttributeName pN
 		}
 	} else {
 		if (oAttribute) {
-			delete oAttribute;
+			txp::Attribute::destroyAttr(oAttribute);
 			oAttribute = 0;
 		}
 	}
@@ -4756,16 +4756,16 @@ int txp::AttrPtr_char_array::buildAttrPtr_char_array(const txp::AttributeName pN
 }
 
 
-int txp::AttrPtr_array_of_char_arrays::buildAttrPtr_array_of_char_arrays(const txp::AttributeName pName, const txp::CharArray* pData, txp::AttrPtr_array_of_char_arrays* &oAttribute) {
+int txp::AttrPtr_array_of_char_arrays::buildAttrPtr_array_of_char_arrays(const txp::AttributeName pName, const txp::CharArray* pData, txp::AttrPtr_array_of_char_arrays* &oAttribute, txp::AttributeSlab* pSlab) {
 	int l_RC = 0;
 
-	oAttribute = new AttrPtr_array_of_char_arrays(pName, pData);
+	oAttribute = NEW_ATTR(AttrPtr_array_of_char_arrays, pName, pData);
 
 	if (!l_RC) {
 		oAttribute->setAllocatedFlag(1);
 	} else {
 		if (oAttribute) {
-			delete oAttribute;
+			txp::Attribute::destroyAttr(oAttribute);
 			oAttribute = 0;
 		}
 	}
@@ -4775,7 +4775,7 @@ int txp::AttrPtr_array_of_char_arrays::buildAttrPtr_array_of_char_arrays(const t
 
 
 //  Build an attribute from a heap buffer location
-int txp::Attribute::buildAttr(txp::HeapBuffer* pBuffer, const size_t pOffset, txp::Attribute* &oAttribute, size_t &pLength, const txp::DeserializeOption &pOption, unsigned long* pCRC) {
+int txp::Attribute::buildAttr(txp::HeapBuffer* pBuffer, const size_t pOffset, txp::Attribute* &oAttribute, size_t &pLength, const txp::DeserializeOption &pOption, unsigned long* pCRC, txp::AttributeSlab* pSlab) {
     int l_RC = 0;
 
     txp::AttributeType l_Type = pBuffer->getAttrType(pOffset);
@@ -4788,70 +4788,70 @@ int txp::Attribute::buildAttr(txp::HeapBuffer* pBuffer, const size_t pOffset, tx
                     l_RC = -419;
                     break;
                 case txp::CHAR:
-                    oAttribute = new AttrPtr_char(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_char, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::UINT8:
-                    oAttribute = new AttrPtr_uint8(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_uint8, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::UINT16:
-                    oAttribute = new AttrPtr_uint16(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_uint16, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::UINT32:
-                    oAttribute = new AttrPtr_uint32(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_uint32, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::UINT64:
-                    oAttribute = new AttrPtr_uint64(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_uint64, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::INT8:
-                    oAttribute = new AttrPtr_int8(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_int8, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::INT16:
-                    oAttribute = new AttrPtr_int16(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_int16, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::INT32:
-                    oAttribute = new AttrPtr_int32(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_int32, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::INT64:
-                    oAttribute = new AttrPtr_int64(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_int64, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::CHAR_ARRAY:
-                    oAttribute = new AttrPtr_char_array(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_char_array, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::ARRAY_OF_CHAR_ARRAYS:
-                    oAttribute = new AttrPtr_array_of_char_arrays(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_array_of_char_arrays, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::PTR_CHAR:
-                    oAttribute = new AttrPtr_char(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_char, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_UINT8:
-                    oAttribute = new AttrPtr_uint8(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_uint8, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_UINT16:
-                    oAttribute = new AttrPtr_uint16(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_uint16, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_UINT32:
-                    oAttribute = new AttrPtr_uint32(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_uint32, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_UINT64:
-                    oAttribute = new AttrPtr_uint64(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_uint64, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_INT8:
-                    oAttribute = new AttrPtr_int8(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_int8, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_INT16:
-                    oAttribute = new AttrPtr_int16(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_int16, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_INT32:
-                    oAttribute = new AttrPtr_int32(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_int32, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_INT64:
-                    oAttribute = new AttrPtr_int64(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_int64, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_CHAR_ARRAY:
-                    oAttribute = new AttrPtr_char_array(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_char_array, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_ARRAY_OF_CHAR_ARRAYS:
-                    oAttribute = new AttrPtr_array_of_char_arrays(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_array_of_char_arrays, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
 
                 default:
@@ -4867,70 +4867,70 @@ int txp::Attribute::buildAttr(txp::HeapBuffer* pBuffer, const size_t pOffset, tx
                     l_RC = -421;
                     break;
                 case txp::CHAR:
-                    oAttribute = new Attr_char(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(Attr_char, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::UINT8:
-                    oAttribute = new Attr_uint8(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(Attr_uint8, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::UINT16:
-                    oAttribute = new Attr_uint16(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(Attr_uint16, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::UINT32:
-                    oAttribute = new Attr_uint32(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(Attr_uint32, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::UINT64:
-                    oAttribute = new Attr_uint64(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(Attr_uint64, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::INT8:
-                    oAttribute = new Attr_int8(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(Attr_int8, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::INT16:
-                    oAttribute = new Attr_int16(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(Attr_int16, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::INT32:
-                    oAttribute = new Attr_int32(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(Attr_int32, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::INT64:
-                    oAttribute = new Attr_int64(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(Attr_int64, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::CHAR_ARRAY:
-                    oAttribute = new AttrPtr_char_array(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_char_array, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::ARRAY_OF_CHAR_ARRAYS:
-                    oAttribute = new AttrPtr_array_of_char_arrays(pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_array_of_char_arrays, pBuffer, pOffset, pOption, txp::BUFFER_HAS_DATA);
                     break;
                 case txp::PTR_CHAR:
-                    oAttribute = new Attr_char(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(Attr_char, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_UINT8:
-                    oAttribute = new Attr_uint8(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(Attr_uint8, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_UINT16:
-                    oAttribute = new Attr_uint16(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(Attr_uint16, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_UINT32:
-                    oAttribute = new Attr_uint32(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(Attr_uint32, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_UINT64:
-                    oAttribute = new Attr_uint64(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(Attr_uint64, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_INT8:
-                    oAttribute = new Attr_int8(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(Attr_int8, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_INT16:
-                    oAttribute = new Attr_int16(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(Attr_int16, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_INT32:
-                    oAttribute = new Attr_int32(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(Attr_int32, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_INT64:
-                    oAttribute = new Attr_int64(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(Attr_int64, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_CHAR_ARRAY:
-                    oAttribute = new AttrPtr_char_array(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_char_array, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
                 case txp::PTR_ARRAY_OF_CHAR_ARRAYS:
-                    oAttribute = new AttrPtr_array_of_char_arrays(pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
+                    oAttribute = NEW_ATTR(AttrPtr_array_of_char_arrays, pBuffer, pOffset, pOption, txp::BUFFER_HAS_PTR_TO_DATA);
                     break;
 
                 default:
@@ -4969,7 +4969,7 @@ int txp::Attribute::buildAttr(txp::HeapBuffer* pBuffer, const size_t pOffset, tx
     	}
     } else {
         if (oAttribute) {
-            delete oAttribute;
+            txp::Attribute::destroyAttr(oAttribute);
 			oAttribute = 0;
         }
     }
@@ -0,0 +1,135 @@
+/*******************************************************************************
+ |    AttributeIndex.cc
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+#include "Attribute.h"
+#include "AttributeIndex.h"
+
+namespace {
+
+struct NameLess {
+    inline bool operator()(const txp::AttributeIndex::value_type& pEntry, const txp::AttributeName pName) const {
+        return pEntry.first < pName;
+    }
+};
+
+} // namespace
+
+
+//*****************************************************************************
+//  Constructors
+//*****************************************************************************
+txp::AttributeIndex::AttributeIndex() :
+    sorted(inlineSorted),
+    ordered(inlineOrdered),
+    count(0),
+    capacity(INLINE_CAPACITY) {
+}
+
+
+//*****************************************************************************
+//  Destructor
+//*****************************************************************************
+txp::AttributeIndex::~AttributeIndex() {
+    if (sorted != inlineSorted) {
+        delete[] sorted;
+        delete[] ordered;
+    }
+}
+
+
+//*****************************************************************************
+//  Non-static methods
+//*****************************************************************************
+txp::Attribute*& txp::AttributeIndex::at(const txp::AttributeName pName) {
+    iterator it = find(pName);
+    if (it == end()) {
+        throw std::out_of_range("txp::AttributeIndex::at");
+    }
+
+    return it->second;
+}
+
+
+txp::AttributeIndex::iterator txp::AttributeIndex::find(const txp::AttributeName pName) {
+    // NOTE:  Most messages carry a handful of attributes, where a linear
+    //        scan of the inline storage beats a binary search.
+    if (count <= 8) {
+        for (iterator it = sorted; it != end(); ++it) {
+            if (it->first >= pName) {
+                return (it->first == pName ? it : end());
+            }
+        }
+        return end();
+    }
+
+    iterator it = std::lower_bound(sorted, end(), pName, NameLess());
+    if (it != end() && it->first == pName) {
+        return it;
+    }
+
+    return end();
+}
+
+
+int txp::AttributeIndex::grow() {
+    size_t l_Capacity = capacity * 2;
+    value_type* l_Sorted = new(std::nothrow) value_type[l_Capacity];
+    txp::Attribute** l_Ordered = new(std::nothrow) txp::Attribute*[l_Capacity];
+    if (!l_Sorted || !l_Ordered) {
+        delete[] l_Sorted;
+        delete[] l_Ordered;
+        return -2;
+    }
+
+    std::copy(sorted, sorted + count, l_Sorted);
+    std::copy(ordered, ordered + count, l_Ordered);
+    if (sorted != inlineSorted) {
+        delete[] sorted;
+        delete[] ordered;
+    }
+    sorted = l_Sorted;
+    ordered = l_Ordered;
+    capacity = l_Capacity;
+
+    return 0;
+}
+
+
+int txp::AttributeIndex::insert(txp::Attribute* pAttribute) {
+    txp::AttributeName l_Name = pAttribute->getAttrName();
+
+    iterator it = std::lower_bound(sorted, end(), l_Name, NameLess());
+    if (it != end() && it->first == l_Name) {
+        return -1;
+    }
+
+    if (count == capacity) {
+        size_t l_Position = it - sorted;
+        if (grow()) {
+            return -2;
+        }
+        it = sorted + l_Position;
+    }
+
+    std::copy_backward(it, end(), end() + 1);
+    *it = value_type(l_Name, pAttribute);
+    ordered[count] = pAttribute;
+    ++count;
+
+    return 0;
+}
+
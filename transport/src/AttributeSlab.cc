@@ -0,0 +1,72 @@
+/*******************************************************************************
+ |    AttributeSlab.cc
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#include "AttributeSlab.h"
+#include "ObjectPool.h"
+
+namespace {
+
+inline size_t roundUp(const size_t pSize) {
+    return (pSize + txp::AttributeSlab::ALIGNMENT - 1) & ~(txp::AttributeSlab::ALIGNMENT - 1);
+}
+
+} // namespace
+
+
+//*****************************************************************************
+//  Constructors
+//*****************************************************************************
+txp::AttributeSlab::AttributeSlab() :
+    next(inlineStorage),
+    limit(inlineStorage + INLINE_SIZE),
+    chunks(0) {
+}
+
+
+//*****************************************************************************
+//  Destructor
+//*****************************************************************************
+txp::AttributeSlab::~AttributeSlab() {
+    while (chunks) {
+        Chunk* l_Chunk = chunks;
+        chunks = l_Chunk->next;
+        txp::ObjectPool::release(l_Chunk, l_Chunk->size);
+    }
+}
+
+
+//*****************************************************************************
+//  Non-static methods
+//*****************************************************************************
+void* txp::AttributeSlab::allocate(const size_t pSize) {
+    size_t l_Size = roundUp(pSize);
+
+    if ((size_t)(limit - next) < l_Size) {
+        // NOTE:  An attribute larger than a chunk gets a chunk of its own...
+        size_t l_ChunkSize = roundUp(sizeof(Chunk)) + l_Size;
+        if (l_ChunkSize < CHUNK_SIZE) {
+            l_ChunkSize = CHUNK_SIZE;
+        }
+        Chunk* l_Chunk = (Chunk*)txp::ObjectPool::allocate(l_ChunkSize);
+        l_Chunk->next = chunks;
+        l_Chunk->size = l_ChunkSize;
+        chunks = l_Chunk;
+        next = (char*)l_Chunk + roundUp(sizeof(Chunk));
+        limit = (char*)l_Chunk + l_ChunkSize;
+    }
+
+    void* l_Storage = next;
+    next += l_Size;
+
+    return l_Storage;
+}
@@ -12,6 +12,8 @@
  *******************************************************************************/
 
 #include <limits.h>
+#include <new>
+#include <pthread.h>
 #include <stdio.h>
 #include <unistd.h>
 
@@ -101,6 +103,20 @@ unsigned long txp::Msg::CRC_Value = 0;
 
 int16_t txp::initPerformed = 0;
 
+namespace {
+
+// NOTE:  The free-list of Msg() objects is shared by all threads.  Messages are
+//        commonly built on one thread and deleted on another...
+struct FreeMsg {
+    FreeMsg* next;
+};
+
+FreeMsg*        freeMsgs = 0;
+size_t          numberOfFreeMsgs = 0;
+pthread_mutex_t freeMsgsMutex = PTHREAD_MUTEX_INITIALIZER;
+
+} // namespace
+
 
 //*****************************************************************************
 //  Non-Msg() related static methods
@@ -341,9 +357,6 @@ txp::Msg::Msg() :
     msgHeapBuffer(0),
     msg_IO_Vector(0)
 {
-    msgAttrMap = new std::map<txp::AttributeName, txp::Attribute*>;
-    msgAttributes = new std::vector<Attribute*>;
-    msgAttributes->reserve(txp::MAXIMUM_NUMBER_OF_ATTRIBUTES);
 #if MSG_STALE_CHECK
     addMsg2map(this);
 #endif
@@ -375,9 +388,6 @@ txp::Msg::Msg(const txp::Id pId) :
     msgHeapBuffer(0),
     msg_IO_Vector(0)
 {
-    msgAttrMap = new std::map<txp::AttributeName, txp::Attribute*>;
-    msgAttributes = new std::vector<Attribute*>;
-    msgAttributes->reserve(txp::MAXIMUM_NUMBER_OF_ATTRIBUTES);
 #if MSG_STALE_CHECK
     addMsg2map(this);
 #endif
@@ -411,9 +421,6 @@ txp::Msg::Msg(const txp::Id pId, Version pVersion) :
     msgHeapBuffer(0),
     msg_IO_Vector(0)
 {
-    msgAttrMap = new std::map<txp::AttributeName, txp::Attribute*>;
-    msgAttributes = new std::vector<Attribute*>;
-    msgAttributes->reserve(txp::MAXIMUM_NUMBER_OF_ATTRIBUTES);
 #if MSG_STALE_CHECK
     addMsg2map(this);
 #endif
@@ -455,9 +462,6 @@ txp::Msg::Msg(HeapBuffer* pHeapBuffer) :
     msgHeapBuffer(0),
     msg_IO_Vector(0)
 {
-    msgAttrMap = new std::map<txp::AttributeName, txp::Attribute*>;
-    msgAttributes = new std::vector<Attribute*>;
-    msgAttributes->reserve(txp::MAXIMUM_NUMBER_OF_ATTRIBUTES);
 #if MSG_STALE_CHECK
     addMsg2map(this);
 #endif
@@ -489,9 +493,6 @@ txp::Msg::Msg(txp::Id pId, int32_t pRequestMsgNumber, txp::Version pVersion, pid
     msgHeapBuffer(0),
     msg_IO_Vector(0)
 {
-    msgAttrMap = new std::map<txp::AttributeName, txp::Attribute*>;
-    msgAttributes = new std::vector<Attribute*>;
-    msgAttributes->reserve(txp::MAXIMUM_NUMBER_OF_ATTRIBUTES);
 #if MSG_STALE_CHECK
     addMsg2map(this);
 #endif
@@ -569,23 +570,11 @@ txp::Msg::Msg(const Msg &pMsg) {
     //        the addAttribute() method below.
     msg_IO_Vector=0;
 
-    // NOTE:  The attribute map is not copied and will be populated with
-    //        the addAttribute() method below.
-    msgAttrMap = new std::map<txp::AttributeName, txp::Attribute*>;
-
-    // NOTE:  All attributes are copied as they are in the source message.
-    //        addAttribute also populates the map of attributes.
-    if (pMsg.msgAttributes)
+    // NOTE:  All attributes are copied as they are in the source message,
+    //        in the order they were added to the source message.
+    for(Attribute* const* it = pMsg.msgAttributes.orderBegin(); it != pMsg.msgAttributes.orderEnd(); ++it)
     {
-        for(std::vector<Attribute*>::iterator it = pMsg.msgAttributes->begin(); it != pMsg.msgAttributes->end(); ++it)
-        {
-            addAttribute(*it);
-        }
-    }
-    else
-    {
-        msgAttributes = new std::vector<Attribute*>;
-        msgAttributes->reserve(txp::MAXIMUM_NUMBER_OF_ATTRIBUTES);
+        addAttribute(*it);
     }
 
 #ifdef TXP_DEVELOPMENT
@@ -608,7 +597,7 @@ txp::Msg::~Msg() {
     char l_MsgId[64] = {'\0'};
     msgIdToChar(getMsgId(), l_MsgId, sizeof(l_MsgId));
     d_log.write("===  Start dtor  ===============================================================", txp::Log::DEBUG, txp::Log::C_DTOR_LOGLEVEL);
-    snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg::~Msg()=%p, %s, msgNumber=%d, msgHeapBuffer=%p, msg_IO_Vector=%p, msgAttrMap=%p, msgAttributes=%p", this, l_MsgId, msgNumber, msgHeapBuffer, msg_IO_Vector, msgAttrMap, msgAttributes);
+    snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg::~Msg()=%p, %s, msgNumber=%d, msgHeapBuffer=%p, msg_IO_Vector=%p, #Attrs=%lu", this, l_MsgId, msgNumber, msgHeapBuffer, msg_IO_Vector, msgAttributes.size());
     d_log.write(d_log_buffer, txp::Log::DEBUG, txp::Log::C_DTOR_LOGLEVEL);
 #endif
 #if MSG_STALE_CHECK
@@ -616,44 +605,26 @@ txp::Msg::~Msg() {
 #endif
     freeHeapBuffer();
 
-    // NOTE:  Everything in msgAttrMap points to data in msgAttributes.
-    //        Therefore, nothing specifically needs to be deleted related
-    //        to delete related to the map.
-
     if (msg_IO_Vector) {
         struct iovec* l_Temp_IO_Vector = msg_IO_Vector;
         msg_IO_Vector = 0;
         delete l_Temp_IO_Vector;
     }
 
-    if (msgAttrMap) {
-        std::map<txp::AttributeName, txp::Attribute*>* l_TempAttrMap = msgAttrMap;
-        msgAttrMap = 0;
-        delete l_TempAttrMap;
-    }
-
-    if (msgAttributes) {
-        Attribute* l_AttrPtr;
-        while (!msgAttributes->empty()) {
-            l_AttrPtr = msgAttributes->back();
-            if (l_AttrPtr->isAllocated()) {
-                l_AttrPtr->setAllocatedFlag(0);
-                Attribute* l_TempAttr = l_AttrPtr;
-                l_AttrPtr = 0;
-                delete l_TempAttr;
-            }
-            else
-            {
+    for(Attribute** it = msgAttributes.orderBegin(); it != msgAttributes.orderEnd(); ++it) {
+        Attribute* l_AttrPtr = *it;
+        if (l_AttrPtr->isAllocated()) {
+            l_AttrPtr->setAllocatedFlag(0);
+            txp::Attribute::destroyAttr(l_AttrPtr);
+        }
+        else
+        {
 #ifdef TXP_DEVELOPMENT
-                l_AttrPtr->dump(d_log, "~Msg: Attribute not owned and not deleted");
+            l_AttrPtr->dump(d_log, "~Msg: Attribute not owned and not deleted");
 #endif
-            }
-            msgAttributes->pop_back();
         }
-        std::vector<Attribute*>* l_TempMsgAttrs = msgAttributes;
-        msgAttributes = 0;
-        delete l_TempMsgAttrs;
     }
+    msgAttributes.clear();
 #ifdef TXP_DEVELOPMENT
     d_log.write("===    End dtor  ===============================================================", txp::Log::DEBUG, txp::Log::C_DTOR_LOGLEVEL);
 #endif
@@ -663,6 +634,52 @@ txp::Msg::~Msg() {
 //*****************************************************************************
 //  Static methods
 //*****************************************************************************
+void* txp::Msg::operator new(size_t pSize) {
+    void* l_Msg = 0;
+
+    if (pSize == sizeof(txp::Msg)) {
+        pthread_mutex_lock(&freeMsgsMutex);
+        if (freeMsgs) {
+            l_Msg = freeMsgs;
+            freeMsgs = freeMsgs->next;
+            --numberOfFreeMsgs;
+        }
+        pthread_mutex_unlock(&freeMsgsMutex);
+    }
+
+    if (!l_Msg) {
+        l_Msg = ::operator new(pSize);
+    }
+
+    return l_Msg;
+}
+
+
+void txp::Msg::operator delete(void* pMsg, size_t pSize) {
+    if (!pMsg) {
+        return;
+    }
+
+    if (pSize == sizeof(txp::Msg)) {
+        FreeMsg* l_Msg = (FreeMsg*)pMsg;
+        pthread_mutex_lock(&freeMsgsMutex);
+        if (numberOfFreeMsgs < MAXIMUM_FREE_MSGS) {
+            l_Msg->next = freeMsgs;
+            freeMsgs = l_Msg;
+            ++numberOfFreeMsgs;
+            pMsg = 0;
+        }
+        pthread_mutex_unlock(&freeMsgsMutex);
+    }
+
+    if (pMsg) {
+        ::operator delete(pMsg);
+    }
+
+    return;
+}
+
+
 int txp::Msg::buildMsg(const txp::Id pId, txp::Msg* &oMsg) {
     int l_RC = 0;
 
@@ -856,7 +873,7 @@ int txp::Msg::deserializeToMsg(txp::Msg* &oMsg, HeapBuffer* pHeapBuffer, const t
                             while (l_Offset<l_MsgLength && l_RC == 0) {
                                 l_Attr = 0;
                                 l_AttrLength = 0;
-                                l_RC = txp::Attribute::buildAttr(pHeapBuffer, l_Offset, l_Attr, l_AttrLength, pOption, l_PtrCalcMsgCRC);
+                                l_RC = txp::Attribute::buildAttr(pHeapBuffer, l_Offset, l_Attr, l_AttrLength, pOption, l_PtrCalcMsgCRC, &oMsg->msgAttributeSlab);
                                 if (!l_RC) {
                                     l_RC = oMsg->addAttribute(l_Attr);
                                     l_Offset += l_AttrLength;
@@ -865,7 +882,7 @@ int txp::Msg::deserializeToMsg(txp::Msg* &oMsg, HeapBuffer* pHeapBuffer, const t
                                 // If the add failed, delete the attribute...
                                 if (l_RC && l_Attr)
                                 {
-                                    delete l_Attr;
+                                    txp::Attribute::destroyAttr(l_Attr);
                                 }
                             }
 
@@ -1063,122 +1080,93 @@ int txp::Msg::addAttribute(Attribute* pAttribute) {
     int l_RC = 0;
 
     txp::Attribute* l_AttrPtr = 0;
-    //  If this is the first attribute to be added,
-    //  get space for the vector and map...
-    //  NOTE:  Either both pointers should be null or non-null.
-    //         Should we verify that the two pointers are consistent.  @@DLH
-    if (!msgAttrMap) {
-        msgAttrMap = new std::map<txp::AttributeName, txp::Attribute*>;
-    }
-
-    if (msgAttrMap) {
-        if (!msgAttributes) {
-            msgAttributes = new std::vector<Attribute*>;
-            msgAttributes->reserve(txp::MAXIMUM_NUMBER_OF_ATTRIBUTES);
-        }
+    // First, prevent more than the maximum number of attributes from being added...
+    if (msgAttributes.size() < txp::MAXIMUM_NUMBER_OF_ATTRIBUTES) {
+        // Second, prevent the attribute from being added a second time...
+        txp::AttributeName l_AttrName = pAttribute->getAttrName();
+        l_AttrPtr = retrieveAttr(l_AttrName);
+        if (!l_AttrPtr) {
+            // Next, if the client created the attribute, make a copy of it.
+            // Insert the attribute into the index...
+            // NOTE:  If the client created the attribute we copy it so they
+            //        can free the storage for that attribute.  However, for
+            //        those attributes with char arrays, storage for those
+            //        arrays cannot be freed until all processing of the message
+            //        is complete.  The char arrays are NOT copied, but referenced
+            //        by the copied attribute.
+            // NOTE:  Similar to above, if the attribute has already been added to
+            //        a message, the attribute will be cloned first before adding the
+            //        cloned attribute to the second message.  In the case where
+            //        an attribute is owned by the message facility, cloning the
+            //        message first prevents a double free for the attribute
+            //        when the message destructors are run.
+            if (pAttribute->isAllocated() && (!pAttribute->isAddedToMsg())) {
+                l_AttrPtr = pAttribute;
+            } else {
+                l_RC = pAttribute->clone(l_AttrPtr, &msgAttributeSlab);
+            }
 
-        if (msgAttributes) {
-            // First, prevent more than the maximum number of attributes from being added...
-            if (msgAttributes->size() < txp::MAXIMUM_NUMBER_OF_ATTRIBUTES) {
-                // Second, prevent the attribute from being added a second time...
-                txp::AttributeName l_AttrName = pAttribute->getAttrName();
-                l_AttrPtr = retrieveAttr(l_AttrName);
-                if (!l_AttrPtr) {
-                    // Next, if the client created the attribute, make a copy of it.
-                    // Insert the attribute into the vector...
-                    // NOTE:  If the client created the attribute we copy it so they
-                    //        can free the storage for that attribute.  However, for
-                    //        those attributes with char arrays, storage for those
-                    //        arrays cannot be freed until all processing of the message
-                    //        is complete.  The char arrays are NOT copied, but referenced
-                    //        by the copied attribute.
-                    // NOTE:  Similar to above, if the attribute has already been added to
-                    //        a message, the attribute will be cloned first before adding the
-                    //        cloned attribute to the second message.  In the case where
-                    //        an attribute is owned by the message facility, cloning the
-                    //        message first prevents a double free for the attribute
-                    //        when the message destructors are run.
-                    if (pAttribute->isAllocated() && (!pAttribute->isAddedToMsg())) {
-                        l_AttrPtr = pAttribute;
+            if (!l_RC) {
+                // Insert the attribute in the index...
+                if (!msgAttributes.insert(l_AttrPtr)) {
+                    // None of the containers keeping attribute data is now current...
+                    msgState.setHeapBufferIsCurrentFlag(0);
+                    msgState.setIO_VectorIsCurrentFlag(0);
+
+                    // NOTE:  We calculate three message buffer lengths:
+                    //        1) One is the message length if all data values are copied to the buffer.
+                    //        2) The second is the length if those attributes that use pointer indirection
+                    //           copy those pointers instead of the actual data value.
+                    //        3) The third is the same as the second, except for any non-array attributes
+                    //           that use pointer indirection.  The lengths for those non-array attributes
+                    //           are calculated assuming that the data value will be copied to the buffer.
+                    //        @@DLH
+                    msgLengthWithDataValues += l_AttrPtr->getLengthOfValueInBuffer();
+                    msgLengthWithPtrValues += l_AttrPtr->getLengthInBuffer();
+                    if (l_AttrPtr->isPtrToArrayAttrType()) {
+                        msgLengthWithDataValuesExceptForArrays += l_AttrPtr->getLengthInBuffer();
                     } else {
-                        l_RC = pAttribute->clone(l_AttrPtr);
+                        msgLengthWithDataValuesExceptForArrays += l_AttrPtr->getLengthOfValueInBuffer();
                     }
 
-                    if (!l_RC) {
-                        msgAttributes->push_back(l_AttrPtr);
-
-                        // None of the containers keeping attribute data is now current...
-                        msgState.setHeapBufferIsCurrentFlag(0);
-                        msgState.setIO_VectorIsCurrentFlag(0);
-
-                        // NOTE:  We calculate three message buffer lengths:
-                        //        1) One is the message length if all data values are copied to the buffer.
-                        //        2) The second is the length if those attributes that use pointer indirection
-                        //           copy those pointers instead of the actual data value.
-                        //        3) The third is the same as the second, except for any non-array attributes
-                        //           that use pointer indirection.  The lengths for those non-array attributes
-                        //           are calculated assuming that the data value will be copied to the buffer.
-                        //        @@DLH
-                        msgLengthWithDataValues += l_AttrPtr->getLengthOfValueInBuffer();
-                        msgLengthWithPtrValues += l_AttrPtr->getLengthInBuffer();
-                        if (l_AttrPtr->isPtrToArrayAttrType()) {
-                            msgLengthWithDataValuesExceptForArrays += l_AttrPtr->getLengthInBuffer();
-                        } else {
-                            msgLengthWithDataValuesExceptForArrays += l_AttrPtr->getLengthOfValueInBuffer();
-                        }
-
-                        // Finally, insert the attribute in the map...
-                        std::pair<std::map<txp::AttributeName, Attribute*>::iterator,bool> l_Return;
-                        l_Return = msgAttrMap->insert(std::make_pair(l_AttrPtr->getAttrName(), l_AttrPtr));
-                        if (!l_Return.second) {
-                            l_RC = -12;
-#ifdef TXP_DEVELOPMENT
-                            snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg::addAttribute(l_AttrPtr=%p): AttributeName=%d, RC=%d, msgLengthWithDataValues=%zu, msgLengthWithPtrValues=%zu, msgLengthWithDataValuesExceptForArrays=%zu", l_AttrPtr, l_AttrPtr->getAttrName(), l_RC, msgLengthWithDataValues, msgLengthWithPtrValues, msgLengthWithDataValuesExceptForArrays);
-                            txp::Msg::d_log.write(d_log_buffer, txp::Log::ERROR);
-#endif
-                        }
-
-                        // Indicate this attribute has been added to a message
-                        l_AttrPtr->setAddedToMsg(1);
-                    } else {
-                        l_RC = -45;
-                    }
+                    // Indicate this attribute has been added to a message
+                    l_AttrPtr->setAddedToMsg(1);
                 } else {
-                    l_RC = -30;
+                    l_RC = -34;
 #ifdef TXP_DEVELOPMENT
-                    char l_AttrName[64] = {'\0'};
-                    txp::Attribute::attrNameToChar(l_AttrPtr->getAttrName(), l_AttrName, sizeof(l_AttrName));
-                    char l_AttrType[64] = {'\0'};
-                    txp::Attribute::attrTypeToChar(l_AttrPtr->getAttrType(), l_AttrType, sizeof(l_AttrType));
-                    snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg::addAttribute(l_AttrPtr=%p): AttributeName=%d, RC=%d, msg with attribute name of %s already exsits. Existing attr at %p, type=%s, length of value in buffer=%zu", l_AttrPtr, l_AttrPtr->getAttrName(), l_RC, l_AttrName, l_AttrPtr, l_AttrType, l_AttrPtr->getLengthOfValueInBuffer());
+                    snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg::addAttribute(l_AttrPtr=%p): AttributeName=%d, RC=%d, msg attribute index could not be extended", l_AttrPtr, l_AttrPtr->getAttrName(), l_RC);
                     txp::Msg::d_log.write(d_log_buffer, txp::Log::ERROR);
 #endif
+                    if (l_AttrPtr != pAttribute) {
+                        txp::Attribute::destroyAttr(l_AttrPtr);
+                        l_AttrPtr = 0;
+                    }
                 }
             } else {
-                l_RC = -44;
-#ifdef TXP_DEVELOPMENT
-                snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg::addAttribute(l_AttrPtr=%p): AttributeName=%d, RC=%d, maximum number of attributes (%zu) already added", l_AttrPtr, l_AttrPtr->getAttrName(), l_RC, txp::MAXIMUM_NUMBER_OF_ATTRIBUTES);
-                txp::Msg::d_log.write(d_log_buffer, txp::Log::ERROR);
-#endif
+                l_RC = -45;
             }
         } else {
-            l_RC = -34;
+            l_RC = -30;
 #ifdef TXP_DEVELOPMENT
-            snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg::addAttribute(l_AttrPtr=%p): AttributeName=%d, RC=%d, msg attributes vector could not be created", l_AttrPtr, l_AttrPtr->getAttrName(), l_RC);
+            char l_AttrName[64] = {'\0'};
+            txp::Attribute::attrNameToChar(l_AttrPtr->getAttrName(), l_AttrName, sizeof(l_AttrName));
+            char l_AttrType[64] = {'\0'};
+            txp::Attribute::attrTypeToChar(l_AttrPtr->getAttrType(), l_AttrType, sizeof(l_AttrType));
+            snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg::addAttribute(l_AttrPtr=%p): AttributeName=%d, RC=%d, msg with attribute name of %s already exsits. Existing attr at %p, type=%s, length of value in buffer=%zu", l_AttrPtr, l_AttrPtr->getAttrName(), l_RC, l_AttrName, l_AttrPtr, l_AttrType, l_AttrPtr->getLengthOfValueInBuffer());
             txp::Msg::d_log.write(d_log_buffer, txp::Log::ERROR);
 #endif
         }
     } else {
-        l_RC = -35;
+        l_RC = -44;
 #ifdef TXP_DEVELOPMENT
-        snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg::addAttribute(l_AttrPtr=%p): AttributeName=%d, RC=%d, msg attribute map could not be created", l_AttrPtr, l_AttrPtr->getAttrName(), l_RC);
+        snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg::addAttribute(l_AttrPtr=%p): AttributeName=%d, RC=%d, maximum number of attributes (%zu) already added", l_AttrPtr, l_AttrPtr->getAttrName(), l_RC, txp::MAXIMUM_NUMBER_OF_ATTRIBUTES);
         txp::Msg::d_log.write(d_log_buffer, txp::Log::ERROR);
 #endif
     }
 
 #ifdef TXP_DEVELOPMENT
     if (!l_RC) {
-        snprintf(d_log_buffer, sizeof(d_log_buffer), "Attribute %p number %lu added to msg %p", l_AttrPtr, msgAttributes->size(), this);
+        snprintf(d_log_buffer, sizeof(d_log_buffer), "Attribute %p number %lu added to msg %p", l_AttrPtr, msgAttributes.size(), this);
         l_AttrPtr->dump(d_log, d_log_buffer);
     }
 #endif
@@ -1190,7 +1178,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const char& pData) {
     int l_RC = 0;
 
     Attr_char* l_Attr = 0;
-    l_RC = txp::Attr_char::buildAttr_char(pName, pData, l_Attr);
+    l_RC = txp::Attr_char::buildAttr_char(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1199,7 +1187,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const char& pData) {
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1210,7 +1198,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint8_t& pData)
     int l_RC = 0;
 
     Attr_uint8* l_Attr = 0;
-    l_RC = txp::Attr_uint8::buildAttr_uint8(pName, pData, l_Attr);
+    l_RC = txp::Attr_uint8::buildAttr_uint8(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1219,7 +1207,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint8_t& pData)
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1230,7 +1218,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint16_t& pData
     int l_RC = 0;
 
     Attr_uint16* l_Attr = 0;
-    l_RC = txp::Attr_uint16::buildAttr_uint16(pName, pData, l_Attr);
+    l_RC = txp::Attr_uint16::buildAttr_uint16(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1239,7 +1227,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint16_t& pData
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1250,7 +1238,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint32_t& pData
     int l_RC = 0;
 
     Attr_uint32* l_Attr = 0;
-    l_RC = txp::Attr_uint32::buildAttr_uint32(pName, pData, l_Attr);
+    l_RC = txp::Attr_uint32::buildAttr_uint32(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1259,7 +1247,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint32_t& pData
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1270,7 +1258,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint64_t& pData
     int l_RC = 0;
 
     Attr_uint64* l_Attr = 0;
-    l_RC = txp::Attr_uint64::buildAttr_uint64(pName, pData, l_Attr);
+    l_RC = txp::Attr_uint64::buildAttr_uint64(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1279,7 +1267,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint64_t& pData
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1290,7 +1278,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int8_t& pData)
     int l_RC = 0;
 
     Attr_int8* l_Attr = 0;
-    l_RC = txp::Attr_int8::buildAttr_int8(pName, pData, l_Attr);
+    l_RC = txp::Attr_int8::buildAttr_int8(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1299,7 +1287,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int8_t& pData)
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1310,7 +1298,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int16_t& pData)
     int l_RC = 0;
 
     Attr_int16* l_Attr = 0;
-    l_RC = txp::Attr_int16::buildAttr_int16(pName, pData, l_Attr);
+    l_RC = txp::Attr_int16::buildAttr_int16(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1319,7 +1307,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int16_t& pData)
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1330,7 +1318,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int32_t& pData)
     int l_RC = 0;
 
     Attr_int32* l_Attr = 0;
-    l_RC = txp::Attr_int32::buildAttr_int32(pName, pData, l_Attr);
+    l_RC = txp::Attr_int32::buildAttr_int32(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1339,7 +1327,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int32_t& pData)
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1350,7 +1338,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int64_t& pData)
     int l_RC = 0;
 
     Attr_int64* l_Attr = 0;
-    l_RC = txp::Attr_int64::buildAttr_int64(pName, pData, l_Attr);
+    l_RC = txp::Attr_int64::buildAttr_int64(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1359,7 +1347,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int64_t& pData)
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1370,7 +1358,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const char* pData) {
     int l_RC = 0;
 
     AttrPtr_char* l_Attr = 0;
-    l_RC = txp::AttrPtr_char::buildAttrPtr_char(pName, pData, l_Attr);
+    l_RC = txp::AttrPtr_char::buildAttrPtr_char(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1383,7 +1371,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const char* pData) {
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1394,7 +1382,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint8_t* pData)
     int l_RC = 0;
 
     AttrPtr_uint8* l_Attr = 0;
-    l_RC = txp::AttrPtr_uint8::buildAttrPtr_uint8(pName, pData, l_Attr);
+    l_RC = txp::AttrPtr_uint8::buildAttrPtr_uint8(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1406,7 +1394,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint8_t* pData)
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1417,7 +1405,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint16_t* pData
     int l_RC = 0;
 
     AttrPtr_uint16* l_Attr = 0;
-    l_RC = txp::AttrPtr_uint16::buildAttrPtr_uint16(pName, pData, l_Attr);
+    l_RC = txp::AttrPtr_uint16::buildAttrPtr_uint16(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1429,7 +1417,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint16_t* pData
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1440,7 +1428,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint32_t* pData
     int l_RC = 0;
 
     AttrPtr_uint32* l_Attr = 0;
-    l_RC = txp::AttrPtr_uint32::buildAttrPtr_uint32(pName, pData, l_Attr);
+    l_RC = txp::AttrPtr_uint32::buildAttrPtr_uint32(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1452,7 +1440,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint32_t* pData
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1463,7 +1451,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint64_t* pData
     int l_RC = 0;
 
     AttrPtr_uint64* l_Attr = 0;
-    l_RC = txp::AttrPtr_uint64::buildAttrPtr_uint64(pName, pData, l_Attr);
+    l_RC = txp::AttrPtr_uint64::buildAttrPtr_uint64(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1475,7 +1463,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const uint64_t* pData
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1486,7 +1474,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int8_t* pData)
     int l_RC = 0;
 
     AttrPtr_int8* l_Attr = 0;
-    l_RC = txp::AttrPtr_int8::buildAttrPtr_int8(pName, pData, l_Attr);
+    l_RC = txp::AttrPtr_int8::buildAttrPtr_int8(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1498,7 +1486,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int8_t* pData)
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1509,7 +1497,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int16_t* pData)
     int l_RC = 0;
 
     AttrPtr_int16* l_Attr = 0;
-    l_RC = txp::AttrPtr_int16::buildAttrPtr_int16(pName, pData, l_Attr);
+    l_RC = txp::AttrPtr_int16::buildAttrPtr_int16(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1521,7 +1509,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int16_t* pData)
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1532,7 +1520,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int32_t* pData)
     int l_RC = 0;
 
     AttrPtr_int32* l_Attr = 0;
-    l_RC = txp::AttrPtr_int32::buildAttrPtr_int32(pName, pData, l_Attr);
+    l_RC = txp::AttrPtr_int32::buildAttrPtr_int32(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1544,7 +1532,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int32_t* pData)
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1555,7 +1543,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int64_t* pData)
     int l_RC = 0;
 
     AttrPtr_int64* l_Attr = 0;
-    l_RC = txp::AttrPtr_int64::buildAttrPtr_int64(pName, pData, l_Attr);
+    l_RC = txp::AttrPtr_int64::buildAttrPtr_int64(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1567,7 +1555,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const int64_t* pData)
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1578,7 +1566,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const char* pData, co
     int l_RC = 0;
 
     AttrPtr_char_array* l_Attr = 0;
-    l_RC = txp::AttrPtr_char_array::buildAttrPtr_char_array(pName, pData, pLength, l_Attr, pCopyDataOption);
+    l_RC = txp::AttrPtr_char_array::buildAttrPtr_char_array(pName, pData, pLength, l_Attr, pCopyDataOption, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1587,7 +1575,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const char* pData, co
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1598,7 +1586,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const txp::CharArray*
     int l_RC = 0;
 
     AttrPtr_array_of_char_arrays* l_Attr = 0;
-    l_RC = txp::AttrPtr_array_of_char_arrays::buildAttrPtr_array_of_char_arrays(pName, pData, l_Attr);
+    l_RC = txp::AttrPtr_array_of_char_arrays::buildAttrPtr_array_of_char_arrays(pName, pData, l_Attr, &msgAttributeSlab);
     if (!l_RC) {
         l_Attr->setAllocatedFlag(1);
         l_RC = this->addAttribute(l_Attr);
@@ -1607,7 +1595,7 @@ int txp::Msg::addAttribute(const txp::AttributeName pName, const txp::CharArray*
     // If the add failed, delete the attribute...
     if (l_RC && l_Attr)
     {
-        delete l_Attr;
+        txp::Attribute::destroyAttr(l_Attr);
     }
 
     return l_RC;
@@ -1639,7 +1627,7 @@ int txp::Msg::allocateHeapBuffer(const size_t pSize) {
 #ifdef TXP_DEVELOPMENT
             char l_MsgId[64] = {'\0'};
             msgIdToChar(getMsgId(), l_MsgId, sizeof(l_MsgId));
-            snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg(%p) HB(%p), DB(%p), %s, Msg#=%d, #Attrs=%lu, RC=%d", this, msgHeapBuffer, msgHeapBuffer->getDataBufferPtr(), l_MsgId, msgNumber, (msgAttrMap ? msgAttrMap->size() : 0), l_RC);
+            snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg(%p) HB(%p), DB(%p), %s, Msg#=%d, #Attrs=%lu, RC=%d", this, msgHeapBuffer, msgHeapBuffer->getDataBufferPtr(), l_MsgId, msgNumber, msgAttributes.size(), l_RC);
             d_log.write(d_log_buffer, txp::Log::DEBUG);
 #endif
         } else {
@@ -1673,7 +1661,7 @@ int txp::Msg::allocateHeapBuffer(char* pDataBuffer, const size_t pDataBufferSize
 #ifdef TXP_DEVELOPMENT
             char l_MsgId[64] = {'\0'};
             msgIdToChar(getMsgId(), l_MsgId, sizeof(l_MsgId));
-            snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg(%p) associated with heap buffer(%p), RC=%d, %s, %lu attributes, existing data buffer=%p", this, msgHeapBuffer, l_RC, l_MsgId, (msgAttrMap ? msgAttrMap->size() : 0), msgHeapBuffer->getDataBufferPtr());
+            snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg(%p) associated with heap buffer(%p), RC=%d, %s, %lu attributes, existing data buffer=%p", this, msgHeapBuffer, l_RC, l_MsgId, msgAttributes.size(), msgHeapBuffer->getDataBufferPtr());
             d_log.write(d_log_buffer, txp::Log::DEBUG);
 #endif
         } else {
@@ -1705,7 +1693,7 @@ int txp::Msg::associateHeapBuffer(HeapBuffer* pHeapBuffer) {
 #ifdef TXP_DEVELOPMENT
         char l_MsgId[64] = {'\0'};
         msgIdToChar(getMsgId(), l_MsgId, sizeof(l_MsgId));
-        snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg(%p) associated with heap buffer(%p), RC=%d, %s, %lu attributes, existing data buffer=%p", this, msgHeapBuffer, l_RC, l_MsgId, (msgAttrMap ? msgAttrMap->size() : 0), msgHeapBuffer->getDataBufferPtr());
+        snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg(%p) associated with heap buffer(%p), RC=%d, %s, %lu attributes, existing data buffer=%p", this, msgHeapBuffer, l_RC, l_MsgId, msgAttributes.size(), msgHeapBuffer->getDataBufferPtr());
         d_log.write(d_log_buffer, txp::Log::DEBUG);
 #endif
     } else {
@@ -1742,8 +1730,8 @@ int txp::Msg::build_IO_Vector() {
 #endif
             // Build the I/O vector
             int32_t l_NumberOfVectorElements = 0;
-            if (msgAttributes) {
-                for(std::vector<Attribute*>::iterator it = msgAttributes->begin(); it != msgAttributes->end(); ++it) {
+            if (!msgAttributes.empty()) {
+                for(Attribute** it = msgAttributes.orderBegin(); it != msgAttributes.orderEnd(); ++it) {
 #ifdef TXP_DEVELOPMENT
                     (*it)->dump(d_log, "Attribute");
 #endif
@@ -1896,7 +1884,7 @@ int txp::Msg::build_IO_Vector() {
 #ifdef TXP_DEVELOPMENT
         char l_MsgId[64] = {'\0'};
         msgIdToChar(getMsgId(), l_MsgId, sizeof(l_MsgId));
-        snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg(%p) associated with IO_Vector(%p), %s, %lu attributes, %d vectors", this, msg_IO_Vector, l_MsgId, (msgAttrMap ? msgAttrMap->size() : 0), msg_IO_VectorCount);
+        snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg(%p) associated with IO_Vector(%p), %s, %lu attributes, %d vectors", this, msg_IO_Vector, l_MsgId, msgAttributes.size(), msg_IO_VectorCount);
         d_log.write(d_log_buffer, txp::Log::DBG2, txp::Log::C_DTOR_LOGLEVEL);
     } else {
         snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg::build_IO_Vector(), RC=%d", l_RC);
@@ -2038,7 +2026,7 @@ int txp::Msg::deserializeAttrsToMsg(HeapBuffer* pHeapBuffer, const txp::Deserial
         while (l_Offset<l_MsgLength && l_RC == 0) {
             l_Attr = 0;
             l_AttrLength = 0;
-            l_RC = txp::Attribute::buildAttr(pHeapBuffer, l_Offset, l_Attr, l_AttrLength, pOption, l_PtrCalcMsgCRC);
+            l_RC = txp::Attribute::buildAttr(pHeapBuffer, l_Offset, l_Attr, l_AttrLength, pOption, l_PtrCalcMsgCRC, &msgAttributeSlab);
             if (!l_RC) {
                 l_RC = addAttribute(l_Attr);
                 l_Offset += l_AttrLength;
@@ -2047,7 +2035,7 @@ int txp::Msg::deserializeAttrsToMsg(HeapBuffer* pHeapBuffer, const txp::Deserial
             // If the add failed, delete the attribute...
             if (l_RC && l_Attr)
             {
-                delete l_Attr;
+                txp::Attribute::destroyAttr(l_Attr);
             }
         }
 
@@ -2067,7 +2055,7 @@ int txp::Msg::deserializeAttrsToMsg(HeapBuffer* pHeapBuffer, const txp::Deserial
         d_log.write(d_log_buffer, txp::Log::ERROR);
 
     } else {
-        snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg(%p) %s, Msg#=%d, #Attrs=%lu, RC=%d", this, l_MsgId, msgNumber, (msgAttrMap ? msgAttrMap->size() : 0), l_RC);
+        snprintf(d_log_buffer, sizeof(d_log_buffer), "Msg(%p) %s, Msg#=%d, #Attrs=%lu, RC=%d", this, l_MsgId, msgNumber, msgAttributes.size(), l_RC);
         d_log.write(d_log_buffer, txp::Log::DEBUG);
         this->dump(d_log, "Deserialized message with attributes");
     }
@@ -2142,21 +2130,11 @@ void txp::Msg::dump(Log& pLog, const char* pPrefix, const int pDumpRawHeapBuffer
         pLog.write(d_log_buffer, txp::Log::DEBUG, txp::Log::DEFAULT_OPEN_DUMP_LOGLEVEL);
 
         pLog.write(" ", txp::Log::DEBUG, txp::Log::DEFAULT_OPEN_DUMP_LOGLEVEL);
-        snprintf(d_log_buffer, sizeof(d_log_buffer), "Attribute Map:         %p", msgAttrMap);
+        snprintf(d_log_buffer, sizeof(d_log_buffer), "Attributes:            %p", &msgAttributes);
         pLog.write(d_log_buffer, txp::Log::DEBUG, txp::Log::DEFAULT_OPEN_DUMP_LOGLEVEL);
-        if (msgAttrMap) {
-            snprintf(d_log_buffer, sizeof(d_log_buffer), "Attribute Map Count:   0x%08X (%6lu)", (unsigned int)msgAttrMap->size(), msgAttrMap->size());
-            pLog.write(d_log_buffer, txp::Log::DEBUG, txp::Log::DEFAULT_OPEN_DUMP_LOGLEVEL);
-        }
-
-        pLog.write(" ", txp::Log::DEBUG, txp::Log::DEFAULT_OPEN_DUMP_LOGLEVEL);
-        snprintf(d_log_buffer, sizeof(d_log_buffer), "Attributes:            %p", msgAttributes);
+        snprintf(d_log_buffer, sizeof(d_log_buffer), "Attribute Count:       0x%08X (%6lu)", (unsigned int)msgAttributes.size(), msgAttributes.size());
         pLog.write(d_log_buffer, txp::Log::DEBUG, txp::Log::DEFAULT_OPEN_DUMP_LOGLEVEL);
-        if (msgAttributes) {
-            snprintf(d_log_buffer, sizeof(d_log_buffer), "Attribute Count:       0x%08X (%6lu)", (unsigned int)msgAttributes->size(), msgAttributes->size());
-            pLog.write(d_log_buffer, txp::Log::DEBUG, txp::Log::DEFAULT_OPEN_DUMP_LOGLEVEL);
-            dump_msgAttributes(msgAttributes, pLog, pPrefix);
-        }
+        dump_msgAttributes(&msgAttributes, pLog, pPrefix);
 
         pLog.write(" ", txp::Log::DEBUG, txp::Log::DEFAULT_OPEN_DUMP_LOGLEVEL);
         snprintf(d_log_buffer, sizeof(d_log_buffer), "Heap Buffer:           %p", msgHeapBuffer);
@@ -2173,14 +2151,14 @@ void txp::Msg::dump(Log& pLog, const char* pPrefix, const int pDumpRawHeapBuffer
 }
 
 
-void txp::Msg::dump_msgAttributes(std::vector<Attribute*>* pMsgAttributes, Log& pLog, const char* pPrefix) {
+void txp::Msg::dump_msgAttributes(AttributeIndex* pMsgAttributes, Log& pLog, const char* pPrefix) {
 #ifdef TXP_DEVELOPMENT
     if (pLog.logLevelCheck(txp::Log::DEFAULT_OPEN_DUMP_LOGLEVEL)) {
         if (pMsgAttributes) {
             START_PREFIX(pPrefix, ">>>>> Start dump for message attributes:  %s");
 
             unsigned int i=1;
-            for(std::vector<Attribute*>::iterator it = pMsgAttributes->begin(); it != pMsgAttributes->end(); ++i, ++it) {
+            for(Attribute** it = pMsgAttributes->orderBegin(); it != pMsgAttributes->orderEnd(); ++i, ++it) {
                 snprintf(d_log_buffer, sizeof(d_log_buffer), ">>>>> Start dump for attribute %d", i);
                 pLog.write(d_log_buffer, txp::Log::DEBUG, txp::Log::DEFAULT_OPEN_DUMP_LOGLEVEL);
 
@@ -2282,23 +2260,20 @@ txp::Attribute* txp::Msg::retrieveAttr(const int32_t pNameValue) {
 
 
 txp::Attribute* txp::Msg::retrieveAttr(const txp::AttributeName &pName) {
-    std::map<txp::AttributeName, Attribute*>::iterator it;
     Attribute* l_AttrPtr = 0;
 
-    if (msgAttrMap) {
-        it = msgAttrMap->find(pName);
-        if (it != msgAttrMap->end()) {
-            l_AttrPtr = it->second;
-        }
+    AttributeIndex::iterator it = msgAttributes.find(pName);
+    if (it != msgAttributes.end()) {
+        l_AttrPtr = it->second;
     }
 
     return l_AttrPtr;
 }
 
 
-std::map<txp::AttributeName, txp::Attribute*>* txp::Msg::retrieveAttrs() {
+txp::Msg::AttributeMap* txp::Msg::retrieveAttrs() {
 
-    return msgAttrMap;
+    return &msgAttributes;
 }
 
 
@@ -2476,8 +2451,8 @@ ssize_t txp::Msg::serializeToHeapBuffer(size_t pDataAlignment, int pCalculateCRC
             }
 
             // Build each of the message attributes...
-            if (msgAttributes) {
-                for(std::vector<Attribute*>::iterator it = msgAttributes->begin(); it != msgAttributes->end() && l_RC == 0; ++it) {
+            if (!msgAttributes.empty()) {
+                for(Attribute** it = msgAttributes.orderBegin(); it != msgAttributes.orderEnd() && l_RC == 0; ++it) {
 //                  if (pCalculateCRC) {
 //                      printf("serializeToHeapBuffer: Before: l_PtrMsgCRC=%p, *l_PtrMsgCRC=0x%016lX\n", l_PtrMsgCRC, *l_PtrMsgCRC);
 //                  }
@@ -2516,7 +2491,7 @@ ssize_t txp::Msg::serializeToHeapBuffer(size_t pDataAlignment, int pCalculateCRC
     msgIdToChar(getMsgId(), l_MsgId, sizeof(l_MsgId));
     snprintf(d_log_buffer, sizeof(d_log_buffer),
              "serializeToHeapBuffer(): %s, Msg#=%d, #Attrs=%lu, RC=%zu",
-             l_MsgId, msgNumber, (msgAttributes ? msgAttributes->size() : 0), l_RC);
+             l_MsgId, msgNumber, msgAttributes.size(), l_RC);
     if (l_RC > 0) {
         d_log.write(d_log_buffer, txp::Log::DEBUG);
     } else {
@@ -2569,8 +2544,8 @@ ssize_t txp::Msg::serializeWithValuesToHeapBuffer(size_t pDataAlignment, int pCa
             }
 
             // Build each of the message attributes...
-            if (msgAttributes) {
-                for(std::vector<Attribute*>::iterator it = msgAttributes->begin(); it != msgAttributes->end() && l_RC == 0; ++it) {
+            if (!msgAttributes.empty()) {
+                for(Attribute** it = msgAttributes.orderBegin(); it != msgAttributes.orderEnd() && l_RC == 0; ++it) {
 //                  if (pCalculateCRC) {
 //                      printf("serializeWithValuesToHeapBuffer: Before: l_PtrMsgCRC=%p, *l_PtrMsgCRC=0x%016lX\n", l_PtrMsgCRC, *l_PtrMsgCRC);
 //                  }
@@ -2609,7 +2584,7 @@ ssize_t txp::Msg::serializeWithValuesToHeapBuffer(size_t pDataAlignment, int pCa
     msgIdToChar(getMsgId(), l_MsgId, sizeof(l_MsgId));
     snprintf(d_log_buffer, sizeof(d_log_buffer),
              "serializeWithValuesToHeapBuffer(): %s, Msg#=%d, #Attrs=%lu, RC=%zu",
-             l_MsgId, msgNumber, (msgAttributes ? msgAttributes->size() : 0), l_RC);
+             l_MsgId, msgNumber, msgAttributes.size(), l_RC);
     if (l_RC > 0) {
         d_log.write(d_log_buffer, txp::Log::DEBUG);
     } else {
@@ -0,0 +1,200 @@
+/*******************************************************************************
+ |    ObjectPool.cc
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+#include <new>
+
+#include <pthread.h>
+
+#include "ObjectPool.h"
+
+namespace {
+
+struct FreeObject {
+    FreeObject* next;
+};
+
+struct FreeList {
+    FreeObject* head;
+    size_t      count;
+};
+
+struct ThreadCache {
+    FreeList    sizeClass[txp::ObjectPool::NUMBER_OF_SIZE_CLASSES];
+};
+
+// Shared depot for objects spilled from, or left behind by, the per-thread caches
+FreeList        depot[txp::ObjectPool::NUMBER_OF_SIZE_CLASSES];
+pthread_mutex_t depotMutex = PTHREAD_MUTEX_INITIALIZER;
+
+pthread_key_t   cacheKey;
+pthread_once_t  cacheKeyOnce = PTHREAD_ONCE_INIT;
+
+// NOTE:  After the thread specific destructor ran for a thread, any further
+//        objects released by that thread go straight to the depot.
+ThreadCache* const CACHE_TORN_DOWN = (ThreadCache*)1;
+__thread ThreadCache* threadCache = 0;
+
+
+inline size_t sizeClassIndex(const size_t pSize) {
+    return (pSize ? (pSize - 1) / txp::ObjectPool::SIZE_CLASS_GRANULE : 0);
+}
+
+
+// Moves up to pCount objects from the head of pSource to pTarget
+void moveObjects(FreeList& pSource, FreeList& pTarget, size_t pCount) {
+    while (pCount-- && pSource.head) {
+        FreeObject* l_Object = pSource.head;
+        pSource.head = l_Object->next;
+        --pSource.count;
+        l_Object->next = pTarget.head;
+        pTarget.head = l_Object;
+        ++pTarget.count;
+    }
+
+    return;
+}
+
+
+void releaseThreadCache(void* pCache) {
+    ThreadCache* l_Cache = (ThreadCache*)pCache;
+
+    pthread_mutex_lock(&depotMutex);
+    for (size_t i=0; i<txp::ObjectPool::NUMBER_OF_SIZE_CLASSES; ++i) {
+        moveObjects(l_Cache->sizeClass[i], depot[i], l_Cache->sizeClass[i].count);
+    }
+    pthread_mutex_unlock(&depotMutex);
+
+    threadCache = CACHE_TORN_DOWN;
+    free(l_Cache);
+
+    return;
+}
+
+
+void createCacheKey() {
+    pthread_key_create(&cacheKey, releaseThreadCache);
+
+    return;
+}
+
+
+ThreadCache* getThreadCache() {
+    if (!threadCache) {
+        pthread_once(&cacheKeyOnce, createCacheKey);
+        ThreadCache* l_Cache = (ThreadCache*)calloc(1, sizeof(ThreadCache));
+        if (l_Cache) {
+            threadCache = l_Cache;
+            pthread_setspecific(cacheKey, l_Cache);
+        } else {
+            return CACHE_TORN_DOWN;
+        }
+    }
+
+    return threadCache;
+}
+
+
+// Refills pList from the depot, or carves a new slab if the depot has nothing
+int refill(FreeList& pList, const size_t pIndex) {
+    pthread_mutex_lock(&depotMutex);
+    moveObjects(depot[pIndex], pList, txp::ObjectPool::OBJECTS_PER_SLAB);
+    pthread_mutex_unlock(&depotMutex);
+
+    if (!pList.head) {
+        size_t l_ObjectSize = (pIndex + 1) * txp::ObjectPool::SIZE_CLASS_GRANULE;
+        char* l_Slab = (char*)malloc(l_ObjectSize * txp::ObjectPool::OBJECTS_PER_SLAB);
+        if (!l_Slab) {
+            return -1;
+        }
+        for (size_t i=txp::ObjectPool::OBJECTS_PER_SLAB; i>0; --i) {
+            FreeObject* l_Object = (FreeObject*)(l_Slab + (i - 1) * l_ObjectSize);
+            l_Object->next = pList.head;
+            pList.head = l_Object;
+            ++pList.count;
+        }
+    }
+
+    return 0;
+}
+
+} // namespace
+
+
+//*****************************************************************************
+//  Static methods
+//*****************************************************************************
+void* txp::ObjectPool::allocate(const size_t pSize) {
+    void* l_Object = 0;
+
+    if (pSize <= MAXIMUM_POOLED_SIZE) {
+        size_t l_Index = sizeClassIndex(pSize);
+        ThreadCache* l_Cache = getThreadCache();
+        if (l_Cache != CACHE_TORN_DOWN) {
+            FreeList& l_List = l_Cache->sizeClass[l_Index];
+            if (l_List.head || refill(l_List, l_Index) == 0) {
+                FreeObject* l_FreeObject = l_List.head;
+                l_List.head = l_FreeObject->next;
+                --l_List.count;
+                l_Object = l_FreeObject;
+            }
+        } else {
+            l_Object = malloc((l_Index + 1) * SIZE_CLASS_GRANULE);
+        }
+        if (!l_Object) {
+            throw std::bad_alloc();
+        }
+    } else {
+        l_Object = ::operator new(pSize);
+    }
+
+    return l_Object;
+}
+
+
+void txp::ObjectPool::release(void* pObject, const size_t pSize) {
+    if (!pObject) {
+        return;
+    }
+
+    if (pSize <= MAXIMUM_POOLED_SIZE) {
+        size_t l_Index = sizeClassIndex(pSize);
+        FreeObject* l_Object = (FreeObject*)pObject;
+        ThreadCache* l_Cache = (threadCache ? threadCache : getThreadCache());
+        if (l_Cache != CACHE_TORN_DOWN) {
+            FreeList& l_List = l_Cache->sizeClass[l_Index];
+            l_Object->next = l_List.head;
+            l_List.head = l_Object;
+            ++l_List.count;
+
+            // Keep the per-thread free-list bounded.  Messages are commonly
+            // built on one thread and deleted on another...
+            if (l_List.count > MAXIMUM_PER_THREAD) {
+                pthread_mutex_lock(&depotMutex);
+                moveObjects(l_List, depot[l_Index], l_List.count - (MAXIMUM_PER_THREAD / 2));
+                pthread_mutex_unlock(&depotMutex);
+            }
+        } else {
+            // NOTE:  Storage may have come from a slab, so it can never be
+            //        given back to the heap.  Park it in the depot instead.
+            pthread_mutex_lock(&depotMutex);
+            l_Object->next = depot[l_Index].head;
+            depot[l_Index].head = l_Object;
+            ++depot[l_Index].count;
+            pthread_mutex_unlock(&depotMutex);
+        }
+    } else {
+        ::operator delete(pObject);
+    }
+
+    return;
+}
@@ -0,0 +1,252 @@
+/*******************************************************************************
+ |    msg_test.cc
+ |
+ |  © Copyright IBM Corporation 2015,2016. All Rights Reserved
+ |
+ |    This program is licensed under the terms of the Eclipse Public License
+ |    v1.0 as published by the Eclipse Foundation and available at
+ |    http://www.eclipse.org/legal/epl-v10.html
+ |
+ |    U.S. Government Users Restricted Rights:  Use, duplication or disclosure
+ |    restricted by GSA ADP Schedule Contract with IBM Corp.
+ *******************************************************************************/
+
+//
+// Exercises the attribute index and attribute storage of txp::Msg without a
+// connection: lookups by name below and past the inline capacity, insertion
+// order kept through a serialize/deserialize round trip, attributes carved
+// from the slab of their message, and Msg storage handed out again after the
+// message is deleted, also when it was deleted on another thread.
+//
+
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+
+#include "Msg.h"
+#include "csmutil/include/csm_test_utils.h"
+
+static int failures = 0;
+
+// more attributes than the index keeps inline
+static const int32_t NUMBER_OF_ATTRIBUTES = 3 * txp::AttributeIndex::INLINE_CAPACITY;
+
+static txp::AttributeName nameFor(const int32_t pIndex) {
+    // added in descending name order, so insertion and name order differ
+    return (txp::AttributeName)(NUMBER_OF_ATTRIBUTES - pIndex);
+}
+
+static uint64_t valueFor(const int32_t pIndex) {
+    return 0x1000 + pIndex;
+}
+
+static txp::Msg* buildMsg(const int32_t pNumberOfAttributes) {
+    txp::Msg* l_Msg = 0;
+    if (txp::Msg::buildMsg(txp::CORAL_NO_OP, l_Msg)) {
+        return 0;
+    }
+    for (int32_t i=0; i<pNumberOfAttributes; ++i) {
+        if (l_Msg->addAttribute(nameFor(i), valueFor(i))) {
+            delete l_Msg;
+            return 0;
+        }
+    }
+
+    return l_Msg;
+}
+
+// the attributes of pMsg are the first pNumberOfAttributes built by buildMsg()
+static int checkAttributes(txp::Msg* pMsg, const int32_t pNumberOfAttributes) {
+    txp::AttributeIndex* l_Index = pMsg->getAttributesPtr();
+    if (pMsg->getNumberOfAttributes() != pNumberOfAttributes) {
+        return 0;
+    }
+
+    int32_t i = 0;
+    for (txp::Attribute** it = l_Index->orderBegin(); it != l_Index->orderEnd(); ++it, ++i) {
+        if ((*it)->getAttrName() != nameFor(i)) {
+            return 0;
+        }
+    }
+    for (i=0; i<pNumberOfAttributes; ++i) {
+        txp::Attr_uint64* l_Attr = (txp::Attr_uint64*)pMsg->retrieveAttr(nameFor(i));
+        if (!l_Attr || l_Attr->getAttrName() != nameFor(i) || l_Attr->getData() != valueFor(i)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static void testIndex() {
+    txp::Msg* l_Msg = buildMsg(0);
+    CHECK(l_Msg, "message not built");
+    if (!l_Msg) {
+        return;
+    }
+
+    txp::AttributeIndex* l_Index = l_Msg->getAttributesPtr();
+    CHECK(l_Index->empty() && l_Index->begin() == l_Index->end(), "new message has attributes");
+    CHECK(l_Index->find(nameFor(0)) == l_Index->end(), "lookup in an empty index found an entry");
+
+    for (int32_t i=0; i<NUMBER_OF_ATTRIBUTES; ++i) {
+        CHECK(!l_Msg->addAttribute(nameFor(i), valueFor(i)), "attribute %d not added", i);
+        // every attribute added so far is found, while inline and once grown
+        if (i == txp::AttributeIndex::INLINE_CAPACITY - 1 ||
+            i == txp::AttributeIndex::INLINE_CAPACITY ||
+            i == NUMBER_OF_ATTRIBUTES - 1) {
+            CHECK(checkAttributes(l_Msg, i + 1), "lookup wrong with %d attributes", i + 1);
+        }
+    }
+    CHECK(l_Msg->getNumberOfAttributes() == NUMBER_OF_ATTRIBUTES, "%d attributes in the index", l_Msg->getNumberOfAttributes());
+
+    // begin()/end() are in name order, find() and at() agree with retrieveAttr()
+    txp::AttributeName l_Previous = txp::ATTRIBUTE_NAME_INVALID;
+    bool l_Sorted = true;
+    for (txp::AttributeIndex::iterator it = l_Index->begin(); it != l_Index->end(); ++it) {
+        l_Sorted = l_Sorted && (it->first > l_Previous) && (it->second->getAttrName() == it->first);
+        l_Previous = it->first;
+    }
+    CHECK(l_Sorted, "index not in name order");
+    txp::AttributeIndex::iterator it = l_Index->find(nameFor(5));
+    CHECK(it != l_Index->end() && it->second == l_Msg->retrieveAttr(nameFor(5)), "find() disagrees with retrieveAttr()");
+    bool l_Agrees = false;
+    try {
+        l_Agrees = (l_Index->at(nameFor(40)) == l_Msg->retrieveAttr(nameFor(40)));
+    } catch (std::out_of_range& e) {
+    }
+    CHECK(l_Agrees, "at() disagrees with retrieveAttr()");
+
+    // a name not added is not found, at() throws like std::map::at()
+    txp::AttributeName l_Missing = (txp::AttributeName)(NUMBER_OF_ATTRIBUTES + 1);
+    CHECK(l_Index->find(l_Missing) == l_Index->end() && !l_Msg->retrieveAttr(l_Missing), "missing attribute found");
+    bool l_Thrown = false;
+    try {
+        l_Index->at(l_Missing);
+    } catch (std::out_of_range& e) {
+        l_Thrown = true;
+    }
+    CHECK(l_Thrown, "at() of a missing attribute did not throw std::out_of_range");
+
+    // a name is only added once
+    CHECK(l_Msg->addAttribute(nameFor(3), valueFor(0)) == -30, "duplicate attribute added");
+    CHECK(l_Msg->addAttribute(nameFor(30), valueFor(0)) == -30, "duplicate attribute added past the inline capacity");
+    CHECK(checkAttributes(l_Msg, NUMBER_OF_ATTRIBUTES), "duplicate add changed the index");
+
+    delete l_Msg;
+}
+
+static void testRoundTrip() {
+    txp::Msg* l_Msg = buildMsg(NUMBER_OF_ATTRIBUTES);
+    CHECK(l_Msg, "message not built");
+    if (!l_Msg) {
+        return;
+    }
+
+    l_Msg->allocateHeapBuffer(l_Msg->getMsgLengthWithDataValues() + 1024);
+    int32_t l_DataLen = l_Msg->serializeWithValuesToHeapBuffer();
+    CHECK(l_DataLen > 0, "message with %d attributes not serialized, rc=%d", NUMBER_OF_ATTRIBUTES, l_DataLen);
+
+    std::vector<char> l_Buffer(l_Msg->getDataBufferPtr(), l_Msg->getDataBufferPtr() + (l_DataLen > 0 ? l_DataLen : 0));
+    delete l_Msg;
+
+    // attributes come back in the order they were added, found by name
+    txp::Msg* l_Copy = 0;
+    ssize_t l_TotalMsgSize = 0;
+    if (l_DataLen > 0) {
+        int l_RC = txp::Msg::deserializeToMsg(l_Copy, &l_Buffer[0], l_Buffer.size(), l_TotalMsgSize);
+        CHECK(!l_RC && l_Copy, "message not deserialized, rc=%d", l_RC);
+    }
+    if (l_Copy) {
+        CHECK(l_TotalMsgSize == l_DataLen, "deserialized %zd of %d bytes", l_TotalMsgSize, l_DataLen);
+        CHECK(checkAttributes(l_Copy, NUMBER_OF_ATTRIBUTES), "attributes differ after the round trip");
+        CHECK(l_Copy->retrieveAttr(nameFor(0))->isSlabAllocated(), "deserialized attribute not carved from the slab");
+        delete l_Copy;
+    }
+}
+
+// the storage of pAttribute is part of pMsg, i.e., the inline storage of its slab
+static int isInline(txp::Msg* pMsg, txp::Attribute* pAttribute) {
+    return ((char*)pAttribute >= (char*)pMsg) && ((char*)pAttribute < (char*)(pMsg + 1));
+}
+
+static void testStorage() {
+    // attributes a message builds are carved from its slab, the first ones
+    // from the inline storage of the message itself
+    txp::Msg* l_Msg = buildMsg(NUMBER_OF_ATTRIBUTES);
+    CHECK(l_Msg, "message not built");
+    if (!l_Msg) {
+        return;
+    }
+    int32_t l_NotInSlab = 0;
+    for (int32_t i=0; i<NUMBER_OF_ATTRIBUTES; ++i) {
+        l_NotInSlab += !l_Msg->retrieveAttr(nameFor(i))->isSlabAllocated();
+    }
+    CHECK(l_NotInSlab == 0, "%d attributes not carved from the slab", l_NotInSlab);
+    CHECK(isInline(l_Msg, l_Msg->retrieveAttr(nameFor(0))), "first attribute not in the inline storage");
+    CHECK(!isInline(l_Msg, l_Msg->retrieveAttr(nameFor(NUMBER_OF_ATTRIBUTES - 1))), "inline storage overrun");
+
+    // an attribute of another message is cloned into the slab of this one
+    txp::Msg* l_Other = buildMsg(0);
+    txp::Attribute* l_Attr = l_Msg->retrieveAttr(nameFor(0));
+    CHECK(l_Other && !l_Other->addAttribute(l_Attr), "attribute of another message not added");
+    if (l_Other) {
+        txp::Attribute* l_Clone = l_Other->retrieveAttr(nameFor(0));
+        CHECK(l_Clone && l_Clone != l_Attr && isInline(l_Other, l_Clone), "attribute not cloned into the slab");
+        delete l_Other;
+    }
+    CHECK(checkAttributes(l_Msg, NUMBER_OF_ATTRIBUTES), "attributes changed by deleting the clone");
+
+    // a deleted message is handed out again, inline storage included
+    void* l_MsgStorage = l_Msg;
+    delete l_Msg;
+    l_Msg = buildMsg(1);
+    CHECK((void*)l_Msg == l_MsgStorage, "message storage not reused");
+    if (l_Msg) {
+        CHECK(l_Msg->getNumberOfAttributes() == 1 && isInline(l_Msg, l_Msg->retrieveAttr(nameFor(0))) &&
+              checkAttributes(l_Msg, 1), "reused message not reset");
+        delete l_Msg;
+    }
+
+    // an attribute built by the caller keeps its pooled storage and is owned
+    // by the message it is added to
+    txp::Attr_uint64* l_Built = 0;
+    CHECK(!txp::Attr_uint64::buildAttr_uint64(nameFor(1), valueFor(1), l_Built) && !l_Built->isSlabAllocated(),
+          "attribute built by the caller carved from a slab");
+    l_Msg = buildMsg(0);
+    if (l_Msg && l_Built) {
+        CHECK(!l_Msg->addAttribute(l_Built) && l_Msg->retrieveAttr(nameFor(1)) == l_Built,
+              "attribute built by the caller not added");
+    }
+    delete l_Msg;
+
+    // messages deleted on another thread are handed out to this one
+    std::vector<txp::Msg*> l_Msgs;
+    std::set<void*> l_Released;
+    for (size_t i=0; i<4; ++i) {
+        l_Msgs.push_back(buildMsg(0));
+        l_Released.insert(l_Msgs.back());
+    }
+    std::thread([&l_Msgs]() {
+        for (size_t i=0; i<l_Msgs.size(); ++i) {
+            delete l_Msgs[i];
+        }
+    }).join();
+
+    l_Msg = buildMsg(0);
+    CHECK(l_Released.count(l_Msg), "message deleted on another thread not reused");
+    delete l_Msg;
+}
+
+int main(int argc, char** argv) {
+    testIndex();
+    testRoundTrip();
+    testStorage();
+
+    printf("msg_test: %d failure(s)\n", failures);
+
+    return failures ? 1 : 0;
+}